@@ -73,6 +73,18 @@ if (OTBR_DUA_ROUTING)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DUA_ROUTING=1)
 endif()
 
+cmake_dependent_option(OTBR_DUA_DAD_SCHEDULER "Pace the Backbone Queries of the DUA duplicate address detection" OFF "OTBR_BACKBONE_ROUTER" OFF)
+if (OTBR_DUA_DAD_SCHEDULER)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DUA_DAD_SCHEDULER=1)
+endif()
+
+# Conflicts with the multicast routing of OpenThread POSIX (OT_BACKBONE_ROUTER_MULTICAST_ROUTING), only one of them may
+# own the multicast router socket.
+option(OTBR_MLR_ROUTING "Enable Backbone Router Multicast Listener Registration routing" OFF)
+if (OTBR_MLR_ROUTING)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MLR_ROUTING=1)
+endif()
+
 option(OTBR_OPENWRT "Enable OpenWrt support" OFF)
 if(OTBR_OPENWRT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_OPENWRT=1)
@@ -83,6 +95,11 @@ if(OTBR_REST)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_REST_SERVER=1)
 endif()
 
+cmake_dependent_option(OTBR_REST_GZIP "Enable gzip compressed Rest Server responses" OFF "OTBR_REST" OFF)
+if(OTBR_REST_GZIP)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_REST_GZIP=1)
+endif()
+
 option(OTBR_SRP_ADVERTISING_PROXY "Enable Advertising Proxy" OFF)
 if (OTBR_SRP_ADVERTISING_PROXY)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_SRP_ADVERTISING_PROXY=1)
@@ -108,6 +125,11 @@ if(OTBR_TREL)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TREL=1)
 endif()
 
+cmake_dependent_option(OTBR_TREL_BATCHED_IO "Send and receive the TREL packets with batched system calls" OFF "OTBR_TREL" OFF)
+if (OTBR_TREL_BATCHED_IO)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TREL_BATCHED_IO=1)
+endif()
+
 option(OTBR_EPSKC "Enable ephemeral PSKc" ON)
 if (OTBR_EPSKC)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPSKC=1)
@@ -141,6 +163,11 @@ if (OTBR_DNS_UPSTREAM_QUERY)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DNS_UPSTREAM_QUERY=1)
 endif()
 
+cmake_dependent_option(OTBR_DNS_UPSTREAM_RESOLVER "Resolve the upstream DNS queries with the caching resolver of the agent" OFF "OTBR_DNS_UPSTREAM_QUERY" OFF)
+if (OTBR_DNS_UPSTREAM_RESOLVER)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DNS_UPSTREAM_RESOLVER=1)
+endif()
+
 option(OTBR_PUBLISH_MESHCOP_BA_ID "Publish the MeshCoP mDNS 'id' TXT entry, enable this feature only when 'id' is not set via dbus API" ON)
 if (OTBR_PUBLISH_MESHCOP_BA_ID)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_PUBLISH_MESHCOP_BA_ID=1)
@@ -158,9 +185,111 @@ if (OTBR_VENDOR_SERVER)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_VENDOR_SERVER=1)
 endif()
 
+option(OTBR_MAINLOOP_EPOLL "Watch registered mainloop fds with epoll (Linux) or kqueue (BSD)" ON)
+if (OTBR_MAINLOOP_EPOLL)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MAINLOOP_EPOLL=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MAINLOOP_EPOLL=0)
+endif()
+
+option(OTBR_MAINLOOP_STATS "Enable per-processor mainloop timing statistics" OFF)
+if (OTBR_MAINLOOP_STATS)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MAINLOOP_STATS=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MAINLOOP_STATS=0)
+endif()
+
+option(OTBR_RADIO_THREAD "Allow processing the Thread stack on a dedicated radio thread in RCP mode" OFF)
+if (OTBR_RADIO_THREAD)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_RADIO_THREAD=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_RADIO_THREAD=0)
+endif()
+
+option(OTBR_MDNS_THREAD "Allow processing the mDNSResponder publisher on a dedicated mDNS thread" OFF)
+if (OTBR_MDNS_THREAD)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MDNS_THREAD=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MDNS_THREAD=0)
+endif()
+
+option(OTBR_NETIF_MULTI_QUEUE_TUN "Open the Thread TUN device with multiple queues and virtio-net headers" OFF)
+if (OTBR_NETIF_MULTI_QUEUE_TUN)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NETIF_MULTI_QUEUE_TUN=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NETIF_MULTI_QUEUE_TUN=0)
+endif()
+
+option(OTBR_TASK_RUNNER_TIMER_WHEEL "Use a timer wheel for TaskRunner delayed tasks" OFF)
+if (OTBR_TASK_RUNNER_TIMER_WHEEL)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TASK_RUNNER_TIMER_WHEEL=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TASK_RUNNER_TIMER_WHEEL=0)
+endif()
+
+option(OTBR_LOG_ASYNC "Write logs from a background thread instead of the calling thread" OFF)
+if (OTBR_LOG_ASYNC)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LOG_ASYNC=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LOG_ASYNC=0)
+endif()
+
+option(OTBR_LOG_BINARY "Allow writing logs to a binary log file with deferred formatting" OFF)
+if (OTBR_LOG_BINARY)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LOG_BINARY=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LOG_BINARY=0)
+endif()
+
+option(OTBR_FIREWALL "Enable the border routing firewall in otbr-agent, instead of the otbr-firewall service" OFF)
+if (OTBR_FIREWALL)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_FIREWALL=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_FIREWALL=0)
+endif()
+
+option(OTBR_WARM_RESTART "Persist the host-side caches in a snapshot for warm restarts" OFF)
+if (OTBR_WARM_RESTART)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_WARM_RESTART=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_WARM_RESTART=0)
+endif()
+
 option(OTBR_LINK_METRICS_TELEMETRY "Enable Link Metrics Telemetry Upload" OFF)
 if (OTBR_LINK_METRICS_TELEMETRY)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LINK_METRICS_TELEMETRY=1)
 else()
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LINK_METRICS_TELEMETRY=0)
 endif()
+
+option(OTBR_USDT_PROBES "Compile in USDT probes on the hot paths for tracing with bpftrace or perf, requires sys/sdt.h" OFF)
+if (OTBR_USDT_PROBES)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_USDT_PROBES=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_USDT_PROBES=0)
+endif()
+
+option(OTBR_PACKET_CAPTURE "Capture the recent Thread datagrams and spinel frames in a ring, dumped as pcapng over D-Bus" OFF)
+if (OTBR_PACKET_CAPTURE)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_PACKET_CAPTURE=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_PACKET_CAPTURE=0)
+endif()
+
+option(OTBR_COROUTINES "Enable the C++20 coroutine awaitables of the Task Runner and the async callbacks" OFF)
+if (OTBR_COROUTINES)
+    if (NOT CMAKE_CXX_STANDARD OR CMAKE_CXX_STANDARD LESS 20)
+        set(CMAKE_CXX_STANDARD 20)
+        set(CMAKE_CXX_STANDARD_REQUIRED ON)
+    endif()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_COROUTINES=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_COROUTINES=0)
+endif()
+
+option(OTBR_LOW_MEMORY "Build the small footprint profile for low RAM devices, with smaller caches and compact containers" OFF)
+if (OTBR_LOW_MEMORY)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LOW_MEMORY=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LOW_MEMORY=0)
+endif()
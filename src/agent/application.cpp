@@ -37,14 +37,83 @@
 #include <systemd/sd-daemon.h>
 #endif
 
+#include <errno.h>
+#include <net/if.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+
 #include "agent/application.hpp"
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/probes.hpp"
+#include "common/startup_stats.hpp"
+#include "utils/config_file.hpp"
 #include "utils/infra_link_selector.hpp"
+#include "utils/snapshot.hpp"
 
 namespace otbr {
 
+namespace {
+
+// The keys of the configuration file, named after the command line options where there is one.
+constexpr char kConfigDebugLevel[]          = "debug-level";
+constexpr char kConfigTagDebugLevel[]       = "tag-debug-level";
+constexpr char kConfigRestListenAddress[]   = "rest-listen-address";
+constexpr char kConfigRestListenPort[]      = "rest-listen-port";
+constexpr char kConfigBackboneIfName[]      = "backbone-ifname";
+constexpr char kConfigMdnsPublicationPace[] = "mdns-publication-pace";
+constexpr char kConfigMdnsIfNames[]         = "mdns-ifnames";
+constexpr char kConfigMeshCopInstanceName[] = "meshcop-instance-name";
+constexpr char kConfigVendorName[]          = "vendor-name";
+constexpr char kConfigProductName[]         = "product-name";
+
+bool ParseConfigInteger(const std::string &aValue, long aMin, long aMax, long &aResult)
+{
+    bool  successful = true;
+    char *end;
+
+    VerifyOrExit(!aValue.empty(), successful = false);
+    errno   = 0;
+    aResult = strtol(aValue.c_str(), &end, 0);
+    VerifyOrExit(errno != ERANGE && *end == '\0', successful = false);
+    VerifyOrExit(aMin <= aResult && aResult <= aMax, successful = false);
+
+exit:
+    return successful;
+}
+
+bool ParseConfigInterfaces(const std::string &aValue, std::vector<uint32_t> &aInterfaces)
+{
+    bool   successful = true;
+    size_t begin      = 0;
+
+    aInterfaces.clear();
+
+    // The value is a comma separated list of interface names, empty for all the interfaces.
+    while (begin < aValue.size())
+    {
+        size_t   end   = std::min(aValue.find(',', begin), aValue.size());
+        uint32_t index = if_nametoindex(aValue.substr(begin, end - begin).c_str());
+
+        VerifyOrExit(index != 0, successful = false);
+        aInterfaces.push_back(index);
+        begin = end + 1;
+    }
+
+    std::sort(aInterfaces.begin(), aInterfaces.end());
+    aInterfaces.erase(std::unique(aInterfaces.begin(), aInterfaces.end()), aInterfaces.end());
+
+exit:
+    return successful;
+}
+
+} // namespace
+
 std::atomic_bool     Application::sShouldTerminate(false);
+std::atomic_bool     Application::sShouldReload(false);
 const struct timeval Application::kPollTimeout = {10, 0};
 
 Application::Application(const std::string               &aInterfaceName,
@@ -52,14 +121,16 @@ Application::Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
                          const std::string               &aRestListenAddress,
-                         int                              aRestListenPort)
+                         int                              aRestListenPort,
+                         const std::string               &aRestUnixSocketPath)
     : mInterfaceName(aInterfaceName)
 #if __linux__
     , mInfraLinkSelector(aBackboneInterfaceNames)
-    , mBackboneInterfaceName(mInfraLinkSelector.Select())
+    , mBackboneInterfaceName(mInfraLinkSelector.GetSelectedInfraLink())
 #else
     , mBackboneInterfaceName(aBackboneInterfaceNames.empty() ? "" : aBackboneInterfaceNames.front())
 #endif
+    , mInfraLinkChanged(false)
     , mHost(Ncp::ThreadHost::Create(mInterfaceName.c_str(),
                                     aRadioUrls,
                                     mBackboneInterfaceName,
@@ -71,16 +142,35 @@ Application::Application(const std::string               &aInterfaceName,
 #if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
     , mDBusAgent(MakeUnique<DBus::DBusAgent>(*mHost, *mPublisher))
 #endif
+#if OTBR_ENABLE_REST_SERVER
+    , mRestListenAddress(aRestListenAddress)
+    , mRestListenPort(aRestListenPort)
+#endif
 {
+#if __linux__
+    // The agent moves to the newly selected infra link in the mainloop, see `Run()`.
+    mInfraLinkSelector.SetInfraLinkChangedCallback([this](const char *aInfraLink) {
+        OTBR_UNUSED_VARIABLE(aInfraLink);
+        mInfraLinkChanged = true;
+    });
+#endif
+
     if (mHost->GetCoprocessorType() == OT_COPROCESSOR_RCP)
     {
-        CreateRcpMode(aRestListenAddress, aRestListenPort);
+        CreateRcpMode(aRestListenAddress, aRestListenPort, aRestUnixSocketPath);
     }
+
+#if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
+    mDBusAgent->SetReloadConfigHandler([this]() { return ReloadConfig(); });
+#endif
 }
 
 void Application::Init(void)
 {
-    mHost->Init();
+    StartupStats &stats = StartupStats::GetInstance();
+
+    stats.Restart();
+    stats.RunStage("host", [this]() { mHost->Init(); });
 
     switch (mHost->GetCoprocessorType())
     {
@@ -96,6 +186,12 @@ void Application::Init(void)
     }
 
     otbrLogInfo("Co-processor version: %s", mHost->GetCoprocessorVersion());
+
+    if (!mConfigFilePath.empty())
+    {
+        // The agent keeps running with the command line options if the configuration file can't be applied.
+        ReloadConfig();
+    }
 }
 
 void Application::Deinit(void)
@@ -146,12 +242,49 @@ otbrError Application::Run(void)
 
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+    signal(SIGHUP, HandleSignal);
+
+#if OTBR_ENABLE_RADIO_THREAD
+    if (mRadioThreadEnabled)
+    {
+        if (mHost->GetCoprocessorType() != OT_COPROCESSOR_RCP)
+        {
+            otbrLogWarning("The radio thread is only supported in RCP mode");
+        }
+        else
+        {
+            error = MainloopManager::GetInstance().StartRadioThread(mRadioThreadPriority, mRadioThreadCpu);
+            VerifyOrExit(error == OTBR_ERROR_NONE,
+                         otbrLogErr("Failed to start the radio thread: %s", otbrErrorString(error)));
+        }
+    }
+#endif
+
+#if OTBR_ENABLE_MDNS_THREAD
+    if (mMdnsThreadEnabled)
+    {
+#if OTBR_ENABLE_MDNS_MDNSSD
+        otbrError mdnsError = MainloopManager::GetInstance().StartMdnsThread();
+
+        // Unlike the radio thread, the mDNS thread is optional, the publisher then stays on the mainloop.
+        if (mdnsError != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to start the mDNS thread: %s", otbrErrorString(mdnsError));
+        }
+#else
+        // The other publishers dispatch their events through the registered fds, which stay on the mainloop.
+        otbrLogWarning("The mDNS thread is only supported with the mDNSResponder publisher");
+#endif
+    }
+#endif
 
     while (!sShouldTerminate)
     {
         otbr::MainloopContext mainloop;
         int                   rval;
 
+        OTBR_PROBE(mainloop__iteration__start);
+
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
 
@@ -161,18 +294,18 @@ otbrError Application::Run(void)
 
         MainloopManager::GetInstance().Update(mainloop);
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+        rval = MainloopManager::GetInstance().Poll(mainloop);
 
         if (rval >= 0)
         {
             MainloopManager::GetInstance().Process(mainloop);
 
 #if __linux__
+            if (mInfraLinkChanged)
             {
-                const char *newInfraLink = mInfraLinkSelector.Select();
+                mInfraLinkChanged = false;
 
-                if (mBackboneInterfaceName != newInfraLink)
+                if (SwitchInfraLink(mInfraLinkSelector.GetSelectedInfraLink()) != OTBR_ERROR_NONE)
                 {
                     error = OTBR_ERROR_INFRA_LINK_CHANGED;
                     break;
@@ -183,11 +316,69 @@ otbrError Application::Run(void)
         else if (errno != EINTR)
         {
             error = OTBR_ERROR_ERRNO;
-            otbrLogErr("select() failed: %s", strerror(errno));
+            otbrLogErr("Mainloop poll failed: %s", strerror(errno));
             break;
         }
+
+        // The reload is handled on the mainloop, where the components are not being processed.
+        if (sShouldReload.exchange(false))
+        {
+            ReloadConfig();
+        }
+
+        OTBR_PROBE(mainloop__iteration__end, rval);
     }
 
+#if OTBR_ENABLE_MDNS_THREAD
+    MainloopManager::GetInstance().StopMdnsThread();
+#endif
+#if OTBR_ENABLE_RADIO_THREAD
+    MainloopManager::GetInstance().StopRadioThread();
+
+exit:
+#endif
+    return error;
+}
+
+#if OTBR_ENABLE_RADIO_THREAD
+void Application::EnableRadioThread(int aPriority, int aCpu)
+{
+    mRadioThreadEnabled  = true;
+    mRadioThreadPriority = aPriority;
+    mRadioThreadCpu      = aCpu;
+}
+#endif
+
+#if OTBR_ENABLE_MDNS_THREAD
+void Application::EnableMdnsThread(void)
+{
+    mMdnsThreadEnabled = true;
+}
+#endif
+
+otbrError Application::SwitchInfraLink(const char *aInfraLink)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // The Thread stack, the SRP server and the mDNS registrations are kept. The mDNS publisher serves all the
+    // interfaces, so only the components bound to the infra link are moved.
+    VerifyOrExit(mHost->GetCoprocessorType() == OT_COPROCESSOR_RCP, error = OTBR_ERROR_NOT_IMPLEMENTED);
+#if OTBR_ENABLE_TREL
+    // The TREL UDP socket is bound by OpenThread to the netif of the `trel://` radio URL, which can't be changed.
+    VerifyOrExit(mTrelDnssd->GetTrelNetif() != mBackboneInterfaceName, error = OTBR_ERROR_NOT_IMPLEMENTED);
+#endif
+
+#if OTBR_ENABLE_BORDER_ROUTING
+    SuccessOrExit(error = static_cast<otbr::Ncp::RcpHost &>(*mHost).SetInfraIf(aInfraLink));
+#endif
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    mBackboneAgent->SetBackboneInterfaceName(aInfraLink);
+#endif
+
+    mBackboneInterfaceName = aInfraLink;
+
+exit:
+    otbrLogResult(error, "Switch to AIL %s", aInfraLink);
     return error;
 }
 
@@ -195,6 +386,11 @@ void Application::HandleMdnsState(Mdns::Publisher::State aState)
 {
     OTBR_UNUSED_VARIABLE(aState);
 
+    if (aState == Mdns::Publisher::State::kReady)
+    {
+        StartupStats::GetInstance().EndStage("mdns");
+    }
+
 #if OTBR_ENABLE_BORDER_AGENT
     mBorderAgent->HandleMdnsState(aState);
 #endif
@@ -211,11 +407,188 @@ void Application::HandleMdnsState(Mdns::Publisher::State aState)
 
 void Application::HandleSignal(int aSignal)
 {
-    sShouldTerminate = true;
-    signal(aSignal, SIG_DFL);
+    if (aSignal == SIGHUP)
+    {
+        sShouldReload = true;
+    }
+    else
+    {
+        sShouldTerminate = true;
+        signal(aSignal, SIG_DFL);
+    }
+}
+
+otbrError Application::ReloadConfig(void)
+{
+    otbrError                             error = OTBR_ERROR_NONE;
+    std::vector<Utils::ConfigFile::Entry> entries;
+    std::map<std::string, std::string>    config;
+
+    VerifyOrExit(!mConfigFilePath.empty(), error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = Utils::ConfigFile::Load(mConfigFilePath, entries));
+
+    // All the settings are validated before any of them is applied, a later setting of a key overrides the former.
+    for (const Utils::ConfigFile::Entry &entry : entries)
+    {
+        std::string key   = entry.mKey;
+        std::string value = entry.mValue;
+
+        if (key == kConfigTagDebugLevel)
+        {
+            size_t separator = value.find('=');
+
+            VerifyOrExit(separator != std::string::npos && separator > 0, error = OTBR_ERROR_INVALID_ARGS,
+                         otbrLogWarning("Invalid setting %s at line %u", key.c_str(), entry.mLine));
+            key += "=" + value.substr(0, separator);
+            value = value.substr(separator + 1);
+        }
+
+        VerifyOrExit(ApplyConfig(key, value, /* aApply */ false) == OTBR_ERROR_NONE, error = OTBR_ERROR_INVALID_ARGS,
+                     otbrLogWarning("Invalid setting %s at line %u", key.c_str(), entry.mLine));
+        config[key] = value;
+    }
+
+    for (const auto &setting : config)
+    {
+        auto      applied = mAppliedConfig.find(setting.first);
+        otbrError result;
+
+        if (applied != mAppliedConfig.end() && applied->second == setting.second)
+        {
+            continue;
+        }
+
+        result = ApplyConfig(setting.first, setting.second, /* aApply */ true);
+        otbrLogResult(result, "Apply setting %s=%s", setting.first.c_str(), setting.second.c_str());
+
+        if (result == OTBR_ERROR_NONE)
+        {
+            mAppliedConfig[setting.first] = setting.second;
+        }
+        else if (error == OTBR_ERROR_NONE)
+        {
+            error = result;
+        }
+    }
+
+exit:
+    otbrLogResult(error, "Reload configuration file %s", mConfigFilePath.c_str());
+    return error;
+}
+
+otbrError Application::ApplyConfig(const std::string &aKey, const std::string &aValue, bool aApply)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    long      value = 0;
+
+    if (aKey == kConfigDebugLevel)
+    {
+        VerifyOrExit(ParseConfigInteger(aValue, OTBR_LOG_EMERG, OTBR_LOG_DEBUG, value),
+                     error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aApply);
+        otbrLogSetLevel(static_cast<otbrLogLevel>(value));
+    }
+    else if (aKey.size() > sizeof(kConfigTagDebugLevel) &&
+             aKey.compare(0, sizeof(kConfigTagDebugLevel), std::string(kConfigTagDebugLevel) + "=") == 0)
+    {
+        // The key of a tag level is "tag-debug-level=TAG", see `ReloadConfig()`.
+        std::string tag = aKey.substr(sizeof(kConfigTagDebugLevel));
+
+        VerifyOrExit(ParseConfigInteger(aValue, OTBR_LOG_EMERG, OTBR_LOG_DEBUG, value),
+                     error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aApply);
+        error = otbrLogSetTagLevel(tag.c_str(), static_cast<otbrLogLevel>(value));
+    }
+    else if (aKey == kConfigRestListenAddress || aKey == kConfigRestListenPort)
+    {
+        if (aKey == kConfigRestListenPort)
+        {
+            VerifyOrExit(ParseConfigInteger(aValue, 1, UINT16_MAX, value), error = OTBR_ERROR_INVALID_ARGS);
+        }
+        VerifyOrExit(aApply);
+#if OTBR_ENABLE_REST_SERVER
+        VerifyOrExit(mRestWebServer != nullptr, error = OTBR_ERROR_INVALID_STATE);
+        SuccessOrExit(error = mRestWebServer->SetListenAddress(
+                          (aKey == kConfigRestListenAddress) ? aValue : mRestListenAddress,
+                          (aKey == kConfigRestListenPort) ? static_cast<int>(value) : mRestListenPort));
+        if (aKey == kConfigRestListenAddress)
+        {
+            mRestListenAddress = aValue;
+        }
+        else
+        {
+            mRestListenPort = static_cast<int>(value);
+        }
+#else
+        error = OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+    }
+    else if (aKey == kConfigBackboneIfName)
+    {
+        VerifyOrExit(!aValue.empty(), error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aApply && aValue != mBackboneInterfaceName);
+        // The names are kept, since `mBackboneInterfaceName` refers to the name of the current infra link.
+        error = SwitchInfraLink(mConfigInfraLinks.insert(aValue).first->c_str());
+    }
+    else if (aKey == kConfigMdnsPublicationPace)
+    {
+        size_t separator = aValue.find(',');
+        long   burst;
+
+        VerifyOrExit(separator != std::string::npos, error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(ParseConfigInteger(aValue.substr(0, separator), 0, INT32_MAX, value) &&
+                         ParseConfigInteger(aValue.substr(separator + 1), 1, INT32_MAX, burst),
+                     error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aApply);
+#if OTBR_ENABLE_MDNS
+        mPublisher->SetPublicationPace(static_cast<uint32_t>(value), static_cast<uint32_t>(burst));
+#else
+        error = OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+    }
+    else if (aKey == kConfigMdnsIfNames)
+    {
+        std::vector<uint32_t> interfaces;
+
+        VerifyOrExit(ParseConfigInterfaces(aValue, interfaces), error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aApply);
+#if OTBR_ENABLE_MDNS
+        VerifyOrExit(interfaces != mPublisher->GetInterfaces());
+        // The publisher is restarted as after losing the mDNS daemon, so that the components publish and subscribe
+        // again on the new interfaces once it's ready.
+        HandleMdnsState(Mdns::Publisher::State::kIdle);
+        mPublisher->Stop();
+        mPublisher->SetInterfaces(interfaces);
+        error = mPublisher->Start();
+#else
+        error = OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+    }
+    else if (aKey == kConfigMeshCopInstanceName || aKey == kConfigVendorName || aKey == kConfigProductName)
+    {
+        VerifyOrExit(!aValue.empty(), error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aApply);
+#if OTBR_ENABLE_BORDER_AGENT
+        VerifyOrExit(mBorderAgent != nullptr, error = OTBR_ERROR_INVALID_STATE);
+        error = mBorderAgent->UpdateMeshCopServiceNames((aKey == kConfigMeshCopInstanceName) ? aValue : "",
+                                                        (aKey == kConfigProductName) ? aValue : "",
+                                                        (aKey == kConfigVendorName) ? aValue : "");
+#else
+        error = OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+    }
+    else
+    {
+        error = OTBR_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
 }
 
-void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRestListenPort)
+void Application::CreateRcpMode(const std::string &aRestListenAddress,
+                                int                aRestListenPort,
+                                const std::string &aRestUnixSocketPath)
 {
     otbr::Ncp::RcpHost &rcpHost = static_cast<otbr::Ncp::RcpHost &>(*mHost);
 #if OTBR_ENABLE_BORDER_AGENT
@@ -230,14 +603,25 @@ void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRest
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     mDiscoveryProxy = MakeUnique<Dnssd::DiscoveryProxy>(rcpHost, *mPublisher);
 #endif
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+    mUpstreamResolver = MakeUnique<UpstreamResolver>(rcpHost);
+#endif
 #if OTBR_ENABLE_TREL
     mTrelDnssd = MakeUnique<TrelDnssd::TrelDnssd>(rcpHost, *mPublisher);
 #endif
+#if OTBR_ENABLE_TREL_BATCHED_IO
+    // The TREL socket must be there before the Thread stack enables TREL when the host is initialized.
+    mTrelSocket = MakeUnique<TrelDnssd::TrelSocket>(*mTrelDnssd);
+#endif
 #if OTBR_ENABLE_OPENWRT
     mUbusAgent = MakeUnique<ubus::UBusAgent>(rcpHost);
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer = MakeUnique<rest::RestWebServer>(rcpHost, aRestListenAddress, aRestListenPort);
+    mRestWebServer = MakeUnique<rest::RestWebServer>(rcpHost, *mPublisher, aRestListenAddress, aRestListenPort,
+                                                     aRestUnixSocketPath);
+#endif
+#if OTBR_ENABLE_FIREWALL
+    mFirewallManager = MakeUnique<FirewallManager>(rcpHost, mInterfaceName);
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
     mVendorServer = vendor::VendorServer::newInstance(*this);
@@ -245,53 +629,82 @@ void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRest
 
     OT_UNUSED_VARIABLE(aRestListenAddress);
     OT_UNUSED_VARIABLE(aRestListenPort);
+    OT_UNUSED_VARIABLE(aRestUnixSocketPath);
 }
 
 void Application::InitRcpMode(void)
 {
+    StartupStats &stats = StartupStats::GetInstance();
+
+    OTBR_UNUSED_VARIABLE(stats);
+
+#if OTBR_ENABLE_WARM_RESTART
+    // The restored caches are announced once the mDNS publisher is ready, so they are restored before starting it.
+    RestoreSnapshot();
+#endif
+    // The mDNS publisher and the D-Bus agent wait for their daemons on the mainloop, their stages are completed from
+    // the callbacks. The components publishing to mDNS are enabled right away and publish once it's ready, see
+    // `HandleMdnsState()`.
 #if OTBR_ENABLE_MDNS
+    stats.BeginStage("mdns");
     mPublisher->Start();
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
 // This is for delaying publishing the MeshCoP service until the correct
 // vendor name and OUI etc. are correctly set by BorderAgent::SetMeshCopServiceValues()
 #if OTBR_STOP_BORDER_AGENT_ON_INIT
-    mBorderAgent->SetEnabled(false);
+    stats.RunStage("border_agent", [this]() { mBorderAgent->SetEnabled(false); });
 #else
-    mBorderAgent->SetEnabled(true);
+    stats.RunStage("border_agent", [this]() { mBorderAgent->SetEnabled(true); });
 #endif
 #endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent->Init();
+    stats.RunStage("backbone_agent", [this]() { mBackboneAgent->Init(); });
 #endif
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-    mAdvertisingProxy->SetEnabled(true);
+    stats.RunStage("advertising_proxy", [this]() { mAdvertisingProxy->SetEnabled(true); });
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
-    mDiscoveryProxy->SetEnabled(true);
+    stats.RunStage("discovery_proxy", [this]() { mDiscoveryProxy->SetEnabled(true); });
+#endif
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+    stats.RunStage("upstream_resolver", [this]() { mUpstreamResolver->Init(); });
 #endif
 #if OTBR_ENABLE_OPENWRT
-    mUbusAgent->Init();
+    stats.RunStage("ubus", [this]() { mUbusAgent->Init(); });
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer->Init();
+    stats.RunStage("rest", [this]() { mRestWebServer->Init(); });
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    stats.BeginStage("dbus");
+    mDBusAgent->Init(mBorderAgent.get(), []() { StartupStats::GetInstance().EndStage("dbus"); });
+#endif
+#if OTBR_ENABLE_FIREWALL
+    stats.RunStage("firewall", [this]() { mFirewallManager->Init(); });
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
-    mVendorServer->Init();
+    stats.RunStage("vendor_server", [this]() { mVendorServer->Init(); });
 #endif
 }
 
 void Application::DeinitRcpMode(void)
 {
+#if OTBR_ENABLE_WARM_RESTART
+    SaveSnapshot();
+#endif
+#if OTBR_ENABLE_FIREWALL
+    mFirewallManager->Deinit();
+#endif
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy->SetEnabled(false);
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     mDiscoveryProxy->SetEnabled(false);
 #endif
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+    mUpstreamResolver->Deinit();
+#endif
 #if OTBR_ENABLE_BORDER_AGENT
     mBorderAgent->SetEnabled(false);
 #endif
@@ -300,10 +713,46 @@ void Application::DeinitRcpMode(void)
 #endif
 }
 
+#if OTBR_ENABLE_WARM_RESTART
+void Application::RestoreSnapshot(void)
+{
+    Utils::SnapshotReader reader;
+    otbrError             error;
+
+    SuccessOrExit(error = reader.Load(OTBR_WARM_RESTART_SNAPSHOT_FILE, Seconds(OTBR_WARM_RESTART_SNAPSHOT_MAX_AGE)));
+
+#if OTBR_ENABLE_TREL
+    mTrelDnssd->RestorePeers(reader);
+#endif
+
+exit:
+    // A snapshot is only used once, the next restart must not see the caches from before this run.
+    if (error != OTBR_ERROR_NOT_FOUND)
+    {
+        unlink(OTBR_WARM_RESTART_SNAPSHOT_FILE);
+        otbrLogResult(error, "Restore warm restart snapshot");
+    }
+}
+
+void Application::SaveSnapshot(void)
+{
+    Utils::SnapshotWriter writer;
+
+#if OTBR_ENABLE_TREL
+    mTrelDnssd->SavePeers(writer);
+#endif
+
+    otbrLogResult(writer.Save(OTBR_WARM_RESTART_SNAPSHOT_FILE), "Save warm restart snapshot");
+}
+#endif // OTBR_ENABLE_WARM_RESTART
+
 void Application::InitNcpMode(void)
 {
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    // The Border Agent, the SRP Advertising Proxy and the other components reading the Thread stack through
+    // `otInstance` are only created for an RCP, they run on the co-processor with an NCP.
+    StartupStats::GetInstance().BeginStage("dbus");
+    mDBusAgent->Init(/* aBorderAgent */ nullptr, []() { StartupStats::GetInstance().EndStage("dbus"); });
 #endif
 }
 
@@ -37,8 +37,11 @@
 #include "openthread-br/config.h"
 
 #include <atomic>
+#include <map>
+#include <set>
 #include <signal.h>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 #if OTBR_ENABLE_BORDER_AGENT
@@ -60,6 +63,15 @@
 #if OTBR_ENABLE_VENDOR_SERVER
 #include "agent/vendor.hpp"
 #endif
+#if OTBR_ENABLE_FIREWALL
+#include "firewall/firewall_manager.hpp"
+#endif
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+#include "sdp_proxy/upstream_resolver.hpp"
+#endif
+#if OTBR_ENABLE_TREL_BATCHED_IO
+#include "trel_dnssd/trel_socket.hpp"
+#endif
 #include "utils/infra_link_selector.hpp"
 
 namespace otbr {
@@ -97,6 +109,7 @@ public:
      * @param[in] aEnableAutoAttach      Whether or not to automatically attach to the saved network.
      * @param[in] aRestListenAddress     Network address to listen on.
      * @param[in] aRestListenPort        Network port to listen on.
+     * @param[in] aRestUnixSocketPath    UNIX domain socket to also listen on, empty to only listen on TCP.
      *
      */
     explicit Application(const std::string               &aInterfaceName,
@@ -104,7 +117,8 @@ public:
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
                          const std::string               &aRestListenAddress,
-                         int                              aRestListenPort);
+                         int                              aRestListenPort,
+                         const std::string               &aRestUnixSocketPath);
 
     /**
      * This method initializes the Application instance.
@@ -121,12 +135,66 @@ public:
     /**
      * This method runs the application until exit.
      *
-     * @retval OTBR_ERROR_NONE  The application exited without any error.
-     * @retval OTBR_ERROR_ERRNO The application exited with some system error.
+     * The application moves to a newly selected infrastructure link without restarting, if it can't,
+     * `OTBR_ERROR_INFRA_LINK_CHANGED` is returned for the agent to restart on the new link.
+     *
+     * @retval OTBR_ERROR_NONE                The application exited without any error.
+     * @retval OTBR_ERROR_ERRNO               The application exited with some system error.
+     * @retval OTBR_ERROR_INFRA_LINK_CHANGED  The application exited to restart on another infrastructure link.
      *
      */
     otbrError Run(void);
 
+#if OTBR_ENABLE_RADIO_THREAD
+    /**
+     * This method makes `Run()` process the Thread stack on a dedicated radio thread in RCP mode.
+     *
+     * The management components stay on the mainloop, see `MainloopManager::StartRadioThread()`.
+     *
+     * @param[in] aPriority  The SCHED_FIFO priority of the radio thread, or 0 to keep the default scheduling policy.
+     * @param[in] aCpu       The CPU which the radio thread is pinned to, or -1 not to pin it.
+     *
+     */
+    void EnableRadioThread(int aPriority, int aCpu);
+#endif
+
+#if OTBR_ENABLE_MDNS_THREAD
+    /**
+     * This method makes `Run()` process the mDNS publisher on a dedicated mDNS thread.
+     *
+     * The publisher callbacks of the components then run on the mDNS thread, see
+     * `MainloopManager::StartMdnsThread()`.
+     *
+     */
+    void EnableMdnsThread(void);
+#endif
+
+    /**
+     * This method sets the configuration file of the settings which can be changed without restarting the agent.
+     *
+     * The settings are applied by `Init()` over the command line options, and again by `ReloadConfig()`.
+     *
+     * @param[in] aPath  The path of the configuration file.
+     *
+     */
+    void SetConfigFile(const std::string &aPath) { mConfigFilePath = aPath; }
+
+    /**
+     * This method reads the configuration file again and applies the changed settings.
+     *
+     * The Thread stack keeps running, each component applies its settings incrementally. A reload is requested
+     * with SIGHUP or the `ReloadConfig` D-Bus method. The file is validated as a whole, so that a malformed file
+     * changes nothing. A setting removed from the file keeps its current value.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully applied the changed settings.
+     * @retval OTBR_ERROR_INVALID_STATE  No configuration file is set.
+     * @retval OTBR_ERROR_ERRNO          Failed to read the configuration file.
+     * @retval OTBR_ERROR_INVALID_ARGS   The configuration file is malformed, nothing is applied.
+     * @retval ...                       The error of the first setting which failed to be applied.
+     *
+     */
+    otbrError ReloadConfig(void);
+
     /**
      * Get the OpenThread controller object the application is using.
      *
@@ -256,18 +324,29 @@ private:
 
     static void HandleSignal(int aSignal);
 
-    void CreateRcpMode(const std::string &aRestListenAddress, int aRestListenPort);
+    void CreateRcpMode(const std::string &aRestListenAddress,
+                       int                aRestListenPort,
+                       const std::string &aRestUnixSocketPath);
     void InitRcpMode(void);
     void DeinitRcpMode(void);
 
     void InitNcpMode(void);
     void DeinitNcpMode(void);
 
+    otbrError SwitchInfraLink(const char *aInfraLink);
+    otbrError ApplyConfig(const std::string &aKey, const std::string &aValue, bool aApply);
+
+#if OTBR_ENABLE_WARM_RESTART
+    void RestoreSnapshot(void);
+    void SaveSnapshot(void);
+#endif
+
     std::string mInterfaceName;
 #if __linux__
     otbr::Utils::InfraLinkSelector mInfraLinkSelector;
 #endif
     const char                      *mBackboneInterfaceName;
+    bool                             mInfraLinkChanged;
     std::unique_ptr<Ncp::ThreadHost> mHost;
 #if OTBR_ENABLE_MDNS
     std::unique_ptr<Mdns::Publisher> mPublisher;
@@ -284,9 +363,15 @@ private:
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     std::unique_ptr<Dnssd::DiscoveryProxy> mDiscoveryProxy;
 #endif
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+    std::unique_ptr<UpstreamResolver> mUpstreamResolver;
+#endif
 #if OTBR_ENABLE_TREL
     std::unique_ptr<TrelDnssd::TrelDnssd> mTrelDnssd;
 #endif
+#if OTBR_ENABLE_TREL_BATCHED_IO
+    std::unique_ptr<TrelDnssd::TrelSocket> mTrelSocket;
+#endif
 #if OTBR_ENABLE_OPENWRT
     std::unique_ptr<ubus::UBusAgent> mUbusAgent;
 #endif
@@ -296,11 +381,32 @@ private:
 #if OTBR_ENABLE_DBUS_SERVER
     std::unique_ptr<DBus::DBusAgent> mDBusAgent;
 #endif
+#if OTBR_ENABLE_FIREWALL
+    std::unique_ptr<FirewallManager> mFirewallManager;
+#endif
 #if OTBR_ENABLE_VENDOR_SERVER
     std::shared_ptr<vendor::VendorServer> mVendorServer;
 #endif
+#if OTBR_ENABLE_RADIO_THREAD
+    bool mRadioThreadEnabled  = false;
+    int  mRadioThreadPriority = 0;
+    int  mRadioThreadCpu      = -1;
+#endif
+#if OTBR_ENABLE_MDNS_THREAD
+    bool mMdnsThreadEnabled = false;
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    std::string mRestListenAddress;
+    int         mRestListenPort;
+#endif
+    std::string mConfigFilePath;
+    // The settings applied from the configuration file by their keys.
+    std::map<std::string, std::string> mAppliedConfig;
+    // The infra link names from the configuration file, which `mBackboneInterfaceName` may point to.
+    std::set<std::string> mConfigInfraLinks;
 
     static std::atomic_bool sShouldTerminate;
+    static std::atomic_bool sShouldReload;
 };
 
 /**
@@ -31,10 +31,15 @@
 #include <openthread-br/config.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include <assert.h>
 #include <getopt.h>
+#include <limits.h>
+#if OTBR_ENABLE_LOW_MEMORY && defined(__GLIBC__)
+#include <malloc.h>
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -51,6 +56,7 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
 #include "ncp/thread_host.hpp"
 
@@ -79,10 +85,20 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_REST_UNIX_SOCKET,
+    OTBR_OPT_BINARY_LOG,
+    OTBR_OPT_TAG_DEBUG_LEVEL,
+    OTBR_OPT_RADIO_THREAD,
+    OTBR_OPT_CONFIG_FILE,
+    OTBR_OPT_MDNS_THREAD,
 };
 
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
 static jmp_buf sResetJump;
+#if OTBR_ENABLE_RADIO_THREAD
+static int    sArgc;
+static char **sArgv;
+#endif
 #endif
 static otbr::Application *gApp = nullptr;
 
@@ -90,6 +106,7 @@ void                       __gcov_flush();
 static const struct option kOptions[] = {
     {"backbone-ifname", required_argument, nullptr, OTBR_OPT_BACKBONE_INTERFACE_NAME},
     {"debug-level", required_argument, nullptr, OTBR_OPT_DEBUG_LEVEL},
+    {"tag-debug-level", required_argument, nullptr, OTBR_OPT_TAG_DEBUG_LEVEL},
     {"help", no_argument, nullptr, OTBR_OPT_HELP},
     {"thread-ifname", required_argument, nullptr, OTBR_OPT_INTERFACE_NAME},
     {"verbose", no_argument, nullptr, OTBR_OPT_VERBOSE},
@@ -99,6 +116,17 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"rest-unix-socket", required_argument, nullptr, OTBR_OPT_REST_UNIX_SOCKET},
+    {"config-file", required_argument, nullptr, OTBR_OPT_CONFIG_FILE},
+#if OTBR_ENABLE_LOG_BINARY
+    {"binary-log", required_argument, nullptr, OTBR_OPT_BINARY_LOG},
+#endif
+#if OTBR_ENABLE_RADIO_THREAD
+    {"radio-thread", optional_argument, nullptr, OTBR_OPT_RADIO_THREAD},
+#endif
+#if OTBR_ENABLE_MDNS_THREAD
+    {"mdns-thread", no_argument, nullptr, OTBR_OPT_MDNS_THREAD},
+#endif
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -119,6 +147,33 @@ exit:
     return successful;
 }
 
+#if OTBR_ENABLE_RADIO_THREAD
+static bool ParseRadioThreadArg(const char *aArg, int &aPriority, int &aCpu)
+{
+    bool        successful = true;
+    const char *separator  = strchr(aArg, ',');
+    std::string priority(aArg, (separator == nullptr) ? strlen(aArg) : static_cast<size_t>(separator - aArg));
+    long        parseResult;
+
+    if (!priority.empty())
+    {
+        VerifyOrExit(ParseInteger(priority.c_str(), parseResult), successful = false);
+        VerifyOrExit(parseResult >= 0 && parseResult <= 99, successful = false);
+        aPriority = static_cast<int>(parseResult);
+    }
+
+    if (separator != nullptr)
+    {
+        VerifyOrExit(ParseInteger(separator + 1, parseResult), successful = false);
+        VerifyOrExit(parseResult >= 0 && parseResult <= INT_MAX, successful = false);
+        aCpu = static_cast<int>(parseResult);
+    }
+
+exit:
+    return successful;
+}
+#endif
+
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
 static constexpr char kAutoAttachDisableArg[] = "--auto-attach=0";
 static char           sAutoAttachDisableArgStorage[sizeof(kAutoAttachDisableArg)];
@@ -137,6 +192,18 @@ static std::vector<char *> AppendAutoAttachDisableArg(int argc, char *argv[])
 
     return args;
 }
+
+static void Restart(int argc, char *argv[])
+{
+    std::vector<char *> args = AppendAutoAttachDisableArg(argc, argv);
+
+    alarm(0);
+#if OPENTHREAD_ENABLE_COVERAGE
+    __gcov_flush();
+#endif
+
+    execvp(args[0], args.data());
+}
 #endif
 
 static void PrintHelp(const char *aProgramName)
@@ -145,8 +212,23 @@ static void PrintHelp(const char *aProgramName)
             "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [-s] [--auto-attach[=0/1]] "
             "RADIO_URL [RADIO_URL]\n"
             "    --auto-attach defaults to 1\n"
-            "    -s disables syslog and prints to standard out\n",
-            aProgramName);
+            "    -I is given at most once, each Thread network is served by its own %s\n"
+            "    -s disables syslog and prints to standard out\n"
+            "    --tag-debug-level TAG=DEBUG_LEVEL sets the log level of a log tag, such as MDNS=7\n"
+            "    --rest-unix-socket PATH also serves the REST API on a UNIX domain socket\n"
+            "    --config-file FILE applies the settings of FILE after starting, and again on SIGHUP or the\n"
+            "      ReloadConfig D-Bus method\n",
+            aProgramName, aProgramName);
+#if OTBR_ENABLE_LOG_BINARY
+    fprintf(stderr, "    --binary-log FILE writes logs to a binary log file, formatted by log-decoder\n");
+#endif
+#if OTBR_ENABLE_RADIO_THREAD
+    fprintf(stderr, "    --radio-thread[=PRIORITY][,CPU] processes the Thread stack on a dedicated thread, with the\n"
+                    "      SCHED_FIFO PRIORITY (1-99) and pinned to the CPU if given, in RCP mode\n");
+#endif
+#if OTBR_ENABLE_MDNS_THREAD
+    fprintf(stderr, "    --mdns-thread processes the mDNSResponder publisher on a dedicated thread\n");
+#endif
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
@@ -178,6 +260,20 @@ static otbrLogLevel GetDefaultLogLevel(void)
     return level;
 }
 
+static void TuneAllocator(void)
+{
+#if OTBR_ENABLE_LOW_MEMORY && defined(__GLIBC__)
+    // The allocations of all the threads share one arena, and the fixed mmap threshold keeps the buffers larger than it
+    // out of the heap so that they are returned to the system once freed, instead of fragmenting the heap.
+    static constexpr int kMmapThreshold = 64 * 1024;
+    static constexpr int kTrimThreshold = 128 * 1024;
+
+    mallopt(M_ARENA_MAX, 1);
+    mallopt(M_MMAP_THRESHOLD, kMmapThreshold);
+    mallopt(M_TRIM_THRESHOLD, kTrimThreshold);
+#endif
+}
+
 static void PrintRadioVersionAndExit(const std::vector<const char *> &aRadioUrls)
 {
     auto host = std::unique_ptr<otbr::Ncp::ThreadHost>(
@@ -208,11 +304,23 @@ static int realmain(int argc, char *argv[])
     bool                      enableAutoAttach  = true;
     const char               *restListenAddress = "";
     int                       restListenPort    = kPortNumber;
+    const char               *restUnixSocket    = "";
+    const char               *binaryLogPath     = nullptr;
+    const char               *configFilePath    = nullptr;
+#if OTBR_ENABLE_RADIO_THREAD
+    bool                      enableRadioThread = false;
+    int                       radioThreadPrio   = 0;
+    int                       radioThreadCpu    = -1;
+#endif
+#if OTBR_ENABLE_MDNS_THREAD
+    bool                      enableMdnsThread  = false;
+#endif
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
     long                      parseResult;
 
     std::set_new_handler(OnAllocateFailed);
+    TuneAllocator();
 
     while ((opt = getopt_long(argc, argv, "B:d:hI:Vvs", kOptions, nullptr)) != -1)
     {
@@ -229,7 +337,23 @@ static int realmain(int argc, char *argv[])
             logLevel = static_cast<otbrLogLevel>(parseResult);
             break;
 
+        case OTBR_OPT_TAG_DEBUG_LEVEL:
+        {
+            const char *separator = strchr(optarg, '=');
+
+            VerifyOrExit(separator != nullptr, ret = EXIT_FAILURE);
+            VerifyOrExit(ParseInteger(separator + 1, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(OTBR_LOG_EMERG <= parseResult && parseResult <= OTBR_LOG_DEBUG, ret = EXIT_FAILURE);
+            VerifyOrExit(otbrLogSetTagLevel(std::string(optarg, separator).c_str(),
+                                            static_cast<otbrLogLevel>(parseResult)) == OTBR_ERROR_NONE,
+                         ret = EXIT_FAILURE);
+            break;
+        }
+
         case OTBR_OPT_INTERFACE_NAME:
+            // The OpenThread POSIX platform has a single instance per process, a second Thread interface can't be
+            // served by the same process.
+            VerifyOrExit(interfaceName == kDefaultInterfaceName, PrintHelp(argv[0]), ret = EXIT_FAILURE);
             interfaceName = optarg;
             break;
 
@@ -275,6 +399,35 @@ static int realmain(int argc, char *argv[])
             restListenPort = parseResult;
             break;
 
+        case OTBR_OPT_REST_UNIX_SOCKET:
+            restUnixSocket = optarg;
+            break;
+
+        case OTBR_OPT_BINARY_LOG:
+            binaryLogPath = optarg;
+            break;
+
+        case OTBR_OPT_CONFIG_FILE:
+            configFilePath = optarg;
+            break;
+
+#if OTBR_ENABLE_RADIO_THREAD
+        case OTBR_OPT_RADIO_THREAD:
+            enableRadioThread = true;
+            if (optarg != nullptr)
+            {
+                VerifyOrExit(ParseRadioThreadArg(optarg, radioThreadPrio, radioThreadCpu), PrintHelp(argv[0]),
+                             ret = EXIT_FAILURE);
+            }
+            break;
+#endif
+
+#if OTBR_ENABLE_MDNS_THREAD
+        case OTBR_OPT_MDNS_THREAD:
+            enableMdnsThread = true;
+            break;
+#endif
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -283,6 +436,17 @@ static int realmain(int argc, char *argv[])
     }
 
     otbrLogInit(argv[0], logLevel, verbose, syslogDisable);
+    if (binaryLogPath != nullptr)
+    {
+        otbrError error = otbrLogBinaryOpen(binaryLogPath);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogCrit("Failed to open binary log %s: %s", binaryLogPath, otbrErrorString(error));
+            otbrLogDeinit();
+            ExitNow(ret = EXIT_FAILURE);
+        }
+    }
     otbrLogNotice("Running %s", OTBR_PACKAGE_VERSION);
     otbrLogNotice("Thread version: %s", otbr::Ncp::RcpHost::GetThreadVersion());
     otbrLogNotice("Thread interface: %s", interfaceName);
@@ -306,9 +470,25 @@ static int realmain(int argc, char *argv[])
 
     {
         otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress,
-                              restListenPort);
+                              restListenPort, restUnixSocket);
 
         gApp = &app;
+        if (configFilePath != nullptr)
+        {
+            app.SetConfigFile(configFilePath);
+        }
+#if OTBR_ENABLE_RADIO_THREAD
+        if (enableRadioThread)
+        {
+            app.EnableRadioThread(radioThreadPrio, radioThreadCpu);
+        }
+#endif
+#if OTBR_ENABLE_MDNS_THREAD
+        if (enableMdnsThread)
+        {
+            app.EnableMdnsThread();
+        }
+#endif
         app.Init();
 
         ret = app.Run();
@@ -333,6 +513,16 @@ void otPlatReset(otInstance *aInstance)
     gApp = nullptr;
 
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
+#if OTBR_ENABLE_RADIO_THREAD
+    // The stack of the main thread can't be jumped to from the radio thread, which holds the stack lock so that the
+    // main thread doesn't run anymore.
+    if (otbr::MainloopManager::GetInstance().IsRadioThread())
+    {
+        Restart(sArgc, sArgv);
+        otbrLogCrit("Failed to restart: %s", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+#endif
     longjmp(sResetJump, 1);
     assert(false);
 #else
@@ -345,16 +535,13 @@ void otPlatReset(otInstance *aInstance)
 int main(int argc, char *argv[])
 {
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
+#if OTBR_ENABLE_RADIO_THREAD
+    sArgc = argc;
+    sArgv = argv;
+#endif
     if (setjmp(sResetJump))
     {
-        std::vector<char *> args = AppendAutoAttachDisableArg(argc, argv);
-
-        alarm(0);
-#if OPENTHREAD_ENABLE_COVERAGE
-        __gcov_flush();
-#endif
-
-        execvp(args[0], args.data());
+        Restart(argc, argv);
     }
 #endif
     return realmain(argc, argv);
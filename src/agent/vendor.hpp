@@ -37,6 +37,7 @@
 #include "openthread-br/config.h"
 
 #include "agent/application.hpp"
+#include "common/event_bus.hpp"
 
 namespace otbr {
 
@@ -68,6 +69,11 @@ public:
      *
      * This will be called by `Application::Init()` after OpenThread instance and other built-in
      * servers have been created and initialized.
+     *
+     * The vendor server may subscribe here to the events of the built-in servers on the `EventBus`, e.g.
+     * `Ncp::RcpHost::StateChangedEvent`, `Mdns::Publisher::ServiceDiscoveredEvent`,
+     * `Mdns::Publisher::HostDiscoveredEvent` and `AdvertisingProxy::SrpUpdateEvent`. The handlers are invoked in the
+     * mainloop thread with the event records of the publishers, which are only valid during the call.
      */
     virtual void Init(void) = 0;
 };
@@ -37,6 +37,8 @@
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
 
+#include <chrono>
+
 #include <assert.h>
 #include <net/if.h>
 
@@ -54,6 +56,9 @@ BackboneAgent::BackboneAgent(otbr::Ncp::RcpHost &aHost, std::string aInterfaceNa
     , mNdProxyManager(aHost, aBackboneInterfaceName)
     , mDuaRoutingManager(aInterfaceName, aBackboneInterfaceName)
 #endif
+#if OTBR_ENABLE_MLR_ROUTING
+    , mMlrManager(aHost, aInterfaceName, aBackboneInterfaceName)
+#endif
 {
     OTBR_UNUSED_VARIABLE(aInterfaceName);
     OTBR_UNUSED_VARIABLE(aBackboneInterfaceName);
@@ -68,12 +73,40 @@ void BackboneAgent::Init(void)
     otBackboneRouterSetNdProxyCallback(mHost.GetInstance(), &BackboneAgent::HandleBackboneRouterNdProxyEvent, this);
     mNdProxyManager.Init();
 #endif
+#if OTBR_ENABLE_MLR_ROUTING
+    otBackboneRouterSetMulticastListenerCallback(mHost.GetInstance(),
+                                                 &BackboneAgent::HandleBackboneRouterMulticastListenerEvent, this);
+#endif
 
 #if OTBR_ENABLE_BACKBONE_ROUTER_ON_INIT
     otBackboneRouterSetEnabled(mHost.GetInstance(), /* aEnabled */ true);
 #endif
 }
 
+void BackboneAgent::SetBackboneInterfaceName(const std::string &aBackboneInterfaceName)
+{
+    otbrLogInfo("BackboneAgent: Move to backbone interface %s", aBackboneInterfaceName.c_str());
+
+    // Leave the current state as if the Backbone Router was disabled, the state is then entered again.
+    if (IsPrimary())
+    {
+        OnResignPrimary();
+    }
+
+    mBackboneRouterState = OT_BACKBONE_ROUTER_STATE_DISABLED;
+
+#if OTBR_ENABLE_DUA_ROUTING
+    mNdProxyManager.Disable();
+    mNdProxyManager.SetBackboneInterfaceName(aBackboneInterfaceName);
+    mDuaRoutingManager.SetBackboneInterfaceName(aBackboneInterfaceName);
+#endif
+#if OTBR_ENABLE_MLR_ROUTING
+    mMlrManager.SetBackboneInterfaceName(aBackboneInterfaceName);
+#endif
+
+    HandleBackboneRouterState();
+}
+
 void BackboneAgent::HandleThreadStateChanged(otChangedFlags aFlags)
 {
     if (aFlags & OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE)
@@ -102,6 +135,10 @@ void BackboneAgent::HandleBackboneRouterState(void)
         OnResignPrimary();
     }
 
+#if OTBR_ENABLE_DUA_ROUTING
+    UpdateNdProxyStandby();
+#endif
+
 exit:
     return;
 }
@@ -110,11 +147,25 @@ void BackboneAgent::OnBecomePrimary(void)
 {
     otbrLogNotice("BackboneAgent: Backbone Router becomes Primary!");
 
+#if OTBR_ENABLE_MLR_ROUTING
+    mMlrManager.Enable();
+#endif
+
 #if OTBR_ENABLE_DUA_ROUTING
     if (mDomainPrefix.IsValid())
     {
+        using std::chrono::steady_clock;
+
+        steady_clock::time_point start = steady_clock::now();
+        long long                elapsedUs;
+
+        // The ND Proxy manager of a Secondary BBR is already enabled, only its activation is left.
         mDuaRoutingManager.Enable(mDomainPrefix);
         mNdProxyManager.Enable(mDomainPrefix);
+        mNdProxyManager.SetActive(true);
+
+        elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - start).count();
+        otbrLogNotice("BackboneAgent: Took over as Primary in %lld us", elapsedUs);
     }
 #endif
 }
@@ -125,9 +176,31 @@ void BackboneAgent::OnResignPrimary(void)
 
 #if OTBR_ENABLE_DUA_ROUTING
     mDuaRoutingManager.Disable();
-    mNdProxyManager.Disable();
+    mNdProxyManager.SetActive(false);
 #endif
+#if OTBR_ENABLE_MLR_ROUTING
+    mMlrManager.Disable();
+#endif
+#if OTBR_ENABLE_DUA_DAD_SCHEDULER
+    // No more queries are sent by a Secondary BBR, the waiting ones are not delayed any longer.
+    mDadScheduler.Flush();
+#endif
+}
+
+#if OTBR_ENABLE_DUA_ROUTING
+void BackboneAgent::UpdateNdProxyStandby(void)
+{
+    // A Secondary BBR keeps an inactive ND Proxy manager, with its sockets and NFQUEUE installed, to take over fast.
+    if (mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_DISABLED || !mDomainPrefix.IsValid())
+    {
+        mNdProxyManager.Disable();
+    }
+    else
+    {
+        mNdProxyManager.Enable(mDomainPrefix);
+    }
 }
+#endif
 
 const char *BackboneAgent::StateToString(otBackboneRouterState aState)
 {
@@ -170,14 +243,21 @@ void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomain
         assert(mDomainPrefix.IsValid());
     }
 
-    VerifyOrExit(IsPrimary() && aEvent != OT_BACKBONE_ROUTER_DOMAIN_PREFIX_REMOVED);
+    VerifyOrExit(mBackboneRouterState != OT_BACKBONE_ROUTER_STATE_DISABLED &&
+                 aEvent != OT_BACKBONE_ROUTER_DOMAIN_PREFIX_REMOVED);
 
 #if OTBR_ENABLE_DUA_ROUTING
     mDuaRoutingManager.Disable();
     mNdProxyManager.Disable();
 
-    mDuaRoutingManager.Enable(mDomainPrefix);
-    mNdProxyManager.Enable(mDomainPrefix);
+    if (IsPrimary())
+    {
+        OnBecomePrimary();
+    }
+    else
+    {
+        UpdateNdProxyStandby();
+    }
 #endif
 
 exit:
@@ -195,6 +275,22 @@ void BackboneAgent::HandleBackboneRouterNdProxyEvent(void
 void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
 {
     mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
+    mDuaRoutingManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
+}
+#endif
+
+#if OTBR_ENABLE_MLR_ROUTING
+void BackboneAgent::HandleBackboneRouterMulticastListenerEvent(void                                  *aContext,
+                                                               otBackboneRouterMulticastListenerEvent aEvent,
+                                                               const otIp6Address                    *aAddress)
+{
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterMulticastListenerEvent(aEvent, aAddress);
+}
+
+void BackboneAgent::HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                               const otIp6Address                    *aAddress)
+{
+    mMlrManager.HandleBackboneRouterMulticastListenerEvent(aEvent, aAddress);
 }
 #endif
 
@@ -44,7 +44,9 @@
 
 #include <openthread/backbone_router_ftd.h>
 
+#include "backbone_router/dad_scheduler.hpp"
 #include "backbone_router/dua_routing_manager.hpp"
+#include "backbone_router/mlr_manager.hpp"
 #include "backbone_router/nd_proxy.hpp"
 #include "common/code_utils.hpp"
 #include "ncp/rcp_host.hpp"
@@ -84,6 +86,27 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method moves the Backbone agent to another Backbone network interface.
+     *
+     * The managers are disabled on the previous interface and enabled again on the new one in the current Backbone
+     * Router state, the DUAs and multicast listeners registered to this Backbone Router are kept.
+     *
+     * @param[in] aBackboneInterfaceName  The Backbone network interface name.
+     *
+     */
+    void SetBackboneInterfaceName(const std::string &aBackboneInterfaceName);
+
+#if OTBR_ENABLE_DUA_DAD_SCHEDULER
+    /**
+     * This method returns the scheduler of the DUA duplicate address detection queries.
+     *
+     * @returns A reference to the DAD scheduler.
+     *
+     */
+    const DadScheduler &GetDadScheduler(void) const { return mDadScheduler; }
+#endif
+
 private:
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
@@ -100,6 +123,14 @@ private:
                                                  otBackboneRouterNdProxyEvent aEvent,
                                                  const otIp6Address          *aAddress);
     void        HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aAddress);
+    void        UpdateNdProxyStandby(void);
+#endif
+#if OTBR_ENABLE_MLR_ROUTING
+    static void HandleBackboneRouterMulticastListenerEvent(void                                  *aContext,
+                                                           otBackboneRouterMulticastListenerEvent aEvent,
+                                                           const otIp6Address                    *aAddress);
+    void        HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                           const otIp6Address                    *aAddress);
 #endif
 
     static const char *StateToString(otBackboneRouterState aState);
@@ -111,6 +142,12 @@ private:
     NdProxyManager    mNdProxyManager;
     DuaRoutingManager mDuaRoutingManager;
 #endif
+#if OTBR_ENABLE_MLR_ROUTING
+    MlrManager mMlrManager;
+#endif
+#if OTBR_ENABLE_DUA_DAD_SCHEDULER
+    DadScheduler mDadScheduler;
+#endif
 };
 
 /**
@@ -0,0 +1,338 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the scheduler of the DUA duplicate address detection queries.
+ */
+
+#define OTBR_LOG_TAG "DAD"
+
+#include "backbone_router/dad_scheduler.hpp"
+
+#if OTBR_ENABLE_DUA_DAD_SCHEDULER
+
+#include <algorithm>
+#include <string>
+
+#include <string.h>
+
+#include "backbone_router/backbone_agent.hpp"
+#include "common/logging.hpp"
+
+extern "C" otError __real_otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo);
+
+extern "C" otError __wrap_otPlatUdpSend(otUdpSocket         *aUdpSocket,
+                                        otMessage           *aMessage,
+                                        const otMessageInfo *aMessageInfo)
+{
+    otbr::BackboneRouter::DadScheduler *scheduler = otbr::BackboneRouter::DadScheduler::GetActive();
+
+    return (scheduler != nullptr) ? scheduler->Send(aUdpSocket, aMessage, aMessageInfo)
+                                  : __real_otPlatUdpSend(aUdpSocket, aMessage, aMessageInfo);
+}
+
+namespace otbr {
+namespace BackboneRouter {
+
+namespace {
+
+constexpr uint16_t kMaxQuerySize       = 128;
+constexpr uint8_t  kCoapVersion        = 1;
+constexpr uint8_t  kCoapCodePost       = 0x02;
+constexpr uint8_t  kCoapHeaderSize     = 4;
+constexpr uint8_t  kCoapPayloadMarker  = 0xff;
+constexpr uint16_t kCoapOptionUriPath  = 11;
+constexpr uint8_t  kTargetEidTlv       = 0;
+constexpr char     kBackboneQueryUri[] = "/b/bq";
+
+// Reads the extended value of a CoAP option delta or length, as described in RFC 7252 section 3.1.
+bool ReadCoapOptionValue(const uint8_t *aBuffer, uint16_t aLength, uint16_t &aOffset, uint16_t &aValue)
+{
+    bool ok = true;
+
+    if (aValue == 13)
+    {
+        VerifyOrExit(aOffset + 1 <= aLength, ok = false);
+        aValue = 13 + aBuffer[aOffset];
+        aOffset += 1;
+    }
+    else if (aValue == 14)
+    {
+        VerifyOrExit(aOffset + 2 <= aLength, ok = false);
+        aValue = 269 + ((aBuffer[aOffset] << 8) | aBuffer[aOffset + 1]);
+        aOffset += 2;
+    }
+    else if (aValue == 15)
+    {
+        ok = false;
+    }
+
+exit:
+    return ok;
+}
+
+} // namespace
+
+DadScheduler *DadScheduler::sActive = nullptr;
+
+DadScheduler::DadScheduler(void)
+    : mBatchCount(0)
+    , mBatchTaskId(0)
+    , mCounters()
+{
+    assert(sActive == nullptr);
+    sActive = this;
+}
+
+DadScheduler::~DadScheduler(void)
+{
+    sActive = nullptr;
+    mTaskRunner.Cancel(mBatchTaskId);
+
+    // The waiting messages belong to the message pool of the Thread stack, which outlives the Backbone agent.
+    for (Query &query : mQueue)
+    {
+        otMessageFree(query.mMessage);
+    }
+}
+
+otError DadScheduler::Send(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    otError   error = OT_ERROR_NONE;
+    Query     query;
+    Timepoint now = Clock::now();
+
+    if (aMessageInfo->mPeerPort != BackboneAgent::kBackboneUdpPort || !ParseQueryTarget(aMessage, query.mDua))
+    {
+        ExitNow(error = __real_otPlatUdpSend(aUdpSocket, aMessage, aMessageInfo));
+    }
+
+    // The Thread stack repeats the query of a DUA, a repeat is redundant as long as the previous one hasn't been sent.
+    for (const Query &queued : mQueue)
+    {
+        if (queued.mDua == query.mDua)
+        {
+            otMessageFree(aMessage);
+            mCounters.mDeduplicated++;
+            ExitNow();
+        }
+    }
+
+    query.mUdpSocket   = aUdpSocket;
+    query.mMessage     = aMessage;
+    query.mMessageInfo = *aMessageInfo;
+    query.mQueuedTime  = now;
+
+    if (mBatchTaskId == 0 && now - mLastBatchTime >= Milliseconds(OTBR_DUA_DAD_PACING_INTERVAL_MS))
+    {
+        mLastBatchTime = now;
+        mBatchCount    = 0;
+        mCounters.mBatches++;
+    }
+
+    // A query is never dropped for pacing, a full queue is bypassed instead.
+    if ((mQueue.empty() && mBatchCount < kBatchSize) || mQueue.size() >= kMaxQueueSize)
+    {
+        mBatchCount++;
+        ExitNow(error = SendQuery(query));
+    }
+
+    mQueue.push_back(query);
+    mCounters.mDelayedQueries++;
+    mCounters.mMaxQueueLength = std::max(mCounters.mMaxQueueLength, static_cast<uint32_t>(mQueue.size()));
+
+    if (mBatchTaskId == 0)
+    {
+        mBatchTaskId = mTaskRunner.Post(
+            std::chrono::duration_cast<Milliseconds>(mLastBatchTime + Milliseconds(OTBR_DUA_DAD_PACING_INTERVAL_MS) -
+                                                     now),
+            [this]() {
+                mBatchTaskId = 0;
+                SendBatch();
+            });
+    }
+
+exit:
+    return error;
+}
+
+void DadScheduler::Flush(void)
+{
+    VerifyOrExit(!mQueue.empty());
+
+    otbrLogInfo("DadScheduler: Flush %zu queries", mQueue.size());
+
+    mTaskRunner.Cancel(mBatchTaskId);
+    mBatchTaskId = 0;
+
+    while (!mQueue.empty())
+    {
+        if (SendQuery(mQueue.front()) != OT_ERROR_NONE)
+        {
+            otMessageFree(mQueue.front().mMessage);
+        }
+        mQueue.pop_front();
+    }
+
+exit:
+    return;
+}
+
+void DadScheduler::SendBatch(void)
+{
+    Timepoint now      = Clock::now();
+    Timepoint deadline = now + Milliseconds(OTBR_DUA_DAD_PACING_INTERVAL_MS) - Milliseconds(OTBR_DUA_DAD_MAX_DELAY_MS);
+
+    mLastBatchTime = now;
+    mBatchCount    = 0;
+    mCounters.mBatches++;
+
+    // The queries which would wait beyond the maximum delay for the next batch are sent in this one too.
+    while (!mQueue.empty() && (mBatchCount < kBatchSize || mQueue.front().mQueuedTime <= deadline))
+    {
+        // The socket of the Thread stack outlives the query, sending fails if it has been closed meanwhile.
+        if (SendQuery(mQueue.front()) != OT_ERROR_NONE)
+        {
+            otMessageFree(mQueue.front().mMessage);
+        }
+        mQueue.pop_front();
+        mBatchCount++;
+    }
+
+    if (!mQueue.empty())
+    {
+        mBatchTaskId = mTaskRunner.Post(Milliseconds(OTBR_DUA_DAD_PACING_INTERVAL_MS), [this]() {
+            mBatchTaskId = 0;
+            SendBatch();
+        });
+    }
+}
+
+otError DadScheduler::SendQuery(const Query &aQuery)
+{
+    otError error = __real_otPlatUdpSend(aQuery.mUdpSocket, aQuery.mMessage, &aQuery.mMessageInfo);
+
+    if (error == OT_ERROR_NONE)
+    {
+        mCounters.mQueries++;
+        RecordLatency(aQuery.mDua, std::chrono::duration_cast<Milliseconds>(Clock::now() - aQuery.mQueuedTime));
+    }
+    else
+    {
+        otbrLogWarning("DadScheduler: Failed to send the query of %s: %s", aQuery.mDua.ToString().c_str(),
+                       otThreadErrorToString(error));
+    }
+
+    return error;
+}
+
+void DadScheduler::RecordLatency(const Ip6Address &aDua, Milliseconds aDelay)
+{
+    auto it = mDuaLatencies.find(aDua);
+
+    if (it == mDuaLatencies.end())
+    {
+        // The DUA queried least recently makes room for a new one.
+        if (mDuaLatencies.size() >= kMaxDuas)
+        {
+            mDuaLatencies.erase(std::min_element(mDuaLatencies.begin(), mDuaLatencies.end(),
+                                                 [](const std::pair<const Ip6Address, DuaLatency> &aLhs,
+                                                    const std::pair<const Ip6Address, DuaLatency> &aRhs) {
+                                                     return aLhs.second.mLastSentTime < aRhs.second.mLastSentTime;
+                                                 }));
+        }
+
+        it = mDuaLatencies.emplace(aDua, DuaLatency()).first;
+    }
+
+    it->second.mQueries++;
+    it->second.mLastDelay    = aDelay;
+    it->second.mMaxDelay     = std::max(it->second.mMaxDelay, aDelay);
+    it->second.mLastSentTime = Clock::now();
+}
+
+bool DadScheduler::ParseQueryTarget(const otMessage *aMessage, Ip6Address &aDua)
+{
+    bool        found = false;
+    uint8_t     buffer[kMaxQuerySize];
+    uint16_t    length       = otMessageRead(aMessage, 0, buffer, sizeof(buffer));
+    uint16_t    offset       = kCoapHeaderSize;
+    uint16_t    optionNumber = 0;
+    std::string uriPath;
+
+    VerifyOrExit(length >= kCoapHeaderSize && (buffer[0] >> 6) == kCoapVersion && buffer[1] == kCoapCodePost);
+    offset += buffer[0] & 0x0f;
+
+    while (offset < length && buffer[offset] != kCoapPayloadMarker)
+    {
+        uint16_t delta        = buffer[offset] >> 4;
+        uint16_t optionLength = buffer[offset] & 0x0f;
+
+        offset++;
+        VerifyOrExit(ReadCoapOptionValue(buffer, length, offset, delta));
+        VerifyOrExit(ReadCoapOptionValue(buffer, length, offset, optionLength));
+        VerifyOrExit(offset + optionLength <= length);
+
+        optionNumber += delta;
+        if (optionNumber == kCoapOptionUriPath)
+        {
+            uriPath += '/';
+            uriPath.append(reinterpret_cast<const char *>(&buffer[offset]), optionLength);
+        }
+        offset += optionLength;
+    }
+
+    VerifyOrExit(uriPath == kBackboneQueryUri && offset < length);
+    offset++;
+
+    // The payload is a sequence of Thread TLVs, a Backbone Query always has a Target EID TLV.
+    while (offset + 2 <= length)
+    {
+        uint8_t type      = buffer[offset];
+        uint8_t tlvLength = buffer[offset + 1];
+
+        offset += 2;
+        VerifyOrExit(offset + tlvLength <= length);
+
+        if (type == kTargetEidTlv && tlvLength == sizeof(aDua.m8))
+        {
+            memcpy(aDua.m8, &buffer[offset], sizeof(aDua.m8));
+            ExitNow(found = true);
+        }
+        offset += tlvLength;
+    }
+
+exit:
+    return found;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_DAD_SCHEDULER
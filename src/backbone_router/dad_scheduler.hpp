@@ -0,0 +1,222 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the scheduler of the DUA duplicate address detection queries.
+ */
+
+#ifndef BACKBONE_ROUTER_DAD_SCHEDULER_HPP_
+#define BACKBONE_ROUTER_DAD_SCHEDULER_HPP_
+
+#include "openthread-br/config.h"
+
+/**
+ * The maximum number of Backbone Queries sent per pacing interval.
+ *
+ */
+#ifndef OTBR_DUA_DAD_BATCH_SIZE
+#define OTBR_DUA_DAD_BATCH_SIZE 8
+#endif
+
+/**
+ * The interval (in milliseconds) at which the batches of Backbone Queries are sent.
+ *
+ */
+#ifndef OTBR_DUA_DAD_PACING_INTERVAL_MS
+#define OTBR_DUA_DAD_PACING_INTERVAL_MS 50
+#endif
+
+/**
+ * The maximum time (in milliseconds) a Backbone Query is delayed.
+ *
+ * It must be well below the DAD period of the Thread stack, so that the answers to a query still arrive in time.
+ *
+ */
+#ifndef OTBR_DUA_DAD_MAX_DELAY_MS
+#define OTBR_DUA_DAD_MAX_DELAY_MS 500
+#endif
+
+#if OTBR_ENABLE_DUA_DAD_SCHEDULER
+
+#include <deque>
+#include <unordered_map>
+
+#include <stdint.h>
+
+#include <openthread/platform/udp.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-backbone
+ *
+ * @{
+ */
+
+/**
+ * This class implements the scheduler of the Backbone Queries (BB.qry) sent by the Thread stack for the duplicate
+ * address detection of DUAs.
+ *
+ * When many DUAs are registered at once, for example after a power outage, the queries are sent in paced batches
+ * instead of all in the same mainloop iteration. A query for a DUA whose previous query is still waiting is dropped.
+ *
+ */
+class DadScheduler : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the counters of the scheduler.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mQueries;        ///< The number of queries sent
+        uint64_t mDelayedQueries; ///< The number of queries which waited for a later batch
+        uint64_t mDeduplicated;   ///< The number of queries dropped because one for the same DUA was waiting
+        uint64_t mBatches;        ///< The number of batches sent
+        uint32_t mMaxQueueLength; ///< The maximum number of queries waiting at once
+    };
+
+    /**
+     * This structure represents the query latency of a DUA.
+     *
+     */
+    struct DuaLatency
+    {
+        uint32_t     mQueries;      ///< The number of queries sent for the DUA
+        Milliseconds mLastDelay;    ///< The time the last query of the DUA waited before it was sent
+        Milliseconds mMaxDelay;     ///< The maximum time a query of the DUA waited before it was sent
+        Timepoint    mLastSentTime; ///< The time the last query of the DUA was sent
+    };
+
+    /**
+     * This constructor initializes the scheduler.
+     *
+     * The scheduler serves the Backbone Queries of the Thread stack from then on.
+     *
+     */
+    DadScheduler(void);
+
+    /**
+     * This destructor frees the queries still waiting.
+     *
+     */
+    ~DadScheduler(void);
+
+    /**
+     * This method sends a UDP message of the Thread stack, a Backbone Query may be delayed to a later batch.
+     *
+     * @param[in] aUdpSocket    A pointer to the UDP socket.
+     * @param[in] aMessage      A pointer to the message, which is owned by the scheduler if the sending succeeds.
+     * @param[in] aMessageInfo  A pointer to the message info.
+     *
+     * @returns The error of sending the message.
+     *
+     */
+    otError Send(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo);
+
+    /**
+     * This method sends all the waiting queries.
+     *
+     */
+    void Flush(void);
+
+    /**
+     * This method returns the counters of the scheduler.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method returns the query latencies of the DUAs.
+     *
+     * @returns A reference to the query latencies of the recently queried DUAs.
+     *
+     */
+    const std::unordered_map<Ip6Address, DuaLatency> &GetDuaLatencies(void) const { return mDuaLatencies; }
+
+    /**
+     * This method returns the scheduler serving the Backbone Queries of the Thread stack.
+     *
+     * @returns A pointer to the scheduler, or nullptr if there is none.
+     *
+     */
+    static DadScheduler *GetActive(void) { return sActive; }
+
+private:
+    static constexpr size_t kBatchSize    = OTBR_DUA_DAD_BATCH_SIZE;
+    static constexpr size_t kMaxDuas      = 256;
+    static constexpr size_t kMaxQueueSize = 256;
+
+    static_assert(kBatchSize > 0, "OTBR_DUA_DAD_BATCH_SIZE must be greater than 0");
+
+    struct Query
+    {
+        Ip6Address    mDua;
+        otUdpSocket  *mUdpSocket;
+        otMessage    *mMessage;
+        otMessageInfo mMessageInfo;
+        Timepoint     mQueuedTime;
+    };
+
+    static bool ParseQueryTarget(const otMessage *aMessage, Ip6Address &aDua);
+
+    otError SendQuery(const Query &aQuery);
+    void    SendBatch(void);
+    void    RecordLatency(const Ip6Address &aDua, Milliseconds aDelay);
+
+    static DadScheduler *sActive;
+
+    std::deque<Query>                          mQueue;
+    std::unordered_map<Ip6Address, DuaLatency> mDuaLatencies;
+    Timepoint                                  mLastBatchTime;
+    size_t                                     mBatchCount;
+    TaskRunner::TaskId                         mBatchTaskId;
+    Counters                                   mCounters;
+    TaskRunner                                 mTaskRunner;
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_DAD_SCHEDULER
+
+#endif // BACKBONE_ROUTER_DAD_SCHEDULER_HPP_
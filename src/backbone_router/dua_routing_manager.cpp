@@ -35,63 +35,355 @@
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <linux/fib_rules.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
 
 namespace otbr {
 
 namespace BackboneRouter {
 
+// The maximum number of requests sent in a single netlink message, whose acknowledgements fit in the receive buffer.
+static constexpr size_t kMaxNetlinkBatchSize = 64;
+
+// The size of the buffer to receive netlink messages, as recommended by netlink(7).
+static constexpr size_t kNetlinkReceiveBufferSize = 8192;
+
+// The metric of the routes to the Thread interface in the main table.
+static constexpr uint32_t kThreadRouteMetric = 1;
+
+struct DuaRoutingManager::NetlinkRequest
+{
+    nlmsghdr nh;
+    union
+    {
+        rtmsg        rtm;
+        fib_rule_hdr frh;
+    };
+    char buf[64];
+};
+
+static void AddRtAttr(nlmsghdr *aHeader, uint32_t aMaxLen, uint16_t aType, const void *aData, uint16_t aLen)
+{
+    uint16_t len = RTA_LENGTH(aLen);
+    rtattr  *rta;
+
+    assert(NLMSG_ALIGN(aHeader->nlmsg_len) + RTA_ALIGN(len) <= aMaxLen);
+    OTBR_UNUSED_VARIABLE(aMaxLen);
+
+    rta           = reinterpret_cast<rtattr *>(reinterpret_cast<char *>(aHeader) + NLMSG_ALIGN(aHeader->nlmsg_len));
+    rta->rta_type = aType;
+    rta->rta_len  = len;
+    memcpy(RTA_DATA(rta), aData, aLen);
+    aHeader->nlmsg_len = NLMSG_ALIGN(aHeader->nlmsg_len) + RTA_ALIGN(len);
+}
+
+void DuaRoutingManager::PrepareRouteRequest(NetlinkRequest  &aRequest,
+                                            bool             aIsAdded,
+                                            const Ip6Prefix &aPrefix,
+                                            unsigned int     aIfIndex,
+                                            uint32_t         aTable,
+                                            uint32_t         aMetric)
+{
+    uint32_t ifIndex = aIfIndex;
+
+    memset(&aRequest, 0, sizeof(aRequest));
+
+    aRequest.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(rtmsg));
+    aRequest.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    aRequest.nh.nlmsg_type  = aIsAdded ? RTM_NEWROUTE : RTM_DELROUTE;
+
+    // Tables beyond 255 are only given by the `RTA_TABLE` attribute.
+    aRequest.rtm.rtm_family   = AF_INET6;
+    aRequest.rtm.rtm_dst_len  = aPrefix.mLength;
+    aRequest.rtm.rtm_table    = static_cast<uint8_t>((aTable <= UINT8_MAX) ? aTable : uint32_t{RT_TABLE_UNSPEC});
+    aRequest.rtm.rtm_protocol = RTPROT_STATIC;
+    aRequest.rtm.rtm_scope    = RT_SCOPE_UNIVERSE;
+    aRequest.rtm.rtm_type     = RTN_UNICAST;
+
+    AddRtAttr(&aRequest.nh, sizeof(aRequest), RTA_DST, &aPrefix.mPrefix, sizeof(aPrefix.mPrefix));
+    AddRtAttr(&aRequest.nh, sizeof(aRequest), RTA_OIF, &ifIndex, sizeof(ifIndex));
+    AddRtAttr(&aRequest.nh, sizeof(aRequest), RTA_TABLE, &aTable, sizeof(aTable));
+
+    // Without a metric, the route gets the default one when added and any route matches when deleted.
+    if (aMetric != 0)
+    {
+        AddRtAttr(&aRequest.nh, sizeof(aRequest), RTA_PRIORITY, &aMetric, sizeof(aMetric));
+    }
+}
+
+DuaRoutingManager::~DuaRoutingManager(void)
+{
+    if (mNetlinkFd >= 0)
+    {
+        close(mNetlinkFd);
+        mNetlinkFd = -1;
+    }
+}
+
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
+    otbrError                   error = OTBR_ERROR_NONE;
+    std::vector<NetlinkRequest> requests;
+
     VerifyOrExit(!mEnabled);
-    mEnabled = true;
 
+    SuccessOrExit(error = InitNetlink());
+    mInterfaceIndex         = if_nametoindex(mInterfaceName.c_str());
+    mBackboneInterfaceIndex = if_nametoindex(mBackboneInterfaceName.c_str());
+    VerifyOrExit(mInterfaceIndex != 0 && mBackboneInterfaceIndex != 0, error = OTBR_ERROR_ERRNO);
+
+    mEnabled      = true;
     mDomainPrefix = aDomainPrefix;
 
-    AddDefaultRouteToThread();
-    AddPolicyRouteToBackbone();
+    // All the routes are programmed with a single round trip, so that a Primary BBR transition converges fast.
+    PrepareDefaultRouteToThread(requests, /* aIsAdded */ true);
+    PreparePolicyRouteToBackbone(requests, /* aIsAdded */ true);
+
+    for (const Ip6Address &dua : mDuas)
+    {
+        PrepareHostRouteToThread(requests, dua, /* aIsAdded */ true);
+    }
+
+    SendNetlinkRequests(requests);
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::Disable(void)
 {
+    std::vector<NetlinkRequest> requests;
+
     VerifyOrExit(mEnabled);
     mEnabled = false;
 
-    DelDefaultRouteToThread();
-    DelPolicyRouteToBackbone();
+    for (const Ip6Address &dua : mDuas)
+    {
+        PrepareHostRouteToThread(requests, dua, /* aIsAdded */ false);
+    }
+
+    PrepareDefaultRouteToThread(requests, /* aIsAdded */ false);
+    PreparePolicyRouteToBackbone(requests, /* aIsAdded */ false);
+
+    SendNetlinkRequests(requests);
 
 exit:
     otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
-void DuaRoutingManager::AddDefaultRouteToThread(void)
+void DuaRoutingManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
 {
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    std::vector<NetlinkRequest> requests;
+    Ip6Address                  dua;
+
+    if (aEvent != OT_BACKBONE_ROUTER_NDPROXY_CLEARED)
+    {
+        assert(aDua != nullptr);
+        dua = Ip6Address(aDua->mFields.m8);
+    }
+
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
+    case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
+        if (mDuas.insert(dua).second && mEnabled)
+        {
+            PrepareHostRouteToThread(requests, dua, /* aIsAdded */ true);
+        }
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
+        if (mDuas.erase(dua) > 0 && mEnabled)
+        {
+            PrepareHostRouteToThread(requests, dua, /* aIsAdded */ false);
+        }
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
+        for (const Ip6Address &proxiedDua : mDuas)
+        {
+            PrepareHostRouteToThread(requests, proxiedDua, /* aIsAdded */ false);
+        }
+        mDuas.clear();
+
+        if (!mEnabled)
+        {
+            requests.clear();
+        }
+        break;
+    }
+
+    SendNetlinkRequests(requests);
 }
 
-void DuaRoutingManager::DelDefaultRouteToThread(void)
+void DuaRoutingManager::PrepareDefaultRouteToThread(std::vector<NetlinkRequest> &aRequests, bool aIsAdded)
 {
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    aRequests.emplace_back();
+    PrepareRouteRequest(aRequests.back(), aIsAdded, mDomainPrefix, mInterfaceIndex, RT_TABLE_MAIN, kThreadRouteMetric);
 }
 
-void DuaRoutingManager::AddPolicyRouteToBackbone(void)
+void DuaRoutingManager::PreparePolicyRouteToBackbone(std::vector<NetlinkRequest> &aRequests, bool aIsAdded)
 {
+    uint32_t table = OTBR_DUA_ROUTING_TABLE;
+
     // Packets from Thread interface use route table "openthread"
-    SystemUtils::ExecuteCommand("ip -6 rule add iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    aRequests.emplace_back();
+    {
+        NetlinkRequest &request = aRequests.back();
+
+        memset(&request, 0, sizeof(request));
+
+        request.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(fib_rule_hdr));
+        request.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+        request.nh.nlmsg_type  = aIsAdded ? RTM_NEWRULE : RTM_DELRULE;
+
+        request.frh.family = AF_INET6;
+        request.frh.table  = static_cast<uint8_t>((table <= UINT8_MAX) ? table : uint32_t{RT_TABLE_UNSPEC});
+        request.frh.action = FR_ACT_TO_TBL;
+
+        AddRtAttr(&request.nh, sizeof(request), FRA_IIFNAME, mInterfaceName.c_str(),
+                  static_cast<uint16_t>(mInterfaceName.size() + 1));
+        AddRtAttr(&request.nh, sizeof(request), FRA_TABLE, &table, sizeof(table));
+    }
+
+    aRequests.emplace_back();
+    PrepareRouteRequest(aRequests.back(), aIsAdded, mDomainPrefix, mBackboneInterfaceIndex, table, /* aMetric */ 0);
+}
+
+void DuaRoutingManager::PrepareHostRouteToThread(std::vector<NetlinkRequest> &aRequests,
+                                                 const Ip6Address            &aDua,
+                                                 bool                         aIsAdded)
+{
+    Ip6Prefix hostPrefix;
+
+    hostPrefix.mPrefix = aDua;
+    hostPrefix.mLength = 128;
+
+    aRequests.emplace_back();
+    PrepareRouteRequest(aRequests.back(), aIsAdded, hostPrefix, mInterfaceIndex, RT_TABLE_MAIN, kThreadRouteMetric);
+}
+
+otbrError DuaRoutingManager::InitNetlink(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mNetlinkFd < 0);
+
+    // The socket is only used for requests, it's not subscribed to any group.
+    mNetlinkFd = CreateNetLinkRouteSocket(/* aNlGroups */ 0);
+    VerifyOrExit(mNetlinkFd >= 0, error = OTBR_ERROR_ERRNO);
+
+#if defined(SOL_NETLINK) && defined(NETLINK_CAP_ACK)
+    {
+        int enable = 1;
+
+        // The acknowledgements of failed requests don't carry the requests back.
+        if (setsockopt(mNetlinkFd, SOL_NETLINK, NETLINK_CAP_ACK, &enable, sizeof(enable)) != 0)
+        {
+            otbrLogWarning("DuaRoutingManager: Failed to enable NETLINK_CAP_ACK: %s", strerror(errno));
+        }
+    }
+#endif
+
+exit:
+    return error;
 }
 
-void DuaRoutingManager::DelPolicyRouteToBackbone(void)
+void DuaRoutingManager::SendNetlinkRequests(std::vector<NetlinkRequest> &aRequests)
 {
-    SystemUtils::ExecuteCommand("ip -6 rule del iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    std::vector<iovec> iovs(aRequests.size());
+
+    VerifyOrExit(!aRequests.empty());
+    VerifyOrExit(mNetlinkFd >= 0, otbrLogWarning("DuaRoutingManager: Netlink socket is not initialized"));
+
+    for (size_t i = 0; i < aRequests.size(); i++)
+    {
+        aRequests[i].nh.nlmsg_seq = ++mNetlinkSequence;
+        iovs[i].iov_base          = &aRequests[i];
+        iovs[i].iov_len           = NLMSG_ALIGN(aRequests[i].nh.nlmsg_len);
+    }
+
+    // The kernel processes all the requests of a single message in order, and acknowledges them before `sendmsg()`
+    // returns.
+    for (size_t begin = 0; begin < aRequests.size(); begin += kMaxNetlinkBatchSize)
+    {
+        size_t count = std::min(kMaxNetlinkBatchSize, aRequests.size() - begin);
+        msghdr msg;
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov    = &iovs[begin];
+        msg.msg_iovlen = count;
+
+        if (sendmsg(mNetlinkFd, &msg, 0) == -1)
+        {
+            otbrLogWarning("DuaRoutingManager: Failed to send requests#%u-%u: %s", aRequests[begin].nh.nlmsg_seq,
+                           aRequests[begin + count - 1].nh.nlmsg_seq, strerror(errno));
+            continue;
+        }
+
+        ProcessNetlinkAcks(aRequests, begin, count);
+    }
+
+exit:
+    return;
+}
+
+void DuaRoutingManager::ProcessNetlinkAcks(const std::vector<NetlinkRequest> &aRequests, size_t aBegin, size_t aCount)
+{
+    alignas(nlmsghdr) char buffer[kNetlinkReceiveBufferSize];
+    ssize_t                length;
+    size_t                 ackCount     = 0;
+    size_t                 failureCount = 0;
+    uint32_t               firstSeq     = aRequests[aBegin].nh.nlmsg_seq;
+
+    while (ackCount < aCount && (length = recv(mNetlinkFd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0)
+    {
+        int remaining = static_cast<int>(length);
+
+        for (nlmsghdr *msg = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(msg, remaining);
+             msg = NLMSG_NEXT(msg, remaining))
+        {
+            const NetlinkRequest *request;
+            int                   error;
+
+            // Acknowledgements left behind by an earlier batch are skipped.
+            if (msg->nlmsg_type != NLMSG_ERROR || msg->nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr)) ||
+                msg->nlmsg_seq - firstSeq >= aCount)
+            {
+                continue;
+            }
+
+            request = &aRequests[aBegin + (msg->nlmsg_seq - firstSeq)];
+            error   = -reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(msg))->error;
+            ackCount++;
+
+            // Adding an existing route and deleting a missing one are expected at transitions.
+            if (error == 0 || (error == EEXIST && (request->nh.nlmsg_flags & NLM_F_CREATE)) ||
+                ((error == ESRCH || error == ENOENT) && !(request->nh.nlmsg_flags & NLM_F_CREATE)))
+            {
+                continue;
+            }
+
+            failureCount++;
+            otbrLogWarning("DuaRoutingManager: Netlink request#%u (type %u) failed: %s", msg->nlmsg_seq,
+                           request->nh.nlmsg_type, strerror(error));
+        }
+    }
+
+    otbrLogInfo("DuaRoutingManager: Sent requests#%u-%u, %zu failed", firstSeq,
+                static_cast<uint32_t>(firstSeq + aCount - 1), failureCount);
 }
 
 } // namespace BackboneRouter
@@ -36,15 +36,24 @@
 
 #include "openthread-br/config.h"
 
+/**
+ * The id of the routing table "openthread" used for the packets from the Thread interface.
+ *
+ * It must match the name registered in /etc/iproute2/rt_tables by script/setup.
+ */
+#ifndef OTBR_DUA_ROUTING_TABLE
+#define OTBR_DUA_ROUTING_TABLE 88
+#endif
+
 #if OTBR_ENABLE_DUA_ROUTING
 
 #include <set>
 #include <utility>
+#include <vector>
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
 #include "ncp/rcp_host.hpp"
-#include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -73,9 +82,19 @@ public:
         : mEnabled(false)
         , mInterfaceName(std::move(aInterfaceName))
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+        , mInterfaceIndex(0)
+        , mBackboneInterfaceIndex(0)
+        , mNetlinkFd(-1)
+        , mNetlinkSequence(0)
     {
     }
 
+    /**
+     * This destructor closes the netlink socket.
+     *
+     */
+    ~DuaRoutingManager(void);
+
     /**
      * This method enables the DUA routing manager.
      *
@@ -88,16 +107,58 @@ public:
      */
     void Disable(void);
 
+    /**
+     * This method sets the Backbone network interface.
+     *
+     * The DUA routing manager must be disabled.
+     *
+     * @param[in] aBackboneInterfaceName  The Backbone network interface name.
+     *
+     */
+    void SetBackboneInterfaceName(std::string aBackboneInterfaceName)
+    {
+        assert(!mEnabled);
+        mBackboneInterfaceName = std::move(aBackboneInterfaceName);
+    }
+
+    /**
+     * This method handles a Backbone Router ND Proxy event.
+     *
+     * A host route to the Thread interface is kept for each DUA registered to this Backbone Router.
+     *
+     * @param[in] aEvent  The Backbone Router ND Proxy event type.
+     * @param[in] aDua    The Domain Unicast Address of the ND Proxy, or `nullptr` if @p `aEvent` is
+     *                    `OT_BACKBONE_ROUTER_NDPROXY_CLEARED`.
+     *
+     */
+    void HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua);
+
 private:
-    void AddDefaultRouteToThread(void);
-    void DelDefaultRouteToThread(void);
-    void AddPolicyRouteToBackbone(void);
-    void DelPolicyRouteToBackbone(void);
-
-    Ip6Prefix   mDomainPrefix;
-    bool        mEnabled : 1;
-    std::string mInterfaceName;
-    std::string mBackboneInterfaceName;
+    struct NetlinkRequest;
+
+    static void PrepareRouteRequest(NetlinkRequest  &aRequest,
+                                    bool             aIsAdded,
+                                    const Ip6Prefix &aPrefix,
+                                    unsigned int     aIfIndex,
+                                    uint32_t         aTable,
+                                    uint32_t         aMetric);
+
+    void      PrepareDefaultRouteToThread(std::vector<NetlinkRequest> &aRequests, bool aIsAdded);
+    void      PreparePolicyRouteToBackbone(std::vector<NetlinkRequest> &aRequests, bool aIsAdded);
+    void      PrepareHostRouteToThread(std::vector<NetlinkRequest> &aRequests, const Ip6Address &aDua, bool aIsAdded);
+    otbrError InitNetlink(void);
+    void      SendNetlinkRequests(std::vector<NetlinkRequest> &aRequests);
+    void      ProcessNetlinkAcks(const std::vector<NetlinkRequest> &aRequests, size_t aBegin, size_t aCount);
+
+    Ip6Prefix            mDomainPrefix;
+    bool                 mEnabled : 1;
+    std::string          mInterfaceName;
+    std::string          mBackboneInterfaceName;
+    std::set<Ip6Address> mDuas;
+    unsigned int         mInterfaceIndex;
+    unsigned int         mBackboneInterfaceIndex;
+    int                  mNetlinkFd;
+    uint32_t             mNetlinkSequence;
 };
 
 /**
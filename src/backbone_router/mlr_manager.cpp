@@ -0,0 +1,601 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   The file implements the Multicast Listener Registration (MLR) manager.
+ */
+
+#define OTBR_LOG_TAG "MLR"
+
+#include "backbone_router/mlr_manager.hpp"
+
+#if OTBR_ENABLE_MLR_ROUTING
+
+#include <algorithm>
+#include <iterator>
+
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <linux/mroute6.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+// The maximum number of kernel messages handled per mainloop iteration, so that a burst of new multicast flows
+// doesn't starve the other processors.
+static constexpr int kMaxMessagesPerProcess = 64;
+
+// Multicast traffic of a scope larger than realm-local is forwarded from Thread to the backbone.
+static constexpr uint8_t kRealmLocalScope = 3;
+
+MlrManager::MlrManager(otbr::Ncp::RcpHost &aHost, std::string aInterfaceName, std::string aBackboneInterfaceName)
+    : mHost(aHost)
+    , mInterfaceName(std::move(aInterfaceName))
+    , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+    , mBackboneIfIndex(0)
+    , mMulticastRouterSock(-1)
+    , mMfcIdleCheckTaskId(0)
+    , mCounters()
+    , mTaskRunner(TaskRunner::Mode::kTimerWheel)
+{
+}
+
+MlrManager::~MlrManager(void)
+{
+    Disable();
+}
+
+void MlrManager::Enable(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!IsEnabled());
+
+    SuccessOrExit(error = InitMulticastRouterSock());
+    SyncListeners();
+
+    for (const auto &listener : mListeners)
+    {
+        mPendingGroups.push_back(listener.first);
+    }
+
+    ScheduleMfcIdleCheck();
+
+exit:
+    otbrLogResult(error, "MlrManager: %s", __FUNCTION__);
+}
+
+void MlrManager::Disable(void)
+{
+    VerifyOrExit(IsEnabled());
+
+    // Closing the socket removes all the MFC entries, the multicast interfaces and the memberships.
+    FiniMulticastRouterSock();
+    mMfcEntries.clear();
+
+    for (auto &listener : mListeners)
+    {
+        listener.second.mJoined = false;
+    }
+
+    mTaskRunner.Cancel(mMfcIdleCheckTaskId);
+    mMfcIdleCheckTaskId = 0;
+
+    otbrLogInfo("MlrManager: %s", __FUNCTION__);
+
+exit:
+    return;
+}
+
+void MlrManager::SetBackboneInterfaceName(std::string aBackboneInterfaceName)
+{
+    assert(!IsEnabled());
+
+    mBackboneInterfaceName = std::move(aBackboneInterfaceName);
+}
+
+otbrError MlrManager::InitMulticastRouterSock(void)
+{
+    otbrError           error = OTBR_ERROR_ERRNO;
+    int                 one   = 1;
+    struct icmp6_filter filter;
+    struct mif6ctl      mif6ctl;
+    unsigned int        ifIndex;
+
+    mMulticastRouterSock = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketNonBlock);
+    VerifyOrExit(mMulticastRouterSock >= 0);
+
+    // Only one socket may be the multicast router of a network namespace.
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_INIT, &one, sizeof(one)) == 0);
+
+    // The upcalls of the kernel are not subject to the filter, no ICMPv6 message is needed.
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0);
+
+    memset(&mif6ctl, 0, sizeof(mif6ctl));
+    VerifyOrExit((ifIndex = if_nametoindex(mInterfaceName.c_str())) > 0);
+    mif6ctl.mif6c_mifi = kMifIndexThread;
+    mif6ctl.mif6c_pifi = static_cast<uint16_t>(ifIndex);
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MIF, &mif6ctl, sizeof(mif6ctl)) == 0);
+
+    VerifyOrExit((mBackboneIfIndex = if_nametoindex(mBackboneInterfaceName.c_str())) > 0);
+    mif6ctl.mif6c_mifi = kMifIndexBackbone;
+    mif6ctl.mif6c_pifi = static_cast<uint16_t>(mBackboneIfIndex);
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MIF, &mif6ctl, sizeof(mif6ctl)) == 0);
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("MlrManager: Failed to initialize the multicast router socket: %s", strerror(errno));
+        FiniMulticastRouterSock();
+    }
+
+    return error;
+}
+
+void MlrManager::FiniMulticastRouterSock(void)
+{
+    if (mMulticastRouterSock >= 0)
+    {
+        close(mMulticastRouterSock);
+        mMulticastRouterSock = -1;
+    }
+}
+
+void MlrManager::SyncListeners(void)
+{
+    otBackboneRouterMulticastListenerIterator iterator = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    otBackboneRouterMulticastListenerInfo     info;
+
+    while (otBackboneRouterMulticastListenerGetNext(mHost.GetInstance(), &iterator, &info) == OT_ERROR_NONE)
+    {
+        AddListener(Ip6Address(info.mAddress.mFields.m8), info.mTimeout);
+    }
+}
+
+void MlrManager::HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                            const otIp6Address                    *aAddress)
+{
+    Ip6Address group(aAddress->mFields.m8);
+
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED:
+    {
+        uint32_t timeout = GetListenerTimeout(group);
+
+        // The forwarding of the group expires with its MLR timeout, the default is used if it can't be told.
+        AddListener(group, timeout > 0 ? timeout : OTBR_MLR_LISTENER_TIMEOUT);
+        break;
+    }
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED:
+        RemoveListener(group);
+        break;
+    }
+}
+
+void MlrManager::AddListener(const Ip6Address &aGroup, uint32_t aTimeout)
+{
+    // Value-initialization makes a new listener start unregistered, not joined and without expiry.
+    Listener &listener = mListeners[aGroup];
+
+    if (!listener.mRegistered)
+    {
+        listener.mRegistered = true;
+        mCounters.mListenersAdded++;
+        mPendingGroups.push_back(aGroup);
+    }
+
+    mTaskRunner.Cancel(listener.mExpiryTaskId);
+    listener.mExpiryTaskId =
+        mTaskRunner.Post(std::chrono::seconds(aTimeout), [this, aGroup]() { HandleListenerExpiry(aGroup); });
+}
+
+void MlrManager::RemoveListener(const Ip6Address &aGroup)
+{
+    auto it = mListeners.find(aGroup);
+
+    VerifyOrExit(it != mListeners.end() && it->second.mRegistered);
+
+    // The listener is erased once the group is left.
+    it->second.mRegistered = false;
+    mTaskRunner.Cancel(it->second.mExpiryTaskId);
+    it->second.mExpiryTaskId = 0;
+    mCounters.mListenersRemoved++;
+    mPendingGroups.push_back(aGroup);
+
+exit:
+    return;
+}
+
+uint32_t MlrManager::GetListenerTimeout(const Ip6Address &aGroup) const
+{
+    otBackboneRouterMulticastListenerIterator iterator = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    otBackboneRouterMulticastListenerInfo     info;
+    uint32_t                                  timeout = 0;
+
+    while (otBackboneRouterMulticastListenerGetNext(mHost.GetInstance(), &iterator, &info) == OT_ERROR_NONE)
+    {
+        if (Ip6Address(info.mAddress.mFields.m8) == aGroup)
+        {
+            timeout = info.mTimeout;
+            break;
+        }
+    }
+
+    return timeout;
+}
+
+void MlrManager::HandleListenerExpiry(const Ip6Address &aGroup)
+{
+    auto     it = mListeners.find(aGroup);
+    uint32_t timeout;
+
+    VerifyOrExit(it != mListeners.end() && it->second.mRegistered);
+    it->second.mExpiryTaskId = 0;
+
+    // OpenThread doesn't report the renewals of a listener, it's only removed if OpenThread no longer has it.
+    timeout = GetListenerTimeout(aGroup);
+    if (timeout > 0)
+    {
+        AddListener(aGroup, timeout);
+        ExitNow();
+    }
+
+    otbrLogInfo("MlrManager: Listener of %s expired", aGroup.ToString().c_str());
+    mCounters.mListenersExpired++;
+    RemoveListener(aGroup);
+
+exit:
+    return;
+}
+
+void MlrManager::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(IsEnabled());
+
+    UpdatePendingGroups();
+
+    FD_SET(mMulticastRouterSock, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mMulticastRouterSock);
+
+exit:
+    return;
+}
+
+void MlrManager::Process(const MainloopContext &aMainloop)
+{
+    VerifyOrExit(IsEnabled() && FD_ISSET(mMulticastRouterSock, &aMainloop.mReadFdSet));
+
+    ProcessMulticastRouterMessages();
+
+exit:
+    return;
+}
+
+void MlrManager::UpdatePendingGroups(void)
+{
+    VerifyOrExit(!mPendingGroups.empty());
+
+    // The listener changes of a mainloop iteration are applied together, a group added and removed in between is
+    // neither joined nor left.
+    for (const Ip6Address &group : mPendingGroups)
+    {
+        UpdateGroup(group);
+    }
+
+    otbrLogInfo("MlrManager: Updated %zu groups, %zu listeners in total", mPendingGroups.size(), mListeners.size());
+    mPendingGroups.clear();
+
+exit:
+    return;
+}
+
+void MlrManager::UpdateGroup(const Ip6Address &aGroup)
+{
+    auto listenerIt = mListeners.find(aGroup);
+    auto mfcIt      = mMfcEntries.find(aGroup);
+    bool registered = (listenerIt != mListeners.end() && listenerIt->second.mRegistered);
+
+    if (listenerIt != mListeners.end())
+    {
+        Listener &listener = listenerIt->second;
+
+        if (registered && !listener.mJoined)
+        {
+            // A failed join is retried at the next change of the listener.
+            listener.mJoined = (UpdateMembership(aGroup, /* aJoin */ true) == OTBR_ERROR_NONE);
+        }
+        else if (!registered && listener.mJoined)
+        {
+            UpdateMembership(aGroup, /* aJoin */ false);
+            listener.mJoined = false;
+        }
+
+        if (!registered)
+        {
+            mListeners.erase(listenerIt);
+        }
+    }
+
+    VerifyOrExit(mfcIt != mMfcEntries.end());
+
+    for (MfcEntry &entry : mfcIt->second)
+    {
+        if (entry.mInputMif == kMifIndexBackbone && entry.mForwarding != registered)
+        {
+            entry.mForwarding = registered;
+            SetMfcEntry(aGroup, entry);
+        }
+    }
+
+exit:
+    return;
+}
+
+otbrError MlrManager::UpdateMembership(const Ip6Address &aGroup, bool aJoin)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ipv6_mreq mreq;
+
+    // Joining the group on the backbone makes the MLD snooping switches forward its traffic to this BBR.
+    mreq.ipv6mr_interface = mBackboneIfIndex;
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
+
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, aJoin ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP, &mreq,
+                            sizeof(mreq)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("MlrManager: Failed to %s %s: %s", aJoin ? "join" : "leave", aGroup.ToString().c_str(),
+                       strerror(errno));
+        mCounters.mJoinFailures += aJoin ? 1 : 0;
+    }
+
+    return error;
+}
+
+void MlrManager::ProcessMulticastRouterMessages(void)
+{
+    for (int i = 0; i < kMaxMessagesPerProcess; i++)
+    {
+        alignas(struct mrt6msg) uint8_t buffer[128];
+        const struct mrt6msg           *msg = reinterpret_cast<const struct mrt6msg *>(buffer);
+        ssize_t                         len = recv(mMulticastRouterSock, buffer, sizeof(buffer), 0);
+
+        if (len < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("MlrManager: Failed to receive from the multicast router socket: %s", strerror(errno));
+            }
+            break;
+        }
+
+        // The kernel messages are told from ICMPv6 messages by their zero first byte.
+        if (static_cast<size_t>(len) < sizeof(*msg) || msg->im6_mbz != 0 || msg->im6_msgtype != MRT6MSG_NOCACHE ||
+            (msg->im6_mif != kMifIndexThread && msg->im6_mif != kMifIndexBackbone))
+        {
+            continue;
+        }
+
+        HandleNoCache(Ip6Address(msg->im6_src.s6_addr), Ip6Address(msg->im6_dst.s6_addr),
+                      static_cast<MifIndex>(msg->im6_mif));
+    }
+}
+
+void MlrManager::HandleNoCache(const Ip6Address &aSource, const Ip6Address &aGroup, MifIndex aInputMif)
+{
+    std::vector<MfcEntry> &entries = mMfcEntries[aGroup];
+    MfcEntry               entry;
+
+    entry.mSource      = aSource;
+    entry.mInputMif    = aInputMif;
+    entry.mForwarding  = ShouldForward(aGroup, aInputMif);
+    entry.mPacketCount = 0;
+
+    // The flows which are not forwarded get an entry too, so that the kernel stops reporting their packets.
+    SuccessOrExit(SetMfcEntry(aGroup, entry));
+
+    for (MfcEntry &existing : entries)
+    {
+        if (existing.mSource == aSource)
+        {
+            existing = entry;
+            ExitNow();
+        }
+    }
+
+    entries.push_back(entry);
+
+exit:
+    if (entries.empty())
+    {
+        mMfcEntries.erase(aGroup);
+    }
+}
+
+bool MlrManager::ShouldForward(const Ip6Address &aGroup, MifIndex aInputMif) const
+{
+    bool forward;
+
+    if (aInputMif == kMifIndexThread)
+    {
+        forward = (aGroup.m8[1] & 0x0f) > kRealmLocalScope;
+    }
+    else
+    {
+        auto it = mListeners.find(aGroup);
+
+        forward = (it != mListeners.end() && it->second.mRegistered);
+    }
+
+    return forward;
+}
+
+otbrError MlrManager::SetMfcEntry(const Ip6Address &aGroup, const MfcEntry &aEntry)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mf6cctl mf6cctl;
+
+    memset(&mf6cctl, 0, sizeof(mf6cctl));
+    mf6cctl.mf6cc_origin.sin6_family   = AF_INET6;
+    mf6cctl.mf6cc_mcastgrp.sin6_family = AF_INET6;
+    aEntry.mSource.CopyTo(mf6cctl.mf6cc_origin.sin6_addr);
+    aGroup.CopyTo(mf6cctl.mf6cc_mcastgrp.sin6_addr);
+    mf6cctl.mf6cc_parent = aEntry.mInputMif;
+
+    if (aEntry.mForwarding)
+    {
+        IF_SET(aEntry.mInputMif == kMifIndexThread ? kMifIndexBackbone : kMifIndexThread, &mf6cctl.mf6cc_ifset);
+    }
+
+    // An existing entry of the same source and group is replaced.
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MFC, &mf6cctl, sizeof(mf6cctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    mCounters.mMfcEntriesAdded++;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("MlrManager: Failed to set MFC entry (%s, %s): %s", aEntry.mSource.ToString().c_str(),
+                       aGroup.ToString().c_str(), strerror(errno));
+        mCounters.mMfcFailures++;
+    }
+
+    return error;
+}
+
+otbrError MlrManager::DelMfcEntry(const Ip6Address &aGroup, const MfcEntry &aEntry)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mf6cctl mf6cctl;
+
+    memset(&mf6cctl, 0, sizeof(mf6cctl));
+    mf6cctl.mf6cc_origin.sin6_family   = AF_INET6;
+    mf6cctl.mf6cc_mcastgrp.sin6_family = AF_INET6;
+    aEntry.mSource.CopyTo(mf6cctl.mf6cc_origin.sin6_addr);
+    aGroup.CopyTo(mf6cctl.mf6cc_mcastgrp.sin6_addr);
+    mf6cctl.mf6cc_parent = aEntry.mInputMif;
+
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_DEL_MFC, &mf6cctl, sizeof(mf6cctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    mCounters.mMfcEntriesRemoved++;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("MlrManager: Failed to delete MFC entry (%s, %s): %s", aEntry.mSource.ToString().c_str(),
+                       aGroup.ToString().c_str(), strerror(errno));
+        mCounters.mMfcFailures++;
+    }
+
+    return error;
+}
+
+bool MlrManager::GetMfcPacketCount(const Ip6Address &aGroup, const MfcEntry &aEntry, unsigned long &aPacketCount) const
+{
+    bool                found = false;
+    struct sioc_sg_req6 req;
+
+    memset(&req, 0, sizeof(req));
+    req.src.sin6_family = AF_INET6;
+    req.grp.sin6_family = AF_INET6;
+    aEntry.mSource.CopyTo(req.src.sin6_addr);
+    aGroup.CopyTo(req.grp.sin6_addr);
+
+    VerifyOrExit(ioctl(mMulticastRouterSock, SIOCGETSGCNT_IN6, &req) == 0);
+    aPacketCount = req.pktcnt;
+    found        = true;
+
+exit:
+    return found;
+}
+
+void MlrManager::ScheduleMfcIdleCheck(void)
+{
+    mMfcIdleCheckTaskId = mTaskRunner.Post(std::chrono::seconds(OTBR_MLR_MFC_IDLE_TIMEOUT), [this]() {
+        mMfcIdleCheckTaskId = 0;
+        RemoveIdleMfcEntries();
+        ScheduleMfcIdleCheck();
+    });
+}
+
+void MlrManager::RemoveIdleMfcEntries(void)
+{
+    size_t removedCount = 0;
+
+    for (auto it = mMfcEntries.begin(); it != mMfcEntries.end();)
+    {
+        std::vector<MfcEntry> &entries = it->second;
+
+        for (size_t i = 0; i < entries.size();)
+        {
+            unsigned long packetCount = 0;
+            bool          counted     = GetMfcPacketCount(it->first, entries[i], packetCount);
+
+            // The packets are counted whether they are forwarded or not, an entry whose count hasn't changed since
+            // the last check is idle.
+            if (counted && packetCount == entries[i].mPacketCount)
+            {
+                DelMfcEntry(it->first, entries[i]);
+                entries[i] = entries.back();
+                entries.pop_back();
+                removedCount++;
+            }
+            else
+            {
+                entries[i].mPacketCount = counted ? packetCount : entries[i].mPacketCount;
+                i++;
+            }
+        }
+
+        it = entries.empty() ? mMfcEntries.erase(it) : std::next(it);
+    }
+
+    otbrLogInfo("MlrManager: Removed %zu idle MFC entries, %zu groups left", removedCount, mMfcEntries.size());
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_MLR_ROUTING
@@ -0,0 +1,245 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definition for the Multicast Listener Registration (MLR) manager.
+ */
+
+#ifndef BACKBONE_ROUTER_MLR_MANAGER_HPP_
+#define BACKBONE_ROUTER_MLR_MANAGER_HPP_
+
+#include "openthread-br/config.h"
+
+/**
+ * The time (in seconds) after which a multicast listener is checked again when its removal is not reported.
+ *
+ * This is the default MLR timeout of Thread 1.2, it's only used when the timeout of the listener can't be read from
+ * OpenThread.
+ */
+#ifndef OTBR_MLR_LISTENER_TIMEOUT
+#define OTBR_MLR_LISTENER_TIMEOUT 3600
+#endif
+
+/**
+ * The interval (in seconds) to remove the multicast forwarding cache entries which didn't forward any packet.
+ */
+#ifndef OTBR_MLR_MFC_IDLE_TIMEOUT
+#define OTBR_MLR_MFC_IDLE_TIMEOUT 300
+#endif
+
+#if OTBR_ENABLE_MLR_ROUTING
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <openthread/backbone_router_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+#include "ncp/rcp_host.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-backbone
+ *
+ * @brief
+ *   This module includes definition for the MLR manager.
+ *
+ * @{
+ */
+
+/**
+ * This class implements the MLR manager.
+ *
+ * The MLR manager forwards the multicast traffic from the backbone to the groups which Thread devices registered,
+ * and the multicast traffic of a scope larger than realm-local from Thread to the backbone. It joins the registered
+ * groups on the backbone and programs the kernel multicast forwarding cache (MFC) with a single socket.
+ *
+ */
+class MlrManager : public MainloopProcessor, private NonCopyable
+{
+public:
+    /**
+     * This structure represents the MLR manager counters.
+     *
+     */
+    struct Counters
+    {
+        uint32_t mListenersAdded;    ///< The number of multicast listeners added.
+        uint32_t mListenersRemoved;  ///< The number of multicast listeners removed, including the expired ones.
+        uint32_t mListenersExpired;  ///< The number of multicast listeners expired without being removed.
+        uint32_t mJoinFailures;      ///< The number of groups failed to be joined on the backbone.
+        uint32_t mMfcEntriesAdded;   ///< The number of MFC entries added or updated.
+        uint32_t mMfcEntriesRemoved; ///< The number of idle MFC entries removed.
+        uint32_t mMfcFailures;       ///< The number of MFC entries failed to be programmed.
+    };
+
+    /**
+     * This constructor initializes a MLR manager instance.
+     *
+     * @param[in] aHost                   A reference to the Thread controller.
+     * @param[in] aInterfaceName          The Thread network interface name.
+     * @param[in] aBackboneInterfaceName  The Backbone network interface name.
+     *
+     */
+    MlrManager(otbr::Ncp::RcpHost &aHost, std::string aInterfaceName, std::string aBackboneInterfaceName);
+
+    /**
+     * This destructor disables the MLR manager.
+     *
+     */
+    ~MlrManager(void) override;
+
+    /**
+     * This method enables the MLR manager.
+     *
+     * The multicast listeners already registered to OpenThread are synchronized.
+     *
+     */
+    void Enable(void);
+
+    /**
+     * This method disables the MLR manager.
+     *
+     */
+    void Disable(void);
+
+    /**
+     * This method sets the Backbone network interface.
+     *
+     * The MLR manager must be disabled.
+     *
+     * @param[in] aBackboneInterfaceName  The Backbone network interface name.
+     *
+     */
+    void SetBackboneInterfaceName(std::string aBackboneInterfaceName);
+
+    /**
+     * This method returns if the MLR manager is enabled.
+     *
+     * @returns If the MLR manager is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return mMulticastRouterSock >= 0; }
+
+    /**
+     * This method handles a Backbone Router Multicast Listener event.
+     *
+     * The changes of the listeners are applied once per mainloop iteration.
+     *
+     * @param[in] aEvent    The Multicast Listener event.
+     * @param[in] aAddress  The multicast address of the listener.
+     *
+     */
+    void HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                    const otIp6Address                    *aAddress);
+
+    /**
+     * This method returns the MLR manager counters.
+     *
+     * @returns A reference to the MLR manager counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "MlrManager"; }
+
+private:
+    enum MifIndex : uint16_t
+    {
+        kMifIndexThread   = 0,
+        kMifIndexBackbone = 1,
+    };
+
+    struct Listener
+    {
+        TaskRunner::TaskId mExpiryTaskId; ///< The delayed task checking the expiry of this listener.
+        bool               mRegistered;   ///< Whether the listener is registered to OpenThread.
+        bool               mJoined;       ///< Whether the group is joined on the backbone.
+    };
+
+    struct MfcEntry
+    {
+        Ip6Address    mSource;      ///< The source address.
+        MifIndex      mInputMif;    ///< The interface on which the packets are received.
+        bool          mForwarding;  ///< Whether the packets are forwarded to the other interface.
+        unsigned long mPacketCount; ///< The number of packets forwarded at the last idle check.
+    };
+
+    typedef std::unordered_map<Ip6Address, Listener, Ip6AddressHash>              ListenerTable;
+    typedef std::unordered_map<Ip6Address, std::vector<MfcEntry>, Ip6AddressHash> MfcTable;
+
+    otbrError InitMulticastRouterSock(void);
+    void      FiniMulticastRouterSock(void);
+    void      SyncListeners(void);
+    void      AddListener(const Ip6Address &aGroup, uint32_t aTimeout);
+    void      RemoveListener(const Ip6Address &aGroup);
+    uint32_t  GetListenerTimeout(const Ip6Address &aGroup) const;
+    void      HandleListenerExpiry(const Ip6Address &aGroup);
+    void      UpdatePendingGroups(void);
+    void      UpdateGroup(const Ip6Address &aGroup);
+    otbrError UpdateMembership(const Ip6Address &aGroup, bool aJoin);
+    void      ProcessMulticastRouterMessages(void);
+    void      HandleNoCache(const Ip6Address &aSource, const Ip6Address &aGroup, MifIndex aInputMif);
+    bool      ShouldForward(const Ip6Address &aGroup, MifIndex aInputMif) const;
+    otbrError SetMfcEntry(const Ip6Address &aGroup, const MfcEntry &aEntry);
+    otbrError DelMfcEntry(const Ip6Address &aGroup, const MfcEntry &aEntry);
+    bool      GetMfcPacketCount(const Ip6Address &aGroup, const MfcEntry &aEntry, unsigned long &aPacketCount) const;
+    void      ScheduleMfcIdleCheck(void);
+    void      RemoveIdleMfcEntries(void);
+
+    otbr::Ncp::RcpHost     &mHost;
+    std::string             mInterfaceName;
+    std::string             mBackboneInterfaceName;
+    unsigned int            mBackboneIfIndex;
+    int                     mMulticastRouterSock;
+    ListenerTable           mListeners;
+    MfcTable                mMfcEntries;
+    std::vector<Ip6Address> mPendingGroups;
+    TaskRunner::TaskId      mMfcIdleCheckTaskId;
+    Counters                mCounters;
+    TaskRunner              mTaskRunner;
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_MLR_ROUTING
+
+#endif // BACKBONE_ROUTER_MLR_MANAGER_HPP_
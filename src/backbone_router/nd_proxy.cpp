@@ -39,15 +39,25 @@
 
 #include <openthread/backbone_router_ftd.h>
 
+#include <vector>
+
 #include <assert.h>
+#include <stddef.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <stdio.h>
+#include <string.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #if __linux__
+#include <linux/filter.h>
 #include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter_ipv6.h>
 #else
 #error "Platform not supported"
 #endif
@@ -56,7 +66,6 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
-#include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -74,12 +83,7 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     SuccessOrExit(error = UpdateMacAddress());
     SuccessOrExit(error = InitNetfilterQueue());
 
-    // Add ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = UpdateUnicastNsRule(/* aIsAdded */ true));
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -99,26 +103,99 @@ void NdProxyManager::Disable(void)
 
     FiniNetfilterQueue();
     FiniIcmp6RawSocket();
+    mActive = false;
 
-    // Remove ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    error = UpdateUnicastNsRule(/* aIsAdded */ false);
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+otbrError NdProxyManager::UpdateUnicastNsRule(bool aIsAdded)
+{
+    static constexpr char kTable[] = "otbr_nd_proxy";
+    static constexpr char kChain[] = "prerouting";
+
+    Nftables::Batch batch;
+    uint8_t         protocol = IPPROTO_ICMPV6;
+    uint8_t         type     = ND_NEIGHBOR_SOLICIT;
+
+    // The table is added before being deleted, so that the deletion succeeds and drops any rule left behind by an
+    // earlier run, the table is then rebuilt in the same transaction.
+    batch.AddTable(NFPROTO_IPV6, kTable);
+    batch.DeleteTable(NFPROTO_IPV6, kTable);
+
+    if (aIsAdded)
+    {
+        batch.AddTable(NFPROTO_IPV6, kTable);
+        batch.AddBaseChain(NFPROTO_IPV6, kTable, kChain, NF_INET_PRE_ROUTING, NF_IP6_PRI_RAW);
+
+        // Same as `ip6tables -t raw -A PREROUTING -d <domain prefix> -p icmpv6 --icmpv6-type neighbor-solicitation
+        // -i <backbone interface> -j NFQUEUE --queue-num <kNsQueueNum> --queue-bypass`.
+        batch.BeginRule(NFPROTO_IPV6, kTable, kChain);
+        batch.AddMetaLoad(NFT_META_L4PROTO);
+        batch.AddCompare(&protocol, sizeof(protocol));
+        batch.AddPayloadLoad(NFT_PAYLOAD_TRANSPORT_HEADER, offsetof(struct icmp6_hdr, icmp6_type), sizeof(type));
+        batch.AddCompare(&type, sizeof(type));
+        batch.AddInterfaceNameMatch(NFT_META_IIFNAME, mBackboneInterfaceName.c_str());
+        batch.AddIp6PrefixMatch(mDomainPrefix, /* aIsDestination */ true);
+        batch.AddQueue(kNsQueueNum, /* aBypass */ true);
+        batch.EndRule();
+    }
+
+    return mNftSocket.Commit(batch);
+}
+
 void NdProxyManager::Init(void)
 {
     mBackboneIfIndex = if_nametoindex(mBackboneInterfaceName.c_str());
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
 }
 
+void NdProxyManager::SetBackboneInterfaceName(std::string aBackboneInterfaceName)
+{
+    assert(!IsEnabled());
+
+    mBackboneInterfaceName = std::move(aBackboneInterfaceName);
+    Init();
+}
+
+void NdProxyManager::SetActive(bool aActive)
+{
+    VerifyOrExit(mActive != aActive);
+    mActive = aActive;
+
+    UpdateNeighborSolicitationFilter();
+
+    if (IsActive())
+    {
+        // Neighbors learn the new Primary BBR for the targets proxied already without waiting for their NS.
+        for (const Ip6Address &target : mNdProxySet)
+        {
+            SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        }
+    }
+
+exit:
+    otbrLogInfo("NdProxyManager: %s", IsActive() ? "Active" : "Inactive");
+}
+
 void NdProxyManager::Update(MainloopContext &aMainloop)
 {
+    // The changes of the proxied targets are applied once per mainloop iteration, so that a burst of DUA
+    // registrations only updates the memberships and the filter of the raw socket once.
+    if (IsEnabled() && mSolicitedNodeGroupsChanged)
+    {
+        mSolicitedNodeGroupsChanged = false;
+        UpdateSolicitedNodeMulticastGroups();
+    }
+
+    if (IsEnabled() && mNsFilterChanged)
+    {
+        mNsFilterChanged = false;
+        UpdateNeighborSolicitationFilter();
+    }
+
     if (mIcmp6RawSock >= 0)
     {
         FD_SET(mIcmp6RawSock, &aMainloop.mReadFdSet);
@@ -159,6 +236,8 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
     struct cmsghdr   *cmsghdr;
     unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
     uint8_t           packet[kMaxICMP6PacketSize];
+    char              srcString[Ip6Address::kStringSize];
+    char              dstString[Ip6Address::kStringSize];
     otbrError         error = OTBR_ERROR_NONE;
     bool              found = false;
 
@@ -177,14 +256,17 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
     VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
 
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        Ip6Address                 &src    = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
+        Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
 
         icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct nd_neighbor_solicit)), error = OTBR_ERROR_PARSE);
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString(srcString, sizeof(srcString)));
 
         for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
         {
@@ -202,17 +284,11 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     Ip6Address         &dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
 
-                    for (const Ip6Address &ipaddr : mNdProxySet)
-                    {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
-
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
-                                 found ? "Y" : "N");
+                    found = mActive && mNdProxySet.Contains(target) &&
+                            target.ToSolicitedNodeMulticastAddress() == dst;
+
+                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s",
+                                 dst.ToString(dstString, sizeof(dstString)), ifindex, found ? "Y" : "N");
                 }
                 break;
 
@@ -231,15 +307,10 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
         VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
 
-        {
-            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
-            Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
-
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+        otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
+                    target.ToString().c_str());
 
-            SendNeighborAdvertisement(target, src);
-        }
+        SendNeighborAdvertisement(target, src);
     }
 
 exit:
@@ -248,19 +319,100 @@ exit:
 
 void NdProxyManager::ProcessUnicastNeighborSolicition(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-    char      packet[kMaxICMP6PacketSize];
-    ssize_t   len;
+    otbrError      error = OTBR_ERROR_NONE;
+    char           packets[kNfqRecvBatchSize][kMaxNfqMessageSize];
+    struct iovec   iovecs[kNfqRecvBatchSize];
+    struct mmsghdr msgs[kNfqRecvBatchSize];
+    int            count;
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    memset(msgs, 0, sizeof(msgs));
 
-    error = OTBR_ERROR_NONE;
+    for (int i = 0; i < kNfqRecvBatchSize; i++)
+    {
+        iovecs[i].iov_base         = packets[i];
+        iovecs[i].iov_len          = sizeof(packets[i]);
+        msgs[i].msg_hdr.msg_iov    = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    count = recvmmsg(mUnicastNsQueueSock, msgs, kNfqRecvBatchSize, MSG_DONTWAIT, nullptr);
+
+    if (count < 0 && errno == ENOBUFS)
+    {
+        // The kernel failed to deliver some NS to the socket, which are already accepted or dropped.
+        mSocketOverruns++;
+        otbrLogWarning("NdProxyManager: Unicast NS are not processed in time (%u overruns)", mSocketOverruns);
+        ExitNow();
+    }
+
+    VerifyOrExit(count >= 0, error = (errno == EAGAIN ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO));
+
+    for (int i = 0; i < count; i++)
+    {
+        if (nfq_handle_packet(mNfqHandler, packets[i], static_cast<int>(msgs[i].msg_len)) != 0)
+        {
+            error = OTBR_ERROR_ERRNO;
+        }
+    }
+
+    FlushPendingAccept();
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+void NdProxyManager::FlushPendingAccept(void)
+{
+    VerifyOrExit(mHasPendingAccept);
+
+    // The verdict applies to all the packets in the queue up to the given id.
+    if (nfq_set_verdict_batch(mNfqQueueHandler, mPendingAcceptId, NF_ACCEPT) < 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to accept unicast NS up to id %u: %s", mPendingAcceptId,
+                       strerror(errno));
+    }
+
+    mHasPendingAccept = false;
+
+exit:
+    return;
+}
+
+otbrError NdProxyManager::GetQueueCounters(QueueCounters &aCounters) const
+{
+    otbrError error = OTBR_ERROR_NOT_FOUND;
+    FILE     *file  = fopen("/proc/net/netfilter/nfnetlink_queue", "r");
+    unsigned  queueNum;
+    unsigned  queueDropped;
+    unsigned  userDropped;
+
+    memset(&aCounters, 0, sizeof(aCounters));
+    aCounters.mSocketOverruns = mSocketOverruns;
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    // Each line is: queue number, port id, queue total, copy mode, copy range, queue dropped, user dropped, id
+    // sequence, 1.
+    while (fscanf(file, "%u %*u %*u %*u %*u %u %u %*u %*d", &queueNum, &queueDropped, &userDropped) == 3)
+    {
+        if (queueNum == kNsQueueNum)
+        {
+            aCounters.mQueueDropped = queueDropped;
+            aCounters.mUserDropped  = userDropped;
+            error                   = OTBR_ERROR_NONE;
+            break;
+        }
+    }
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    return error;
+}
+
 void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
 {
     Ip6Address target;
@@ -276,26 +428,34 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
     case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
     case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
     {
-        bool isNewInsert = mNdProxySet.insert(target).second;
+        bool isNewInsert = mNdProxySet.Insert(target);
 
         if (isNewInsert)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            AddSolicitedNodeMulticastGroup(target);
+            mNsFilterChanged = true;
         }
 
-        SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        if (IsActive())
+        {
+            SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        }
         break;
     }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        if (mNdProxySet.Erase(target))
+        {
+            RemoveSolicitedNodeMulticastGroup(target);
+            mNsFilterChanged = true;
+        }
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
         for (const Ip6Address &proxingTarget : mNdProxySet)
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            RemoveSolicitedNodeMulticastGroup(proxingTarget);
         }
-        mNdProxySet.clear();
+        mNdProxySet.Clear();
+        mNsFilterChanged = true;
         break;
     }
 }
@@ -399,6 +559,12 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+
+    UpdateNeighborSolicitationFilter();
+
+    // The groups of the targets proxied before the socket is opened are joined at the next mainloop iteration.
+    mSolicitedNodeGroupsChanged = !mSolicitedNodeGroups.empty();
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -408,6 +574,69 @@ exit:
     return error;
 }
 
+void NdProxyManager::UpdateNeighborSolicitationFilter(void)
+{
+    // Each proxied target takes 4 loads and 4 comparisons of its words, and the return accepting the packet.
+    static constexpr size_t   kInstructionsPerTarget = 9;
+    static constexpr uint32_t kTargetOffset          = offsetof(struct nd_neighbor_solicit, nd_ns_target);
+
+    otbrError                       error = OTBR_ERROR_NONE;
+    std::vector<struct sock_filter> program;
+    struct sock_fprog               filter;
+    int                             unused = 0;
+    size_t                          targetCount;
+
+    VerifyOrExit(mIcmp6RawSock >= 0);
+
+    // The raw socket receives every multicast NS on the backbone, the kernel drops those whose target is not
+    // proxied instead of waking up the mainloop for each of them. The packets seen by the filter of an ICMPv6 raw
+    // socket start with the ICMPv6 header. An inactive ND Proxy manager drops all of them.
+    targetCount = mActive ? mNdProxySet.GetSize() : 0;
+
+    if (targetCount > OTBR_ND_PROXY_KERNEL_FILTER_MAX_TARGETS)
+    {
+        otbrLogWarning("NdProxyManager: too many targets to filter NS in kernel");
+        ExitNow(error = OTBR_ERROR_ABORTED);
+    }
+
+    program.reserve(targetCount * kInstructionsPerTarget + 1);
+
+    if (mActive)
+    {
+        for (const Ip6Address &target : mNdProxySet)
+        {
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                // A mismatch skips the remaining comparisons of this target and the return.
+                uint8_t skip = static_cast<uint8_t>(kInstructionsPerTarget - 2 * (i + 1));
+
+                program.push_back(
+                    BPF_STMT(BPF_LD | BPF_W | BPF_ABS, static_cast<uint32_t>(kTargetOffset + i * sizeof(uint32_t))));
+                program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ntohl(target.m32[i]), 0, skip));
+            }
+
+            program.push_back(BPF_STMT(BPF_RET | BPF_K, UINT32_MAX));
+        }
+    }
+
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+
+    filter.len    = static_cast<unsigned short>(program.size());
+    filter.filter = program.data();
+
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_ATTACH_FILTER, &filter, sizeof(filter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        // The previous program would drop the NS for the new targets, all the NS are checked in userspace instead.
+        setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_DETACH_FILTER, &unused, sizeof(unused));
+    }
+
+    otbrLogResult(error, "NdProxyManager: %s for %zu targets", __FUNCTION__, targetCount);
+}
+
 void NdProxyManager::FiniIcmp6RawSocket(void)
 {
     if (mIcmp6RawSock != -1)
@@ -415,6 +644,12 @@ void NdProxyManager::FiniIcmp6RawSocket(void)
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
     }
+
+    // Closing the socket drops all its memberships.
+    for (auto &group : mSolicitedNodeGroups)
+    {
+        group.second.mJoined = false;
+    }
 }
 
 otbrError NdProxyManager::InitNetfilterQueue(void)
@@ -425,8 +660,17 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_unbind_pf(mNfqHandler, AF_INET6) >= 0);
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
-    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
-    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
+    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, kNsQueueNum, HandleNetfilterQueue, this)) !=
+                 nullptr);
+    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, kMaxICMP6PacketSize) >= 0);
+    VerifyOrExit(nfq_set_queue_maxlen(mNfqQueueHandler, OTBR_ND_PROXY_NFQUEUE_MAXLEN) >= 0);
+
+    // Accept the NS instead of dropping them when the queue is full, which is not supported by old kernels.
+    if (nfq_set_queue_flags(mNfqQueueHandler, NFQA_CFG_F_FAIL_OPEN, NFQA_CFG_F_FAIL_OPEN) < 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to enable fail-open of the NFQUEUE: %s", strerror(errno));
+    }
+
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
     error = OTBR_ERROR_NONE;
@@ -456,6 +700,8 @@ void NdProxyManager::FiniNetfilterQueue(void)
         mNfqQueueHandler = nullptr;
     }
 
+    mHasPendingAccept = false;
+
     if (mNfqHandler != nullptr)
     {
         nfq_close(mNfqHandler);
@@ -486,6 +732,8 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     Ip6Address        dst;
     Ip6Address        src;
+    char              srcString[Ip6Address::kStringSize];
+    char              dstString[Ip6Address::kStringSize];
     struct icmp6_hdr *icmp6header = nullptr;
     struct ip6_hdr   *ip6header   = nullptr;
     otbrError         error       = OTBR_ERROR_NONE;
@@ -504,27 +752,37 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
 
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s",
+                 src.ToString(srcString, sizeof(srcString)), dst.ToString(dstString, sizeof(dstString)));
 
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
 
-    VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(mActive && mNdProxySet.Contains(dst), error = OTBR_ERROR_NOT_FOUND);
 
     {
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
         Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
 
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
-                     ip6header->ip6_hlim);
+        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__,
+                     target.ToString(dstString, sizeof(dstString)), ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
         SendNeighborAdvertisement(target, src);
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    if (verdict == NF_ACCEPT)
+    {
+        // The accepted packets get a single verdict after all the received packets are handled.
+        mPendingAcceptId  = id;
+        mHasPendingAccept = true;
+    }
+    else
+    {
+        FlushPendingAccept();
+        ret = nfq_set_verdict(aNfQueueHandler, id, verdict, 0, nullptr);
+    }
 
     otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
                   verdict);
@@ -532,36 +790,96 @@ exit:
     return ret;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::AddSolicitedNodeMulticastGroup(const Ip6Address &aTarget)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    // Value-initialization makes a new group start with no reference and not joined.
+    SolicitedNodeGroup &group = mSolicitedNodeGroups[aTarget.ToSolicitedNodeMulticastAddress()];
+
+    if (group.mRefCount++ == 0)
+    {
+        mSolicitedNodeGroupsChanged = true;
+    }
+}
+
+void NdProxyManager::RemoveSolicitedNodeMulticastGroup(const Ip6Address &aTarget)
+{
+    auto it = mSolicitedNodeGroups.find(aTarget.ToSolicitedNodeMulticastAddress());
+
+    VerifyOrExit(it != mSolicitedNodeGroups.end() && it->second.mRefCount > 0);
+
+    if (--it->second.mRefCount == 0)
+    {
+        mSolicitedNodeGroupsChanged = true;
+    }
+
+exit:
+    return;
+}
+
+void NdProxyManager::UpdateSolicitedNodeMulticastGroups(void)
+{
+    uint32_t joinCount  = 0;
+    uint32_t leaveCount = 0;
+
+    for (auto it = mSolicitedNodeGroups.begin(); it != mSolicitedNodeGroups.end();)
+    {
+        SolicitedNodeGroup &group = it->second;
+
+        if (group.mRefCount > 0 && !group.mJoined)
+        {
+            // A failed join is retried at the next change of the groups.
+            group.mJoined = (JoinSolicitedNodeMulticastGroup(it->first) == OTBR_ERROR_NONE);
+            joinCount++;
+        }
+        else if (group.mRefCount == 0 && group.mJoined)
+        {
+            LeaveSolicitedNodeMulticastGroup(it->first);
+            group.mJoined = false;
+            leaveCount++;
+        }
+
+        if (group.mRefCount == 0)
+        {
+            it = mSolicitedNodeGroups.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    otbrLogInfo("NdProxyManager: Joined %u and left %u solicited-node multicast groups, %zu groups in total",
+                joinCount, leaveCount, mSolicitedNodeGroups.size());
+}
+
+otbrError NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const
+{
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup %s", aGroup.ToString().c_str());
+    return error;
 }
 
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+otbrError NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup %s", aGroup.ToString().c_str());
+    return error;
 }
 
 } // namespace BackboneRouter
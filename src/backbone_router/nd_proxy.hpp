@@ -36,6 +36,28 @@
 
 #include "openthread-br/config.h"
 
+/**
+ * The maximum number of ND Proxy targets matched by the kernel filter of multicast NS.
+ *
+ * Each target takes 9 classic BPF instructions, the NS are only filtered in userspace beyond this number.
+ */
+#ifndef OTBR_ND_PROXY_KERNEL_FILTER_MAX_TARGETS
+#define OTBR_ND_PROXY_KERNEL_FILTER_MAX_TARGETS 128
+#endif
+
+/**
+ * The maximum number of unicast NS waiting in the NFQUEUE for a verdict.
+ *
+ * The NS beyond this number are accepted without being proxied, instead of being dropped by the kernel.
+ */
+#ifndef OTBR_ND_PROXY_NFQUEUE_MAXLEN
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_ND_PROXY_NFQUEUE_MAXLEN 128
+#else
+#define OTBR_ND_PROXY_NFQUEUE_MAXLEN 1024
+#endif
+#endif
+
 #if OTBR_ENABLE_DUA_ROUTING
 
 #ifdef __APPLE__
@@ -46,7 +68,6 @@
 #include <libnetfilter_queue/libnetfilter_queue.h>
 #include <map>
 #include <netinet/in.h>
-#include <set>
 #include <string>
 #include <utility>
 
@@ -54,8 +75,10 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/open_hash_set.hpp"
 #include "common/types.hpp"
 #include "ncp/rcp_host.hpp"
+#include "utils/nftables.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -87,6 +110,12 @@ public:
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mPendingAcceptId(0)
+        , mHasPendingAccept(false)
+        , mSocketOverruns(0)
+        , mSolicitedNodeGroupsChanged(false)
+        , mNsFilterChanged(false)
+        , mActive(false)
     {
     }
 
@@ -96,6 +125,16 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method sets the Backbone network interface.
+     *
+     * The ND Proxy manager must be disabled.
+     *
+     * @param[in] aBackboneInterfaceName  The Backbone network interface name.
+     *
+     */
+    void SetBackboneInterfaceName(std::string aBackboneInterfaceName);
+
     /**
      * This method enables the ND Proxy manager.
      *
@@ -110,8 +149,28 @@ public:
      */
     void Disable(void);
 
+    /**
+     * This method activates or deactivates the ND Proxy manager.
+     *
+     * An enabled but inactive ND Proxy manager keeps its sockets and the NFQUEUE installed without answering any NS,
+     * so that it only needs to be activated when the Backbone Router becomes Primary.
+     *
+     * @param[in] aActive  Whether to answer the NS for the proxied targets.
+     *
+     */
+    void SetActive(bool aActive);
+
+    /**
+     * This method returns if the ND Proxy manager is answering the NS for the proxied targets.
+     *
+     * @returns If the ND Proxy manager is enabled and active.
+     *
+     */
+    bool IsActive(void) const { return IsEnabled() && mActive; }
+
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "NdProxyManager"; }
 
     /**
      * This method handles a Backbone Router ND Proxy event.
@@ -131,38 +190,83 @@ public:
      */
     bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
 
+    /**
+     * This structure represents the counters of the unicast NS which are not processed in time.
+     *
+     */
+    struct QueueCounters
+    {
+        uint32_t mQueueDropped;   ///< The number of NS dropped by the kernel because the NFQUEUE was full.
+        uint32_t mUserDropped;    ///< The number of NS dropped by the kernel because the socket buffer was full.
+        uint32_t mSocketOverruns; ///< The number of times the NFQUEUE socket reported lost messages.
+    };
+
+    /**
+     * This method gets the counters of the unicast NS which are not processed in time.
+     *
+     * @param[out] aCounters  A reference to the counters.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully got the counters.
+     * @retval OTBR_ERROR_ERRNO  Failed to read the NFQUEUE statistics of the kernel.
+     *
+     */
+    otbrError GetQueueCounters(QueueCounters &aCounters) const;
+
 private:
     enum
     {
-        kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxICMP6PacketSize = 1500,                      ///< Max size of an ICMP6 packet in bytes.
+        kMaxNfqMessageSize  = kMaxICMP6PacketSize + 512, ///< Max size of an NFQUEUE message in bytes.
+        kNfqRecvBatchSize   = 16,                        ///< Max number of NFQUEUE messages received at once.
+        kNsQueueNum         = 88,                        ///< The NFQUEUE number of the unicast NS.
+    };
+
+    struct SolicitedNodeGroup
+    {
+        uint32_t mRefCount; ///< The number of proxied targets in this group.
+        bool     mJoined;   ///< Whether the raw socket is a member of this group.
     };
 
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
     void       FiniIcmp6RawSocket(void);
+    void       UpdateNeighborSolicitationFilter(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
+    otbrError  UpdateUnicastNsRule(bool aIsAdded);
     void       ProcessMulticastNeighborSolicition(void);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       FlushPendingAccept(void);
+    void       AddSolicitedNodeMulticastGroup(const Ip6Address &aTarget);
+    void       RemoveSolicitedNodeMulticastGroup(const Ip6Address &aTarget);
+    void       UpdateSolicitedNodeMulticastGroups(void);
+    otbrError  JoinSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const;
+    otbrError  LeaveSolicitedNodeMulticastGroup(const Ip6Address &aGroup) const;
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg     *aNfMsg,
                                     struct nfq_data     *aNfData,
                                     void                *aContext);
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
 
-    otbr::Ncp::RcpHost  &mHost;
-    std::string          mBackboneInterfaceName;
-    std::set<Ip6Address> mNdProxySet;
-    uint32_t             mBackboneIfIndex;
-    int                  mIcmp6RawSock;
-    int                  mUnicastNsQueueSock;
-    struct nfq_handle   *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
-    struct nfq_q_handle *mNfqQueueHandler; ///< A pointer to a newly created queue.
-    MacAddress           mMacAddress;
-    Ip6Prefix            mDomainPrefix;
+    otbr::Ncp::RcpHost                      &mHost;
+    std::string                              mBackboneInterfaceName;
+    OpenHashSet<Ip6Address, Ip6AddressHash>  mNdProxySet;
+    uint32_t                                 mBackboneIfIndex;
+    int                                      mIcmp6RawSock;
+    int                                      mUnicastNsQueueSock;
+    struct nfq_handle                       *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
+    struct nfq_q_handle                     *mNfqQueueHandler; ///< A pointer to a newly created queue.
+    uint32_t                                 mPendingAcceptId; ///< The highest packet id to be accepted in batch.
+    bool                                     mHasPendingAccept;
+    uint32_t                                 mSocketOverruns;
+    std::map<Ip6Address, SolicitedNodeGroup> mSolicitedNodeGroups;
+    bool                                     mSolicitedNodeGroupsChanged;
+    bool                                     mNsFilterChanged;
+    bool                                     mActive;
+    MacAddress                               mMacAddress;
+    Ip6Prefix                                mDomainPrefix;
+    Nftables::Socket                         mNftSocket;
 };
 
 /**
@@ -81,6 +81,9 @@ static const char    kBorderAgentEpskcServiceType[] = "_meshcop-e._udp"; ///< Bo
 static constexpr int kBorderAgentServiceDummyPort   = 49152;
 static constexpr int kEpskcRandomGenLen             = 8;
 
+// The number of alternative meshcop service instance names probed in parallel after a name conflict.
+static constexpr size_t kAlternativeServiceInstanceNames = 3;
+
 /**
  * Locators
  *
@@ -165,8 +168,19 @@ BorderAgent::BorderAgent(otbr::Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     , mVendorName(OTBR_VENDOR_NAME)
     , mProductName(OTBR_PRODUCT_NAME)
     , mBaseServiceInstanceName(OTBR_MESHCOP_SERVICE_INSTANCE_NAME)
+    , mPublishedMeshCopPort(0)
+    , mMeshCopServicePublished(false)
+    , mMeshCopNameConflictPending(false)
+    , mEpskcServiceActive(false)
+    , mEpskcServicePublished(false)
+    , mEpskcServiceUpdatePending(false)
+    , mEpskcDiscoverablePending(false)
+    , mPublishedEpskcPort(0)
+    , mEpskcDiscoverableLatencies()
+    , mMeshCopUpdateTaskId(0)
 {
     mHost.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mHost.RegisterResetHandler([this]() { HandleHostReset(); });
     otbrLogInfo("Ephemeral Key is: %s during initialization", (mIsEphemeralKeyEnabled ? "enabled" : "disabled"));
 }
 
@@ -228,6 +242,43 @@ exit:
     return error;
 }
 
+otbrError BorderAgent::UpdateMeshCopServiceNames(const std::string &aServiceInstanceName,
+                                                 const std::string &aProductName,
+                                                 const std::string &aVendorName)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aProductName.size() <= kMaxProductNameLength, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aVendorName.size() <= kMaxVendorNameLength, error = OTBR_ERROR_INVALID_ARGS);
+
+    if (!aProductName.empty())
+    {
+        mProductName = aProductName;
+    }
+    if (!aVendorName.empty())
+    {
+        mVendorName = aVendorName;
+    }
+
+    if (!aServiceInstanceName.empty() && aServiceInstanceName != mBaseServiceInstanceName)
+    {
+        mBaseServiceInstanceName = aServiceInstanceName;
+
+        if (IsEnabled())
+        {
+            // The service is unpublished under the old name, the new name is published by the update below.
+            UnpublishMeshCopService();
+            mServiceInstanceName = GetServiceInstanceNameWithExtAddr(mBaseServiceInstanceName);
+        }
+    }
+
+    // The names are in the TXT data, so the service is only published again if any of them is changed.
+    UpdateMeshCopService();
+
+exit:
+    return error;
+}
+
 void BorderAgent::SetEnabled(bool aIsEnabled)
 {
     VerifyOrExit(IsEnabled() != aIsEnabled);
@@ -288,25 +339,60 @@ void BorderAgent::Start(void)
 void BorderAgent::Stop(void)
 {
     otbrLogInfo("Stop Thread Border Agent");
+    mTaskRunner.Cancel(mMeshCopUpdateTaskId);
+    mMeshCopUpdateTaskId = 0;
     UnpublishMeshCopService();
 }
 
 void BorderAgent::HandleEpskcStateChanged(void *aContext)
 {
-    BorderAgent *borderAgent = static_cast<BorderAgent *>(aContext);
+    static_cast<BorderAgent *>(aContext)->HandleEpskcStateChanged();
+}
+
+void BorderAgent::HandleEpskcStateChanged(void)
+{
+    bool isActive = otBorderAgentIsEphemeralKeyActive(mHost.GetInstance());
 
-    if (otBorderAgentIsEphemeralKeyActive(borderAgent->mHost.GetInstance()))
+    if (isActive && !mEpskcServiceActive)
     {
-        borderAgent->PublishEpskcService();
+        mEpskcActivationTime      = Clock::now();
+        mEpskcDiscoverablePending = true;
     }
-    else
+    mEpskcServiceActive = isActive;
+    ScheduleEpskcServiceUpdate();
+
+    for (auto &ephemeralKeyCallback : mEphemeralKeyChangedCallbacks)
     {
-        borderAgent->UnpublishEpskcService();
+        ephemeralKeyCallback();
     }
+}
+
+void BorderAgent::ScheduleEpskcServiceUpdate(void)
+{
+    VerifyOrExit(!mEpskcServiceUpdatePending);
+    mEpskcServiceUpdatePending = true;
+    mTaskRunner.Post([this]() { UpdateEpskcService(); });
+
+exit:
+    return;
+}
 
-    for (auto &ephemeralKeyCallback : borderAgent->mEphemeralKeyChangedCallbacks)
+void BorderAgent::UpdateEpskcService(void)
+{
+    mEpskcServiceUpdatePending = false;
+
+    if (!mEpskcServiceActive)
     {
-        ephemeralKeyCallback();
+        mEpskcDiscoverablePending = false;
+        if (mEpskcServicePublished)
+        {
+            UnpublishEpskcService();
+        }
+    }
+    else if (!mEpskcServicePublished || otBorderAgentGetUdpPort(mHost.GetInstance()) != mPublishedEpskcPort)
+    {
+        // Publishing the registered service again only updates its records.
+        PublishEpskcService();
     }
 }
 
@@ -318,6 +404,9 @@ void BorderAgent::PublishEpskcService()
     otbrLogInfo("Publish meshcop-e service %s.%s.local. port %d", mServiceInstanceName.c_str(),
                 kBorderAgentEpskcServiceType, port);
 
+    mEpskcServicePublished = true;
+    mPublishedEpskcPort    = static_cast<uint16_t>(port);
+
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentEpskcServiceType,
                               Mdns::Publisher::SubTypeList{}, port, /* aTxtData */ {}, [this](otbrError aError) {
                                   if (aError == OTBR_ERROR_ABORTED)
@@ -334,6 +423,21 @@ void BorderAgent::PublishEpskcService()
                                                     mServiceInstanceName.c_str(), kBorderAgentEpskcServiceType);
                                   }
 
+                                  if (aError == OTBR_ERROR_NONE && mEpskcServiceActive && mEpskcDiscoverablePending)
+                                  {
+                                      uint32_t latency = static_cast<uint32_t>(
+                                          std::chrono::duration_cast<Milliseconds>(Clock::now() - mEpskcActivationTime)
+                                              .count());
+
+                                      mEpskcDiscoverablePending = false;
+                                      mEpskcDiscoverableLatencies.Record(latency);
+                                      otbrLogInfo("Ephemeral key is discoverable after %u ms", latency);
+                                  }
+                                  else if (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_ABORTED)
+                                  {
+                                      mEpskcServicePublished = false;
+                                  }
+
                                   if (aError == OTBR_ERROR_DUPLICATED)
                                   {
                                       // Try to unpublish current service in case we are trying to register
@@ -344,13 +448,16 @@ void BorderAgent::PublishEpskcService()
                                       mServiceInstanceName = GetAlternativeServiceInstanceName();
                                       PublishEpskcService();
                                   }
-                              });
+                              },
+                              Mdns::Publisher::Priority::kHigh);
 }
 
 void BorderAgent::UnpublishEpskcService()
 {
     otbrLogInfo("Unpublish meshcop-e service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentEpskcServiceType);
 
+    mEpskcServicePublished = false;
+
     mPublisher.UnpublishService(mServiceInstanceName, kBorderAgentEpskcServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop-e service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentEpskcServiceType);
@@ -369,7 +476,11 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
+        // The services registered on the previous mDNS daemon are lost.
+        InvalidatePublishedMeshCopService();
         UpdateMeshCopService();
+        mEpskcServicePublished = false;
+        ScheduleEpskcServiceUpdate();
         break;
     default:
         otbrLogWarning("mDNS publisher not available!");
@@ -524,8 +635,6 @@ void BorderAgent::PublishMeshCopService(void)
 
     OTBR_UNUSED_VARIABLE(error);
 
-    otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
-
 #if OTBR_ENABLE_PUBLISH_MESHCOP_BA_ID
     {
         otError         error;
@@ -600,8 +709,20 @@ void BorderAgent::PublishMeshCopService(void)
     error = Mdns::Publisher::EncodeTxtData(txtList, txtData);
     assert(error == OTBR_ERROR_NONE);
 
+    if (mMeshCopServicePublished && port == mPublishedMeshCopPort && txtData == mPublishedMeshCopTxtData)
+    {
+        otbrLogDebug("Meshcop service %s.%s.local is unchanged", mServiceInstanceName.c_str(), kBorderAgentServiceType);
+        ExitNow();
+    }
+
+    otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
+
+    mPublishedMeshCopPort    = port;
+    mPublishedMeshCopTxtData = txtData;
+    mMeshCopServicePublished = true;
+
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
-                              Mdns::Publisher::SubTypeList{}, port, txtData, [this](otbrError aError) {
+                              Mdns::Publisher::SubTypeList{}, port, txtData, [this, port, txtData](otbrError aError) {
                                   if (aError == OTBR_ERROR_ABORTED)
                                   {
                                       // OTBR_ERROR_ABORTED is thrown when an ongoing service registration is
@@ -615,33 +736,104 @@ void BorderAgent::PublishMeshCopService(void)
                                       otbrLogResult(aError, "Result of publish meshcop service %s.%s.local",
                                                     mServiceInstanceName.c_str(), kBorderAgentServiceType);
                                   }
+                                  if (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_ABORTED)
+                                  {
+                                      // Retry the publication on the next update even if nothing has changed.
+                                      InvalidatePublishedMeshCopService();
+                                  }
                                   if (aError == OTBR_ERROR_DUPLICATED)
                                   {
                                       // Try to unpublish current service in case we are trying to register
                                       // multiple new services simultaneously when the original service name
                                       // is conflicted.
                                       UnpublishMeshCopService();
-                                      mServiceInstanceName = GetAlternativeServiceInstanceName();
-                                      PublishMeshCopService();
+                                      PublishMeshCopServiceWithAlternatives(port, txtData);
                                   }
-                              });
+                              },
+                              Mdns::Publisher::Priority::kHigh);
+
+exit:
+    return;
+}
+
+void BorderAgent::PublishMeshCopServiceWithAlternatives(int aPort, const Mdns::Publisher::TxtData &aTxtData)
+{
+    std::vector<std::string> names;
+
+    // The publications failing meanwhile under the conflicted name don't start another round of alternatives.
+    VerifyOrExit(!mMeshCopNameConflictPending);
+
+    for (size_t i = 0; i < kAlternativeServiceInstanceNames; i++)
+    {
+        names.push_back(GetAlternativeServiceInstanceName());
+    }
+
+    otbrLogInfo("Publish meshcop service under %zu alternative names", names.size());
+    mMeshCopNameConflictPending = true;
+
+    mPublisher.PublishServiceWithAlternatives(
+        /* aHostName */ "", names, kBorderAgentServiceType, Mdns::Publisher::SubTypeList{},
+        static_cast<uint16_t>(aPort), aTxtData,
+        [this, aPort, aTxtData](otbrError aError, const std::string &aName) {
+            mMeshCopNameConflictPending = false;
+            otbrLogResult(aError, "Result of publish meshcop service under alternative name %s.%s.local",
+                          aName.c_str(), kBorderAgentServiceType);
+
+            if (aError == OTBR_ERROR_NONE && !IsEnabled())
+            {
+                mPublisher.UnpublishService(aName, kBorderAgentServiceType, [](otbrError) {});
+            }
+            else if (aError == OTBR_ERROR_NONE)
+            {
+                // Published again under the new name, so that the changes of the TXT data meanwhile are published
+                // as well.
+                mServiceInstanceName = aName;
+                InvalidatePublishedMeshCopService();
+                PublishMeshCopService();
+            }
+            else if (aError == OTBR_ERROR_DUPLICATED && IsEnabled())
+            {
+                PublishMeshCopServiceWithAlternatives(aPort, aTxtData);
+            }
+        },
+        Mdns::Publisher::Priority::kHigh);
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
 {
     otbrLogInfo("Unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
+    InvalidatePublishedMeshCopService();
+
     mPublisher.UnpublishService(mServiceInstanceName, kBorderAgentServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentServiceType);
     });
 }
 
+void BorderAgent::InvalidatePublishedMeshCopService(void)
+{
+    mMeshCopServicePublished = false;
+    mPublishedMeshCopTxtData.clear();
+}
+
 void BorderAgent::UpdateMeshCopService(void)
 {
     VerifyOrExit(IsEnabled());
-    VerifyOrExit(mPublisher.IsStarted());
-    PublishMeshCopService();
+
+    // Changes arriving while an update is pending are picked up by it, so a burst of state changes results in a
+    // single publication at most `OTBR_MESHCOP_SERVICE_UPDATE_DELAY` after the first one.
+    VerifyOrExit(mMeshCopUpdateTaskId == 0);
+    mMeshCopUpdateTaskId = mTaskRunner.Post(Milliseconds(OTBR_MESHCOP_SERVICE_UPDATE_DELAY), [this]() {
+        mMeshCopUpdateTaskId = 0;
+        if (IsEnabled() && mPublisher.IsStarted())
+        {
+            PublishMeshCopService();
+        }
+    });
 
 exit:
     return;
@@ -674,6 +866,30 @@ exit:
     return;
 }
 
+void BorderAgent::HandleHostReset(void)
+{
+    std::string serviceInstanceName;
+
+    VerifyOrExit(IsEnabled());
+
+    // The service stays published across the reset of the OpenThread instance. It is only published under another
+    // name if the identity of the Border Agent changed, e.g. the extended address by a factory reset, and otherwise
+    // only if its TXT data changed.
+    serviceInstanceName = GetServiceInstanceNameWithExtAddr(mBaseServiceInstanceName);
+    if (serviceInstanceName != mServiceInstanceName)
+    {
+        otbrLogInfo("The extended address changed by the reset");
+        UnpublishMeshCopService();
+        mServiceInstanceName = serviceInstanceName;
+    }
+    UpdateMeshCopService();
+
+    otBorderAgentSetEphemeralKeyCallback(mHost.GetInstance(), BorderAgent::HandleEpskcStateChanged, this);
+
+exit:
+    return;
+}
+
 bool BorderAgent::IsThreadStarted(void) const
 {
     otDeviceRole role = mHost.GetDeviceRole();
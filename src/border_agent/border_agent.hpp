@@ -43,6 +43,9 @@
 #include "backbone_router/backbone_agent.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 #include "sdp_proxy/advertising_proxy.hpp"
@@ -61,6 +64,14 @@
 #define OTBR_MESHCOP_SERVICE_INSTANCE_NAME (OTBR_VENDOR_NAME " " OTBR_PRODUCT_NAME)
 #endif
 
+/**
+ * The delay (in milliseconds) within which changes of the MeshCoP service are coalesced into a single update.
+ *
+ */
+#ifndef OTBR_MESHCOP_SERVICE_UPDATE_DELAY
+#define OTBR_MESHCOP_SERVICE_UPDATE_DELAY 200
+#endif
+
 namespace otbr {
 
 /**
@@ -117,6 +128,23 @@ public:
                                       const std::vector<uint8_t>     &aVendorOui             = {},
                                       const Mdns::Publisher::TxtList &aNonStandardTxtEntries = {});
 
+    /**
+     * This method updates the MeshCoP service instance name, product name and vendor name while the Border Agent may
+     * be running.
+     *
+     * The MeshCoP service is published again with the new values, under the new instance name if it is changed.
+     *
+     * @param[in] aServiceInstanceName  The service instance name; an empty string keeps the current value.
+     * @param[in] aProductName          The product name; an empty string keeps the current value.
+     * @param[in] aVendorName           The vendor name; an empty string keeps the current value.
+     *
+     * @returns OTBR_ERROR_INVALID_ARGS  If aVendorName or aProductName exceeds the allowed length.
+     * @returns OTBR_ERROR_NONE          If successfully updated the meshcop service values.
+     */
+    otbrError UpdateMeshCopServiceNames(const std::string &aServiceInstanceName,
+                                        const std::string &aProductName,
+                                        const std::string &aVendorName);
+
     /**
      * This method enables/disables the Border Agent.
      *
@@ -166,6 +194,15 @@ public:
      */
     void AddEphemeralKeyChangedCallback(EphemeralKeyChangedCallback aCallback);
 
+    /**
+     * This method returns the latencies from the activation of an ephemeral key to the successful publication of the
+     * meshcop-e service, i.e. until the ephemeral key becomes discoverable.
+     *
+     * @returns The latency histogram in milliseconds.
+     *
+     */
+    const MdnsLatencyHistogram &GetEpskcDiscoverableLatencies(void) const { return mEpskcDiscoverableLatencies; }
+
 private:
     void Start(void);
     void Stop(void);
@@ -173,17 +210,23 @@ private:
     void PublishMeshCopService(void);
     void UpdateMeshCopService(void);
     void UnpublishMeshCopService(void);
+    void InvalidatePublishedMeshCopService(void);
+    void PublishMeshCopServiceWithAlternatives(int aPort, const Mdns::Publisher::TxtData &aTxtData);
 #if OTBR_ENABLE_DBUS_SERVER
     void HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate);
 #endif
 
     void HandleThreadStateChanged(otChangedFlags aFlags);
+    void HandleHostReset(void);
 
     bool        IsThreadStarted(void) const;
     std::string GetServiceInstanceNameWithExtAddr(const std::string &aServiceInstanceName) const;
     std::string GetAlternativeServiceInstanceName() const;
 
     static void HandleEpskcStateChanged(void *aContext);
+    void        HandleEpskcStateChanged(void);
+    void        ScheduleEpskcServiceUpdate(void);
+    void        UpdateEpskcService(void);
     void        PublishEpskcService(void);
     void        UnpublishEpskcService(void);
 
@@ -211,6 +254,28 @@ private:
     std::string mServiceInstanceName;
 
     std::vector<EphemeralKeyChangedCallback> mEphemeralKeyChangedCallbacks;
+
+    // The TXT data and port of the last MeshCoP service publication, an update is skipped if both are unchanged.
+    // `mMeshCopServicePublished` is cleared whenever the publication may be lost, so that the next update is sent.
+    Mdns::Publisher::TxtData mPublishedMeshCopTxtData;
+    int                      mPublishedMeshCopPort;
+    bool                     mMeshCopServicePublished;
+
+    // Whether the meshcop service is being published under alternative names after a name conflict.
+    bool mMeshCopNameConflictPending;
+
+    // The meshcop-e service is only (un)published when the ephemeral key state differs from the published state once
+    // the pending changes are processed, so that rapid ePSKc cycling results in one publication at most.
+    bool                 mEpskcServiceActive;
+    bool                 mEpskcServicePublished;
+    bool                 mEpskcServiceUpdatePending;
+    bool                 mEpskcDiscoverablePending;
+    uint16_t             mPublishedEpskcPort;
+    Timepoint            mEpskcActivationTime;
+    MdnsLatencyHistogram mEpskcDiscoverableLatencies;
+
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mMeshCopUpdateTaskId;
 };
 
 /**
@@ -0,0 +1,851 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "BINLOG"
+
+#include "common/binary_log.hpp"
+
+#include <algorithm>
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+
+namespace otbr {
+
+namespace {
+
+constexpr uint8_t kMaxLogLevel = OTBR_LOG_DEBUG;
+constexpr uint8_t kMaxTagSize  = 7;
+
+const char kLevelStrings[][8] = {
+    "[EMERG]", "[ALERT]", "[CRIT]", "[ERR ]", "[WARN]", "[NOTE]", "[INFO]", "[DEBG]",
+};
+
+// Same as the prefix of the text log: -xxx-----
+void AppendPrefix(std::string &aText, const std::string &aLogTag)
+{
+    size_t tagLength = std::min<size_t>(aLogTag.size(), kMaxTagSize);
+
+    if (tagLength > 0)
+    {
+        aText += '-';
+        aText.append(aLogTag, 0, tagLength);
+        aText.append(kMaxTagSize - tagLength + 1, '-');
+    }
+}
+
+template <typename... Args> void AppendPrintf(std::string &aText, const char *aSpec, Args... aArgs)
+{
+    int    length = snprintf(nullptr, 0, aSpec, aArgs...);
+    size_t offset = aText.size();
+
+    VerifyOrExit(length > 0);
+
+    aText.resize(offset + length + 1);
+    snprintf(&aText[offset], length + 1, aSpec, aArgs...);
+    aText.resize(offset + length);
+
+exit:
+    return;
+}
+
+template <typename T>
+void AppendConversion(std::string &aText, const char *aSpec, const int *aStars, uint8_t aNumStars, T aValue)
+{
+    switch (aNumStars)
+    {
+    case 0:
+        AppendPrintf(aText, aSpec, aValue);
+        break;
+    case 1:
+        AppendPrintf(aText, aSpec, aStars[0], aValue);
+        break;
+    default:
+        AppendPrintf(aText, aSpec, aStars[0], aStars[1], aValue);
+        break;
+    }
+}
+
+bool ReadPayloadUint(const uint8_t *&aCursor, const uint8_t *aEnd, uint64_t &aValue, uint8_t aSize)
+{
+    bool successful = false;
+
+    VerifyOrExit(static_cast<size_t>(aEnd - aCursor) >= aSize);
+
+    aValue = 0;
+    for (uint8_t i = 0; i < aSize; i++)
+    {
+        aValue |= static_cast<uint64_t>(*aCursor++) << (8 * i);
+    }
+    successful = true;
+
+exit:
+    return successful;
+}
+
+uint64_t GetRealTimeMicroseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+} // namespace
+
+constexpr char   BinaryLog::kMagic[];
+constexpr int    BinaryLog::kPrecisionNone;
+constexpr int    BinaryLog::kPrecisionStar;
+constexpr size_t BinaryLog::kMaxStringLength;
+constexpr size_t BinaryLog::kMaxPayloadLength;
+
+otbrError BinaryLog::ParseFormat(const char *aFormat, std::vector<Conversion> &aConversions)
+{
+    otbrError   error  = OTBR_ERROR_NONE;
+    const char *cursor = aFormat;
+
+    aConversions.clear();
+    VerifyOrExit(strlen(aFormat) <= UINT16_MAX, error = OTBR_ERROR_PARSE);
+
+    while ((cursor = strchr(cursor, '%')) != nullptr)
+    {
+        const char *start = cursor++;
+        Conversion  conversion;
+        char        length[3] = {};
+
+        conversion.mNumStars  = 0;
+        conversion.mPrecision = kPrecisionNone;
+
+        while (*cursor != '\0' && strchr("-+ #0", *cursor) != nullptr)
+        {
+            cursor++;
+        }
+
+        if (*cursor == '*')
+        {
+            conversion.mNumStars++;
+            cursor++;
+        }
+        while (isdigit(static_cast<unsigned char>(*cursor)))
+        {
+            cursor++;
+        }
+
+        if (*cursor == '.')
+        {
+            cursor++;
+            if (*cursor == '*')
+            {
+                conversion.mNumStars++;
+                conversion.mPrecision = kPrecisionStar;
+                cursor++;
+            }
+            else
+            {
+                conversion.mPrecision = 0;
+                while (isdigit(static_cast<unsigned char>(*cursor)))
+                {
+                    conversion.mPrecision = conversion.mPrecision * 10 + (*cursor++ - '0');
+                    VerifyOrExit(conversion.mPrecision <= UINT16_MAX, error = OTBR_ERROR_PARSE);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < sizeof(length) - 1 && *cursor != '\0' && strchr("hljztL", *cursor) != nullptr; i++)
+        {
+            length[i] = *cursor++;
+        }
+
+        switch (*cursor)
+        {
+        case '%':
+            conversion.mArg = Arg::kNone;
+            break;
+
+        case 'n':
+            conversion.mArg = Arg::kCount;
+            break;
+
+        case 'c':
+            VerifyOrExit(length[0] == '\0', error = OTBR_ERROR_PARSE);
+            conversion.mArg = Arg::kInt;
+            break;
+
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        {
+            bool isSigned = (*cursor == 'd' || *cursor == 'i');
+
+            if (length[0] == '\0' || !strcmp(length, "h") || !strcmp(length, "hh"))
+            {
+                conversion.mArg = isSigned ? Arg::kInt : Arg::kUnsignedInt;
+            }
+            else if (!strcmp(length, "l"))
+            {
+                conversion.mArg = isSigned ? Arg::kLong : Arg::kUnsignedLong;
+            }
+            else if (!strcmp(length, "ll"))
+            {
+                conversion.mArg = isSigned ? Arg::kLongLong : Arg::kUnsignedLongLong;
+            }
+            else if (!strcmp(length, "j"))
+            {
+                conversion.mArg = isSigned ? Arg::kIntMax : Arg::kUnsignedIntMax;
+            }
+            else if (!strcmp(length, "z"))
+            {
+                conversion.mArg = Arg::kSize;
+            }
+            else if (!strcmp(length, "t"))
+            {
+                conversion.mArg = Arg::kPtrDiff;
+            }
+            else
+            {
+                ExitNow(error = OTBR_ERROR_PARSE);
+            }
+            break;
+        }
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (length[0] == '\0' || !strcmp(length, "l"))
+            {
+                conversion.mArg = Arg::kDouble;
+            }
+            else if (!strcmp(length, "L"))
+            {
+                conversion.mArg = Arg::kLongDouble;
+            }
+            else
+            {
+                ExitNow(error = OTBR_ERROR_PARSE);
+            }
+            break;
+
+        case 's':
+            VerifyOrExit(length[0] == '\0', error = OTBR_ERROR_PARSE);
+            conversion.mArg = Arg::kString;
+            break;
+
+        case 'p':
+            VerifyOrExit(length[0] == '\0', error = OTBR_ERROR_PARSE);
+            conversion.mArg = Arg::kPointer;
+            break;
+
+        default:
+            ExitNow(error = OTBR_ERROR_PARSE);
+        }
+
+        cursor++;
+        conversion.mOffset = static_cast<uint16_t>(start - aFormat);
+        conversion.mLength = static_cast<uint16_t>(cursor - start);
+        aConversions.push_back(conversion);
+    }
+
+exit:
+    return error;
+}
+
+BinaryLogWriter::~BinaryLogWriter(void)
+{
+    Close();
+}
+
+otbrError BinaryLogWriter::Open(const char *aPath)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    otbrError                   error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mFile == nullptr, error = OTBR_ERROR_INVALID_STATE);
+
+    mFile = fopen(aPath, "wb");
+    VerifyOrExit(mFile != nullptr, error = OTBR_ERROR_ERRNO);
+
+    // Messages are written in large chunks, only the important ones are flushed right away.
+    setvbuf(mFile, nullptr, _IOFBF, kBufferSize);
+    fwrite(kMagic, sizeof(kMagic), 1, mFile);
+    fputc(kVersion, mFile);
+    mFormats.clear();
+
+exit:
+    return error;
+}
+
+void BinaryLogWriter::Close(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    mFormats.clear();
+}
+
+bool BinaryLogWriter::Log(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgList)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    bool                        handled = false;
+    const Format               *format;
+
+    VerifyOrExit(mFile != nullptr);
+
+    // The message is left to the text logger if its format can't be added.
+    format = FindOrAddFormat(aLogTag, aFormat, aLogTag == nullptr ? kFlagNoPrefix : 0);
+    VerifyOrExit(format != nullptr, mDroppedMessageCount++);
+
+    BeginMessage(aLevel, *format);
+    handled = true;
+
+    if (format->mPreformatted)
+    {
+        char buffer[kMaxStringLength + 1];
+
+        vsnprintf(buffer, sizeof(buffer), aFormat, aArgList);
+        AppendString(buffer, kMaxStringLength);
+        ExitNow(EndMessage(aLevel));
+    }
+
+    for (const Conversion &conversion : format->mConversions)
+    {
+        int precision = conversion.mPrecision;
+
+        // The precision star, if any, is the last one.
+        for (uint8_t i = 0; i < conversion.mNumStars; i++)
+        {
+            precision = va_arg(aArgList, int);
+            AppendUint(static_cast<uint32_t>(precision), sizeof(uint32_t));
+        }
+
+        switch (conversion.mArg)
+        {
+        case Arg::kNone:
+            break;
+        case Arg::kCount:
+            va_arg(aArgList, void *);
+            break;
+        case Arg::kInt:
+            AppendUint(static_cast<uint64_t>(va_arg(aArgList, int)), sizeof(uint64_t));
+            break;
+        case Arg::kUnsignedInt:
+            AppendUint(va_arg(aArgList, unsigned int), sizeof(uint64_t));
+            break;
+        case Arg::kLong:
+            AppendUint(static_cast<uint64_t>(va_arg(aArgList, long)), sizeof(uint64_t));
+            break;
+        case Arg::kUnsignedLong:
+            AppendUint(va_arg(aArgList, unsigned long), sizeof(uint64_t));
+            break;
+        case Arg::kLongLong:
+            AppendUint(static_cast<uint64_t>(va_arg(aArgList, long long)), sizeof(uint64_t));
+            break;
+        case Arg::kUnsignedLongLong:
+            AppendUint(va_arg(aArgList, unsigned long long), sizeof(uint64_t));
+            break;
+        case Arg::kIntMax:
+            AppendUint(static_cast<uint64_t>(va_arg(aArgList, intmax_t)), sizeof(uint64_t));
+            break;
+        case Arg::kUnsignedIntMax:
+            AppendUint(va_arg(aArgList, uintmax_t), sizeof(uint64_t));
+            break;
+        case Arg::kSize:
+            AppendUint(va_arg(aArgList, size_t), sizeof(uint64_t));
+            break;
+        case Arg::kPtrDiff:
+            AppendUint(static_cast<uint64_t>(va_arg(aArgList, ptrdiff_t)), sizeof(uint64_t));
+            break;
+        case Arg::kDouble:
+        case Arg::kLongDouble:
+        {
+            double   value = (conversion.mArg == Arg::kDouble) ? va_arg(aArgList, double)
+                                                               : static_cast<double>(va_arg(aArgList, long double));
+            uint64_t bits;
+
+            memcpy(&bits, &value, sizeof(bits));
+            AppendUint(bits, sizeof(bits));
+            break;
+        }
+        case Arg::kString:
+        {
+            const char *string = va_arg(aArgList, const char *);
+
+            if (conversion.mPrecision == kPrecisionNone || precision < 0)
+            {
+                precision = kMaxStringLength;
+            }
+            AppendString(string != nullptr ? string : "(null)", std::min<size_t>(precision, kMaxStringLength));
+            break;
+        }
+        case Arg::kPointer:
+            AppendUint(reinterpret_cast<uintptr_t>(va_arg(aArgList, void *)), sizeof(uint64_t));
+            break;
+        }
+    }
+
+    EndMessage(aLevel);
+
+exit:
+    return handled;
+}
+
+bool BinaryLogWriter::Dump(otbrLogLevel aLevel,
+                           const char  *aLogTag,
+                           const char  *aPrefix,
+                           const void  *aMemory,
+                           size_t       aSize)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    bool                        handled = false;
+    const Format               *format;
+
+    VerifyOrExit(mFile != nullptr);
+
+    format = FindOrAddFormat(aLogTag, aPrefix, kFlagDump);
+    VerifyOrExit(format != nullptr, mDroppedMessageCount++);
+
+    BeginMessage(aLevel, *format);
+    handled = true;
+    AppendBytes(aMemory, std::min(aSize, kMaxPayloadLength));
+    EndMessage(aLevel);
+
+exit:
+    return handled;
+}
+
+uint32_t BinaryLogWriter::GetDroppedMessageCount(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mDroppedMessageCount;
+}
+
+const BinaryLogWriter::Format *BinaryLogWriter::FindOrAddFormat(const char *aLogTag,
+                                                                const char *aFormat,
+                                                                uint8_t     aFlags)
+{
+    FormatKey     key    = {aLogTag, aFormat, aFlags};
+    const Format *format = nullptr;
+    auto          iter   = mFormats.find(key);
+
+    if (iter == mFormats.end())
+    {
+        Format      newFormat;
+        const char *text;
+        size_t      tagLength;
+        size_t      textLength;
+
+        VerifyOrExit(mFormats.size() < kMaxFormats);
+
+        newFormat.mId = static_cast<uint16_t>(mFormats.size());
+        newFormat.mPreformatted =
+            !(aFlags & kFlagDump) && ParseFormat(aFormat, newFormat.mConversions) != OTBR_ERROR_NONE;
+
+        text       = newFormat.mPreformatted ? "%s" : aFormat;
+        tagLength  = (aLogTag != nullptr) ? strnlen(aLogTag, UINT8_MAX) : 0;
+        textLength = strnlen(text, kMaxPayloadLength - UINT8_MAX); // Leaves room for the tag and the header.
+
+        mRecordLength = 0;
+        AppendUint(kRecordFormat, sizeof(uint8_t));
+        AppendUint(aFlags, sizeof(uint8_t));
+        AppendUint(newFormat.mId, sizeof(uint16_t));
+        AppendUint(tagLength, sizeof(uint8_t));
+        AppendBytes(aLogTag, tagLength);
+        AppendUint(textLength, sizeof(uint16_t));
+        AppendBytes(text, textLength);
+        fwrite(mRecord, mRecordLength, 1, mFile);
+
+        iter = mFormats.emplace(key, std::move(newFormat)).first;
+    }
+
+    format = &iter->second;
+
+exit:
+    return format;
+}
+
+void BinaryLogWriter::BeginMessage(otbrLogLevel aLevel, const Format &aFormat)
+{
+    mRecordLength = 0;
+    AppendUint(kRecordMessage, sizeof(uint8_t));
+    AppendUint(static_cast<uint8_t>(aLevel), sizeof(uint8_t));
+    AppendUint(aFormat.mId, sizeof(uint16_t));
+    AppendUint(GetRealTimeMicroseconds(), sizeof(uint64_t));
+    // The payload length is filled by `EndMessage()`.
+    AppendUint(0, sizeof(uint16_t));
+}
+
+void BinaryLogWriter::AppendString(const char *aString, size_t aMaxLength)
+{
+    size_t length = strnlen(aString, aMaxLength);
+
+    AppendUint(length, sizeof(uint16_t));
+    AppendBytes(aString, length);
+}
+
+void BinaryLogWriter::AppendUint(uint64_t aValue, uint8_t aSize)
+{
+    uint8_t bytes[sizeof(uint64_t)];
+
+    for (uint8_t i = 0; i < aSize; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(aValue >> (8 * i));
+    }
+    AppendBytes(bytes, aSize);
+}
+
+void BinaryLogWriter::AppendBytes(const void *aBytes, size_t aLength)
+{
+    // A record which doesn't fit is invalidated and dropped by `EndMessage()`.
+    if (mRecordLength > kMaxRecordLength - aLength)
+    {
+        mRecordLength = kInvalidLength;
+    }
+    VerifyOrExit(mRecordLength != kInvalidLength);
+
+    memcpy(&mRecord[mRecordLength], aBytes, aLength);
+    mRecordLength += aLength;
+
+exit:
+    return;
+}
+
+void BinaryLogWriter::EndMessage(otbrLogLevel aLevel)
+{
+    size_t payloadLength;
+
+    // Messages with too many long strings are dropped.
+    VerifyOrExit(mRecordLength != kInvalidLength, mDroppedMessageCount++);
+
+    payloadLength                     = mRecordLength - kMessageHeaderLength;
+    mRecord[kMessageHeaderLength - 2] = static_cast<uint8_t>(payloadLength);
+    mRecord[kMessageHeaderLength - 1] = static_cast<uint8_t>(payloadLength >> 8);
+    fwrite(mRecord, mRecordLength, 1, mFile);
+
+    if (aLevel <= OTBR_LOG_WARNING)
+    {
+        fflush(mFile);
+    }
+
+exit:
+    return;
+}
+
+BinaryLogReader::~BinaryLogReader(void)
+{
+    Close();
+}
+
+otbrError BinaryLogReader::Open(const char *aPath)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      magic[sizeof(kMagic)];
+    uint8_t   version;
+
+    Close();
+
+    mFile = fopen(aPath, "rb");
+    VerifyOrExit(mFile != nullptr, error = OTBR_ERROR_ERRNO);
+
+    VerifyOrExit(Read(magic, sizeof(magic)) && memcmp(magic, kMagic, sizeof(magic)) == 0, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(Read(&version, sizeof(version)) && version == kVersion, error = OTBR_ERROR_PARSE);
+
+exit:
+    if (error == OTBR_ERROR_PARSE)
+    {
+        Close();
+    }
+    return error;
+}
+
+void BinaryLogReader::Close(void)
+{
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    mFormats.clear();
+}
+
+otbrError BinaryLogReader::ReadNext(std::string &aText)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   type;
+
+    VerifyOrExit(mFile != nullptr, error = OTBR_ERROR_INVALID_STATE);
+
+    while (true)
+    {
+        VerifyOrExit(Read(&type, sizeof(type)), error = OTBR_ERROR_NOT_FOUND);
+
+        if (type == kRecordFormat)
+        {
+            SuccessOrExit(error = ReadFormat());
+        }
+        else
+        {
+            VerifyOrExit(type == kRecordMessage, error = OTBR_ERROR_PARSE);
+            ExitNow(error = ReadMessage(aText));
+        }
+    }
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadFormat(void)
+{
+    otbrError error = OTBR_ERROR_PARSE;
+    Format    format;
+    uint64_t  id;
+    uint64_t  length;
+
+    VerifyOrExit(Read(&format.mFlags, sizeof(format.mFlags)));
+    VerifyOrExit(ReadUint(id, sizeof(uint16_t)) && id == mFormats.size());
+
+    VerifyOrExit(ReadUint(length, sizeof(uint8_t)));
+    format.mLogTag.resize(length);
+    VerifyOrExit(Read(&format.mLogTag[0], length));
+
+    VerifyOrExit(ReadUint(length, sizeof(uint16_t)));
+    format.mFormat.resize(length);
+    VerifyOrExit(Read(&format.mFormat[0], length));
+
+    if (!(format.mFlags & kFlagDump))
+    {
+        SuccessOrExit(ParseFormat(format.mFormat.c_str(), format.mConversions));
+    }
+
+    mFormats.push_back(std::move(format));
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadMessage(std::string &aText)
+{
+    otbrError            error = OTBR_ERROR_PARSE;
+    uint64_t             level;
+    uint64_t             id;
+    uint64_t             time;
+    uint64_t             length;
+    std::vector<uint8_t> payload;
+    std::string          prefix;
+
+    VerifyOrExit(ReadUint(level, sizeof(uint8_t)) && level <= kMaxLogLevel);
+    VerifyOrExit(ReadUint(id, sizeof(uint16_t)) && id < mFormats.size());
+    VerifyOrExit(ReadUint(time, sizeof(uint64_t)));
+    VerifyOrExit(ReadUint(length, sizeof(uint16_t)));
+    payload.resize(length);
+    VerifyOrExit(Read(payload.data(), length));
+
+    {
+        const Format &format = mFormats[id];
+
+        AppendPrintf(prefix, "%" PRIu64 ".%06" PRIu64 " ", time / 1000000, time % 1000000);
+        if (!(format.mFlags & kFlagNoPrefix))
+        {
+            prefix += kLevelStrings[level];
+            AppendPrefix(prefix, format.mLogTag);
+            prefix += ": ";
+        }
+
+        aText.clear();
+
+        if (format.mFlags & kFlagDump)
+        {
+            static const char kHexChars[] = "0123456789abcdef";
+
+            // Same as the lines of `otbrDump()`.
+            for (size_t offset = 0; offset < payload.size(); offset += 16)
+            {
+                if (offset > 0)
+                {
+                    aText += '\n';
+                }
+
+                aText += prefix;
+                AppendPrintf(aText, "%s: %04x:", format.mFormat.c_str(), static_cast<unsigned int>(offset));
+                for (size_t i = offset; i < std::min(offset + 16, payload.size()); i++)
+                {
+                    aText += ' ';
+                    aText += kHexChars[payload[i] >> 4];
+                    aText += kHexChars[payload[i] & 0x0f];
+                }
+            }
+            error = OTBR_ERROR_NONE;
+        }
+        else
+        {
+            aText = prefix;
+            error = FormatMessage(format, payload.data(), payload.size(), aText);
+        }
+    }
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::FormatMessage(const Format  &aFormat,
+                                         const uint8_t *aPayload,
+                                         size_t         aLength,
+                                         std::string   &aText)
+{
+    otbrError      error  = OTBR_ERROR_PARSE;
+    const uint8_t *cursor = aPayload;
+    const uint8_t *end    = aPayload + aLength;
+    size_t         offset = 0;
+
+    for (const Conversion &conversion : aFormat.mConversions)
+    {
+        std::string spec = aFormat.mFormat.substr(conversion.mOffset, conversion.mLength);
+        int         stars[2];
+        uint64_t    value = 0;
+
+        aText.append(aFormat.mFormat, offset, conversion.mOffset - offset);
+        offset = conversion.mOffset + conversion.mLength;
+
+        for (uint8_t i = 0; i < conversion.mNumStars; i++)
+        {
+            VerifyOrExit(ReadPayloadUint(cursor, end, value, sizeof(uint32_t)));
+            stars[i] = static_cast<int>(static_cast<uint32_t>(value));
+        }
+
+        if (conversion.mArg != Arg::kNone && conversion.mArg != Arg::kCount)
+        {
+            VerifyOrExit(ReadPayloadUint(cursor, end, value, conversion.mArg == Arg::kString ? sizeof(uint16_t)
+                                                                                            : sizeof(uint64_t)));
+        }
+
+        switch (conversion.mArg)
+        {
+        case Arg::kNone:
+            aText += '%';
+            break;
+        case Arg::kCount:
+            break;
+        case Arg::kInt:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<int>(value));
+            break;
+        case Arg::kUnsignedInt:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<unsigned int>(value));
+            break;
+        case Arg::kLong:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<long>(value));
+            break;
+        case Arg::kUnsignedLong:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<unsigned long>(value));
+            break;
+        case Arg::kLongLong:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<long long>(value));
+            break;
+        case Arg::kUnsignedLongLong:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<unsigned long long>(value));
+            break;
+        case Arg::kIntMax:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<intmax_t>(value));
+            break;
+        case Arg::kUnsignedIntMax:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<uintmax_t>(value));
+            break;
+        case Arg::kSize:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<size_t>(value));
+            break;
+        case Arg::kPtrDiff:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<ptrdiff_t>(value));
+            break;
+        case Arg::kDouble:
+        case Arg::kLongDouble:
+        {
+            double number;
+
+            memcpy(&number, &value, sizeof(number));
+            if (conversion.mArg == Arg::kDouble)
+            {
+                AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, number);
+            }
+            else
+            {
+                AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, static_cast<long double>(number));
+            }
+            break;
+        }
+        case Arg::kString:
+        {
+            std::string string;
+
+            VerifyOrExit(static_cast<size_t>(end - cursor) >= value);
+            string.assign(reinterpret_cast<const char *>(cursor), value);
+            cursor += value;
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars, string.c_str());
+            break;
+        }
+        case Arg::kPointer:
+            AppendConversion(aText, spec.c_str(), stars, conversion.mNumStars,
+                             reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+            break;
+        }
+    }
+
+    aText.append(aFormat.mFormat, offset, std::string::npos);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+bool BinaryLogReader::Read(void *aBuffer, size_t aLength)
+{
+    return aLength == 0 || fread(aBuffer, aLength, 1, mFile) == 1;
+}
+
+bool BinaryLogReader::ReadUint(uint64_t &aValue, uint8_t aSize)
+{
+    uint8_t        buffer[sizeof(uint64_t)];
+    const uint8_t *cursor = buffer;
+
+    return Read(buffer, aSize) && ReadPayloadUint(cursor, buffer + aSize, aValue, aSize);
+}
+
+} // namespace otbr
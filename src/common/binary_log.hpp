@@ -0,0 +1,332 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the binary log writer and reader.
+ *
+ * A binary log records the raw arguments of a log message instead of the formatted text. The format string and the
+ * log tag are written once, the first time they are used, and referred by an ID afterwards. Formatting is deferred
+ * to the reader.
+ */
+
+#ifndef OTBR_COMMON_BINARY_LOG_HPP_
+#define OTBR_COMMON_BINARY_LOG_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the binary log format shared by the writer and the reader.
+ *
+ */
+class BinaryLog
+{
+public:
+    /**
+     * This enumeration represents the argument type of a printf-style conversion.
+     *
+     */
+    enum class Arg : uint8_t
+    {
+        kNone,              ///< `%%`, consumes no argument.
+        kCount,             ///< `%n`, consumes a pointer which isn't recorded.
+        kInt,               ///< `int`, including `char` and `short` which are promoted.
+        kUnsignedInt,       ///< `unsigned int`.
+        kLong,              ///< `long`.
+        kUnsignedLong,      ///< `unsigned long`.
+        kLongLong,          ///< `long long`.
+        kUnsignedLongLong,  ///< `unsigned long long`.
+        kIntMax,            ///< `intmax_t`.
+        kUnsignedIntMax,    ///< `uintmax_t`.
+        kSize,              ///< `size_t`.
+        kPtrDiff,           ///< `ptrdiff_t`.
+        kDouble,            ///< `double`, including `float` which is promoted.
+        kLongDouble,        ///< `long double`, recorded as `double`.
+        kString,            ///< `const char *`, the characters are recorded.
+        kPointer,           ///< `void *`.
+    };
+
+    static constexpr int kPrecisionNone = -1; ///< The conversion has no precision.
+    static constexpr int kPrecisionStar = -2; ///< The precision is given by an argument.
+
+    /**
+     * This structure represents a conversion of a format string.
+     *
+     */
+    struct Conversion
+    {
+        uint16_t mOffset;    ///< The offset of the `%` in the format string.
+        uint16_t mLength;    ///< The length of the conversion specification.
+        uint8_t  mNumStars;  ///< The number of `*` width or precision, each consumes an `int` argument.
+        int      mPrecision; ///< The precision, or `kPrecisionNone` or `kPrecisionStar`.
+        Arg      mArg;       ///< The argument type.
+    };
+
+    /**
+     * This function parses the conversions of a printf-style format string.
+     *
+     * @param[in]  aFormat       The format string.
+     * @param[out] aConversions  The parsed conversions.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully parsed the format string.
+     * @retval OTBR_ERROR_PARSE  The format string contains an unsupported conversion.
+     *
+     */
+    static otbrError ParseFormat(const char *aFormat, std::vector<Conversion> &aConversions);
+
+protected:
+    static constexpr char    kMagic[]          = {'O', 'T', 'B', 'R', 'B', 'L', 'O', 'G'};
+    static constexpr uint8_t kVersion          = 1;
+    static constexpr uint8_t kFlagNoPrefix     = 1 << 0; ///< The message is printed without level and tag.
+    static constexpr uint8_t kFlagDump         = 1 << 1; ///< The format is the prefix of a hex dump.
+    static constexpr size_t  kMaxStringLength  = 1024;
+    static constexpr size_t  kMaxPayloadLength = 0xffff;
+
+    enum RecordType : uint8_t
+    {
+        kRecordFormat  = 1, ///< Flags (1), ID (2), tag length (1), tag, format length (2), format.
+        kRecordMessage = 2, ///< Level (1), ID (2), time in microseconds (8), payload length (2), payload.
+    };
+};
+
+/**
+ * This class implements a binary log writer.
+ *
+ * It's safe to write log messages from different threads concurrently.
+ *
+ */
+class BinaryLogWriter : public BinaryLog, private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes a closed binary log writer.
+     *
+     */
+    BinaryLogWriter(void) = default;
+
+    /**
+     * This destructor closes the binary log file.
+     *
+     */
+    ~BinaryLogWriter(void);
+
+    /**
+     * This method opens the binary log file, an existing file is truncated.
+     *
+     * @param[in] aPath  The path of the binary log file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the binary log file.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the binary log file.
+     *
+     */
+    otbrError Open(const char *aPath);
+
+    /**
+     * This method flushes and closes the binary log file.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method writes a log message.
+     *
+     * The format string and the log tag are identified by their addresses, so they must be string literals.
+     *
+     * @param[in] aLevel    The log level.
+     * @param[in] aLogTag   The log tag, or nullptr to print the message without level and tag.
+     * @param[in] aFormat   The format string.
+     * @param[in] aArgList  The arguments, they are only consumed if this method returns true.
+     *
+     * @retval TRUE   The log message is handled by this writer.
+     * @retval FALSE  The binary log file isn't open, or its table of formats is full.
+     *
+     */
+    bool Log(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgList);
+
+    /**
+     * This method writes a hex dump.
+     *
+     * @param[in] aLevel   The log level.
+     * @param[in] aLogTag  The log tag, must be a string literal.
+     * @param[in] aPrefix  The prefix of each line, must be a string literal.
+     * @param[in] aMemory  A pointer to the memory to dump.
+     * @param[in] aSize    The number of bytes to dump.
+     *
+     * @retval TRUE   The hex dump is handled by this writer.
+     * @retval FALSE  The binary log file isn't open, or its table of formats is full.
+     *
+     */
+    bool Dump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, const void *aMemory, size_t aSize);
+
+    /**
+     * This method returns the number of messages which are not written to the binary log file.
+     *
+     * These are the messages left to the text logger as the table of formats is full, and those which
+     * don't fit in a record.
+     *
+     */
+    uint32_t GetDroppedMessageCount(void);
+
+private:
+    static constexpr size_t kMaxFormats          = 4096;
+    static constexpr size_t kBufferSize          = 64 * 1024;
+    static constexpr size_t kMessageHeaderLength = 14;
+    static constexpr size_t kMaxRecordLength     = kMessageHeaderLength + kMaxPayloadLength;
+    static constexpr size_t kInvalidLength       = SIZE_MAX;
+
+    struct FormatKey
+    {
+        bool operator==(const FormatKey &aOther) const
+        {
+            return mLogTag == aOther.mLogTag && mFormat == aOther.mFormat && mFlags == aOther.mFlags;
+        }
+
+        const char *mLogTag;
+        const char *mFormat;
+        uint8_t     mFlags;
+    };
+
+    struct FormatKeyHash
+    {
+        size_t operator()(const FormatKey &aKey) const
+        {
+            return std::hash<const void *>()(aKey.mLogTag) * 31 + std::hash<const void *>()(aKey.mFormat) + aKey.mFlags;
+        }
+    };
+
+    struct Format
+    {
+        uint16_t                mId;
+        bool                    mPreformatted; ///< The message is formatted by the writer, for unsupported formats.
+        std::vector<Conversion> mConversions;
+    };
+
+    const Format *FindOrAddFormat(const char *aLogTag, const char *aFormat, uint8_t aFlags);
+    void          BeginMessage(otbrLogLevel aLevel, const Format &aFormat);
+    void          AppendString(const char *aString, size_t aMaxLength);
+    void          AppendUint(uint64_t aValue, uint8_t aSize);
+    void          AppendBytes(const void *aBytes, size_t aLength);
+    void          EndMessage(otbrLogLevel aLevel);
+
+    std::mutex                                           mMutex;
+    FILE                                                *mFile = nullptr;
+    std::unordered_map<FormatKey, Format, FormatKeyHash> mFormats;
+    uint8_t                                              mRecord[kMaxRecordLength];
+    size_t                                               mRecordLength        = 0;
+    uint32_t                                             mDroppedMessageCount = 0;
+};
+
+/**
+ * This class implements a binary log reader, which formats the log messages.
+ *
+ */
+class BinaryLogReader : public BinaryLog, private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes a closed binary log reader.
+     *
+     */
+    BinaryLogReader(void) = default;
+
+    /**
+     * This destructor closes the binary log file.
+     *
+     */
+    ~BinaryLogReader(void);
+
+    /**
+     * This method opens a binary log file.
+     *
+     * @param[in] aPath  The path of the binary log file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the binary log file.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the binary log file.
+     * @retval OTBR_ERROR_PARSE  The file isn't a binary log file of a supported version.
+     *
+     */
+    otbrError Open(const char *aPath);
+
+    /**
+     * This method closes the binary log file.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method reads and formats the next log message.
+     *
+     * The text is formatted like the syslog message, preceded by the time in seconds. A hex dump is formatted as
+     * multiple lines separated by `\n`.
+     *
+     * @param[out] aText  The formatted log message.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully read a log message.
+     * @retval OTBR_ERROR_NOT_FOUND  There are no more log messages.
+     * @retval OTBR_ERROR_PARSE      The binary log file is malformed or truncated.
+     *
+     */
+    otbrError ReadNext(std::string &aText);
+
+private:
+    struct Format
+    {
+        uint8_t                 mFlags;
+        std::string             mLogTag;
+        std::string             mFormat;
+        std::vector<Conversion> mConversions;
+    };
+
+    otbrError ReadFormat(void);
+    otbrError ReadMessage(std::string &aText);
+    otbrError FormatMessage(const Format &aFormat, const uint8_t *aPayload, size_t aLength, std::string &aText);
+    bool      Read(void *aBuffer, size_t aLength);
+    bool      ReadUint(uint64_t &aValue, uint8_t aSize);
+
+    FILE               *mFile = nullptr;
+    std::vector<Format> mFormats;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_BINARY_LOG_HPP_
@@ -34,6 +34,16 @@
 #include <functional>
 #include <type_traits>
 
+#include "common/inline_function.hpp"
+
+/**
+ * The size (in bytes) of the inline storage of a `OnceCallback`, larger callables are allocated from the heap.
+ *
+ */
+#ifndef OTBR_ONCE_CALLBACK_INLINE_SIZE
+#define OTBR_ONCE_CALLBACK_INLINE_SIZE 48
+#endif
+
 namespace otbr {
 
 template <class T> class OnceCallback;
@@ -43,6 +53,9 @@ template <class T> class OnceCallback;
  *
  * IsNull is guaranteed to return true once the callback has been invoked.
  *
+ * The callback is move-only, so that it can hold move-only callables. Callables up to
+ * `OTBR_ONCE_CALLBACK_INLINE_SIZE` bytes are stored inline, larger ones fall back to a heap allocation.
+ *
  * Example usage:
  *  OnceCallback<int(int)> square([](int x) { return x * x; });
  *  std::move(square)(5); // Returns 25.
@@ -100,10 +113,21 @@ public:
         return cb.mFunc(std::forward<Args>(aArgs)...);
     }
 
-    bool IsNull() const { return mFunc == nullptr; }
+    bool IsNull() const { return !mFunc; }
+
+    /**
+     * This method indicates whether a callable of type `F` is stored without heap allocation.
+     *
+     */
+    template <typename F> static constexpr bool IsStoredInline(void)
+    {
+        return Function::template IsStoredInline<typename std::decay<F>::type>();
+    }
 
 private:
-    std::function<R(Args...)> mFunc;
+    using Function = InlineFunction<R(Args...), OTBR_ONCE_CALLBACK_INLINE_SIZE>;
+
+    Function mFunc;
 };
 
 } // namespace otbr
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/coroutine.hpp"
+
+#if OTBR_ENABLE_COROUTINES
+
+#include <new>
+
+/**
+ * The maximum number of free coroutine frames of each size class kept for reuse by each thread.
+ *
+ */
+#ifndef OTBR_COROUTINE_FRAME_POOL_SIZE
+#define OTBR_COROUTINE_FRAME_POOL_SIZE 16
+#endif
+
+namespace otbr {
+
+namespace {
+
+// The frames are pooled by size classes of 64 bytes, the larger ones are allocated from the heap.
+constexpr size_t kFrameSizeClassUnit  = 64;
+constexpr size_t kFrameSizeClassCount = 16;
+
+thread_local size_t sFrameHeapAllocationCount = 0;
+
+/**
+ * This structure implements the free lists of the frames of each size class.
+ *
+ * It is trivially destructible, so that the coroutines finishing during the exit of the program can still put their
+ * frames back. The free frames are kept until then.
+ *
+ */
+struct FreeFrames
+{
+    void  *mFrames[kFrameSizeClassCount][OTBR_COROUTINE_FRAME_POOL_SIZE];
+    size_t mCounts[kFrameSizeClassCount];
+};
+
+thread_local FreeFrames sFreeFrames;
+
+size_t GetSizeClass(size_t aSize)
+{
+    return (aSize + kFrameSizeClassUnit - 1) / kFrameSizeClassUnit - 1;
+}
+
+} // namespace
+
+void *Coroutine::AllocateFrame(size_t aSize)
+{
+    size_t sizeClass = GetSizeClass(aSize);
+    void  *frame;
+
+    if (sizeClass < kFrameSizeClassCount && sFreeFrames.mCounts[sizeClass] > 0)
+    {
+        frame = sFreeFrames.mFrames[sizeClass][--sFreeFrames.mCounts[sizeClass]];
+    }
+    else
+    {
+        // A pooled frame is allocated with the size of its class, so that it can be reused by any frame of it.
+        frame = ::operator new(sizeClass < kFrameSizeClassCount ? (sizeClass + 1) * kFrameSizeClassUnit : aSize);
+        sFrameHeapAllocationCount++;
+    }
+
+    return frame;
+}
+
+void Coroutine::FreeFrame(void *aFrame, size_t aSize) noexcept
+{
+    size_t sizeClass = GetSizeClass(aSize);
+
+    // A coroutine may finish on another thread, its frame is then put back to the pool of that thread.
+    if (sizeClass < kFrameSizeClassCount && sFreeFrames.mCounts[sizeClass] < OTBR_COROUTINE_FRAME_POOL_SIZE)
+    {
+        sFreeFrames.mFrames[sizeClass][sFreeFrames.mCounts[sizeClass]++] = aFrame;
+    }
+    else
+    {
+        ::operator delete(aFrame);
+    }
+}
+
+size_t Coroutine::GetFrameHeapAllocationCount(void)
+{
+    return sFrameHeapAllocationCount;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_COROUTINES
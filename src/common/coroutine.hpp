@@ -0,0 +1,269 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the coroutines and the awaitables of the mainloop tasks and the async callbacks.
+ */
+
+#ifndef OTBR_COMMON_COROUTINE_HPP_
+#define OTBR_COMMON_COROUTINE_HPP_
+
+#include <openthread-br/config.h>
+
+/**
+ * Whether to build the coroutine layer, which requires C++20.
+ *
+ */
+#ifndef OTBR_ENABLE_COROUTINES
+#define OTBR_ENABLE_COROUTINES 0
+#endif
+
+#if OTBR_ENABLE_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/task_runner.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a coroutine which is started right away and destroys itself once it returns.
+ *
+ * Like a task posted to the Task Runner, the coroutine isn't owned by its caller. Its frame is allocated from a
+ * per-thread pool, so that running the coroutines of an operation repeatedly doesn't allocate memory once the pool
+ * is warm.
+ *
+ * Example usage:
+ *  Coroutine Migrate(TaskRunner &aTaskRunner, Ncp::ThreadHost &aHost, otOperationalDatasetTlvs aTlvs)
+ *  {
+ *      auto [error, errorInfo] = co_await Ncp::ScheduleMigration(aHost, aTlvs);
+ *
+ *      co_await ResumeAfter(aTaskRunner, std::chrono::milliseconds(100));
+ *      ...
+ *  }
+ *
+ * A coroutine awaiting a callback which is destroyed without being invoked is never resumed, its frame is leaked.
+ *
+ */
+class Coroutine
+{
+public:
+    struct promise_type
+    {
+        Coroutine           get_return_object(void) noexcept { return Coroutine(); }
+        std::suspend_never  initial_suspend(void) noexcept { return {}; }
+        std::suspend_never  final_suspend(void) noexcept { return {}; }
+        void                return_void(void) noexcept {}
+        void                unhandled_exception(void) noexcept { std::terminate(); }
+        static void        *operator new(size_t aSize) { return AllocateFrame(aSize); }
+        static void         operator delete(void *aFrame, size_t aSize) noexcept { FreeFrame(aFrame, aSize); }
+    };
+
+    /**
+     * This function returns the number of coroutine frames which have been allocated from the heap by this thread.
+     *
+     * @returns The number of heap allocations of the frame pool, which stops growing once the pool is warm.
+     *
+     */
+    static size_t GetFrameHeapAllocationCount(void);
+
+private:
+    static void *AllocateFrame(size_t aSize);
+    static void  FreeFrame(void *aFrame, size_t aSize) noexcept;
+};
+
+/**
+ * This class implements the awaitable which resumes the coroutine by a task of the Task Runner.
+ *
+ */
+class TaskRunnerAwaiter
+{
+public:
+    TaskRunnerAwaiter(TaskRunner &aTaskRunner, TaskRunner::Priority aPriority, Milliseconds aDelay)
+        : mTaskRunner(aTaskRunner)
+        , mPriority(aPriority)
+        , mDelay(aDelay)
+    {
+    }
+
+    bool await_ready(void) const noexcept { return false; }
+    void await_resume(void) const noexcept {}
+
+    void await_suspend(std::coroutine_handle<> aHandle)
+    {
+        if (mDelay > Milliseconds::zero())
+        {
+            mTaskRunner.Post(mPriority, mDelay, [aHandle]() { aHandle.resume(); });
+        }
+        else
+        {
+            mTaskRunner.Post(mPriority, [aHandle]() { aHandle.resume(); });
+        }
+    }
+
+private:
+    TaskRunner          &mTaskRunner;
+    TaskRunner::Priority mPriority;
+    Milliseconds         mDelay;
+};
+
+/**
+ * This function returns an awaitable which resumes the coroutine on the mainloop of a Task Runner.
+ *
+ * It is safe to await it on other threads, the coroutine continues on the mainloop.
+ *
+ * @param[in] aTaskRunner  The Task Runner to resume the coroutine.
+ * @param[in] aPriority    The priority of the task resuming the coroutine.
+ *
+ */
+inline TaskRunnerAwaiter ResumeOn(TaskRunner          &aTaskRunner,
+                                  TaskRunner::Priority aPriority = TaskRunner::Priority::kNormal)
+{
+    return TaskRunnerAwaiter(aTaskRunner, aPriority, Milliseconds::zero());
+}
+
+/**
+ * This function returns an awaitable which resumes the coroutine on the mainloop of a Task Runner after a delay.
+ *
+ * @param[in] aTaskRunner  The Task Runner to resume the coroutine.
+ * @param[in] aDelay       The delay before resuming the coroutine.
+ * @param[in] aPriority    The priority of the task resuming the coroutine.
+ *
+ */
+inline TaskRunnerAwaiter ResumeAfter(TaskRunner          &aTaskRunner,
+                                     Milliseconds         aDelay,
+                                     TaskRunner::Priority aPriority = TaskRunner::Priority::kNormal)
+{
+    return TaskRunnerAwaiter(aTaskRunner, aPriority, aDelay);
+}
+
+template <typename... Args> struct CallbackResult
+{
+    using Type = std::tuple<std::decay_t<Args>...>;
+};
+
+template <typename Arg> struct CallbackResult<Arg>
+{
+    using Type = std::decay_t<Arg>;
+};
+
+/**
+ * This class implements the awaitable of an operation which reports its result to a callback.
+ *
+ * The awaiting coroutine is resumed within the callback, with its arguments as the result of `co_await`: the argument
+ * itself if there is only one, otherwise a tuple of them.
+ *
+ * @tparam Starter  The type of the function starting the operation with a callback.
+ * @tparam Args     The argument types of the callback.
+ *
+ */
+template <typename Starter, typename... Args> class CallbackAwaiter
+{
+public:
+    using Result = typename CallbackResult<Args...>::Type;
+
+    /**
+     * This class implements the callback resuming the coroutine.
+     *
+     * It's trivially copyable and small, so that it's stored inline by `std::function`, `InlineFunction` and
+     * `OnceCallback`.
+     *
+     */
+    class Resumer
+    {
+    public:
+        void operator()(Args... aArgs) const
+        {
+            mAwaiter->mResult.emplace(std::forward<Args>(aArgs)...);
+            mHandle.resume();
+        }
+
+    private:
+        friend class CallbackAwaiter;
+
+        Resumer(CallbackAwaiter *aAwaiter, std::coroutine_handle<> aHandle)
+            : mAwaiter(aAwaiter)
+            , mHandle(aHandle)
+        {
+        }
+
+        CallbackAwaiter        *mAwaiter;
+        std::coroutine_handle<> mHandle;
+    };
+
+    explicit CallbackAwaiter(Starter aStarter)
+        : mStarter(std::move(aStarter))
+    {
+    }
+
+    bool   await_ready(void) const noexcept { return false; }
+    Result await_resume(void) { return std::move(*mResult); }
+
+    void await_suspend(std::coroutine_handle<> aHandle)
+    {
+        // The callback may resume the coroutine, and destroy this awaiter, before the starter returns.
+        Starter starter = std::move(mStarter);
+
+        starter(Resumer(this, aHandle));
+    }
+
+private:
+    Starter               mStarter;
+    std::optional<Result> mResult;
+};
+
+/**
+ * This function returns an awaitable of an operation which reports its result to a callback.
+ *
+ * Example usage:
+ *  otbrError error = co_await AwaitCallback<otbrError>([&](auto aCallback) {
+ *      aPublisher.PublishKey(aName, aKeyData, std::move(aCallback));
+ *  });
+ *
+ * @tparam Args     The argument types of the callback.
+ * @tparam Starter  The type of the function starting the operation.
+ *
+ * @param[in] aStarter  The function starting the operation, with the callback resuming the coroutine.
+ *
+ */
+template <typename... Args, typename Starter> CallbackAwaiter<Starter, Args...> AwaitCallback(Starter aStarter)
+{
+    return CallbackAwaiter<Starter, Args...>(std::move(aStarter));
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_COROUTINES
+
+#endif // OTBR_COMMON_COROUTINE_HPP_
@@ -28,64 +28,265 @@
 
 #include "common/dns_utils.hpp"
 
-#include <assert.h>
+#include <algorithm>
+#include <functional>
+
+#include <ctype.h>
 
 #include "common/code_utils.hpp"
 
+// The sizes and offsets of the DNS message fields (RFC 1035 section 4.1).
+static constexpr uint16_t kDnsHeaderSize            = 12;
+static constexpr uint16_t kDnsFlagsOffset           = 2;
+static constexpr uint16_t kDnsQuestionCountOffset   = 4;
+static constexpr uint16_t kDnsAnswerCountOffset     = 6;
+static constexpr uint16_t kDnsAuthorityCountOffset  = 8;
+static constexpr uint16_t kDnsAdditionalCountOffset = 10;
+static constexpr uint16_t kDnsQuestionFixedSize     = 4;
+static constexpr uint16_t kDnsRecordFixedSize       = 10;
+static constexpr uint16_t kDnsRecordTtlOffset       = 4;
+static constexpr uint16_t kDnsRecordRdLengthOffset  = 8;
+static constexpr uint16_t kDnsSoaMinimumSize        = 4;
+
+static constexpr uint16_t kDnsFlagResponse  = 0x8000;
+static constexpr uint16_t kDnsFlagsOpcode   = 0x7800;
+static constexpr uint16_t kDnsFlagTruncated = 0x0200;
+static constexpr uint16_t kDnsFlagRecursion = 0x0100;
+static constexpr uint16_t kDnsFlagChecking  = 0x0010;
+static constexpr uint16_t kDnsFlagsRcode    = 0x000f;
+
+static constexpr uint16_t kDnsRcodeNoError   = 0;
+static constexpr uint16_t kDnsRcodeNameError = 3;
+
+static constexpr uint16_t kDnsTypeSoa = 6;
+static constexpr uint16_t kDnsTypeOpt = 41;
+
+static uint16_t ReadUint16(const uint8_t *aData)
+{
+    return static_cast<uint16_t>((aData[0] << 8) | aData[1]);
+}
+
+static uint32_t ReadUint32(const uint8_t *aData)
+{
+    return (static_cast<uint32_t>(ReadUint16(aData)) << 16) | ReadUint16(aData + 2);
+}
+
+static void WriteUint32(uint8_t *aData, uint32_t aValue)
+{
+    aData[0] = static_cast<uint8_t>(aValue >> 24);
+    aData[1] = static_cast<uint8_t>(aValue >> 16);
+    aData[2] = static_cast<uint8_t>(aValue >> 8);
+    aData[3] = static_cast<uint8_t>(aValue);
+}
+
+// Advances `aOffset` past the (possibly compressed) DNS name at it.
+static bool SkipDnsName(const uint8_t *aMessage, uint16_t aLength, uint16_t &aOffset)
+{
+    bool found = false;
+
+    while (aOffset < aLength)
+    {
+        uint8_t labelLength = aMessage[aOffset];
+
+        if (labelLength == 0)
+        {
+            aOffset += 1;
+            found = true;
+            break;
+        }
+        if ((labelLength & 0xc0) == 0xc0)
+        {
+            // A compression pointer ends the name.
+            VerifyOrExit(aLength - aOffset >= 2);
+            aOffset += 2;
+            found = true;
+            break;
+        }
+        VerifyOrExit((labelLength & 0xc0) == 0 && aLength - aOffset > labelLength);
+        aOffset += 1 + labelLength;
+    }
+
+exit:
+    return found;
+}
+
+// Invokes `aHandler` with the type, the offset of the fixed fields and the RDATA length of each record after the
+// questions.
+static bool ForEachDnsRecord(const uint8_t                                          *aMessage,
+                             uint16_t                                                aLength,
+                             const std::function<void(uint16_t, uint16_t, uint16_t)> &aHandler)
+{
+    bool     valid  = false;
+    uint16_t offset = kDnsHeaderSize;
+    uint32_t recordCount;
+
+    VerifyOrExit(aLength >= kDnsHeaderSize);
+    recordCount = static_cast<uint32_t>(ReadUint16(aMessage + kDnsAnswerCountOffset)) +
+                  ReadUint16(aMessage + kDnsAuthorityCountOffset) + ReadUint16(aMessage + kDnsAdditionalCountOffset);
+
+    for (uint16_t i = ReadUint16(aMessage + kDnsQuestionCountOffset); i > 0; i--)
+    {
+        VerifyOrExit(SkipDnsName(aMessage, aLength, offset));
+        VerifyOrExit(aLength - offset >= kDnsQuestionFixedSize);
+        offset += kDnsQuestionFixedSize;
+    }
+
+    for (; recordCount > 0; recordCount--)
+    {
+        uint16_t rdLength;
+
+        VerifyOrExit(SkipDnsName(aMessage, aLength, offset));
+        VerifyOrExit(aLength - offset >= kDnsRecordFixedSize);
+        rdLength = ReadUint16(aMessage + offset + kDnsRecordRdLengthOffset);
+        VerifyOrExit(aLength - offset - kDnsRecordFixedSize >= rdLength);
+        aHandler(ReadUint16(aMessage + offset), offset, rdLength);
+        offset += kDnsRecordFixedSize + rdLength;
+    }
+
+    valid = true;
+
+exit:
+    return valid;
+}
+
 static bool NameEndsWithDot(const std::string &aName)
 {
     return !aName.empty() && aName.back() == '.';
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+/**
+ * This class provides the characters of a DNS name, as if it ends with a dot.
+ *
+ */
+class FullDnsName
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+public:
+    FullDnsName(const char *aName, size_t aLength)
+        : mName(aName)
+        , mLength(aLength)
+        , mFullLength((aLength > 0 && aName[aLength - 1] == '.') ? aLength : aLength + 1)
+    {
+    }
+
+    size_t GetLength(void) const { return mFullLength; }
+
+    char operator[](size_t aIndex) const { return aIndex < mLength ? mName[aIndex] : '.'; }
 
-    if (!NameEndsWithDot(fullName))
+    // The part only covers the characters of the name, i.e. not the dot it may lack.
+    DnsNameSpan GetSpan(size_t aStart, size_t aEnd) const
     {
-        fullName += '.';
+        aStart = std::min(aStart, mLength);
+        aEnd   = std::min(aEnd, mLength);
+
+        return {mName + aStart, aEnd - aStart};
     }
 
-    transportPos = fullName.rfind("._udp.");
+    size_t FindLast(const char *aString, size_t aStringLength) const
+    {
+        size_t pos = std::string::npos;
 
-    if (transportPos == std::string::npos)
+        for (size_t end = mFullLength; pos == std::string::npos && end >= aStringLength; end--)
+        {
+            size_t start = end - aStringLength;
+            size_t i     = 0;
+
+            while (i < aStringLength && (*this)[start + i] == aString[i])
+            {
+                i++;
+            }
+
+            pos = (i == aStringLength) ? start : pos;
+        }
+
+        return pos;
+    }
+
+    size_t FindFirstDot(void) const
     {
-        transportPos = fullName.rfind("._tcp.");
+        size_t pos = 0;
+
+        while ((*this)[pos] != '.')
+        {
+            pos++;
+        }
+
+        return pos;
     }
 
+private:
+    const char *mName;
+    size_t      mLength;
+    size_t      mFullLength;
+};
+
+DnsNameSpans SplitFullDnsName(const char *aName, size_t aLength)
+{
+    static constexpr char   kUdp[]           = "._udp.";
+    static constexpr char   kTcp[]           = "._tcp.";
+    static constexpr size_t kTransportLength = sizeof(kUdp) - 1;
+
+    FullDnsName  fullName(aName, aLength);
+    size_t       transportPos;
+    DnsNameSpans nameSpans;
+
+    nameSpans.mInstanceName = fullName.GetSpan(0, 0);
+    nameSpans.mServiceName  = nameSpans.mInstanceName;
+    nameSpans.mHostName     = nameSpans.mInstanceName;
+
+    transportPos = fullName.FindLast(kUdp, kTransportLength);
+
     if (transportPos == std::string::npos)
     {
-        // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
+        transportPos = fullName.FindLast(kTcp, kTransportLength);
+    }
 
-        assert(dotPos != std::string::npos);
+    if (transportPos == std::string::npos)
+    {
+        // host.domain or domain, the name ends with a dot so that there is always one.
+        size_t dotPos = fullName.FindFirstDot();
 
         // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        nameSpans.mHostName = fullName.GetSpan(0, dotPos);
+        nameSpans.mDomain   = fullName.GetSpan(dotPos + 1, fullName.GetLength());
     }
     else
     {
         // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t dotPos = transportPos;
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        while (dotPos > 0 && fullName[dotPos - 1] != '.')
+        {
+            dotPos--;
+        }
 
-        if (dotPos == std::string::npos)
+        nameSpans.mDomain = fullName.GetSpan(transportPos + kTransportLength, fullName.GetLength());
+
+        if (dotPos == 0)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            nameSpans.mServiceName = fullName.GetSpan(0, transportPos + kTransportLength - 1);
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            nameSpans.mInstanceName = fullName.GetSpan(0, dotPos - 1);
+            nameSpans.mServiceName  = fullName.GetSpan(dotPos, transportPos + kTransportLength - 1);
         }
     }
 
+    return nameSpans;
+}
+
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    DnsNameSpans nameSpans = SplitFullDnsName(aName.data(), aName.size());
+    DnsNameInfo  nameInfo;
+
+    nameInfo.mInstanceName = nameSpans.mInstanceName.ToString();
+    nameInfo.mServiceName  = nameSpans.mServiceName.ToString();
+    nameInfo.mHostName     = nameSpans.mHostName.ToString();
+    nameInfo.mDomain       = nameSpans.mDomain.ToString();
+
     if (!NameEndsWithDot(nameInfo.mDomain))
     {
         nameInfo.mDomain += '.';
@@ -139,3 +340,100 @@ otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName
 exit:
     return error;
 }
+
+otbrError GetDnsQueryKey(const uint8_t *aMessage, uint16_t aLength, std::string &aKey)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    uint16_t  offset = kDnsHeaderSize;
+    uint16_t  flags;
+
+    VerifyOrExit(aLength >= kDnsHeaderSize, error = OTBR_ERROR_PARSE);
+    flags = ReadUint16(aMessage + kDnsFlagsOffset);
+    VerifyOrExit(!(flags & kDnsFlagsOpcode) && ReadUint16(aMessage + kDnsQuestionCountOffset) == 1,
+                 error = OTBR_ERROR_NOT_IMPLEMENTED);
+
+    // The question name is never compressed, so that it can be compared byte by byte.
+    while (offset < aLength && aMessage[offset] != 0)
+    {
+        VerifyOrExit((aMessage[offset] & 0xc0) == 0 && aLength - offset > aMessage[offset], error = OTBR_ERROR_PARSE);
+        offset += 1 + aMessage[offset];
+    }
+    VerifyOrExit(offset < aLength && aLength - offset - 1 >= kDnsQuestionFixedSize, error = OTBR_ERROR_PARSE);
+    offset += 1;
+
+    flags &= (kDnsFlagRecursion | kDnsFlagChecking);
+    aKey.assign(1, static_cast<char>(flags >> 8));
+    aKey.push_back(static_cast<char>(flags & 0xff));
+    for (uint16_t i = kDnsHeaderSize; i < offset; i++)
+    {
+        // Label lengths are below 64 and are never changed.
+        aKey.push_back(static_cast<char>(tolower(aMessage[i])));
+    }
+
+    // The QTYPE and QCLASS are kept as is.
+    aKey.append(reinterpret_cast<const char *>(aMessage + offset), kDnsQuestionFixedSize);
+
+exit:
+    return error;
+}
+
+uint32_t GetDnsResponseCacheTtl(const uint8_t *aMessage, uint16_t aLength)
+{
+    uint32_t ttl       = UINT32_MAX;
+    uint32_t soaTtl    = UINT32_MAX;
+    bool     hasAnswer = false;
+    uint16_t flags;
+    uint16_t rcode;
+
+    VerifyOrExit(aLength >= kDnsHeaderSize, ttl = 0);
+    flags = ReadUint16(aMessage + kDnsFlagsOffset);
+    rcode = flags & kDnsFlagsRcode;
+    VerifyOrExit((flags & kDnsFlagResponse) && !(flags & kDnsFlagTruncated), ttl = 0);
+    VerifyOrExit(rcode == kDnsRcodeNoError || rcode == kDnsRcodeNameError, ttl = 0);
+    hasAnswer = (rcode == kDnsRcodeNoError && ReadUint16(aMessage + kDnsAnswerCountOffset) > 0);
+
+    VerifyOrExit(ForEachDnsRecord(aMessage, aLength,
+                                  [&](uint16_t aType, uint16_t aOffset, uint16_t aRdLength) {
+                                      uint32_t recordTtl = ReadUint32(aMessage + aOffset + kDnsRecordTtlOffset);
+
+                                      if (aType == kDnsTypeOpt)
+                                      {
+                                          return;
+                                      }
+                                      ttl = std::min(ttl, recordTtl);
+                                      if (aType == kDnsTypeSoa && aRdLength >= kDnsSoaMinimumSize)
+                                      {
+                                          uint16_t minimumOffset =
+                                              aOffset + kDnsRecordFixedSize + aRdLength - kDnsSoaMinimumSize;
+
+                                          soaTtl = std::min(recordTtl, ReadUint32(aMessage + minimumOffset));
+                                      }
+                                  }),
+                 ttl = 0);
+
+    if (!hasAnswer)
+    {
+        ttl = (soaTtl == UINT32_MAX) ? 0 : std::min(ttl, soaTtl);
+    }
+    else if (ttl == UINT32_MAX)
+    {
+        ttl = 0;
+    }
+
+exit:
+    return ttl;
+}
+
+void AgeDnsResponse(uint8_t *aMessage, uint16_t aLength, uint32_t aElapsed)
+{
+    ForEachDnsRecord(aMessage, aLength, [aMessage, aElapsed](uint16_t aType, uint16_t aOffset, uint16_t aRdLength) {
+        uint8_t *ttl = aMessage + aOffset + kDnsRecordTtlOffset;
+
+        OTBR_UNUSED_VARIABLE(aRdLength);
+
+        if (aType != kDnsTypeOpt)
+        {
+            WriteUint32(ttl, ReadUint32(ttl) > aElapsed ? ReadUint32(ttl) - aElapsed : 0);
+        }
+    });
+}
@@ -76,6 +76,73 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This structure represents a part of a DNS name, which refers to the characters of the name instead of copying them.
+ *
+ */
+struct DnsNameSpan
+{
+    const char *mData;   ///< A pointer to the first character of the part.
+    size_t      mLength; ///< The number of characters of the part.
+
+    /**
+     * This method returns if the part is empty.
+     *
+     * @returns Whether the part is empty.
+     *
+     */
+    bool IsEmpty(void) const { return mLength == 0; }
+
+    /**
+     * This method returns a copy of the part.
+     *
+     * @returns A string containing the characters of the part.
+     *
+     */
+    std::string ToString(void) const { return std::string(mData, mLength); }
+};
+
+/**
+ * This structure represents DNS Name information as parts of the DNS name it is split from.
+ *
+ * The parts are only valid as long as the DNS name is. Unlike `DnsNameInfo::mDomain`, `mDomain` doesn't end with a dot
+ * if the DNS name doesn't.
+ *
+ * @sa SplitFullDnsName
+ *
+ */
+struct DnsNameSpans
+{
+    DnsNameSpan mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    DnsNameSpan mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    DnsNameSpan mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    DnsNameSpan mDomain;       ///< Domain name.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     *
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); };
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     *
+     */
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     *
+     */
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+};
+
 /**
  * This method splits a full DNS name into name components.
  *
@@ -88,6 +155,19 @@ struct DnsNameInfo
  */
 DnsNameInfo SplitFullDnsName(const std::string &aName);
 
+/**
+ * This method splits a full DNS name into name components, without copying them.
+ *
+ * @param[in] aName    A pointer to the full DNS name to dissect.
+ * @param[in] aLength  The length of the full DNS name.
+ *
+ * @returns A `DnsNameSpans` structure referring to the name components of @p aName.
+ *
+ * @sa DnsNameSpans
+ *
+ */
+DnsNameSpans SplitFullDnsName(const char *aName, size_t aLength);
+
 /**
  * This function splits a full service name into components.
  *
@@ -131,4 +211,48 @@ otbrError SplitFullServiceInstanceName(const std::string &aFullName,
  */
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain);
 
+/**
+ * This function derives the key of a DNS query message, which identical queries and their responses share.
+ *
+ * The key is made of the flags which affect the answers and of the question, whose name is converted to lower case.
+ * The message ID is not part of the key.
+ *
+ * @param[in]  aMessage  A pointer to the DNS query or response message.
+ * @param[in]  aLength   The length of the DNS message.
+ * @param[out] aKey      A reference to a string to receive the key.
+ *
+ * @retval OTBR_ERROR_NONE             Successfully derived the key.
+ * @retval OTBR_ERROR_PARSE            The message is not a valid DNS message.
+ * @retval OTBR_ERROR_NOT_IMPLEMENTED  The message is not a standard query with a single question.
+ *
+ */
+otbrError GetDnsQueryKey(const uint8_t *aMessage, uint16_t aLength, std::string &aKey);
+
+/**
+ * This function returns how long a DNS response message may be cached.
+ *
+ * A positive response may be cached for the smallest TTL of its records. A negative response (name error or no
+ * answer) may be cached for the smaller of the TTL and MINIMUM fields of its SOA record (RFC 2308). Truncated
+ * responses and responses with other response codes are never cached.
+ *
+ * @param[in] aMessage  A pointer to the DNS response message.
+ * @param[in] aLength   The length of the DNS response message.
+ *
+ * @returns The time in seconds for which the response may be cached, or 0 if it must not be cached.
+ *
+ */
+uint32_t GetDnsResponseCacheTtl(const uint8_t *aMessage, uint16_t aLength);
+
+/**
+ * This function subtracts the time spent in a cache from the TTLs of the records of a DNS response message.
+ *
+ * The TTLs do not go below 0, the OPT pseudo-record is left as is.
+ *
+ * @param[in,out] aMessage  A pointer to the DNS response message.
+ * @param[in]     aLength   The length of the DNS response message.
+ * @param[in]     aElapsed  The time in seconds spent in the cache.
+ *
+ */
+void AgeDnsResponse(uint8_t *aMessage, uint16_t aLength, uint32_t aElapsed);
+
 #endif // OTBR_COMMON_DNS_UTILS_HPP_
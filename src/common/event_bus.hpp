@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the in-process event bus of the agent.
+ */
+
+#ifndef OTBR_COMMON_EVENT_BUS_HPP_
+#define OTBR_COMMON_EVENT_BUS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class template implements the channel of one type of events on the event bus.
+ *
+ * The publishers keep the event records and pass them by const reference, so publishing neither allocates nor
+ * copies the events. The referenced data is only valid during the call of the handlers, a handler which needs it
+ * later copies what it needs.
+ *
+ * The events are published, subscribed and unsubscribed in the mainloop thread. A handler may subscribe or
+ * unsubscribe handlers, including itself, the new handlers only receive the next events.
+ *
+ * @tparam EventType  The type of the event records.
+ *
+ */
+template <typename EventType> class EventChannel : private NonCopyable
+{
+public:
+    using Handler      = std::function<void(const EventType &aEvent)>;
+    using SubscriberId = uint64_t;
+
+    /**
+     * This method subscribes a handler to the events.
+     *
+     * @param[in] aHandler  The handler of the events.
+     *
+     * @returns The ID of the subscription, which unsubscribes it with `Unsubscribe()`.
+     *
+     */
+    SubscriberId Subscribe(Handler aHandler)
+    {
+        SubscriberId id = mNextId++;
+
+        mSubscribers.push_back({id, std::move(aHandler)});
+
+        return id;
+    }
+
+    /**
+     * This method unsubscribes a handler.
+     *
+     * @param[in] aId  The ID of the subscription.
+     *
+     */
+    void Unsubscribe(SubscriberId aId)
+    {
+        for (Subscriber &subscriber : mSubscribers)
+        {
+            if (subscriber.mId == aId)
+            {
+                // The handler is only erased once no event is being published, so that the iteration remains valid.
+                subscriber.mHandler = nullptr;
+                mHasRemoved         = true;
+            }
+        }
+
+        EraseRemoved();
+    }
+
+    /**
+     * This method indicates whether any handler is subscribed, so that publishers can skip filling the event record.
+     *
+     * @returns Whether any handler is subscribed.
+     *
+     */
+    bool HasSubscribers(void) const { return !mSubscribers.empty(); }
+
+    /**
+     * This method publishes an event to all the subscribed handlers.
+     *
+     * @param[in] aEvent  The event record.
+     *
+     */
+    void Publish(const EventType &aEvent)
+    {
+        size_t count = mSubscribers.size();
+
+        mPublishDepth++;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            // The handlers are copied since a handler may subscribe another one, which reallocates the subscribers.
+            Handler handler = mSubscribers[i].mHandler;
+
+            if (handler != nullptr)
+            {
+                handler(aEvent);
+            }
+        }
+
+        mPublishDepth--;
+        EraseRemoved();
+    }
+
+private:
+    struct Subscriber
+    {
+        SubscriberId mId;
+        Handler      mHandler;
+    };
+
+    void EraseRemoved(void)
+    {
+        VerifyOrExit(mHasRemoved && mPublishDepth == 0);
+
+        for (auto it = mSubscribers.begin(); it != mSubscribers.end();)
+        {
+            it = (it->mHandler == nullptr) ? mSubscribers.erase(it) : it + 1;
+        }
+        mHasRemoved = false;
+
+    exit:
+        return;
+    }
+
+    std::vector<Subscriber> mSubscribers;
+    SubscriberId            mNextId       = 1;
+    uint32_t                mPublishDepth = 0;
+    bool                    mHasRemoved   = false;
+};
+
+/**
+ * This class implements the in-process event bus of the agent.
+ *
+ * The subsystems publish their events (e.g. `Ncp::RcpHost::StateChangedEvent`) to the channel of the event type, so
+ * that other subsystems and vendor extensions can subscribe to them without registering callbacks on each subsystem
+ * or polling through D-Bus.
+ *
+ */
+class EventBus
+{
+public:
+    /**
+     * This method returns the channel of an event type.
+     *
+     * @tparam EventType  The type of the events.
+     *
+     * @returns A reference to the channel of the events.
+     *
+     */
+    template <typename EventType> static EventChannel<EventType> &Get(void)
+    {
+        static EventChannel<EventType> sChannel;
+        return sChannel;
+    }
+
+    /**
+     * This method publishes an event, the event record is not filled if there is no subscriber.
+     *
+     * @tparam EventType  The type of the events.
+     * @tparam Filler     The type of the function filling the event record.
+     *
+     * @param[in] aEvent   The event record kept by the publisher.
+     * @param[in] aFiller  The function filling the event record before it is published.
+     *
+     */
+    template <typename EventType, typename Filler> static void Publish(EventType &aEvent, Filler aFiller)
+    {
+        EventChannel<EventType> &channel = Get<EventType>();
+
+        VerifyOrExit(channel.HasSubscribers());
+        aFiller(aEvent);
+        channel.Publish(aEvent);
+
+    exit:
+        return;
+    }
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_EVENT_BUS_HPP_
@@ -0,0 +1,166 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a map stored in a sorted vector.
+ */
+
+#ifndef OTBR_COMMON_FLAT_MAP_HPP_
+#define OTBR_COMMON_FLAT_MAP_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace otbr {
+
+/**
+ * This class implements a map whose entries are stored contiguously in a vector sorted by key.
+ *
+ * It has no per-entry node, bucket array or allocator slack beyond the vector capacity, so it suits the maps which
+ * are filled at startup and then only looked up. Insertions and erasures move the following entries and are linear.
+ *
+ * The class provides the subset of the `std::map` interface used by OTBR, so that it can replace a `std::map` or a
+ * `std::unordered_map` through an alias. Iterators are invalidated by any insertion or erasure.
+ *
+ * @tparam Key      The key type.
+ * @tparam Value    The mapped type.
+ * @tparam Compare  The ordering of the keys.
+ *
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>> class FlatMap
+{
+public:
+    using key_type       = Key;
+    using mapped_type    = Value;
+    using value_type     = std::pair<Key, Value>;
+    using iterator       = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator       begin(void) { return mEntries.begin(); }
+    iterator       end(void) { return mEntries.end(); }
+    const_iterator begin(void) const { return mEntries.begin(); }
+    const_iterator end(void) const { return mEntries.end(); }
+
+    size_t size(void) const { return mEntries.size(); }
+    bool   empty(void) const { return mEntries.empty(); }
+    void   clear(void) { mEntries.clear(); }
+
+    /**
+     * This method releases the capacity of the vector beyond its entries.
+     *
+     */
+    void shrink_to_fit(void) { mEntries.shrink_to_fit(); }
+
+    iterator find(const Key &aKey)
+    {
+        iterator it = LowerBound(aKey);
+
+        return (it != mEntries.end() && !Compare()(aKey, it->first)) ? it : mEntries.end();
+    }
+
+    const_iterator find(const Key &aKey) const
+    {
+        const_iterator it = LowerBound(aKey);
+
+        return (it != mEntries.end() && !Compare()(aKey, it->first)) ? it : mEntries.end();
+    }
+
+    size_t count(const Key &aKey) const { return find(aKey) == end() ? 0 : 1; }
+
+    Value &at(const Key &aKey)
+    {
+        iterator it = find(aKey);
+
+        if (it == mEntries.end())
+        {
+            throw std::out_of_range("FlatMap::at");
+        }
+
+        return it->second;
+    }
+
+    const Value &at(const Key &aKey) const { return const_cast<FlatMap *>(this)->at(aKey); }
+
+    Value &operator[](const Key &aKey) { return emplace(aKey, Value()).first->second; }
+
+    /**
+     * This method inserts an entry unless the key is already in the map.
+     *
+     * @param[in] aKey    The key of the entry.
+     * @param[in] aValue  The value of the entry.
+     *
+     * @returns The iterator to the entry of the key, and whether the entry is inserted.
+     *
+     */
+    template <typename K, typename V> std::pair<iterator, bool> emplace(K &&aKey, V &&aValue)
+    {
+        Key      key(std::forward<K>(aKey));
+        iterator it       = LowerBound(key);
+        bool     inserted = false;
+
+        if (it == mEntries.end() || Compare()(key, it->first))
+        {
+            it       = mEntries.emplace(it, std::move(key), std::forward<V>(aValue));
+            inserted = true;
+        }
+
+        return std::make_pair(it, inserted);
+    }
+
+    iterator erase(const_iterator aPosition) { return mEntries.erase(aPosition); }
+
+    size_t erase(const Key &aKey)
+    {
+        iterator it     = find(aKey);
+        size_t   erased = 0;
+
+        if (it != mEntries.end())
+        {
+            mEntries.erase(it);
+            erased = 1;
+        }
+
+        return erased;
+    }
+
+private:
+    static bool KeyLess(const value_type &aEntry, const Key &aKey) { return Compare()(aEntry.first, aKey); }
+
+    iterator       LowerBound(const Key &aKey) { return std::lower_bound(begin(), end(), aKey, KeyLess); }
+    const_iterator LowerBound(const Key &aKey) const { return std::lower_bound(begin(), end(), aKey, KeyLess); }
+
+    std::vector<value_type> mEntries;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_FLAT_MAP_HPP_
@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a frame buffer with headroom for prepending headers in place.
+ */
+
+#ifndef OTBR_COMMON_FRAME_BUFFER_HPP_
+#define OTBR_COMMON_FRAME_BUFFER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a view of a frame in a caller-provided buffer.
+ *
+ * The frame starts after some headroom, so that the lower layer can prepend its
+ * headers in place instead of copying the payload into another buffer.
+ *
+ */
+class FrameBuffer : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty frame.
+     *
+     * @param[in] aBuffer    A pointer to the buffer.
+     * @param[in] aSize      The size of @p aBuffer.
+     * @param[in] aHeadroom  The number of bytes reserved before the frame.
+     *
+     */
+    FrameBuffer(uint8_t *aBuffer, uint16_t aSize, uint16_t aHeadroom)
+        : mBuffer(aBuffer)
+        , mSize(aSize)
+        , mOffset(aHeadroom)
+        , mLength(0)
+    {
+        assert(aHeadroom <= aSize);
+    }
+
+    /**
+     * This method returns a pointer to the start of the frame.
+     *
+     */
+    uint8_t *GetData(void) { return mBuffer + mOffset; }
+
+    /**
+     * This method returns a pointer to the start of the frame.
+     *
+     */
+    const uint8_t *GetData(void) const { return mBuffer + mOffset; }
+
+    /**
+     * This method returns the length of the frame.
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns the number of bytes which can be prepended to the frame.
+     *
+     */
+    uint16_t GetHeadroom(void) const { return mOffset; }
+
+    /**
+     * This method returns the maximum length of the frame without prepending.
+     *
+     */
+    uint16_t GetCapacity(void) const { return mSize - mOffset; }
+
+    /**
+     * This method sets the length of the frame, after the frame has been written to `GetData()`.
+     *
+     * @param[in] aLength  The length of the frame, must not exceed `GetCapacity()`.
+     *
+     */
+    void SetLength(uint16_t aLength)
+    {
+        assert(aLength <= GetCapacity());
+        mLength = aLength;
+    }
+
+    /**
+     * This method prepends a header to the frame in place.
+     *
+     * @param[in] aHeader  A pointer to the header.
+     * @param[in] aLength  The length of the header.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully prepended the header.
+     * @retval OTBR_ERROR_INVALID_ARGS  There is not enough headroom for the header.
+     *
+     */
+    otbrError Prepend(const void *aHeader, uint16_t aLength)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(aLength <= mOffset, error = OTBR_ERROR_INVALID_ARGS);
+
+        mOffset -= aLength;
+        mLength += aLength;
+        memcpy(mBuffer + mOffset, aHeader, aLength);
+
+    exit:
+        return error;
+    }
+
+private:
+    uint8_t *mBuffer;
+    uint16_t mSize;
+    uint16_t mOffset;
+    uint16_t mLength;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_FRAME_BUFFER_HPP_
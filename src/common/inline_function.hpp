@@ -0,0 +1,232 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a move-only function wrapper with inline storage.
+ */
+
+#ifndef OTBR_COMMON_INLINE_FUNCTION_HPP_
+#define OTBR_COMMON_INLINE_FUNCTION_HPP_
+
+#include "openthread-br/config.h"
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace otbr {
+
+template <class T, size_t kInlineSize = 56> class InlineFunction;
+
+/**
+ * A move-only callable wrapper which stores small callables without heap allocation.
+ *
+ * Callables up to `kInlineSize` bytes which are nothrow move constructible are stored
+ * in an inline buffer, larger ones fall back to a single heap allocation. Unlike
+ * std::function, the callable doesn't need to be copy constructible.
+ *
+ * Example usage:
+ *  InlineFunction<int(int)> square([](int x) { return x * x; });
+ *  square(5); // Returns 25.
+ *
+ */
+template <typename R, typename... Args, size_t kInlineSize> class InlineFunction<R(Args...), kInlineSize>
+{
+    template <typename F>
+    using IsCallable = std::integral_constant<bool,
+                                              !std::is_same<InlineFunction, F>::value &&
+                                                  !std::is_same<std::nullptr_t, F>::value>;
+
+public:
+    InlineFunction(void)
+        : mOps(nullptr)
+    {
+    }
+
+    InlineFunction(std::nullptr_t)
+        : mOps(nullptr)
+    {
+    }
+
+    // Constructs a new `InlineFunction` instance with a callable.
+    template <typename F, typename = typename std::enable_if<IsCallable<typename std::decay<F>::type>::value>::type>
+    InlineFunction(F &&aFunc)
+        : mOps(nullptr)
+    {
+        Assign(std::forward<F>(aFunc));
+    }
+
+    InlineFunction(InlineFunction &&aOther) noexcept
+        : mOps(aOther.mOps)
+    {
+        if (mOps != nullptr)
+        {
+            mOps->mMove(&mStorage, &aOther.mStorage);
+            aOther.mOps = nullptr;
+        }
+    }
+
+    InlineFunction &operator=(InlineFunction &&aOther) noexcept
+    {
+        if (this != &aOther)
+        {
+            Reset();
+
+            if (aOther.mOps != nullptr)
+            {
+                mOps = aOther.mOps;
+                mOps->mMove(&mStorage, &aOther.mStorage);
+                aOther.mOps = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    InlineFunction &operator=(std::nullptr_t)
+    {
+        Reset();
+
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction &)            = delete;
+    InlineFunction &operator=(const InlineFunction &) = delete;
+
+    ~InlineFunction(void) { Reset(); }
+
+    R operator()(Args... aArgs)
+    {
+        assert(mOps != nullptr);
+
+        return mOps->mInvoke(&mStorage, std::forward<Args>(aArgs)...);
+    }
+
+    explicit operator bool(void) const { return mOps != nullptr; }
+
+    /**
+     * This method indicates whether a callable of type `F` is stored without heap allocation.
+     *
+     */
+    template <typename F> static constexpr bool IsStoredInline(void)
+    {
+        return sizeof(F) <= kInlineSize && alignof(F) <= alignof(Storage) &&
+               std::is_nothrow_move_constructible<F>::value;
+    }
+
+private:
+    typedef typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type Storage;
+
+    struct Ops
+    {
+        R (*mInvoke)(void *aStorage, Args &&...aArgs);
+        void (*mMove)(void *aDst, void *aSrc);
+        void (*mDestroy)(void *aStorage);
+    };
+
+    template <typename F> struct InlineOps
+    {
+        static R    Invoke(void *aStorage, Args &&...aArgs) { return (*Get(aStorage))(std::forward<Args>(aArgs)...); }
+        static void Move(void *aDst, void *aSrc)
+        {
+            ::new (aDst) F(std::move(*Get(aSrc)));
+            Get(aSrc)->~F();
+        }
+        static void Destroy(void *aStorage) { Get(aStorage)->~F(); }
+        static F   *Get(void *aStorage) { return static_cast<F *>(aStorage); }
+
+        static constexpr Ops kOps = {Invoke, Move, Destroy};
+    };
+
+    template <typename F> struct HeapOps
+    {
+        static R    Invoke(void *aStorage, Args &&...aArgs) { return (*Get(aStorage))(std::forward<Args>(aArgs)...); }
+        static void Move(void *aDst, void *aSrc) { new (aDst) F *(Get(aSrc)); }
+        static void Destroy(void *aStorage) { delete Get(aStorage); }
+        static F   *Get(void *aStorage) { return *static_cast<F **>(aStorage); }
+
+        static constexpr Ops kOps = {Invoke, Move, Destroy};
+    };
+
+    template <typename F> void Assign(F &&aFunc)
+    {
+        typedef typename std::decay<F>::type Func;
+
+        if (!IsNull(aFunc))
+        {
+            Emplace<Func>(std::forward<F>(aFunc), std::integral_constant<bool, IsStoredInline<Func>()>());
+        }
+    }
+
+    template <typename Func, typename F> void Emplace(F &&aFunc, std::true_type)
+    {
+        ::new (&mStorage) Func(std::forward<F>(aFunc));
+        mOps = &InlineOps<Func>::kOps;
+    }
+
+    template <typename Func, typename F> void Emplace(F &&aFunc, std::false_type)
+    {
+        new (&mStorage) Func *(new Func(std::forward<F>(aFunc)));
+        mOps = &HeapOps<Func>::kOps;
+    }
+
+    // Empty function pointers and std::function objects result in a null `InlineFunction`.
+    template <typename T> static bool IsNull(const std::function<T> &aFunc) { return !aFunc; }
+    template <typename T> static bool IsNull(T *aFunc) { return aFunc == nullptr; }
+    template <typename T> static bool IsNull(const T &) { return false; }
+
+    void Reset(void)
+    {
+        if (mOps != nullptr)
+        {
+            mOps->mDestroy(&mStorage);
+            mOps = nullptr;
+        }
+    }
+
+    Storage    mStorage;
+    const Ops *mOps;
+};
+
+template <typename R, typename... Args, size_t kInlineSize>
+template <typename F>
+constexpr typename InlineFunction<R(Args...), kInlineSize>::Ops
+    InlineFunction<R(Args...), kInlineSize>::InlineOps<F>::kOps;
+
+template <typename R, typename... Args, size_t kInlineSize>
+template <typename F>
+constexpr typename InlineFunction<R(Args...), kInlineSize>::Ops
+    InlineFunction<R(Args...), kInlineSize>::HeapOps<F>::kOps;
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_INLINE_FUNCTION_HPP_
@@ -32,6 +32,54 @@
 #define OTBR_SYSLOG_FACILITY_ID LOG_USER
 #endif
 
+/**
+ * The number of log records the asynchronous logging queue holds, must be a power of two.
+ *
+ */
+/**
+ * The maximum number of log tags with their own log level.
+ *
+ */
+#ifndef OTBR_LOG_MAX_TAG_LEVELS
+#define OTBR_LOG_MAX_TAG_LEVELS 16
+#endif
+
+#ifndef OTBR_LOG_ASYNC_QUEUE_SIZE
+#define OTBR_LOG_ASYNC_QUEUE_SIZE 256
+#endif
+
+/**
+ * The maximum length of a log record queued for asynchronous logging, longer messages are truncated.
+ *
+ */
+#ifndef OTBR_LOG_ASYNC_MAX_RECORD_LENGTH
+#define OTBR_LOG_ASYNC_MAX_RECORD_LENGTH 512
+#endif
+
+/**
+ * The maximum time (in milliseconds) a queued log record waits before it's written.
+ *
+ */
+#ifndef OTBR_LOG_ASYNC_FLUSH_INTERVAL
+#define OTBR_LOG_ASYNC_FLUSH_INTERVAL 20
+#endif
+
+/**
+ * The number of messages a rate-limited call site logs in a burst.
+ *
+ */
+#ifndef OTBR_LOG_RATE_LIMIT_BURST
+#define OTBR_LOG_RATE_LIMIT_BURST 10
+#endif
+
+/**
+ * The interval (in milliseconds) in which a rate-limited call site earns one more message to log.
+ *
+ */
+#ifndef OTBR_LOG_RATE_LIMIT_INTERVAL
+#define OTBR_LOG_RATE_LIMIT_INTERVAL 1000
+#endif
+
 #include "common/logging.hpp"
 
 #include <assert.h>
@@ -44,9 +92,21 @@
 #include <sys/time.h>
 #include <syslog.h>
 
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#if OTBR_ENABLE_LOG_ASYNC
+#include <condition_variable>
+#include <thread>
+#endif
 
 #include "common/code_utils.hpp"
+#if OTBR_ENABLE_LOG_BINARY
+#include "common/binary_log.hpp"
+#endif
+#if OTBR_ENABLE_LOG_ASYNC
+#include "common/mpsc_queue.hpp"
+#endif
 #include "common/time.hpp"
 
 static otbrLogLevel sLevel            = OTBR_LOG_INFO;
@@ -57,6 +117,260 @@ static bool sSyslogDisabled = false;
 
 static otbrLogLevel sDefaultLevel = OTBR_LOG_INFO;
 
+// Log prefix format : -xxx-----
+static constexpr uint8_t  kMaxTagSize   = 7;
+static constexpr uint8_t  kPrefixSize   = kMaxTagSize + 3;
+static constexpr uint16_t kMaxLogLength = 1024;
+
+struct TagLevel
+{
+    static constexpr uint8_t kMaxTagLength = 15;
+
+    char         mTag[kMaxTagLength + 1];
+    otbrLogLevel mLevel;
+};
+
+// The generation is in the upper 24 bits of the `otbrLogTagLevelCache`, 0 is never used so that a zero-initialized
+// cache is always resolved.
+static constexpr uint32_t kGenerationMask = 0xffffff;
+
+std::atomic<uint32_t> gOtbrLogLevelGeneration(1);
+
+static std::mutex        sTagLevelsMutex;
+static TagLevel          sTagLevels[OTBR_LOG_MAX_TAG_LEVELS];
+static uint8_t           sNumTagLevels = 0;
+static std::atomic<bool> sHasTagLevels(false);
+
+#if OTBR_ENABLE_LOG_BINARY
+static otbr::BinaryLogWriter sBinaryLog;
+#endif
+
+#if OTBR_ENABLE_LOG_ASYNC
+struct LogRecord
+{
+    otbrLogLevel mLevel;
+    char         mText[OTBR_LOG_ASYNC_MAX_RECORD_LENGTH];
+};
+
+static otbr::MpscQueue<LogRecord, OTBR_LOG_ASYNC_QUEUE_SIZE> sLogQueue;
+
+// The drain thread is allocated so that no joinable `std::thread` is destroyed when exiting without `otbrLogDeinit()`.
+static std::thread            *sDrainThread = nullptr;
+static std::atomic<bool>       sAsyncEnabled(false);
+static std::atomic<bool>       sDrainStopping(false);
+static std::atomic<uint32_t>   sPendingCount(0);
+static std::atomic<uint32_t>   sDroppedCount(0);
+static std::mutex              sDrainMutex;
+static std::condition_variable sDrainCondition;
+
+static void WriteLog(otbrLogLevel aLevel, const char *aText)
+{
+    if (sSyslogDisabled)
+    {
+        printf("%s\n", aText);
+    }
+    else
+    {
+        syslog(static_cast<int>(aLevel), "%s", aText);
+    }
+}
+
+static void DrainLogs(void)
+{
+    LogRecord record;
+    uint32_t  reportedDroppedCount = sDroppedCount.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        bool     stopping = sDrainStopping.load(std::memory_order_acquire);
+        uint32_t droppedCount;
+
+        // syslog has no batch API, so batching means writing all the records queued since the last wakeup in a row.
+        while (sLogQueue.TryPop(record))
+        {
+            sPendingCount.fetch_sub(1, std::memory_order_relaxed);
+            WriteLog(record.mLevel, record.mText);
+        }
+
+        droppedCount = sDroppedCount.load(std::memory_order_relaxed);
+        if (droppedCount != reportedDroppedCount)
+        {
+            char text[64];
+
+            snprintf(text, sizeof(text), "[WARN]-LOG-----: %u log messages dropped",
+                     static_cast<unsigned int>(droppedCount - reportedDroppedCount));
+            WriteLog(OTBR_LOG_WARNING, text);
+            reportedDroppedCount = droppedCount;
+        }
+
+        if (sSyslogDisabled)
+        {
+            fflush(stdout);
+        }
+
+        if (stopping)
+        {
+            break;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(sDrainMutex);
+
+            // Any wakeup, including a spurious one, just writes the queued records earlier.
+            if (!sDrainStopping.load(std::memory_order_acquire))
+            {
+                sDrainCondition.wait_for(lock, otbr::Milliseconds(OTBR_LOG_ASYNC_FLUSH_INTERVAL));
+            }
+        }
+    }
+}
+
+static void StopAsyncLogging(void)
+{
+    VerifyOrExit(sDrainThread != nullptr);
+
+    // Logs emitted from now on are written synchronously, the drain thread writes what's left in the queue.
+    sAsyncEnabled.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(sDrainMutex);
+
+        sDrainStopping.store(true, std::memory_order_release);
+    }
+    sDrainCondition.notify_one();
+    sDrainThread->join();
+
+    delete sDrainThread;
+    sDrainThread = nullptr;
+
+exit:
+    return;
+}
+
+static void StartAsyncLogging(void)
+{
+    static bool sAtExitRegistered = false;
+
+    VerifyOrExit(sDrainThread == nullptr);
+
+    if (!sAtExitRegistered)
+    {
+        // Flushes the queue when exiting without `otbrLogDeinit()`.
+        atexit(StopAsyncLogging);
+        sAtExitRegistered = true;
+    }
+
+    sDrainStopping.store(false, std::memory_order_relaxed);
+    sDrainThread = new std::thread(DrainLogs);
+    sAsyncEnabled.store(true, std::memory_order_release);
+
+exit:
+    return;
+}
+
+static bool PushLogRecord(LogRecord &aRecord)
+{
+    bool pushed = false;
+
+    VerifyOrExit(sAsyncEnabled.load(std::memory_order_acquire));
+
+    pushed = sLogQueue.TryPush(std::move(aRecord));
+    if (!pushed)
+    {
+        // The record is dropped instead of blocking the caller, the drain thread reports the dropped count.
+        sDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        sDrainCondition.notify_one();
+        pushed = true;
+        ExitNow();
+    }
+
+    // Only wakes up the drain thread early when the queue is half full, it otherwise wakes up periodically.
+    if (sPendingCount.fetch_add(1, std::memory_order_relaxed) + 1 == OTBR_LOG_ASYNC_QUEUE_SIZE / 2)
+    {
+        sDrainCondition.notify_one();
+    }
+
+exit:
+    return pushed;
+}
+#endif // OTBR_ENABLE_LOG_ASYNC
+
+/** Write log messages to a binary log file */
+otbrError otbrLogBinaryOpen(const char *aPath)
+{
+#if OTBR_ENABLE_LOG_BINARY
+    return sBinaryLog.Open(aPath);
+#else
+    OTBR_UNUSED_VARIABLE(aPath);
+
+    return OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+/** Take a token of the rate limiter of a call site, logging the number of messages suppressed since the last one */
+bool otbrLogAcquireRateLimit(otbrLogRateLimiter &aLimiter, otbrLogLevel aLevel, const char *aLogTag)
+{
+    static std::mutex sRateLimitMutex;
+    const int64_t     kInterval  = static_cast<int64_t>(OTBR_LOG_RATE_LIMIT_INTERVAL) * 1000;
+    int64_t           now        = otbr::Clock::now().time_since_epoch() / otbr::Microseconds(1);
+    bool              acquired   = false;
+    uint32_t          suppressed = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(sRateLimitMutex);
+
+        if (!aLimiter.mStarted)
+        {
+            aLimiter.mStarted    = true;
+            aLimiter.mTokens     = OTBR_LOG_RATE_LIMIT_BURST;
+            aLimiter.mRefillTime = now;
+        }
+        else if (now > aLimiter.mRefillTime)
+        {
+            int64_t refill = (now - aLimiter.mRefillTime) / kInterval;
+
+            if (aLimiter.mTokens + refill >= OTBR_LOG_RATE_LIMIT_BURST)
+            {
+                aLimiter.mTokens     = OTBR_LOG_RATE_LIMIT_BURST;
+                aLimiter.mRefillTime = now;
+            }
+            else
+            {
+                aLimiter.mTokens += static_cast<uint32_t>(refill);
+                aLimiter.mRefillTime += refill * kInterval;
+            }
+        }
+
+        if (aLimiter.mTokens > 0)
+        {
+            aLimiter.mTokens--;
+            suppressed           = aLimiter.mSuppressed;
+            aLimiter.mSuppressed = 0;
+            acquired             = true;
+        }
+        else
+        {
+            aLimiter.mSuppressed++;
+        }
+    }
+
+    if (suppressed > 0)
+    {
+        otbrLogNoFilter(aLevel, aLogTag, "%u similar messages suppressed", suppressed);
+    }
+
+    return acquired;
+}
+
+/** Get the number of log messages dropped because the asynchronous logging queue was full */
+uint32_t otbrLogGetDroppedCount(void)
+{
+#if OTBR_ENABLE_LOG_ASYNC
+    return sDroppedCount.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
@@ -69,13 +383,103 @@ otbrLogLevel otbrLogGetDefaultLevel(void)
     return sDefaultLevel;
 }
 
+// It must be called with `sTagLevelsMutex` locked.
+static void InvalidateCachedTagLevels(void)
+{
+    uint32_t generation = (gOtbrLogLevelGeneration.load(std::memory_order_relaxed) + 1) & kGenerationMask;
+
+    gOtbrLogLevelGeneration.store(generation == 0 ? 1 : generation, std::memory_order_relaxed);
+}
+
+// It must be called with `sTagLevelsMutex` locked.
+static TagLevel *FindTagLevel(const char *aLogTag)
+{
+    TagLevel *tagLevel = nullptr;
+
+    for (uint8_t i = 0; i < sNumTagLevels; i++)
+    {
+        if (strcmp(sTagLevels[i].mTag, aLogTag) == 0)
+        {
+            tagLevel = &sTagLevels[i];
+            break;
+        }
+    }
+
+    return tagLevel;
+}
+
 /**
  * Set current log level.
  */
 void otbrLogSetLevel(otbrLogLevel aLevel)
 {
+    std::lock_guard<std::mutex> lock(sTagLevelsMutex);
+
     assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
     sLevel = aLevel;
+    InvalidateCachedTagLevels();
+}
+
+/** Set the log level of a log tag */
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel)
+{
+    std::lock_guard<std::mutex> lock(sTagLevelsMutex);
+    otbrError                   error = OTBR_ERROR_NONE;
+    TagLevel                   *tagLevel;
+
+    VerifyOrExit(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(strlen(aLogTag) <= TagLevel::kMaxTagLength, error = OTBR_ERROR_INVALID_ARGS);
+
+    tagLevel = FindTagLevel(aLogTag);
+    if (tagLevel == nullptr)
+    {
+        VerifyOrExit(sNumTagLevels < OTBR_LOG_MAX_TAG_LEVELS, error = OTBR_ERROR_INVALID_STATE);
+        tagLevel = &sTagLevels[sNumTagLevels++];
+        strcpy(tagLevel->mTag, aLogTag);
+    }
+
+    tagLevel->mLevel = aLevel;
+    sHasTagLevels.store(true, std::memory_order_relaxed);
+    InvalidateCachedTagLevels();
+
+exit:
+    return error;
+}
+
+/** Clear the log levels of all log tags */
+void otbrLogClearTagLevels(void)
+{
+    std::lock_guard<std::mutex> lock(sTagLevelsMutex);
+
+    sNumTagLevels = 0;
+    sHasTagLevels.store(false, std::memory_order_relaxed);
+    InvalidateCachedTagLevels();
+}
+
+/** Get the log level of a log tag */
+otbrLogLevel otbrLogGetTagLevel(const char *aLogTag)
+{
+    otbrLogLevel level = sLevel;
+
+    if (sHasTagLevels.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(sTagLevelsMutex);
+        const TagLevel             *tagLevel = FindTagLevel(aLogTag);
+
+        level = (tagLevel != nullptr) ? tagLevel->mLevel : sLevel;
+    }
+
+    return level;
+}
+
+/** Get the log level of a log tag with the generation of the log levels */
+uint32_t otbrLogResolveTagLevel(const char *aLogTag)
+{
+    std::lock_guard<std::mutex> lock(sTagLevelsMutex);
+    const TagLevel             *tagLevel = FindTagLevel(aLogTag);
+    otbrLogLevel                level    = (tagLevel != nullptr) ? tagLevel->mLevel : sLevel;
+
+    return (gOtbrLogLevelGeneration.load(std::memory_order_relaxed) << 8) | static_cast<uint32_t>(level);
 }
 
 /** Enable/disable logging with syslog */
@@ -101,59 +505,106 @@ void otbrLogInit(const char *aProgramName, otbrLogLevel aLevel, bool aPrintStder
     {
         openlog(ident, (LOG_CONS | LOG_PID) | (aPrintStderr ? LOG_PERROR : 0), OTBR_SYSLOG_FACILITY_ID);
     }
-    sLevel        = aLevel;
+    otbrLogSetLevel(aLevel);
     sDefaultLevel = sLevel;
+
+#if OTBR_ENABLE_LOG_ASYNC
+    StartAsyncLogging();
+#endif
 }
 
-static const char *GetPrefix(const char *aLogTag)
+static const char *GetPrefix(const char *aLogTag, char (&aPrefix)[kPrefixSize])
 {
-    // Log prefix format : -xxx-----
-    const uint8_t kMaxTagSize = 7;
-    const uint8_t kBufferSize = kMaxTagSize + 3;
-    static char   prefix[kBufferSize];
-    uint8_t       tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
-    int           index     = 0;
+    uint8_t tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
+    int     index     = 0;
 
     if (strlen(aLogTag) > 0)
     {
-        prefix[0] = '-';
-        memcpy(&prefix[1], aLogTag, tagLength);
+        aPrefix[0] = '-';
+        memcpy(&aPrefix[1], aLogTag, tagLength);
 
         index = tagLength + 1;
 
-        memset(&prefix[index], '-', kMaxTagSize - tagLength + 1);
+        memset(&aPrefix[index], '-', kMaxTagSize - tagLength + 1);
         index += kMaxTagSize - tagLength + 1;
     }
 
-    prefix[index++] = '\0';
+    aPrefix[index++] = '\0';
 
-    return prefix;
+    return aPrefix;
 }
 
-/** log to the syslog or standard out */
-void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
+static void LogTagged(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgList)
 {
-    const uint16_t kBufferSize = 1024;
-    va_list        ap;
-    char           buffer[kBufferSize];
+    char prefix[kPrefixSize];
 
-    va_start(ap, aFormat);
+#if OTBR_ENABLE_LOG_BINARY
+    VerifyOrExit(!sBinaryLog.Log(aLevel, aLogTag, aFormat, aArgList));
+#endif
+
+#if OTBR_ENABLE_LOG_ASYNC
+    if (sAsyncEnabled.load(std::memory_order_relaxed))
+    {
+        LogRecord record;
+        int       length;
+
+        record.mLevel = aLevel;
+
+        length =
+            snprintf(record.mText, sizeof(record.mText), "%s%s: ", sLevelString[aLevel], GetPrefix(aLogTag, prefix));
+        VerifyOrExit(vsnprintf(record.mText + length, sizeof(record.mText) - length, aFormat, aArgList) > 0);
+
+        if (!PushLogRecord(record))
+        {
+            // The drain thread has just been stopped.
+            WriteLog(aLevel, record.mText);
+        }
+        ExitNow();
+    }
+#endif
 
-    if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
     {
+        char buffer[kMaxLogLength];
+
+        VerifyOrExit(vsnprintf(buffer, sizeof(buffer), aFormat, aArgList) > 0);
+
         if (sSyslogDisabled)
         {
-            printf("%s%s: %s\n", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+            printf("%s%s: %s\n", sLevelString[aLevel], GetPrefix(aLogTag, prefix), buffer);
         }
         else
         {
-            syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+            syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag, prefix), buffer);
         }
     }
 
+exit:
+    return;
+}
+
+/** log to the syslog or standard out */
+void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
+{
+    va_list ap;
+
+    va_start(ap, aFormat);
+
+    if (aLevel <= otbrLogGetTagLevel(aLogTag))
+    {
+        LogTagged(aLevel, aLogTag, aFormat, ap);
+    }
+
     va_end(ap);
+}
 
-    return;
+/** log to the syslog or standard out without checking the log level */
+void otbrLogNoFilter(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
+{
+    va_list ap;
+
+    va_start(ap, aFormat);
+    LogTagged(aLevel, aLogTag, aFormat, ap);
+    va_end(ap);
 }
 
 /** log to the syslog or standard out */
@@ -170,6 +621,30 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 /** log to the syslog or standard out */
 void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
+#if OTBR_ENABLE_LOG_BINARY
+    if (sBinaryLog.Log(aLevel, nullptr, aFormat, aArgList))
+    {
+        return;
+    }
+#endif
+
+#if OTBR_ENABLE_LOG_ASYNC
+    if (sAsyncEnabled.load(std::memory_order_relaxed))
+    {
+        LogRecord record;
+
+        record.mLevel = aLevel;
+        vsnprintf(record.mText, sizeof(record.mText), aFormat, aArgList);
+
+        if (!PushLogRecord(record))
+        {
+            // The drain thread has just been stopped.
+            WriteLog(aLevel, record.mText);
+        }
+        return;
+    }
+#endif
+
     if (sSyslogDisabled)
     {
         vprintf(aFormat, aArgList);
@@ -190,11 +665,18 @@ void otbrDump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, con
     const uint8_t *p8;
     int            addr;
 
-    if (aLevel >= sLevel)
+    if (aLevel > otbrLogGetTagLevel(aLogTag))
     {
         return;
     }
 
+#if OTBR_ENABLE_LOG_BINARY
+    if (sBinaryLog.Dump(aLevel, aLogTag, aPrefix, aMemory, aSize))
+    {
+        return;
+    }
+#endif
+
     /* break hex dumps into 16byte lines
      * In the form ADDR: XX XX XX XX ...
      */
@@ -295,5 +777,11 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+#if OTBR_ENABLE_LOG_ASYNC
+    StopAsyncLogging();
+#endif
+#if OTBR_ENABLE_LOG_BINARY
+    sBinaryLog.Close();
+#endif
     closelog();
 }
@@ -37,6 +37,9 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
 
 #ifndef OTBR_LOG_TAG
 #error "OTBR_LOG_TAG is not defined"
@@ -60,6 +63,33 @@ typedef enum
     OTBR_LOG_DEBUG,   ///< Debug level messages
 } otbrLogLevel;
 
+/**
+ * @def OTBR_LOG_LEVEL_MIN
+ *
+ * The least severe log level compiled in.
+ *
+ * The `otbrLogXxx()` macros of less severe levels are removed at compile time, including the evaluation of their
+ * arguments.
+ *
+ */
+#ifndef OTBR_LOG_LEVEL_MIN
+#define OTBR_LOG_LEVEL_MIN OTBR_LOG_DEBUG
+#endif
+
+/**
+ * This type caches the log level of a log tag, for a call site of the `otbrLogXxx()` macros.
+ *
+ */
+typedef std::atomic<uint32_t> otbrLogTagLevelCache;
+
+/**
+ * The generation of the log levels, it's changed whenever the global or a tag log level is changed.
+ *
+ * @note This variable is only for `otbrLogGetCachedTagLevel()`.
+ *
+ */
+extern std::atomic<uint32_t> gOtbrLogLevelGeneration;
+
 /**
  * Get current log level.
  */
@@ -75,6 +105,82 @@ otbrLogLevel otbrLogGetDefaultLevel(void);
  */
 void otbrLogSetLevel(otbrLogLevel aLevel);
 
+/**
+ * This function sets the log level of a log tag, which overrides the current log level for the messages of the tag.
+ *
+ * @param[in] aLogTag  The log tag, such as "MDNS".
+ * @param[in] aLevel   The log level of the tag.
+ *
+ * @retval OTBR_ERROR_NONE           Successfully set the log level of the tag.
+ * @retval OTBR_ERROR_INVALID_ARGS   The log tag is too long or the log level is invalid.
+ * @retval OTBR_ERROR_INVALID_STATE  There are too many log tags with a log level.
+ *
+ */
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel);
+
+/**
+ * This function clears the log levels of all log tags, so that all messages follow the current log level.
+ *
+ */
+void otbrLogClearTagLevels(void);
+
+/**
+ * This function returns the log level of a log tag.
+ *
+ * @param[in] aLogTag  The log tag.
+ *
+ * @returns The log level of the tag if set, otherwise the current log level.
+ *
+ */
+otbrLogLevel otbrLogGetTagLevel(const char *aLogTag);
+
+/**
+ * This function returns the log level of a log tag with the current generation of the log levels.
+ *
+ * @note This function is only for `otbrLogGetCachedTagLevel()`.
+ *
+ * @param[in] aLogTag  The log tag.
+ *
+ * @returns The generation in the upper 24 bits and the log level of the tag in the lowest 8 bits.
+ *
+ */
+uint32_t otbrLogResolveTagLevel(const char *aLogTag);
+
+/**
+ * This function returns the log level of a log tag, using the cache of a call site.
+ *
+ * @param[in] aCache   The cache of the call site.
+ * @param[in] aLogTag  The log tag.
+ *
+ * @returns The log level of the tag if set, otherwise the current log level.
+ *
+ */
+inline otbrLogLevel otbrLogGetCachedTagLevel(otbrLogTagLevelCache &aCache, const char *aLogTag)
+{
+    uint32_t state = aCache.load(std::memory_order_relaxed);
+
+    if ((state >> 8) != gOtbrLogLevelGeneration.load(std::memory_order_relaxed))
+    {
+        state = otbrLogResolveTagLevel(aLogTag);
+        aCache.store(state, std::memory_order_relaxed);
+    }
+
+    return static_cast<otbrLogLevel>(state & 0xff);
+}
+
+/**
+ * This function tells whether a log level is compiled in.
+ *
+ * @param[in] aLevel  The log level.
+ *
+ * @returns Whether @p aLevel is not less severe than `OTBR_LOG_LEVEL_MIN`.
+ *
+ */
+constexpr bool otbrLogIsLevelCompiled(otbrLogLevel aLevel)
+{
+    return aLevel <= OTBR_LOG_LEVEL_MIN;
+}
+
 /**
  * Control log to syslog.
  *
@@ -104,6 +210,16 @@ void otbrLogInit(const char *aProgramName, otbrLogLevel aLevel, bool aPrintStder
  */
 void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...);
 
+/**
+ * This function logs to the syslog or standard out without checking the log level.
+ *
+ * @param[in] aLevel   Log level of the logger.
+ * @param[in] aLogTag  Log tag.
+ * @param[in] aFormat  Format string as in printf.
+ *
+ */
+void otbrLogNoFilter(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...);
+
 /**
  * This function log at level @p aLevel.
  *
@@ -149,9 +265,67 @@ const char *otbrErrorString(otbrError aError);
 /**
  * This function deinitializes the logging service.
  *
+ * With asynchronous logging, the queued log messages are written before this function returns.
+ *
  */
 void otbrLogDeinit(void);
 
+/**
+ * This function starts writing the log messages to a binary log file instead of syslog or the standard output.
+ *
+ * The binary log file records the raw arguments of each log message, it's formatted by the `log-decoder` tool. The
+ * file is closed by `otbrLogDeinit()`.
+ *
+ * @param[in] aPath  The path of the binary log file, an existing file is truncated.
+ *
+ * @retval OTBR_ERROR_NONE             Successfully opened the binary log file.
+ * @retval OTBR_ERROR_ERRNO            Failed to open the binary log file.
+ * @retval OTBR_ERROR_INVALID_STATE    The binary log file is already open.
+ * @retval OTBR_ERROR_NOT_IMPLEMENTED  Binary logging isn't enabled in this build.
+ *
+ */
+otbrError otbrLogBinaryOpen(const char *aPath);
+
+/**
+ * This function returns the number of log messages dropped because the asynchronous logging queue was full.
+ *
+ * @returns The number of dropped log messages, always 0 without asynchronous logging.
+ *
+ */
+uint32_t otbrLogGetDroppedCount(void);
+
+/**
+ * This structure represents the token bucket of a rate-limited call site of the `otbrLogXxxRateLimited()` macros.
+ *
+ * A zero-initialized instance is full, it's only accessed by `otbrLogAcquireRateLimit()`.
+ *
+ */
+struct otbrLogRateLimiter
+{
+    bool     mStarted;
+    uint32_t mTokens;
+    uint32_t mSuppressed;
+    int64_t  mRefillTime; ///< The time (in microseconds) the tokens were refilled.
+};
+
+/**
+ * This function takes a token of the rate limiter of a call site.
+ *
+ * A call site logs up to `OTBR_LOG_RATE_LIMIT_BURST` messages at once, and earns one more message to log every
+ * `OTBR_LOG_RATE_LIMIT_INTERVAL` milliseconds. The number of messages suppressed meanwhile is logged before the next
+ * message of the call site.
+ *
+ * @note This function is only for `otbrLogRateLimited()`.
+ *
+ * @param[in] aLimiter  The rate limiter of the call site.
+ * @param[in] aLevel    The log level of the call site.
+ * @param[in] aLogTag   The log tag of the call site.
+ *
+ * @returns Whether the message of the call site is logged.
+ *
+ */
+bool otbrLogAcquireRateLimit(otbrLogRateLimiter &aLimiter, otbrLogLevel aLevel, const char *aLogTag);
+
 /**
  * This macro log an action result according to @p aError.
  *
@@ -163,14 +337,78 @@ void otbrLogDeinit(void);
  * @param[in] ...      Arguments for the format specification.
  *
  */
-#define otbrLogResult(aError, aFormat, ...)                                                               \
-    do                                                                                                    \
-    {                                                                                                     \
-        otbrError _err = (aError);                                                                        \
-        otbrLog(_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG, aFormat ": %s", \
-                ##__VA_ARGS__, otbrErrorString(_err));                                                    \
+#define otbrLogResult(aError, aFormat, ...)                                                 \
+    do                                                                                      \
+    {                                                                                       \
+        otbrError    _err   = (aError);                                                     \
+        otbrLogLevel _level = (_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING); \
+        otbrLogAtLevel(_level, aFormat ": %s", ##__VA_ARGS__, otbrErrorString(_err));       \
     } while (0)
 
+/**
+ * This macro returns the log level cache of the call site, a function local static is unique for each call site.
+ *
+ */
+#define OTBR_LOG_TAG_LEVEL_CACHE()          \
+    ([]() -> otbrLogTagLevelCache & {       \
+        static otbrLogTagLevelCache sCache; \
+        return sCache;                      \
+    }())
+
+/**
+ * This macro tells whether the logs at a level with the log tag `OTBR_LOG_TAG` are emitted.
+ *
+ * The log level is checked against `OTBR_LOG_LEVEL_MIN` at compile time, and against the log level of the tag at run
+ * time. This allows skipping the work only done for the logs, e.g. building the strings printed by several logs.
+ *
+ * @param[in] aLevel  The log level.
+ *
+ * @returns Whether the logs at @p aLevel are emitted.
+ *
+ */
+#define otbrLogIsEnabled(aLevel)       \
+    (otbrLogIsLevelCompiled(aLevel) && \
+     (aLevel) <= otbrLogGetCachedTagLevel(OTBR_LOG_TAG_LEVEL_CACHE(), OTBR_LOG_TAG))
+
+/**
+ * This macro logs at a level with the log tag `OTBR_LOG_TAG`.
+ *
+ * The log level is checked before the arguments are evaluated, so the arguments formatting the values to log, e.g.
+ * `Mdns::Publisher::AddressListToString()`, are only called when the log is emitted.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Format string and arguments for the format specification.
+ *
+ */
+#define otbrLogAtLevel(aLevel, ...) \
+    (otbrLogIsEnabled(aLevel) ? otbrLogNoFilter((aLevel), OTBR_LOG_TAG, __VA_ARGS__) : (void)0)
+
+/**
+ * This macro returns the rate limiter of the call site, a function local static is unique for each call site.
+ *
+ */
+#define OTBR_LOG_RATE_LIMITER()                 \
+    ([]() -> otbrLogRateLimiter & {             \
+        static otbrLogRateLimiter sRateLimiter; \
+        return sRateLimiter;                    \
+    }())
+
+/**
+ * This macro logs at a level with the log tag `OTBR_LOG_TAG`, at a limited rate for the call site.
+ *
+ * This is for the messages logged for each packet, request or peer, which would flood the log when there are bursts
+ * of them. The suppressed messages are counted, and the count is logged before the next message of the call site.
+ * As `otbrLogAtLevel()`, the arguments are only evaluated when the message is logged.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Format string and arguments for the format specification.
+ *
+ */
+#define otbrLogRateLimited(aLevel, ...)                                                                     \
+    ((otbrLogIsEnabled(aLevel) && otbrLogAcquireRateLimit(OTBR_LOG_RATE_LIMITER(), (aLevel), OTBR_LOG_TAG)) \
+         ? otbrLogNoFilter((aLevel), OTBR_LOG_TAG, __VA_ARGS__)                                             \
+         : (void)0)
+
 /**
  * @def otbrLogEmerg
  *
@@ -242,13 +480,53 @@ void otbrLogDeinit(void);
  * @param[in] ...  Arguments for the format specification.
  *
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogAtLevel(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogAtLevel(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogAtLevel(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogAtLevel(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogAtLevel(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogAtLevel(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogAtLevel(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogAtLevel(OTBR_LOG_DEBUG, __VA_ARGS__)
+
+/**
+ * @def otbrLogErrRateLimited
+ *
+ * Log at level error, at a limited rate for the call site.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+
+/**
+ * @def otbrLogWarningRateLimited
+ *
+ * Log at level warning, at a limited rate for the call site.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+
+/**
+ * @def otbrLogInfoRateLimited
+ *
+ * Log at level information, at a limited rate for the call site.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+
+/**
+ * @def otbrLogDebugRateLimited
+ *
+ * Log at level debug, at a limited rate for the call site.
+ *
+ * @param[in] ...  Arguments for the format specification.
+ *
+ */
+#define otbrLogErrRateLimited(...) otbrLogRateLimited(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarningRateLimited(...) otbrLogRateLimited(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogInfoRateLimited(...) otbrLogRateLimited(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebugRateLimited(...) otbrLogRateLimited(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 #endif // OTBR_COMMON_LOGGING_HPP_
@@ -31,7 +31,8 @@
 
 namespace otbr {
 
-MainloopProcessor::MainloopProcessor(void)
+MainloopProcessor::MainloopProcessor(Priority aPriority)
+    : mPriority(aPriority)
 {
     MainloopManager::GetInstance().AddMainloopProcessor(this);
 }
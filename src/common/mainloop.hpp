@@ -36,6 +36,8 @@
 
 #include <openthread-br/config.h>
 
+#include <stdint.h>
+
 #include <openthread/openthread-system.h>
 
 namespace otbr {
@@ -46,6 +48,10 @@ namespace otbr {
  */
 using MainloopContext = otSysMainloopContext;
 
+#if OTBR_ENABLE_MAINLOOP_STATS
+struct MainloopProcessorStats;
+#endif
+
 /**
  * This abstract class defines the interface of a mainloop processor
  * which adds fds to the mainloop context and handles fds events.
@@ -54,7 +60,24 @@ using MainloopContext = otSysMainloopContext;
 class MainloopProcessor
 {
 public:
-    MainloopProcessor(void);
+    /**
+     * This enumeration defines the priorities of mainloop processors.
+     *
+     */
+    enum Priority : uint8_t
+    {
+        kPriorityThreadStack = 0, ///< The Thread stack, processed before the registered fds and other processors.
+        kPriorityDefault     = 1, ///< The management processors, e.g. REST and D-Bus.
+        kPriorityMdns        = 2, ///< The mDNS publisher, processed after the management processors.
+    };
+
+    /**
+     * The constructor to register the mainloop processor to the mainloop manager.
+     *
+     * @param[in] aPriority  The priority of the mainloop processor.
+     *
+     */
+    explicit MainloopProcessor(Priority aPriority = kPriorityDefault);
 
     virtual ~MainloopProcessor(void);
 
@@ -73,6 +96,34 @@ public:
      *
      */
     virtual void Process(const MainloopContext &aMainloop) = 0;
+
+    /**
+     * This method returns the name of the mainloop processor.
+     *
+     * The name is used to account the mainloop statistics, processors with the same name are accounted together.
+     *
+     * @returns The name of the mainloop processor.
+     *
+     */
+    virtual const char *GetName(void) const { return "MainloopProcessor"; }
+
+    /**
+     * This method returns the priority of the mainloop processor.
+     *
+     * @returns The priority of the mainloop processor.
+     *
+     */
+    Priority GetPriority(void) const { return mPriority; }
+
+private:
+    friend class MainloopManager;
+
+    Priority mPriority;
+#if OTBR_ENABLE_MAINLOOP_STATS
+    // The statistics accounted to the name of this processor, which the mainloop manager looks up on first use.
+    MainloopProcessorStats *mStats           = nullptr;
+    uint32_t                mStatsGeneration = 0;
+#endif
 };
 
 } // namespace otbr
@@ -25,16 +25,92 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
-#include <assert.h>
+
+#define OTBR_LOG_TAG "MAINLOOP"
 
 #include "common/mainloop_manager.hpp"
 
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+#include <sched.h>
+#include <signal.h>
+
+#include <functional>
+#endif
+
+#if OTBR_MAINLOOP_USE_EPOLL
+#include <sys/epoll.h>
+#elif OTBR_MAINLOOP_USE_KQUEUE
+#include <sys/event.h>
+#endif
+
 namespace otbr {
 
+#if OTBR_MAINLOOP_USE_EPOLL || OTBR_MAINLOOP_USE_KQUEUE
+// The max number of registered fd events fetched from the poll backend in one iteration.
+static constexpr int kMaxPollEvents = 64;
+#endif
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+// The max time a worker thread waits for events, the processors on the thread shorten it as needed.
+static const struct timeval kWorkerThreadPollTimeout = {10, 0};
+#endif
+
+MainloopManager::MainloopManager(void)
+{
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    pthread_mutexattr_t attr;
+
+    // The radio thread must not wait for a lower priority thread which is preempted while holding the lock.
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    VerifyOrDie(pthread_mutex_init(&mStackLock, &attr) == 0, "Failed to initialize the stack lock");
+    pthread_mutexattr_destroy(&attr);
+#endif
+
+#if OTBR_MAINLOOP_USE_EPOLL
+    mPollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(mPollFd != -1, strerror(errno));
+#elif OTBR_MAINLOOP_USE_KQUEUE
+    mPollFd = kqueue();
+    VerifyOrDie(mPollFd != -1, strerror(errno));
+#endif
+}
+
+MainloopManager::~MainloopManager(void)
+{
+#if OTBR_MAINLOOP_USE_EPOLL || OTBR_MAINLOOP_USE_KQUEUE
+    if (mPollFd != -1)
+    {
+        close(mPollFd);
+        mPollFd = -1;
+    }
+#endif
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    pthread_mutex_destroy(&mStackLock);
+#endif
+}
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
+    auto it = mMainloopProcessorList.begin();
+
     assert(aMainloopProcessor != nullptr);
-    mMainloopProcessorList.emplace_back(aMainloopProcessor);
+
+    // The processors are kept sorted by priority, and by the order of addition within a priority.
+    while (it != mMainloopProcessorList.end() && (*it)->GetPriority() <= aMainloopProcessor->GetPriority())
+    {
+        ++it;
+    }
+
+    mMainloopProcessorList.insert(it, aMainloopProcessor);
 }
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
@@ -44,17 +120,862 @@ void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProces
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
+    // The timeouts of all the processors are computed from the same time.
+    MainloopClock::Refresh();
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    UpdateWithStats(aMainloop);
+#else
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
-        mainloopProcessor->Update(aMainloop);
+        if (!IsOnWorkerThread(mainloopProcessor->GetPriority()))
+        {
+            mainloopProcessor->Update(aMainloop);
+        }
+    }
+#endif
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    for (const WorkerThread &worker : mWorkerThreads)
+    {
+        if (worker.mRunning)
+        {
+            FD_SET(worker.mMainWakeFds[kRead], &aMainloop.mReadFdSet);
+            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, worker.mMainWakeFds[kRead]);
+        }
     }
+#endif
+
+#if OTBR_MAINLOOP_USE_EPOLL || OTBR_MAINLOOP_USE_KQUEUE
+    if (!mFdEntries.empty())
+    {
+        FD_SET(mPollFd, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mPollFd);
+    }
+#else
+    for (const auto &entry : mFdEntries)
+    {
+        int fd = entry.first;
+
+        if (entry.second.mEvents & kEventReadable)
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+        if (entry.second.mEvents & kEventWritable)
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+        if (entry.second.mEvents != 0)
+        {
+            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        }
+    }
+#endif
+
+    MainloopClock::Reset();
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
+{
+    MainloopClock::Refresh();
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    CountReadyFds(aMainloop);
+#endif
+
+    // The Thread stack goes first so that the radio frames and the tasklets are not delayed by the management
+    // processors and the handlers of the registered fds.
+    if (!IsOnWorkerThread(MainloopProcessor::kPriorityThreadStack))
+    {
+        ProcessProcessors(aMainloop, MainloopProcessor::kPriorityThreadStack);
+    }
+    DispatchFdEvents();
+    ProcessProcessors(aMainloop, MainloopProcessor::kPriorityDefault);
+    if (!IsOnWorkerThread(MainloopProcessor::kPriorityMdns))
+    {
+        ProcessProcessors(aMainloop, MainloopProcessor::kPriorityMdns);
+    }
+
+    MainloopClock::Reset();
+}
+
+void MainloopManager::ProcessProcessors(const MainloopContext &aMainloop, MainloopProcessor::Priority aPriority)
 {
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
+        if (mainloopProcessor->GetPriority() != aPriority)
+        {
+            continue;
+        }
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+        {
+            MainloopProcessorStats &stats = GetStats(*mainloopProcessor);
+            Timepoint               start = Clock::now();
+
+            mainloopProcessor->Process(aMainloop);
+            stats.mProcessDuration.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+        }
+#else
         mainloopProcessor->Process(aMainloop);
+#endif
+
+        if (aPriority != MainloopProcessor::kPriorityThreadStack)
+        {
+            YieldToWorkerThreads();
+        }
+    }
+}
+
+void MainloopManager::AddFd(int aFd, uint8_t aEvents, FdEventHandler aHandler, const char *aName)
+{
+    assert(aFd >= 0);
+    assert(aHandler != nullptr);
+#if !OTBR_MAINLOOP_USE_EPOLL && !OTBR_MAINLOOP_USE_KQUEUE
+    VerifyOrDie(aFd < FD_SETSIZE, "fd exceeds FD_SETSIZE");
+#endif
+
+    auto it = mFdEntries.find(aFd);
+
+    if (it != mFdEntries.end())
+    {
+        // Re-registering an fd replaces its handler and events.
+        it->second.mHandler = std::move(aHandler);
+        it->second.mName    = aName;
+#if OTBR_ENABLE_MAINLOOP_STATS
+        it->second.mStatsGeneration = 0;
+#endif
+        UpdateFd(aFd, aEvents);
+        ExitNow();
+    }
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    mFdEntries.emplace(aFd, FdEntry{0, std::move(aHandler), aName, nullptr, 0});
+#else
+    mFdEntries.emplace(aFd, FdEntry{0, std::move(aHandler), aName});
+#endif
+    UpdateFd(aFd, aEvents);
+
+exit:
+    return;
+}
+
+void MainloopManager::UpdateFd(int aFd, uint8_t aEvents)
+{
+    auto it = mFdEntries.find(aFd);
+
+    VerifyOrExit(it != mFdEntries.end());
+    VerifyOrExit(it->second.mEvents != aEvents);
+
+    ArmFd(aFd, it->second.mEvents, aEvents);
+    it->second.mEvents = aEvents;
+
+exit:
+    return;
+}
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    auto it = mFdEntries.find(aFd);
+
+    VerifyOrExit(it != mFdEntries.end());
+
+    ArmFd(aFd, it->second.mEvents, 0);
+    mFdEntries.erase(it);
+
+exit:
+    return;
+}
+
+#if OTBR_MAINLOOP_USE_EPOLL
+void MainloopManager::ArmFd(int aFd, uint8_t aOldEvents, uint8_t aNewEvents)
+{
+    struct epoll_event event;
+    int                op;
+
+    // A disarmed fd is removed from the epoll set, otherwise a hang-up would be reported on every
+    // iteration because EPOLLHUP and EPOLLERR can't be masked.
+    if (aNewEvents == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+    else
+    {
+        op = (aOldEvents == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.data.fd = aFd;
+
+    if (aNewEvents & kEventReadable)
+    {
+        event.events |= EPOLLIN;
+    }
+    if (aNewEvents & kEventWritable)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    if (epoll_ctl(mPollFd, op, aFd, &event) == -1)
+    {
+        otbrLogWarning("Failed to update fd %d in epoll: %s", aFd, strerror(errno));
+    }
+}
+#elif OTBR_MAINLOOP_USE_KQUEUE
+void MainloopManager::ArmFd(int aFd, uint8_t aOldEvents, uint8_t aNewEvents)
+{
+    struct kevent changes[2];
+    int           count   = 0;
+    uint8_t       changed = aOldEvents ^ aNewEvents;
+
+    if (changed & kEventReadable)
+    {
+        EV_SET(&changes[count++], aFd, EVFILT_READ, (aNewEvents & kEventReadable) ? EV_ADD : EV_DELETE, 0, 0,
+               nullptr);
+    }
+    if (changed & kEventWritable)
+    {
+        EV_SET(&changes[count++], aFd, EVFILT_WRITE, (aNewEvents & kEventWritable) ? EV_ADD : EV_DELETE, 0, 0,
+               nullptr);
+    }
+
+    if (count > 0 && kevent(mPollFd, changes, count, nullptr, 0, nullptr) == -1)
+    {
+        otbrLogWarning("Failed to update fd %d in kqueue: %s", aFd, strerror(errno));
+    }
+}
+#else
+void MainloopManager::ArmFd(int aFd, uint8_t aOldEvents, uint8_t aNewEvents)
+{
+    // The select() backend re-adds the registered fds to the fd sets in every `Update()`.
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aOldEvents);
+    OTBR_UNUSED_VARIABLE(aNewEvents);
+}
+#endif
+
+int MainloopManager::Poll(MainloopContext &aMainloop)
+{
+    int rval;
+
+    mReadyFds.clear();
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    if (IsAnyWorkerRunning())
+    {
+        // The previous iteration may have started tasklets or timers of the Thread stack, or mDNS requests.
+        for (const WorkerThread &worker : mWorkerThreads)
+        {
+            if (mWakeWorkerThreads && worker.mRunning)
+            {
+                Wake(worker.mWakeFds[kWrite]);
+            }
+        }
+        pthread_mutex_unlock(&mStackLock);
+    }
+#endif
+
+    rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                  &aMainloop.mTimeout);
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    if (IsAnyWorkerRunning())
+    {
+        int  selectErrno = errno;
+        bool wokenUp     = false;
+
+        pthread_mutex_lock(&mStackLock);
+        errno = selectErrno;
+
+        for (const WorkerThread &worker : mWorkerThreads)
+        {
+            if (rval > 0 && worker.mRunning && FD_ISSET(worker.mMainWakeFds[kRead], &aMainloop.mReadFdSet))
+            {
+                DrainWake(worker.mMainWakeFds[kRead]);
+                FD_CLR(worker.mMainWakeFds[kRead], &aMainloop.mReadFdSet);
+                --rval;
+                wokenUp = true;
+            }
+        }
+
+        // The worker threads needn't be woken up if nothing but them woke this thread up, otherwise the threads
+        // would keep waking each other up.
+        mWakeWorkerThreads = !wokenUp || rval > 0;
+    }
+#endif
+
+    VerifyOrExit(rval > 0);
+
+#if OTBR_MAINLOOP_USE_EPOLL
+    if (!mFdEntries.empty() && FD_ISSET(mPollFd, &aMainloop.mReadFdSet))
+    {
+        struct epoll_event events[kMaxPollEvents];
+        int                count;
+
+        FD_CLR(mPollFd, &aMainloop.mReadFdSet);
+        --rval;
+
+        count = epoll_wait(mPollFd, events, kMaxPollEvents, 0);
+
+        for (int i = 0; i < count; i++)
+        {
+            uint8_t ready = 0;
+
+            if (events[i].events & (EPOLLIN | EPOLLHUP))
+            {
+                ready |= kEventReadable;
+            }
+            if (events[i].events & EPOLLOUT)
+            {
+                ready |= kEventWritable;
+            }
+            if (events[i].events & (EPOLLERR | EPOLLHUP))
+            {
+                ready |= kEventError;
+            }
+
+            mReadyFds.push_back({events[i].data.fd, ready});
+        }
+
+        rval += std::max(count, 0);
+    }
+#elif OTBR_MAINLOOP_USE_KQUEUE
+    if (!mFdEntries.empty() && FD_ISSET(mPollFd, &aMainloop.mReadFdSet))
+    {
+        struct kevent   events[kMaxPollEvents];
+        struct timespec zero = {0, 0};
+        int             count;
+
+        FD_CLR(mPollFd, &aMainloop.mReadFdSet);
+        --rval;
+
+        count = kevent(mPollFd, nullptr, 0, events, kMaxPollEvents, &zero);
+
+        for (int i = 0; i < count; i++)
+        {
+            uint8_t ready = (events[i].filter == EVFILT_WRITE) ? kEventWritable : kEventReadable;
+
+            if (events[i].flags & (EV_EOF | EV_ERROR))
+            {
+                ready |= kEventError;
+            }
+
+            mReadyFds.push_back({static_cast<int>(events[i].ident), ready});
+        }
+
+        rval += std::max(count, 0);
+    }
+#else
+    for (const auto &entry : mFdEntries)
+    {
+        int     fd    = entry.first;
+        uint8_t ready = 0;
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            ready |= kEventReadable;
+        }
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            ready |= kEventWritable;
+        }
+
+        if (ready != 0)
+        {
+            mReadyFds.push_back({fd, ready});
+        }
+    }
+#endif
+
+exit:
+    return rval;
+}
+
+void MainloopManager::DispatchFdEvents(void)
+{
+    for (const ReadyFd &readyFd : mReadyFds)
+    {
+        auto           it = mFdEntries.find(readyFd.mFd);
+        FdEventHandler handler;
+
+        // The fd may have been removed or disarmed by a handler invoked before.
+        if (it == mFdEntries.end() || it->second.mEvents == 0)
+        {
+            continue;
+        }
+
+        // A copy is used because the handler may remove the fd itself.
+        handler = it->second.mHandler;
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+        {
+            MainloopProcessorStats &stats = GetStats(it->second.mStats, it->second.mStatsGeneration, it->second.mName);
+            Timepoint               start = Clock::now();
+
+            handler(readyFd.mEvents & (it->second.mEvents | kEventError));
+
+            stats.mProcessDuration.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+            ++stats.mReadyFdCount;
+        }
+#else
+        handler(readyFd.mEvents & (it->second.mEvents | kEventError));
+#endif
+
+        YieldToWorkerThreads();
+    }
+
+    mReadyFds.clear();
+}
+
+#if OTBR_ENABLE_RADIO_THREAD
+otbrError MainloopManager::StartRadioThread(int aPriority, int aCpu)
+{
+    otbrError error = StartWorkerThread(mWorkerThreads[kRadioWorker], aPriority, aCpu);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("The Thread stack is processed on the radio thread");
+    }
+
+    return error;
+}
+
+void MainloopManager::StopRadioThread(void)
+{
+    VerifyOrExit(mWorkerThreads[kRadioWorker].mRunning);
+
+    StopWorkerThread(mWorkerThreads[kRadioWorker]);
+    otbrLogInfo("The Thread stack is processed on the mainloop again");
+
+exit:
+    return;
+}
+#endif // OTBR_ENABLE_RADIO_THREAD
+
+#if OTBR_ENABLE_MDNS_THREAD
+otbrError MainloopManager::StartMdnsThread(void)
+{
+    otbrError error = StartWorkerThread(mWorkerThreads[kMdnsWorker], /* aSchedPriority */ 0, /* aCpu */ -1);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("The mDNS publisher is processed on the mDNS thread");
+    }
+
+    return error;
+}
+
+void MainloopManager::StopMdnsThread(void)
+{
+    VerifyOrExit(mWorkerThreads[kMdnsWorker].mRunning);
+
+    StopWorkerThread(mWorkerThreads[kMdnsWorker]);
+    otbrLogInfo("The mDNS publisher is processed on the mainloop again");
+
+exit:
+    return;
+}
+#endif // OTBR_ENABLE_MDNS_THREAD
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+bool MainloopManager::IsOnWorkerThread(MainloopProcessor::Priority aPriority) const
+{
+    bool onWorkerThread = false;
+
+    for (const WorkerThread &worker : mWorkerThreads)
+    {
+        if (worker.mRunning && worker.mPriority == aPriority)
+        {
+            onWorkerThread = true;
+            break;
+        }
+    }
+
+    return onWorkerThread;
+}
+
+bool MainloopManager::IsAnyWorkerRunning(void) const
+{
+    bool running = false;
+
+    for (const WorkerThread &worker : mWorkerThreads)
+    {
+        running = running || worker.mRunning;
+    }
+
+    return running;
+}
+
+otbrError MainloopManager::StartWorkerThread(WorkerThread &aWorker, int aSchedPriority, int aCpu)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // The pipes of a running worker thread are kept, so that it can still be woken up and stopped.
+    VerifyOrExit(!aWorker.mRunning, error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = OpenWakeFds(aWorker));
+
+    aWorker.mSchedPriority = aSchedPriority;
+    aWorker.mCpu           = aCpu;
+    aWorker.mStopping      = false;
+
+    // This thread holds the lock from the first worker thread on, except while it waits for events.
+    if (!IsAnyWorkerRunning())
+    {
+        pthread_mutex_lock(&mStackLock);
+        mWakeWorkerThreads = false;
+    }
+    aWorker.mRunning = true;
+    aWorker.mThread  = std::thread(&MainloopManager::RunWorkerThread, this, std::ref(aWorker));
+
+exit:
+    return error;
+}
+
+otbrError MainloopManager::OpenWakeFds(WorkerThread &aWorker)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(pipe(aWorker.mWakeFds) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(pipe(aWorker.mMainWakeFds) == 0, error = OTBR_ERROR_ERRNO);
+    for (int fd : {aWorker.mWakeFds[kRead], aWorker.mWakeFds[kWrite], aWorker.mMainWakeFds[kRead],
+                   aWorker.mMainWakeFds[kWrite]})
+    {
+        VerifyOrExit(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) != -1, error = OTBR_ERROR_ERRNO);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        int savedErrno = errno;
+
+        CloseWakeFds(aWorker);
+        errno = savedErrno;
+    }
+
+    return error;
+}
+
+void MainloopManager::StopWorkerThread(WorkerThread &aWorker)
+{
+    aWorker.mStopping = true;
+    Wake(aWorker.mWakeFds[kWrite]);
+    pthread_mutex_unlock(&mStackLock);
+
+    aWorker.mThread.join();
+
+    // The other worker threads still exclude this thread, and may read the state of this worker thread.
+    for (const WorkerThread &worker : mWorkerThreads)
+    {
+        if (&worker != &aWorker && worker.mRunning)
+        {
+            pthread_mutex_lock(&mStackLock);
+            break;
+        }
+    }
+
+    aWorker.mRunning = false;
+    CloseWakeFds(aWorker);
+}
+
+void MainloopManager::CloseWakeFds(WorkerThread &aWorker)
+{
+    for (int *fds : {aWorker.mWakeFds, aWorker.mMainWakeFds})
+    {
+        for (int i : {kRead, kWrite})
+        {
+            if (fds[i] != -1)
+            {
+                close(fds[i]);
+                fds[i] = -1;
+            }
+        }
+    }
+}
+
+void MainloopManager::YieldToWorkerThreads(void)
+{
+    VerifyOrExit(IsAnyWorkerRunning());
+
+    // A waiting radio thread is handed the lock over by the priority inheritance protocol.
+    pthread_mutex_unlock(&mStackLock);
+    pthread_mutex_lock(&mStackLock);
+
+    // The worker threads may have run meanwhile.
+    MainloopClock::Refresh();
+
+exit:
+    return;
+}
+
+void MainloopManager::SetWorkerThreadScheduling(const WorkerThread &aWorker)
+{
+    if (aWorker.mSchedPriority > 0)
+    {
+        struct sched_param param;
+        int                error;
+
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = aWorker.mSchedPriority;
+
+        error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (error != 0)
+        {
+            otbrLogWarning("Failed to set SCHED_FIFO priority %d of the %s thread: %s", aWorker.mSchedPriority,
+                           aWorker.mName, strerror(error));
+        }
+    }
+
+    if (aWorker.mCpu >= 0)
+    {
+#if defined(__linux__)
+        cpu_set_t cpus;
+        int       error = EINVAL;
+
+        CPU_ZERO(&cpus);
+        if (aWorker.mCpu < CPU_SETSIZE)
+        {
+            CPU_SET(aWorker.mCpu, &cpus);
+            error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        }
+
+        if (error != 0)
+        {
+            otbrLogWarning("Failed to pin the %s thread to CPU %d: %s", aWorker.mName, aWorker.mCpu, strerror(error));
+        }
+#else
+        otbrLogWarning("Pinning the %s thread to a CPU is not supported on this platform", aWorker.mName);
+#endif
+    }
+}
+
+void MainloopManager::RunWorkerThread(WorkerThread &aWorker)
+{
+    sigset_t signals;
+
+    // The signals are handled by the thread running `Poll()`, so that they interrupt its wait.
+    sigfillset(&signals);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    SetWorkerThreadScheduling(aWorker);
+
+    pthread_mutex_lock(&mStackLock);
+
+    while (!aWorker.mStopping)
+    {
+        MainloopContext mainloop;
+        int             rval;
+
+        mainloop.mMaxFd   = aWorker.mWakeFds[kRead];
+        mainloop.mTimeout = kWorkerThreadPollTimeout;
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+        FD_SET(aWorker.mWakeFds[kRead], &mainloop.mReadFdSet);
+
+        MainloopClock::Refresh();
+        for (auto &mainloopProcessor : mMainloopProcessorList)
+        {
+            if (mainloopProcessor->GetPriority() == aWorker.mPriority)
+            {
+                mainloopProcessor->Update(mainloop);
+            }
+        }
+        MainloopClock::Reset();
+
+        pthread_mutex_unlock(&mStackLock);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        pthread_mutex_lock(&mStackLock);
+
+        if (rval < 0)
+        {
+            if (errno != EINTR)
+            {
+                otbrLogWarning("The %s thread poll failed: %s", aWorker.mName, strerror(errno));
+            }
+            continue;
+        }
+
+        if (FD_ISSET(aWorker.mWakeFds[kRead], &mainloop.mReadFdSet))
+        {
+            DrainWake(aWorker.mWakeFds[kRead]);
+            FD_CLR(aWorker.mWakeFds[kRead], &mainloop.mReadFdSet);
+            --rval;
+        }
+
+        VerifyOrExit(!aWorker.mStopping);
+
+        MainloopClock::Refresh();
+        ProcessProcessors(mainloop, aWorker.mPriority);
+        MainloopClock::Reset();
+
+        // The callbacks may have changed the state of the processors on the other threads. The Thread stack runs its
+        // tasklets and timers in every iteration, the other processors only act on ready fds, so that the threads
+        // don't keep waking each other up.
+        if (aWorker.mPriority == MainloopProcessor::kPriorityThreadStack || rval > 0)
+        {
+            WakeOtherThreads(aWorker);
+        }
+    }
+
+exit:
+    pthread_mutex_unlock(&mStackLock);
+}
+
+void MainloopManager::WakeOtherThreads(const WorkerThread &aWorker)
+{
+    Wake(aWorker.mMainWakeFds[kWrite]);
+
+    for (const WorkerThread &worker : mWorkerThreads)
+    {
+        if (&worker != &aWorker && worker.mRunning)
+        {
+            Wake(worker.mWakeFds[kWrite]);
+        }
+    }
+}
+
+void MainloopManager::Wake(int aFd)
+{
+    const uint8_t kWakeByte = 1;
+
+    // The pipe is full only if the thread is already to be woken up.
+    if (write(aFd, &kWakeByte, sizeof(kWakeByte)) == -1 && errno != EAGAIN)
+    {
+        otbrLogWarning("Failed to wake up the thread: %s", strerror(errno));
+    }
+}
+
+void MainloopManager::DrainWake(int aFd)
+{
+    uint8_t buffer[64];
+
+    while (read(aFd, buffer, sizeof(buffer)) > 0)
+    {
+    }
+}
+#endif // OTBR_MAINLOOP_USE_WORKER_THREADS
+
+void MainloopHistogram::Record(Microseconds aDuration)
+{
+    uint64_t duration = static_cast<uint64_t>(std::max(aDuration.count(), Microseconds::rep{0}));
+    uint8_t  bucket   = 0;
+
+    while (bucket < kNumBuckets - 1 && (duration >> (bucket + 1)) != 0)
+    {
+        ++bucket;
+    }
+
+    ++mBuckets[bucket];
+    ++mCount;
+    mSum += duration;
+    mMax = std::max(mMax, duration);
+}
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+void MainloopManager::RecordProcessDuration(const char *aName, Microseconds aDuration)
+{
+    mProcessorStats[aName].mProcessDuration.Record(aDuration);
+}
+
+void MainloopManager::ResetStats(void)
+{
+    mProcessorFds.clear();
+    mProcessorStats.clear();
+    mIterationCount = 0;
+
+    // The entries referred to by the processors and the fds are looked up again.
+    if (++mStatsGeneration == 0)
+    {
+        mStatsGeneration = 1;
+    }
+}
+
+MainloopProcessorStats &MainloopManager::GetStats(MainloopProcessorStats *&aStats,
+                                                  uint32_t                &aGeneration,
+                                                  const char              *aName)
+{
+    // The entry is only looked up by its name once, and again after the statistics are reset.
+    if (aGeneration != mStatsGeneration)
+    {
+        aStats      = &mProcessorStats[aName];
+        aGeneration = mStatsGeneration;
+    }
+
+    return *aStats;
+}
+
+void MainloopManager::UpdateWithStats(MainloopContext &aMainloop)
+{
+    ++mIterationCount;
+    mProcessorFds.clear();
+
+    mInitialFds.mStats      = nullptr;
+    mInitialFds.mReadFdSet  = aMainloop.mReadFdSet;
+    mInitialFds.mWriteFdSet = aMainloop.mWriteFdSet;
+    mInitialFds.mErrorFdSet = aMainloop.mErrorFdSet;
+
+    for (auto &mainloopProcessor : mMainloopProcessorList)
+    {
+        ProcessorFds fds;
+        timeval      timeout = aMainloop.mTimeout;
+        Timepoint    start;
+
+        if (IsOnWorkerThread(mainloopProcessor->GetPriority()))
+        {
+            continue;
+        }
+
+        fds.mStats = &GetStats(*mainloopProcessor);
+
+        start = Clock::now();
+        mainloopProcessor->Update(aMainloop);
+        fds.mStats->mUpdateDuration.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+
+        if (timercmp(&aMainloop.mTimeout, &timeout, <))
+        {
+            ++fds.mStats->mTimeoutShortenedCount;
+            fds.mStats->mTimeout.Record(FromTimeval<Microseconds>(aMainloop.mTimeout));
+        }
+
+        // The fds added by each processor are only told apart once some of them are ready.
+        fds.mReadFdSet  = aMainloop.mReadFdSet;
+        fds.mWriteFdSet = aMainloop.mWriteFdSet;
+        fds.mErrorFdSet = aMainloop.mErrorFdSet;
+        mProcessorFds.push_back(fds);
+    }
+}
+
+void MainloopManager::CountReadyFds(const MainloopContext &aMainloop)
+{
+    for (int fd = 0; fd <= aMainloop.mMaxFd && !mProcessorFds.empty(); ++fd)
+    {
+        bool                readable = FD_ISSET(fd, &aMainloop.mReadFdSet);
+        bool                writable = FD_ISSET(fd, &aMainloop.mWriteFdSet);
+        bool                error    = FD_ISSET(fd, &aMainloop.mErrorFdSet);
+        const ProcessorFds *previous = &mInitialFds;
+
+        if (!readable && !writable && !error)
+        {
+            continue;
+        }
+
+        // A ready fd is accounted to the processor which added it to the ready set.
+        for (const ProcessorFds &fds : mProcessorFds)
+        {
+            if ((readable && FD_ISSET(fd, &fds.mReadFdSet) && !FD_ISSET(fd, &previous->mReadFdSet)) ||
+                (writable && FD_ISSET(fd, &fds.mWriteFdSet) && !FD_ISSET(fd, &previous->mWriteFdSet)) ||
+                (error && FD_ISSET(fd, &fds.mErrorFdSet) && !FD_ISSET(fd, &previous->mErrorFdSet)))
+            {
+                ++fds.mStats->mReadyFdCount;
+            }
+            previous = &fds;
+        }
     }
+
+    mProcessorFds.clear();
 }
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
 } // namespace otbr
@@ -38,14 +38,125 @@
 
 #include <openthread/openthread-system.h>
 
+#include <functional>
 #include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "ncp/rcp_host.hpp"
 
+#ifndef OTBR_ENABLE_MAINLOOP_EPOLL
+#define OTBR_ENABLE_MAINLOOP_EPOLL 0
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_EPOLL && defined(__linux__)
+#define OTBR_MAINLOOP_USE_EPOLL 1
+#else
+#define OTBR_MAINLOOP_USE_EPOLL 0
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_EPOLL && (defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || \
+                                   defined(__OpenBSD__))
+#define OTBR_MAINLOOP_USE_KQUEUE 1
+#else
+#define OTBR_MAINLOOP_USE_KQUEUE 0
+#endif
+
+#ifndef OTBR_ENABLE_MAINLOOP_STATS
+#define OTBR_ENABLE_MAINLOOP_STATS 0
+#endif
+
+#ifndef OTBR_ENABLE_RADIO_THREAD
+#define OTBR_ENABLE_RADIO_THREAD 0
+#endif
+
+#ifndef OTBR_ENABLE_MDNS_THREAD
+#define OTBR_ENABLE_MDNS_THREAD 0
+#endif
+
+#define OTBR_MAINLOOP_USE_WORKER_THREADS (OTBR_ENABLE_RADIO_THREAD || OTBR_ENABLE_MDNS_THREAD)
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+#include <pthread.h>
+
+#include <thread>
+#endif
+
 namespace otbr {
 
+/**
+ * This class implements a histogram of durations with power-of-two microsecond buckets.
+ *
+ * Bucket 0 counts durations below 2 us, bucket `i` counts durations in [2^i, 2^(i+1)) us and the
+ * last bucket counts all durations from 2^(kNumBuckets - 1) us on.
+ *
+ */
+class MainloopHistogram
+{
+public:
+    static constexpr uint8_t kNumBuckets = 21; ///< The number of buckets, the last one starts from ~1 second.
+
+    /**
+     * This method records a duration.
+     *
+     * @param[in] aDuration  The duration to record.
+     *
+     */
+    void Record(Microseconds aDuration);
+
+    /**
+     * This method returns the number of durations counted in a bucket.
+     *
+     * @param[in] aBucket  The bucket index, must be less than `kNumBuckets`.
+     *
+     */
+    uint64_t GetBucketCount(uint8_t aBucket) const { return mBuckets[aBucket]; }
+
+    /**
+     * This method returns the number of recorded durations.
+     *
+     */
+    uint64_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the sum of recorded durations in microseconds.
+     *
+     */
+    uint64_t GetSum(void) const { return mSum; }
+
+    /**
+     * This method returns the max recorded duration in microseconds.
+     *
+     */
+    uint64_t GetMax(void) const { return mMax; }
+
+private:
+    uint64_t mBuckets[kNumBuckets] = {};
+    uint64_t mCount                = 0;
+    uint64_t mSum                  = 0;
+    uint64_t mMax                  = 0;
+};
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+/**
+ * This structure represents the mainloop statistics of the processors with the same name.
+ *
+ */
+struct MainloopProcessorStats
+{
+    MainloopHistogram mUpdateDuration;            ///< The duration of `MainloopProcessor::Update()`.
+    MainloopHistogram mProcessDuration;           ///< The duration of `Process()` or the fd handlers.
+    MainloopHistogram mTimeout;                   ///< The timeout set when the processor shortened it.
+    uint64_t          mReadyFdCount          = 0; ///< The number of ready fds handled.
+    uint64_t          mTimeoutShortenedCount = 0; ///< The number of iterations the processor shortened the timeout.
+};
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
 /**
  * This class implements the mainloop manager.
  *
@@ -53,11 +164,36 @@ namespace otbr {
 class MainloopManager : private NonCopyable
 {
 public:
+    /**
+     * This enumeration defines the fd events which can be watched by a registered fd handler.
+     *
+     */
+    enum FdEvent : uint8_t
+    {
+        kEventReadable = 1 << 0, ///< The fd is readable.
+        kEventWritable = 1 << 1, ///< The fd is writable.
+        kEventError    = 1 << 2, ///< An error or hang-up happened on the fd (epoll and kqueue only).
+    };
+
+    /**
+     * This type represents the handler of fd events.
+     *
+     * @param[in] aEvents  A bit-set of `FdEvent` which are ready.
+     *
+     */
+    using FdEventHandler = std::function<void(uint8_t aEvents)>;
+
     /**
      * The constructor to initialize the mainloop manager.
      *
      */
-    MainloopManager() = default;
+    MainloopManager(void);
+
+    /**
+     * The destructor to de-initialize the mainloop manager.
+     *
+     */
+    ~MainloopManager(void);
 
     /**
      * This method returns the singleton instance of the mainloop manager.
@@ -96,13 +232,276 @@ public:
     /**
      * This method processes mainloop events of all mainloop processors.
      *
+     * The processors of `MainloopProcessor::kPriorityThreadStack` are processed before the handlers of the
+     * registered fds, the other processors after them.
+     *
      * @param[in] aMainloop  A reference to the mainloop context.
      *
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method registers an fd to be watched by the mainloop.
+     *
+     * Unlike fds added to the `MainloopContext` fd sets in `MainloopProcessor::Update()`, a registered fd is
+     * handed to the poll backend (epoll or kqueue when available) once and is only re-armed when its events
+     * change. The handler is invoked from `Process()` before the mainloop processors are processed.
+     *
+     * @param[in] aFd       The fd to watch.
+     * @param[in] aEvents   A bit-set of `FdEvent` to watch.
+     * @param[in] aHandler  The handler to be invoked when any of the watched events is ready.
+     * @param[in] aName     The name which the handling time is accounted to in the mainloop statistics.
+     *
+     */
+    void AddFd(int aFd, uint8_t aEvents, FdEventHandler aHandler, const char *aName = "RegisteredFd");
+
+    /**
+     * This method updates the events watched on a registered fd.
+     *
+     * This method does nothing if @p aFd is not registered or the events are not changed.
+     *
+     * @param[in] aFd      The registered fd.
+     * @param[in] aEvents  A bit-set of `FdEvent` to watch. Zero disarms the fd without unregistering it.
+     *
+     */
+    void UpdateFd(int aFd, uint8_t aEvents);
+
+    /**
+     * This method unregisters an fd from the mainloop.
+     *
+     * This method must be called before the fd is closed.
+     *
+     * @param[in] aFd  The registered fd.
+     *
+     */
+    void RemoveFd(int aFd);
+
+    /**
+     * This method waits for the fds in the mainloop context and the registered fds.
+     *
+     * The fd sets and timeout of @p aMainloop are updated as select() does.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context.
+     *
+     * @returns The number of ready fds in the fd sets of @p aMainloop and the poll backend, or -1 on
+     *          failure with `errno` set.
+     *
+     */
+    int Poll(MainloopContext &aMainloop);
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    /**
+     * This method returns the mainloop statistics keyed by processor name.
+     *
+     * The registered fds are accounted to the name given in `AddFd()`.
+     *
+     */
+    const std::map<std::string, MainloopProcessorStats> &GetProcessorStats(void) const { return mProcessorStats; }
+
+    /**
+     * This method returns the number of mainloop iterations since the statistics were reset.
+     *
+     */
+    uint64_t GetIterationCount(void) const { return mIterationCount; }
+
+    /**
+     * This method records the duration of a phase of a processor, which is accounted as a processor of its own.
+     *
+     * @param[in] aName      The name which the duration is accounted to, e.g. "RcpHost.Tasklets".
+     * @param[in] aDuration  The duration of the phase.
+     *
+     */
+    void RecordProcessDuration(const char *aName, Microseconds aDuration);
+
+    /**
+     * This method resets the mainloop statistics.
+     *
+     */
+    void ResetStats(void);
+#endif
+
+#if OTBR_ENABLE_RADIO_THREAD
+    /**
+     * This method starts processing the Thread stack on a dedicated radio thread.
+     *
+     * The processors of `MainloopProcessor::kPriorityThreadStack` are then updated and processed on the radio thread,
+     * the other processors and the registered fds stay on the calling thread, which runs `Update()`, `Poll()` and
+     * `Process()`. The threads exclude each other with a lock which is only released while they wait for events
+     * and between the management processors, so that the processors and the OpenThread callbacks don't need to be
+     * thread-safe. The lock inherits the priority of the radio thread.
+     *
+     * @param[in] aPriority  The SCHED_FIFO priority of the radio thread, or 0 to keep the default scheduling policy.
+     * @param[in] aCpu       The CPU which the radio thread is pinned to, or -1 not to pin it.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully started the radio thread.
+     * @retval OTBR_ERROR_INVALID_STATE  The radio thread is already running.
+     * @retval OTBR_ERROR_ERRNO          Failed to create the pipes waking the threads up.
+     *
+     */
+    otbrError StartRadioThread(int aPriority, int aCpu);
+
+    /**
+     * This method stops the radio thread, the Thread stack is then processed by `Process()` again.
+     *
+     * This method must be called by the thread which started the radio thread.
+     *
+     */
+    void StopRadioThread(void);
+
+    /**
+     * This method indicates whether the calling thread is the radio thread.
+     *
+     */
+    bool IsRadioThread(void) const { return IsWorkerThread(mWorkerThreads[kRadioWorker]); }
+#endif
+
+#if OTBR_ENABLE_MDNS_THREAD
+    /**
+     * This method starts processing the mDNS publisher on a dedicated mDNS thread.
+     *
+     * The processors of `MainloopProcessor::kPriorityMdns` are then updated and processed on the mDNS thread, under
+     * the same lock as the radio thread, see `StartRadioThread()`. So the publisher callbacks, e.g. to the Advertising
+     * Proxy, the Discovery Proxy, the TREL DNS-SD and the Border Agent, run on the mDNS thread but never concurrently
+     * with the mainloop and the Thread stack. They must not wait for the mainloop, e.g. with
+     * `TaskRunner::PostAndWait()`, and the mainloop must not wait for them.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully started the mDNS thread.
+     * @retval OTBR_ERROR_INVALID_STATE  The mDNS thread is already running.
+     * @retval OTBR_ERROR_ERRNO          Failed to create the pipes waking the threads up.
+     *
+     */
+    otbrError StartMdnsThread(void);
+
+    /**
+     * This method stops the mDNS thread, the mDNS publisher is then processed by `Process()` again.
+     *
+     * This method must be called by the thread which started the mDNS thread.
+     *
+     */
+    void StopMdnsThread(void);
+
+    /**
+     * This method indicates whether the calling thread is the mDNS thread.
+     *
+     */
+    bool IsMdnsThread(void) const { return IsWorkerThread(mWorkerThreads[kMdnsWorker]); }
+#endif
+
 private:
-    std::list<MainloopProcessor *> mMainloopProcessorList;
+    struct FdEntry
+    {
+        uint8_t        mEvents;
+        FdEventHandler mHandler;
+        const char    *mName;
+#if OTBR_ENABLE_MAINLOOP_STATS
+        MainloopProcessorStats *mStats;
+        uint32_t                mStatsGeneration;
+#endif
+    };
+
+    struct ReadyFd
+    {
+        int     mFd;
+        uint8_t mEvents;
+    };
+
+    void ArmFd(int aFd, uint8_t aOldEvents, uint8_t aNewEvents);
+    void DispatchFdEvents(void);
+    void ProcessProcessors(const MainloopContext &aMainloop, MainloopProcessor::Priority aPriority);
+
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    enum
+    {
+        kRead  = 0,
+        kWrite = 1,
+    };
+
+    enum WorkerId : uint8_t
+    {
+        kRadioWorker = 0,
+        kMdnsWorker  = 1,
+        kNumWorkers  = 2,
+    };
+
+    struct WorkerThread
+    {
+        WorkerThread(const char *aName, MainloopProcessor::Priority aPriority)
+            : mName(aName)
+            , mPriority(aPriority)
+        {
+        }
+
+        const char                 *mName;
+        MainloopProcessor::Priority mPriority; ///< The priority of the processors on this thread.
+        std::thread                 mThread;
+        bool                        mRunning        = false;
+        bool                        mStopping       = false;
+        int                         mSchedPriority  = 0;
+        int                         mCpu            = -1;
+        int                         mWakeFds[2]     = {-1, -1}; ///< Wakes the worker thread up.
+        int                         mMainWakeFds[2] = {-1, -1}; ///< Wakes the thread running `Poll()` up.
+    };
+
+    bool IsWorkerThread(const WorkerThread &aWorker) const
+    {
+        return aWorker.mRunning && std::this_thread::get_id() == aWorker.mThread.get_id();
+    }
+    bool             IsOnWorkerThread(MainloopProcessor::Priority aPriority) const;
+    bool             IsAnyWorkerRunning(void) const;
+    otbrError        StartWorkerThread(WorkerThread &aWorker, int aSchedPriority, int aCpu);
+    void             StopWorkerThread(WorkerThread &aWorker);
+    void             YieldToWorkerThreads(void);
+    void             RunWorkerThread(WorkerThread &aWorker);
+    void             SetWorkerThreadScheduling(const WorkerThread &aWorker);
+    void             WakeOtherThreads(const WorkerThread &aWorker);
+    static otbrError OpenWakeFds(WorkerThread &aWorker);
+    static void      CloseWakeFds(WorkerThread &aWorker);
+    static void      Wake(int aFd);
+    static void      DrainWake(int aFd);
+#else
+    bool IsOnWorkerThread(MainloopProcessor::Priority) const { return false; }
+    void YieldToWorkerThreads(void) {}
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    // The fds of the mainloop context after the update of a processor.
+    struct ProcessorFds
+    {
+        MainloopProcessorStats *mStats;
+        fd_set                  mReadFdSet;
+        fd_set                  mWriteFdSet;
+        fd_set                  mErrorFdSet;
+    };
+
+    MainloopProcessorStats &GetStats(MainloopProcessorStats *&aStats, uint32_t &aGeneration, const char *aName);
+    MainloopProcessorStats &GetStats(MainloopProcessor &aProcessor)
+    {
+        return GetStats(aProcessor.mStats, aProcessor.mStatsGeneration, aProcessor.GetName());
+    }
+    void UpdateWithStats(MainloopContext &aMainloop);
+    void CountReadyFds(const MainloopContext &aMainloop);
+#endif
+
+    std::list<MainloopProcessor *>   mMainloopProcessorList;
+    std::unordered_map<int, FdEntry> mFdEntries;
+    std::vector<ReadyFd>             mReadyFds;
+#if OTBR_MAINLOOP_USE_EPOLL || OTBR_MAINLOOP_USE_KQUEUE
+    int mPollFd;
+#endif
+#if OTBR_ENABLE_MAINLOOP_STATS
+    std::map<std::string, MainloopProcessorStats> mProcessorStats;
+    std::vector<ProcessorFds>                     mProcessorFds;
+    ProcessorFds                                  mInitialFds;
+    uint64_t                                      mIterationCount  = 0;
+    uint32_t                                      mStatsGeneration = 1;
+#endif
+#if OTBR_MAINLOOP_USE_WORKER_THREADS
+    // The lock is held by a thread unless it is waiting for events, see `StartRadioThread()`.
+    pthread_mutex_t mStackLock;
+    WorkerThread    mWorkerThreads[kNumWorkers] = {{"radio", MainloopProcessor::kPriorityThreadStack},
+                                                   {"mDNS", MainloopProcessor::kPriorityMdns}};
+    bool            mWakeWorkerThreads          = false;
+#endif
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
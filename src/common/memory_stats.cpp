@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "MEMORY"
+
+#include "common/memory_stats.hpp"
+
+#include <algorithm>
+
+#include <stdio.h>
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+void MemoryStats::AddCounter(const void *aOwner, const std::string &aName, CounterGetter aGetter)
+{
+    mCounters.push_back({aOwner, aName, std::move(aGetter)});
+}
+
+void MemoryStats::RemoveCounters(const void *aOwner)
+{
+    mCounters.erase(std::remove_if(mCounters.begin(), mCounters.end(),
+                                   [aOwner](const Counter &aCounter) { return aCounter.mOwner == aOwner; }),
+                    mCounters.end());
+}
+
+std::map<std::string, size_t> MemoryStats::GetCounters(void) const
+{
+    std::map<std::string, size_t> counters;
+
+    for (const Counter &counter : mCounters)
+    {
+        counters[counter.mName] += counter.mGetter();
+    }
+
+    return counters;
+}
+
+MemoryStats::HeapUsage MemoryStats::GetHeapUsage(void)
+{
+    HeapUsage     usage = {0, 0, 0, 0};
+    FILE         *statm = fopen("/proc/self/statm", "r");
+    unsigned long size;
+    unsigned long resident;
+
+    if (statm != nullptr)
+    {
+        if (fscanf(statm, "%lu %lu", &size, &resident) == 2)
+        {
+            usage.mResidentBytes = static_cast<uint64_t>(resident) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        }
+        fclose(statm);
+    }
+
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 33)
+    {
+        struct mallinfo2 info = mallinfo2();
+
+        usage.mInUseBytes   = info.uordblks;
+        usage.mFreeBytes    = info.fordblks;
+        usage.mMmappedBytes = info.hblkhd;
+    }
+#endif
+#endif
+
+    return usage;
+}
+
+otbrError MemoryStats::TrimHeap(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+#if defined(__GLIBC__)
+    HeapUsage before = GetHeapUsage();
+    HeapUsage after;
+
+    malloc_trim(0);
+    after = GetHeapUsage();
+    otbrLogInfo("Trimmed the heap, resident size %llu -> %llu bytes",
+                static_cast<unsigned long long>(before.mResidentBytes),
+                static_cast<unsigned long long>(after.mResidentBytes));
+#else
+    error = OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the memory accounting of the agent.
+ */
+
+#ifndef OTBR_COMMON_MEMORY_STATS_HPP_
+#define OTBR_COMMON_MEMORY_STATS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class accounts the entries held by the subsystems of the agent, next to the heap usage of the process.
+ *
+ * The subsystems add counters which are only evaluated when the statistics are retrieved, so that the accounting
+ * doesn't cost anything on their paths. The counters are added, removed and retrieved in the mainloop thread.
+ *
+ */
+class MemoryStats : private NonCopyable
+{
+public:
+    /**
+     * This function returns the current number of entries of a counter.
+     *
+     */
+    using CounterGetter = std::function<size_t(void)>;
+
+    /**
+     * This structure represents the heap usage of the process.
+     *
+     * The values are zero if they are not available on the platform.
+     *
+     */
+    struct HeapUsage
+    {
+        uint64_t mResidentBytes; ///< The resident set size of the process.
+        uint64_t mInUseBytes;    ///< The bytes allocated by the heap allocator.
+        uint64_t mFreeBytes;     ///< The bytes kept free by the heap allocator.
+        uint64_t mMmappedBytes;  ///< The bytes allocated by the heap allocator in separate mappings.
+    };
+
+    /**
+     * This method returns the singleton instance of the memory statistics.
+     *
+     */
+    static MemoryStats &GetInstance(void)
+    {
+        static MemoryStats sMemoryStats;
+        return sMemoryStats;
+    }
+
+    /**
+     * This method adds a counter.
+     *
+     * The counters of the same name, e.g. of several instances of a class, are summed up.
+     *
+     * @param[in] aOwner   The owner of the counter, which removes it with `RemoveCounters()`.
+     * @param[in] aName    The counter name.
+     * @param[in] aGetter  The function returning the current number of entries.
+     *
+     */
+    void AddCounter(const void *aOwner, const std::string &aName, CounterGetter aGetter);
+
+    /**
+     * This method removes all the counters of an owner.
+     *
+     * @param[in] aOwner  The owner of the counters.
+     *
+     */
+    void RemoveCounters(const void *aOwner);
+
+    /**
+     * This method returns the current number of entries of each counter, by counter name.
+     *
+     */
+    std::map<std::string, size_t> GetCounters(void) const;
+
+    /**
+     * This method returns the heap usage of the process.
+     *
+     */
+    static HeapUsage GetHeapUsage(void);
+
+    /**
+     * This method releases the free heap memory back to the system.
+     *
+     * @retval OTBR_ERROR_NONE             Successfully trimmed the heap.
+     * @retval OTBR_ERROR_NOT_IMPLEMENTED  The heap allocator can't be trimmed on this platform.
+     *
+     */
+    static otbrError TrimHeap(void);
+
+private:
+    struct Counter
+    {
+        const void   *mOwner;
+        std::string   mName;
+        CounterGetter mGetter;
+    };
+
+    MemoryStats(void) = default;
+
+    std::vector<Counter> mCounters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MEMORY_STATS_HPP_
@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a bounded lock-free multi-producer single-consumer queue.
+ */
+
+#ifndef OTBR_COMMON_MPSC_QUEUE_HPP_
+#define OTBR_COMMON_MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a bounded lock-free queue with multiple producers and a single consumer.
+ *
+ * Each cell carries a sequence number which tells whether the cell is free for the producer
+ * of a given position or holds an item for the consumer. Producers claim positions with a CAS
+ * on the enqueue position, the consumer owns the dequeue position exclusively.
+ *
+ * @tparam T          The item type, must be default constructible and move assignable.
+ * @tparam kCapacity  The number of cells, must be a power of two.
+ *
+ */
+template <typename T, size_t kCapacity> class MpscQueue : private NonCopyable
+{
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of two");
+
+public:
+    /**
+     * This constructor initializes an empty queue.
+     *
+     */
+    MpscQueue(void)
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mCells[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * This method tries to push an item to the tail of the queue.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aItem  The item to push, it's only moved from when this method succeeds.
+     *
+     * @retval TRUE   Successfully pushed the item.
+     * @retval FALSE  The queue is full.
+     *
+     */
+    template <typename U> bool TryPush(U &&aItem)
+    {
+        bool   pushed = false;
+        Cell  *cell;
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            size_t   seq;
+            intptr_t diff;
+
+            cell = &mCells[pos & kMask];
+            seq  = cell->mSequence.load(std::memory_order_acquire);
+            diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The consumer has not released the cell of the previous round.
+                ExitNow();
+            }
+            else
+            {
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->mItem = std::forward<U>(aItem);
+        cell->mSequence.store(pos + 1, std::memory_order_release);
+        pushed = true;
+
+    exit:
+        return pushed;
+    }
+
+    /**
+     * This method tries to pop an item from the head of the queue.
+     *
+     * This method must only be called by the consumer thread.
+     *
+     * @param[out] aItem  A reference to receive the popped item.
+     *
+     * @retval TRUE   Successfully popped an item.
+     * @retval FALSE  There is no published item at the head of the queue.
+     *
+     */
+    bool TryPop(T &aItem)
+    {
+        bool  popped = false;
+        Cell &cell   = mCells[mDequeuePos & kMask];
+
+        VerifyOrExit(cell.mSequence.load(std::memory_order_acquire) == mDequeuePos + 1);
+
+        aItem      = std::move(cell.mItem);
+        cell.mItem = T();
+        cell.mSequence.store(mDequeuePos + kCapacity, std::memory_order_release);
+        ++mDequeuePos;
+        popped = true;
+
+    exit:
+        return popped;
+    }
+
+    /**
+     * This method indicates whether there is a published item at the head of the queue.
+     *
+     * This method must only be called by the consumer thread.
+     *
+     * @retval TRUE   The queue has no item to pop.
+     * @retval FALSE  The queue has at least one item to pop.
+     *
+     */
+    bool IsEmpty(void) const
+    {
+        return mCells[mDequeuePos & kMask].mSequence.load(std::memory_order_acquire) != mDequeuePos + 1;
+    }
+
+private:
+    static constexpr size_t kMask          = kCapacity - 1;
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Cell
+    {
+        std::atomic<size_t> mSequence;
+        T                   mItem;
+    };
+
+    Cell mCells[kCapacity];
+
+    // Keep the producer and consumer positions on separate cache lines. They are padded rather than over-aligned
+    // with `alignas`, since the queue is a member of heap allocated objects and C++11 `new` ignores extended
+    // alignment.
+    std::atomic<size_t> mEnqueuePos{0};
+    char                mPadding[kCacheLineSize - sizeof(std::atomic<size_t>)];
+    size_t              mDequeuePos = 0;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MPSC_QUEUE_HPP_
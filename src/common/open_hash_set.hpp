@@ -0,0 +1,294 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a hash set with open addressing.
+ */
+
+#ifndef OTBR_COMMON_OPEN_HASH_SET_HPP_
+#define OTBR_COMMON_OPEN_HASH_SET_HPP_
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a hash set with open addressing and linear probing.
+ *
+ * The keys are stored inline in a power-of-two table which is kept at most half full, so a lookup
+ * usually touches a single cache line. Erased slots are refilled by shifting the following keys of
+ * the probe sequence backward, so there are no tombstones and lookups don't degrade over time.
+ *
+ * @tparam Key   The key type, must be default constructible, copy assignable and equality comparable.
+ * @tparam Hash  The hash function of the keys.
+ *
+ */
+template <typename Key, typename Hash = std::hash<Key>> class OpenHashSet
+{
+public:
+    /**
+     * This class implements an iterator over the keys of the set.
+     *
+     * The iterator is invalidated by any modification of the set.
+     *
+     */
+    class ConstIterator
+    {
+    public:
+        const Key &operator*(void) const { return mSet->mSlots[mIndex].mKey; }
+        const Key *operator->(void) const { return &mSet->mSlots[mIndex].mKey; }
+
+        ConstIterator &operator++(void)
+        {
+            mIndex = mSet->FindOccupied(mIndex + 1);
+            return *this;
+        }
+
+        bool operator==(const ConstIterator &aOther) const { return mIndex == aOther.mIndex; }
+        bool operator!=(const ConstIterator &aOther) const { return mIndex != aOther.mIndex; }
+
+    private:
+        friend class OpenHashSet;
+
+        ConstIterator(const OpenHashSet *aSet, size_t aIndex)
+            : mSet(aSet)
+            , mIndex(aIndex)
+        {
+        }
+
+        const OpenHashSet *mSet;
+        size_t             mIndex;
+    };
+
+    /**
+     * This constructor initializes an empty set, the table is allocated by the first insertion.
+     *
+     */
+    OpenHashSet(void)
+        : mSize(0)
+    {
+    }
+
+    /**
+     * This method inserts a key.
+     *
+     * @param[in] aKey  The key to insert.
+     *
+     * @retval TRUE   The key is inserted.
+     * @retval FALSE  The key is already in the set.
+     *
+     */
+    bool Insert(const Key &aKey)
+    {
+        bool   inserted = false;
+        size_t index;
+
+        if ((mSize + 1) * 2 > mSlots.size())
+        {
+            Rehash(mSlots.empty() ? kMinCapacity : mSlots.size() * 2);
+        }
+
+        index = Find(aKey);
+
+        if (!mSlots[index].mOccupied)
+        {
+            mSlots[index].mKey      = aKey;
+            mSlots[index].mOccupied = true;
+            mSize++;
+            inserted = true;
+        }
+
+        return inserted;
+    }
+
+    /**
+     * This method erases a key.
+     *
+     * @param[in] aKey  The key to erase.
+     *
+     * @retval TRUE   The key is erased.
+     * @retval FALSE  The key is not in the set.
+     *
+     */
+    bool Erase(const Key &aKey)
+    {
+        bool   erased = false;
+        size_t hole;
+
+        VerifyOrExit(mSize != 0);
+
+        hole = Find(aKey);
+        VerifyOrExit(mSlots[hole].mOccupied);
+
+        // Moves back the following keys which could not be placed in the hole when they were inserted.
+        for (size_t index = Next(hole); mSlots[index].mOccupied; index = Next(index))
+        {
+            size_t home = GetHome(mSlots[index].mKey);
+
+            if (((index - home) & GetMask()) >= ((index - hole) & GetMask()))
+            {
+                mSlots[hole].mKey = mSlots[index].mKey;
+                hole              = index;
+            }
+        }
+
+        mSlots[hole].mOccupied = false;
+        mSlots[hole].mKey      = Key();
+        mSize--;
+        erased = true;
+
+    exit:
+        return erased;
+    }
+
+    /**
+     * This method checks whether a key is in the set.
+     *
+     * @param[in] aKey  The key to look up.
+     *
+     * @returns Whether the key is in the set.
+     *
+     */
+    bool Contains(const Key &aKey) const { return mSize != 0 && mSlots[Find(aKey)].mOccupied; }
+
+    /**
+     * This method removes all the keys, the table is kept for the next insertions.
+     *
+     */
+    void Clear(void)
+    {
+        for (Slot &slot : mSlots)
+        {
+            slot.mOccupied = false;
+            slot.mKey      = Key();
+        }
+        mSize = 0;
+    }
+
+    /**
+     * This method returns the number of keys in the set.
+     *
+     * @returns The number of keys in the set.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+    /**
+     * This method checks whether the set is empty.
+     *
+     * @returns Whether the set is empty.
+     *
+     */
+    bool IsEmpty(void) const { return mSize == 0; }
+
+    ConstIterator begin(void) const { return ConstIterator(this, FindOccupied(0)); }
+    ConstIterator end(void) const { return ConstIterator(this, mSlots.size()); }
+
+private:
+    static constexpr size_t kMinCapacity = 16;
+
+    struct Slot
+    {
+        Slot(void)
+            : mKey()
+            , mOccupied(false)
+        {
+        }
+
+        Key  mKey;
+        bool mOccupied;
+    };
+
+    size_t GetMask(void) const { return mSlots.size() - 1; }
+    size_t GetHome(const Key &aKey) const { return Mix(mHash(aKey)) & GetMask(); }
+    size_t Next(size_t aIndex) const { return (aIndex + 1) & GetMask(); }
+
+    static size_t Mix(size_t aHash)
+    {
+        // Spreads the hash over the low bits used to index the table, in case the hash function is poor in them.
+        uint64_t hash = static_cast<uint64_t>(aHash) * 0x9e3779b97f4a7c15ULL;
+
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+
+    // Returns the slot of the key, or the empty slot where it would be inserted.
+    size_t Find(const Key &aKey) const
+    {
+        size_t index = GetHome(aKey);
+
+        while (mSlots[index].mOccupied && !(mSlots[index].mKey == aKey))
+        {
+            index = Next(index);
+        }
+
+        return index;
+    }
+
+    size_t FindOccupied(size_t aIndex) const
+    {
+        while (aIndex < mSlots.size() && !mSlots[aIndex].mOccupied)
+        {
+            aIndex++;
+        }
+
+        return aIndex;
+    }
+
+    void Rehash(size_t aCapacity)
+    {
+        std::vector<Slot> slots(aCapacity);
+
+        slots.swap(mSlots);
+
+        for (const Slot &slot : slots)
+        {
+            if (slot.mOccupied)
+            {
+                size_t index = Find(slot.mKey);
+
+                mSlots[index] = slot;
+            }
+        }
+    }
+
+    std::vector<Slot> mSlots;
+    size_t            mSize;
+    Hash              mHash;
+};
+
+template <typename Key, typename Hash> constexpr size_t OpenHashSet<Key, Hash>::kMinCapacity;
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_OPEN_HASH_SET_HPP_
@@ -0,0 +1,84 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definitions of the USDT probes of the otbr-agent.
+ */
+
+#ifndef OTBR_COMMON_PROBES_HPP_
+#define OTBR_COMMON_PROBES_HPP_
+
+#include "openthread-br/config.h"
+
+/**
+ * Whether the USDT (user-level statically defined tracing) probes are compiled in.
+ *
+ * The probes are nops until a tracer such as bpftrace attaches to them, e.g.
+ * `bpftrace -e 'usdt:/usr/sbin/otbr-agent:otbr:rest__handle__start { @[str(arg0)] = count(); }'`.
+ *
+ */
+#ifndef OTBR_ENABLE_USDT_PROBES
+#define OTBR_ENABLE_USDT_PROBES 0
+#endif
+
+#if OTBR_ENABLE_USDT_PROBES
+#include <sys/sdt.h>
+
+/**
+ * This macro defines a USDT probe of the `otbr` provider at the place it is used.
+ *
+ * The `*__start` and `*__end` probes enclose an operation so that its latency can be measured, the probes are:
+ * - `mainloop__iteration__start()`, `mainloop__iteration__end(int aReadyFds)`
+ * - `task_runner__pop__start()`, `task_runner__pop__end()`
+ * - `netif__ip6__send__start(uint16_t aLength)`, `netif__ip6__send__end(uint16_t aLength)`
+ * - `netif__ip6__receive__start(uint16_t aLength)`, `netif__ip6__receive__end(uint16_t aLength, int aError)`
+ * - `ncp__spinel__frame__start(uint8_t aTid, uint16_t aLength)`, `ncp__spinel__frame__end(uint8_t aTid,
+ *   uint16_t aLength)`
+ * - `mdns__publish__service(const char *aName, const char *aType, int aPriority)`,
+ *   `mdns__publish__host(const char *aName, size_t aNumAddresses)`, `mdns__publish__key(const char *aName)`
+ * - `mdns__service__resolved(const char *aType, const char *aName, bool aRemoved, size_t aNumAddresses)`,
+ *   `mdns__host__resolved(const char *aName, size_t aNumAddresses)`
+ * - `srp__advertising__start(uint32_t aUpdateId, const char *aHostName)`, `srp__advertising__end(uint32_t
+ *   aUpdateId, int aError)`
+ * - `rest__handle__start(const char *aUrl, int aMethod)`, `rest__handle__end(const char *aStatus)`
+ * - `dbus__method__start(const char *aInterface, const char *aMember)`, `dbus__method__end(const char
+ *   *aInterface, const char *aMember)`
+ *
+ * The arguments are only evaluated when the probes are compiled in, and must be integers or pointers.
+ *
+ * @param[in] aName  The name of the probe, `__` is shown as `-` by the tracers.
+ * @param[in] ...    The arguments of the probe, up to 12.
+ *
+ */
+#define OTBR_PROBE(aName, ...) STAP_PROBEV(otbr, aName, ##__VA_ARGS__)
+#else
+#define OTBR_PROBE(aName, ...)
+#endif
+
+#endif // OTBR_COMMON_PROBES_HPP_
@@ -0,0 +1,96 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "STARTUP"
+
+#include "common/startup_stats.hpp"
+
+#include <algorithm>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+StartupStats::StartupStats(void)
+    : mBeginTime(Clock::now())
+    , mDuration(0)
+{
+}
+
+void StartupStats::Restart(void)
+{
+    mBeginTime = Clock::now();
+    mDuration  = Microseconds(0);
+    mStages.clear();
+}
+
+void StartupStats::BeginStage(const std::string &aName)
+{
+    mStages.push_back({aName, GetElapsedTime(), Microseconds(0), false});
+}
+
+void StartupStats::EndStage(const std::string &aName)
+{
+    auto it = std::find_if(mStages.begin(), mStages.end(),
+                           [&aName](const Stage &aStage) { return aStage.mName == aName && !aStage.mCompleted; });
+
+    VerifyOrExit(it != mStages.end());
+
+    mDuration      = GetElapsedTime();
+    it->mDuration  = mDuration - it->mBeginTime;
+    it->mCompleted = true;
+
+    otbrLogInfo("Stage %s completed in %lld us", aName.c_str(), static_cast<long long>(it->mDuration.count()));
+
+    if (IsCompleted())
+    {
+        otbrLogNotice("Startup completed in %lld ms", static_cast<long long>(mDuration.count() / 1000));
+    }
+
+exit:
+    return;
+}
+
+void StartupStats::RunStage(const std::string &aName, const std::function<void(void)> &aStage)
+{
+    BeginStage(aName);
+    aStage();
+    EndStage(aName);
+}
+
+bool StartupStats::IsCompleted(void) const
+{
+    return std::all_of(mStages.begin(), mStages.end(), [](const Stage &aStage) { return aStage.mCompleted; });
+}
+
+Microseconds StartupStats::GetElapsedTime(void) const
+{
+    return std::chrono::duration_cast<Microseconds>(Clock::now() - mBeginTime);
+}
+
+} // namespace otbr
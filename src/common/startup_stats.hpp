@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the startup statistics of the agent.
+ */
+
+#ifndef OTBR_COMMON_STARTUP_STATS_HPP_
+#define OTBR_COMMON_STARTUP_STATS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class records the durations of the startup stages of the agent.
+ *
+ * A stage is either run synchronously, or begun and then completed from a callback when the subsystem is started
+ * asynchronously, so that it doesn't hold back the other subsystems.
+ *
+ */
+class StartupStats : private NonCopyable
+{
+public:
+    /**
+     * This structure represents a startup stage.
+     *
+     */
+    struct Stage
+    {
+        std::string  mName;      ///< The stage name.
+        Microseconds mBeginTime; ///< The time the stage began, since the startup began.
+        Microseconds mDuration;  ///< The duration of the stage, zero until completed.
+        bool         mCompleted; ///< Whether the stage is completed.
+    };
+
+    /**
+     * The constructor begins the startup.
+     *
+     */
+    StartupStats(void);
+
+    /**
+     * This method returns the singleton instance of the startup statistics.
+     *
+     */
+    static StartupStats &GetInstance(void)
+    {
+        static StartupStats sStartupStats;
+        return sStartupStats;
+    }
+
+    /**
+     * This method begins the startup again, the stages recorded are cleared.
+     *
+     */
+    void Restart(void);
+
+    /**
+     * This method begins a startup stage.
+     *
+     * @param[in] aName  The stage name.
+     *
+     */
+    void BeginStage(const std::string &aName);
+
+    /**
+     * This method completes a startup stage.
+     *
+     * Nothing is done if the stage was not begun or is completed already.
+     *
+     * @param[in] aName  The stage name.
+     *
+     */
+    void EndStage(const std::string &aName);
+
+    /**
+     * This method runs a startup stage synchronously.
+     *
+     * @param[in] aName   The stage name.
+     * @param[in] aStage  The function running the stage.
+     *
+     */
+    void RunStage(const std::string &aName, const std::function<void(void)> &aStage);
+
+    /**
+     * This method returns whether all the startup stages begun are completed.
+     *
+     */
+    bool IsCompleted(void) const;
+
+    /**
+     * This method returns the time since the startup began until the last stage completed.
+     *
+     */
+    Microseconds GetDuration(void) const { return mDuration; }
+
+    /**
+     * This method returns the startup stages in the order they began.
+     *
+     */
+    const std::vector<Stage> &GetStages(void) const { return mStages; }
+
+private:
+    Microseconds GetElapsedTime(void) const;
+
+    Timepoint          mBeginTime;
+    Microseconds       mDuration;
+    std::vector<Stage> mStages;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STARTUP_STATS_HPP_
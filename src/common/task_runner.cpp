@@ -39,14 +39,25 @@
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/memory_stats.hpp"
+#include "common/probes.hpp"
 
 namespace otbr {
 
-TaskRunner::TaskRunner(void)
+TaskRunner::TaskRunner(Mode aMode)
     : mTaskQueue(DelayedTask::Comparator{})
+    , mMode(aMode)
+    , mWheelEpoch(Clock::now())
+    , mWheelTick(0)
 {
     int flags;
 
+    if (mMode == Mode::kTimerWheel)
+    {
+        mWheelSlots.resize(kWheelSlotCount);
+        mWheelSlotBitmap.resize(kWheelSlotCount / 64, 0);
+    }
+
     // We do not handle failures when creating a pipe, simply die.
     VerifyOrDie(pipe(mEventFd) != -1, strerror(errno));
 
@@ -54,10 +65,14 @@ TaskRunner::TaskRunner(void)
     VerifyOrDie(fcntl(mEventFd[kRead], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
     flags = fcntl(mEventFd[kWrite], F_GETFL, 0);
     VerifyOrDie(fcntl(mEventFd[kWrite], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
+
+    MemoryStats::GetInstance().AddCounter(this, "task_runner.tasks", [this]() { return GetPendingTaskCount(); });
 }
 
 TaskRunner::~TaskRunner(void)
 {
+    MemoryStats::GetInstance().RemoveCounters(this);
+
     if (mEventFd[kRead] != -1)
     {
         close(mEventFd[kRead]);
@@ -72,12 +87,33 @@ TaskRunner::~TaskRunner(void)
 
 void TaskRunner::Post(Task<void> aTask)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    PushImmediateTask(std::move(aTask));
 }
 
 TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
 {
-    return PushTask(aDelay, std::move(aTask));
+    return PushTask(aDelay, Priority::kNormal, std::move(aTask));
+}
+
+void TaskRunner::Post(Priority aPriority, Task<void> aTask)
+{
+    VerifyOrExit(aPriority != Priority::kNormal, PushImmediateTask(std::move(aTask)));
+
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+        (aPriority == Priority::kCritical ? mCriticalTasks : mBackgroundTasks).push_back(std::move(aTask));
+    }
+
+    WakeUp();
+
+exit:
+    return;
+}
+
+TaskRunner::TaskId TaskRunner::Post(Priority aPriority, Milliseconds aDelay, Task<void> aTask)
+{
+    return PushTask(aDelay, aPriority, std::move(aTask));
 }
 
 void TaskRunner::Update(MainloopContext &aMainloop)
@@ -87,10 +123,26 @@ void TaskRunner::Update(MainloopContext &aMainloop)
 
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
+        Timepoint                   deadline;
 
-        if (!mTaskQueue.empty())
+        if (mMode == Mode::kTimerWheel)
         {
-            auto  now     = Clock::now();
+            if (GetNextWheelDeadline(deadline))
+            {
+                auto delay   = std::chrono::duration_cast<Microseconds>(deadline - MainloopClock::Now());
+                auto timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+
+                delay = std::max(delay, Microseconds::zero());
+
+                if (delay <= timeout)
+                {
+                    aMainloop.mTimeout = ToTimeval(delay);
+                }
+            }
+        }
+        else if (!mTaskQueue.empty())
+        {
+            auto  now     = MainloopClock::Now();
             auto &task    = mTaskQueue.top();
             auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
             auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
@@ -115,6 +167,10 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
 
     ssize_t rval;
 
+    // Clear the flag before reading the pipe and popping the tasks, so that a
+    // task posted after this point always triggers a new wakeup.
+    mWakeupPending.store(false);
+
     // Read any data in the pipe.
     do
     {
@@ -129,21 +185,54 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
     PopTasks();
 }
 
-TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+void TaskRunner::PushImmediateTask(Task<void> aTask)
 {
-    ssize_t       rval;
-    const uint8_t kOne = 1;
-    TaskId        taskId;
-
+    if (mHasOverflowTasks.load(std::memory_order_acquire) || !mImmediateTasks.TryPush(std::move(aTask)))
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-        taskId = mNextTaskId++;
+        if (mHasOverflowTasks.load(std::memory_order_relaxed) || !mImmediateTasks.TryPush(std::move(aTask)))
+        {
+            mOverflowTasks.push_back(std::move(aTask));
+            mHasOverflowTasks.store(true, std::memory_order_release);
+        }
+    }
+
+    WakeUp();
+}
+
+TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Priority aPriority, Task<void> aTask)
+{
+    TaskId taskId;
+
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-        mActiveTaskIds.insert(taskId);
-        mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
+        if (mMode == Mode::kTimerWheel)
+        {
+            taskId = PushWheelTask(aDelay, aPriority, std::move(aTask));
+        }
+        else
+        {
+            taskId = mNextTaskId++;
+            mActiveTaskIds.insert(taskId);
+            mTaskQueue.emplace(taskId, aDelay, aPriority, std::move(aTask));
+        }
     }
 
+    WakeUp();
+
+    return taskId;
+}
+
+void TaskRunner::WakeUp(void)
+{
+    ssize_t       rval;
+    const uint8_t kOne = 1;
+
+    // Only the first post after the last `Process()` needs to write the pipe.
+    VerifyOrExit(!mWakeupPending.exchange(true));
+
     do
     {
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
@@ -159,33 +248,187 @@ TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
     otbrLogWarning("Failed to write fd %d: %s", mEventFd[kWrite], strerror(errno));
 
 exit:
-    return taskId;
+    return;
 }
 
 void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
 {
     std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-    mActiveTaskIds.erase(aTaskId);
+    if (mMode == Mode::kTimerWheel)
+    {
+        CancelWheelTask(aTaskId);
+    }
+    else
+    {
+        mActiveTaskIds.erase(aTaskId);
+    }
+}
+
+size_t TaskRunner::GetPendingTaskCount(void)
+{
+    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+    return mTaskQueue.size() + mWheelTaskCount + mOverflowTasks.size() + mCriticalTasks.size() +
+           mBackgroundTasks.size();
+}
+
+void TaskRunner::PopImmediateTasks(void)
+{
+    size_t count = 0;
+
+    // Bound the number of tasks per round, so that tasks which keep posting
+    // new tasks can't starve the other mainloop processors.
+    for (; count < kImmediateTaskQueueSize; count++)
+    {
+        Task<void> task;
+
+        if (!mImmediateTasks.TryPop(task))
+        {
+            break;
+        }
+
+        task();
+    }
+
+    if (count == kImmediateTaskQueueSize)
+    {
+        // The overflow tasks must wait until the queue is drained.
+        ExitNow(WakeUp());
+    }
+
+    VerifyOrExit(mHasOverflowTasks.load(std::memory_order_acquire));
+
+    {
+        std::deque<Task<void>> overflowTasks;
+
+        {
+            std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+            overflowTasks.swap(mOverflowTasks);
+            mHasOverflowTasks.store(false, std::memory_order_release);
+        }
+
+        for (Task<void> &task : overflowTasks)
+        {
+            task();
+        }
+    }
+
+exit:
+    return;
 }
 
 void TaskRunner::PopTasks(void)
+{
+    OTBR_PROBE(task_runner__pop__start);
+
+    PopCriticalTasks();
+    PopImmediateTasks();
+
+    if (mMode == Mode::kTimerWheel)
+    {
+        PopWheelTasks();
+    }
+    else
+    {
+        PopHeapTasks();
+    }
+
+    // The critical tasks posted or due meanwhile don't wait for the next iteration.
+    PopCriticalTasks();
+    PopBackgroundTasks();
+
+    OTBR_PROBE(task_runner__pop__end);
+}
+
+void TaskRunner::RunDueTask(Priority aPriority, Task<void> &aTask)
+{
+    if (aPriority == Priority::kNormal)
+    {
+        aTask();
+    }
+    else
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+        (aPriority == Priority::kCritical ? mCriticalTasks : mBackgroundTasks).push_back(std::move(aTask));
+    }
+}
+
+void TaskRunner::PopCriticalTasks(void)
+{
+    // Only the tasks posted so far are executed, so that a critical task which keeps posting critical tasks can't
+    // starve the other lanes.
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+        VerifyOrExit(!mCriticalTasks.empty());
+        mRunningCriticalTasks.swap(mCriticalTasks);
+    }
+
+    for (Task<void> &task : mRunningCriticalTasks)
+    {
+        task();
+    }
+
+    mRunningCriticalTasks.clear();
+
+exit:
+    return;
+}
+
+void TaskRunner::PopBackgroundTasks(void)
+{
+    bool hasMoreTasks = false;
+
+    for (size_t count = 0; count < kBackgroundTaskBudget; count++)
+    {
+        Task<void> task;
+
+        {
+            std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+            if (mBackgroundTasks.empty())
+            {
+                break;
+            }
+
+            task = std::move(mBackgroundTasks.front());
+            mBackgroundTasks.pop_front();
+            hasMoreTasks = !mBackgroundTasks.empty();
+        }
+
+        task();
+    }
+
+    // The rest of the background tasks are executed in the next iterations, without blocking the mainloop.
+    if (hasMoreTasks)
+    {
+        WakeUp();
+    }
+}
+
+void TaskRunner::PopHeapTasks(void)
 {
     while (true)
     {
         Task<void> task;
+        Priority   priority;
         bool       canceled;
 
         // The braces here are necessary for auto-releasing of the mutex.
         {
             std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
+            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= MainloopClock::Now())
             {
                 const DelayedTask &top    = mTaskQueue.top();
                 TaskId             taskId = top.mTaskId;
 
-                task = std::move(top.mTask);
+                // The task is popped right away, moving it out doesn't break the heap.
+                task     = std::move(const_cast<DelayedTask &>(top).mTask);
+                priority = top.mPriority;
                 mTaskQueue.pop();
                 canceled = (mActiveTaskIds.erase(taskId) == 0);
             }
@@ -197,9 +440,329 @@ void TaskRunner::PopTasks(void)
 
         if (!canceled)
         {
-            task();
+            RunDueTask(priority, task);
         }
     }
 }
 
+void TaskRunner::PopWheelTasks(void)
+{
+    while (true)
+    {
+        Task<void> task;
+        Priority   priority;
+
+        // The braces here are necessary for auto-releasing of the mutex.
+        {
+            std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+            if (mWheelDueTasks.mHead == kWheelNoTask)
+            {
+                CollectWheelTasks(MainloopClock::Now());
+            }
+
+            if (mWheelDueTasks.mHead == kWheelNoTask)
+            {
+                break;
+            }
+
+            task     = std::move(mWheelTasks[mWheelDueTasks.mHead].mTask);
+            priority = mWheelTasks[mWheelDueTasks.mHead].mPriority;
+            FreeWheelTask(mWheelDueTasks.mHead);
+        }
+
+        RunDueTask(priority, task);
+    }
+}
+
+TaskRunner::Tick TaskRunner::ToWheelTick(Timepoint aTime, bool aRoundUp) const
+{
+    auto elapsed = std::chrono::duration_cast<Microseconds>(aTime - mWheelEpoch).count();
+    Tick tick;
+
+    if (elapsed <= 0)
+    {
+        ExitNow(tick = 0);
+    }
+
+    tick = static_cast<Tick>(elapsed) / 1000;
+
+    // Rounding up makes sure a task is never executed before its deadline.
+    if (aRoundUp && static_cast<Tick>(elapsed) % 1000 != 0)
+    {
+        ++tick;
+    }
+
+exit:
+    return tick;
+}
+
+TaskRunner::TaskId TaskRunner::PushWheelTask(Milliseconds aDelay, Priority aPriority, Task<void> aTask)
+{
+    WheelTaskList *list;
+    uint32_t       index;
+    Tick           tick = mWheelTick;
+
+    if (aDelay > Milliseconds::zero())
+    {
+        tick = ToWheelTick(MainloopClock::Now() + aDelay, /* aRoundUp */ true);
+    }
+
+    if (tick <= mWheelTick)
+    {
+        list = &mWheelDueTasks;
+    }
+    else if (IsInWheelSlots(tick))
+    {
+        list = &mWheelSlots[tick & kWheelSlotMask];
+        SetWheelSlotBit(tick & kWheelSlotMask);
+    }
+    else
+    {
+        WheelPeriod &period = mWheelOverflowTasks[tick >> kWheelPeriodShift];
+
+        if (period.mTasks.mHead == kWheelNoTask || tick < period.mFirstTick)
+        {
+            period.mFirstTick = tick;
+        }
+
+        list = &period.mTasks;
+    }
+
+    if (mWheelFreeTask != kWheelNoTask)
+    {
+        index          = mWheelFreeTask;
+        mWheelFreeTask = mWheelTasks[index].mNext;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(mWheelTasks.size());
+        mWheelTasks.emplace_back();
+    }
+
+    mWheelTasks[index].mTick     = tick;
+    mWheelTasks[index].mPriority = aPriority;
+    mWheelTasks[index].mTask     = std::move(aTask);
+    LinkWheelTask(*list, index);
+    ++mWheelTaskCount;
+
+    return (static_cast<TaskId>(mWheelTasks[index].mGeneration) << 32) | index;
+}
+
+void TaskRunner::CancelWheelTask(TaskId aTaskId)
+{
+    uint32_t       index = static_cast<uint32_t>(aTaskId);
+    WheelTaskList *list;
+    Tick           tick;
+
+    // The generation has changed if the task was already executed or canceled.
+    VerifyOrExit(index < mWheelTasks.size() && mWheelTasks[index].mGeneration == (aTaskId >> 32));
+
+    list = mWheelTasks[index].mList;
+    tick = mWheelTasks[index].mTick;
+    FreeWheelTask(index);
+
+    VerifyOrExit(list != &mWheelDueTasks && list->mHead == kWheelNoTask);
+
+    if (IsInWheelSlots(tick))
+    {
+        ClearWheelSlotBit(tick & kWheelSlotMask);
+    }
+    else
+    {
+        mWheelOverflowTasks.erase(tick >> kWheelPeriodShift);
+    }
+
+exit:
+    return;
+}
+
+void TaskRunner::LinkWheelTask(WheelTaskList &aList, uint32_t aIndex)
+{
+    WheelTask &task = mWheelTasks[aIndex];
+
+    task.mList = &aList;
+    task.mPrev = aList.mTail;
+    task.mNext = kWheelNoTask;
+
+    if (aList.mTail == kWheelNoTask)
+    {
+        aList.mHead = aIndex;
+    }
+    else
+    {
+        mWheelTasks[aList.mTail].mNext = aIndex;
+    }
+
+    aList.mTail = aIndex;
+}
+
+void TaskRunner::UnlinkWheelTask(uint32_t aIndex)
+{
+    WheelTask     &task = mWheelTasks[aIndex];
+    WheelTaskList &list = *task.mList;
+
+    (task.mPrev == kWheelNoTask ? list.mHead : mWheelTasks[task.mPrev].mNext) = task.mNext;
+    (task.mNext == kWheelNoTask ? list.mTail : mWheelTasks[task.mNext].mPrev) = task.mPrev;
+    task.mList = nullptr;
+}
+
+void TaskRunner::MoveWheelTasks(WheelTaskList &aFrom, WheelTaskList &aTo)
+{
+    VerifyOrExit(aFrom.mHead != kWheelNoTask);
+
+    for (uint32_t index = aFrom.mHead; index != kWheelNoTask; index = mWheelTasks[index].mNext)
+    {
+        mWheelTasks[index].mList = &aTo;
+    }
+
+    if (aTo.mTail == kWheelNoTask)
+    {
+        aTo.mHead = aFrom.mHead;
+    }
+    else
+    {
+        mWheelTasks[aTo.mTail].mNext  = aFrom.mHead;
+        mWheelTasks[aFrom.mHead].mPrev = aTo.mTail;
+    }
+
+    aTo.mTail = aFrom.mTail;
+    aFrom     = WheelTaskList();
+
+exit:
+    return;
+}
+
+void TaskRunner::FreeWheelTask(uint32_t aIndex)
+{
+    WheelTask &task = mWheelTasks[aIndex];
+
+    UnlinkWheelTask(aIndex);
+    task.mTask = nullptr;
+    task.mNext = mWheelFreeTask;
+    ++task.mGeneration;
+    mWheelFreeTask = aIndex;
+    --mWheelTaskCount;
+}
+
+void TaskRunner::CollectWheelTasks(Timepoint aNow)
+{
+    Tick                  nowTick = ToWheelTick(aNow, /* aRoundUp */ false);
+    Tick                  lastTick;
+    std::vector<uint32_t> dueTasks;
+
+    VerifyOrExit(nowTick > mWheelTick);
+
+    // Every task in the slot of a passed tick is due, as the slots never hold tasks which
+    // are a whole wheel apart. Visiting the slots in order keeps the order of deadlines.
+    lastTick = std::min<Tick>(nowTick, (((mWheelTick >> kWheelPeriodShift) + 2) << kWheelPeriodShift) - 1);
+
+    for (Tick tick = mWheelTick + 1; tick <= lastTick; ++tick)
+    {
+        uint32_t slotIndex = tick & kWheelSlotMask;
+
+        MoveWheelTasks(mWheelSlots[slotIndex], mWheelDueTasks);
+        ClearWheelSlotBit(slotIndex);
+    }
+
+    mWheelTick = nowTick;
+
+    // Move the tasks of the next period into their slots. Those which became due while the
+    // mainloop was not run are sorted by their deadlines, the tasks of a period are not.
+    while (!mWheelOverflowTasks.empty() && IsInWheelSlots(mWheelOverflowTasks.begin()->first << kWheelPeriodShift))
+    {
+        WheelTaskList &period = mWheelOverflowTasks.begin()->second.mTasks;
+
+        while (period.mHead != kWheelNoTask)
+        {
+            uint32_t index = period.mHead;
+            Tick     tick  = mWheelTasks[index].mTick;
+
+            UnlinkWheelTask(index);
+
+            if (tick <= mWheelTick)
+            {
+                dueTasks.push_back(index);
+            }
+            else
+            {
+                LinkWheelTask(mWheelSlots[tick & kWheelSlotMask], index);
+                SetWheelSlotBit(tick & kWheelSlotMask);
+            }
+        }
+
+        mWheelOverflowTasks.erase(mWheelOverflowTasks.begin());
+    }
+
+    std::stable_sort(dueTasks.begin(), dueTasks.end(),
+                     [this](uint32_t aLhs, uint32_t aRhs) { return mWheelTasks[aLhs].mTick < mWheelTasks[aRhs].mTick; });
+
+    for (uint32_t index : dueTasks)
+    {
+        LinkWheelTask(mWheelDueTasks, index);
+    }
+
+exit:
+    return;
+}
+
+bool TaskRunner::GetNextWheelDeadline(Timepoint &aDeadline) const
+{
+    bool found = false;
+
+    if (mWheelDueTasks.mHead != kWheelNoTask)
+    {
+        aDeadline = MainloopClock::Now();
+        ExitNow(found = true);
+    }
+
+    // Find the first non-empty slot after the current tick, all of its tasks are due then.
+    for (uint32_t offset = 1; offset <= kWheelSlotCount;)
+    {
+        uint32_t slotIndex = (mWheelTick + offset) & kWheelSlotMask;
+        uint64_t word      = mWheelSlotBitmap[slotIndex / 64] >> (slotIndex % 64);
+
+        if (word == 0)
+        {
+            offset += 64 - (slotIndex % 64);
+            continue;
+        }
+
+        offset += __builtin_ctzll(word);
+
+        if (offset <= kWheelSlotCount)
+        {
+            aDeadline = mWheelEpoch + Milliseconds(mWheelTick + offset);
+            ExitNow(found = true);
+        }
+
+        break;
+    }
+
+    // The tasks of later periods are all after the slots.
+    if (!mWheelOverflowTasks.empty())
+    {
+        aDeadline = mWheelEpoch + Milliseconds(mWheelOverflowTasks.begin()->second.mFirstTick);
+        found     = true;
+    }
+
+exit:
+    return found;
+}
+
+bool TaskRunner::IsInWheelSlots(Tick aTick) const
+{
+    return (aTick >> kWheelPeriodShift) <= (mWheelTick >> kWheelPeriodShift) + 1;
+}
+
+void TaskRunner::SetWheelSlotBit(uint32_t aSlot)
+{
+    mWheelSlotBitmap[aSlot / 64] |= (uint64_t{1} << (aSlot % 64));
+}
+
+void TaskRunner::ClearWheelSlotBit(uint32_t aSlot)
+{
+    mWheelSlotBitmap[aSlot / 64] &= ~(uint64_t{1} << (aSlot % 64));
+}
+
 } // namespace otbr
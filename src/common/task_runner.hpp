@@ -36,17 +36,34 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
-#include <functional>
-#include <future>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <set>
+#include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/inline_function.hpp"
 #include "common/mainloop.hpp"
+#include "common/mpsc_queue.hpp"
 #include "common/time.hpp"
 
+#ifndef OTBR_ENABLE_TASK_RUNNER_TIMER_WHEEL
+#define OTBR_ENABLE_TASK_RUNNER_TIMER_WHEEL 0
+#endif
+
+/**
+ * The maximum number of background tasks executed per mainloop iteration.
+ *
+ */
+#ifndef OTBR_TASK_RUNNER_BACKGROUND_BUDGET
+#define OTBR_TASK_RUNNER_BACKGROUND_BUDGET 16
+#endif
+
 namespace otbr {
 
 /**
@@ -60,8 +77,10 @@ public:
     /**
      * This type represents the generic executable task.
      *
+     * Tasks are move-only, and captures up to 56 bytes are stored without heap allocation.
+     *
      */
-    template <class T> using Task = std::function<T(void)>;
+    template <class T> using Task = InlineFunction<T(void)>;
 
     /**
      * This type represents a unique task ID to an delayed task.
@@ -71,11 +90,42 @@ public:
      */
     typedef uint64_t TaskId;
 
+    /**
+     * This enumeration defines how the delayed tasks are stored.
+     *
+     */
+    enum class Mode : uint8_t
+    {
+        kHeap,       ///< A binary heap, canceled tasks are dropped when they expire.
+        kTimerWheel, ///< A timer wheel with O(1) cancellation, tasks due within 8 s are also inserted in O(1).
+    };
+
+    /**
+     * This enumeration defines the priority lanes of the tasks.
+     *
+     * The tasks of a lane are executed in the order they were posted, or of their deadlines.
+     *
+     */
+    enum class Priority : uint8_t
+    {
+        kCritical,   ///< Executed before the other tasks of a mainloop iteration, e.g. the spinel continuations.
+        kNormal,     ///< The default priority.
+        kBackground, ///< Executed after the other tasks, at most `OTBR_TASK_RUNNER_BACKGROUND_BUDGET` per iteration.
+    };
+
+    /**
+     * The default mode of the Task Runner.
+     *
+     */
+    static constexpr Mode kDefaultMode = OTBR_ENABLE_TASK_RUNNER_TIMER_WHEEL ? Mode::kTimerWheel : Mode::kHeap;
+
     /**
      * This constructor initializes the Task Runner instance.
      *
+     * @param[in] aMode  The way the delayed tasks are stored.
+     *
      */
-    TaskRunner(void);
+    explicit TaskRunner(Mode aMode = kDefaultMode);
 
     /**
      * This destructor destroys the Task Runner instance.
@@ -87,7 +137,8 @@ public:
      * This method posts a task to the task runner and returns immediately.
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * It is safe to call this method in different threads concurrently, it doesn't
+     * take any lock unless the queue of immediate tasks is full.
      *
      * @param[in] aTask  The task to be executed.
      *
@@ -108,6 +159,32 @@ public:
      */
     TaskId Post(Milliseconds aDelay, Task<void> aTask);
 
+    /**
+     * This method posts a task of a priority to the task runner and returns immediately.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aPriority  The priority of the task.
+     * @param[in] aTask      The task to be executed.
+     *
+     */
+    void Post(Priority aPriority, Task<void> aTask);
+
+    /**
+     * This method posts a delayed task of a priority to the task runner and returns immediately.
+     *
+     * The task joins its priority lane once it's due. It is safe to call this method in different threads
+     * concurrently.
+     *
+     * @param[in] aPriority  The priority of the task.
+     * @param[in] aDelay     The delay before executing the task (in milliseconds).
+     * @param[in] aTask      The task to be executed.
+     *
+     * @returns  The unique task ID of the delayed task.
+     *
+     */
+    TaskId Post(Priority aPriority, Milliseconds aDelay, Task<void> aTask);
+
     /**
      * This method cancels a delayed task from the task runner.
      * It is safe to call this method in different threads concurrently.
@@ -117,6 +194,17 @@ public:
      */
     void Cancel(TaskId aTaskId);
 
+    /**
+     * This method returns the number of tasks held by the task runner.
+     *
+     * The immediate tasks in the lock-free queue are not counted, they don't allocate memory. The canceled delayed
+     * tasks are counted until they are due, as they are only released then.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     */
+    size_t GetPendingTaskCount(void);
+
     /**
      * This method posts a task and waits for the completion of the task.
      *
@@ -127,17 +215,18 @@ public:
      * @returns The result returned by the task @p aTask.
      *
      */
-    template <class T> T PostAndWait(const Task<T> &aTask)
+    template <class T> T PostAndWait(Task<T> aTask)
     {
-        std::promise<T> pro;
+        Completion<T> completion;
 
-        Post([&pro, &aTask]() { pro.set_value(aTask()); });
+        Post([&completion, &aTask]() { completion.Complete(aTask()); });
 
-        return pro.get_future().get();
+        return completion.Wait();
     }
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "TaskRunner"; }
 
 private:
     enum
@@ -146,6 +235,46 @@ private:
         kWrite = 1,
     };
 
+    // A stack allocated replacement of std::promise/std::future, which
+    // allocates its shared state on the heap.
+    template <class T> class Completion : private NonCopyable
+    {
+    public:
+        Completion(void) = default;
+
+        void Complete(T &&aResult)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            new (&mResult) T(std::move(aResult));
+            mDone = true;
+
+            // Notify with the mutex held, the waiter destroys this object once it returns.
+            mCondition.notify_one();
+        }
+
+        T Wait(void)
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            T                           *result;
+
+            mCondition.wait(lock, [this]() { return mDone; });
+            result = reinterpret_cast<T *>(&mResult);
+
+            T rval(std::move(*result));
+
+            result->~T();
+
+            return rval;
+        }
+
+    private:
+        std::mutex                                                 mMutex;
+        std::condition_variable                                    mCondition;
+        bool                                                       mDone = false;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type mResult;
+    };
+
     struct DelayedTask
     {
         friend class Comparator;
@@ -155,9 +284,10 @@ private:
             bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
         };
 
-        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Task<void> aTask)
+        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Priority aPriority, Task<void> aTask)
             : mTaskId(aTaskId)
-            , mDeadline(Clock::now() + aDelay)
+            , mDeadline(MainloopClock::Now() + aDelay)
+            , mPriority(aPriority)
             , mTask(std::move(aTask))
         {
         }
@@ -171,11 +301,77 @@ private:
 
         TaskId     mTaskId;
         Timepoint  mDeadline;
+        Priority   mPriority;
         Task<void> mTask;
     };
 
-    TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
+    // The timer wheel has 8192 slots of 1 ms which hold the tasks of the current
+    // and the next period of 4096 ms. The tasks of later periods wait in
+    // `mWheelOverflowTasks` until the wheel enters the period before theirs.
+    static constexpr uint32_t kWheelSlotCount   = 8192;
+    static constexpr uint32_t kWheelSlotMask    = kWheelSlotCount - 1;
+    static constexpr uint32_t kWheelPeriodShift = 12;
+    static constexpr uint32_t kWheelNoTask      = UINT32_MAX;
+
+    typedef uint64_t Tick;
+
+    // The wheel tasks are linked by their indexes in `mWheelTasks`. The index and
+    // the generation of the storage make up the task ID, so that a task is found
+    // and unlinked in O(1) when it's canceled.
+    struct WheelTaskList
+    {
+        uint32_t mHead = kWheelNoTask;
+        uint32_t mTail = kWheelNoTask;
+    };
+
+    struct WheelTask
+    {
+        uint32_t       mGeneration = 1;
+        uint32_t       mPrev       = kWheelNoTask;
+        uint32_t       mNext       = kWheelNoTask;
+        WheelTaskList *mList       = nullptr;
+        Tick           mTick       = 0;
+        Priority       mPriority   = Priority::kNormal;
+        Task<void>     mTask;
+    };
+
+    struct WheelPeriod
+    {
+        WheelTaskList mTasks;
+        Tick          mFirstTick; // Not updated when a task is canceled.
+    };
+
+    // The capacity of the lock-free queue of immediate tasks, tasks
+    // posted while it is full go to `mOverflowTasks`.
+    static constexpr size_t kImmediateTaskQueueSize = 1024;
+
+    static constexpr size_t kBackgroundTaskBudget = OTBR_TASK_RUNNER_BACKGROUND_BUDGET;
+
+    static_assert(kBackgroundTaskBudget > 0, "OTBR_TASK_RUNNER_BACKGROUND_BUDGET must be greater than 0");
+
+    void   PushImmediateTask(Task<void> aTask);
+    void   PopImmediateTasks(void);
+    void   WakeUp(void);
+    TaskId PushTask(Milliseconds aDelay, Priority aPriority, Task<void> aTask);
     void   PopTasks(void);
+    void   PopHeapTasks(void);
+    void   PopWheelTasks(void);
+    void   RunDueTask(Priority aPriority, Task<void> &aTask);
+    void   PopCriticalTasks(void);
+    void   PopBackgroundTasks(void);
+
+    TaskId PushWheelTask(Milliseconds aDelay, Priority aPriority, Task<void> aTask);
+    void   CancelWheelTask(TaskId aTaskId);
+    void   CollectWheelTasks(Timepoint aNow);
+    bool   GetNextWheelDeadline(Timepoint &aDeadline) const;
+    void   LinkWheelTask(WheelTaskList &aList, uint32_t aIndex);
+    void   UnlinkWheelTask(uint32_t aIndex);
+    void   MoveWheelTasks(WheelTaskList &aFrom, WheelTaskList &aTo);
+    void   FreeWheelTask(uint32_t aIndex);
+    Tick   ToWheelTick(Timepoint aTime, bool aRoundUp) const;
+    bool   IsInWheelSlots(Tick aTick) const;
+    void   SetWheelSlotBit(uint32_t aSlot);
+    void   ClearWheelSlotBit(uint32_t aSlot);
 
     // The event fds which are used to wakeup the mainloop
     // when there are pending tasks in the task queue.
@@ -185,9 +381,39 @@ private:
 
     std::set<TaskId> mActiveTaskIds;
     TaskId           mNextTaskId = 1;
+    const Mode       mMode;
+
+    // The timer wheel, only used in `Mode::kTimerWheel`.
+    Timepoint                   mWheelEpoch;
+    Tick                        mWheelTick;
+    std::vector<WheelTask>      mWheelTasks;
+    size_t                      mWheelTaskCount = 0;
+    std::vector<WheelTaskList>  mWheelSlots;
+    std::vector<uint64_t>       mWheelSlotBitmap;
+    std::map<Tick, WheelPeriod> mWheelOverflowTasks;
+    WheelTaskList               mWheelDueTasks;
+    uint32_t                    mWheelFreeTask = kWheelNoTask; // The free storages are linked by `mNext`.
+
+    // Immediate tasks don't need the heap or the wheel. Once a task is put
+    // into `mOverflowTasks`, later tasks follow it until the overflow is
+    // drained, so the tasks of a single thread are never reordered.
+    MpscQueue<Task<void>, kImmediateTaskQueueSize> mImmediateTasks;
+    std::deque<Task<void>>                         mOverflowTasks;
+    std::atomic<bool>                              mHasOverflowTasks{false};
+
+    // The lanes of the critical and background tasks, the normal ones are the immediate tasks above.
+    std::deque<Task<void>> mCriticalTasks;
+    std::deque<Task<void>> mBackgroundTasks;
+
+    // The critical tasks being executed, kept to reuse its storage.
+    std::deque<Task<void>> mRunningCriticalTasks;
+
+    // Whether a byte was written to `mEventFd` which has not been consumed by
+    // `Process()` yet, only the first of a burst of posts writes to the pipe.
+    std::atomic<bool> mWakeupPending{false};
 
-    // The mutex which protects the `mTaskQueue` from being
-    // simultaneously accessed by multiple threads.
+    // The mutex which protects the `mTaskQueue` and `mOverflowTasks`
+    // from being simultaneously accessed by multiple threads.
     std::mutex mTaskQueueMutex;
 };
 
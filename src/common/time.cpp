@@ -0,0 +1,84 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the monotonic time cached by the mainloop.
+ */
+
+#include "common/time.hpp"
+
+#include <time.h>
+
+namespace otbr {
+
+namespace {
+
+struct CachedTime
+{
+    bool      mValid = false;
+    Timepoint mNow;
+};
+
+thread_local CachedTime sCachedTime;
+
+Timepoint ReadClock(void)
+{
+#if OTBR_MAINLOOP_COARSE_CLOCK && defined(CLOCK_MONOTONIC_COARSE)
+    struct timespec now;
+
+    // The steady clock also reads `CLOCK_MONOTONIC`, which the coarse clock shares the epoch with.
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &now) == 0)
+    {
+        return Timepoint(std::chrono::duration_cast<Clock::duration>(Seconds(now.tv_sec) +
+                                                                     std::chrono::nanoseconds(now.tv_nsec)));
+    }
+#endif
+
+    return Clock::now();
+}
+
+} // namespace
+
+Timepoint MainloopClock::Now(void)
+{
+    return sCachedTime.mValid ? sCachedTime.mNow : Clock::now();
+}
+
+void MainloopClock::Refresh(void)
+{
+    sCachedTime.mNow   = ReadClock();
+    sCachedTime.mValid = true;
+}
+
+void MainloopClock::Reset(void)
+{
+    sCachedTime.mValid = false;
+}
+
+} // namespace otbr
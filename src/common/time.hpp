@@ -42,6 +42,15 @@
 
 #include <sys/time.h>
 
+/**
+ * Set to 1 to read the time cached by the mainloop from the coarse monotonic clock, which is cheaper to read but only
+ * precise to a few milliseconds, so the timers may fire that much later.
+ *
+ */
+#ifndef OTBR_MAINLOOP_COARSE_CLOCK
+#define OTBR_MAINLOOP_COARSE_CLOCK 0
+#endif
+
 namespace otbr {
 
 using Seconds      = std::chrono::seconds;
@@ -68,6 +77,38 @@ template <class D> timeval ToTimeval(const D &aDuration)
     return ret;
 }
 
+/**
+ * This class implements the monotonic time cached for a phase of the mainloop iteration.
+ *
+ * The mainloop reads the clock once before updating the processors and once before processing them, so that all the
+ * timeouts of a phase are computed from the same time instead of each reading the clock. The time is cached per
+ * thread, `Now()` reads the clock outside of the phases and on the threads not running a mainloop.
+ *
+ */
+class MainloopClock
+{
+public:
+    /**
+     * This method returns the time cached by the mainloop of the calling thread, or the current time.
+     *
+     * @returns The monotonic time.
+     *
+     */
+    static Timepoint Now(void);
+
+    /**
+     * This method caches the current time for the calling thread, until `Reset()` is called.
+     *
+     */
+    static void Refresh(void);
+
+    /**
+     * This method stops caching the time for the calling thread.
+     *
+     */
+    static void Reset(void);
+};
+
 } // namespace otbr
 
 #endif // OTBR_COMMON_TIME_HPP_
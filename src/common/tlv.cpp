@@ -0,0 +1,181 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the iterator and the editor of the TLVs.
+ */
+
+#include "common/tlv.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+constexpr uint8_t TlvIterator::kLengthEscape;
+constexpr size_t  TlvIterator::kHeaderSize;
+constexpr size_t  TlvIterator::kExtendedHeaderSize;
+
+size_t TlvIterator::GetSize(void) const
+{
+    size_t remaining = static_cast<size_t>(mEnd - mCur);
+    size_t size      = 0;
+
+    VerifyOrExit(remaining >= kHeaderSize);
+
+    if (mCur[1] != kLengthEscape)
+    {
+        size = kHeaderSize + mCur[1];
+    }
+    else
+    {
+        VerifyOrExit(remaining >= kExtendedHeaderSize);
+        size = kExtendedHeaderSize + static_cast<uint16_t>(mCur[2] << 8 | mCur[3]);
+    }
+
+    VerifyOrExit(size <= remaining, size = 0);
+
+exit:
+    return size;
+}
+
+bool TlvView::Find(uint8_t aType, TlvIterator &aIterator) const
+{
+    bool found = false;
+
+    for (const TlvIterator &tlv : *this)
+    {
+        if (tlv.GetType() == aType)
+        {
+            aIterator = tlv;
+            ExitNow(found = true);
+        }
+    }
+
+exit:
+    return found;
+}
+
+bool TlvView::IsWellFormed(void) const
+{
+    TlvIterator it = begin();
+
+    while (!it.IsDone())
+    {
+        ++it;
+    }
+
+    return it.GetTlv() == mTlvs + mLength;
+}
+
+otbrError TlvEditor::Set(uint8_t aType, const void *aValue, uint16_t aLength)
+{
+    return Replace(aType, aValue, aLength, /* aRemove */ false);
+}
+
+otbrError TlvEditor::SetUint32(uint8_t aType, uint32_t aValue)
+{
+    uint8_t value[sizeof(aValue)];
+
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        value[i] = static_cast<uint8_t>(aValue >> (8 * (sizeof(value) - i - 1)));
+    }
+
+    return Set(aType, value, sizeof(value));
+}
+
+otbrError TlvEditor::SetUint64(uint8_t aType, uint64_t aValue)
+{
+    uint8_t value[sizeof(aValue)];
+
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        value[i] = static_cast<uint8_t>(aValue >> (8 * (sizeof(value) - i - 1)));
+    }
+
+    return Set(aType, value, sizeof(value));
+}
+
+otbrError TlvEditor::Remove(uint8_t aType)
+{
+    return Replace(aType, nullptr, 0, /* aRemove */ true);
+}
+
+otbrError TlvEditor::Replace(uint8_t aType, const void *aValue, uint16_t aLength, bool aRemove)
+{
+    otbrError   error   = OTBR_ERROR_NONE;
+    TlvView     view    = GetView();
+    TlvIterator tlv     = view.begin();
+    size_t      offset  = mLength;
+    size_t      oldSize = 0;
+    size_t      newSize = 0;
+    uint8_t    *cur;
+
+    VerifyOrExit(view.IsWellFormed(), error = OTBR_ERROR_PARSE);
+
+    if (view.Find(aType, tlv))
+    {
+        offset  = static_cast<size_t>(tlv.GetTlv() - mTlvs);
+        oldSize = tlv.GetSize();
+    }
+    else
+    {
+        VerifyOrExit(!aRemove, error = OTBR_ERROR_NOT_FOUND);
+    }
+
+    if (!aRemove)
+    {
+        newSize = (aLength < 0xff ? sizeof(uint8_t) : sizeof(uint8_t) + sizeof(uint16_t)) + sizeof(uint8_t) + aLength;
+    }
+
+    VerifyOrExit(mLength - oldSize + newSize <= mCapacity, error = OTBR_ERROR_INVALID_ARGS);
+
+    // Only the TLVs after the edited one are moved.
+    cur = mTlvs + offset;
+    memmove(cur + newSize, cur + oldSize, mLength - offset - oldSize);
+    mLength = mLength - oldSize + newSize;
+
+    VerifyOrExit(!aRemove);
+
+    reinterpret_cast<Tlv *>(cur)->SetType(aType);
+
+    if (aLength == 0)
+    {
+        reinterpret_cast<Tlv *>(cur)->SetLength(0);
+    }
+    else
+    {
+        reinterpret_cast<Tlv *>(cur)->SetValue(aValue, aLength);
+    }
+
+exit:
+    return error;
+}
+
+} // namespace otbr
@@ -36,9 +36,12 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "common/types.hpp"
+
 namespace otbr {
 
 /**
@@ -242,6 +245,220 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class implements a bounds-checked iterator over the TLVs of a buffer.
+ *
+ * The iterator refers to the TLVs in the buffer without copying them, and is done at the end of the buffer or at the
+ * first TLV overrunning it.
+ *
+ */
+class TlvIterator
+{
+public:
+    /**
+     * The constructor to iterate the TLVs of a buffer.
+     *
+     * @param[in] aTlvs    A pointer to the TLVs.
+     * @param[in] aLength  The length of the TLVs in bytes.
+     *
+     */
+    constexpr TlvIterator(const uint8_t *aTlvs, size_t aLength)
+        : mCur(aTlvs)
+        , mEnd(aTlvs + aLength)
+    {
+    }
+
+    /**
+     * This method indicates whether the iteration is done, at the end of the buffer or at a malformed TLV.
+     *
+     */
+    bool IsDone(void) const { return GetSize() == 0; }
+
+    /**
+     * This method returns the type of the current TLV, the iteration must not be done.
+     *
+     */
+    uint8_t GetType(void) const { return mCur[0]; }
+
+    /**
+     * This method returns the value length of the current TLV, the iteration must not be done.
+     *
+     */
+    uint16_t GetLength(void) const { return static_cast<uint16_t>(GetSize() - GetHeaderSize()); }
+
+    /**
+     * This method returns a pointer to the value of the current TLV, the iteration must not be done.
+     *
+     */
+    const uint8_t *GetValue(void) const { return mCur + GetHeaderSize(); }
+
+    /**
+     * This method returns a pointer to the current TLV, or to where the iteration is done.
+     *
+     */
+    const uint8_t *GetTlv(void) const { return mCur; }
+
+    /**
+     * This method returns the size of the current TLV, including its type and length.
+     *
+     * @returns The size of the current TLV, or 0 if the iteration is done.
+     *
+     */
+    size_t GetSize(void) const;
+
+    /**
+     * This method moves to the next TLV, the iteration must not be done.
+     *
+     */
+    TlvIterator &operator++(void)
+    {
+        mCur += GetSize();
+        return *this;
+    }
+
+    const TlvIterator &operator*(void) const { return *this; }
+
+    bool operator!=(const TlvIterator &aOther) const
+    {
+        return IsDone() != aOther.IsDone() || (!IsDone() && mCur != aOther.mCur);
+    }
+
+private:
+    size_t GetHeaderSize(void) const { return mCur[1] == kLengthEscape ? kExtendedHeaderSize : kHeaderSize; }
+
+    static constexpr uint8_t kLengthEscape      = 0xff;
+    static constexpr size_t  kHeaderSize         = sizeof(uint8_t) + sizeof(uint8_t);
+    static constexpr size_t  kExtendedHeaderSize = kHeaderSize + sizeof(uint16_t);
+
+    const uint8_t *mCur;
+    const uint8_t *mEnd;
+};
+
+/**
+ * This class implements a read-only view of the TLVs of a buffer, e.g. an operational dataset.
+ *
+ * Example usage:
+ *  for (const TlvIterator &tlv : TlvView(aDatasetTlvs.mTlvs, aDatasetTlvs.mLength))
+ *  {
+ *      ...
+ *  }
+ *
+ */
+class TlvView
+{
+public:
+    constexpr TlvView(const uint8_t *aTlvs, size_t aLength)
+        : mTlvs(aTlvs)
+        , mLength(aLength)
+    {
+    }
+
+    TlvIterator begin(void) const { return TlvIterator(mTlvs, mLength); }
+    TlvIterator end(void) const { return TlvIterator(mTlvs + mLength, 0); }
+
+    /**
+     * This method finds the first TLV of a type.
+     *
+     * @param[in]  aType      The TLV type.
+     * @param[out] aIterator  The iterator at the TLV found.
+     *
+     * @retval TRUE   Found the TLV.
+     * @retval FALSE  There is no well-formed TLV of the type.
+     *
+     */
+    bool Find(uint8_t aType, TlvIterator &aIterator) const;
+
+    /**
+     * This method indicates whether the TLVs fill the buffer exactly, without overrunning it.
+     *
+     */
+    bool IsWellFormed(void) const;
+
+private:
+    const uint8_t *mTlvs;
+    size_t         mLength;
+};
+
+/**
+ * This class implements an in-place editor of the TLVs of a buffer.
+ *
+ * A TLV is replaced or inserted by moving only the TLVs after it, the others are neither parsed nor re-encoded.
+ *
+ */
+class TlvEditor
+{
+public:
+    /**
+     * The constructor to edit the TLVs of a buffer.
+     *
+     * @param[in] aTlvs      A pointer to the buffer of the TLVs.
+     * @param[in] aLength    The length of the TLVs in bytes.
+     * @param[in] aCapacity  The size of the buffer in bytes.
+     *
+     */
+    TlvEditor(uint8_t *aTlvs, size_t aLength, size_t aCapacity)
+        : mTlvs(aTlvs)
+        , mLength(aLength)
+        , mCapacity(aCapacity)
+    {
+    }
+
+    /**
+     * This method returns the length of the TLVs in bytes, after the edits.
+     *
+     */
+    size_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method returns a view of the TLVs.
+     *
+     */
+    TlvView GetView(void) const { return TlvView(mTlvs, mLength); }
+
+    /**
+     * This method replaces the value of the first TLV of a type, or appends the TLV if there isn't any.
+     *
+     * @param[in] aType    The TLV type.
+     * @param[in] aValue   A pointer to the value, which must not be in the edited buffer.
+     * @param[in] aLength  The length of the value in bytes.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully set the TLV.
+     * @retval OTBR_ERROR_PARSE         The TLVs are malformed.
+     * @retval OTBR_ERROR_INVALID_ARGS  There isn't enough space in the buffer for the TLV.
+     *
+     */
+    otbrError Set(uint8_t aType, const void *aValue, uint16_t aLength);
+
+    /**
+     * This method sets a TLV to a big-endian uint32_t value.
+     *
+     */
+    otbrError SetUint32(uint8_t aType, uint32_t aValue);
+
+    /**
+     * This method sets a TLV to a big-endian uint64_t value.
+     *
+     */
+    otbrError SetUint64(uint8_t aType, uint64_t aValue);
+
+    /**
+     * This method removes the first TLV of a type.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully removed the TLV.
+     * @retval OTBR_ERROR_PARSE      The TLVs are malformed.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no TLV of the type.
+     *
+     */
+    otbrError Remove(uint8_t aType);
+
+private:
+    otbrError Replace(uint8_t aType, const void *aValue, uint16_t aLength, bool aRemove);
+
+    uint8_t *mTlvs;
+    size_t   mLength;
+    size_t   mCapacity;
+};
+
 namespace Meshcop {
 
 enum
@@ -27,7 +27,9 @@
  */
 
 #include <arpa/inet.h>
+#include <algorithm>
 #include <sstream>
+#include <type_traits>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
@@ -46,9 +48,13 @@ Ip6Address::Ip6Address(const otIp6Address &aAddress)
     memcpy(m8, aAddress.mFields.m8, sizeof(m8));
 }
 
+static_assert(std::is_trivially_copyable<Ip6Address>::value, "Ip6Address must be copyable as bytes");
+static_assert(std::is_trivially_copyable<Ip6Prefix>::value, "Ip6Prefix must be copyable as bytes");
+static_assert(std::is_trivially_copyable<MacAddress>::value, "MacAddress must be copyable as bytes");
+
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
     VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
                 "Failed to convert Ip6 address to string");
@@ -56,6 +62,38 @@ std::string Ip6Address::ToString() const
     return std::string(strbuf);
 }
 
+const char *Ip6Address::ToString(char *aBuffer, size_t aSize) const
+{
+    if (inet_ntop(AF_INET6, m8, aBuffer, aSize) == nullptr && aSize > 0)
+    {
+        aBuffer[0] = '\0';
+    }
+
+    return aBuffer;
+}
+
+uint8_t Ip6Address::GetPrefixMatchLength(const Ip6Address &aOther) const
+{
+    uint8_t length = 0;
+
+    // Compares 64 bits at a time, the first differing bit is the leading one of the XOR in host byte order.
+    for (size_t i = 0; i < sizeof(m64) / sizeof(m64[0]); i++)
+    {
+        uint64_t diff = be64toh(m64[i] ^ aOther.m64[i]);
+
+        if (diff != 0)
+        {
+            length += static_cast<uint8_t>(__builtin_clzll(diff));
+            ExitNow();
+        }
+
+        length += 64;
+    }
+
+exit:
+    return length;
+}
+
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
 {
     Ip6Address ma(Ip6Address::GetSolicitedMulticastAddressPrefix());
@@ -111,36 +149,48 @@ Ip6Address Ip6Address::FromString(const char *aStr)
 
 bool Ip6Prefix::operator==(const Ip6Prefix &aOther) const
 {
-    bool    isEqual = false;
-    uint8_t lengthFullBytes;     // the number of complete bytes in the prefix length
-    uint8_t lengthRemainingBits; // the number of remaining bits in the prefix length that do not form a complete byte
+    return mLength == aOther.mLength && ContainsAddress(aOther.mPrefix);
+}
+
+bool Ip6Prefix::operator!=(const Ip6Prefix &aOther) const
+{
+    return !(*this == aOther);
+}
+
+void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
+{
+    memcpy(reinterpret_cast<void *>(this), &aPrefix, sizeof(*this));
+}
 
-    VerifyOrExit(mLength == aOther.mLength);
+const char *Ip6Prefix::ToString(char *aBuffer, size_t aSize) const
+{
+    size_t length;
 
-    lengthFullBytes     = mLength / 8;
-    lengthRemainingBits = mLength % 8;
-    VerifyOrExit(memcmp(mPrefix.m8, aOther.mPrefix.m8, lengthFullBytes) == 0);
+    VerifyOrExit(aSize > 0);
 
-    if (lengthRemainingBits > 0)
+    length = strlen(mPrefix.ToString(aBuffer, aSize));
+    if (length == 0 || snprintf(aBuffer + length, aSize - length, "/%d", mLength) >= static_cast<int>(aSize - length))
     {
-        uint8_t mask = 0xff << (8 - lengthRemainingBits);
-        VerifyOrExit((mPrefix.m8[lengthFullBytes] & mask) == (aOther.mPrefix.m8[lengthFullBytes] & mask));
+        aBuffer[0] = '\0';
     }
 
-    isEqual = true;
-
 exit:
-    return isEqual;
+    return aBuffer;
 }
 
-bool Ip6Prefix::operator!=(const Ip6Prefix &aOther) const
+size_t Ip6PrefixHash::operator()(const Ip6Prefix &aPrefix) const
 {
-    return !(*this == aOther);
-}
+    uint64_t hash = aPrefix.mLength;
 
-void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
-{
-    memcpy(reinterpret_cast<void *>(this), &aPrefix, sizeof(*this));
+    for (size_t i = 0; i < sizeof(aPrefix.mPrefix.m64) / sizeof(aPrefix.mPrefix.m64[0]); i++)
+    {
+        int      bits = std::min(std::max(aPrefix.mLength - static_cast<int>(i) * 64, 0), 64);
+        uint64_t mask = (bits == 0) ? 0 : ~uint64_t(0) << (64 - bits);
+
+        hash = hash * 1099511628211ull ^ (be64toh(aPrefix.mPrefix.m64[i]) & mask);
+    }
+
+    return static_cast<size_t>(hash);
 }
 
 std::string Ip6Prefix::ToString() const
@@ -162,11 +212,62 @@ std::string Ip6Prefix::ToString() const
 
 std::string MacAddress::ToString(void) const
 {
-    char strbuf[sizeof(m8) * 3];
+    char strbuf[kStringSize];
+
+    return std::string(ToString(strbuf, sizeof(strbuf)));
+}
+
+const char *MacAddress::ToString(char *aBuffer, size_t aSize) const
+{
+    snprintf(aBuffer, aSize, "%02x:%02x:%02x:%02x:%02x:%02x", m8[0], m8[1], m8[2], m8[3], m8[4], m8[5]);
+
+    return aBuffer;
+}
 
-    snprintf(strbuf, sizeof(strbuf), "%02x:%02x:%02x:%02x:%02x:%02x", m8[0], m8[1], m8[2], m8[3], m8[4], m8[5]);
+const uint32_t MdnsLatencyHistogram::kBucketUpperBounds[] = {10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000};
 
-    return std::string(strbuf);
+void MdnsLatencyHistogram::Record(uint32_t aLatency)
+{
+    uint8_t bucket = 0;
+
+    while (bucket < kNumBuckets - 1 && aLatency >= kBucketUpperBounds[bucket])
+    {
+        bucket++;
+    }
+
+    mBucketCounts[bucket]++;
+    mMaxLatency = std::max(mMaxLatency, aLatency);
+}
+
+uint32_t MdnsLatencyHistogram::GetPercentile(uint8_t aPercentile) const
+{
+    uint64_t total      = 0;
+    uint64_t cumulative = 0;
+    uint64_t rank;
+    uint32_t percentile = 0;
+
+    for (uint32_t count : mBucketCounts)
+    {
+        total += count;
+    }
+    VerifyOrExit(total > 0);
+
+    // The rank of the percentile among all the recorded latencies, rounded up.
+    rank = (total * aPercentile + 99) / 100;
+
+    for (uint8_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        cumulative += mBucketCounts[bucket];
+
+        if (cumulative >= rank)
+        {
+            percentile = (bucket < kNumBuckets - 1) ? std::min(kBucketUpperBounds[bucket], mMaxLatency) : mMaxLatency;
+            break;
+        }
+    }
+
+exit:
+    return percentile;
 }
 
 otError OtbrErrorToOtError(otbrError aError)
@@ -39,6 +39,8 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
+#include <array>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -112,6 +114,8 @@ static constexpr char kLinkLocalAllNodesMulticastAddress[] = "ff02::01";
 class Ip6Address
 {
 public:
+    static constexpr size_t kStringSize = INET6_ADDRSTRLEN; ///< The size of a string representation buffer.
+
     /**
      * Default constructor.
      *
@@ -215,6 +219,27 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 address to a buffer, without allocating memory.
+     *
+     * @param[out] aBuffer  A pointer to the buffer to write the string representation to.
+     * @param[in]  aSize    The size of @p aBuffer, `kStringSize` fits any Ip6 address.
+     *
+     * @returns @p aBuffer, containing an empty string if it is too small.
+     *
+     */
+    const char *ToString(char *aBuffer, size_t aSize) const;
+
+    /**
+     * This method returns the length of the prefix the Ip6 address has in common with another one.
+     *
+     * @param[in] aOther  The Ip6 address to compare with.
+     *
+     * @returns The number of leading bits, from 0 to 128, of the two Ip6 addresses which are equal.
+     *
+     */
+    uint8_t GetPrefixMatchLength(const Ip6Address &aOther) const;
+
     /**
      * This method indicates whether or not the Ip6 address is the Unspecified Address.
      *
@@ -331,6 +356,19 @@ private:
     static Ip6Address FromString(const char *aStr);
 };
 
+/**
+ * This structure implements the hash of an Ip6 address for hashed containers.
+ *
+ */
+struct Ip6AddressHash
+{
+    size_t operator()(const Ip6Address &aAddress) const
+    {
+        // The addresses mostly differ in their low bits, i.e. the interface identifier or the group id.
+        return static_cast<size_t>(aAddress.m64[1] ^ (aAddress.m64[0] >> 1));
+    }
+};
+
 /**
  * This class represents a Ipv6 prefix.
  *
@@ -338,6 +376,12 @@ private:
 class Ip6Prefix
 {
 public:
+    /**
+     * The size of a string representation buffer.
+     *
+     */
+    static constexpr size_t kStringSize = Ip6Address::kStringSize + sizeof("/128") - 1;
+
     /**
      * Default constructor.
      *
@@ -397,6 +441,27 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 prefix to a buffer, without allocating memory.
+     *
+     * @param[out] aBuffer  A pointer to the buffer to write the string representation to.
+     * @param[in]  aSize    The size of @p aBuffer, `kStringSize` fits any Ip6 prefix.
+     *
+     * @returns @p aBuffer, containing an empty string if it is too small.
+     *
+     */
+    const char *ToString(char *aBuffer, size_t aSize) const;
+
+    /**
+     * This method indicates whether or not an Ip6 address is within the Ip6 prefix.
+     *
+     * @param[in] aAddress  The Ip6 address to check.
+     *
+     * @returns Whether the first `mLength` bits of @p aAddress are those of the Ip6 prefix.
+     *
+     */
+    bool ContainsAddress(const Ip6Address &aAddress) const { return mPrefix.GetPrefixMatchLength(aAddress) >= mLength; }
+
     /**
      * This method clears the Ip6 prefix to be unspecified.
      *
@@ -431,6 +496,17 @@ public:
     uint8_t    mLength; ///< The IPv6 prefix length (in bits).
 };
 
+/**
+ * This structure implements the hash of an Ip6 prefix for hashed containers.
+ *
+ * Like the `==` operator, it ignores the bits of the address after the prefix length.
+ *
+ */
+struct Ip6PrefixHash
+{
+    size_t operator()(const Ip6Prefix &aPrefix) const;
+};
+
 /**
  * This class represents a Ipv6 address and its info.
  *
@@ -461,7 +537,24 @@ public:
     bool         mPreferred : 1;
     bool         mMeshLocal : 1;
 
-    bool operator==(const Ip6AddressInfo &aOther) const { return memcmp(this, &aOther, sizeof(Ip6AddressInfo)) == 0; }
+    bool operator==(const Ip6AddressInfo &aOther) const { return Compare(aOther) == 0; }
+
+    bool operator<(const Ip6AddressInfo &aOther) const { return Compare(aOther) < 0; }
+
+private:
+    // Compares field by field, the padding bits are not initialized by the non-default constructor.
+    int Compare(const Ip6AddressInfo &aOther) const
+    {
+        int result = memcmp(&mAddress, &aOther.mAddress, sizeof(mAddress));
+
+        if (result == 0)
+        {
+            result = (mPrefixLength << 6 | mScope << 2 | mPreferred << 1 | mMeshLocal) -
+                     (aOther.mPrefixLength << 6 | aOther.mScope << 2 | aOther.mPreferred << 1 | aOther.mMeshLocal);
+        }
+
+        return result;
+    }
 };
 
 /**
@@ -481,6 +574,31 @@ public:
         m16[2] = 0;
     }
 
+    static constexpr size_t kStringSize = sizeof("00:00:00:00:00:00"); ///< The size of a string representation buffer.
+
+    /**
+     * This method overloads `==` operator and compares if the MAC address is equal to the other address.
+     *
+     * @param[in] aOther  The other MAC address to compare with.
+     *
+     * @returns Whether the MAC address is equal to @p aOther.
+     *
+     */
+    bool operator==(const MacAddress &aOther) const
+    {
+        return m16[0] == aOther.m16[0] && m16[1] == aOther.m16[1] && m16[2] == aOther.m16[2];
+    }
+
+    /**
+     * This method overloads `!=` operator and compares if the MAC address is NOT equal to the other address.
+     *
+     * @param[in] aOther  The other MAC address to compare with.
+     *
+     * @returns Whether the MAC address is NOT equal to @p aOther.
+     *
+     */
+    bool operator!=(const MacAddress &aOther) const { return !(*this == aOther); }
+
     /**
      * This method returns the string representation for the MAC address.
      *
@@ -489,6 +607,17 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the MAC address to a buffer, without allocating memory.
+     *
+     * @param[out] aBuffer  A pointer to the buffer to write the string representation to.
+     * @param[in]  aSize    The size of @p aBuffer, `kStringSize` fits any MAC address.
+     *
+     * @returns @p aBuffer, containing a truncated string if it is too small.
+     *
+     */
+    const char *ToString(char *aBuffer, size_t aSize) const;
+
     union
     {
         uint8_t  m8[6];
@@ -496,6 +625,20 @@ public:
     };
 };
 
+/**
+ * This structure implements the hash of a MAC address for hashed containers.
+ *
+ */
+struct MacAddressHash
+{
+    size_t operator()(const MacAddress &aAddress) const
+    {
+        // The NIC specific part, in the low bytes, varies the most.
+        return static_cast<size_t>(static_cast<uint64_t>(aAddress.m16[2]) << 32 ^
+                                   static_cast<uint64_t>(aAddress.m16[1]) << 16 ^ aAddress.m16[0]);
+    }
+};
+
 struct MdnsResponseCounters
 {
     uint32_t mSuccess;        ///< The number of successful responses
@@ -508,6 +651,43 @@ struct MdnsResponseCounters
     uint32_t mInvalidState;   ///< The number of 'invalid state' responses
 };
 
+/**
+ * This structure represents a fixed-bucket histogram of the latencies of an mDNS operation.
+ *
+ */
+struct MdnsLatencyHistogram
+{
+    static constexpr uint8_t kNumBuckets = 12;
+
+    /**
+     * The upper bounds (exclusive) in milliseconds of the buckets, the last bucket is unbounded.
+     *
+     */
+    static const uint32_t kBucketUpperBounds[kNumBuckets - 1];
+
+    std::array<uint32_t, kNumBuckets> mBucketCounts; ///< The number of operations in each bucket
+    uint32_t                          mMaxLatency;   ///< The maximum latency in milliseconds
+
+    /**
+     * This method records the latency of an operation.
+     *
+     * @param[in] aLatency  The latency in milliseconds.
+     *
+     */
+    void Record(uint32_t aLatency);
+
+    /**
+     * This method returns an estimation of a latency percentile.
+     *
+     * @param[in] aPercentile  The percentile, between 1 and 100.
+     *
+     * @returns The upper bound of the bucket containing the percentile (or the maximum latency if smaller) in
+     *          milliseconds, or 0 if no latency is recorded.
+     *
+     */
+    uint32_t GetPercentile(uint8_t aPercentile) const;
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -528,6 +708,29 @@ struct MdnsTelemetryInfo
     uint32_t mServiceRegistrationEmaLatency; ///< The EMA latency of service registrations in milliseconds
     uint32_t mHostResolutionEmaLatency;      ///< The EMA latency of host resolutions in milliseconds
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
+
+    MdnsLatencyHistogram mHostRegistrationLatencies;    ///< The latencies of host registrations
+    MdnsLatencyHistogram mKeyRegistrationLatencies;     ///< The latencies of key registrations
+    MdnsLatencyHistogram mServiceRegistrationLatencies; ///< The latencies of service registrations
+    MdnsLatencyHistogram mHostResolutionLatencies;      ///< The latencies of host resolutions
+    MdnsLatencyHistogram mServiceResolutionLatencies;   ///< The latencies of service resolutions
+
+    uint32_t mDiscoveryCacheHits;   ///< The number of subscriptions answered with cached discovery results
+    uint32_t mDiscoveryCacheMisses; ///< The number of subscriptions waiting for new discovery results
+    uint32_t mDaemonRequests;       ///< The number of requests sent to the mDNS daemon
+
+    /**
+     * The number of buckets of the publication histograms.
+     *
+     * Bucket 0 counts the value 0, bucket `i` counts the values in [2^(i-1), 2^i) and the last bucket counts all the
+     * larger values.
+     *
+     */
+    static constexpr uint8_t kNumHistogramBuckets      = 16;
+    static constexpr uint8_t kNumPublicationPriorities = 2;
+
+    uint32_t mPublicationQueueDepths[kNumHistogramBuckets]; ///< The pending publications found by new publications
+    uint32_t mPublicationWaitTimes[kNumPublicationPriorities][kNumHistogramBuckets]; ///< The waits in milliseconds
 };
 
 static constexpr size_t kVendorOuiLength      = 3;
@@ -546,4 +749,20 @@ otError OtbrErrorToOtError(otbrError aError);
 
 } // namespace otbr
 
+namespace std {
+
+template <> struct hash<otbr::Ip6Address> : public otbr::Ip6AddressHash
+{
+};
+
+template <> struct hash<otbr::Ip6Prefix> : public otbr::Ip6PrefixHash
+{
+};
+
+template <> struct hash<otbr::MacAddress> : public otbr::MacAddressHash
+{
+};
+
+} // namespace std
+
 #endif // OTBR_COMMON_TYPES_HPP_
@@ -27,6 +27,7 @@
  */
 
 #include <map>
+#include <assert.h>
 #include <string.h>
 
 #include "common/api_strings.hpp"
@@ -85,6 +86,7 @@ bool IsThreadActive(DeviceRole aRole)
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
     : mInterfaceName("wpan0")
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
 {
     SubscribeDeviceRoleSignal();
 }
@@ -92,6 +94,7 @@ ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName)
     : mInterfaceName(aInterfaceName)
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
 {
     SubscribeDeviceRoleSignal();
 }
@@ -131,6 +134,19 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     std::string     interfaceName, propertyName, val;
     DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
 
+    if (mPropertyCacheEnabled)
+    {
+        // Not handled, the device role handlers below see the signals as well.
+        UpdatePropertyCache(aMessage);
+    }
+
+    if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_MIGRATION_PROGRESS))
+    {
+        // Not handled, so that the objects of the other interfaces on the same connection see it as well.
+        HandleMigrationProgressSignal(aMessage);
+        ExitNow();
+    }
+
     VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
     SuccessOrExit(DBusMessageExtract(&iter, interfaceName));
@@ -138,14 +154,23 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+
+    // A signal may carry several changed properties, whose device role is looked for.
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
+    {
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+
+        if (propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
     VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
     dbus_message_iter_recurse(&dictEntryIter, &valIter);
     SuccessOrExit(DBusMessageExtract(&valIter, val));
-
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
     SuccessOrExit(NameToDeviceRole(val, role));
 
     for (const auto &f : mDeviceRoleHandlers)
@@ -163,6 +188,158 @@ void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
     mDeviceRoleHandlers.push_back(aHandler);
 }
 
+ClientError ThreadApiDBus::AddMigrationProgressHandler(const MigrationProgressHandler &aHandler)
+{
+    std::string matchRule = "type='signal',interface='" OTBR_DBUS_THREAD_INTERFACE "',member='"
+                            OTBR_DBUS_SIGNAL_MIGRATION_PROGRESS "',path='" +
+                            (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName) + "'";
+    DBusError   error;
+    ClientError ret = ClientError::ERROR_NONE;
+
+    dbus_error_init(&error);
+
+    if (mMigrationProgressHandlers.empty())
+    {
+        dbus_bus_add_match(mConnection, matchRule.c_str(), &error);
+        VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
+    }
+    mMigrationProgressHandlers.push_back(aHandler);
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::EnablePropertyCache(void)
+{
+    std::string matchRule = "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS
+                            "',member='NameOwnerChanged',arg0='" +
+                            (OTBR_DBUS_SERVER_PREFIX + mInterfaceName) + "'";
+    DBusError   error;
+    ClientError ret = ClientError::ERROR_NONE;
+
+    dbus_error_init(&error);
+    VerifyOrExit(!mPropertyCacheEnabled);
+
+    dbus_bus_add_match(mConnection, matchRule.c_str(), &error);
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
+    mPropertyCacheEnabled = true;
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+bool ThreadApiDBus::IsPropertyCacheable(const std::string &aPropertyName) const
+{
+    // The device role is signalled by the agent whichever the co-processor is, the other properties only by some.
+    return aPropertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE || mSignaledProperties.count(aPropertyName) != 0;
+}
+
+void ThreadApiDBus::UpdatePropertyCache(DBusMessage *aMessage)
+{
+    DBusMessageIter iter, subIter, dictEntryIter;
+    std::string     name, propertyName;
+
+    if (dbus_message_is_signal(aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged"))
+    {
+        VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+        SuccessOrExit(DBusMessageExtract(&iter, name));
+        VerifyOrExit(name == OTBR_DBUS_SERVER_PREFIX + mInterfaceName);
+
+        // The agent has left or restarted, none of its values are known anymore.
+        mPropertyCache.clear();
+        mSignaledProperties.clear();
+        ExitNow();
+    }
+
+    VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
+    VerifyOrExit(dbus_message_has_path(aMessage, (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str()));
+    VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+    SuccessOrExit(DBusMessageExtract(&iter, name));
+    VerifyOrExit(name == OTBR_DBUS_THREAD_INTERFACE);
+
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
+    dbus_message_iter_recurse(&iter, &subIter);
+
+    // The signal itself is kept for each of its changed properties, whose values are extracted when they are read.
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
+    {
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+
+        mPropertyCache[propertyName] = UniqueDBusMessage(dbus_message_ref(aMessage));
+        mSignaledProperties.insert(propertyName);
+    }
+
+    // The invalidated properties are signalled without their values, which are read from the agent next time.
+    dbus_message_iter_next(&iter);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
+    dbus_message_iter_recurse(&iter, &subIter);
+
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_STRING; dbus_message_iter_next(&subIter))
+    {
+        const char *invalidated;
+
+        dbus_message_iter_get_basic(&subIter, &invalidated);
+        mPropertyCache.erase(invalidated);
+        mSignaledProperties.insert(invalidated);
+    }
+
+exit:
+    return;
+}
+
+bool ThreadApiDBus::FindPropertyValue(DBusMessage *aMessage, const std::string &aPropertyName, DBusMessageIter &aIter)
+{
+    DBusMessageIter iter, subIter;
+    std::string     interfaceName, propertyName;
+    bool            found = false;
+
+    VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+
+    // The reply of `Get` is the value alone.
+    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_RETURN)
+    {
+        aIter = iter;
+        ExitNow(found = true);
+    }
+
+    SuccessOrExit(DBusMessageExtract(&iter, interfaceName));
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
+    dbus_message_iter_recurse(&iter, &subIter);
+
+    for (; !found && dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
+    {
+        dbus_message_iter_recurse(&subIter, &aIter);
+        SuccessOrExit(DBusMessageExtract(&aIter, propertyName));
+        found = (propertyName == aPropertyName);
+    }
+
+exit:
+    return found;
+}
+
+void ThreadApiDBus::HandleMigrationProgressSignal(DBusMessage *aMessage)
+{
+    uint64_t    migrationId;
+    std::string state;
+    std::string errorName;
+    int64_t     delayMs;
+    auto        args = std::tie(migrationId, state, errorName, delayMs);
+
+    VerifyOrExit(dbus_message_has_path(aMessage, (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str()));
+    SuccessOrExit(DBusMessageToTuple(*aMessage, args));
+
+    for (const auto &f : mMigrationProgressHandlers)
+    {
+        f(migrationId, state, ConvertFromDBusErrorName(errorName), delayMs);
+    }
+
+exit:
+    return;
+}
+
 ClientError ThreadApiDBus::Scan(const ScanHandler &aHandler)
 {
     ClientError error = ClientError::ERROR_NONE;
@@ -514,6 +691,24 @@ exit:
     return error;
 }
 
+ClientError ThreadApiDBus::GetNetworkProperties(NetworkProperties &aProperties)
+{
+    std::string roleName;
+    ClientError error;
+
+    SuccessOrExit(error = GetProperties({OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                         OTBR_DBUS_PROPERTY_PANID, OTBR_DBUS_PROPERTY_EXTPANID,
+                                         OTBR_DBUS_PROPERTY_CHANNEL, OTBR_DBUS_PROPERTY_RLOC16,
+                                         OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY},
+                                        roleName, aProperties.mNetworkName, aProperties.mPanId, aProperties.mExtPanId,
+                                        aProperties.mChannel, aProperties.mRloc16, aProperties.mExtendedAddress,
+                                        aProperties.mPartitionId));
+    SuccessOrExit(error = NameToDeviceRole(roleName, aProperties.mDeviceRole));
+
+exit:
+    return error;
+}
+
 ClientError ThreadApiDBus::GetNetworkName(std::string &aNetworkName)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_NETWORK_NAME, aNetworkName);
@@ -609,6 +804,16 @@ ClientError ThreadApiDBus::GetChannelMonitorAllChannelQualities(std::vector<Chan
     return GetProperty(OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES, aChannelQualities);
 }
 
+ClientError ThreadApiDBus::GetChannelMonitorAverageChannelQualities(std::vector<ChannelQuality> &aChannelQualities)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_AVERAGE_CHANNEL_QUALITIES, aChannelQualities);
+}
+
+ClientError ThreadApiDBus::GetChannelMonitorRecommendedChannel(uint8_t &aChannel)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_RECOMMENDED_CHANNEL, aChannel);
+}
+
 ClientError ThreadApiDBus::GetChildTable(std::vector<ChildInfo> &aChildTable)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_CHILD_TABLE, aChildTable);
@@ -659,6 +864,11 @@ ClientError ThreadApiDBus::GetFeatureFlagListData(std::vector<uint8_t> &aFeature
     return GetProperty(OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_DATA, aFeatureFlagListData);
 }
 
+ClientError ThreadApiDBus::GetFeatureFlagListVersion(uint32_t &aVersion)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_VERSION, aVersion);
+}
+
 ClientError ThreadApiDBus::GetRadioRegion(std::string &aRadioRegion)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_RADIO_REGION, aRadioRegion);
@@ -718,6 +928,73 @@ ClientError ThreadApiDBus::GetCapabilities(std::vector<uint8_t> &aCapabilities)
     return GetProperty(OTBR_DBUS_PROPERTY_CAPABILITIES, aCapabilities);
 }
 
+ClientError ThreadApiDBus::GetTelemetryDataFd(uint32_t aSections, int &aFd)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_GET_TELEMETRY_DATA_FD_METHOD));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBus::UnixFd            fd    = {-1};
+    auto                    args  = std::tie(fd);
+    DBusError               error;
+
+    dbus_error_init(&error);
+    aFd = -1;
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_connection_can_send_type(mConnection, DBUS_TYPE_UNIX_FD),
+                 ret = ClientError::OT_ERROR_NOT_CAPABLE);
+    VerifyOrExit(DBus::TupleToDBusMessage(*message, std::tie(aSections)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(DBus::DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    aFd = fd.mFd;
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::GetChildTableAsync(const PropertyHandler<std::vector<ChildInfo>> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_CHILD_TABLE, aHandler);
+}
+
+ClientError ThreadApiDBus::GetNeighborTableAsync(const PropertyHandler<std::vector<NeighborInfo>> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY, aHandler);
+}
+
+ClientError ThreadApiDBus::GetNetworkDataAsync(const PropertyHandler<std::vector<uint8_t>> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY, aHandler);
+}
+
+ClientError ThreadApiDBus::GetNat64MappingsAsync(const PropertyHandler<std::vector<Nat64AddressMapping>> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_NAT64_MAPPINGS, aHandler);
+}
+
+ClientError ThreadApiDBus::GetSrpServerInfoAsync(const PropertyHandler<SrpServerInfo> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_SRP_SERVER_INFO, aHandler);
+}
+
+ClientError ThreadApiDBus::GetTelemetryDataAsync(const PropertyHandler<std::vector<uint8_t>> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_TELEMETRY_DATA, aHandler);
+}
+
+ClientError ThreadApiDBus::GetCapabilitiesAsync(const PropertyHandler<std::vector<uint8_t>> &aHandler)
+{
+    return GetPropertyAsync(OTBR_DBUS_PROPERTY_CAPABILITIES, aHandler);
+}
+
 std::string ThreadApiDBus::GetInterfaceName(void)
 {
     return mInterfaceName;
@@ -841,18 +1118,40 @@ exit:
     return ret;
 }
 
+template <typename ValType> bool ThreadApiDBus::GetCachedProperty(const std::string &aPropertyName, ValType &aValue)
+{
+    auto            it    = mPropertyCache.find(aPropertyName);
+    bool            found = false;
+    DBusMessageIter iter;
+
+    VerifyOrExit(it != mPropertyCache.end());
+    VerifyOrExit(FindPropertyValue(it->second.get(), aPropertyName, iter));
+    found = (DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE);
+
+exit:
+    return found;
+}
+
 template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::string &aPropertyName, ValType &aValue)
 {
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
-                                                                 DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
-    DBus::UniqueDBusMessage reply = nullptr;
+    DBus::UniqueDBusMessage message = nullptr;
+    DBus::UniqueDBusMessage reply   = nullptr;
 
     ClientError     ret = ClientError::ERROR_NONE;
     DBusError       error;
     DBusMessageIter iter;
 
     dbus_error_init(&error);
+
+    if (mPropertyCacheEnabled && GetCachedProperty(aPropertyName, aValue))
+    {
+        ExitNow();
+    }
+
+    message = DBus::UniqueDBusMessage(
+        dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                     (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(), DBUS_INTERFACE_PROPERTIES,
+                                     DBUS_PROPERTY_GET_METHOD));
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
     otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
     reply = DBus::UniqueDBusMessage(
@@ -864,11 +1163,133 @@ template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::st
     VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
     VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
 
+    // The reply is only kept for the properties whose changes are signalled, so that it is replaced once stale.
+    if (mPropertyCacheEnabled && IsPropertyCacheable(aPropertyName))
+    {
+        mPropertyCache[aPropertyName] = std::move(reply);
+    }
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+static ClientError ExtractFromVariants(DBusMessageIter *aIter)
+{
+    OTBR_UNUSED_VARIABLE(aIter);
+
+    return ClientError::ERROR_NONE;
+}
+
+template <typename ValType, typename... ValTypes>
+static ClientError ExtractFromVariants(DBusMessageIter *aIter, ValType &aValue, ValTypes &...aValues)
+{
+    ClientError ret = ClientError::ERROR_NONE;
+
+    VerifyOrExit(DBus::DBusMessageExtractFromVariant(aIter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    dbus_message_iter_next(aIter);
+    ret = ExtractFromVariants(aIter, aValues...);
+
+exit:
+    return ret;
+}
+
+template <typename... ValTypes>
+ClientError ThreadApiDBus::GetProperties(const std::vector<std::string> &aPropertyNames, ValTypes &...aValues)
+{
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_GET_PROPERTIES_METHOD));
+    DBus::UniqueDBusMessage reply = nullptr;
+
+    ClientError     ret = ClientError::ERROR_NONE;
+    DBusError       error;
+    DBusMessageIter iter;
+    DBusMessageIter subIter;
+
+    assert(aPropertyNames.size() == sizeof...(ValTypes));
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+    dbus_message_iter_recurse(&iter, &subIter);
+    ret = ExtractFromVariants(&subIter, aValues...);
+
 exit:
     dbus_error_free(&error);
     return ret;
 }
 
+template <typename ValType>
+ClientError ThreadApiDBus::GetPropertyAsync(const std::string &aPropertyName, const PropertyHandler<ValType> &aHandler)
+{
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
+    DBusPendingCall        *pending = nullptr;
+    ClientError             ret     = ClientError::ERROR_NONE;
+
+    VerifyOrExit(aHandler != nullptr, ret = ClientError::OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) ==
+                     OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 ret = ClientError::ERROR_DBUS);
+
+    {
+        auto *handler = new PropertyHandler<ValType>(aHandler);
+
+        VerifyOrExit(dbus_pending_call_set_notify(pending, &ThreadApiDBus::sHandleGetPropertyReply<ValType>, handler,
+                                                  &ThreadApiDBus::sFreePropertyHandler<ValType>),
+                     {
+                         delete handler;
+                         dbus_pending_call_cancel(pending);
+                         ret = ClientError::ERROR_DBUS;
+                     });
+    }
+
+exit:
+    if (pending != nullptr)
+    {
+        // The connection keeps its own reference until the reply is handled.
+        dbus_pending_call_unref(pending);
+    }
+    return ret;
+}
+
+template <typename ValType> void ThreadApiDBus::sHandleGetPropertyReply(DBusPendingCall *aPending, void *aHandler)
+{
+    DBus::UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+    ClientError             ret = ClientError::ERROR_DBUS;
+    ValType                 value{};
+    DBusMessageIter         iter;
+
+    VerifyOrExit(reply != nullptr);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, value) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+
+exit:
+    (*static_cast<PropertyHandler<ValType> *>(aHandler))(ret, value);
+}
+
+template <typename ValType> void ThreadApiDBus::sFreePropertyHandler(void *aHandler)
+{
+    delete static_cast<PropertyHandler<ValType> *>(aHandler);
+}
+
 template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
 void ThreadApiDBus::sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus)
 {
@@ -883,6 +1304,12 @@ ClientError ThreadApiDBus::AttachAllNodesTo(const std::vector<uint8_t> &aDataset
     return CallDBusMethodSync(OTBR_DBUS_ATTACH_ALL_NODES_TO_METHOD, args);
 }
 
+ClientError ThreadApiDBus::StartMigration(const std::vector<uint8_t> &aDataset, uint64_t aMigrationId)
+{
+    auto args = std::tie(aDataset, aMigrationId);
+    return CallDBusMethodSync(OTBR_DBUS_START_MIGRATION_METHOD, args);
+}
+
 ClientError ThreadApiDBus::UpdateVendorMeshCopTxtEntries(std::vector<TxtEntry> &aUpdate)
 {
     auto args = std::tie(aUpdate);
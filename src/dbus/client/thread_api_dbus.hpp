@@ -37,11 +37,15 @@
 #include "openthread-br/config.h"
 
 #include <functional>
+#include <map>
+#include <set>
+#include <string>
 
 #include <dbus/dbus.h>
 
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -58,6 +62,11 @@ public:
     using EnergyScanHandler = std::function<void(const std::vector<EnergyScanResult> &)>;
     using OtResultHandler   = std::function<void(ClientError)>;
 
+    using MigrationProgressHandler =
+        std::function<void(uint64_t aMigrationId, const std::string &aState, ClientError aError, int64_t aDelayMs)>;
+
+    template <typename ValType> using PropertyHandler = std::function<void(ClientError, const ValType &)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -85,6 +94,35 @@ public:
      */
     void AddDeviceRoleHandler(const DeviceRoleHandler &aHandler);
 
+    /**
+     * This method adds a callback for the progress of the migrations started by `StartMigration()`.
+     *
+     * Only the signals of the interface of this object are reported, so that the migrations of several interfaces
+     * may be followed on the same connection.
+     *
+     * @param[in] aHandler  The migration progress handler.
+     *
+     * @retval ERROR_NONE       Successfully subscribed to the migration progress.
+     * @retval OT_ERROR_FAILED  Failed to subscribe to the migration progress signal.
+     *
+     */
+    ClientError AddMigrationProgressHandler(const MigrationProgressHandler &aHandler);
+
+    /**
+     * This method enables the cache of the properties which the agent signals with `PropertiesChanged`.
+     *
+     * Once enabled, the synchronous getters of the cached properties are answered from the cache instead of a blocking
+     * D-Bus call. The device role is cached from the first read, as the agent always signals its changes; the other
+     * properties are cached once the agent has been seen signalling them. The cache is updated by the signals, so the
+     * application must keep dispatching the connection, and is dropped when the agent leaves or restarts on the bus.
+     * The asynchronous getters always query the agent.
+     *
+     * @retval ERROR_NONE       Successfully enabled the property cache.
+     * @retval OT_ERROR_FAILED  Failed to subscribe to the owner changes of the agent.
+     *
+     */
+    ClientError EnablePropertyCache(void);
+
     /**
      * This method permits unsecure join on port.
      *
@@ -192,6 +230,24 @@ public:
      */
     ClientError AttachAllNodesTo(const std::vector<uint8_t> &aDataset);
 
+    /**
+     * This method starts attaching all nodes to the specified Thread network without waiting for the migration.
+     *
+     * The progress of the migration is reported to the handlers added by `AddMigrationProgressHandler()`.
+     *
+     * @param[in] aDataset      The Operational Dataset of the Thread network to attach to, as for
+     *                          `AttachAllNodesTo()`.
+     * @param[in] aMigrationId  The identifier of the migration in the progress reports.
+     *
+     * @retval ERROR_NONE              Successfully started the Thread network migration.
+     * @retval ERROR_DBUS              D-Bus encode/decode error.
+     * @retval OT_ERROR_INVALID_STATE  The device is attaching.
+     * @retval OT_ERROR_INVALID_ARGS   Arguments are invalid.
+     * @retval OT_ERROR_BUSY           There is an ongoing migration.
+     *
+     */
+    ClientError StartMigration(const std::vector<uint8_t> &aDataset, uint64_t aMigrationId);
+
     /**
      * This method performs a factory reset.
      *
@@ -467,6 +523,20 @@ public:
      */
     ClientError GetChannel(uint16_t &aChannel);
 
+    /**
+     * This method gets the device role, network name, PAN IDs, channel, RLOC16, extended address and partition ID.
+     *
+     * All the properties are fetched in a single round-trip, and they are read by the server at the same time.
+     *
+     * @param[out] aProperties  The network properties.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNetworkProperties(NetworkProperties &aProperties);
+
     /**
      * This method gets the network network key.
      *
@@ -648,6 +718,30 @@ public:
      */
     ClientError GetChannelMonitorAllChannelQualities(std::vector<ChannelQuality> &aChannelQualities);
 
+    /**
+     * This method gets the average channel qualities over the recorded history of the channel monitor.
+     *
+     * @param[out] aChannelQualities  The average channel qualities.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetChannelMonitorAverageChannelQualities(std::vector<ChannelQuality> &aChannelQualities);
+
+    /**
+     * This method gets the channel recommended from the recorded history of the channel monitor.
+     *
+     * @param[out] aChannel  The recommended channel, 0 if no sample is recorded yet.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetChannelMonitorRecommendedChannel(uint8_t &aChannel);
+
     /**
      * This method gets the child table.
      *
@@ -769,6 +863,18 @@ public:
      */
     ClientError GetFeatureFlagListData(std::vector<uint8_t> &aFeatureFlagListData);
 
+    /**
+     * This method gets the version of the applied feature flag list.
+     *
+     * @param[out] aVersion  The version, which is incremented each time a different feature flag list is applied.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetFeatureFlagListVersion(uint32_t &aVersion);
+
     /**
      * This method gets the radio region.
      *
@@ -934,6 +1040,55 @@ public:
      */
     ClientError GetCapabilities(std::vector<uint8_t> &aCapabilities);
 
+    /**
+     * This method gets the selected sections of the telemetry data in a sealed memory file.
+     *
+     * The data is passed as a file descriptor instead of being copied through the bus daemon, which is cheaper for
+     * the large telemetry data. The file contains the telemetry data proto serialized byte data at offset 0, its size
+     * is the size of the data. It may be read or mapped read-only, and must be closed by the caller.
+     *
+     * @param[in]  aSections  The bit mask of the sections to get, see the GetTelemetryDataSections d-bus method.
+     * @param[out] aFd        The file descriptor of the memory file, -1 on failure.
+     *
+     * @retval ERROR_NONE            Successfully performed the dbus function call
+     * @retval ERROR_DBUS            dbus encode/decode error
+     * @retval OT_ERROR_NOT_CAPABLE  The connection can't pass file descriptors.
+     * @retval ...                   OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTelemetryDataFd(uint32_t aSections, int &aFd);
+
+    /**
+     * @name Asynchronous getters
+     *
+     * These methods send the request and return immediately, the handler is called with the result when the reply
+     * is dispatched by `dbus_connection_dispatch()`. Any number of requests may be pending at the same time.
+     *
+     * An external event loop drives the connection by installing `dbus_connection_set_watch_functions()` and
+     * `dbus_connection_set_timeout_functions()` hooks on it. The handler is called with an error if no reply is
+     * received within the default D-Bus timeout.
+     *
+     * @param[in] aHandler  The handler of the result, which is not called if the request fails to be sent.
+     *
+     * @retval ERROR_NONE            Successfully sent the request.
+     * @retval ERROR_DBUS            Failed to send the request.
+     * @retval OT_ERROR_INVALID_ARGS The handler is empty.
+     *
+     * @{
+     *
+     */
+    ClientError GetChildTableAsync(const PropertyHandler<std::vector<ChildInfo>> &aHandler);
+    ClientError GetNeighborTableAsync(const PropertyHandler<std::vector<NeighborInfo>> &aHandler);
+    ClientError GetNetworkDataAsync(const PropertyHandler<std::vector<uint8_t>> &aHandler);
+    ClientError GetNat64MappingsAsync(const PropertyHandler<std::vector<Nat64AddressMapping>> &aHandler);
+    ClientError GetSrpServerInfoAsync(const PropertyHandler<SrpServerInfo> &aHandler);
+    ClientError GetTelemetryDataAsync(const PropertyHandler<std::vector<uint8_t>> &aHandler);
+    ClientError GetCapabilitiesAsync(const PropertyHandler<std::vector<uint8_t>> &aHandler);
+    /**
+     * @}
+     *
+     */
+
 private:
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
@@ -948,10 +1103,25 @@ private:
     template <typename ValType> ClientError SetProperty(const std::string &aPropertyName, const ValType &aValue);
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
+    template <typename ValType> bool GetCachedProperty(const std::string &aPropertyName, ValType &aValue);
+
+    bool        IsPropertyCacheable(const std::string &aPropertyName) const;
+    void        UpdatePropertyCache(DBusMessage *aMessage);
+    static bool FindPropertyValue(DBusMessage *aMessage, const std::string &aPropertyName, DBusMessageIter &aIter);
+
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string &aPropertyName, const PropertyHandler<ValType> &aHandler);
+
+    template <typename ValType> static void sHandleGetPropertyReply(DBusPendingCall *aPending, void *aHandler);
+    template <typename ValType> static void sFreePropertyHandler(void *aHandler);
+
+    template <typename... ValTypes>
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, ValTypes &...aValues);
 
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
+    void                     HandleMigrationProgressSignal(DBusMessage *aMessage);
 
     template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
     static void sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus);
@@ -979,7 +1149,12 @@ private:
     OtResultHandler   mFactoryResetHandler;
     OtResultHandler   mJoinerHandler;
 
-    std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+    std::vector<DeviceRoleHandler>        mDeviceRoleHandlers;
+    std::vector<MigrationProgressHandler> mMigrationProgressHandlers;
+
+    bool                                     mPropertyCacheEnabled;
+    std::map<std::string, UniqueDBusMessage> mPropertyCache;
+    std::set<std::string>                    mSignaledProperties;
 };
 
 } // namespace DBus
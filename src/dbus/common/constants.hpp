@@ -59,6 +59,7 @@
 #define OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD "AddExternalRoute"
 #define OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD "RemoveExternalRoute"
 #define OTBR_DBUS_ATTACH_ALL_NODES_TO_METHOD "AttachAllNodesTo"
+#define OTBR_DBUS_START_MIGRATION_METHOD "StartMigration"
 #define OTBR_DBUS_UPDATE_VENDOR_MESHCOP_TXT_METHOD "UpdateVendorMeshCopTxtEntries"
 #define OTBR_DBUS_GET_PROPERTIES_METHOD "GetProperties"
 #define OTBR_DBUS_LEAVE_NETWORK_METHOD "LeaveNetwork"
@@ -66,6 +67,15 @@
 #define OTBR_DBUS_ACTIVATE_EPHEMERAL_KEY_MODE_METHOD "ActivateEphemeralKeyMode"
 #define OTBR_DBUS_DEACTIVATE_EPHEMERAL_KEY_MODE_METHOD "DeactivateEphemeralKeyMode"
 #define OTBR_DBUS_SCHEDULE_MIGRATION_METHOD "ScheduleMigration"
+#define OTBR_DBUS_GET_TELEMETRY_DATA_SECTIONS_METHOD "GetTelemetryDataSections"
+#define OTBR_DBUS_GET_TELEMETRY_DATA_FD_METHOD "GetTelemetryDataFd"
+#define OTBR_DBUS_TRIM_MEMORY_METHOD "TrimMemory"
+#define OTBR_DBUS_RELOAD_CONFIG_METHOD "ReloadConfig"
+#define OTBR_DBUS_GET_NAT64_MAPPINGS_PAGE_METHOD "GetNat64MappingsPage"
+#define OTBR_DBUS_GET_TOP_NAT64_MAPPINGS_METHOD "GetTopNat64Mappings"
+#define OTBR_DBUS_GET_SRP_HOSTS_PAGE_METHOD "GetSrpHostsPage"
+#define OTBR_DBUS_GET_SPINEL_TRANSACTION_STATS_METHOD "GetSpinelTransactionStats"
+#define OTBR_DBUS_GET_PACKET_CAPTURE_METHOD "GetPacketCapture"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LINK_MODE "LinkMode"
@@ -89,6 +99,8 @@
 #define OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT "LocalLeaderWeight"
 #define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT "ChannelMonitorSampleCount"
 #define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES "ChannelMonitorAllChannelQualities"
+#define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_AVERAGE_CHANNEL_QUALITIES "ChannelMonitorAverageChannelQualities"
+#define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_RECOMMENDED_CHANNEL "ChannelMonitorRecommendedChannel"
 #define OTBR_DBUS_PROPERTY_CHILD_TABLE "ChildTable"
 #define OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY "NeighborTable"
 #define OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY "PartitionID"
@@ -99,6 +111,7 @@
 #define OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS "ActiveDatasetTlvs"
 #define OTBR_DBUS_PROPERTY_PENDING_DATASET_TLVS "PendingDatasetTlvs"
 #define OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_DATA "FeatureFlagListData"
+#define OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_VERSION "FeatureFlagListVersion"
 #define OTBR_DBUS_PROPERTY_RADIO_REGION "RadioRegion"
 #define OTBR_DBUS_PROPERTY_SRP_SERVER_INFO "SrpServerInfo"
 #define OTBR_DBUS_PROPERTY_TREL_INFO "TrelInfo"
@@ -125,12 +138,21 @@
 #define OTBR_DBUS_PROPERTY_DHCP6_PD_STATE "Dhcp6PdState"
 #define OTBR_DBUS_PROPERTY_TELEMETRY_DATA "TelemetryData"
 #define OTBR_DBUS_PROPERTY_CAPABILITIES "Capabilities"
+#define OTBR_DBUS_PROPERTY_TELEMETRY_PUSH_INTERVAL "TelemetryPushInterval"
 
 #define OTBR_NAT64_STATE_NAME_DISABLED "disabled"
 #define OTBR_NAT64_STATE_NAME_NOT_RUNNING "not_running"
 #define OTBR_NAT64_STATE_NAME_IDLE "idle"
 #define OTBR_NAT64_STATE_NAME_ACTIVE "active"
 
+#define OTBR_MIGRATION_STATE_NAME_SCHEDULED "scheduled"
+#define OTBR_MIGRATION_STATE_NAME_COMPLETED "completed"
+#define OTBR_MIGRATION_STATE_NAME_FAILED "failed"
+
 #define OTBR_DBUS_SIGNAL_READY "Ready"
+#define OTBR_DBUS_SIGNAL_TELEMETRY_DATA_CHANGED "TelemetryDataChanged"
+#define OTBR_DBUS_SIGNAL_SCAN_RESULT "ScanResult"
+#define OTBR_DBUS_SIGNAL_MIGRATION_PROGRESS "MigrationProgress"
+#define OTBR_DBUS_SIGNAL_NEIGHBOR_TABLE_CHANGED "NeighborTableChanged"
 
 #endif // OTBR_DBUS_CONSTANTS_HPP_
@@ -82,6 +82,19 @@ exit:
     return error;
 }
 
+otbrError DBusMessageExtract(DBusMessageIter *aIter, UnixFd &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // The descriptor is duplicated by libdbus, and owned by the caller.
+    VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_UNIX_FD, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_get_basic(aIter, &aValue.mFd);
+    dbus_message_iter_next(aIter);
+
+exit:
+    return error;
+}
+
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue)
 {
     return DBusMessageExtractPrimitive(aIter, aValue);
@@ -144,6 +157,16 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const UnixFd &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_append_basic(aIter, DBUS_TYPE_UNIX_FD, &aValue.mFd), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const char *aValue)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -39,6 +39,7 @@
 #include <array>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <dbus/dbus.h>
@@ -73,6 +74,8 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChildInfo &aChildInfo)
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChildInfo &aChildInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborInfo &aNeighborInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborInfo &aNeighborInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborTableChange &aChange);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborTableChange &aChange);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderData);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality);
@@ -85,8 +88,14 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo::Respons
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo::ResponseCounters &aResponseCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpServerInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo &aSrpServerInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerService &aService);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerService &aService);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerHost &aHost);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerHost &aHost);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistogram &aMdnsLatencyHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistogram &aMdnsLatencyHistogram);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
@@ -208,6 +217,18 @@ template <> struct DBusTypeTrait<std::vector<NeighborInfo>>
     static constexpr const char *TYPE_AS_STRING = "a(tuquuyyyqqqbbbb)";
 };
 
+template <> struct DBusTypeTrait<NeighborTableChange>
+{
+    // struct of { uint8, uint64, uint16, bool, bool, bool, bool }
+    static constexpr const char *TYPE_AS_STRING = "(ytqbbbb)";
+};
+
+template <> struct DBusTypeTrait<std::vector<NeighborTableChange>>
+{
+    // array of struct of { uint8, uint64, uint16, bool, bool, bool, bool }
+    static constexpr const char *TYPE_AS_STRING = "a(ytqbbbb)";
+};
+
 template <> struct DBusTypeTrait<ChildInfo>
 {
     // struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
@@ -274,14 +295,41 @@ template <> struct DBusTypeTrait<SrpServerInfo>
     static constexpr const char *TYPE_AS_STRING = "(yqy(uutttt)(uutttt)(uuuuuu))";
 };
 
+template <> struct DBusTypeTrait<SrpServerService>
+{
+    // struct of { string, bool, uint16, uint16, uint16, uint32, uint32, uint32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(sbqqquuuu)";
+};
+
+template <> struct DBusTypeTrait<SrpServerHost>
+{
+    // struct of { string, bool, array of array of uint8, uint32, uint32, uint32, uint32,
+    //             array of struct of { string, bool, uint16, uint16, uint16, uint32, uint32, uint32, uint32 } }
+    static constexpr const char *TYPE_AS_STRING = "(sbaayuuuua(sbqqquuuu))";
+};
+
+template <> struct DBusTypeTrait<std::vector<SrpServerHost>>
+{
+    // array of struct of {
+    //             string, bool, array of array of uint8, uint32, uint32, uint32, uint32,
+    //             array of struct of { string, bool, uint16, uint16, uint16, uint32, uint32, uint32, uint32 } }
+    static constexpr const char *TYPE_AS_STRING = "a(sbaayuuuua(sbqqquuuu))";
+};
+
 template <> struct DBusTypeTrait<MdnsTelemetryInfo>
 {
     // struct of { struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
-    //              uint32, uint32, uint32, uint32 }
-    static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu)";
+    //              uint32, uint32, uint32, uint32,
+    //              struct of { array of uint32, uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32, uint32 } }
+    static constexpr const char *TYPE_AS_STRING =
+        "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu(auuuuu)(auuuuu)(auuuuu)(auuuuu)(auuuuu))";
 };
 
 template <> struct DBusTypeTrait<DnssdCounters>
@@ -461,6 +509,12 @@ template <> struct DBusTypeTrait<std::string>
     static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_STRING_AS_STRING;
 };
 
+template <> struct DBusTypeTrait<UnixFd>
+{
+    static constexpr int         TYPE           = DBUS_TYPE_UNIX_FD;
+    static constexpr const char *TYPE_AS_STRING = DBUS_TYPE_UNIX_FD_AS_STRING;
+};
+
 template <> struct DBusTypeTrait<bool>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BOOLEAN;
@@ -473,6 +527,7 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, int8_t aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::string &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const char *aValue);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const UnixFd &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint16_t> &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint32_t> &aValue);
@@ -483,6 +538,7 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &
 otbrError DBusMessageExtract(DBusMessageIter *aIter, bool &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, int8_t &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::string &aValue);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, UnixFd &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue);
@@ -491,6 +547,24 @@ otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int16_t> &aValu
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int32_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int64_t> &aValue);
 
+/**
+ * This trait tells whether arrays of @p T are marshalled as a whole with `dbus_message_iter_append_fixed_array()`
+ * instead of element by element.
+ *
+ * D-Bus booleans are 32-bit wide and do not share the layout of `bool`.
+ *
+ */
+template <typename T>
+struct IsDBusFixedType : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+{
+};
+
+template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIter, std::vector<T> &aValue);
+template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue);
+template <typename T, size_t SIZE> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::array<T, SIZE> &aValue);
+template <typename T, size_t SIZE>
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::array<T, SIZE> &aValue);
+
 template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, T &aValue)
 {
     otbrError error = OTBR_ERROR_DBUS;
@@ -504,11 +578,22 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue)
+template <typename T>
+otbrError DBusMessageExtractArray(DBusMessageIter *aIter, std::vector<T> &aValue, std::true_type aIsFixed)
+{
+    OTBR_UNUSED_VARIABLE(aIsFixed);
+
+    return DBusMessageExtractPrimitive(aIter, aValue);
+}
+
+template <typename T>
+otbrError DBusMessageExtractArray(DBusMessageIter *aIter, std::vector<T> &aValue, std::false_type aIsFixed)
 {
     otbrError       error = OTBR_ERROR_NONE;
     DBusMessageIter subIter;
 
+    OTBR_UNUSED_VARIABLE(aIsFixed);
+
     VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_ARRAY, error = OTBR_ERROR_DBUS);
     dbus_message_iter_recurse(aIter, &subIter);
 
@@ -517,7 +602,7 @@ template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::
     {
         T val;
         SuccessOrExit(error = DBusMessageExtract(&subIter, val));
-        aValue.push_back(val);
+        aValue.push_back(std::move(val));
     }
     dbus_message_iter_next(aIter);
 
@@ -525,6 +610,11 @@ exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue)
+{
+    return DBusMessageExtractArray(aIter, aValue, IsDBusFixedType<T>());
+}
+
 template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIter, std::vector<T> &aValue)
 {
     DBusMessageIter subIter;
@@ -591,11 +681,22 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue)
+template <typename T>
+otbrError DBusMessageEncodeArray(DBusMessageIter *aIter, const std::vector<T> &aValue, std::true_type aIsFixed)
+{
+    OTBR_UNUSED_VARIABLE(aIsFixed);
+
+    return DBusMessageEncodePrimitive(aIter, aValue);
+}
+
+template <typename T>
+otbrError DBusMessageEncodeArray(DBusMessageIter *aIter, const std::vector<T> &aValue, std::false_type aIsFixed)
 {
     otbrError       error = OTBR_ERROR_NONE;
     DBusMessageIter subIter;
 
+    OTBR_UNUSED_VARIABLE(aIsFixed);
+
     VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
                  error = OTBR_ERROR_DBUS);
 
@@ -609,6 +710,11 @@ exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue)
+{
+    return DBusMessageEncodeArray(aIter, aValue, IsDBusFixedType<T>());
+}
+
 template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue)
 {
     DBusMessageIter subIter;
@@ -433,6 +433,34 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborTableChange &aChange)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    auto            args  = std::tie(aChange.mType, aChange.mExtAddress, aChange.mRloc16, aChange.mIsChild,
+                                     aChange.mRxOnWhenIdle, aChange.mFullThreadDevice, aChange.mFullNetworkData);
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborTableChange &aChange)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    auto            args  = std::tie(aChange.mType, aChange.mExtAddress, aChange.mRloc16, aChange.mIsChild,
+                                     aChange.mRxOnWhenIdle, aChange.mFullThreadDevice, aChange.mFullNetworkData);
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+    SuccessOrExit(error = ConvertToTuple(&sub, args));
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderData)
 {
     DBusMessageIter sub;
@@ -608,6 +636,92 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerService &aService)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mFullName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mDeleted));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mPort));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mPriority));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mWeight));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mKeyLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mRemainingLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aService.mRemainingKeyLease));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerService &aService)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mFullName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mDeleted));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mPort));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mPriority));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mWeight));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mKeyLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mRemainingLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aService.mRemainingKeyLease));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerHost &aHost)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mFullName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mDeleted));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mAddresses));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mKeyLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mRemainingLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mRemainingKeyLease));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aHost.mServices));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerHost &aHost)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mFullName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mDeleted));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mAddresses));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mKeyLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mRemainingLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mRemainingKeyLease));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aHost.mServices));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters)
 {
     DBusMessageIter sub;
@@ -692,6 +806,44 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistogram &aMdnsLatencyHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistogram.mBucketCounts));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistogram.GetPercentile(50)));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistogram.GetPercentile(95)));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistogram.GetPercentile(99)));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistogram.mMaxLatency));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistogram &aMdnsLatencyHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    uint32_t        percentile;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistogram.mBucketCounts));
+    // The percentiles are derived from the buckets.
+    SuccessOrExit(error = DBusMessageExtract(&sub, percentile));
+    SuccessOrExit(error = DBusMessageExtract(&sub, percentile));
+    SuccessOrExit(error = DBusMessageExtract(&sub, percentile));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistogram.mMaxLatency));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     DBusMessageIter sub;
@@ -709,6 +861,12 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMd
     SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionEmaLatency));
     SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionEmaLatency));
 
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostRegistrationLatencies));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mKeyRegistrationLatencies));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceRegistrationLatencies));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionLatencies));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionLatencies));
+
     VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
 exit:
     return error;
@@ -731,6 +889,12 @@ otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTel
     SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionEmaLatency));
     SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionEmaLatency));
 
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostRegistrationLatencies));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mKeyRegistrationLatencies));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceRegistrationLatencies));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionLatencies));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionLatencies));
+
     dbus_message_iter_next(aIter);
 exit:
     return error;
@@ -509,6 +509,17 @@ struct NeighborInfo
     bool     mIsChild;          ///< Is the neighbor a child
 };
 
+struct NeighborTableChange
+{
+    uint8_t  mType;             ///< The type of the change: 0 for added, 1 for removed and 2 for updated
+    uint64_t mExtAddress;       ///< IEEE 802.15.4 Extended Address
+    uint16_t mRloc16;           ///< RLOC16
+    bool     mIsChild;          ///< Is the neighbor a child
+    bool     mRxOnWhenIdle;     ///< rx-on-when-idle
+    bool     mFullThreadDevice; ///< Full Thread Device
+    bool     mFullNetworkData;  ///< Full Network Data
+};
+
 struct LeaderData
 {
     uint32_t mPartitionId;       ///< Partition ID
@@ -518,6 +529,22 @@ struct LeaderData
     uint8_t  mLeaderRouterId;    ///< Leader Router ID
 };
 
+/**
+ * This structure represents the network properties which are fetched together.
+ *
+ */
+struct NetworkProperties
+{
+    DeviceRole  mDeviceRole;      ///< Device role
+    std::string mNetworkName;     ///< Network name
+    uint16_t    mPanId;           ///< PAN ID
+    uint64_t    mExtPanId;        ///< Extended PAN ID
+    uint16_t    mChannel;         ///< Channel
+    uint16_t    mRloc16;          ///< RLOC16
+    uint64_t    mExtendedAddress; ///< Extended address
+    uint32_t    mPartitionId;     ///< Partition ID
+};
+
 struct TxtEntry
 {
     std::string          mKey;
@@ -571,6 +598,31 @@ struct SrpServerInfo
     ResponseCounters     mResponseCounters; ///< The counters of response codes sent by the SRP server
 };
 
+struct SrpServerService
+{
+    std::string mFullName;          ///< The full name of the service instance
+    bool        mDeleted;           ///< Whether the service is in 'Deleted' state
+    uint16_t    mPort;              ///< The port of the service
+    uint16_t    mPriority;          ///< The priority of the service
+    uint16_t    mWeight;            ///< The weight of the service
+    uint32_t    mLease;             ///< The lease time in milliseconds
+    uint32_t    mKeyLease;          ///< The key lease time in milliseconds
+    uint32_t    mRemainingLease;    ///< The remaining lease time in milliseconds
+    uint32_t    mRemainingKeyLease; ///< The remaining key lease time in milliseconds
+};
+
+struct SrpServerHost
+{
+    std::string                   mFullName;          ///< The full name of the host
+    bool                          mDeleted;           ///< Whether the host is in 'Deleted' state
+    std::vector<Ip6Address>       mAddresses;         ///< The addresses of the host
+    uint32_t                      mLease;             ///< The lease time in milliseconds
+    uint32_t                      mKeyLease;          ///< The key lease time in milliseconds
+    uint32_t                      mRemainingLease;    ///< The remaining lease time in milliseconds
+    uint32_t                      mRemainingKeyLease; ///< The remaining key lease time in milliseconds
+    std::vector<SrpServerService> mServices;          ///< The services of the host
+};
+
 struct DnssdCounters
 {
     uint32_t mSuccessResponse;        ///< The number of successful responses
@@ -719,6 +771,18 @@ struct TrelInfo
     TrelPacketCounters mTrelCounters; ///< The TREL counters.
 };
 
+/**
+ * This structure represents a file descriptor passed by a d-bus message.
+ *
+ * The descriptor is duplicated when encoded, so the sender still closes its own. The extracted descriptor is owned by
+ * the receiver, which must close it.
+ *
+ */
+struct UnixFd
+{
+    int mFd; ///< The file descriptor.
+};
+
 } // namespace DBus
 } // namespace otbr
 
@@ -31,11 +31,12 @@
 #include "dbus/server/dbus_agent.hpp"
 
 #include <chrono>
-#include <thread>
 #include <unistd.h>
 
 #include "common/logging.hpp"
+#include "common/memory_stats.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/server/dbus_request.hpp"
 #include "dbus/server/dbus_thread_object_ncp.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
 #include "mdns/mdns.hpp"
@@ -43,35 +44,74 @@
 namespace otbr {
 namespace DBus {
 
-const struct timeval           DBusAgent::kPollTimeout = {0, 0};
-constexpr std::chrono::seconds DBusAgent::kDBusWaitAllowance;
+const struct timeval                DBusAgent::kPollTimeout = {0, 0};
+constexpr std::chrono::seconds      DBusAgent::kDBusWaitAllowance;
+constexpr std::chrono::seconds      DBusAgent::kDBusRetryInterval;
+constexpr uint32_t                  DBusAgent::kDispatchBudgetMessages;
+constexpr std::chrono::microseconds DBusAgent::kDispatchBudgetTime;
 
 DBusAgent::DBusAgent(otbr::Ncp::ThreadHost &aHost, Mdns::Publisher &aPublisher)
     : mInterfaceName(aHost.GetInterfaceName())
     , mHost(aHost)
     , mPublisher(aPublisher)
+    , mBorderAgent(nullptr)
+    , mIsReconnecting(false)
 {
+    MemoryStats::GetInstance().AddCounter(this, "dbus.requests", []() { return DBusRequest::GetInstanceCount(); });
 }
 
-void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
+DBusAgent::~DBusAgent(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    MemoryStats::GetInstance().RemoveCounters(this);
+}
+
+void DBusAgent::Init(otbr::BorderAgent *aBorderAgent, ReadyCallback aReadyCallback)
+{
+    mBorderAgent        = aBorderAgent;
+    mReadyCallback      = std::move(aReadyCallback);
+    mConnectionDeadline = Clock::now() + kDBusWaitAllowance;
 
-    auto connection_deadline = Clock::now() + kDBusWaitAllowance;
+    Connect();
+}
+
+void DBusAgent::Connect(void)
+{
+    otbrError            error      = OTBR_ERROR_NONE;
+    UniqueDBusConnection connection = PrepareDBusConnection();
 
-    while ((mConnection = PrepareDBusConnection()) == nullptr && Clock::now() < connection_deadline)
+    if (connection == nullptr)
     {
-        otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        // The other components keep serving after the D-Bus daemon is lost, so reconnecting is never given up.
+        VerifyOrDie(mIsReconnecting || Clock::now() < mConnectionDeadline, "Failed to get DBus connection");
+
+        otbrLogWarning("Failed to setup DBus connection, will retry after %lld second(s)",
+                       static_cast<long long>(kDBusRetryInterval.count()));
+        mTaskRunner.Post(kDBusRetryInterval, [this]() { Connect(); });
+        ExitNow();
     }
 
-    VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
+    if (mIsReconnecting)
+    {
+        // The D-Bus object is kept, so that the handlers it registered to the Thread host remain valid. The lost
+        // connection is released only after the object is attached to the new one.
+        error = mThreadObject->Reattach(*connection);
+        VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to register the DBus objects again");
+
+        mConnection     = std::move(connection);
+        mIsReconnecting = false;
+        mDispatchCounters.mReconnections++;
+        otbrLogInfo("Reconnected to the DBus daemon");
+        ExitNow();
+    }
+
+    mConnection = std::move(connection);
 
     switch (mHost.GetCoprocessorType())
     {
     case OT_COPROCESSOR_RCP:
+        VerifyOrDie(mBorderAgent != nullptr, "The Border Agent is required with an RCP");
         mThreadObject = MakeUnique<DBusThreadObjectRcp>(*mConnection, mInterfaceName,
-                                                        static_cast<Ncp::RcpHost &>(mHost), &mPublisher, aBorderAgent);
+                                                        static_cast<Ncp::RcpHost &>(mHost), &mPublisher, *mBorderAgent);
         break;
 
     case OT_COPROCESSOR_NCP:
@@ -86,6 +126,34 @@ void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
 
     error = mThreadObject->Init();
     VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
+
+    if (mReloadConfigHandler)
+    {
+        mThreadObject->RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RELOAD_CONFIG_METHOD,
+                                      [this](DBusRequest &aRequest) {
+                                          aRequest.ReplyOtResult(OtbrErrorToOtError(mReloadConfigHandler()));
+                                      });
+    }
+
+    if (mReadyCallback)
+    {
+        mReadyCallback();
+    }
+
+exit:
+    return;
+}
+
+void DBusAgent::HandleDisconnected(void)
+{
+    VerifyOrExit(!mIsReconnecting);
+
+    otbrLogWarning("Lost the DBus connection, reconnecting");
+    mIsReconnecting = true;
+    Connect();
+
+exit:
+    return;
 }
 
 DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
@@ -104,6 +172,8 @@ DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
 
     VerifyOrExit(uniqueConn != nullptr,
                  otbrLogWarning("Failed to get DBus connection: %s: %s", dbusError.name, dbusError.message));
+    // The connection is set up again when the D-Bus daemon restarts, instead of exiting the process.
+    dbus_connection_set_exit_on_disconnect(uniqueConn.get(), FALSE);
     dbus_bus_register(uniqueConn.get(), &dbusError);
 
     requestReply =
@@ -140,6 +210,8 @@ void DBusAgent::Update(MainloopContext &aMainloop)
     unsigned int flags;
     int          fd;
 
+    VerifyOrExit(mConnection != nullptr && !mIsReconnecting);
+
     if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
     {
         aMainloop.mTimeout = {0, 0};
@@ -174,6 +246,9 @@ void DBusAgent::Update(MainloopContext &aMainloop)
 
         aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
     }
+
+exit:
+    return;
 }
 
 void DBusAgent::Process(const MainloopContext &aMainloop)
@@ -181,6 +256,8 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
     unsigned int flags;
     int          fd;
 
+    VerifyOrExit(mConnection != nullptr && !mIsReconnecting);
+
     for (const auto &watch : mWatches)
     {
         if (!dbus_watch_get_enabled(watch))
@@ -214,8 +291,43 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
         dbus_watch_handle(watch, flags);
     }
 
-    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
-        ;
+    DispatchMessages();
+
+    // The connection is lost once the local `Disconnected` message generated by libdbus is dispatched.
+    if (!dbus_connection_get_is_connected(mConnection.get()) &&
+        dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_COMPLETE)
+    {
+        HandleDisconnected();
+    }
+
+exit:
+    return;
+}
+
+void DBusAgent::DispatchMessages(void)
+{
+    Clock::time_point start      = Clock::now();
+    Clock::duration   elapsed    = Clock::duration::zero();
+    uint32_t          dispatched = 0;
+
+    while (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        if (dispatched >= kDispatchBudgetMessages || elapsed >= kDispatchBudgetTime)
+        {
+            // The remaining messages are dispatched in the next iteration, whose timeout is zeroed by `Update()`.
+            mDispatchCounters.mBudgetExhaustions++;
+            otbrLogDebug("Yield to the mainloop after dispatching %u messages", dispatched);
+            break;
+        }
+
+        dbus_connection_dispatch(mConnection.get());
+        dispatched++;
+        elapsed = Clock::now() - start;
+    }
+
+    mDispatchCounters.mMessages += dispatched;
+    mDispatchCounters.mTimeUs +=
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
 }
 
 } // namespace DBus
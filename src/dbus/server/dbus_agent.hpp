@@ -43,6 +43,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
 #include "dbus/server/dbus_object.hpp"
@@ -50,12 +51,32 @@
 #include "dbus/server/dbus_thread_object_rcp.hpp"
 #include "ncp/thread_host.hpp"
 
+#ifndef OTBR_DBUS_DISPATCH_BUDGET_MESSAGES
+#define OTBR_DBUS_DISPATCH_BUDGET_MESSAGES 32
+#endif
+
+#ifndef OTBR_DBUS_DISPATCH_BUDGET_US
+#define OTBR_DBUS_DISPATCH_BUDGET_US 5000
+#endif
+
 namespace otbr {
 namespace DBus {
 
 class DBusAgent : public MainloopProcessor, private NonCopyable
 {
 public:
+    /**
+     * This structure represents the counters of dispatching the incoming D-Bus messages.
+     *
+     */
+    struct DispatchCounters
+    {
+        uint64_t mMessages          = 0; ///< The number of dispatched messages.
+        uint64_t mTimeUs            = 0; ///< The time spent in dispatching messages, in microseconds.
+        uint64_t mBudgetExhaustions = 0; ///< The number of mainloop iterations which ran out of dispatch budget.
+        uint32_t mReconnections     = 0; ///< The number of reconnections after the D-Bus daemon was lost.
+    };
+
     /**
      * The constructor of dbus agent.
      *
@@ -65,24 +86,82 @@ public:
      */
     DBusAgent(otbr::Ncp::ThreadHost &aHost, Mdns::Publisher &aPublisher);
 
+    /**
+     * The destructor of dbus agent.
+     *
+     */
+    ~DBusAgent(void);
+
+    /**
+     * This function is called when the dbus agent is ready to serve requests.
+     *
+     */
+    using ReadyCallback = std::function<void(void)>;
+
+    /**
+     * This function is called to reload the runtime configuration of the agent.
+     *
+     * @returns The result of the reload.
+     *
+     */
+    using ReloadConfigHandler = std::function<otbrError(void)>;
+
     /**
      * This method initializes the dbus agent.
      *
+     * The connection to the D-Bus daemon is retried on the mainloop until it succeeds, so that the other components
+     * don't wait for the D-Bus daemon. If the D-Bus daemon restarts later, the dbus agent reconnects to it and
+     * registers the same D-Bus objects again.
+     *
+     * The Border Agent is only required by the RCP-mode D-Bus object. With an NCP, the Border Agent runs on the
+     * co-processor and no Border Agent is created on the host.
+     *
+     * @param[in] aBorderAgent    A pointer to the Border Agent, `nullptr` with an NCP.
+     * @param[in] aReadyCallback  The callback called once the dbus agent is ready, can be `nullptr`.
+     *
      */
-    void Init(otbr::BorderAgent &aBorderAgent);
+    void Init(otbr::BorderAgent *aBorderAgent, ReadyCallback aReadyCallback = nullptr);
+
+    /**
+     * This method sets the handler of the `ReloadConfig` D-Bus method, which is only served if it is set.
+     *
+     * This method must be called before `Init()`.
+     *
+     * @param[in] aHandler  The handler reloading the runtime configuration.
+     *
+     */
+    void SetReloadConfigHandler(ReloadConfigHandler aHandler) { mReloadConfigHandler = std::move(aHandler); }
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "DBusAgent"; }
+
+    /**
+     * This method returns the counters of dispatching the incoming D-Bus messages.
+     *
+     * @returns The dispatch counters.
+     *
+     */
+    const DispatchCounters &GetDispatchCounters(void) const { return mDispatchCounters; }
 
 private:
     using Clock                                              = std::chrono::steady_clock;
     constexpr static std::chrono::seconds kDBusWaitAllowance = std::chrono::seconds(30);
+    constexpr static std::chrono::seconds kDBusRetryInterval = std::chrono::seconds(1);
+
+    // The messages are dispatched until either budget runs out in each mainloop iteration, so that a busy client
+    // does not starve the other processors.
+    static constexpr uint32_t                  kDispatchBudgetMessages = OTBR_DBUS_DISPATCH_BUDGET_MESSAGES;
+    static constexpr std::chrono::microseconds kDispatchBudgetTime{OTBR_DBUS_DISPATCH_BUDGET_US};
 
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
 
     static dbus_bool_t   AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void          RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
     UniqueDBusConnection PrepareDBusConnection(void);
+    void                 Connect(void);
+    void                 HandleDisconnected(void);
+    void                 DispatchMessages(void);
 
     static const struct timeval kPollTimeout;
 
@@ -91,12 +170,20 @@ private:
     UniqueDBusConnection        mConnection;
     otbr::Ncp::ThreadHost      &mHost;
     Mdns::Publisher            &mPublisher;
+    otbr::BorderAgent          *mBorderAgent;
+    ReadyCallback               mReadyCallback;
+    ReloadConfigHandler         mReloadConfigHandler;
+    Clock::time_point           mConnectionDeadline;
+    bool                        mIsReconnecting;
+    TaskRunner                  mTaskRunner;
 
     /**
      * This map is used to track DBusWatch-es.
      *
      */
     std::set<DBusWatch *> mWatches;
+
+    DispatchCounters mDispatchCounters;
 };
 
 } // namespace DBus
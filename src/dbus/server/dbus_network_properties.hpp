@@ -0,0 +1,90 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the host-agnostic Thread network properties of the d-bus thread objects.
+ */
+
+#ifndef OTBR_DBUS_NETWORK_PROPERTIES_HPP_
+#define OTBR_DBUS_NETWORK_PROPERTIES_HPP_
+
+#include "openthread-br/config.h"
+
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/server/dbus_object.hpp"
+#include "ncp/thread_host.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class exposes the Thread network properties which are available with both RCP and NCP co-processors.
+ *
+ * The values are read from the cache kept by the Thread host, which is updated as the co-processor reports the
+ * changes, so getting a property never waits for the co-processor. The changes are signaled as `PropertiesChanged`.
+ *
+ */
+class DBusNetworkProperties : private NonCopyable
+{
+public:
+    /**
+     * The constructor of the network properties.
+     *
+     * @param[in] aObject  The d-bus object to expose the properties.
+     * @param[in] aHost    The Thread host.
+     *
+     */
+    DBusNetworkProperties(DBusObject &aObject, Ncp::ThreadHost &aHost);
+
+    /**
+     * This method registers the properties to the d-bus object.
+     *
+     * The d-bus object must be initialized with synchronous property handlers.
+     *
+     */
+    void Init(void);
+
+private:
+    otError GetDeviceRoleHandler(DBusMessageIter &aIter);
+    otError GetActiveDatasetTlvsHandler(DBusMessageIter &aIter);
+    otError GetOtbrVersionHandler(DBusMessageIter &aIter);
+    otError GetCoprocessorVersionHandler(DBusMessageIter &aIter);
+
+    void HandleDeviceRoleChanged(otDeviceRole aRole);
+
+    DBusObject      &mObject;
+    Ncp::ThreadHost &mHost;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_NETWORK_PROPERTIES_HPP_
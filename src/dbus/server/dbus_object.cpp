@@ -35,6 +35,7 @@
 #include <dbus/dbus.h>
 
 #include "common/logging.hpp"
+#include "common/probes.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_object.hpp"
 
@@ -56,15 +57,9 @@ otbrError DBusObject::Init(void)
 
 otbrError DBusObject::Initialize(bool aIsAsyncPropertyHandler)
 {
-    otbrError            error = OTBR_ERROR_NONE;
-    DBusObjectPathVTable vTable;
-
-    memset(&vTable, 0, sizeof(vTable));
+    otbrError error = OTBR_ERROR_NONE;
 
-    vTable.message_function = DBusObject::sMessageHandler;
-
-    VerifyOrExit(dbus_connection_register_object_path(mConnection, mObjectPath.c_str(), &vTable, this),
-                 error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = RegisterObjectPath());
 
     if (aIsAsyncPropertyHandler)
     {
@@ -85,14 +80,110 @@ exit:
     return error;
 }
 
+otbrError DBusObject::Reattach(DBusConnection &aConnection)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mConnection = &aConnection;
+    SuccessOrExit(error = RegisterObjectPath());
+
+    for (const auto &interfaceProperties : mSignaledProperties)
+    {
+        for (const auto &property : interfaceProperties.second)
+        {
+            mPendingPropertyChanges[interfaceProperties.first][property.first] = property.second;
+        }
+    }
+
+    if (!mPendingPropertyChanges.empty())
+    {
+        SchedulePropertiesChanged();
+    }
+
+exit:
+    return error;
+}
+
+otbrError DBusObject::RegisterObjectPath(void)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    DBusObjectPathVTable vTable;
+
+    memset(&vTable, 0, sizeof(vTable));
+
+    vTable.message_function = DBusObject::sMessageHandler;
+
+    VerifyOrExit(dbus_connection_register_object_path(mConnection, mObjectPath.c_str(), &vTable, this),
+                 error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+uint64_t DBusObject::HashMemberName(const char *aInterfaceName, const char *aMemberName)
+{
+    // FNV-1a over "<interface>.<member>".
+    static constexpr uint64_t kOffsetBasis = 14695981039346656037ull;
+    static constexpr uint64_t kPrime       = 1099511628211ull;
+
+    uint64_t hash = kOffsetBasis;
+
+    for (const char *p = aInterfaceName; *p != '\0'; p++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * kPrime;
+    }
+
+    hash = (hash ^ static_cast<uint8_t>('.')) * kPrime;
+
+    for (const char *p = aMemberName; *p != '\0'; p++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * kPrime;
+    }
+
+    return hash;
+}
+
+template <typename HandlerType>
+void DBusObject::AddMemberHandler(MemberHandlerMap<HandlerType> &aHandlers,
+                                  const std::string             &aInterfaceName,
+                                  const std::string             &aMemberName,
+                                  const HandlerType             &aHandler)
+{
+    assert(FindMemberHandler(aHandlers, aInterfaceName.c_str(), aMemberName.c_str()) == nullptr);
+    aHandlers.emplace(HashMemberName(aInterfaceName.c_str(), aMemberName.c_str()),
+                      MemberHandler<HandlerType>{aInterfaceName, aMemberName, aHandler});
+}
+
+template <typename HandlerType>
+const HandlerType *DBusObject::FindMemberHandler(const MemberHandlerMap<HandlerType> &aHandlers,
+                                                 const char                          *aInterfaceName,
+                                                 const char                          *aMemberName)
+{
+    const HandlerType *handler = nullptr;
+
+    VerifyOrExit(aInterfaceName != nullptr && aMemberName != nullptr);
+
+    {
+        auto range = aHandlers.equal_range(HashMemberName(aInterfaceName, aMemberName));
+
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            if (iter->second.mInterfaceName == aInterfaceName && iter->second.mMemberName == aMemberName)
+            {
+                ExitNow(handler = &iter->second.mHandler);
+            }
+        }
+    }
+
+exit:
+    return handler;
+}
+
 void DBusObject::RegisterMethod(const std::string       &aInterfaceName,
                                 const std::string       &aMethodName,
                                 const MethodHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aMethodName;
-
-    assert(mMethodHandlers.find(fullPath) == mMethodHandlers.end());
-    mMethodHandlers.emplace(fullPath, aHandler);
+    AddMemberHandler(mMethodHandlers, aInterfaceName, aMethodName, aHandler);
 }
 
 void DBusObject::RegisterGetPropertyHandler(const std::string         &aInterfaceName,
@@ -106,10 +197,7 @@ void DBusObject::RegisterSetPropertyHandler(const std::string         &aInterfac
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aPropertyName;
-
-    assert(mSetPropertyHandlers.find(fullPath) == mSetPropertyHandlers.end());
-    mSetPropertyHandlers.emplace(fullPath, aHandler);
+    AddMemberHandler(mSetPropertyHandlers, aInterfaceName, aPropertyName, aHandler);
 }
 
 void DBusObject::RegisterAsyncGetPropertyHandler(const std::string              &aInterfaceName,
@@ -128,23 +216,27 @@ DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusM
 
 DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage)
 {
-    DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
-    DBusRequest       request(aConnection, aMessage);
-    std::string       interface  = dbus_message_get_interface(aMessage);
-    std::string       memberName = interface + "." + dbus_message_get_member(aMessage);
-    auto              iter       = mMethodHandlers.find(memberName);
-
-    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
+    DBusHandlerResult        handled       = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    DBusRequest              request(aConnection, aMessage);
+    const char              *interfaceName = dbus_message_get_interface(aMessage);
+    const char              *memberName    = dbus_message_get_member(aMessage);
+    const MethodHandlerType *handler       = nullptr;
+
+    VerifyOrExit(dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL);
+    handler = FindMemberHandler(mMethodHandlers, interfaceName, memberName);
+    VerifyOrExit(handler != nullptr);
+
+    otbrLogDebug("Handling method %s.%s", interfaceName, memberName);
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
     {
-        otbrLogDebug("Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            DumpDBusMessage(*aMessage);
-        }
-        (iter->second)(request);
-        handled = DBUS_HANDLER_RESULT_HANDLED;
+        DumpDBusMessage(*aMessage);
     }
+    OTBR_PROBE(dbus__method__start, interfaceName, memberName);
+    (*handler)(request);
+    OTBR_PROBE(dbus__method__end, interfaceName, memberName);
+    handled = DBUS_HANDLER_RESULT_HANDLED;
 
+exit:
     return handled;
 }
 
@@ -247,20 +339,19 @@ void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
     DBusMessageIter iter;
     std::string     interfaceName;
     std::string     propertyName;
-    std::string     propertyFullPath;
     otError         error = OT_ERROR_NONE;
 
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
 
-    propertyFullPath = interfaceName + "." + propertyName;
-    otbrLogInfo("SetProperty %s", propertyFullPath.c_str());
+    otbrLogInfo("SetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
     {
-        auto handlerIter = mSetPropertyHandlers.find(propertyFullPath);
+        const PropertyHandlerType *handler =
+            FindMemberHandler(mSetPropertyHandlers, interfaceName.c_str(), propertyName.c_str());
 
-        VerifyOrExit(handlerIter != mSetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        error = handlerIter->second(iter);
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+        error = (*handler)(iter);
     }
 
 exit:
@@ -316,8 +407,84 @@ UniqueDBusMessage DBusObject::NewSignalMessage(const std::string &aInterfaceName
     return UniqueDBusMessage(dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str()));
 }
 
+void DBusObject::SchedulePropertiesChanged(void)
+{
+    VerifyOrExit(!mIsPropertiesChangedScheduled);
+
+    mIsPropertiesChangedScheduled = true;
+    mTaskRunner.Post([this]() { SignalPropertiesChanged(); });
+
+exit:
+    return;
+}
+
+void DBusObject::SignalPropertiesChanged(void)
+{
+    mIsPropertiesChangedScheduled = false;
+
+    for (const auto &interfaceChanges : mPendingPropertyChanges)
+    {
+        otbrError error = SignalPropertiesChanged(interfaceChanges.first, interfaceChanges.second);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to signal %zu changed properties of %s: %s", interfaceChanges.second.size(),
+                           interfaceChanges.first.c_str(), otbrErrorString(error));
+        }
+    }
+
+    mPendingPropertyChanges.clear();
+}
+
+otbrError DBusObject::SignalPropertiesChanged(const std::string &aInterfaceName, const PropertyChangesType &aChanges)
+{
+    UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+    DBusMessageIter   iter, subIter, dictEntryIter;
+    otbrError         error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const auto &change : aChanges)
+    {
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, change.first));
+        SuccessOrExit(error = change.second(dictEntryIter));
+
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+        otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), change.first.c_str());
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        DumpDBusMessage(*signalMsg);
+    }
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 void DBusObject::Flush(void)
 {
+    SignalPropertiesChanged();
     dbus_connection_flush(mConnection);
 }
 
@@ -41,6 +41,7 @@
 #endif
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -48,6 +49,8 @@
 #include <dbus/dbus.h>
 
 #include "common/code_utils.hpp"
+#include "common/flat_map.hpp"
+#include "common/task_runner.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
@@ -89,6 +92,21 @@ public:
      */
     virtual otbrError Init(void);
 
+    /**
+     * This method attaches the d-bus object to a new dbus-connection, after the previous one is disconnected.
+     *
+     * The object is registered to the new connection with the handlers registered so far, and the last signaled
+     * value of each property is signaled again, so that the clients of the restarted d-bus daemon see the current
+     * property state.
+     *
+     * @param[in] aConnection  The new dbus-connection the object bounds to.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully registered the object.
+     * @retval OTBR_ERROR_DBUS  Failed to register the object.
+     *
+     */
+    otbrError Reattach(DBusConnection &aConnection);
+
     /**
      * This method registers the method handler.
      *
@@ -168,12 +186,14 @@ public:
     /**
      * This method sends a property changed signal.
      *
+     * The changes are coalesced into a single `PropertiesChanged` signal per interface, which carries the latest value
+     * of each changed property and is sent in the next mainloop iteration.
+     *
      * @param[in] aInterfaceName  The interface name.
      * @param[in] aPropertyName   The property name.
      * @param[in] aValue          New value of the property.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
-     * @retval OTBR_ERROR_DBUS  Failed to send the signal.
+     * @retval OTBR_ERROR_NONE  Signal successfully queued.
      *
      */
     template <typename ValueType>
@@ -181,43 +201,15 @@ public:
                                     const std::string &aPropertyName,
                                     const ValueType   &aValue)
     {
-        UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
-        DBusMessageIter   iter, subIter, dictEntryIter;
-        otbrError         error = OTBR_ERROR_NONE;
-
-        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+        PropertyEncoderType encoder = [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
 
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
+        mSignaledProperties[aInterfaceName][aPropertyName]     = encoder;
+        mPendingPropertyChanges[aInterfaceName][aPropertyName] = std::move(encoder);
+        SchedulePropertiesChanged();
 
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
-
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
-
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
-
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
-        }
-
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
-
-    exit:
-        return error;
+        return OTBR_ERROR_NONE;
     }
 
     /**
@@ -227,7 +219,10 @@ public:
     virtual ~DBusObject(void);
 
     /**
-     * Sends all outgoing messages, blocks until the message queue is empty.
+     * Sends the pending property changes and all outgoing messages, blocks until the message queue is empty.
+     *
+     * The outgoing messages are otherwise written as the connection becomes writable, so this method is only meant
+     * to be used before the process exits.
      *
      */
     void Flush(void);
@@ -244,15 +239,59 @@ private:
     static DBusHandlerResult sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage);
 
-    UniqueDBusMessage NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName);
+    using PropertyEncoderType = std::function<otbrError(DBusMessageIter &)>;
+    using PropertyChangesType = std::map<std::string, PropertyEncoderType>;
 
-    std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
-    std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
-    std::unordered_map<std::string, std::unordered_map<std::string, AsyncPropertyHandlerType>>
-                                                         mAsyncGetPropertyHandlers;
-    std::unordered_map<std::string, PropertyHandlerType> mSetPropertyHandlers;
-    DBusConnection                                      *mConnection;
-    std::string                                          mObjectPath;
+    template <typename HandlerType> struct MemberHandler
+    {
+        std::string mInterfaceName;
+        std::string mMemberName;
+        HandlerType mHandler;
+    };
+
+    // The handlers are indexed by the hash of their interface and member names, so that finding the handler of an
+    // incoming message needs no string building.
+    template <typename HandlerType>
+    using MemberHandlerMap = std::unordered_multimap<uint64_t, MemberHandler<HandlerType>>;
+
+    // The property handlers by their names, which are kept in sorted vectors by the low memory profile since they are
+    // only registered at startup.
+#if OTBR_ENABLE_LOW_MEMORY
+    template <typename HandlerType> using NamedHandlerMap = FlatMap<std::string, HandlerType>;
+#else
+    template <typename HandlerType> using NamedHandlerMap = std::unordered_map<std::string, HandlerType>;
+#endif
+
+    template <typename HandlerType>
+    static void AddMemberHandler(MemberHandlerMap<HandlerType> &aHandlers,
+                                 const std::string             &aInterfaceName,
+                                 const std::string             &aMemberName,
+                                 const HandlerType             &aHandler);
+    template <typename HandlerType>
+    static const HandlerType *FindMemberHandler(const MemberHandlerMap<HandlerType> &aHandlers,
+                                                const char                          *aInterfaceName,
+                                                const char                          *aMemberName);
+    static uint64_t           HashMemberName(const char *aInterfaceName, const char *aMemberName);
+
+    otbrError         RegisterObjectPath(void);
+    UniqueDBusMessage NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName);
+    void              SchedulePropertiesChanged(void);
+    void              SignalPropertiesChanged(void);
+    otbrError SignalPropertiesChanged(const std::string &aInterfaceName, const PropertyChangesType &aChanges);
+
+    MemberHandlerMap<MethodHandlerType>                        mMethodHandlers;
+    NamedHandlerMap<NamedHandlerMap<PropertyHandlerType>>      mGetPropertyHandlers;
+    NamedHandlerMap<NamedHandlerMap<AsyncPropertyHandlerType>> mAsyncGetPropertyHandlers;
+    MemberHandlerMap<PropertyHandlerType>                      mSetPropertyHandlers;
+    DBusConnection                                            *mConnection;
+    std::string                                                mObjectPath;
+
+    // The changed properties by their interfaces, which are signaled in the next mainloop iteration.
+    std::map<std::string, PropertyChangesType> mPendingPropertyChanges;
+    // The last signaled value of each property by their interfaces, which are signaled again after reattaching.
+    std::map<std::string, PropertyChangesType> mSignaledProperties;
+    bool                                       mIsPropertiesChangedScheduled = false;
+    TaskRunner                                 mTaskRunner;
 };
 
 } // namespace DBus
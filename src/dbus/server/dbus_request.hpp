@@ -71,6 +71,7 @@ public:
     {
         dbus_message_ref(aMessage);
         dbus_connection_ref(aConnection);
+        GetInstanceCounter()++;
     }
 
     /**
@@ -84,6 +85,7 @@ public:
         , mMessage(nullptr)
     {
         CopyFrom(aOther);
+        GetInstanceCounter()++;
     }
 
     /**
@@ -190,6 +192,7 @@ public:
      */
     ~DBusRequest(void)
     {
+        GetInstanceCounter()--;
         if (mConnection)
         {
             dbus_connection_unref(mConnection);
@@ -200,7 +203,21 @@ public:
         }
     }
 
+    /**
+     * This method returns the number of dbus requests alive, i.e. being handled or waiting for a deferred reply.
+     *
+     * The copies of a request, e.g. captured by the callbacks, are counted separately.
+     *
+     */
+    static size_t GetInstanceCount(void) { return GetInstanceCounter(); }
+
 private:
+    static size_t &GetInstanceCounter(void)
+    {
+        static size_t sInstanceCount = 0;
+        return sInstanceCount;
+    }
+
     void CopyFrom(const DBusRequest &aOther)
     {
         if (mMessage)
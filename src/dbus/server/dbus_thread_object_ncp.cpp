@@ -28,7 +28,6 @@
 
 #include "dbus_thread_object_ncp.hpp"
 
-#include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "dbus/common/constants.hpp"
@@ -41,11 +40,24 @@ using std::placeholders::_2;
 namespace otbr {
 namespace DBus {
 
+static std::vector<uint64_t> HistogramToVector(const MainloopHistogram &aHistogram)
+{
+    std::vector<uint64_t> values = {aHistogram.GetCount(), aHistogram.GetSum(), aHistogram.GetMax()};
+
+    for (uint8_t i = 0; i < MainloopHistogram::kNumBuckets; i++)
+    {
+        values.push_back(aHistogram.GetBucketCount(i));
+    }
+
+    return values;
+}
+
 DBusThreadObjectNcp::DBusThreadObjectNcp(DBusConnection     &aConnection,
                                          const std::string  &aInterfaceName,
                                          otbr::Ncp::NcpHost &aHost)
     : DBusObject(&aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mHost(aHost)
+    , mNetworkProperties(*this, aHost)
 {
 }
 
@@ -53,10 +65,9 @@ otbrError DBusThreadObjectNcp::Init(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    SuccessOrExit(error = DBusObject::Initialize(true));
-
-    RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
-                                    std::bind(&DBusThreadObjectNcp::AsyncGetDeviceRoleHandler, this, _1));
+    // The properties are read from the cache of the NCP host, so they don't need asynchronous handlers.
+    SuccessOrExit(error = DBusObject::Initialize(false));
+    mNetworkProperties.Init();
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOIN_METHOD,
                    std::bind(&DBusThreadObjectNcp::JoinHandler, this, _1));
@@ -64,39 +75,16 @@ otbrError DBusThreadObjectNcp::Init(void)
                    std::bind(&DBusThreadObjectNcp::LeaveHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCHEDULE_MIGRATION_METHOD,
                    std::bind(&DBusThreadObjectNcp::ScheduleMigrationHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_SPINEL_TRANSACTION_STATS_METHOD,
+                   std::bind(&DBusThreadObjectNcp::GetSpinelTransactionStatsHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PACKET_CAPTURE_METHOD,
+                   std::bind(&DBusThreadObjectNcp::GetPacketCaptureHandler, this, _1));
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 exit:
     return error;
 }
 
-void DBusThreadObjectNcp::AsyncGetDeviceRoleHandler(DBusRequest &aRequest)
-{
-    otDeviceRole role = mHost.GetDeviceRole();
-
-    ReplyAsyncGetProperty(aRequest, GetDeviceRoleName(role));
-}
-
-void DBusThreadObjectNcp::ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent)
-{
-    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
-    DBusMessageIter   replyIter;
-    otError           error = OT_ERROR_NONE;
-
-    dbus_message_iter_init_append(reply.get(), &replyIter);
-    SuccessOrExit(error = OtbrErrorToOtError(DBusMessageEncodeToVariant(&replyIter, aContent)));
-
-exit:
-    if (error == OT_ERROR_NONE)
-    {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
-    }
-    else
-    {
-        aRequest.ReplyOtResult(error);
-    }
-}
-
 void DBusThreadObjectNcp::JoinHandler(DBusRequest &aRequest)
 {
     std::vector<uint8_t>     dataset;
@@ -160,5 +148,33 @@ exit:
     }
 }
 
+void DBusThreadObjectNcp::GetSpinelTransactionStatsHandler(DBusRequest &aRequest)
+{
+    using TransactionStats = otbr::Ncp::NcpSpinel::TransactionStats;
+
+    const TransactionStats &stats = mHost.GetSpinelTransactionStats();
+
+    aRequest.Reply(std::make_tuple(stats.mQueueDepth, stats.mMaxQueueDepth, stats.mInFlightTransactions,
+                                   stats.mCompletedTransactions, HistogramToVector(stats.mQueueTime),
+                                   HistogramToVector(stats.mSendTime),
+                                   HistogramToVector(stats.mResponseTime[TransactionStats::kCommandGet]),
+                                   HistogramToVector(stats.mResponseTime[TransactionStats::kCommandSet]),
+                                   HistogramToVector(stats.mResponseTime[TransactionStats::kCommandInsert]),
+                                   HistogramToVector(stats.mResponseTime[TransactionStats::kCommandRemove]),
+                                   HistogramToVector(stats.mResponseTime[TransactionStats::kCommandOther])));
+}
+
+void DBusThreadObjectNcp::GetPacketCaptureHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_PACKET_CAPTURE
+    std::vector<uint8_t> pcapng;
+
+    mHost.GetPacketCapture().WritePcapng(pcapng);
+    aRequest.Reply(std::make_tuple(pcapng));
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
 } // namespace DBus
 } // namespace otbr
@@ -41,6 +41,7 @@
 
 #include <openthread/link.h>
 
+#include "dbus/server/dbus_network_properties.hpp"
 #include "dbus/server/dbus_object.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_host.hpp"
@@ -80,14 +81,14 @@ public:
     otbrError Init(void) override;
 
 private:
-    void AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
-    void ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent);
-
     void JoinHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
     void ScheduleMigrationHandler(DBusRequest &aRequest);
+    void GetSpinelTransactionStatsHandler(DBusRequest &aRequest);
+    void GetPacketCaptureHandler(DBusRequest &aRequest);
 
-    otbr::Ncp::NcpHost &mHost;
+    otbr::Ncp::NcpHost   &mHost;
+    DBusNetworkProperties mNetworkProperties;
 };
 
 /**
@@ -27,8 +27,13 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <net/if.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include <openthread/border_agent.h>
 #include <openthread/border_router.h>
@@ -49,15 +54,24 @@
 #include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "common/memory_stats.hpp"
+#include "common/tlv.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
+#include "utils/srp_server_host_page.hpp"
 #if OTBR_ENABLE_FEATURE_FLAGS
 #include "proto/feature_flag.pb.h"
 #endif
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 #include "proto/thread_telemetry.pb.h"
 #endif
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+#include "sdp_proxy/upstream_resolver.hpp"
+#endif
+#if OTBR_ENABLE_TREL_BATCHED_IO
+#include "trel_dnssd/trel_socket.hpp"
+#endif
 #include "proto/capabilities.pb.h"
 
 /**
@@ -70,6 +84,16 @@
 #define OTBR_CONFIG_BORDER_AGENT_MESHCOP_E_UDP_PORT 0
 #endif
 
+/**
+ * @def OTBR_TELEMETRY_DATA_PUSH_INTERVAL_MS
+ *
+ * Specifies the default interval of the TelemetryDataChanged signal.
+ * If zero, the signal is disabled until a client sets the TelemetryPushInterval property.
+ */
+#ifndef OTBR_TELEMETRY_DATA_PUSH_INTERVAL_MS
+#define OTBR_TELEMETRY_DATA_PUSH_INTERVAL_MS 0
+#endif
+
 using std::placeholders::_1;
 using std::placeholders::_2;
 
@@ -96,8 +120,137 @@ static std::string GetNat64StateName(otNat64State aState)
 
     return stateName;
 }
+
+static otbr::DBus::Nat64AddressMapping ConvertNat64AddressMapping(const otNat64AddressMapping &aOtMapping)
+{
+    otbr::DBus::Nat64AddressMapping mapping;
+
+    mapping.mId = aOtMapping.mId;
+    std::copy(std::begin(aOtMapping.mIp4.mFields.m8), std::end(aOtMapping.mIp4.mFields.m8), mapping.mIp4.data());
+    std::copy(std::begin(aOtMapping.mIp6.mFields.m8), std::end(aOtMapping.mIp6.mFields.m8), mapping.mIp6.data());
+    mapping.mRemainingTimeMs = aOtMapping.mRemainingTimeMs;
+
+    mapping.mCounters.mTotal.m4To6Packets = aOtMapping.mCounters.mTotal.m4To6Packets;
+    mapping.mCounters.mTotal.m4To6Bytes   = aOtMapping.mCounters.mTotal.m4To6Bytes;
+    mapping.mCounters.mTotal.m6To4Packets = aOtMapping.mCounters.mTotal.m6To4Packets;
+    mapping.mCounters.mTotal.m6To4Bytes   = aOtMapping.mCounters.mTotal.m6To4Bytes;
+
+    mapping.mCounters.mIcmp.m4To6Packets = aOtMapping.mCounters.mIcmp.m4To6Packets;
+    mapping.mCounters.mIcmp.m4To6Bytes   = aOtMapping.mCounters.mIcmp.m4To6Bytes;
+    mapping.mCounters.mIcmp.m6To4Packets = aOtMapping.mCounters.mIcmp.m6To4Packets;
+    mapping.mCounters.mIcmp.m6To4Bytes   = aOtMapping.mCounters.mIcmp.m6To4Bytes;
+
+    mapping.mCounters.mUdp.m4To6Packets = aOtMapping.mCounters.mUdp.m4To6Packets;
+    mapping.mCounters.mUdp.m4To6Bytes   = aOtMapping.mCounters.mUdp.m4To6Bytes;
+    mapping.mCounters.mUdp.m6To4Packets = aOtMapping.mCounters.mUdp.m6To4Packets;
+    mapping.mCounters.mUdp.m6To4Bytes   = aOtMapping.mCounters.mUdp.m6To4Bytes;
+
+    mapping.mCounters.mTcp.m4To6Packets = aOtMapping.mCounters.mTcp.m4To6Packets;
+    mapping.mCounters.mTcp.m4To6Bytes   = aOtMapping.mCounters.mTcp.m4To6Bytes;
+    mapping.mCounters.mTcp.m6To4Packets = aOtMapping.mCounters.mTcp.m6To4Packets;
+    mapping.mCounters.mTcp.m6To4Bytes   = aOtMapping.mCounters.mTcp.m6To4Bytes;
+
+    return mapping;
+}
+
+static uint64_t GetNat64MappingTotalBytes(const otNat64AddressMapping &aOtMapping)
+{
+    return aOtMapping.mCounters.mTotal.m4To6Bytes + aOtMapping.mCounters.mTotal.m6To4Bytes;
+}
 #endif // OTBR_ENABLE_NAT64
 
+// The number of blocks the protobuf arena allocated from the heap since it was last reset.
+static uint32_t sProtoArenaHeapBlocks = 0;
+
+static void *AllocateProtoArenaBlock(size_t aSize)
+{
+    sProtoArenaHeapBlocks++;
+    return ::operator new(aSize);
+}
+
+static void FreeProtoArenaBlock(void *aBlock, size_t aSize)
+{
+    OTBR_UNUSED_VARIABLE(aSize);
+    ::operator delete(aBlock);
+}
+
+static google::protobuf::ArenaOptions MakeProtoArenaOptions(char *aInitialBlock, size_t aInitialBlockSize)
+{
+    google::protobuf::ArenaOptions options;
+
+    options.initial_block      = aInitialBlock;
+    options.initial_block_size = aInitialBlockSize;
+    options.block_alloc        = AllocateProtoArenaBlock;
+    options.block_dealloc      = FreeProtoArenaBlock;
+
+    return options;
+}
+
+// Writes the data to a sealed memory file, which is passed to the client instead of copying the data through the
+// bus daemon.
+static otError CreateSealedMemfd(const char *aName, const std::vector<uint8_t> &aData, int &aFd)
+{
+#if defined(MFD_ALLOW_SEALING) && defined(F_ADD_SEALS)
+    otError error  = OT_ERROR_NONE;
+    size_t  offset = 0;
+    int     fd     = memfd_create(aName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+    VerifyOrExit(fd != -1, error = OT_ERROR_NO_BUFS);
+
+    while (offset < aData.size())
+    {
+        ssize_t written = write(fd, aData.data() + offset, aData.size() - offset);
+
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrExit(written > 0, error = OT_ERROR_NO_BUFS);
+        offset += static_cast<size_t>(written);
+    }
+
+    // The client may read or map the file, but neither side can change it anymore.
+    VerifyOrExit(fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == 0,
+                 error = OT_ERROR_FAILED);
+    VerifyOrExit(lseek(fd, 0, SEEK_SET) == 0, error = OT_ERROR_FAILED);
+
+exit:
+    if (error != OT_ERROR_NONE && fd != -1)
+    {
+        close(fd);
+        fd = -1;
+    }
+    aFd = fd;
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aData);
+
+    aFd = -1;
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+// Reads the Active Timestamp TLV of a dataset in place, without parsing the other TLVs.
+static bool GetActiveTimestampTlvValue(const uint8_t *aTlvs, size_t aLength, uint64_t &aTimestamp)
+{
+    otbr::TlvIterator tlv(nullptr, 0);
+    bool              found = false;
+
+    VerifyOrExit(otbr::TlvView(aTlvs, aLength).Find(OT_MESHCOP_TLV_ACTIVETIMESTAMP, tlv));
+    VerifyOrExit(tlv.GetLength() == sizeof(aTimestamp));
+
+    aTimestamp = 0;
+    for (uint16_t i = 0; i < tlv.GetLength(); i++)
+    {
+        aTimestamp = (aTimestamp << 8) | tlv.GetValue()[i];
+    }
+    found = true;
+
+exit:
+    return found;
+}
+
 namespace otbr {
 namespace DBus {
 
@@ -108,8 +261,10 @@ DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection     &aConnection,
                                          otbr::BorderAgent  &aBorderAgent)
     : DBusObject(&aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mHost(aHost)
+    , mNetworkProperties(*this, aHost)
     , mPublisher(aPublisher)
     , mBorderAgent(aBorderAgent)
+    , mProtoArena(MakeProtoArenaOptions(mProtoArenaBlock, sizeof(mProtoArenaBlock)))
 {
 }
 
@@ -119,6 +274,7 @@ otbrError DBusThreadObjectRcp::Init(void)
     auto      threadHelper = mHost.GetThreadHelper();
 
     SuccessOrExit(error = DBusObject::Initialize(false));
+    mNetworkProperties.Init();
 
     threadHelper->AddDeviceRoleHandler(std::bind(&DBusThreadObjectRcp::DeviceRoleHandler, this, _1));
 #if OTBR_ENABLE_DHCP6_PD
@@ -126,6 +282,7 @@ otbrError DBusThreadObjectRcp::Init(void)
 #endif
     threadHelper->AddActiveDatasetChangeHandler(std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
     mHost.RegisterResetHandler(std::bind(&DBusThreadObjectRcp::NcpResetHandler, this));
+    mHost.AddNeighborTableChangedCallback(std::bind(&DBusThreadObjectRcp::SignalNeighborTableChanged, this, _1, _2));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
                    std::bind(&DBusThreadObjectRcp::ScanHandler, this, _1));
@@ -155,6 +312,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                    std::bind(&DBusThreadObjectRcp::RemoveExternalRouteHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_ALL_NODES_TO_METHOD,
                    std::bind(&DBusThreadObjectRcp::AttachAllNodesToHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_START_MIGRATION_METHOD,
+                   std::bind(&DBusThreadObjectRcp::StartMigrationHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UPDATE_VENDOR_MESHCOP_TXT_METHOD,
                    std::bind(&DBusThreadObjectRcp::UpdateMeshCopTxtHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD,
@@ -167,6 +326,18 @@ otbrError DBusThreadObjectRcp::Init(void)
                    std::bind(&DBusThreadObjectRcp::ActivateEphemeralKeyModeHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_DEACTIVATE_EPHEMERAL_KEY_MODE_METHOD,
                    std::bind(&DBusThreadObjectRcp::DeactivateEphemeralKeyModeHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_DATA_SECTIONS_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetTelemetryDataSectionsHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_DATA_FD_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetTelemetryDataFdHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_TRIM_MEMORY_METHOD,
+                   std::bind(&DBusThreadObjectRcp::TrimMemoryHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_NAT64_MAPPINGS_PAGE_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetNat64MappingsPageHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TOP_NAT64_MAPPINGS_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetTopNat64MappingsHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_SRP_HOSTS_PAGE_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetSrpHostsPageHandler, this, _1));
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObjectRcp::IntrospectHandler, this, _1));
@@ -183,6 +354,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::SetRadioRegionHandler, this, _1));
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNS_UPSTREAM_QUERY_STATE,
                                std::bind(&DBusThreadObjectRcp::SetDnsUpstreamQueryState, this, _1));
+    RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_PUSH_INTERVAL,
+                               std::bind(&DBusThreadObjectRcp::SetTelemetryPushIntervalHandler, this, _1));
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_CIDR,
                                std::bind(&DBusThreadObjectRcp::SetNat64Cidr, this, _1));
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EPHEMERAL_KEY_ENABLED,
@@ -190,8 +363,6 @@ otbrError DBusThreadObjectRcp::Init(void)
 
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LINK_MODE,
                                std::bind(&DBusThreadObjectRcp::GetLinkModeHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
-                               std::bind(&DBusThreadObjectRcp::GetDeviceRoleHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_NAME,
                                std::bind(&DBusThreadObjectRcp::GetNetworkNameHandler, this, _1));
 
@@ -234,6 +405,11 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetChannelMonitorSampleCountHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
                                std::bind(&DBusThreadObjectRcp::GetChannelMonitorAllChannelQualities, this, _1));
+    RegisterGetPropertyHandler(
+        OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_AVERAGE_CHANNEL_QUALITIES,
+        std::bind(&DBusThreadObjectRcp::GetChannelMonitorAverageChannelQualitiesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_RECOMMENDED_CHANNEL,
+                               std::bind(&DBusThreadObjectRcp::GetChannelMonitorRecommendedChannelHandler, this, _1));
 #endif
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE,
                                std::bind(&DBusThreadObjectRcp::GetChildTableHandler, this, _1));
@@ -249,12 +425,12 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetExternalRoutesHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES,
                                std::bind(&DBusThreadObjectRcp::GetOnMeshPrefixesHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS,
-                               std::bind(&DBusThreadObjectRcp::GetActiveDatasetTlvsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PENDING_DATASET_TLVS,
                                std::bind(&DBusThreadObjectRcp::GetPendingDatasetTlvsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_DATA,
                                std::bind(&DBusThreadObjectRcp::GetFeatureFlagListDataHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_VERSION,
+                               std::bind(&DBusThreadObjectRcp::GetFeatureFlagListVersionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_REGION,
                                std::bind(&DBusThreadObjectRcp::GetRadioRegionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_SRP_SERVER_INFO,
@@ -263,12 +439,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetDnssdCountersHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
-                               std::bind(&DBusThreadObjectRcp::GetOtbrVersionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
                                std::bind(&DBusThreadObjectRcp::GetOtHostVersionHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_RCP_VERSION,
-                               std::bind(&DBusThreadObjectRcp::GetOtRcpVersionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_THREAD_VERSION,
                                std::bind(&DBusThreadObjectRcp::GetThreadVersionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_SPINEL_METRICS,
@@ -303,6 +475,12 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetTelemetryDataHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
                                std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_PUSH_INTERVAL,
+                               std::bind(&DBusThreadObjectRcp::GetTelemetryPushIntervalHandler, this, _1));
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    SetTelemetryPushInterval(Milliseconds(OTBR_TELEMETRY_DATA_PUSH_INTERVAL_MS));
+#endif
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
@@ -312,7 +490,20 @@ exit:
 
 void DBusThreadObjectRcp::DeviceRoleHandler(otDeviceRole aDeviceRole)
 {
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, GetDeviceRoleName(aDeviceRole));
+    // The change of the DeviceRole property is signaled by `mNetworkProperties`.
+    OTBR_UNUSED_VARIABLE(aDeviceRole);
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    if (mTelemetryPushInterval > Milliseconds(0))
+    {
+        // All the sections of the new role are pushed, without waiting for the next interval.
+        for (std::string &sectionBytes : mPushedTelemetrySections)
+        {
+            sectionBytes.clear();
+        }
+        mTelemetryTaskRunner.Post(TaskRunner::Priority::kBackground, [this]() { PushTelemetryData(); });
+    }
+#endif
 }
 
 #if OTBR_ENABLE_DHCP6_PD
@@ -325,6 +516,12 @@ void DBusThreadObjectRcp::Dhcp6PdStateHandler(otBorderRoutingDhcp6PdState aDhcp6
 
 void DBusThreadObjectRcp::NcpResetHandler(void)
 {
+    // The result handler of the migration was dropped with the Thread helper.
+    if (mMigrationInProgress)
+    {
+        FinishMigration(OT_ERROR_ABORT);
+    }
+
     mHost.GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObjectRcp::DeviceRoleHandler, this, _1));
     mHost.GetThreadHelper()->AddActiveDatasetChangeHandler(
         std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
@@ -334,8 +531,60 @@ void DBusThreadObjectRcp::NcpResetHandler(void)
 
 void DBusThreadObjectRcp::ScanHandler(DBusRequest &aRequest)
 {
-    auto threadHelper = mHost.GetThreadHelper();
-    threadHelper->Scan(std::bind(&DBusThreadObjectRcp::ReplyScanResult, this, aRequest, _1, _2));
+    auto                                   threadHelper  = mHost.GetThreadHelper();
+    agent::ThreadHelper::ScanResultHandler resultHandler = nullptr;
+
+    if (mPendingScans++ == 0)
+    {
+        resultHandler = std::bind(&DBusThreadObjectRcp::SignalScanResult, this, _1);
+    }
+
+    threadHelper->Scan(std::bind(&DBusThreadObjectRcp::ReplyScanResult, this, aRequest, _1, _2), resultHandler);
+}
+
+void DBusThreadObjectRcp::SignalScanResult(const otActiveScanResult &aResult)
+{
+    ActiveScanResult result = ConvertScanResult(aResult);
+
+    Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_SCAN_RESULT, std::tie(result));
+}
+
+void DBusThreadObjectRcp::SignalNeighborTableChanged(
+    const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+    uint32_t                                                aGeneration)
+{
+    std::vector<NeighborTableChange> changes;
+
+    changes.reserve(aChanges.size());
+
+    for (const agent::NeighborTableTracker::Change &change : aChanges)
+    {
+        NeighborTableChange neighborChange;
+
+        neighborChange.mType             = change.mType;
+        neighborChange.mExtAddress       = ConvertOpenThreadUint64(change.mEntry.mExtAddress.m8);
+        neighborChange.mRloc16           = change.mEntry.mRloc16;
+        neighborChange.mIsChild          = change.mEntry.mIsChild;
+        neighborChange.mRxOnWhenIdle     = change.mEntry.mRxOnWhenIdle;
+        neighborChange.mFullThreadDevice = change.mEntry.mFullThreadDevice;
+        neighborChange.mFullNetworkData  = change.mEntry.mFullNetworkData;
+        changes.push_back(neighborChange);
+    }
+
+    Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_NEIGHBOR_TABLE_CHANGED, std::tie(aGeneration, changes));
+}
+
+ActiveScanResult DBusThreadObjectRcp::ConvertScanResult(const otActiveScanResult &aResult)
+{
+    ActiveScanResult result = {};
+
+    result.mExtAddress = ConvertOpenThreadUint64(aResult.mExtAddress.m8);
+    result.mPanId      = aResult.mPanId;
+    result.mChannel    = aResult.mChannel;
+    result.mRssi       = aResult.mRssi;
+    result.mLqi        = aResult.mLqi;
+
+    return result;
 }
 
 void DBusThreadObjectRcp::ReplyScanResult(DBusRequest                           &aRequest,
@@ -344,6 +593,8 @@ void DBusThreadObjectRcp::ReplyScanResult(DBusRequest
 {
     std::vector<ActiveScanResult> results;
 
+    mPendingScans--;
+
     if (aError != OT_ERROR_NONE)
     {
         aRequest.ReplyOtResult(aError);
@@ -352,15 +603,7 @@ void DBusThreadObjectRcp::ReplyScanResult(DBusRequest
     {
         for (const auto &r : aResult)
         {
-            ActiveScanResult result = {};
-
-            result.mExtAddress = ConvertOpenThreadUint64(r.mExtAddress.m8);
-            result.mPanId      = r.mPanId;
-            result.mChannel    = r.mChannel;
-            result.mRssi       = r.mRssi;
-            result.mLqi        = r.mLqi;
-
-            results.emplace_back(result);
+            results.emplace_back(ConvertScanResult(r));
         }
 
         aRequest.Reply(std::tie(results));
@@ -467,6 +710,82 @@ exit:
     }
 }
 
+void DBusThreadObjectRcp::StartMigrationHandler(DBusRequest &aRequest)
+{
+    std::vector<uint8_t> dataset;
+    uint64_t             migrationId;
+    uint64_t             activeTimestamp;
+    otError              error = OT_ERROR_NONE;
+
+    auto args = std::tie(dataset, migrationId);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(!mMigrationInProgress, error = OT_ERROR_BUSY);
+
+    VerifyOrExit(dataset.size() <= OT_OPERATIONAL_DATASET_MAX_LENGTH, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(TlvView(dataset.data(), dataset.size()).IsWellFormed(), error = OT_ERROR_PARSE);
+    VerifyOrExit(GetActiveTimestampTlvValue(dataset.data(), dataset.size(), activeTimestamp),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    mMigrationInProgress      = true;
+    mMigrationStarting        = true;
+    mMigrationStartError      = OT_ERROR_NONE;
+    mMigrationId              = migrationId;
+    mMigrationActiveTimestamp = activeTimestamp;
+
+    // The other checks of the dataset are done by AttachAllNodesTo(), which reports their errors before returning.
+    mHost.GetThreadHelper()->AttachAllNodesTo(dataset, [this, migrationId](otError aError, int64_t aDelayMs) {
+        HandleMigrationResult(migrationId, aError, aDelayMs);
+    });
+    mMigrationStarting = false;
+    error              = mMigrationStartError;
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusThreadObjectRcp::HandleMigrationResult(uint64_t aMigrationId, otError aError, int64_t aDelayMs)
+{
+    // The migration may already be completed by the change of the active dataset.
+    VerifyOrExit(mMigrationInProgress && aMigrationId == mMigrationId);
+
+    if (aError != OT_ERROR_NONE && mMigrationStarting)
+    {
+        mMigrationStartError = aError;
+        mMigrationInProgress = false;
+    }
+    else if (aError != OT_ERROR_NONE || aDelayMs == 0)
+    {
+        FinishMigration(aError);
+    }
+    else
+    {
+        SignalMigrationProgress(OTBR_MIGRATION_STATE_NAME_SCHEDULED, OT_ERROR_NONE, aDelayMs);
+    }
+
+exit:
+    return;
+}
+
+void DBusThreadObjectRcp::FinishMigration(otError aError)
+{
+    const char *state =
+        (aError == OT_ERROR_NONE) ? OTBR_MIGRATION_STATE_NAME_COMPLETED : OTBR_MIGRATION_STATE_NAME_FAILED;
+
+    mMigrationInProgress = false;
+    SignalMigrationProgress(state, aError, 0);
+}
+
+void DBusThreadObjectRcp::SignalMigrationProgress(const char *aState, otError aError, int64_t aDelayMs)
+{
+    std::string state     = aState;
+    std::string errorName = ConvertToDBusErrorName(aError);
+
+    otbrLogInfo("Migration %" PRIu64 " %s: %s", mMigrationId, aState, otThreadErrorToString(aError));
+    Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_MIGRATION_PROGRESS,
+           std::tie(mMigrationId, state, errorName, aDelayMs));
+}
+
 void DBusThreadObjectRcp::DetachHandler(DBusRequest &aRequest)
 {
     aRequest.ReplyOtResult(mHost.GetThreadHelper()->Detach());
@@ -691,19 +1010,6 @@ exit:
     return error;
 }
 
-otError DBusThreadObjectRcp::GetDeviceRoleHandler(DBusMessageIter &aIter)
-{
-    auto         threadHelper = mHost.GetThreadHelper();
-    otDeviceRole role         = otThreadGetDeviceRole(threadHelper->GetInstance());
-    std::string  roleName     = GetDeviceRoleName(role);
-    otError      error        = OT_ERROR_NONE;
-
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, roleName) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-exit:
-    return error;
-}
-
 otError DBusThreadObjectRcp::GetNetworkNameHandler(DBusMessageIter &aIter)
 {
     auto        threadHelper = mHost.GetThreadHelper();
@@ -930,16 +1236,11 @@ exit:
 
 otError DBusThreadObjectRcp::GetNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mHost.GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    auto    threadHelper = mHost.GetThreadHelper();
+    otError error        = OT_ERROR_NONE;
 
-    SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/false, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, threadHelper->GetNetworkData().mFullTlvs) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -947,16 +1248,11 @@ exit:
 
 otError DBusThreadObjectRcp::GetStableNetworkDataHandler(DBusMessageIter &aIter)
 {
-    static constexpr size_t kNetworkDataMaxSize = 255;
-    auto                    threadHelper        = mHost.GetThreadHelper();
-    otError                 error               = OT_ERROR_NONE;
-    uint8_t                 data[kNetworkDataMaxSize];
-    uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
+    auto    threadHelper = mHost.GetThreadHelper();
+    otError error        = OT_ERROR_NONE;
 
-    SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/true, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, threadHelper->GetNetworkData().mStableTlvs) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1020,6 +1316,53 @@ exit:
 #endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 }
 
+otError DBusThreadObjectRcp::GetChannelMonitorAverageChannelQualitiesHandler(DBusMessageIter &aIter)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    auto                                threadHelper = mHost.GetThreadHelper();
+    const agent::ChannelQualityHistory &history      = threadHelper->GetChannelMonitorSampler().GetHistory();
+    uint32_t                            channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance());
+    otError                             error        = OT_ERROR_NONE;
+    std::vector<ChannelQuality>         quality;
+
+    for (uint8_t i = 0; i < agent::ChannelQualityHistory::kNumChannels; i++)
+    {
+        uint8_t channel = agent::ChannelQualityHistory::kFirstChannel + i;
+
+        if (channelMask & (1U << channel))
+        {
+            quality.emplace_back(ChannelQuality{channel, history.GetAverageOccupancy(channel)});
+        }
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, quality) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+}
+
+otError DBusThreadObjectRcp::GetChannelMonitorRecommendedChannelHandler(DBusMessageIter &aIter)
+{
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    auto    threadHelper = mHost.GetThreadHelper();
+    otError error        = OT_ERROR_NONE;
+    uint8_t channel      = threadHelper->GetChannelMonitorSampler().GetHistory().GetRecommendedChannel(
+        otLinkGetSupportedChannelMask(threadHelper->GetInstance()));
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, channel) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+}
+
 otError DBusThreadObjectRcp::GetChildTableHandler(DBusMessageIter &aIter)
 {
     auto                   threadHelper = mHost.GetThreadHelper();
@@ -1028,6 +1371,8 @@ otError DBusThreadObjectRcp::GetChildTableHandler(DBusMessageIter &aIter)
     otChildInfo            childInfo;
     std::vector<ChildInfo> childTable;
 
+    childTable.reserve(otThreadGetMaxAllowedChildren(threadHelper->GetInstance()));
+
     while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
     {
         ChildInfo info;
@@ -1134,11 +1479,9 @@ otError DBusThreadObjectRcp::GetExternalRoutesHandler(DBusMessageIter &aIter)
 {
     auto                       threadHelper = mHost.GetThreadHelper();
     otError                    error        = OT_ERROR_NONE;
-    otNetworkDataIterator      iter         = OT_NETWORK_DATA_ITERATOR_INIT;
-    otExternalRouteConfig      config;
     std::vector<ExternalRoute> externalRouteTable;
 
-    while (otNetDataGetNextRoute(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
+    for (const otExternalRouteConfig &config : threadHelper->GetNetworkData().mExternalRoutes)
     {
         ExternalRoute route;
 
@@ -1163,11 +1506,9 @@ otError DBusThreadObjectRcp::GetOnMeshPrefixesHandler(DBusMessageIter &aIter)
 {
     auto                      threadHelper = mHost.GetThreadHelper();
     otError                   error        = OT_ERROR_NONE;
-    otNetworkDataIterator     iter         = OT_NETWORK_DATA_ITERATOR_INIT;
-    otBorderRouterConfig      config;
     std::vector<OnMeshPrefix> onMeshPrefixes;
 
-    while (otNetDataGetNextOnMeshPrefix(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
+    for (const otBorderRouterConfig &config : threadHelper->GetNetworkData().mOnMeshPrefixes)
     {
         OnMeshPrefix prefix;
 
@@ -1210,22 +1551,6 @@ exit:
     return error;
 }
 
-otError DBusThreadObjectRcp::GetActiveDatasetTlvsHandler(DBusMessageIter &aIter)
-{
-    auto                     threadHelper = mHost.GetThreadHelper();
-    otError                  error        = OT_ERROR_NONE;
-    std::vector<uint8_t>     data;
-    otOperationalDatasetTlvs datasetTlvs;
-
-    SuccessOrExit(error = otDatasetGetActiveTlvs(threadHelper->GetInstance(), &datasetTlvs));
-    data = std::vector<uint8_t>{std::begin(datasetTlvs.mTlvs), std::begin(datasetTlvs.mTlvs) + datasetTlvs.mLength};
-
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-
-exit:
-    return error;
-}
-
 otError DBusThreadObjectRcp::GetPendingDatasetTlvsHandler(DBusMessageIter &aIter)
 {
     auto                     threadHelper = mHost.GetThreadHelper();
@@ -1245,17 +1570,24 @@ exit:
 otError DBusThreadObjectRcp::SetFeatureFlagListDataHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_FEATURE_FLAGS
-    otError              error = OT_ERROR_NONE;
+    otError              error   = OT_ERROR_NONE;
+    uint32_t             version = mHost.GetAppliedFeatureFlagListVersion();
     std::vector<uint8_t> data;
     FeatureFlagList      featureFlagList;
 
     VerifyOrExit(DBusMessageExtractFromVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(featureFlagList.ParseFromString(std::string(data.begin(), data.end())), error = OT_ERROR_INVALID_ARGS);
-    // TODO: implement the feature flag handler at every component
-    mBorderAgent.SetEphemeralKeyEnabled(featureFlagList.enable_ephemeralkey());
-    otbrLogInfo("Border Agent Ephemeral Key Feature has been %s by feature flag",
-                (featureFlagList.enable_ephemeralkey() ? "enable" : "disable"));
-    VerifyOrExit((error = mHost.ApplyFeatureFlagList(featureFlagList)) == OT_ERROR_NONE);
+    VerifyOrExit(featureFlagList.ParseFromArray(data.data(), static_cast<int>(data.size())),
+                 error = OT_ERROR_INVALID_ARGS);
+    error = mHost.ApplyFeatureFlagList(featureFlagList);
+
+    // The same list is pushed periodically, the Border Agent is only updated when the applied list changes.
+    if (mHost.GetAppliedFeatureFlagListVersion() != version)
+    {
+        // TODO: implement the feature flag handler at every component
+        mBorderAgent.SetEphemeralKeyEnabled(featureFlagList.enable_ephemeralkey());
+        otbrLogInfo("Border Agent Ephemeral Key Feature has been %s by feature flag",
+                    (featureFlagList.enable_ephemeralkey() ? "enable" : "disable"));
+    }
 exit:
     return error;
 #else
@@ -1267,11 +1599,27 @@ exit:
 otError DBusThreadObjectRcp::GetFeatureFlagListDataHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_FEATURE_FLAGS
-    otError              error                       = OT_ERROR_NONE;
-    const std::string    appliedFeatureFlagListBytes = mHost.GetAppliedFeatureFlagListBytes();
-    std::vector<uint8_t> data(appliedFeatureFlagListBytes.begin(), appliedFeatureFlagListBytes.end());
+    otError            error                       = OT_ERROR_NONE;
+    const std::string &appliedFeatureFlagListBytes = mHost.GetAppliedFeatureFlagListBytes();
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    mProtoBuffer.assign(appliedFeatureFlagListBytes.begin(), appliedFeatureFlagListBytes.end());
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mProtoBuffer) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+otError DBusThreadObjectRcp::GetFeatureFlagListVersionHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_FEATURE_FLAGS
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mHost.GetAppliedFeatureFlagListVersion()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1342,53 +1690,30 @@ exit:
 otError DBusThreadObjectRcp::GetSrpServerInfoHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-    auto                               threadHelper = mHost.GetThreadHelper();
-    auto                               instance     = threadHelper->GetInstance();
-    otError                            error        = OT_ERROR_NONE;
-    SrpServerInfo                      srpServerInfo{};
-    otSrpServerLeaseInfo               leaseInfo;
-    const otSrpServerHost             *host             = nullptr;
-    const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(instance);
+    auto                                threadHelper = mHost.GetThreadHelper();
+    auto                                instance     = threadHelper->GetInstance();
+    otError                             error        = OT_ERROR_NONE;
+    SrpServerInfo                       srpServerInfo{};
+    const agent::SrpServerStats::Stats &stats            = threadHelper->GetSrpServerStats().Get();
+    const otSrpServerResponseCounters  *responseCounters = otSrpServerGetResponseCounters(instance);
 
     srpServerInfo.mState       = SrpServerState(static_cast<uint8_t>(otSrpServerGetState(instance)));
     srpServerInfo.mPort        = otSrpServerGetPort(instance);
     srpServerInfo.mAddressMode = SrpServerAddressMode(static_cast<uint8_t>(otSrpServerGetAddressMode(instance)));
 
-    while ((host = otSrpServerGetNextHost(instance, host)))
-    {
-        const otSrpServerService *service = nullptr;
-
-        if (otSrpServerHostIsDeleted(host))
-        {
-            ++srpServerInfo.mHosts.mDeletedCount;
-        }
-        else
-        {
-            ++srpServerInfo.mHosts.mFreshCount;
-            otSrpServerHostGetLeaseInfo(host, &leaseInfo);
-            srpServerInfo.mHosts.mLeaseTimeTotal += leaseInfo.mLease;
-            srpServerInfo.mHosts.mKeyLeaseTimeTotal += leaseInfo.mKeyLease;
-            srpServerInfo.mHosts.mRemainingLeaseTimeTotal += leaseInfo.mRemainingLease;
-            srpServerInfo.mHosts.mRemainingKeyLeaseTimeTotal += leaseInfo.mRemainingKeyLease;
-        }
+    srpServerInfo.mHosts.mFreshCount                 = stats.mHosts.mFreshCount;
+    srpServerInfo.mHosts.mDeletedCount               = stats.mHosts.mDeletedCount;
+    srpServerInfo.mHosts.mLeaseTimeTotal             = stats.mHosts.mLeaseTimeTotal;
+    srpServerInfo.mHosts.mKeyLeaseTimeTotal          = stats.mHosts.mKeyLeaseTimeTotal;
+    srpServerInfo.mHosts.mRemainingLeaseTimeTotal    = stats.mHosts.mRemainingLeaseTimeTotal;
+    srpServerInfo.mHosts.mRemainingKeyLeaseTimeTotal = stats.mHosts.mRemainingKeyLeaseTimeTotal;
 
-        while ((service = otSrpServerHostGetNextService(host, service)))
-        {
-            if (otSrpServerServiceIsDeleted(service))
-            {
-                ++srpServerInfo.mServices.mDeletedCount;
-            }
-            else
-            {
-                ++srpServerInfo.mServices.mFreshCount;
-                otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
-                srpServerInfo.mServices.mLeaseTimeTotal += leaseInfo.mLease;
-                srpServerInfo.mServices.mKeyLeaseTimeTotal += leaseInfo.mKeyLease;
-                srpServerInfo.mServices.mRemainingLeaseTimeTotal += leaseInfo.mRemainingLease;
-                srpServerInfo.mServices.mRemainingKeyLeaseTimeTotal += leaseInfo.mRemainingKeyLease;
-            }
-        }
-    }
+    srpServerInfo.mServices.mFreshCount                 = stats.mServices.mFreshCount;
+    srpServerInfo.mServices.mDeletedCount               = stats.mServices.mDeletedCount;
+    srpServerInfo.mServices.mLeaseTimeTotal             = stats.mServices.mLeaseTimeTotal;
+    srpServerInfo.mServices.mKeyLeaseTimeTotal          = stats.mServices.mKeyLeaseTimeTotal;
+    srpServerInfo.mServices.mRemainingLeaseTimeTotal    = stats.mServices.mRemainingLeaseTimeTotal;
+    srpServerInfo.mServices.mRemainingKeyLeaseTimeTotal = stats.mServices.mRemainingKeyLeaseTimeTotal;
 
     srpServerInfo.mResponseCounters.mSuccess       = responseCounters->mSuccess;
     srpServerInfo.mResponseCounters.mServerFailure = responseCounters->mServerFailure;
@@ -1408,6 +1733,83 @@ exit:
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 }
 
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+static SrpServerHost ConvertSrpServerHost(const agent::SrpServerHostPage::Host &aPageHost)
+{
+    SrpServerHost host;
+
+    host.mFullName          = aPageHost.mFullName;
+    host.mDeleted           = aPageHost.mDeleted;
+    host.mLease             = aPageHost.mLease;
+    host.mKeyLease          = aPageHost.mKeyLease;
+    host.mRemainingLease    = aPageHost.mRemainingLease;
+    host.mRemainingKeyLease = aPageHost.mRemainingKeyLease;
+
+    for (const otbr::Ip6Address &pageAddress : aPageHost.mAddresses)
+    {
+        Ip6Address address;
+
+        std::copy(std::begin(pageAddress.m8), std::end(pageAddress.m8), address.data());
+        host.mAddresses.push_back(address);
+    }
+
+    for (const agent::SrpServerHostPage::Service &pageService : aPageHost.mServices)
+    {
+        SrpServerService service;
+
+        service.mFullName          = pageService.mFullName;
+        service.mDeleted           = pageService.mDeleted;
+        service.mPort              = pageService.mPort;
+        service.mPriority          = pageService.mPriority;
+        service.mWeight            = pageService.mWeight;
+        service.mLease             = pageService.mLease;
+        service.mKeyLease          = pageService.mKeyLease;
+        service.mRemainingLease    = pageService.mRemainingLease;
+        service.mRemainingKeyLease = pageService.mRemainingKeyLease;
+        host.mServices.push_back(service);
+    }
+
+    return host;
+}
+
+void DBusThreadObjectRcp::GetSrpHostsPageHandler(DBusRequest &aRequest)
+{
+    otError                                     error    = OT_ERROR_NONE;
+    uint32_t                                    maxCount = 0;
+    std::string                                 cursor;
+    std::string                                 namePrefix;
+    std::string                                 nextCursor;
+    auto                                        args = std::tie(cursor, namePrefix, maxCount);
+    std::vector<agent::SrpServerHostPage::Host> pageHosts;
+    std::vector<SrpServerHost>                  hosts;
+
+    SuccessOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(agent::SrpServerHostPage::Get(mHost.GetThreadHelper()->GetInstance(), cursor, namePrefix, maxCount,
+                                               pageHosts, nextCursor) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+    for (const agent::SrpServerHostPage::Host &pageHost : pageHosts)
+    {
+        hosts.push_back(ConvertSrpServerHost(pageHost));
+    }
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        aRequest.Reply(std::tie(hosts, nextCursor));
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+#else  // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+void DBusThreadObjectRcp::GetSrpHostsPageHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+}
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
 otError DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler(DBusMessageIter &aIter)
 {
     otError error = OT_ERROR_NONE;
@@ -1477,23 +1879,17 @@ exit:
 otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_TELEMETRY_DATA_API
-    otError                      error = OT_ERROR_NONE;
-    threadnetwork::TelemetryData telemetryData;
-    auto                         threadHelper = mHost.GetThreadHelper();
+    otError error         = OT_ERROR_NONE;
+    auto   &telemetryData = *google::protobuf::Arena::CreateMessage<threadnetwork::TelemetryData>(&mProtoArena);
 
-    if (threadHelper->RetrieveTelemetryData(mPublisher, telemetryData) != OT_ERROR_NONE)
+    if (RetrieveTelemetryData(telemetryData, agent::ThreadHelper::kTelemetryAllSections) != OT_ERROR_NONE)
     {
         otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
     }
 
-    {
-        const std::string    telemetryDataBytes = telemetryData.SerializeAsString();
-        std::vector<uint8_t> data(telemetryDataBytes.begin(), telemetryDataBytes.end());
-
-        VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    }
+    error = EncodeProtoToVariant(aIter, telemetryData);
+    ResetProtoArena("TelemetryData");
 
-exit:
     return error;
 #else
     OTBR_UNUSED_VARIABLE(aIter);
@@ -1503,23 +1899,197 @@ exit:
 
 otError DBusThreadObjectRcp::GetCapabilitiesHandler(DBusMessageIter &aIter)
 {
-    otError            error = OT_ERROR_NONE;
-    otbr::Capabilities capabilities;
+    otError error        = OT_ERROR_NONE;
+    auto   &capabilities = *google::protobuf::Arena::CreateMessage<otbr::Capabilities>(&mProtoArena);
 
     capabilities.set_nat64(OTBR_ENABLE_NAT64);
     capabilities.set_dhcp6_pd(OTBR_ENABLE_DHCP6_PD);
 
+    error = EncodeProtoToVariant(aIter, capabilities);
+    ResetProtoArena("Capabilities");
+
+    return error;
+}
+
+otError DBusThreadObjectRcp::SetTelemetryPushIntervalHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error = OT_ERROR_NONE;
+    uint32_t interval;
+
+    VerifyOrExit(DBusMessageExtractFromVariant(&aIter, interval) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    SetTelemetryPushInterval(Milliseconds(interval));
+
+exit:
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aIter);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+otError DBusThreadObjectRcp::GetTelemetryPushIntervalHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error    = OT_ERROR_NONE;
+    uint32_t interval = static_cast<uint32_t>(mTelemetryPushInterval.count());
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, interval) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aIter);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+void DBusThreadObjectRcp::SetTelemetryPushInterval(Milliseconds aInterval)
+{
+    mTelemetryTaskRunner.Cancel(mTelemetryPushTaskId);
+    mTelemetryPushTaskId   = 0;
+    mTelemetryPushInterval = aInterval;
+
+    if (mTelemetryPushInterval > Milliseconds(0))
     {
-        const std::string    dataBytes = capabilities.SerializeAsString();
-        std::vector<uint8_t> data(dataBytes.begin(), dataBytes.end());
+        mTelemetryPushTaskId = mTelemetryTaskRunner.Post(TaskRunner::Priority::kBackground, mTelemetryPushInterval,
+                                                         [this]() { HandleTelemetryPushTimer(); });
+    }
+}
+
+void DBusThreadObjectRcp::HandleTelemetryPushTimer(void)
+{
+    mTelemetryPushTaskId = mTelemetryTaskRunner.Post(TaskRunner::Priority::kBackground, mTelemetryPushInterval,
+                                                     [this]() { HandleTelemetryPushTimer(); });
+    PushTelemetryData();
+}
 
-        VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+otError DBusThreadObjectRcp::RetrieveTelemetryData(threadnetwork::TelemetryData &aTelemetryData, uint32_t aSections)
+{
+    otError error = mHost.GetThreadHelper()->RetrieveCachedTelemetryData(mPublisher, aTelemetryData, aSections);
+
+#if OTBR_ENABLE_BORDER_AGENT
+    // The Border Agent keeps its own metrics, which are not known by the thread helper.
+    if (aSections & agent::ThreadHelper::kTelemetryBorderRouter)
+    {
+        auto borderAgentInfo = aTelemetryData.mutable_wpan_border_router()->mutable_border_agent_info();
+
+        agent::ThreadHelper::CopyMdnsLatencyHistogram(mBorderAgent.GetEpskcDiscoverableLatencies(),
+                                                      borderAgentInfo->mutable_epskc_discoverable_latencies());
     }
+#endif
+
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+    if ((aSections & agent::ThreadHelper::kTelemetryBorderRouter) && UpstreamResolver::GetActive() != nullptr)
+    {
+        auto  resolverCounters =
+            aTelemetryData.mutable_wpan_border_router()->mutable_dns_server()->mutable_upstream_resolver_counters();
+        auto &counters         = UpstreamResolver::GetActive()->GetCounters();
+
+        resolverCounters->set_cache_hits(counters.mCacheHits);
+        resolverCounters->set_cache_misses(counters.mCacheMisses);
+        resolverCounters->set_coalesced_queries(counters.mCoalescedQueries);
+        resolverCounters->set_upstream_queries(counters.mUpstreamQueries);
+        resolverCounters->set_tcp_queries(counters.mTcpQueries);
+        resolverCounters->set_timeouts(counters.mTimeouts);
+    }
+#endif
+
+#if OTBR_ENABLE_TREL_BATCHED_IO
+    if ((aSections & agent::ThreadHelper::kTelemetryBorderRouter) && TrelDnssd::TrelSocket::GetActive() != nullptr)
+    {
+        auto        trelInfo       = aTelemetryData.mutable_wpan_border_router()->mutable_trel_info();
+        auto        socketCounters = trelInfo->mutable_socket_counters();
+        const auto &counters       = TrelDnssd::TrelSocket::GetActive()->GetCounters();
+
+        socketCounters->set_tx_syscalls(counters.mTxSyscalls);
+        socketCounters->set_tx_packets(counters.mTxPackets);
+        socketCounters->set_tx_drops(counters.mTxDrops);
+        socketCounters->set_rx_syscalls(counters.mRxSyscalls);
+        socketCounters->set_rx_packets(counters.mRxPackets);
+
+        for (const auto &peer : TrelDnssd::TrelSocket::GetActive()->GetPeerCounters())
+        {
+            auto peerCounters = trelInfo->add_peer_socket_counters();
+
+            peerCounters->set_tx_syscalls(peer.mTxSyscalls);
+            peerCounters->set_tx_packets(peer.mTxPackets);
+            peerCounters->set_rx_syscalls(peer.mRxSyscalls);
+            peerCounters->set_rx_packets(peer.mRxPackets);
+        }
+    }
+#endif
 
-exit:
     return error;
 }
 
+void DBusThreadObjectRcp::PushTelemetryData(void)
+{
+    uint32_t    changedSections = 0;
+    std::string delta;
+
+    for (uint8_t i = 0; i < agent::ThreadHelper::kTelemetrySectionCount; i++)
+    {
+        uint32_t    section       = 1u << i;
+        auto       &telemetryData = *google::protobuf::Arena::CreateMessage<threadnetwork::TelemetryData>(&mProtoArena);
+        std::string sectionBytes;
+
+        if (RetrieveTelemetryData(telemetryData, section) != OT_ERROR_NONE)
+        {
+            otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+        }
+
+        telemetryData.SerializeToString(&sectionBytes);
+        if (sectionBytes == mPushedTelemetrySections[i])
+        {
+            continue;
+        }
+
+        // The sections are distinct fields, so the concatenation of their encodings is the encoding of the message
+        // with all of them.
+        delta += sectionBytes;
+        changedSections |= section;
+        mPushedTelemetrySections[i] = std::move(sectionBytes);
+    }
+
+    mProtoBuffer.assign(delta.begin(), delta.end());
+    if (changedSections != 0)
+    {
+        Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_TELEMETRY_DATA_CHANGED,
+               std::tie(changedSections, mProtoBuffer));
+    }
+
+    ResetProtoArena("TelemetryDataChanged");
+}
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
+template <typename MessageType> void DBusThreadObjectRcp::SerializeProto(const MessageType &aMessage)
+{
+    // The buffer keeps its capacity across the replies, and is appended to the D-Bus message as a whole.
+    mProtoBuffer.resize(aMessage.ByteSizeLong());
+    aMessage.SerializeWithCachedSizesToArray(mProtoBuffer.data());
+}
+
+template <typename MessageType>
+otError DBusThreadObjectRcp::EncodeProtoToVariant(DBusMessageIter &aIter, const MessageType &aMessage)
+{
+    SerializeProto(aMessage);
+
+    return DBusMessageEncodeToVariant(&aIter, mProtoBuffer) == OTBR_ERROR_NONE ? OT_ERROR_NONE : OT_ERROR_INVALID_ARGS;
+}
+
+void DBusThreadObjectRcp::ResetProtoArena(const char *aMessageName)
+{
+    uint64_t arenaBytes = mProtoArena.Reset();
+
+    otbrLogDebug("Encoded %s: %zu bytes, %" PRIu64 " arena bytes, %" PRIu32 " heap blocks", aMessageName,
+                 mProtoBuffer.size(), arenaBytes, sProtoArenaHeapBlocks);
+    sProtoArenaHeapBlocks = 0;
+}
+
 void DBusThreadObjectRcp::GetPropertiesHandler(DBusRequest &aRequest)
 {
     UniqueDBusMessage        reply(dbus_message_new_method_return(aRequest.GetMessage()));
@@ -1569,17 +2139,6 @@ void DBusThreadObjectRcp::RegisterGetPropertyHandler(const std::string         &
     mGetPropertyHandlers[aPropertyName] = aHandler;
 }
 
-otError DBusThreadObjectRcp::GetOtbrVersionHandler(DBusMessageIter &aIter)
-{
-    otError     error   = OT_ERROR_NONE;
-    std::string version = OTBR_PACKAGE_VERSION;
-
-    SuccessOrExit(DBusMessageEncodeToVariant(&aIter, version), error = OT_ERROR_FAILED);
-
-exit:
-    return error;
-}
-
 otError DBusThreadObjectRcp::GetOtHostVersionHandler(DBusMessageIter &aIter)
 {
     otError     error   = OT_ERROR_NONE;
@@ -1608,18 +2167,6 @@ exit:
     return error;
 }
 
-otError DBusThreadObjectRcp::GetOtRcpVersionHandler(DBusMessageIter &aIter)
-{
-    auto        threadHelper = mHost.GetThreadHelper();
-    otError     error        = OT_ERROR_NONE;
-    std::string version      = otGetRadioVersionString(threadHelper->GetInstance());
-
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, version) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
-
-exit:
-    return error;
-}
-
 otError DBusThreadObjectRcp::GetThreadVersionHandler(DBusMessageIter &aIter)
 {
     otError error = OT_ERROR_NONE;
@@ -1688,7 +2235,8 @@ otError DBusThreadObjectRcp::GetRadioCoexMetrics(DBusMessageIter &aIter)
     otRadioCoexMetrics otRadioCoexMetrics;
     RadioCoexMetrics   radioCoexMetrics;
 
-    SuccessOrExit(error = otPlatRadioGetCoexMetrics(mHost.GetInstance(), &otRadioCoexMetrics));
+    // The metrics are read by the sampler in the background, so that no spinel transaction blocks the query.
+    SuccessOrExit(error = mHost.GetThreadHelper()->GetRadioCoexSampler().GetMetrics(otRadioCoexMetrics));
 
     radioCoexMetrics.mNumGrantGlitch                     = otRadioCoexMetrics.mNumGrantGlitch;
     radioCoexMetrics.mNumTxRequest                       = otRadioCoexMetrics.mNumTxRequest;
@@ -1756,8 +2304,19 @@ exit:
 void DBusThreadObjectRcp::ActiveDatasetChangeHandler(const otOperationalDatasetTlvs &aDatasetTlvs)
 {
     std::vector<uint8_t> value(aDatasetTlvs.mLength);
+    uint64_t             activeTimestamp;
+
     std::copy(aDatasetTlvs.mTlvs, aDatasetTlvs.mTlvs + aDatasetTlvs.mLength, value.begin());
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS, value);
+
+    VerifyOrExit(mMigrationInProgress);
+    VerifyOrExit(GetActiveTimestampTlvValue(aDatasetTlvs.mTlvs, aDatasetTlvs.mLength, activeTimestamp));
+    // The seconds and the ticks are compared, the U bit is the least significant one.
+    VerifyOrExit((activeTimestamp >> 1) == (mMigrationActiveTimestamp >> 1));
+    FinishMigration(OT_ERROR_NONE);
+
+exit:
+    return;
 }
 
 void DBusThreadObjectRcp::LeaveNetworkHandler(DBusRequest &aRequest)
@@ -1815,43 +2374,120 @@ otError DBusThreadObjectRcp::GetNat64Mappings(DBusMessageIter &aIter)
     std::vector<Nat64AddressMapping> mappings;
     otNat64AddressMappingIterator    iterator;
     otNat64AddressMapping            otMapping;
-    Nat64AddressMapping              mapping;
 
     otNat64InitAddressMappingIterator(mHost.GetThreadHelper()->GetInstance(), &iterator);
     while (otNat64GetNextAddressMapping(mHost.GetThreadHelper()->GetInstance(), &iterator, &otMapping) == OT_ERROR_NONE)
     {
-        mapping.mId = otMapping.mId;
-        std::copy(std::begin(otMapping.mIp4.mFields.m8), std::end(otMapping.mIp4.mFields.m8), mapping.mIp4.data());
-        std::copy(std::begin(otMapping.mIp6.mFields.m8), std::end(otMapping.mIp6.mFields.m8), mapping.mIp6.data());
-        mapping.mRemainingTimeMs = otMapping.mRemainingTimeMs;
+        mappings.push_back(ConvertNat64AddressMapping(otMapping));
+    }
 
-        mapping.mCounters.mTotal.m4To6Packets = otMapping.mCounters.mTotal.m4To6Packets;
-        mapping.mCounters.mTotal.m4To6Bytes   = otMapping.mCounters.mTotal.m4To6Bytes;
-        mapping.mCounters.mTotal.m6To4Packets = otMapping.mCounters.mTotal.m6To4Packets;
-        mapping.mCounters.mTotal.m6To4Bytes   = otMapping.mCounters.mTotal.m6To4Bytes;
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mappings) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+void DBusThreadObjectRcp::GetNat64MappingsPageHandler(DBusRequest &aRequest)
+{
+    otError                          error      = OT_ERROR_NONE;
+    otInstance                      *instance   = mHost.GetThreadHelper()->GetInstance();
+    uint32_t                         cursor     = 0;
+    uint32_t                         maxCount   = 0;
+    uint32_t                         nextCursor = 0;
+    uint32_t                         index      = 0;
+    auto                             args       = std::tie(cursor, maxCount);
+    std::vector<Nat64AddressMapping> mappings;
+    otNat64AddressMappingIterator    iterator;
+    otNat64AddressMapping            otMapping;
 
-        mapping.mCounters.mIcmp.m4To6Packets = otMapping.mCounters.mIcmp.m4To6Packets;
-        mapping.mCounters.mIcmp.m4To6Bytes   = otMapping.mCounters.mIcmp.m4To6Bytes;
-        mapping.mCounters.mIcmp.m6To4Packets = otMapping.mCounters.mIcmp.m6To4Packets;
-        mapping.mCounters.mIcmp.m6To4Bytes   = otMapping.mCounters.mIcmp.m6To4Bytes;
+    SuccessOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(maxCount > 0, error = OT_ERROR_INVALID_ARGS);
 
-        mapping.mCounters.mUdp.m4To6Packets = otMapping.mCounters.mUdp.m4To6Packets;
-        mapping.mCounters.mUdp.m4To6Bytes   = otMapping.mCounters.mUdp.m4To6Bytes;
-        mapping.mCounters.mUdp.m6To4Packets = otMapping.mCounters.mUdp.m6To4Packets;
-        mapping.mCounters.mUdp.m6To4Bytes   = otMapping.mCounters.mUdp.m6To4Bytes;
+    // Only the mappings of the page are converted, the mappings before the cursor are skipped in place.
+    otNat64InitAddressMappingIterator(instance, &iterator);
+    while (otNat64GetNextAddressMapping(instance, &iterator, &otMapping) == OT_ERROR_NONE)
+    {
+        if (index++ < cursor)
+        {
+            continue;
+        }
 
-        mapping.mCounters.mTcp.m4To6Packets = otMapping.mCounters.mTcp.m4To6Packets;
-        mapping.mCounters.mTcp.m4To6Bytes   = otMapping.mCounters.mTcp.m4To6Bytes;
-        mapping.mCounters.mTcp.m6To4Packets = otMapping.mCounters.mTcp.m6To4Packets;
-        mapping.mCounters.mTcp.m6To4Bytes   = otMapping.mCounters.mTcp.m6To4Bytes;
+        if (mappings.size() == maxCount)
+        {
+            nextCursor = index - 1;
+            break;
+        }
 
-        mappings.push_back(mapping);
+        mappings.push_back(ConvertNat64AddressMapping(otMapping));
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mappings) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        aRequest.Reply(std::tie(mappings, nextCursor));
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObjectRcp::GetTopNat64MappingsHandler(DBusRequest &aRequest)
+{
+    using MappingEntry = std::pair<uint64_t, Nat64AddressMapping>;
+
+    otError                          error     = OT_ERROR_NONE;
+    otInstance                      *instance  = mHost.GetThreadHelper()->GetInstance();
+    uint32_t                         count     = 0;
+    auto                             args      = std::tie(count);
+    auto                             moreBytes = [](const MappingEntry &aLhs, const MappingEntry &aRhs) {
+        return aLhs.first > aRhs.first;
+    };
+    std::vector<MappingEntry>        heap;
+    std::vector<Nat64AddressMapping> mappings;
+    otNat64AddressMappingIterator    iterator;
+    otNat64AddressMapping            otMapping;
+
+    SuccessOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(count > 0, error = OT_ERROR_INVALID_ARGS);
+
+    // The heap keeps the `count` mappings with the most traffic seen so far, with the least of them at its front, so
+    // that only these mappings are converted.
+    otNat64InitAddressMappingIterator(instance, &iterator);
+    while (otNat64GetNextAddressMapping(instance, &iterator, &otMapping) == OT_ERROR_NONE)
+    {
+        uint64_t totalBytes = GetNat64MappingTotalBytes(otMapping);
+
+        if (heap.size() == count)
+        {
+            if (totalBytes <= heap.front().first)
+            {
+                continue;
+            }
+
+            std::pop_heap(heap.begin(), heap.end(), moreBytes);
+            heap.pop_back();
+        }
+
+        heap.emplace_back(totalBytes, ConvertNat64AddressMapping(otMapping));
+        std::push_heap(heap.begin(), heap.end(), moreBytes);
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), moreBytes);
+    for (MappingEntry &entry : heap)
+    {
+        mappings.push_back(std::move(entry.second));
+    }
 
 exit:
-    return error;
+    if (error == OT_ERROR_NONE)
+    {
+        aRequest.Reply(std::tie(mappings));
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
 }
 
 otError DBusThreadObjectRcp::GetNat64ProtocolCounters(DBusMessageIter &aIter)
@@ -1957,6 +2593,16 @@ otError DBusThreadObjectRcp::GetNat64Mappings(DBusMessageIter &aIter)
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+void DBusThreadObjectRcp::GetNat64MappingsPageHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+}
+
+void DBusThreadObjectRcp::GetTopNat64MappingsHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+}
+
 otError DBusThreadObjectRcp::GetNat64ProtocolCounters(DBusMessageIter &aIter)
 {
     OTBR_UNUSED_VARIABLE(aIter);
@@ -2041,6 +2687,88 @@ exit:
     }
 }
 
+void DBusThreadObjectRcp::GetTelemetryDataSectionsHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error    = OT_ERROR_NONE;
+    uint32_t sections = 0;
+    auto     args     = std::tie(sections);
+
+    SuccessOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args), error = OT_ERROR_INVALID_ARGS);
+
+    {
+        auto &telemetryData = *google::protobuf::Arena::CreateMessage<threadnetwork::TelemetryData>(&mProtoArena);
+
+        if (RetrieveTelemetryData(telemetryData, sections) != OT_ERROR_NONE)
+        {
+            otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+        }
+
+        SerializeProto(telemetryData);
+        ResetProtoArena("TelemetryData");
+    }
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        aRequest.Reply(std::tie(mProtoBuffer));
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+void DBusThreadObjectRcp::GetTelemetryDataFdHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error    = OT_ERROR_NONE;
+    uint32_t sections = 0;
+    auto     args     = std::tie(sections);
+    UnixFd   fd       = {-1};
+
+    SuccessOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dbus_connection_can_send_type(aRequest.GetConnection(), DBUS_TYPE_UNIX_FD),
+                 error = OT_ERROR_NOT_CAPABLE);
+
+    {
+        auto &telemetryData = *google::protobuf::Arena::CreateMessage<threadnetwork::TelemetryData>(&mProtoArena);
+
+        if (RetrieveTelemetryData(telemetryData, sections) != OT_ERROR_NONE)
+        {
+            otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+        }
+
+        SerializeProto(telemetryData);
+        ResetProtoArena("TelemetryData");
+    }
+
+    SuccessOrExit(error = CreateSealedMemfd("otbr-telemetry-data", mProtoBuffer, fd.mFd));
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        // The descriptor is duplicated into the reply.
+        aRequest.Reply(std::tie(fd));
+        close(fd.mFd);
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+void DBusThreadObjectRcp::TrimMemoryHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(OtbrErrorToOtError(MemoryStats::TrimHeap()));
+}
+
 otError DBusThreadObjectRcp::GetInfraLinkInfo(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_BORDER_ROUTING
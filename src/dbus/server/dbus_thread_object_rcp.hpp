@@ -37,10 +37,15 @@
 #include "openthread-br/config.h"
 
 #include <string>
+#include <vector>
 
+#include <google/protobuf/arena.h>
 #include <openthread/link.h>
 
 #include "border_agent/border_agent.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "dbus/server/dbus_network_properties.hpp"
 #include "dbus/server/dbus_object.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
@@ -92,6 +97,7 @@ private:
     void EnergyScanHandler(DBusRequest &aRequest);
     void AttachHandler(DBusRequest &aRequest);
     void AttachAllNodesToHandler(DBusRequest &aRequest);
+    void StartMigrationHandler(DBusRequest &aRequest);
     void DetachHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
     void FactoryResetHandler(DBusRequest &aRequest);
@@ -109,6 +115,12 @@ private:
     void SetNat64Enabled(DBusRequest &aRequest);
     void ActivateEphemeralKeyModeHandler(DBusRequest &aRequest);
     void DeactivateEphemeralKeyModeHandler(DBusRequest &aRequest);
+    void GetTelemetryDataSectionsHandler(DBusRequest &aRequest);
+    void GetTelemetryDataFdHandler(DBusRequest &aRequest);
+    void TrimMemoryHandler(DBusRequest &aRequest);
+    void GetNat64MappingsPageHandler(DBusRequest &aRequest);
+    void GetTopNat64MappingsHandler(DBusRequest &aRequest);
+    void GetSrpHostsPageHandler(DBusRequest &aRequest);
 
     void IntrospectHandler(DBusRequest &aRequest);
 
@@ -123,7 +135,6 @@ private:
     otError SetEphemeralKeyEnabled(DBusMessageIter &aIter);
 
     otError GetLinkModeHandler(DBusMessageIter &aIter);
-    otError GetDeviceRoleHandler(DBusMessageIter &aIter);
     otError GetNetworkNameHandler(DBusMessageIter &aIter);
     otError GetPanIdHandler(DBusMessageIter &aIter);
     otError GetExtPanIdHandler(DBusMessageIter &aIter);
@@ -144,6 +155,8 @@ private:
     otError GetLocalLeaderWeightHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorSampleCountHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter);
+    otError GetChannelMonitorAverageChannelQualitiesHandler(DBusMessageIter &aIter);
+    otError GetChannelMonitorRecommendedChannelHandler(DBusMessageIter &aIter);
     otError GetChildTableHandler(DBusMessageIter &aIter);
     otError GetNeighborTableHandler(DBusMessageIter &aIter);
     otError GetPartitionIDHandler(DBusMessageIter &aIter);
@@ -151,16 +164,14 @@ private:
     otError GetRadioTxPowerHandler(DBusMessageIter &aIter);
     otError GetExternalRoutesHandler(DBusMessageIter &aIter);
     otError GetOnMeshPrefixesHandler(DBusMessageIter &aIter);
-    otError GetActiveDatasetTlvsHandler(DBusMessageIter &aIter);
     otError GetPendingDatasetTlvsHandler(DBusMessageIter &aIter);
     otError GetFeatureFlagListDataHandler(DBusMessageIter &aIter);
+    otError GetFeatureFlagListVersionHandler(DBusMessageIter &aIter);
     otError GetRadioRegionHandler(DBusMessageIter &aIter);
     otError GetSrpServerInfoHandler(DBusMessageIter &aIter);
     otError GetMdnsTelemetryInfoHandler(DBusMessageIter &aIter);
     otError GetDnssdCountersHandler(DBusMessageIter &aIter);
-    otError GetOtbrVersionHandler(DBusMessageIter &aIter);
     otError GetOtHostVersionHandler(DBusMessageIter &aIter);
-    otError GetOtRcpVersionHandler(DBusMessageIter &aIter);
     otError GetThreadVersionHandler(DBusMessageIter &aIter);
     otError GetRadioSpinelMetricsHandler(DBusMessageIter &aIter);
     otError GetRcpInterfaceMetricsHandler(DBusMessageIter &aIter);
@@ -178,14 +189,63 @@ private:
     otError GetDnsUpstreamQueryState(DBusMessageIter &aIter);
     otError GetTelemetryDataHandler(DBusMessageIter &aIter);
     otError GetCapabilitiesHandler(DBusMessageIter &aIter);
+    otError SetTelemetryPushIntervalHandler(DBusMessageIter &aIter);
+    otError GetTelemetryPushIntervalHandler(DBusMessageIter &aIter);
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError RetrieveTelemetryData(threadnetwork::TelemetryData &aTelemetryData, uint32_t aSections);
+    void    SetTelemetryPushInterval(Milliseconds aInterval);
+    void    HandleTelemetryPushTimer(void);
+    void    PushTelemetryData(void);
+#endif
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
+    void SignalScanResult(const otActiveScanResult &aResult);
+    void HandleMigrationResult(uint64_t aMigrationId, otError aError, int64_t aDelayMs);
+    void FinishMigration(otError aError);
+    void SignalMigrationProgress(const char *aState, otError aError, int64_t aDelayMs);
+    void SignalNeighborTableChanged(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                    uint32_t                                                aGeneration);
     void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
 
+    static ActiveScanResult ConvertScanResult(const otActiveScanResult &aResult);
+
+    template <typename MessageType> void    SerializeProto(const MessageType &aMessage);
+    template <typename MessageType> otError EncodeProtoToVariant(DBusMessageIter &aIter, const MessageType &aMessage);
+    void                                    ResetProtoArena(const char *aMessageName);
+
+    // The protobuf messages built for the replies are allocated from the arena, which starts with a block large enough
+    // for the usual telemetry data.
+    static constexpr size_t kProtoArenaInitialBlockSize = 16384;
+
     otbr::Ncp::RcpHost                                  &mHost;
+    DBusNetworkProperties                                mNetworkProperties;
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
     otbr::BorderAgent                                   &mBorderAgent;
+    alignas(uint64_t) char                               mProtoArenaBlock[kProtoArenaInitialBlockSize];
+    google::protobuf::Arena                              mProtoArena;
+    std::vector<uint8_t>                                 mProtoBuffer;
+
+    // Only the first of the concurrent Scan requests streams the results, so that each one is signaled once.
+    uint16_t mPendingScans = 0;
+
+    // The migration started by StartMigration completes when the active dataset gets the active timestamp of the
+    // target dataset. The errors reported while starting it are replied to the method call instead of being signaled.
+    // The active timestamp is kept as the value of its TLV, compared without the U bit.
+    bool     mMigrationInProgress      = false;
+    bool     mMigrationStarting        = false;
+    otError  mMigrationStartError      = OT_ERROR_NONE;
+    uint64_t mMigrationId              = 0;
+    uint64_t mMigrationActiveTimestamp = 0;
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    // The encoding of each section in the last TelemetryDataChanged signal is kept to find the changed sections.
+    TaskRunner         mTelemetryTaskRunner;
+    TaskRunner::TaskId mTelemetryPushTaskId = 0;
+    Milliseconds       mTelemetryPushInterval;
+    std::string        mPushedTelemetrySections[agent::ThreadHelper::kTelemetrySectionCount];
+#endif
 };
 
 /**
@@ -0,0 +1,305 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the border routing firewall.
+ */
+
+#define OTBR_LOG_TAG "FW"
+
+#include "firewall/firewall_manager.hpp"
+
+#if OTBR_ENABLE_FIREWALL
+
+#include <algorithm>
+
+#include <string.h>
+
+#include <linux/if_packet.h>
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter_ipv6.h>
+
+#include <openthread/netdata.h>
+#include <openthread/thread.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace {
+
+constexpr char kTable[]       = "otbr_firewall";
+constexpr char kChain[]       = "forward";
+constexpr char kDenySrcSet[]  = "ingress_deny_src";
+constexpr char kAllowDstSet[] = "ingress_allow_dst";
+
+} // namespace
+
+FirewallManager::FirewallManager(Ncp::RcpHost &aHost, std::string aInterfaceName)
+    : mHost(aHost)
+    , mInterfaceName(std::move(aInterfaceName))
+    , mInstalled(false)
+    , mCallbackAdded(false)
+{
+}
+
+void FirewallManager::Init(void)
+{
+    otbrError       error      = OTBR_ERROR_NONE;
+    uint8_t         packetType = PACKET_HOST;
+    Nftables::Batch batch;
+
+    VerifyOrExit(!mInstalled);
+
+    // The table is added before being deleted, so that the deletion succeeds and drops anything left behind by an
+    // earlier run, the table is then rebuilt in the same transaction.
+    batch.AddTable(NFPROTO_IPV6, kTable);
+    batch.DeleteTable(NFPROTO_IPV6, kTable);
+    batch.AddTable(NFPROTO_IPV6, kTable);
+    batch.AddSet(NFPROTO_IPV6, kTable, kDenySrcSet, Nftables::Batch::kKeyTypeIp6Address, sizeof(Ip6Address),
+                 NFT_SET_INTERVAL);
+    batch.AddSet(NFPROTO_IPV6, kTable, kAllowDstSet, Nftables::Batch::kKeyTypeIp6Address, sizeof(Ip6Address),
+                 NFT_SET_INTERVAL);
+    batch.AddBaseChain(NFPROTO_IPV6, kTable, kChain, NF_INET_FORWARD, NF_IP6_PRI_FILTER);
+
+    BeginForwardRule(batch);
+    batch.AddInterfaceNameMatch(NFT_META_IIFNAME, mInterfaceName.c_str());
+    batch.AddMetaLoad(NFT_META_PKTTYPE);
+    batch.AddCompare(&packetType, sizeof(packetType));
+    batch.AddVerdict(NF_DROP);
+    batch.EndRule();
+
+    BeginForwardRule(batch);
+    batch.AddIp6AddressLoad(/* aIsDestination */ false);
+    batch.AddLookup(kDenySrcSet);
+    batch.AddVerdict(NF_DROP);
+    batch.EndRule();
+
+    BeginForwardRule(batch);
+    batch.AddIp6AddressLoad(/* aIsDestination */ true);
+    batch.AddLookup(kAllowDstSet);
+    batch.AddVerdict(NF_ACCEPT);
+    batch.EndRule();
+
+    BeginForwardRule(batch);
+    batch.AddMetaLoad(NFT_META_PKTTYPE);
+    batch.AddCompare(&packetType, sizeof(packetType));
+    batch.AddVerdict(NF_DROP);
+    batch.EndRule();
+
+    SuccessOrExit(error = mSocket.Commit(batch));
+    mInstalled = true;
+    mDenySrc.clear();
+    mAllowDst.clear();
+
+    // The callbacks of the Thread controller can't be removed, so it's only added once.
+    if (!mCallbackAdded)
+    {
+        mHost.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+        mCallbackAdded = true;
+    }
+
+    UpdateSets();
+
+exit:
+    otbrLogResult(error, "Install firewall on %s", mInterfaceName.c_str());
+}
+
+void FirewallManager::Deinit(void)
+{
+    Nftables::Batch batch;
+
+    VerifyOrExit(mInstalled);
+    mInstalled = false;
+    mDenySrc.clear();
+    mAllowDst.clear();
+
+    batch.AddTable(NFPROTO_IPV6, kTable);
+    batch.DeleteTable(NFPROTO_IPV6, kTable);
+    otbrLogResult(mSocket.Commit(batch), "Remove firewall on %s", mInterfaceName.c_str());
+
+exit:
+    return;
+}
+
+void FirewallManager::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    if (aFlags & (OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ML_ADDR))
+    {
+        UpdateSets();
+    }
+}
+
+void FirewallManager::BeginForwardRule(Nftables::Batch &aBatch) const
+{
+    // Only the packets forwarded to the Thread interface are filtered.
+    aBatch.BeginRule(NFPROTO_IPV6, kTable, kChain);
+    aBatch.AddInterfaceNameMatch(NFT_META_OIFNAME, mInterfaceName.c_str());
+}
+
+void FirewallManager::UpdateSets(void)
+{
+    otbrError       error;
+    Nftables::Batch batch;
+    PrefixList      denySrc;
+    PrefixList      allowDst;
+
+    VerifyOrExit(mInstalled);
+
+    GetPrefixes(denySrc, allowDst);
+    AddSetChanges(batch, kDenySrcSet, mDenySrc, denySrc);
+    AddSetChanges(batch, kAllowDstSet, mAllowDst, allowDst);
+    VerifyOrExit(batch.GetRequestCount() > 0);
+
+    error = mSocket.Commit(batch);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        // The sets are rebuilt if they went out of sync, e.g. because another program modified them.
+        otbrLogWarning("Failed to update the prefixes incrementally, rebuilding the sets");
+        batch.Clear();
+        AddSetContent(batch, kDenySrcSet, denySrc);
+        AddSetContent(batch, kAllowDstSet, allowDst);
+        error = mSocket.Commit(batch);
+    }
+
+    VerifyOrExit(error == OTBR_ERROR_NONE, otbrLogWarning("Failed to update the prefixes: %s", otbrErrorString(error)));
+
+    mDenySrc  = std::move(denySrc);
+    mAllowDst = std::move(allowDst);
+    otbrLogInfo("Updated prefixes, %zu denied sources, %zu allowed destinations", mDenySrc.size(), mAllowDst.size());
+
+exit:
+    return;
+}
+
+void FirewallManager::GetPrefixes(PrefixList &aDenySrc, PrefixList &aAllowDst)
+{
+    const otMeshLocalPrefix *meshLocalPrefix = otThreadGetMeshLocalPrefix(mHost.GetInstance());
+    Ip6Prefix                prefix;
+
+    // The mesh-local prefix is never reachable from the infrastructure network.
+    memcpy(prefix.mPrefix.m8, meshLocalPrefix->m8, sizeof(meshLocalPrefix->m8));
+    prefix.mLength = sizeof(meshLocalPrefix->m8) * 8;
+    AddPrefix(aDenySrc, prefix);
+
+    for (const otBorderRouterConfig &config : mHost.GetThreadHelper()->GetNetworkData().mOnMeshPrefixes)
+    {
+        // The Domain Prefix is handled by the Backbone Router.
+        if (config.mDp)
+        {
+            continue;
+        }
+
+        prefix.Set(config.mPrefix);
+        AddPrefix(aDenySrc, prefix);
+
+        if (config.mOnMesh)
+        {
+            AddPrefix(aAllowDst, prefix);
+        }
+    }
+}
+
+void FirewallManager::AddSetChanges(Nftables::Batch  &aBatch,
+                                    const char       *aSet,
+                                    const PrefixList &aOld,
+                                    const PrefixList &aNew)
+{
+    // The removed prefixes are deleted first, so that they don't overlap with the added ones.
+    AddSetElements(aBatch, aSet, aOld, aNew, /* aIsAdded */ false);
+    AddSetElements(aBatch, aSet, aNew, aOld, /* aIsAdded */ true);
+}
+
+void FirewallManager::AddSetContent(Nftables::Batch &aBatch, const char *aSet, const PrefixList &aPrefixes)
+{
+    aBatch.FlushSet(NFPROTO_IPV6, kTable, aSet);
+    AddSetElements(aBatch, aSet, aPrefixes, PrefixList(), /* aIsAdded */ true);
+}
+
+void FirewallManager::AddSetElements(Nftables::Batch  &aBatch,
+                                     const char       *aSet,
+                                     const PrefixList &aPrefixes,
+                                     const PrefixList &aExcluded,
+                                     bool              aIsAdded)
+{
+    bool hasElements = false;
+
+    for (const Ip6Prefix &prefix : aPrefixes)
+    {
+        if (std::find(aExcluded.begin(), aExcluded.end(), prefix) != aExcluded.end())
+        {
+            continue;
+        }
+
+        if (!hasElements)
+        {
+            aBatch.BeginSetElements(NFPROTO_IPV6, kTable, aSet, aIsAdded);
+            hasElements = true;
+        }
+
+        aBatch.AddIp6PrefixInterval(prefix);
+    }
+
+    if (hasElements)
+    {
+        aBatch.EndSetElements();
+    }
+}
+
+void FirewallManager::AddPrefix(PrefixList &aPrefixes, const Ip6Prefix &aPrefix)
+{
+    // The intervals of a set must not overlap, so only the shortest of nested prefixes is kept.
+    for (const Ip6Prefix &prefix : aPrefixes)
+    {
+        VerifyOrExit(!IsCovered(aPrefix, prefix));
+    }
+
+    aPrefixes.erase(std::remove_if(aPrefixes.begin(), aPrefixes.end(),
+                                   [&aPrefix](const Ip6Prefix &aOther) { return IsCovered(aOther, aPrefix); }),
+                    aPrefixes.end());
+    aPrefixes.push_back(aPrefix);
+
+exit:
+    return;
+}
+
+bool FirewallManager::IsCovered(const Ip6Prefix &aPrefix, const Ip6Prefix &aOther)
+{
+    Ip6Prefix truncated = aPrefix;
+
+    truncated.mLength = aOther.mLength;
+
+    return aOther.mLength <= aPrefix.mLength && truncated == aOther;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_FIREWALL
@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the border routing firewall.
+ */
+
+#ifndef OTBR_FIREWALL_FIREWALL_MANAGER_HPP_
+#define OTBR_FIREWALL_FIREWALL_MANAGER_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_FIREWALL
+
+#include <string>
+#include <vector>
+
+#include <openthread/instance.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+#include "ncp/rcp_host.hpp"
+#include "utils/nftables.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the border routing firewall with nftables.
+ *
+ * It filters the packets forwarded to the Thread interface the same way as the `otbr-firewall` service:
+ *  - Unicast packets from the Thread interface itself are dropped.
+ *  - Packets whose source is in a Thread prefix are dropped, since they are spoofed.
+ *  - Packets to an on-mesh prefix are accepted.
+ *  - Other unicast packets are dropped.
+ *
+ * The Thread prefixes are kept in nftables interval sets, which are updated incrementally from the Network Data, so
+ * that each change is applied in a single transaction without rebuilding the ruleset.
+ *
+ */
+class FirewallManager : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in] aHost           A reference to the Thread controller.
+     * @param[in] aInterfaceName  The name of the Thread interface.
+     *
+     */
+    FirewallManager(Ncp::RcpHost &aHost, std::string aInterfaceName);
+
+    /**
+     * This destructor removes the firewall.
+     *
+     */
+    ~FirewallManager(void) { Deinit(); }
+
+    /**
+     * This method installs the firewall and starts following the Network Data.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method removes the firewall.
+     *
+     */
+    void Deinit(void);
+
+private:
+    typedef std::vector<Ip6Prefix> PrefixList;
+
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+    void BeginForwardRule(Nftables::Batch &aBatch) const;
+    void UpdateSets(void);
+    void GetPrefixes(PrefixList &aDenySrc, PrefixList &aAllowDst);
+
+    static void AddSetChanges(Nftables::Batch  &aBatch,
+                              const char       *aSet,
+                              const PrefixList &aOld,
+                              const PrefixList &aNew);
+    static void AddSetContent(Nftables::Batch &aBatch, const char *aSet, const PrefixList &aPrefixes);
+    static void AddSetElements(Nftables::Batch  &aBatch,
+                               const char       *aSet,
+                               const PrefixList &aPrefixes,
+                               const PrefixList &aExcluded,
+                               bool              aIsAdded);
+    static void AddPrefix(PrefixList &aPrefixes, const Ip6Prefix &aPrefix);
+    static bool IsCovered(const Ip6Prefix &aPrefix, const Ip6Prefix &aOther);
+
+    Ncp::RcpHost    &mHost;
+    std::string      mInterfaceName;
+    Nftables::Socket mSocket;
+    bool             mInstalled;
+    bool             mCallbackAdded;
+    PrefixList       mDenySrc;
+    PrefixList       mAllowDst;
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_FIREWALL
+
+#endif // OTBR_FIREWALL_FIREWALL_MANAGER_HPP_
@@ -38,73 +38,536 @@
 #if OTBR_ENABLE_MDNS
 
 #include <assert.h>
+#include <string.h>
+#include <strings.h>
 
 #include <algorithm>
 #include <functional>
 
 #include "common/code_utils.hpp"
+#include "common/event_bus.hpp"
+#include "common/memory_stats.hpp"
+#include "common/probes.hpp"
 #include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
 
 namespace otbr {
 
 namespace Mdns {
 
+constexpr uint32_t Publisher::kConflictTimeout;
+
+Publisher::Publisher(void)
+{
+    MemoryStats &memoryStats = MemoryStats::GetInstance();
+
+    memoryStats.AddCounter(this, "mdns.registrations", [this]() {
+        return mServiceRegistrations.size() + mHostRegistrations.size() + mKeyRegistrations.size();
+    });
+    memoryStats.AddCounter(this, "mdns.cache", [this]() { return mServiceInstanceCache.size() + mHostCache.size(); });
+    memoryStats.AddCounter(this, "mdns.pending_publications", [this]() { return GetPendingPublicationCount(); });
+}
+
+Publisher::~Publisher(void)
+{
+    MemoryStats::GetInstance().RemoveCounters(this);
+}
+
 void Publisher::PublishService(const std::string &aHostName,
                                const std::string &aName,
                                const std::string &aType,
                                const SubTypeList &aSubTypeList,
                                uint16_t           aPort,
                                const TxtData     &aTxtData,
-                               ResultCallback   &&aCallback)
+                               ResultCallback   &&aCallback,
+                               Priority           aPriority)
 {
-    otbrError error;
+    auto        callback = std::make_shared<ResultCallback>(std::move(aCallback));
+    std::string fullName = aName + "." + aType;
+
+    OTBR_PROBE(mdns__publish__service, aName.c_str(), aType.c_str(), static_cast<int>(aPriority));
+
+    SchedulePublication(aPriority, PublicationType::kService, fullName,
+                        [this, aHostName, aName, aType, aSubTypeList, aPort, aTxtData, fullName,
+                         callback](otbrError aError) {
+                            if (aError == OTBR_ERROR_NONE && IsInConflict(PublicationType::kService, fullName))
+                            {
+                                aError = OTBR_ERROR_DUPLICATED;
+                            }
+
+                            if (aError == OTBR_ERROR_NONE)
+                            {
+                                aError = PublishServiceImpl(
+                                    aHostName, aName, aType, aSubTypeList, aPort, aTxtData,
+                                    RecordConflict(PublicationType::kService, fullName, std::move(*callback)));
+                            }
+                            else
+                            {
+                                std::move (*callback)(aError);
+                            }
+
+                            if (aError != OTBR_ERROR_NONE)
+                            {
+                                UpdateMdnsResponseCounters(mTelemetryInfo.mServiceRegistrations, aError);
+                            }
+                        });
+}
 
-    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = Clock::now();
+void Publisher::PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
+{
+    auto callback = std::make_shared<ResultCallback>(std::move(aCallback));
+
+    OTBR_PROBE(mdns__publish__host, aName.c_str(), aAddresses.size());
+
+    SchedulePublication(Priority::kNormal, PublicationType::kHost, aName,
+                        [this, aName, aAddresses, callback](otbrError aError) {
+                            if (aError == OTBR_ERROR_NONE && IsInConflict(PublicationType::kHost, aName))
+                            {
+                                aError = OTBR_ERROR_DUPLICATED;
+                            }
+
+                            if (aError == OTBR_ERROR_NONE)
+                            {
+                                aError = PublishHostImpl(
+                                    aName, aAddresses,
+                                    RecordConflict(PublicationType::kHost, aName, std::move(*callback)));
+                            }
+                            else
+                            {
+                                std::move (*callback)(aError);
+                            }
+
+                            if (aError != OTBR_ERROR_NONE)
+                            {
+                                UpdateMdnsResponseCounters(mTelemetryInfo.mHostRegistrations, aError);
+                            }
+                        });
+}
 
-    error = PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aCallback));
-    if (error != OTBR_ERROR_NONE)
+void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
+{
+    auto callback = std::make_shared<ResultCallback>(std::move(aCallback));
+
+    OTBR_PROBE(mdns__publish__key, aName.c_str());
+
+    SchedulePublication(Priority::kNormal, PublicationType::kKey, aName,
+                        [this, aName, aKeyData, callback](otbrError aError) {
+                            if (aError == OTBR_ERROR_NONE)
+                            {
+                                aError = PublishKeyImpl(aName, aKeyData, std::move(*callback));
+                            }
+                            else
+                            {
+                                std::move (*callback)(aError);
+                            }
+
+                            if (aError != OTBR_ERROR_NONE)
+                            {
+                                UpdateMdnsResponseCounters(mTelemetryInfo.mKeyRegistrations, aError);
+                            }
+                        });
+}
+
+void Publisher::PublishServiceWithAlternatives(const std::string              &aHostName,
+                                               const std::vector<std::string> &aNames,
+                                               const std::string              &aType,
+                                               const SubTypeList              &aSubTypeList,
+                                               uint16_t                        aPort,
+                                               const TxtData                  &aTxtData,
+                                               NameResultCallback            &&aCallback,
+                                               Priority                        aPriority)
+{
+    struct Candidates
+    {
+        explicit Candidates(NameResultCallback &&aCallback)
+            : mCallback(std::move(aCallback))
+        {
+        }
+
+        NameResultCallback       mCallback;
+        std::vector<std::string> mNames;
+        std::string              mPublishedName;
+        size_t                   mPending = 0;
+        otbrError                mError   = OTBR_ERROR_DUPLICATED;
+    };
+
+    auto candidates = std::make_shared<Candidates>(std::move(aCallback));
+
+    for (const std::string &name : aNames)
     {
-        UpdateMdnsResponseCounters(mTelemetryInfo.mServiceRegistrations, error);
+        if (!IsInConflict(PublicationType::kService, name + "." + aType))
+        {
+            candidates->mNames.push_back(name);
+        }
     }
+
+    otbrLogInfo("Publish service %s with %zu of %zu candidate names", aType.c_str(), candidates->mNames.size(),
+                aNames.size());
+    VerifyOrExit(!candidates->mNames.empty(), std::move(candidates->mCallback)(OTBR_ERROR_DUPLICATED, ""));
+
+    candidates->mPending = candidates->mNames.size();
+
+    for (const std::string &name : candidates->mNames)
+    {
+        PublishService(
+            aHostName, name, aType, aSubTypeList, aPort, aTxtData,
+            [this, candidates, name, aType](otbrError aError) {
+                candidates->mPending--;
+
+                if (aError == OTBR_ERROR_NONE && candidates->mPublishedName.empty())
+                {
+                    // The other candidates are aborted, their results are ignored as the published name is set.
+                    candidates->mPublishedName = name;
+
+                    for (const std::string &other : candidates->mNames)
+                    {
+                        if (other != name)
+                        {
+                            UnpublishService(other, aType, [](otbrError) {});
+                        }
+                    }
+
+                    std::move(candidates->mCallback)(OTBR_ERROR_NONE, name);
+                }
+                else if (aError == OTBR_ERROR_NONE)
+                {
+                    UnpublishService(name, aType, [](otbrError) {});
+                }
+                else if (aError != OTBR_ERROR_DUPLICATED && candidates->mError == OTBR_ERROR_DUPLICATED)
+                {
+                    candidates->mError = aError;
+                }
+
+                if (candidates->mPending == 0 && candidates->mPublishedName.empty())
+                {
+                    std::move(candidates->mCallback)(candidates->mError, "");
+                }
+            },
+            aPriority);
+    }
+
+exit:
+    return;
 }
 
-void Publisher::PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
+bool Publisher::IsInConflict(PublicationType aType, const std::string &aName)
 {
-    otbrError error;
+    auto it         = mConflictingNames.find({aType, aName});
+    bool inConflict = false;
 
-    mHostRegistrationBeginTime[aName] = Clock::now();
+    VerifyOrExit(it != mConflictingNames.end());
 
-    error = PublishHostImpl(aName, aAddresses, std::move(aCallback));
-    if (error != OTBR_ERROR_NONE)
+    if (Clock::now() < it->second)
+    {
+        inConflict = true;
+    }
+    else
     {
-        UpdateMdnsResponseCounters(mTelemetryInfo.mHostRegistrations, error);
+        mConflictingNames.erase(it);
     }
+
+exit:
+    return inConflict;
 }
 
-void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
+Publisher::ResultCallback Publisher::RecordConflict(PublicationType   aType,
+                                                    const std::string &aName,
+                                                    ResultCallback   &&aCallback)
+{
+    auto callback = std::make_shared<ResultCallback>(std::move(aCallback));
+
+    return [this, aType, aName, callback](otbrError aError) {
+        if (aError == OTBR_ERROR_DUPLICATED)
+        {
+            Timepoint now = Clock::now();
+
+            // The expired conflicts are only pruned here, so that the names in conflict once do not pile up.
+            for (auto it = mConflictingNames.begin(); it != mConflictingNames.end();)
+            {
+                it = (now < it->second) ? std::next(it) : mConflictingNames.erase(it);
+            }
+
+            otbrLogInfo("Name %s is in conflict, not probing it again for %u seconds", aName.c_str(),
+                        kConflictTimeout);
+            mConflictingNames[{aType, aName}] = now + std::chrono::seconds(kConflictTimeout);
+        }
+
+        std::move (*callback)(aError);
+    };
+}
+
+void Publisher::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    AbortPendingPublications(PublicationType::kService, aName + "." + aType);
+    UnpublishServiceImpl(aName, aType, std::move(aCallback));
+}
+
+void Publisher::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    AbortPendingPublications(PublicationType::kHost, aName);
+    UnpublishHostImpl(aName, std::move(aCallback));
+}
+
+void Publisher::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+{
+    AbortPendingPublications(PublicationType::kKey, aName);
+    UnpublishKeyImpl(aName, std::move(aCallback));
+}
+
+void Publisher::PublishHostBatch(HostBatch &&aBatch)
+{
+    if (IsHostBatchPublished(aBatch))
+    {
+        otbrLogDebug("Host %s and its services are already published", aBatch.mHostName.c_str());
+
+        std::move(aBatch.mHostCallback)(OTBR_ERROR_NONE);
+        for (BatchService &service : aBatch.mServices)
+        {
+            std::move(service.mCallback)(OTBR_ERROR_NONE);
+        }
+        for (BatchKey &key : aBatch.mKeys)
+        {
+            std::move(key.mCallback)(OTBR_ERROR_NONE);
+        }
+        ExitNow();
+    }
+
+    otbrLogInfo("Publish host %s with %zu services and %zu keys", aBatch.mHostName.c_str(), aBatch.mServices.size(),
+                aBatch.mKeys.size());
+
+    PublishHostBatchImpl(std::move(aBatch));
+
+exit:
+    return;
+}
+
+bool Publisher::IsHostBatchPublished(const HostBatch &aBatch)
+{
+    bool              isPublished = false;
+    HostRegistration *hostReg     = FindHostRegistration(aBatch.mHostName);
+
+    VerifyOrExit(hostReg != nullptr && hostReg->IsCompleted());
+    VerifyOrExit(!hostReg->IsOutdated(aBatch.mHostName, aBatch.mAddresses));
+
+    for (const BatchService &service : aBatch.mServices)
+    {
+        ServiceRegistration *serviceReg = FindServiceRegistration(service.mName, service.mType);
+
+        VerifyOrExit(serviceReg != nullptr && serviceReg->IsCompleted());
+        VerifyOrExit(!serviceReg->IsOutdated(aBatch.mHostName, service.mName, service.mType,
+                                             SortSubTypeList(service.mSubTypeList), service.mPort, service.mTxtData));
+    }
+
+    for (const BatchKey &key : aBatch.mKeys)
+    {
+        KeyRegistration *keyReg = FindKeyRegistration(key.mName);
+
+        VerifyOrExit(keyReg != nullptr && keyReg->IsCompleted());
+        VerifyOrExit(!keyReg->IsOutdated(key.mName, key.mKeyData));
+    }
+
+    isPublished = true;
+
+exit:
+    return isPublished;
+}
+
+bool Publisher::IsServiceRegistered(const std::string &aName, const std::string &aType)
+{
+    return FindServiceRegistration(aName, aType) != nullptr;
+}
+
+void Publisher::SchedulePublication(Priority aPriority, PublicationType aType, std::string aName, PublicationTask aTask)
+{
+    std::list<PendingPublication> &queue = mPendingPublications[static_cast<uint8_t>(aPriority)];
+
+    RecordHistogram(mTelemetryInfo.mPublicationQueueDepths, GetPendingPublicationCount());
+
+    queue.push_back({aType, std::move(aName), Clock::now(), std::move(aTask)});
+
+    DispatchPublications();
+}
+
+void Publisher::DispatchPublications(void)
+{
+    RefillPublicationTokens();
+
+    for (uint8_t priority = 0; priority < MdnsTelemetryInfo::kNumPublicationPriorities; priority++)
+    {
+        std::list<PendingPublication> &queue = mPendingPublications[priority];
+
+        while (!queue.empty() && (mPublicationsPerSecond == 0 || mPublicationTokens > 0))
+        {
+            PendingPublication publication = std::move(queue.front());
+            uint64_t           waitTime;
+
+            queue.pop_front();
+            if (mPublicationsPerSecond != 0)
+            {
+                mPublicationTokens--;
+            }
+
+            waitTime = std::chrono::duration_cast<Milliseconds>(Clock::now() - publication.mEnqueueTime).count();
+            RecordHistogram(mTelemetryInfo.mPublicationWaitTimes[priority], waitTime);
+
+            publication.mTask(OTBR_ERROR_NONE);
+        }
+    }
+
+    if (GetPendingPublicationCount() > 0 && !mIsPublicationDispatchPosted)
+    {
+        otbrLogInfo("Pace %zu pending publications", GetPendingPublicationCount());
+
+        mIsPublicationDispatchPosted = true;
+        mTaskRunner.Post(Milliseconds(1000 / mPublicationsPerSecond), [this]() {
+            mIsPublicationDispatchPosted = false;
+            DispatchPublications();
+        });
+    }
+}
+
+void Publisher::SetPublicationPace(uint32_t aPublicationsPerSecond, uint32_t aBurst)
 {
-    otbrError error;
+    mPublicationsPerSecond = aPublicationsPerSecond;
+    mPublicationBurst      = aBurst;
+    mPublicationTokens     = std::min(mPublicationTokens, aBurst);
+
+    DispatchPublications();
+}
 
-    mKeyRegistrationBeginTime[aName] = Clock::now();
+void Publisher::SetInterfaces(const std::vector<uint32_t> &aInterfaces)
+{
+    std::string interfaces;
 
-    error = PublishKeyImpl(aName, aKeyData, std::move(aCallback));
-    if (error != OTBR_ERROR_NONE)
+    mInterfaces = aInterfaces;
+    std::sort(mInterfaces.begin(), mInterfaces.end());
+    mInterfaces.erase(std::unique(mInterfaces.begin(), mInterfaces.end()), mInterfaces.end());
+
+    for (uint32_t index : mInterfaces)
     {
-        UpdateMdnsResponseCounters(mTelemetryInfo.mKeyRegistrations, error);
+        interfaces += (interfaces.empty() ? "" : ",") + std::to_string(index);
     }
+    otbrLogInfo("Publish and subscribe on interfaces %s", interfaces.empty() ? "all" : interfaces.c_str());
+}
+
+bool Publisher::IsInterfaceInScope(uint32_t aInterfaceIndex) const
+{
+    return mInterfaces.empty() || std::binary_search(mInterfaces.begin(), mInterfaces.end(), aInterfaceIndex);
+}
+
+void Publisher::RefillPublicationTokens(void)
+{
+    Timepoint now     = Clock::now();
+    uint64_t  elapsed = std::chrono::duration_cast<Milliseconds>(now - mPublicationTokenTime).count();
+    uint64_t  tokens  = elapsed * mPublicationsPerSecond / 1000;
+
+    VerifyOrExit(tokens > 0);
+
+    if (mPublicationTokens + tokens >= mPublicationBurst)
+    {
+        mPublicationTokens    = mPublicationBurst;
+        mPublicationTokenTime = now;
+    }
+    else
+    {
+        // Only the time accounted for by the new tokens is consumed, so that partial tokens are not lost.
+        mPublicationTokens += static_cast<uint32_t>(tokens);
+        mPublicationTokenTime += Milliseconds(tokens * 1000 / mPublicationsPerSecond);
+    }
+
+exit:
+    return;
+}
+
+void Publisher::AbortPendingPublications(PublicationType aType, const std::string &aName)
+{
+    for (std::list<PendingPublication> &queue : mPendingPublications)
+    {
+        for (auto it = queue.begin(); it != queue.end();)
+        {
+            if (it->mType == aType && it->mName == aName)
+            {
+                PublicationTask task = std::move(it->mTask);
+
+                it = queue.erase(it);
+                task(OTBR_ERROR_ABORTED);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+size_t Publisher::GetPendingPublicationCount(void) const
+{
+    size_t count = 0;
+
+    for (const std::list<PendingPublication> &queue : mPendingPublications)
+    {
+        count += queue.size();
+    }
+
+    return count;
+}
+
+void Publisher::RecordHistogram(uint32_t (&aBuckets)[MdnsTelemetryInfo::kNumHistogramBuckets], uint64_t aValue)
+{
+    uint8_t bucket = 0;
+
+    while (aValue > 0 && bucket < MdnsTelemetryInfo::kNumHistogramBuckets - 1)
+    {
+        aValue >>= 1;
+        bucket++;
+    }
+
+    aBuckets[bucket]++;
+}
+
+void Publisher::PublishHostBatchImpl(HostBatch &&aBatch)
+{
+    PublishHost(aBatch.mHostName, aBatch.mAddresses, std::move(aBatch.mHostCallback));
+
+    for (BatchService &service : aBatch.mServices)
+    {
+        PublishService(aBatch.mHostName, service.mName, service.mType, service.mSubTypeList, service.mPort,
+                       service.mTxtData, std::move(service.mCallback));
+    }
+
+    for (BatchKey &key : aBatch.mKeys)
+    {
+        PublishKey(key.mName, key.mKeyData, std::move(key.mCallback));
+    }
+}
+
+otbrError Publisher::UpdateServiceTxtDataImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    OTBR_UNUSED_VARIABLE(aServiceReg);
+    OTBR_UNUSED_VARIABLE(aTxtData);
+
+    return OTBR_ERROR_NOT_IMPLEMENTED;
+}
+
+otbrError Publisher::UpdateHostAddressesImpl(HostRegistration &aHostReg, const AddressList &aAddresses)
+{
+    OTBR_UNUSED_VARIABLE(aHostReg);
+    OTBR_UNUSED_VARIABLE(aAddresses);
+
+    return OTBR_ERROR_NOT_IMPLEMENTED;
 }
 
 void Publisher::OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
+    UpdateServiceInstanceResolutionLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
     OnServiceResolveFailedImpl(aType, aInstanceName, aErrorCode);
 }
 
 void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateHostResolutionEmaLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
+    UpdateHostResolutionLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
     OnHostResolveFailedImpl(aHostName, aErrorCode);
 }
 
@@ -146,41 +609,77 @@ exit:
 
 otbrError Publisher::DecodeTxtData(Publisher::TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError        error;
+    TxtEntryIterator iterator(aTxtData, aTxtLength);
+    TxtEntryView     entry;
 
     aTxtList.clear();
 
-    for (uint16_t r = 0; r < aTxtLength;)
+    while ((error = iterator.GetNextEntry(entry)) == OTBR_ERROR_NONE)
+    {
+        if (entry.mIsBooleanAttribute)
+        {
+            aTxtList.emplace_back(entry.mKey, entry.mKeyLength);
+        }
+        else
+        {
+            aTxtList.emplace_back(entry.mKey, entry.mKeyLength, entry.mValue, entry.mValueLength);
+        }
+    }
+
+    if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        error = OTBR_ERROR_NONE;
+    }
+
+    return error;
+}
+
+bool Publisher::TxtEntryView::KeyMatches(const char *aKey) const
+{
+    return strlen(aKey) == mKeyLength && strncasecmp(mKey, aKey, mKeyLength) == 0;
+}
+
+otbrError Publisher::TxtEntryIterator::GetNextEntry(TxtEntryView &aEntry)
+{
+    otbrError error = OTBR_ERROR_NOT_FOUND;
+
+    while (mOffset < mTxtLength)
     {
-        uint16_t entrySize = aTxtData[r];
-        uint16_t keyStart  = r + 1;
+        uint8_t  entrySize = mTxtData[mOffset];
+        uint16_t keyStart  = mOffset + 1;
         uint16_t entryEnd  = keyStart + entrySize;
         uint16_t keyEnd    = keyStart;
 
-        VerifyOrExit(entryEnd <= aTxtLength, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(entryEnd <= mTxtLength, error = OTBR_ERROR_PARSE);
+        mOffset = entryEnd;
 
-        while (keyEnd < entryEnd && aTxtData[keyEnd] != '=')
+        while (keyEnd < entryEnd && mTxtData[keyEnd] != '=')
         {
             keyEnd++;
         }
 
+        aEntry.mKey       = reinterpret_cast<const char *>(&mTxtData[keyStart]);
+        aEntry.mKeyLength = static_cast<uint8_t>(keyEnd - keyStart);
+
         if (keyEnd == entryEnd)
         {
+            // No `=`, treat as a boolean attribute, an empty entry is skipped.
             if (keyEnd > keyStart)
             {
-                // No `=`, treat as a boolean attribute.
-                aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart);
+                aEntry.mValue              = nullptr;
+                aEntry.mValueLength        = 0;
+                aEntry.mIsBooleanAttribute = true;
+                ExitNow(error = OTBR_ERROR_NONE);
             }
         }
         else
         {
-            uint16_t valStart = keyEnd + 1; // To skip over `=`
-
-            aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart,
-                                  &aTxtData[valStart], entryEnd - valStart);
+            aEntry.mValue              = &mTxtData[keyEnd + 1]; // To skip over `=`
+            aEntry.mValueLength        = static_cast<uint8_t>(entryEnd - keyEnd - 1);
+            aEntry.mIsBooleanAttribute = false;
+            ExitNow(error = OTBR_ERROR_NONE);
         }
-
-        r += entrySize + 1;
     }
 
 exit:
@@ -189,42 +688,239 @@ exit:
 
 void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
 {
-    mDiscoverCallbacks.remove_if(
-        [aSubscriberId](const DiscoverCallback &aCallback) { return (aCallback.mId == aSubscriberId); });
+    for (DiscoverCallback &callback : mDiscoverCallbacks)
+    {
+        if (callback.mId == aSubscriberId)
+        {
+            callback.mRemoved = true;
+        }
+    }
+
+    EraseRemovedDiscoverCallbacks();
 }
 
 uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
-                                             Publisher::DiscoveredHostCallback            aHostCallback)
+                                             Publisher::DiscoveredHostCallback            aHostCallback,
+                                             const std::string                           &aServiceType)
 {
     uint64_t id = mNextSubscriberId++;
 
     assert(id > 0);
-    mDiscoverCallbacks.emplace_back(id, aInstanceCallback, aHostCallback);
+    mDiscoverCallbacks.emplace_back(id, std::move(aInstanceCallback), std::move(aHostCallback), aServiceType);
 
     return id;
 }
 
-void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+void Publisher::EraseRemovedDiscoverCallbacks(void)
 {
-    bool checkToInvoke = false;
+    VerifyOrExit(mDiscoverCallbacksDepth == 0);
 
-    otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
-                aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
-                aInstanceInfo.mAddresses.size());
+    mDiscoverCallbacks.remove_if([](const DiscoverCallback &aCallback) { return aCallback.mRemoved; });
 
-    if (!aInstanceInfo.mRemoved)
+exit:
+    return;
+}
+
+bool Publisher::DiscoverCallback::MatchesServiceType(const std::string &aType) const
+{
+    return mServiceType.empty() || StringUtils::EqualCaseInsensitive(mServiceType, aType);
+}
+
+void Publisher::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    auto it = mServiceSubscriptionCounts.find(std::make_pair(aType, aInstanceName));
+
+    if (it != mServiceSubscriptionCounts.end())
     {
-        std::string addressesString;
+        it->second++;
+        otbrLogInfo("Service %s.%s is already subscribed (total %u)", aInstanceName.c_str(), aType.c_str(),
+                    it->second);
+        NotifyCachedServiceInstances(aType, aInstanceName);
+        ExitNow();
+    }
+
+    SuccessOrExit(SubscribeServiceImpl(aType, aInstanceName));
+    mTelemetryInfo.mDiscoveryCacheMisses++;
+    mServiceSubscriptionCounts[std::make_pair(aType, aInstanceName)] = 1;
 
-        for (const auto &address : aInstanceInfo.mAddresses)
+exit:
+    return;
+}
+
+void Publisher::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    auto it = mServiceSubscriptionCounts.find(std::make_pair(aType, aInstanceName));
+
+    VerifyOrExit(it != mServiceSubscriptionCounts.end());
+    VerifyOrExit(--it->second == 0);
+
+    mServiceSubscriptionCounts.erase(it);
+    RemoveUnsubscribedServiceInstances(aType);
+    UnsubscribeServiceImpl(aType, aInstanceName);
+
+exit:
+    return;
+}
+
+void Publisher::SubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptionCounts.find(aHostName);
+
+    if (it != mHostSubscriptionCounts.end())
+    {
+        it->second++;
+        otbrLogInfo("Host %s is already subscribed (total %u)", aHostName.c_str(), it->second);
+        NotifyCachedHost(aHostName);
+        ExitNow();
+    }
+
+    SuccessOrExit(SubscribeHostImpl(aHostName));
+    mTelemetryInfo.mDiscoveryCacheMisses++;
+    mHostSubscriptionCounts[aHostName] = 1;
+
+exit:
+    return;
+}
+
+void Publisher::UnsubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptionCounts.find(aHostName);
+
+    VerifyOrExit(it != mHostSubscriptionCounts.end());
+    VerifyOrExit(--it->second == 0);
+
+    mHostSubscriptionCounts.erase(it);
+    mHostCache.erase(aHostName);
+    UnsubscribeHostImpl(aHostName);
+
+exit:
+    return;
+}
+
+void Publisher::ClearSubscriptions(void)
+{
+    mServiceSubscriptionCounts.clear();
+    mHostSubscriptionCounts.clear();
+    mServiceInstanceCache.clear();
+    mHostCache.clear();
+}
+
+bool Publisher::IsServiceInstanceSubscribed(const std::string &aType, const std::string &aInstanceName) const
+{
+    return mServiceSubscriptionCounts.count(std::make_pair(aType, std::string())) > 0 ||
+           mServiceSubscriptionCounts.count(std::make_pair(aType, aInstanceName)) > 0;
+}
+
+void Publisher::NotifyCachedServiceInstances(const std::string &aType, const std::string &aInstanceName)
+{
+    bool hit = false;
+
+    for (const auto &entry : mServiceInstanceCache)
+    {
+        if (entry.first.first == aType && (aInstanceName.empty() || entry.first.second == aInstanceName) &&
+            !entry.second.IsExpired())
+        {
+            hit = true;
+            break;
+        }
+    }
+
+    if (!hit)
+    {
+        mTelemetryInfo.mDiscoveryCacheMisses++;
+        ExitNow();
+    }
+
+    mTelemetryInfo.mDiscoveryCacheHits++;
+
+    // The cache is looked up again when the task runs, so that the instances which are removed or expired meanwhile
+    // are not notified.
+    mTaskRunner.Post([this, aType, aInstanceName]() {
+        std::vector<DiscoveredInstanceInfo> instances;
+
+        VerifyOrExit(mServiceSubscriptionCounts.count(std::make_pair(aType, aInstanceName)) > 0);
+
+        for (const auto &entry : mServiceInstanceCache)
         {
-            addressesString += address.ToString() + ",";
+            if (entry.first.first == aType && (aInstanceName.empty() || entry.first.second == aInstanceName) &&
+                !entry.second.IsExpired())
+            {
+                instances.push_back(entry.second.mInfo);
+            }
         }
-        if (addressesString.size())
+
+        for (const DiscoveredInstanceInfo &instance : instances)
         {
-            addressesString.pop_back();
+            otbrLogInfo("Notify cached service instance %s.%s", instance.mName.c_str(), aType.c_str());
+            InvokeServiceCallbacks(aType, instance);
         }
-        otbrLogInfo("addresses: [ %s ]", addressesString.c_str());
+
+    exit:
+        return;
+    });
+
+exit:
+    return;
+}
+
+void Publisher::NotifyCachedHost(const std::string &aHostName)
+{
+    auto it = mHostCache.find(aHostName);
+
+    if (it == mHostCache.end() || it->second.IsExpired())
+    {
+        mTelemetryInfo.mDiscoveryCacheMisses++;
+        ExitNow();
+    }
+
+    mTelemetryInfo.mDiscoveryCacheHits++;
+
+    mTaskRunner.Post([this, aHostName]() {
+        auto               hostIt = mHostCache.find(aHostName);
+        DiscoveredHostInfo hostInfo;
+
+        VerifyOrExit(mHostSubscriptionCounts.count(aHostName) > 0);
+        VerifyOrExit(hostIt != mHostCache.end() && !hostIt->second.IsExpired());
+
+        otbrLogInfo("Notify cached host %s", aHostName.c_str());
+        hostInfo = hostIt->second.mInfo;
+        InvokeHostCallbacks(aHostName, hostInfo);
+
+    exit:
+        return;
+    });
+
+exit:
+    return;
+}
+
+void Publisher::RemoveUnsubscribedServiceInstances(const std::string &aType)
+{
+    for (auto it = mServiceInstanceCache.begin(); it != mServiceInstanceCache.end();)
+    {
+        if (it->first.first == aType && !IsServiceInstanceSubscribed(aType, it->first.second))
+        {
+            it = mServiceInstanceCache.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+{
+    OTBR_PROBE(mdns__service__resolved, aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mRemoved,
+               aInstanceInfo.mAddresses.size());
+
+    otbrLogInfoRateLimited("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
+                           aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(),
+                           aInstanceInfo.mHostName.c_str(), aInstanceInfo.mAddresses.size());
+
+    if (!aInstanceInfo.mRemoved)
+    {
+        otbrLogInfoRateLimited("addresses: [ %s ]", AddressListToString(aInstanceInfo.mAddresses).c_str());
     }
 
     DnsUtils::CheckServiceNameSanity(aType);
@@ -237,38 +933,74 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
+    UpdateServiceInstanceResolutionLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // service callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
-
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
+    if (aInstanceInfo.mRemoved)
     {
-        if (callback.mServiceCallback != nullptr)
+        auto it = mServiceInstanceCache.find(std::make_pair(aType, aInstanceInfo.mName));
+
+        if (it != mServiceInstanceCache.end() && it->second.mInfo.mNetifIndex == aInstanceInfo.mNetifIndex)
         {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
+            mServiceInstanceCache.erase(it);
         }
     }
+    else if (IsServiceInstanceSubscribed(aType, aInstanceInfo.mName) &&
+             HasRoomInCache(mServiceInstanceCache, std::make_pair(aType, aInstanceInfo.mName)))
+    {
+        CachedInfo<DiscoveredInstanceInfo> &cached = mServiceInstanceCache[std::make_pair(aType, aInstanceInfo.mName)];
+
+        cached.mInfo       = aInstanceInfo;
+        cached.mExpireTime = Clock::now() + std::chrono::seconds(aInstanceInfo.mTtl);
+    }
+
+    InvokeServiceCallbacks(aType, aInstanceInfo);
+
+    EventBus::Publish(mServiceDiscoveredEvent, [&aType, &aInstanceInfo](ServiceDiscoveredEvent &aEvent) {
+        aEvent.mType         = &aType;
+        aEvent.mInstanceInfo = &aInstanceInfo;
+    });
+}
+
+template <typename CacheType>
+bool Publisher::HasRoomInCache(CacheType &aCache, const typename CacheType::key_type &aKey)
+{
+    bool hasRoom = true;
+
+    VerifyOrExit(aCache.size() >= OTBR_MDNS_DISCOVERY_CACHE_SIZE && aCache.find(aKey) == aCache.end());
+
+    for (auto it = aCache.begin(); it != aCache.end();)
+    {
+        it = it->second.IsExpired() ? aCache.erase(it) : std::next(it);
+    }
+
+    hasRoom = (aCache.size() < OTBR_MDNS_DISCOVERY_CACHE_SIZE);
+
+exit:
+    return hasRoom;
+}
+
+void Publisher::InvokeServiceCallbacks(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    // The callbacks added by the invoked callbacks have larger Subscriber IDs and are not invoked for this instance.
+    uint64_t endId = mNextSubscriberId;
 
-    while (checkToInvoke)
+    mDiscoverCallbacksDepth++;
+
+    for (DiscoverCallback &callback : mDiscoverCallbacks)
     {
-        checkToInvoke = false;
+        if (callback.mId >= endId)
+        {
+            break;
+        }
 
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+        if (!callback.mRemoved && callback.mServiceCallback != nullptr && callback.MatchesServiceType(aType))
         {
-            if (callback.mShouldInvoke)
-            {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mServiceCallback(aType, aInstanceInfo);
-                break;
-            }
+            callback.mServiceCallback(aType, aInstanceInfo);
         }
     }
+
+    mDiscoverCallbacksDepth--;
+    EraseRemovedDiscoverCallbacks();
 }
 
 void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName)
@@ -281,12 +1013,12 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::s
     instanceInfo.mNetifIndex = aNetifIndex;
     instanceInfo.mName       = aInstanceName;
 
-    OnServiceResolved(aType, instanceInfo);
+    OnServiceResolved(std::move(aType), std::move(instanceInfo));
 }
 
 void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
 {
-    bool checkToInvoke = false;
+    OTBR_PROBE(mdns__host__resolved, aHostName.c_str(), aHostInfo.mAddresses.size());
 
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
                 aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
@@ -297,38 +1029,50 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
-    UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
+    UpdateHostResolutionLatency(aHostName, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // host callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
+    if (aHostInfo.mAddresses.empty())
+    {
+        mHostCache.erase(aHostName);
+    }
+    else if (mHostSubscriptionCounts.count(aHostName) > 0 && HasRoomInCache(mHostCache, aHostName))
+    {
+        CachedInfo<DiscoveredHostInfo> &cached = mHostCache[aHostName];
+
+        cached.mInfo       = aHostInfo;
+        cached.mExpireTime = Clock::now() + std::chrono::seconds(aHostInfo.mTtl);
+    }
+
+    InvokeHostCallbacks(aHostName, aHostInfo);
+
+    EventBus::Publish(mHostDiscoveredEvent, [&aHostName, &aHostInfo](HostDiscoveredEvent &aEvent) {
+        aEvent.mHostName = &aHostName;
+        aEvent.mHostInfo = &aHostInfo;
+    });
+}
+
+void Publisher::InvokeHostCallbacks(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    // The callbacks added by the invoked callbacks have larger Subscriber IDs and are not invoked for this host.
+    uint64_t endId = mNextSubscriberId;
+
+    mDiscoverCallbacksDepth++;
 
     for (DiscoverCallback &callback : mDiscoverCallbacks)
     {
-        if (callback.mHostCallback != nullptr)
+        if (callback.mId >= endId)
         {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
+            break;
         }
-    }
-
-    while (checkToInvoke)
-    {
-        checkToInvoke = false;
 
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+        if (!callback.mRemoved && callback.mHostCallback != nullptr)
         {
-            if (callback.mShouldInvoke)
-            {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mHostCallback(aHostName, aHostInfo);
-                break;
-            }
+            callback.mHostCallback(aHostName, aHostInfo);
         }
     }
+
+    mDiscoverCallbacksDepth--;
+    EraseRemovedDiscoverCallbacks();
 }
 
 Publisher::SubTypeList Publisher::SortSubTypeList(SubTypeList aSubTypeList)
@@ -343,6 +1087,22 @@ Publisher::AddressList Publisher::SortAddressList(AddressList aAddressList)
     return aAddressList;
 }
 
+std::string Publisher::AddressListToString(const AddressList &aAddresses)
+{
+    std::string string;
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        if (!string.empty())
+        {
+            string += ',';
+        }
+        string += address.ToString();
+    }
+
+    return string;
+}
+
 std::string Publisher::MakeFullServiceName(const std::string &aName, const std::string &aType)
 {
     return aName + "." + aType + ".local";
@@ -353,14 +1113,67 @@ std::string Publisher::MakeFullName(const std::string &aName)
     return aName + ".local";
 }
 
+Publisher::NameHash Publisher::HashName(const std::string &aName)
+{
+    return HashLabel(kNameHashOffsetBasis, aName);
+}
+
+Publisher::NameHash Publisher::HashName(const std::string &aName, const std::string &aType)
+{
+    NameHash hash = HashLabel(kNameHashOffsetBasis, aName);
+
+    hash = (hash ^ static_cast<uint8_t>('.')) * kNameHashPrime;
+
+    return HashLabel(hash, aType);
+}
+
+Publisher::NameHash Publisher::HashLabel(NameHash aHash, const std::string &aLabel)
+{
+    // FNV-1a, so that hashing can be continued over the next label.
+    for (char c : aLabel)
+    {
+        aHash = (aHash ^ static_cast<uint8_t>(c)) * kNameHashPrime;
+    }
+
+    return aHash;
+}
+
+bool Publisher::MatchName(const std::string &aNameAndType, const std::string &aName, const std::string &aType)
+{
+    return aNameAndType.size() == aName.size() + 1 + aType.size() &&
+           aNameAndType.compare(0, aName.size(), aName) == 0 && aNameAndType[aName.size()] == '.' &&
+           aNameAndType.compare(aName.size() + 1, aType.size(), aType) == 0;
+}
+
 void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 {
-    mServiceRegistrations.emplace(MakeFullServiceName(aServiceReg->mName, aServiceReg->mType), std::move(aServiceReg));
+    ServiceRegistrationPtr serviceReg = std::move(aServiceReg);
+
+    // An existing registration of the same service is kept, the new one is dropped.
+    VerifyOrExit(FindServiceRegistration(serviceReg->mName, serviceReg->mType) == nullptr);
+    mServiceRegistrations.emplace(HashName(serviceReg->mName, serviceReg->mType), std::move(serviceReg));
+
+exit:
+    return;
+}
+
+Publisher::ServiceRegistrationMap::iterator Publisher::FindServiceRegistrationEntry(const std::string &aName,
+                                                                                      const std::string &aType)
+{
+    auto range = mServiceRegistrations.equal_range(HashName(aName, aType));
+    auto it    = range.first;
+
+    while (it != range.second && !(it->second->mName == aName && it->second->mType == aType))
+    {
+        ++it;
+    }
+
+    return it != range.second ? it : mServiceRegistrations.end();
 }
 
 void Publisher::RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
 {
-    auto                   it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto                   it = FindServiceRegistrationEntry(aName, aType);
     ServiceRegistrationPtr serviceReg;
 
     otbrLogInfo("Removing service %s.%s", aName.c_str(), aType.c_str());
@@ -379,16 +1192,26 @@ exit:
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto it = FindServiceRegistrationEntry(aName, aType);
 
     return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
 }
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aNameAndType)
 {
-    auto it = mServiceRegistrations.find(MakeFullName(aNameAndType));
+    ServiceRegistration *result = nullptr;
+    auto                 range  = mServiceRegistrations.equal_range(HashName(aNameAndType));
 
-    return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (MatchName(aNameAndType, it->second->mName, it->second->mType))
+        {
+            result = it->second.get();
+            break;
+        }
+    }
+
+    return result;
 }
 
 Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const std::string &aHostName,
@@ -403,7 +1226,15 @@ Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const st
 
     VerifyOrExit(serviceReg != nullptr);
 
-    if (serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData))
+    if (serviceReg->IsCompleted() &&
+        serviceReg->IsTxtDataOnlyOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData) &&
+        UpdateServiceTxtDataImpl(*serviceReg, aTxtData) == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("Updated TXT data of existing service %s.%s", aName.c_str(), aType.c_str());
+        serviceReg->mTxtData = aTxtData;
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+    else if (serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData))
     {
         otbrLogInfo("Removing existing service %s.%s: outdated", aName.c_str(), aType.c_str());
         RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
@@ -419,13 +1250,11 @@ Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const st
         // If the same service is being registered with the same parameters,
         // let's join the waiting queue for the result.
         serviceReg->mCallback = std::bind(
-            [](std::shared_ptr<ResultCallback> aExistingCallback, std::shared_ptr<ResultCallback> aNewCallback,
-               otbrError aError) {
-                std::move (*aExistingCallback)(aError);
-                std::move (*aNewCallback)(aError);
+            [](ResultCallback &aExistingCallback, ResultCallback &aNewCallback, otbrError aError) {
+                std::move(aExistingCallback)(aError);
+                std::move(aNewCallback)(aError);
             },
-            std::make_shared<ResultCallback>(std::move(serviceReg->mCallback)),
-            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+            std::move(serviceReg->mCallback), std::move(aCallback), std::placeholders::_1);
     }
 
 exit:
@@ -437,10 +1266,19 @@ Publisher::ResultCallback Publisher::HandleDuplicateHostRegistration(const std::
                                                                      ResultCallback   &&aCallback)
 {
     HostRegistration *hostReg = FindHostRegistration(aName);
+    AddressList       addresses;
 
     VerifyOrExit(hostReg != nullptr);
+    addresses = SortAddressList(aAddresses);
 
-    if (hostReg->IsOutdated(aName, aAddresses))
+    if (hostReg->IsCompleted() && hostReg->IsOutdated(aName, addresses) &&
+        UpdateHostAddressesImpl(*hostReg, addresses) == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("Updated addresses of existing host %s", aName.c_str());
+        hostReg->mAddresses = std::move(addresses);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+    else if (hostReg->IsOutdated(aName, aAddresses))
     {
         otbrLogInfo("Removing existing host %s: outdated", aName.c_str());
         RemoveHostRegistration(hostReg->mName, OTBR_ERROR_ABORTED);
@@ -456,13 +1294,11 @@ Publisher::ResultCallback Publisher::HandleDuplicateHostRegistration(const std::
         // If the same service is being registered with the same parameters,
         // let's join the waiting queue for the result.
         hostReg->mCallback = std::bind(
-            [](std::shared_ptr<ResultCallback> aExistingCallback, std::shared_ptr<ResultCallback> aNewCallback,
-               otbrError aError) {
-                std::move (*aExistingCallback)(aError);
-                std::move (*aNewCallback)(aError);
+            [](ResultCallback &aExistingCallback, ResultCallback &aNewCallback, otbrError aError) {
+                std::move(aExistingCallback)(aError);
+                std::move(aNewCallback)(aError);
             },
-            std::make_shared<ResultCallback>(std::move(hostReg->mCallback)),
-            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+            std::move(hostReg->mCallback), std::move(aCallback), std::placeholders::_1);
     }
 
 exit:
@@ -471,12 +1307,32 @@ exit:
 
 void Publisher::AddHostRegistration(HostRegistrationPtr &&aHostReg)
 {
-    mHostRegistrations.emplace(MakeFullHostName(aHostReg->mName), std::move(aHostReg));
+    HostRegistrationPtr hostReg = std::move(aHostReg);
+
+    // An existing registration of the same host is kept, the new one is dropped.
+    VerifyOrExit(FindHostRegistration(hostReg->mName) == nullptr);
+    mHostRegistrations.emplace(HashName(hostReg->mName), std::move(hostReg));
+
+exit:
+    return;
+}
+
+Publisher::HostRegistrationMap::iterator Publisher::FindHostRegistrationEntry(const std::string &aName)
+{
+    auto range = mHostRegistrations.equal_range(HashName(aName));
+    auto it    = range.first;
+
+    while (it != range.second && it->second->mName != aName)
+    {
+        ++it;
+    }
+
+    return it != range.second ? it : mHostRegistrations.end();
 }
 
 void Publisher::RemoveHostRegistration(const std::string &aName, otbrError aError)
 {
-    auto                it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto                it = FindHostRegistrationEntry(aName);
     HostRegistrationPtr hostReg;
 
     otbrLogInfo("Removing host %s", aName.c_str());
@@ -496,7 +1352,7 @@ exit:
 
 Publisher::HostRegistration *Publisher::FindHostRegistration(const std::string &aName)
 {
-    auto it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto it = FindHostRegistrationEntry(aName);
 
     return it != mHostRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -525,13 +1381,11 @@ Publisher::ResultCallback Publisher::HandleDuplicateKeyRegistration(const std::s
         // If the same key is being registered with the same parameters,
         // let's join the waiting queue for the result.
         keyReg->mCallback = std::bind(
-            [](std::shared_ptr<ResultCallback> aExistingCallback, std::shared_ptr<ResultCallback> aNewCallback,
-               otbrError aError) {
-                std::move (*aExistingCallback)(aError);
-                std::move (*aNewCallback)(aError);
+            [](ResultCallback &aExistingCallback, ResultCallback &aNewCallback, otbrError aError) {
+                std::move(aExistingCallback)(aError);
+                std::move(aNewCallback)(aError);
             },
-            std::make_shared<ResultCallback>(std::move(keyReg->mCallback)),
-            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+            std::move(keyReg->mCallback), std::move(aCallback), std::placeholders::_1);
     }
 
 exit:
@@ -540,12 +1394,32 @@ exit:
 
 void Publisher::AddKeyRegistration(KeyRegistrationPtr &&aKeyReg)
 {
-    mKeyRegistrations.emplace(MakeFullKeyName(aKeyReg->mName), std::move(aKeyReg));
+    KeyRegistrationPtr keyReg = std::move(aKeyReg);
+
+    // An existing registration of the same key is kept, the new one is dropped.
+    VerifyOrExit(FindKeyRegistration(keyReg->mName) == nullptr);
+    mKeyRegistrations.emplace(HashName(keyReg->mName), std::move(keyReg));
+
+exit:
+    return;
+}
+
+Publisher::KeyRegistrationMap::iterator Publisher::FindKeyRegistrationEntry(const std::string &aName)
+{
+    auto range = mKeyRegistrations.equal_range(HashName(aName));
+    auto it    = range.first;
+
+    while (it != range.second && it->second->mName != aName)
+    {
+        ++it;
+    }
+
+    return it != range.second ? it : mKeyRegistrations.end();
 }
 
 void Publisher::RemoveKeyRegistration(const std::string &aName, otbrError aError)
 {
-    auto               it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    auto               it = FindKeyRegistrationEntry(aName);
     KeyRegistrationPtr keyReg;
 
     otbrLogInfo("Removing key %s", aName.c_str());
@@ -565,16 +1439,26 @@ exit:
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName)
 {
-    auto it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    auto it = FindKeyRegistrationEntry(aName);
 
     return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
 }
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mKeyRegistrations.find(MakeFullServiceName(aName, aType));
+    KeyRegistration *result = nullptr;
+    auto             range  = mKeyRegistrations.equal_range(HashName(aName, aType));
 
-    return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (MatchName(it->second->mName, aName, aType))
+        {
+            result = it->second.get();
+            break;
+        }
+    }
+
+    return result;
 }
 
 Publisher::Registration::~Registration(void)
@@ -593,6 +1477,17 @@ bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
              mPort == aPort && mTxtData == aTxtData);
 }
 
+bool Publisher::ServiceRegistration::IsTxtDataOnlyOutdated(const std::string &aHostName,
+                                                           const std::string &aName,
+                                                           const std::string &aType,
+                                                           const SubTypeList &aSubTypeList,
+                                                           uint16_t           aPort,
+                                                           const TxtData     &aTxtData) const
+{
+    return mHostName == aHostName && mName == aName && mType == aType && mSubTypeList == aSubTypeList &&
+           mPort == aPort && mTxtData != aTxtData;
+}
+
 void Publisher::ServiceRegistration::Complete(otbrError aError)
 {
     OnComplete(aError);
@@ -604,7 +1499,8 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mServiceRegistrations, aError);
-        mPublisher->UpdateServiceRegistrationEmaLatency(mName, mType, aError);
+        UpdateRegistrationLatency(mPublisher->mTelemetryInfo.mServiceRegistrationEmaLatency,
+                                  mPublisher->mTelemetryInfo.mServiceRegistrationLatencies, *this, aError);
     }
 }
 
@@ -624,7 +1520,8 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mHostRegistrations, aError);
-        mPublisher->UpdateHostRegistrationEmaLatency(mName, aError);
+        UpdateRegistrationLatency(mPublisher->mTelemetryInfo.mHostRegistrationEmaLatency,
+                                  mPublisher->mTelemetryInfo.mHostRegistrationLatencies, *this, aError);
     }
 }
 
@@ -644,7 +1541,8 @@ void Publisher::KeyRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mKeyRegistrations, aError);
-        mPublisher->UpdateKeyRegistrationEmaLatency(mName, aError);
+        UpdateRegistrationLatency(mPublisher->mTelemetryInfo.mKeyRegistrationEmaLatency,
+                                  mPublisher->mTelemetryInfo.mKeyRegistrationLatencies, *this, aError);
     }
 }
 
@@ -680,10 +1578,15 @@ void Publisher::UpdateMdnsResponseCounters(otbr::MdnsResponseCounters &aCounters
     }
 }
 
-void Publisher::UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError)
+void Publisher::UpdateLatency(uint32_t             &aEmaLatency,
+                              MdnsLatencyHistogram &aHistogram,
+                              uint32_t              aLatency,
+                              otbrError             aError)
 {
     VerifyOrExit(aError != OTBR_ERROR_ABORTED);
 
+    aHistogram.Record(aLatency);
+
     if (!aEmaLatency)
     {
         aEmaLatency = aLatency;
@@ -700,66 +1603,47 @@ exit:
     return;
 }
 
-void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                                    const std::string &aType,
-                                                    otbrError          aError)
+void Publisher::UpdateRegistrationLatency(uint32_t             &aEmaLatency,
+                                          MdnsLatencyHistogram &aHistogram,
+                                          const Registration   &aReg,
+                                          otbrError             aError)
 {
-    auto it = mServiceRegistrationBeginTime.find(std::make_pair(aInstanceName, aType));
+    // The times are cached by the mainloop, the begin time may have been read afterwards on another thread.
+    uint32_t latency =
+        std::max(std::chrono::duration_cast<Milliseconds>(MainloopClock::Now() - aReg.mBeginTime), Milliseconds::zero())
+            .count();
 
-    if (it != mServiceRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
-        mServiceRegistrationBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError)
-{
-    auto it = mHostRegistrationBeginTime.find(aHostName);
-
-    if (it != mHostRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
-        mHostRegistrationBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError)
-{
-    auto it = mKeyRegistrationBeginTime.find(aKeyName);
-
-    if (it != mKeyRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mKeyRegistrationEmaLatency, latency, aError);
-        mKeyRegistrationBeginTime.erase(it);
-    }
+    UpdateLatency(aEmaLatency, aHistogram, latency, aError);
 }
 
-void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                          const std::string &aType,
-                                                          otbrError          aError)
+void Publisher::UpdateServiceInstanceResolutionLatency(const std::string &aInstanceName,
+                                                       const std::string &aType,
+                                                       otbrError          aError)
 {
     auto it = mServiceInstanceResolutionBeginTime.find(std::make_pair(aInstanceName, aType));
 
     if (it != mServiceInstanceResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
+        uint32_t latency =
+            std::max(std::chrono::duration_cast<Milliseconds>(MainloopClock::Now() - it->second), Milliseconds::zero())
+                .count();
+        UpdateLatency(mTelemetryInfo.mServiceResolutionEmaLatency, mTelemetryInfo.mServiceResolutionLatencies, latency,
+                      aError);
         mServiceInstanceResolutionBeginTime.erase(it);
     }
 }
 
-void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError)
+void Publisher::UpdateHostResolutionLatency(const std::string &aHostName, otbrError aError)
 {
     auto it = mHostResolutionBeginTime.find(aHostName);
 
     if (it != mHostResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
+        uint32_t latency =
+            std::max(std::chrono::duration_cast<Milliseconds>(MainloopClock::Now() - it->second), Milliseconds::zero())
+                .count();
+        UpdateLatency(mTelemetryInfo.mHostResolutionEmaLatency, mTelemetryInfo.mHostResolutionLatencies, latency,
+                      aError);
         mHostResolutionBeginTime.erase(it);
     }
 }
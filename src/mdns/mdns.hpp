@@ -45,15 +45,31 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
 
 #include "common/callback.hpp"
 #include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
 
+/**
+ * The maximum number of discovered service instances, and of discovered hosts, cached by the mDNS publisher.
+ *
+ * The expired entries are dropped when the cache is full, and the new discoveries are not cached if there is none.
+ *
+ */
+#ifndef OTBR_MDNS_DISCOVERY_CACHE_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_MDNS_DISCOVERY_CACHE_SIZE 64
+#else
+#define OTBR_MDNS_DISCOVERY_CACHE_SIZE 1024
+#endif
+#endif
+
 namespace otbr {
 
 namespace Mdns {
@@ -175,6 +191,26 @@ public:
     using DiscoveredHostCallback =
         std::function<void(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)>;
 
+    /**
+     * This structure represents the event of a discovered service instance published on the `EventBus`.
+     *
+     */
+    struct ServiceDiscoveredEvent
+    {
+        const std::string            *mType;         ///< The service type.
+        const DiscoveredInstanceInfo *mInstanceInfo; ///< The discovered service instance.
+    };
+
+    /**
+     * This structure represents the event of a discovered host published on the `EventBus`.
+     *
+     */
+    struct HostDiscoveredEvent
+    {
+        const std::string        *mHostName; ///< The host name.
+        const DiscoveredHostInfo *mHostInfo; ///< The discovered host.
+    };
+
     /**
      * mDNS state values.
      *
@@ -191,6 +227,60 @@ public:
     /** The callback for receiving the result of a operation. */
     using ResultCallback = OnceCallback<void(otbrError aError)>;
 
+    /** The callback for receiving the result of a publication with alternative names, and the name published. */
+    using NameResultCallback = OnceCallback<void(otbrError aError, const std::string &aName)>;
+
+    /**
+     * Publication priority values.
+     *
+     * Publications are paced when many of them are requested at once, e.g. when SRP hosts are registered again. The
+     * pending publications of a higher priority are always handed to the mDNS implementation first.
+     *
+     */
+    enum class Priority : uint8_t
+    {
+        kHigh   = 0, ///< The services of the Border Router itself, e.g. MeshCoP and TREL.
+        kNormal = 1, ///< The services and hosts advertised on behalf of other devices, e.g. SRP clients.
+    };
+
+    /**
+     * This structure represents a service to be published with its host by `PublishHostBatch()`.
+     *
+     */
+    struct BatchService
+    {
+        std::string    mName;               ///< The service instance name.
+        std::string    mType;               ///< The service type.
+        SubTypeList    mSubTypeList;        ///< The sub-types of the service.
+        uint16_t       mPort     = 0;       ///< The port of the service.
+        TxtData        mTxtData;            ///< The TXT data of the service.
+        ResultCallback mCallback = nullptr; ///< The callback for receiving the publishing result of the service.
+    };
+
+    /**
+     * This structure represents a key record to be published with its host by `PublishHostBatch()`.
+     *
+     */
+    struct BatchKey
+    {
+        std::string    mName;               ///< The name associated with the key record.
+        KeyData        mKeyData;            ///< The key data.
+        ResultCallback mCallback = nullptr; ///< The callback for receiving the publishing result of the key record.
+    };
+
+    /**
+     * This structure represents a host with its services and key records to be published by `PublishHostBatch()`.
+     *
+     */
+    struct HostBatch
+    {
+        std::string               mHostName;               ///< The name of the host.
+        AddressList               mAddresses;              ///< The addresses of the host.
+        ResultCallback            mHostCallback = nullptr; ///< The callback for receiving the result of the host.
+        std::vector<BatchService> mServices;               ///< The services of the host.
+        std::vector<BatchKey>     mKeys;                   ///< The key records of the host and its services.
+    };
+
     /**
      * This method starts the mDNS publisher.
      *
@@ -233,6 +323,7 @@ public:
      *                          failure. Specifically, `OTBR_ERROR_DUPLICATED` indicates that the name has
      *                          already been published and the caller can re-publish with a new name if an
      *                          alternative name is available/acceptable.
+     * @param[in] aPriority     The priority of this publication.
      *
      */
     void PublishService(const std::string &aHostName,
@@ -241,17 +332,46 @@ public:
                         const SubTypeList &aSubTypeList,
                         uint16_t           aPort,
                         const TxtData     &aTxtData,
-                        ResultCallback   &&aCallback);
+                        ResultCallback   &&aCallback,
+                        Priority           aPriority = Priority::kNormal);
+
+    /**
+     * This method publishes a service under one of several candidate names.
+     *
+     * The candidates are probed in parallel instead of one after the other, the first one published is kept and the
+     * others are un-published. The candidates reported in conflict within the last `kConflictTimeout` are skipped.
+     *
+     * @param[in] aHostName     The name of the host which this service resides on, as for `PublishService()`.
+     * @param[in] aNames        The candidate names of this service.
+     * @param[in] aType         The type of this service, e.g., "_srv._udp" (MUST NOT end with dot).
+     * @param[in] aSubTypeList  A list of service subtypes.
+     * @param[in] aPort         The port number of this service.
+     * @param[in] aTxtData      The encoded TXT data for this service.
+     * @param[in] aCallback     The callback for receiving the publishing result and the published name.
+     *                          `OTBR_ERROR_DUPLICATED` indicates that all the candidates are in conflict.
+     * @param[in] aPriority     The priority of this publication.
+     *
+     */
+    void PublishServiceWithAlternatives(const std::string              &aHostName,
+                                        const std::vector<std::string> &aNames,
+                                        const std::string              &aType,
+                                        const SubTypeList              &aSubTypeList,
+                                        uint16_t                        aPort,
+                                        const TxtData                  &aTxtData,
+                                        NameResultCallback            &&aCallback,
+                                        Priority                        aPriority = Priority::kNormal);
 
     /**
      * This method un-publishes a service.
      *
+     * A pending publication of the service is aborted with `OTBR_ERROR_ABORTED`.
+     *
      * @param[in] aName      The name of this service.
      * @param[in] aType      The type of this service, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aCallback  The callback for receiving the publishing result.
      *
      */
-    virtual void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) = 0;
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback);
 
     /**
      * This method publishes or updates a host.
@@ -273,11 +393,13 @@ public:
     /**
      * This method un-publishes a host.
      *
+     * A pending publication of the host is aborted with `OTBR_ERROR_ABORTED`.
+     *
      * @param[in] aName      A host name (MUST not end with dot).
      * @param[in] aCallback  The callback for receiving the publishing result.
      *
      */
-    virtual void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) = 0;
+    void UnpublishHost(const std::string &aName, ResultCallback &&aCallback);
 
     /**
      * This method publishes or updates a key record for a name.
@@ -296,75 +418,115 @@ public:
     /**
      * This method un-publishes a key record
      *
+     * A pending publication of the key record is aborted with `OTBR_ERROR_ABORTED`.
+     *
      * @param[in] aName      The name associated with key record.
      * @param[in] aCallback  The callback for receiving the publishing result.
      *
      */
-    virtual void UnpublishKey(const std::string &aName, ResultCallback &&aCallback) = 0;
+    void UnpublishKey(const std::string &aName, ResultCallback &&aCallback);
+
+    /**
+     * This method publishes or updates a host together with its services and key records.
+     *
+     * This is the same as publishing each of them with `PublishHost()`, `PublishService()` and `PublishKey()`, and
+     * each callback is invoked with the result of its own record. An mDNS implementation may however commit all of
+     * them at once, which is much cheaper when replaying a large number of hosts, in which case they succeed or fail
+     * together.
+     *
+     * If the host, its services and key records are all already published with the same parameters, the callbacks
+     * are invoked with `OTBR_ERROR_NONE` at once, without handing the batch to the mDNS implementation.
+     *
+     * @param[in] aBatch  The host, its services and key records to publish.
+     *
+     */
+    void PublishHostBatch(HostBatch &&aBatch);
+
+    /**
+     * This method tells whether a host with its services and key records is already published.
+     *
+     * @param[in] aBatch  The host, its services and key records.
+     *
+     * @returns Whether all the records of @p aBatch are already published with the same parameters, in which case
+     *          `PublishHostBatch()` completes at once.
+     *
+     */
+    bool IsHostBatchPublished(const HostBatch &aBatch);
+
+    /**
+     * This method tells whether a service is published or being published.
+     *
+     * @param[in] aName  The service instance name.
+     * @param[in] aType  The service type.
+     *
+     * @returns Whether the service is registered with the publisher.
+     *
+     */
+    bool IsServiceRegistered(const std::string &aName, const std::string &aType);
 
     /**
      * This method subscribes a given service or service instance.
      *
      * If @p aInstanceName is not empty, this method subscribes the service instance. Otherwise, this method subscribes
-     * the service. mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify
-     * discovered service instances.
+     * the service. Discovered service instances are notified with the `DiscoveredServiceInstanceCallback` function.
      *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
-     * instance.
+     * Subscriptions of the same service or service instance are reference counted and share a single mDNS query.
+     * The service instances already discovered by the query are notified again right after a repeated subscription,
+     * unless their TTL has expired.
      *
      * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aInstanceName  The service instance to subscribe, or empty to subscribe the service.
      *
      */
-    virtual void SubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method unsubscribes a given service or service instance.
      *
      * If @p aInstanceName is not empty, this method unsubscribes the service instance. Otherwise, this method
-     * unsubscribes the service.
-     *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a service or service instance.
+     * unsubscribes the service. The mDNS query is stopped when the last subscription is removed.
      *
      * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
      *
      */
-    virtual void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method subscribes a given host.
      *
-     * mDNS implementations should use the `DiscoveredHostCallback` function to notify discovered hosts.
-     *
-     * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
+     * Discovered hosts are notified with the `DiscoveredHostCallback` function. Subscriptions of the same host are
+     * reference counted like the ones of services.
      *
      * @param[in] aHostName  The host name (without domain).
      *
      */
-    virtual void SubscribeHost(const std::string &aHostName) = 0;
+    void SubscribeHost(const std::string &aHostName);
 
     /**
      * This method unsubscribes a given host.
      *
-     * @note Discovery Proxy implementation guarantees no redundant unsubscription for a host.
-     *
      * @param[in] aHostName  The host name (without domain).
      *
      */
-    virtual void UnsubscribeHost(const std::string &aHostName) = 0;
+    void UnsubscribeHost(const std::string &aHostName);
 
     /**
      * This method sets the callbacks for subscriptions.
      *
+     * The instance callback can be limited to a single service type, so that it is not invoked for the instances
+     * resolved for the other subscribers.
+     *
      * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
      * @param[in] aHostCallback      The callback function to receive discovered hosts.
+     * @param[in] aServiceType       The service type of the instances to receive, empty for all service types.
      *
      * @returns  The Subscriber ID for the callbacks.
      *
      */
     uint64_t AddSubscriptionCallbacks(DiscoveredServiceInstanceCallback aInstanceCallback,
-                                      DiscoveredHostCallback            aHostCallback);
+                                      DiscoveredHostCallback            aHostCallback,
+                                      const std::string                &aServiceType = "");
 
     /**
      * This method cancels callbacks for subscriptions.
@@ -382,7 +544,40 @@ public:
      */
     const MdnsTelemetryInfo &GetMdnsTelemetryInfo(void) const { return mTelemetryInfo; }
 
-    virtual ~Publisher(void) = default;
+    /**
+     * This method sets the pace at which the publications are handed to the mDNS implementation.
+     *
+     * The publications are paced to avoid flooding the mDNS daemon, a benchmark of the mDNS implementation may
+     * however hand them at once.
+     *
+     * @param[in] aPublicationsPerSecond  The average number of publications per second, or 0 to not pace them.
+     * @param[in] aBurst                  The number of publications which may be handed at once.
+     *
+     */
+    void SetPublicationPace(uint32_t aPublicationsPerSecond, uint32_t aBurst);
+
+    /**
+     * This method limits the publications and the subscriptions to a set of network interfaces.
+     *
+     * The records are published and the queries are sent on the given interfaces only, and the results received on
+     * the other interfaces are ignored, so that the links which don't need the services are not loaded with their
+     * multicast traffic. The interfaces apply to the registrations and the subscriptions made afterwards, so they
+     * are set while the publisher is stopped.
+     *
+     * @param[in] aInterfaces  The indexes of the network interfaces, or empty for all the interfaces.
+     *
+     */
+    void SetInterfaces(const std::vector<uint32_t> &aInterfaces);
+
+    /**
+     * This method returns the network interfaces the publications and the subscriptions are limited to.
+     *
+     * @returns The sorted indexes of the network interfaces, empty for all the interfaces.
+     *
+     */
+    const std::vector<uint32_t> &GetInterfaces(void) const { return mInterfaces; }
+
+    virtual ~Publisher(void);
 
     /**
      * This function creates a mDNS publisher.
@@ -438,18 +633,87 @@ public:
      */
     static otbrError DecodeTxtData(TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength);
 
+    /**
+     * This structure refers to a key/value pair in TXT data, without copying them.
+     *
+     */
+    struct TxtEntryView
+    {
+        const char    *mKey;                ///< The key of the TXT entry, not null-terminated.
+        uint8_t        mKeyLength;          ///< The length of the key.
+        const uint8_t *mValue;              ///< The value of the TXT entry.
+        uint8_t        mValueLength;        ///< The length of the value. Can be zero.
+        bool           mIsBooleanAttribute; ///< This entry is boolean attribute (encoded as `key` without `=`).
+
+        /**
+         * This method tells whether the key of this entry matches a key, case-insensitively.
+         *
+         * @param[in] aKey  The null-terminated key.
+         *
+         * @returns Whether the key of this entry matches @p aKey.
+         *
+         */
+        bool KeyMatches(const char *aKey) const;
+    };
+
+    /**
+     * This class iterates the entries of TXT data in place.
+     *
+     * This allows looking up a few entries of TXT data without decoding all of them to a `TxtList`. The TXT data must
+     * remain valid while iterating, and while the returned entries are used.
+     *
+     */
+    class TxtEntryIterator
+    {
+    public:
+        /**
+         * The constructor to initialize an iterator of TXT data.
+         *
+         * @param[in] aTxtData    A pointer to TXT data.
+         * @param[in] aTxtLength  The TXT data length.
+         *
+         */
+        TxtEntryIterator(const uint8_t *aTxtData, uint16_t aTxtLength)
+            : mTxtData(aTxtData)
+            , mTxtLength(aTxtLength)
+            , mOffset(0)
+        {
+        }
+
+        /**
+         * This method reads the next entry of the TXT data. Empty entries are skipped.
+         *
+         * @param[out] aEntry  The next entry.
+         *
+         * @retval OTBR_ERROR_NONE       Successfully read the next entry.
+         * @retval OTBR_ERROR_NOT_FOUND  There are no more entries.
+         * @retval OTBR_ERROR_PARSE      The TXT data has invalid TXT format.
+         *
+         */
+        otbrError GetNextEntry(TxtEntryView &aEntry);
+
+    private:
+        const uint8_t *mTxtData;
+        uint16_t       mTxtLength;
+        uint16_t       mOffset;
+    };
+
 protected:
     static constexpr uint8_t kMaxTextEntrySize = 255;
 
+    Publisher(void);
+
     class Registration
     {
     public:
         ResultCallback mCallback;
         Publisher     *mPublisher;
+        Timepoint      mBeginTime; // The timepoint to begin the registration, for the EMA latency.
 
         Registration(ResultCallback &&aCallback, Publisher *aPublisher)
             : mCallback(std::move(aCallback))
             , mPublisher(aPublisher)
+            , mBeginTime(MainloopClock::Now())
         {
         }
         virtual ~Registration(void);
@@ -509,6 +773,15 @@ protected:
                         uint16_t           aPort,
                         const TxtData     &aTxtData) const;
 
+        // Tells whether the TXT data is the only outdated part of this `ServiceRegistration` object comparing to the
+        // given parameters.
+        bool IsTxtDataOnlyOutdated(const std::string &aHostName,
+                                   const std::string &aName,
+                                   const std::string &aType,
+                                   const SubTypeList &aSubTypeList,
+                                   uint16_t           aPort,
+                                   const TxtData     &aTxtData) const;
+
     private:
         void OnComplete(otbrError aError);
     };
@@ -561,20 +834,36 @@ protected:
         void OnComplete(otbrError aError);
     };
 
+    // The hash of a name, which indexes the registrations of that name. Names with the same
+    // hash are told apart by comparing the names kept in the registrations.
+    using NameHash = size_t;
+
     using ServiceRegistrationPtr = std::unique_ptr<ServiceRegistration>;
-    using ServiceRegistrationMap = std::map<std::string, ServiceRegistrationPtr>;
+    using ServiceRegistrationMap = std::unordered_multimap<NameHash, ServiceRegistrationPtr>;
     using HostRegistrationPtr    = std::unique_ptr<HostRegistration>;
-    using HostRegistrationMap    = std::map<std::string, HostRegistrationPtr>;
+    using HostRegistrationMap    = std::unordered_multimap<NameHash, HostRegistrationPtr>;
     using KeyRegistrationPtr     = std::unique_ptr<KeyRegistration>;
-    using KeyRegistrationMap     = std::map<std::string, KeyRegistrationPtr>;
+    using KeyRegistrationMap     = std::unordered_multimap<NameHash, KeyRegistrationPtr>;
 
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static AddressList SortAddressList(AddressList aAddressList);
+    static std::string AddressListToString(const AddressList &aAddresses);
     static std::string MakeFullName(const std::string &aName);
     static std::string MakeFullServiceName(const std::string &aName, const std::string &aType);
     static std::string MakeFullHostName(const std::string &aName) { return MakeFullName(aName); }
     static std::string MakeFullKeyName(const std::string &aName) { return MakeFullName(aName); }
 
+    static constexpr NameHash kNameHashOffsetBasis = 2166136261u;
+    static constexpr NameHash kNameHashPrime       = 16777619u;
+
+    // Hashes `aName`, or `aName` and `aType` as if they were joined by a dot, without building the joined name.
+    static NameHash HashName(const std::string &aName);
+    static NameHash HashName(const std::string &aName, const std::string &aType);
+    static NameHash HashLabel(NameHash aHash, const std::string &aLabel);
+
+    // Tells whether `aNameAndType` equals `aName` and `aType` joined by a dot.
+    static bool MatchName(const std::string &aNameAndType, const std::string &aName, const std::string &aType);
+
     virtual otbrError PublishServiceImpl(const std::string &aHostName,
                                          const std::string &aName,
                                          const std::string &aType,
@@ -589,6 +878,33 @@ protected:
 
     virtual otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) = 0;
 
+    virtual void UnpublishServiceImpl(const std::string &aName,
+                                      const std::string &aType,
+                                      ResultCallback   &&aCallback)                    = 0;
+    virtual void UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) = 0;
+    virtual void UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)  = 0;
+
+    // Publishes the host, services and key records of `aBatch`. The default implementation publishes them one by one.
+    virtual void PublishHostBatchImpl(HostBatch &&aBatch);
+
+    // Replaces the TXT record of a completed service registration in place, so that its other records are not
+    // withdrawn and probed again. The default implementation returns `OTBR_ERROR_NOT_IMPLEMENTED`, in which case the
+    // service is re-registered.
+    virtual otbrError UpdateServiceTxtDataImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData);
+
+    // Adds and removes the AAAA records of a completed host registration for the changed addresses only, so that the
+    // unchanged addresses stay announced without being probed again. `aAddresses` is sorted, `aHostReg.mAddresses` is
+    // set to it by the caller on success. The default implementation returns `OTBR_ERROR_NOT_IMPLEMENTED`, in which
+    // case the host is re-registered.
+    virtual otbrError UpdateHostAddressesImpl(HostRegistration &aHostReg, const AddressList &aAddresses);
+
+    // Starts and stops the mDNS queries of subscriptions. They are only called for the first and the last
+    // subscription of the same service, service instance or host.
+    virtual otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)   = 0;
+    virtual void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) = 0;
+    virtual otbrError SubscribeHostImpl(const std::string &aHostName)                                    = 0;
+    virtual void      UnsubscribeHostImpl(const std::string &aHostName)                                  = 0;
+
     virtual void OnServiceResolveFailedImpl(const std::string &aType,
                                             const std::string &aInstanceName,
                                             int32_t            aErrorCode) = 0;
@@ -608,6 +924,9 @@ protected:
     void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
     void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
 
+    // Forgets all subscriptions and the discovered results, when the mDNS queries are all stopped.
+    void ClearSubscriptions(void);
+
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
     // success and no further action should be performed.
@@ -636,22 +955,77 @@ protected:
     KeyRegistration *FindKeyRegistration(const std::string &aName);
     KeyRegistration *FindKeyRegistration(const std::string &aName, const std::string &aType);
 
+    ServiceRegistrationMap::iterator FindServiceRegistrationEntry(const std::string &aName, const std::string &aType);
+    HostRegistrationMap::iterator    FindHostRegistrationEntry(const std::string &aName);
+    KeyRegistrationMap::iterator     FindKeyRegistrationEntry(const std::string &aName);
+
     static void UpdateMdnsResponseCounters(MdnsResponseCounters &aCounters, otbrError aError);
-    static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
-
-    void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                             const std::string &aType,
-                                             otbrError          aError);
-    void UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError);
-    void UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError);
-    void UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                   const std::string &aType,
-                                                   otbrError          aError);
-    void UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError);
+    static void UpdateLatency(uint32_t             &aEmaLatency,
+                              MdnsLatencyHistogram &aHistogram,
+                              uint32_t              aLatency,
+                              otbrError             aError);
+    static void UpdateRegistrationLatency(uint32_t             &aEmaLatency,
+                                          MdnsLatencyHistogram &aHistogram,
+                                          const Registration   &aReg,
+                                          otbrError             aError);
+
+    void UpdateServiceInstanceResolutionLatency(const std::string &aInstanceName,
+                                                const std::string &aType,
+                                                otbrError          aError);
+    void UpdateHostResolutionLatency(const std::string &aHostName, otbrError aError);
 
     static void AddAddress(AddressList &aAddressList, const Ip6Address &aAddress);
     static void RemoveAddress(AddressList &aAddressList, const Ip6Address &aAddress);
 
+    // Publications are handed to the mDNS implementation at no more than `kPublicationsPerSecond` on average, with
+    // bursts of up to `kPublicationBurst` publications, unless set otherwise with `SetPublicationPace()`.
+    static constexpr uint32_t kPublicationBurst      = 32;
+    static constexpr uint32_t kPublicationsPerSecond = 100;
+
+    enum class PublicationType : uint8_t
+    {
+        kService,
+        kHost,
+        kKey,
+    };
+
+    // Publishes the record if the error is `OTBR_ERROR_NONE`, or reports the error to the callback otherwise.
+    using PublicationTask = std::function<void(otbrError aError)>;
+
+    struct PendingPublication
+    {
+        PublicationType mType;
+        std::string     mName;
+        Timepoint       mEnqueueTime;
+        PublicationTask mTask;
+    };
+
+    void   SchedulePublication(Priority aPriority, PublicationType aType, std::string aName, PublicationTask aTask);
+
+    // A name reported in conflict is not probed again for `kConflictTimeout`, its publications fail immediately with
+    // `OTBR_ERROR_DUPLICATED` so that the caller picks another name without waiting for a probe cycle.
+    static constexpr uint32_t kConflictTimeout = 30; // In seconds.
+
+    bool           IsInConflict(PublicationType aType, const std::string &aName);
+    ResultCallback RecordConflict(PublicationType aType, const std::string &aName, ResultCallback &&aCallback);
+    void   DispatchPublications(void);
+    void   RefillPublicationTokens(void);
+    void   AbortPendingPublications(PublicationType aType, const std::string &aName);
+    size_t GetPendingPublicationCount(void) const;
+
+    static void RecordHistogram(uint32_t (&aBuckets)[MdnsTelemetryInfo::kNumHistogramBuckets], uint64_t aValue);
+
+    // Counts a request sent to the mDNS daemon, e.g. a D-Bus call to avahi or a message to mDNSResponder.
+    void CountDaemonRequest(void) { mTelemetryInfo.mDaemonRequests++; }
+
+    void InvokeServiceCallbacks(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    void InvokeHostCallbacks(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+    void EraseRemovedDiscoverCallbacks(void);
+    bool IsServiceInstanceSubscribed(const std::string &aType, const std::string &aInstanceName) const;
+    void NotifyCachedServiceInstances(const std::string &aType, const std::string &aInstanceName);
+    void NotifyCachedHost(const std::string &aHostName);
+    void RemoveUnsubscribedServiceInstances(const std::string &aType);
+
     ServiceRegistrationMap mServiceRegistrations;
     HostRegistrationMap    mHostRegistrations;
     KeyRegistrationMap     mKeyRegistrations;
@@ -660,36 +1034,81 @@ protected:
     {
         DiscoverCallback(uint64_t                          aId,
                          DiscoveredServiceInstanceCallback aServiceCallback,
-                         DiscoveredHostCallback            aHostCallback)
+                         DiscoveredHostCallback            aHostCallback,
+                         const std::string                &aServiceType)
             : mId(aId)
             , mServiceCallback(std::move(aServiceCallback))
             , mHostCallback(std::move(aHostCallback))
-            , mShouldInvoke(false)
+            , mServiceType(aServiceType)
+            , mRemoved(false)
         {
         }
 
+        bool MatchesServiceType(const std::string &aType) const;
+
         uint64_t                          mId;
         DiscoveredServiceInstanceCallback mServiceCallback;
         DiscoveredHostCallback            mHostCallback;
-        bool                              mShouldInvoke;
+        std::string                       mServiceType;
+        bool                              mRemoved;
     };
 
     uint64_t mNextSubscriberId = 1;
 
+    // The callbacks are kept in the order of their Subscriber IDs. The callbacks removed while the callbacks are
+    // invoked are only marked as removed and erased afterwards, so that the iteration over the list remains valid.
     std::list<DiscoverCallback> mDiscoverCallbacks;
+    uint32_t                    mDiscoverCallbacksDepth = 0;
 
-    // {instance name, service type} -> the timepoint to begin service registration
-    std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
-    // host name -> the timepoint to begin host registration
-    std::map<std::string, Timepoint> mHostRegistrationBeginTime;
-    // key name -> the timepoint to begin key registration
-    std::map<std::string, Timepoint> mKeyRegistrationBeginTime;
     // {instance name, service type} -> the timepoint to begin service resolution
     std::map<std::pair<std::string, std::string>, Timepoint> mServiceInstanceResolutionBeginTime;
     // host name -> the timepoint to begin host resolution
     std::map<std::string, Timepoint> mHostResolutionBeginTime;
 
-    MdnsTelemetryInfo mTelemetryInfo{};
+    template <typename InfoType> struct CachedInfo
+    {
+        InfoType  mInfo;
+        Timepoint mExpireTime;
+
+        bool IsExpired(void) const { return Clock::now() >= mExpireTime; }
+    };
+
+    // Tells whether the results received on a network interface are within the interfaces set with
+    // `SetInterfaces()`.
+    bool IsInterfaceInScope(uint32_t aInterfaceIndex) const;
+
+    template <typename CacheType>
+    static bool HasRoomInCache(CacheType &aCache, const typename CacheType::key_type &aKey);
+
+    // {service type, instance name} -> the number of subscriptions
+    std::map<std::pair<std::string, std::string>, uint32_t> mServiceSubscriptionCounts;
+    // host name -> the number of subscriptions
+    std::map<std::string, uint32_t> mHostSubscriptionCounts;
+    // {service type, instance name} -> the last discovered service instance
+    std::map<std::pair<std::string, std::string>, CachedInfo<DiscoveredInstanceInfo>> mServiceInstanceCache;
+    // host name -> the last discovered host
+    std::map<std::string, CachedInfo<DiscoveredHostInfo>> mHostCache;
+    // {publication type, name} -> the timepoint when the name conflict expires
+    std::map<std::pair<PublicationType, std::string>, Timepoint> mConflictingNames;
+
+    // The pending publications of each priority, in the order they are requested.
+    std::list<PendingPublication> mPendingPublications[MdnsTelemetryInfo::kNumPublicationPriorities];
+    uint32_t                      mPublicationsPerSecond = kPublicationsPerSecond;
+    uint32_t                      mPublicationBurst      = kPublicationBurst;
+    uint32_t                      mPublicationTokens     = kPublicationBurst;
+    Timepoint                     mPublicationTokenTime;
+    bool                          mIsPublicationDispatchPosted = false;
+
+    // The sorted indexes of the network interfaces to publish and subscribe on, empty for all the interfaces.
+    std::vector<uint32_t> mInterfaces;
+
+    // Notifies the cached results of repeated subscriptions from the mainloop, as the subscribers may not expect
+    // their callbacks to be invoked while they subscribe. Also dispatches the paced publications.
+    TaskRunner mTaskRunner;
+
+    MdnsTelemetryInfo      mTelemetryInfo{};
+    ServiceDiscoveredEvent mServiceDiscoveredEvent;
+    HostDiscoveredEvent    mHostDiscoveredEvent;
 };
 
 /**
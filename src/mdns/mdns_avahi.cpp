@@ -36,6 +36,8 @@
 #include "mdns/mdns_avahi.hpp"
 
 #include <algorithm>
+#include <map>
+#include <unordered_map>
 
 #include <avahi-client/client.h>
 #include <avahi-common/alternative.h>
@@ -51,6 +53,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/time.hpp"
 
 namespace otbr {
@@ -86,6 +89,7 @@ struct AvahiWatch
     AvahiWatch(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext, AvahiPoller &aPoller)
         : mFd(aFd)
         , mEvents(aEvents)
+        , mHappened(0)
         , mCallback(aCallback)
         , mContext(aContext)
         , mShouldReport(false)
@@ -100,38 +104,36 @@ struct AvahiWatch
  */
 struct AvahiTimeout
 {
-    typedef otbr::Mdns::AvahiPoller AvahiPoller;
+    typedef otbr::Mdns::AvahiPoller                      AvahiPoller;
+    typedef std::multimap<otbr::Timepoint, AvahiTimeout *> TimerQueue;
 
-    otbr::Timepoint      mTimeout;      ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback;     ///< The function to be called when timeout.
-    void                *mContext;      ///< The pointer to application-specific context.
-    bool                 mShouldReport; ///< Whether or not timeout occurred and need to reported (invoking callback).
-    AvahiPoller         &mPoller;       ///< The poller created this timer.
+    otbr::Timepoint      mTimeout;    ///< Absolute time when this timer timeout.
+    AvahiTimeoutCallback mCallback;   ///< The function to be called when timeout.
+    void                *mContext;    ///< The pointer to application-specific context.
+    AvahiPoller         &mPoller;     ///< The poller created this timer.
+    TimerQueue::iterator mQueueEntry; ///< The entry in the timer queue of `mPoller`, valid only if armed.
 
     /**
      * The constructor to initialize an AvahiTimeout.
      *
-     * @param[in] aTimeout   A pointer to the time after which the callback should be called.
      * @param[in] aCallback  The function to be called after timeout.
      * @param[in] aContext   A pointer to application-specific context.
      * @param[in] aPoller    The AvahiPoller this timeout belongs to.
      *
      */
-    AvahiTimeout(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
-        : mCallback(aCallback)
+    AvahiTimeout(AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
+        : mTimeout(otbr::Timepoint::min())
+        , mCallback(aCallback)
         , mContext(aContext)
-        , mShouldReport(false)
         , mPoller(aPoller)
     {
-        if (aTimeout)
-        {
-            mTimeout = otbr::Clock::now() + otbr::FromTimeval<otbr::Microseconds>(*aTimeout);
-        }
-        else
-        {
-            mTimeout = otbr::Timepoint::min();
-        }
     }
+
+    /**
+     * This method tells whether the timer is armed.
+     *
+     */
+    bool IsArmed(void) const { return mTimeout != otbr::Timepoint::min(); }
 };
 
 namespace otbr {
@@ -174,6 +176,9 @@ static otbrError DnsErrorToOtbrError(int aAvahiError)
     return error;
 }
 
+// The watches are registered to the `MainloopManager`, so that their fds are only handed to the poll backend when
+// they change and their callbacks are only invoked when events happen. The armed timers are kept in a queue ordered by
+// their timeouts, so that only the earliest one is looked at in every mainloop iteration.
 class AvahiPoller : public MainloopProcessor
 {
 public:
@@ -183,12 +188,14 @@ public:
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "PublisherAvahi"; }
 
     const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoll; }
 
 private:
-    typedef std::vector<AvahiWatch *>   Watches;
-    typedef std::vector<AvahiTimeout *> Timers;
+    // Avahi may create different watches for the same fd, e.g. for reading and writing a D-Bus connection.
+    typedef std::unordered_map<int, std::vector<AvahiWatch *>> Watches;
+    typedef AvahiTimeout::TimerQueue                           Timers;
 
     static AvahiWatch     *WatchNew(const struct AvahiPoll *aPoll,
                                     int                     aFd,
@@ -206,9 +213,13 @@ private:
                                       void                 *aContext);
     AvahiTimeout          *TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext);
     static void            TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout);
+    void                   TimeoutUpdate(AvahiTimeout &aTimer, const struct timeval *aTimeout);
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
 
+    void UpdateFdEvents(int aFd);
+    void HandleFdEvents(int aFd, uint8_t aEvents);
+
     Watches   mWatches;
     Timers    mTimers;
     AvahiPoll mAvahiPoll;
@@ -238,16 +249,28 @@ AvahiWatch *AvahiPoller::WatchNew(const struct AvahiPoll *aPoll,
 
 AvahiWatch *AvahiPoller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback aCallback, void *aContext)
 {
+    AvahiWatch *watch;
+
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, *this));
+    watch = new AvahiWatch(aFd, aEvent, aCallback, aContext, *this);
+
+    if (mWatches[aFd].empty())
+    {
+        MainloopManager::GetInstance().AddFd(
+            aFd, /* aEvents */ 0, [this, aFd](uint8_t aEvents) { HandleFdEvents(aFd, aEvents); }, GetName());
+    }
+
+    mWatches[aFd].push_back(watch);
+    UpdateFdEvents(aFd);
 
-    return mWatches.back();
+    return watch;
 }
 
 void AvahiPoller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
 {
     aWatch->mEvents = aEvent;
+    aWatch->mPoller.UpdateFdEvents(aWatch->mFd);
 }
 
 AvahiWatchEvent AvahiPoller::WatchGetEvents(AvahiWatch *aWatch)
@@ -262,147 +285,64 @@ void AvahiPoller::WatchFree(AvahiWatch *aWatch)
 
 void AvahiPoller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
-    {
-        if (*it == &aWatch)
-        {
-            mWatches.erase(it);
-            delete &aWatch;
-            break;
-        }
-    }
-}
+    int                        fd      = aWatch.mFd;
+    std::vector<AvahiWatch *> &watches = mWatches[fd];
 
-AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
-                                      const struct timeval *aTimeout,
-                                      AvahiTimeoutCallback  aCallback,
-                                      void                 *aContext)
-{
-    assert(aPoll && aCallback);
-    return static_cast<AvahiPoller *>(aPoll->userdata)->TimeoutNew(aTimeout, aCallback, aContext);
-}
+    watches.erase(std::remove(watches.begin(), watches.end(), &aWatch), watches.end());
+    delete &aWatch;
 
-AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
-{
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, *this));
-    return mTimers.back();
-}
-
-void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
-{
-    if (aTimeout == nullptr)
+    if (watches.empty())
     {
-        aTimer->mTimeout = Timepoint::min();
+        MainloopManager::GetInstance().RemoveFd(fd);
+        mWatches.erase(fd);
     }
     else
     {
-        aTimer->mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        UpdateFdEvents(fd);
     }
 }
 
-void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
+void AvahiPoller::UpdateFdEvents(int aFd)
 {
-    aTimer->mPoller.TimeoutFree(*aTimer);
-}
+    uint8_t events = 0;
 
-void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
-{
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    for (const AvahiWatch *watch : mWatches[aFd])
     {
-        if (*it == &aTimer)
+        if (AVAHI_WATCH_IN & watch->mEvents)
         {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
+            events |= MainloopManager::kEventReadable;
         }
-    }
-}
 
-void AvahiPoller::Update(MainloopContext &aMainloop)
-{
-    Timepoint now = Clock::now();
-
-    for (AvahiWatch *watch : mWatches)
-    {
-        int             fd     = watch->mFd;
-        AvahiWatchEvent events = watch->mEvents;
-
-        if (AVAHI_WATCH_IN & events)
-        {
-            FD_SET(fd, &aMainloop.mReadFdSet);
-        }
-
-        if (AVAHI_WATCH_OUT & events)
+        if (AVAHI_WATCH_OUT & watch->mEvents)
         {
-            FD_SET(fd, &aMainloop.mWriteFdSet);
+            events |= MainloopManager::kEventWritable;
         }
-
-        if (AVAHI_WATCH_ERR & events)
-        {
-            FD_SET(fd, &aMainloop.mErrorFdSet);
-        }
-
-        if (AVAHI_WATCH_HUP & events)
-        {
-            // TODO what do with this event type?
-        }
-
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
-
-        watch->mHappened = 0;
     }
 
-    for (AvahiTimeout *timer : mTimers)
-    {
-        Timepoint timeout = timer->mTimeout;
-
-        if (timeout == Timepoint::min())
-        {
-            continue;
-        }
-
-        if (timeout <= now)
-        {
-            aMainloop.mTimeout = ToTimeval(Microseconds::zero());
-            break;
-        }
-        else
-        {
-            auto delay = std::chrono::duration_cast<Microseconds>(timeout - now);
-
-            if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
-            {
-                aMainloop.mTimeout = ToTimeval(delay);
-            }
-        }
-    }
+    MainloopManager::GetInstance().UpdateFd(aFd, events);
 }
 
-void AvahiPoller::Process(const MainloopContext &aMainloop)
+void AvahiPoller::HandleFdEvents(int aFd, uint8_t aEvents)
 {
-    Timepoint now          = Clock::now();
-    bool      shouldReport = false;
+    bool shouldReport = false;
 
-    for (AvahiWatch *watch : mWatches)
+    for (AvahiWatch *watch : mWatches[aFd])
     {
-        int             fd     = watch->mFd;
-        AvahiWatchEvent events = watch->mEvents;
-
         watch->mHappened = 0;
 
-        if ((AVAHI_WATCH_IN & events) && FD_ISSET(fd, &aMainloop.mReadFdSet))
+        if ((AVAHI_WATCH_IN & watch->mEvents) && (aEvents & MainloopManager::kEventReadable))
         {
             watch->mHappened |= AVAHI_WATCH_IN;
         }
 
-        if ((AVAHI_WATCH_OUT & events) && FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        if ((AVAHI_WATCH_OUT & watch->mEvents) && (aEvents & MainloopManager::kEventWritable))
         {
             watch->mHappened |= AVAHI_WATCH_OUT;
         }
 
-        if ((AVAHI_WATCH_ERR & events) && FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if (aEvents & MainloopManager::kEventError)
         {
-            watch->mHappened |= AVAHI_WATCH_ERR;
+            watch->mHappened |= (watch->mEvents & (AVAHI_WATCH_ERR | AVAHI_WATCH_HUP));
         }
 
         if (watch->mHappened != 0)
@@ -412,19 +352,22 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
         }
     }
 
-    // When we invoke the callback for an `AvahiWatch` or `AvahiTimeout`,
-    // the Avahi module can call any of `mAvahiPoll` APIs we provided to
-    // it. For example, it can update or free any of `AvahiWatch/Timeout`
-    // entries, which in turn, modifies our `mWatches` or `mTimers` list.
-    // So, before invoking the callback, we update the entry's state and
-    // then restart the iteration over the `mWacthes` list to find the
-    // next entry to report, as the list may have changed.
+    // When we invoke the callback for an `AvahiWatch`, the Avahi module
+    // can call any of `mAvahiPoll` APIs we provided to it. For example,
+    // it can update or free any of `AvahiWatch` entries, which in turn,
+    // modifies our `mWatches` list. So, before invoking the callback, we
+    // update the entry's state and then restart the iteration over the
+    // watches of the fd to find the next entry to report, as the list may
+    // have changed.
 
     while (shouldReport)
     {
+        auto it = mWatches.find(aFd);
+
         shouldReport = false;
+        VerifyOrExit(it != mWatches.end());
 
-        for (AvahiWatch *watch : mWatches)
+        for (AvahiWatch *watch : it->second)
         {
             if (watch->mShouldReport)
             {
@@ -437,36 +380,108 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
         }
     }
 
-    for (AvahiTimeout *timer : mTimers)
+exit:
+    return;
+}
+
+AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
+                                      const struct timeval *aTimeout,
+                                      AvahiTimeoutCallback  aCallback,
+                                      void                 *aContext)
+{
+    assert(aPoll && aCallback);
+    return static_cast<AvahiPoller *>(aPoll->userdata)->TimeoutNew(aTimeout, aCallback, aContext);
+}
+
+AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
+{
+    AvahiTimeout *timer = new AvahiTimeout(aCallback, aContext, *this);
+
+    TimeoutUpdate(*timer, aTimeout);
+
+    return timer;
+}
+
+void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
+{
+    aTimer->mPoller.TimeoutUpdate(*aTimer, aTimeout);
+}
+
+void AvahiPoller::TimeoutUpdate(AvahiTimeout &aTimer, const struct timeval *aTimeout)
+{
+    if (aTimer.IsArmed())
     {
-        if (timer->mTimeout == Timepoint::min())
-        {
-            continue;
-        }
+        mTimers.erase(aTimer.mQueueEntry);
+    }
 
-        if (timer->mTimeout <= now)
-        {
-            timer->mShouldReport = true;
-            shouldReport         = true;
-        }
+    if (aTimeout == nullptr)
+    {
+        aTimer.mTimeout = Timepoint::min();
     }
+    else
+    {
+        aTimer.mTimeout    = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        aTimer.mQueueEntry = mTimers.emplace(aTimer.mTimeout, &aTimer);
+    }
+}
 
-    while (shouldReport)
+void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
+{
+    aTimer->mPoller.TimeoutFree(*aTimer);
+}
+
+void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
+{
+    if (aTimer.IsArmed())
     {
-        shouldReport = false;
+        mTimers.erase(aTimer.mQueueEntry);
+    }
 
-        for (AvahiTimeout *timer : mTimers)
-        {
-            if (timer->mShouldReport)
-            {
-                shouldReport         = true;
-                timer->mShouldReport = false;
-                timer->mCallback(timer, timer->mContext);
+    delete &aTimer;
+}
 
-                break;
-            }
+void AvahiPoller::Update(MainloopContext &aMainloop)
+{
+    Timepoint now = Clock::now();
+
+    VerifyOrExit(!mTimers.empty());
+
+    if (mTimers.begin()->first <= now)
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+    else
+    {
+        auto delay = std::chrono::duration_cast<Microseconds>(mTimers.begin()->first - now);
+
+        if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+        {
+            aMainloop.mTimeout = ToTimeval(delay);
         }
     }
+
+exit:
+    return;
+}
+
+void AvahiPoller::Process(const MainloopContext &aMainloop)
+{
+    Timepoint now = Clock::now();
+
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    // A timer is disarmed before its callback is invoked, the callback
+    // can re-arm or free it and any other timer, so the earliest timer
+    // is looked up again each time.
+
+    while (!mTimers.empty() && mTimers.begin()->first <= now)
+    {
+        AvahiTimeout *timer = mTimers.begin()->second;
+
+        mTimers.erase(mTimers.begin());
+        timer->mTimeout = Timepoint::min();
+        timer->mCallback(timer, timer->mContext);
+    }
 }
 
 PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
@@ -484,17 +499,17 @@ PublisherAvahi::~PublisherAvahi(void)
 
 PublisherAvahi::AvahiServiceRegistration::~AvahiServiceRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->ReleaseGroup(mEntryGroup);
 }
 
 PublisherAvahi::AvahiHostRegistration::~AvahiHostRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->ReleaseGroup(mEntryGroup);
 }
 
 PublisherAvahi::AvahiKeyRegistration::~AvahiKeyRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->ReleaseGroup(mEntryGroup);
 }
 
 otbrError PublisherAvahi::Start(void)
@@ -524,9 +539,12 @@ void PublisherAvahi::Stop(void)
 {
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
+    mBatchGroupRefCounts.clear();
+    mGroupsToRebuild.clear();
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
+    ClearSubscriptions();
 
     if (mClient)
     {
@@ -571,57 +589,111 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
     case AVAHI_ENTRY_GROUP_REGISTERING:
         break;
     }
+
+    RebuildGroups();
 }
 
 void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError)
 {
-    ServiceRegistration *serviceReg;
-    HostRegistration    *hostReg;
-    KeyRegistration     *keyReg;
+    std::vector<std::pair<std::string, std::string>> serviceNames;
+    std::vector<std::string>                         hostNames;
+    std::vector<std::string>                         keyNames;
+
+    // The group of a host batch is shared by the registrations of the host, its services and key records. They are
+    // looked up again by name before completing each of them, since the callbacks may remove any registration.
+    for (const auto &kv : mServiceRegistrations)
+    {
+        if (static_cast<const AvahiServiceRegistration &>(*kv.second).GetEntryGroup() == aGroup)
+        {
+            serviceNames.emplace_back(kv.second->mName, kv.second->mType);
+        }
+    }
+
+    for (const auto &kv : mHostRegistrations)
+    {
+        if (static_cast<const AvahiHostRegistration &>(*kv.second).GetEntryGroup() == aGroup)
+        {
+            hostNames.push_back(kv.second->mName);
+        }
+    }
 
-    if ((serviceReg = FindServiceRegistration(aGroup)) != nullptr)
+    for (const auto &kv : mKeyRegistrations)
     {
+        if (static_cast<const AvahiKeyRegistration &>(*kv.second).GetEntryGroup() == aGroup)
+        {
+            keyNames.push_back(kv.second->mName);
+        }
+    }
+
+    if (serviceNames.empty() && hostNames.empty() && keyNames.empty())
+    {
+        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
+    }
+
+    for (const auto &name : serviceNames)
+    {
+        auto *serviceReg = static_cast<AvahiServiceRegistration *>(FindServiceRegistration(name.first, name.second));
+
+        if (serviceReg == nullptr || serviceReg->GetEntryGroup() != aGroup)
+        {
+            continue;
+        }
+
         if (aError == OTBR_ERROR_NONE)
         {
             serviceReg->Complete(aError);
         }
         else
         {
-            RemoveServiceRegistration(serviceReg->mName, serviceReg->mType, aError);
+            RemoveServiceRegistration(name.first, name.second, aError);
         }
     }
-    else if ((hostReg = FindHostRegistration(aGroup)) != nullptr)
+
+    for (const auto &name : hostNames)
     {
+        auto *hostReg = static_cast<AvahiHostRegistration *>(FindHostRegistration(name));
+
+        if (hostReg == nullptr || hostReg->GetEntryGroup() != aGroup)
+        {
+            continue;
+        }
+
         if (aError == OTBR_ERROR_NONE)
         {
             hostReg->Complete(aError);
         }
         else
         {
-            RemoveHostRegistration(hostReg->mName, aError);
+            RemoveHostRegistration(name, aError);
         }
     }
-    else if ((keyReg = FindKeyRegistration(aGroup)) != nullptr)
+
+    for (const auto &name : keyNames)
     {
+        auto *keyReg = static_cast<AvahiKeyRegistration *>(FindKeyRegistration(name));
+
+        if (keyReg == nullptr || keyReg->GetEntryGroup() != aGroup)
+        {
+            continue;
+        }
+
         if (aError == OTBR_ERROR_NONE)
         {
             keyReg->Complete(aError);
         }
         else
         {
-            RemoveKeyRegistration(keyReg->mName, aError);
+            RemoveKeyRegistration(name, aError);
         }
     }
-    else
-    {
-        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
-    }
 }
 
 AvahiEntryGroup *PublisherAvahi::CreateGroup(AvahiClient *aClient)
 {
     AvahiEntryGroup *group = avahi_entry_group_new(aClient, HandleGroupState, this);
 
+    CountDaemonRequest();
+
     if (group == nullptr)
     {
         otbrLogErr("Failed to create entry avahi group: %s", avahi_strerror(avahi_client_errno(aClient)));
@@ -632,10 +704,25 @@ AvahiEntryGroup *PublisherAvahi::CreateGroup(AvahiClient *aClient)
 
 void PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
 {
-    int error;
+    int  error;
+    auto it = mBatchGroupRefCounts.find(aGroup);
+
+    if (it != mBatchGroupRefCounts.end())
+    {
+        // A shared group is released with its last registration, the records of the others are added again.
+        if (--it->second > 0)
+        {
+            mGroupsToRebuild.insert(aGroup);
+            ExitNow();
+        }
+
+        mBatchGroupRefCounts.erase(it);
+        mGroupsToRebuild.erase(aGroup);
+    }
 
     otbrLogInfo("Releasing avahi entry group @%p", aGroup);
 
+    CountDaemonRequest();
     error = avahi_entry_group_reset(aGroup);
 
     if (error != 0)
@@ -643,11 +730,213 @@ void PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
         otbrLogErr("Failed to reset entry group for avahi error: %s", avahi_strerror(error));
     }
 
+    CountDaemonRequest();
     error = avahi_entry_group_free(aGroup);
     if (error != 0)
     {
         otbrLogErr("Failed to free entry group for avahi error: %s", avahi_strerror(error));
     }
+
+exit:
+    return;
+}
+
+void PublisherAvahi::RebuildGroups(void)
+{
+    std::set<AvahiEntryGroup *> groups;
+
+    groups.swap(mGroupsToRebuild);
+    VerifyOrExit(mState == State::kReady);
+
+    for (AvahiEntryGroup *group : groups)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        if (mBatchGroupRefCounts.find(group) == mBatchGroupRefCounts.end())
+        {
+            // Released while rebuilding the previous groups.
+            continue;
+        }
+
+        otbrLogInfo("Rebuilding avahi entry group @%p", group);
+        CountDaemonRequest();
+        if (avahi_entry_group_reset(group) != AVAHI_OK)
+        {
+            error = OTBR_ERROR_MDNS;
+        }
+
+        for (const auto &kv : mHostRegistrations)
+        {
+            const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
+
+            if (hostReg.GetEntryGroup() == group && error == OTBR_ERROR_NONE)
+            {
+                error = AddHostToGroup(group, hostReg.mName, hostReg.mAddresses);
+            }
+        }
+
+        for (const auto &kv : mServiceRegistrations)
+        {
+            const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
+
+            if (serviceReg.GetEntryGroup() == group && error == OTBR_ERROR_NONE)
+            {
+                error = AddServiceToGroup(group, serviceReg.mHostName, serviceReg.mName, serviceReg.mType,
+                                          serviceReg.mSubTypeList, serviceReg.mPort, serviceReg.mTxtData);
+            }
+        }
+
+        for (const auto &kv : mKeyRegistrations)
+        {
+            const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*kv.second);
+
+            if (keyReg.GetEntryGroup() == group && error == OTBR_ERROR_NONE)
+            {
+                error = AddKeyToGroup(group, keyReg.mName, keyReg.mKeyData);
+            }
+        }
+
+        if (error == OTBR_ERROR_NONE)
+        {
+            CountDaemonRequest();
+            if (avahi_entry_group_commit(group) != AVAHI_OK)
+            {
+                error = OTBR_ERROR_MDNS;
+            }
+        }
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogErr("Failed to rebuild avahi entry group @%p", group);
+            CallHostOrServiceCallback(group, error);
+        }
+    }
+
+exit:
+    return;
+}
+
+otbrError PublisherAvahi::AddServiceToGroup(AvahiEntryGroup   *aGroup,
+                                            const std::string &aHostName,
+                                            const std::string &aName,
+                                            const std::string &aType,
+                                            const SubTypeList &aSubTypeList,
+                                            uint16_t           aPort,
+                                            const TxtData     &aTxtData)
+{
+    otbrError   error      = OTBR_ERROR_NONE;
+    int         avahiError = AVAHI_OK;
+    std::string fullHostName;
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    if (!aHostName.empty())
+    {
+        fullHostName = MakeFullHostName(aHostName);
+    }
+
+    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
+
+    for (AvahiIfIndex ifIndex : GetPublishInterfaces())
+    {
+        CountDaemonRequest();
+        avahiError = avahi_entry_group_add_service_strlst(aGroup, ifIndex, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
+                                                          aName.c_str(), aType.c_str(),
+                                                          /* domain */ nullptr, fullHostName.c_str(), aPort, txtHead);
+        VerifyOrExit(avahiError == AVAHI_OK);
+
+        for (const std::string &subType : aSubTypeList)
+        {
+            otbrLogInfo("Add subtype %s for service %s.%s", subType.c_str(), aName.c_str(), aType.c_str());
+            std::string fullSubType = subType + "._sub." + aType;
+            CountDaemonRequest();
+            avahiError = avahi_entry_group_add_service_subtype(aGroup, ifIndex, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
+                                                               aName.c_str(), aType.c_str(), /* domain */ nullptr,
+                                                               fullSubType.c_str());
+            VerifyOrExit(avahiError == AVAHI_OK);
+        }
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to add service %s.%s for avahi error: %s!", aName.c_str(), aType.c_str(),
+                   avahi_strerror(avahiError));
+    }
+    return error;
+}
+
+otbrError PublisherAvahi::AddHostToGroup(AvahiEntryGroup   *aGroup,
+                                         const std::string &aName,
+                                         const AddressList &aAddresses)
+{
+    int         avahiError   = AVAHI_OK;
+    std::string fullHostName = MakeFullHostName(aName);
+
+    for (AvahiIfIndex ifIndex : GetPublishInterfaces())
+    {
+        for (const auto &address : aAddresses)
+        {
+            AvahiAddress avahiAddress;
+
+            avahiAddress.proto = AVAHI_PROTO_INET6;
+            memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
+            CountDaemonRequest();
+            avahiError = avahi_entry_group_add_address(aGroup, ifIndex, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
+                                                       fullHostName.c_str(), &avahiAddress);
+            VerifyOrExit(avahiError == AVAHI_OK);
+        }
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogErr("Failed to add host %s for avahi error: %s!", aName.c_str(), avahi_strerror(avahiError));
+    }
+    return avahiError == AVAHI_OK ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
+}
+
+otbrError PublisherAvahi::AddKeyToGroup(AvahiEntryGroup *aGroup, const std::string &aName, const KeyData &aKeyData)
+{
+    int         avahiError  = AVAHI_OK;
+    std::string fullKeyName = MakeFullKeyName(aName);
+
+    for (AvahiIfIndex ifIndex : GetPublishInterfaces())
+    {
+        CountDaemonRequest();
+        avahiError = avahi_entry_group_add_record(aGroup, ifIndex, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_UNIQUE,
+                                                  fullKeyName.c_str(), AVAHI_DNS_CLASS_IN, kDnsKeyRecordType,
+                                                  kDefaultTtl, aKeyData.data(), aKeyData.size());
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogErr("Failed to add key record %s for avahi error: %s!", aName.c_str(), avahi_strerror(avahiError));
+    }
+    return avahiError == AVAHI_OK ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
+}
+
+std::vector<AvahiIfIndex> PublisherAvahi::GetPublishInterfaces(void) const
+{
+    std::vector<AvahiIfIndex> interfaces(GetInterfaces().begin(), GetInterfaces().end());
+
+    if (interfaces.empty())
+    {
+        interfaces.push_back(AVAHI_IF_UNSPEC);
+    }
+
+    return interfaces;
+}
+
+AvahiIfIndex PublisherAvahi::GetQueryInterface(void) const
+{
+    // A browser or resolver runs on a single interface or on all of them.
+    return GetInterfaces().size() == 1 ? static_cast<AvahiIfIndex>(GetInterfaces().front()) : AVAHI_IF_UNSPEC;
 }
 
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
@@ -703,25 +992,15 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                              const TxtData     &aTxtData,
                                              ResultCallback   &&aCallback)
 {
-    otbrError         error             = OTBR_ERROR_NONE;
-    int               avahiError        = AVAHI_OK;
-    SubTypeList       sortedSubTypeList = SortSubTypeList(aSubTypeList);
-    const std::string logHostName       = !aHostName.empty() ? aHostName : "localhost";
-    std::string       fullHostName;
-    std::string       serviceName = aName;
-    AvahiEntryGroup  *group       = nullptr;
-
-    // Aligned with AvahiStringList
-    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
-    AvahiStringList *txtHead = nullptr;
+    otbrError        error             = OTBR_ERROR_NONE;
+    int              avahiError        = AVAHI_OK;
+    SubTypeList      sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    std::string      serviceName       = aName;
+    AvahiEntryGroup *group             = nullptr;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
 
-    if (!aHostName.empty())
-    {
-        fullHostName = MakeFullHostName(aHostName);
-    }
     if (serviceName.empty())
     {
         serviceName = avahi_client_get_host_name(mClient);
@@ -731,24 +1010,11 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                                    std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
-    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
     VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
-    avahiError = avahi_entry_group_add_service_strlst(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
-                                                      serviceName.c_str(), aType.c_str(),
-                                                      /* domain */ nullptr, fullHostName.c_str(), aPort, txtHead);
-    VerifyOrExit(avahiError == AVAHI_OK);
-
-    for (const std::string &subType : aSubTypeList)
-    {
-        otbrLogInfo("Add subtype %s for service %s.%s", subType.c_str(), serviceName.c_str(), aType.c_str());
-        std::string fullSubType = subType + "._sub." + aType;
-        avahiError              = avahi_entry_group_add_service_subtype(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
-                                                                        AvahiPublishFlags{}, serviceName.c_str(), aType.c_str(),
-                                                                        /* domain */ nullptr, fullSubType.c_str());
-        VerifyOrExit(avahiError == AVAHI_OK);
-    }
+    SuccessOrExit(error = AddServiceToGroup(group, aHostName, serviceName, aType, aSubTypeList, aPort, aTxtData));
 
     otbrLogInfo("Commit avahi service %s.%s", serviceName.c_str(), aType.c_str());
+    CountDaemonRequest();
     avahiError = avahi_entry_group_commit(group);
     VerifyOrExit(avahiError == AVAHI_OK);
 
@@ -770,15 +1036,83 @@ exit:
         }
         std::move(aCallback)(error);
     }
+    RebuildGroups();
+    return error;
+}
+
+otbrError PublisherAvahi::UpdateServiceTxtDataImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    otbrError                 error      = OTBR_ERROR_NONE;
+    int                       avahiError = AVAHI_OK;
+    AvahiServiceRegistration &serviceReg = static_cast<AvahiServiceRegistration &>(aServiceReg);
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
+
+    for (AvahiIfIndex ifIndex : GetPublishInterfaces())
+    {
+        CountDaemonRequest();
+        avahiError = avahi_entry_group_update_service_txt_strlst(
+            serviceReg.GetEntryGroup(), ifIndex, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{}, serviceReg.mName.c_str(),
+            serviceReg.mType.c_str(), /* domain */ nullptr, txtHead);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogErr("Failed to update TXT data of service %s.%s for avahi error: %s!", serviceReg.mName.c_str(),
+                   serviceReg.mType.c_str(), avahi_strerror(avahiError));
+    }
     return error;
 }
 
-void PublisherAvahi::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+otbrError PublisherAvahi::UpdateHostAddressesImpl(HostRegistration &aHostReg, const AddressList &aAddresses)
+{
+    otbrError              error   = OTBR_ERROR_NONE;
+    AvahiHostRegistration &hostReg = static_cast<AvahiHostRegistration &>(aHostReg);
+    AddressList            addedAddresses;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    // An entry group can only be reset as a whole, so a removed address needs the host to be registered again. The
+    // added addresses are appended to the committed group and are probed alone.
+    for (const Ip6Address &address : hostReg.mAddresses)
+    {
+        VerifyOrExit(std::find(aAddresses.begin(), aAddresses.end(), address) != aAddresses.end(),
+                     error = OTBR_ERROR_NOT_IMPLEMENTED);
+    }
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        if (std::find(hostReg.mAddresses.begin(), hostReg.mAddresses.end(), address) == hostReg.mAddresses.end())
+        {
+            addedAddresses.push_back(address);
+        }
+    }
+
+    SuccessOrExit(error = AddHostToGroup(hostReg.GetEntryGroup(), hostReg.mName, addedAddresses));
+    otbrLogInfo("Added %zu addresses to avahi host %s", addedAddresses.size(), hostReg.mName.c_str());
+
+exit:
+    return error;
+}
+
+void PublisherAvahi::UnpublishServiceImpl(const std::string &aName,
+                                          const std::string &aType,
+                                          ResultCallback   &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+    RebuildGroups();
 
 exit:
     std::move(aCallback)(error);
@@ -790,8 +1124,7 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string &aName,
 {
     otbrError        error      = OTBR_ERROR_NONE;
     int              avahiError = AVAHI_OK;
-    std::string      fullHostName;
-    AvahiEntryGroup *group = nullptr;
+    AvahiEntryGroup *group      = nullptr;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
@@ -801,20 +1134,10 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string &aName,
     VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
 
     VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
-
-    fullHostName = MakeFullHostName(aName);
-    for (const auto &address : aAddresses)
-    {
-        AvahiAddress avahiAddress;
-
-        avahiAddress.proto = AVAHI_PROTO_INET6;
-        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
-        avahiError = avahi_entry_group_add_address(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
-                                                   fullHostName.c_str(), &avahiAddress);
-        VerifyOrExit(avahiError == AVAHI_OK);
-    }
+    SuccessOrExit(error = AddHostToGroup(group, aName, aAddresses));
 
     otbrLogInfo("Commit avahi host %s", aName.c_str());
+    CountDaemonRequest();
     avahiError = avahi_entry_group_commit(group);
     VerifyOrExit(avahiError == AVAHI_OK);
 
@@ -836,15 +1159,17 @@ exit:
         }
         std::move(aCallback)(error);
     }
+    RebuildGroups();
     return error;
 }
 
-void PublisherAvahi::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+void PublisherAvahi::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+    RebuildGroups();
 
 exit:
     std::move(aCallback)(error);
@@ -854,8 +1179,7 @@ otbrError PublisherAvahi::PublishKeyImpl(const std::string &aName, const KeyData
 {
     otbrError        error      = OTBR_ERROR_NONE;
     int              avahiError = AVAHI_OK;
-    std::string      fullKeyName;
-    AvahiEntryGroup *group = nullptr;
+    AvahiEntryGroup *group      = nullptr;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
@@ -864,15 +1188,10 @@ otbrError PublisherAvahi::PublishKeyImpl(const std::string &aName, const KeyData
     VerifyOrExit(!aCallback.IsNull());
 
     VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
-
-    fullKeyName = MakeFullKeyName(aName);
-
-    avahiError = avahi_entry_group_add_record(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_UNIQUE,
-                                              fullKeyName.c_str(), AVAHI_DNS_CLASS_IN, kDnsKeyRecordType, kDefaultTtl,
-                                              aKeyData.data(), aKeyData.size());
-    VerifyOrExit(avahiError == AVAHI_OK);
+    SuccessOrExit(error = AddKeyToGroup(group, aName, aKeyData));
 
     otbrLogInfo("Commit avahi key record for %s", aName.c_str());
+    CountDaemonRequest();
     avahiError = avahi_entry_group_commit(group);
     VerifyOrExit(avahiError == AVAHI_OK);
 
@@ -894,20 +1213,159 @@ exit:
         }
         std::move(aCallback)(error);
     }
+    RebuildGroups();
     return error;
 }
 
-void PublisherAvahi::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+void PublisherAvahi::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveKeyRegistration(aName, OTBR_ERROR_ABORTED);
+    RebuildGroups();
 
 exit:
     std::move(aCallback)(error);
 }
 
+void PublisherAvahi::PublishHostBatchImpl(HostBatch &&aBatch)
+{
+    otbrError        error       = OTBR_ERROR_NONE;
+    int              avahiError  = AVAHI_OK;
+    AvahiEntryGroup *group       = nullptr;
+    size_t           recordCount = 0;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
+
+    // The records which are already registered are left out of the group, the same as publishing them one by one.
+    aBatch.mHostCallback =
+        HandleDuplicateHostRegistration(aBatch.mHostName, aBatch.mAddresses, std::move(aBatch.mHostCallback));
+    if (!aBatch.mHostCallback.IsNull() && aBatch.mAddresses.empty())
+    {
+        std::move(aBatch.mHostCallback)(OTBR_ERROR_NONE);
+    }
+    recordCount += aBatch.mHostCallback.IsNull() ? 0 : 1;
+
+    for (BatchService &service : aBatch.mServices)
+    {
+        if (service.mName.empty())
+        {
+            service.mName = avahi_client_get_host_name(mClient);
+        }
+        service.mSubTypeList = SortSubTypeList(std::move(service.mSubTypeList));
+        service.mCallback =
+            HandleDuplicateServiceRegistration(aBatch.mHostName, service.mName, service.mType, service.mSubTypeList,
+                                               service.mPort, service.mTxtData, std::move(service.mCallback));
+        recordCount += service.mCallback.IsNull() ? 0 : 1;
+    }
+
+    for (BatchKey &key : aBatch.mKeys)
+    {
+        key.mCallback = HandleDuplicateKeyRegistration(key.mName, key.mKeyData, std::move(key.mCallback));
+        recordCount += key.mCallback.IsNull() ? 0 : 1;
+    }
+
+    VerifyOrExit(recordCount > 0);
+    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
+
+    if (!aBatch.mHostCallback.IsNull())
+    {
+        SuccessOrExit(error = AddHostToGroup(group, aBatch.mHostName, aBatch.mAddresses));
+    }
+
+    for (const BatchService &service : aBatch.mServices)
+    {
+        if (!service.mCallback.IsNull())
+        {
+            SuccessOrExit(error = AddServiceToGroup(group, aBatch.mHostName, service.mName, service.mType,
+                                                    service.mSubTypeList, service.mPort, service.mTxtData));
+        }
+    }
+
+    for (const BatchKey &key : aBatch.mKeys)
+    {
+        if (!key.mCallback.IsNull())
+        {
+            SuccessOrExit(error = AddKeyToGroup(group, key.mName, key.mKeyData));
+        }
+    }
+
+    otbrLogInfo("Commit avahi host %s with %zu records", aBatch.mHostName.c_str(), recordCount);
+    CountDaemonRequest();
+    avahiError = avahi_entry_group_commit(group);
+    VerifyOrExit(avahiError == AVAHI_OK);
+
+    if (recordCount > 1)
+    {
+        mBatchGroupRefCounts[group] = recordCount;
+    }
+
+    if (!aBatch.mHostCallback.IsNull())
+    {
+        AddHostRegistration(std::unique_ptr<AvahiHostRegistration>(new AvahiHostRegistration(
+            aBatch.mHostName, aBatch.mAddresses, std::move(aBatch.mHostCallback), group, this)));
+    }
+
+    for (BatchService &service : aBatch.mServices)
+    {
+        if (!service.mCallback.IsNull())
+        {
+            AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
+                aBatch.mHostName, service.mName, service.mType, service.mSubTypeList, service.mPort, service.mTxtData,
+                std::move(service.mCallback), group, this)));
+        }
+    }
+
+    for (BatchKey &key : aBatch.mKeys)
+    {
+        if (!key.mCallback.IsNull())
+        {
+            AddKeyRegistration(std::unique_ptr<AvahiKeyRegistration>(
+                new AvahiKeyRegistration(key.mName, key.mKeyData, std::move(key.mCallback), group, this)));
+        }
+    }
+
+exit:
+    if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
+    {
+        if (avahiError != AVAHI_OK)
+        {
+            error = OTBR_ERROR_MDNS;
+            otbrLogErr("Failed to publish host batch for avahi error: %s!", avahi_strerror(avahiError));
+        }
+
+        if (group != nullptr)
+        {
+            ReleaseGroup(group);
+        }
+
+        if (!aBatch.mHostCallback.IsNull())
+        {
+            UpdateMdnsResponseCounters(mTelemetryInfo.mHostRegistrations, error);
+            std::move(aBatch.mHostCallback)(error);
+        }
+        for (BatchService &service : aBatch.mServices)
+        {
+            if (!service.mCallback.IsNull())
+            {
+                UpdateMdnsResponseCounters(mTelemetryInfo.mServiceRegistrations, error);
+                std::move(service.mCallback)(error);
+            }
+        }
+        for (BatchKey &key : aBatch.mKeys)
+        {
+            if (!key.mCallback.IsNull())
+            {
+                UpdateMdnsResponseCounters(mTelemetryInfo.mKeyRegistrations, error);
+                std::move(key.mCallback)(error);
+            }
+        }
+    }
+    RebuildGroups();
+}
+
 otbrError PublisherAvahi::TxtDataToAvahiStringList(const TxtData    &aTxtData,
                                                    AvahiStringList  *aBuffer,
                                                    size_t            aBufferSize,
@@ -955,62 +1413,12 @@ exit:
     return error;
 }
 
-Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    ServiceRegistration *result = nullptr;
-
-    for (const auto &kv : mServiceRegistrations)
-    {
-        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
-        if (serviceReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    HostRegistration *result = nullptr;
-
-    for (const auto &kv : mHostRegistrations)
-    {
-        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
-        if (hostReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-Publisher::KeyRegistration *PublisherAvahi::FindKeyRegistration(const AvahiEntryGroup *aEntryGroup)
+otbrError PublisherAvahi::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    KeyRegistration *result = nullptr;
-
-    for (const auto &entry : mKeyRegistrations)
-    {
-        const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*entry.second);
-        if (keyReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = entry.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
+    otbrError error   = OTBR_ERROR_NONE;
+    auto      service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
 
-void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
-{
-    auto service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
-
-    VerifyOrExit(mState == Publisher::State::kReady);
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedServices.push_back(std::move(service));
 
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -1022,14 +1430,14 @@ void PublisherAvahi::SubscribeService(const std::string &aType, const std::strin
     }
     else
     {
-        mSubscribedServices.back()->Resolve(AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, aInstanceName, aType);
+        mSubscribedServices.back()->Resolve(GetQueryInterface(), AVAHI_PROTO_UNSPEC, aInstanceName, aType);
     }
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherAvahi::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -1073,11 +1481,12 @@ otbrError PublisherAvahi::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DnsErrorToOtbrError(aErrorCode);
 }
 
-void PublisherAvahi::SubscribeHost(const std::string &aHostName)
+otbrError PublisherAvahi::SubscribeHostImpl(const std::string &aHostName)
 {
-    auto host = MakeUnique<HostSubscription>(*this, aHostName);
+    otbrError error = OTBR_ERROR_NONE;
+    auto      host  = MakeUnique<HostSubscription>(*this, aHostName);
 
-    VerifyOrExit(mState == Publisher::State::kReady);
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
 
     mSubscribedHosts.push_back(std::move(host));
 
@@ -1086,10 +1495,10 @@ void PublisherAvahi::SubscribeHost(const std::string &aHostName)
     mSubscribedHosts.back()->Resolve();
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
+void PublisherAvahi::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList::iterator it;
 
@@ -1128,9 +1537,11 @@ void PublisherAvahi::ServiceSubscription::Browse(void)
     assert(mPublisherAvahi->mClient != nullptr);
 
     otbrLogInfo("Browse service %s", mType.c_str());
+    mPublisherAvahi->CountDaemonRequest();
     mServiceBrowser =
-        avahi_service_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, mType.c_str(),
-                                  /* domain */ nullptr, static_cast<AvahiLookupFlags>(0), HandleBrowseResult, this);
+        avahi_service_browser_new(mPublisherAvahi->mClient, mPublisherAvahi->GetQueryInterface(), AVAHI_PROTO_UNSPEC,
+                                  mType.c_str(), /* domain */ nullptr, static_cast<AvahiLookupFlags>(0),
+                                  HandleBrowseResult, this);
     if (!mServiceBrowser)
     {
         otbrLogWarning("Failed to browse service %s: %s", mType.c_str(),
@@ -1153,6 +1564,7 @@ void PublisherAvahi::ServiceSubscription::Release(void)
 
     if (mServiceBrowser != nullptr)
     {
+        mPublisherAvahi->CountDaemonRequest();
         avahi_service_browser_free(mServiceBrowser);
         mServiceBrowser = nullptr;
     }
@@ -1190,6 +1602,9 @@ void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser
     otbrLogInfo("Browse service reply: %s.%s proto %d inf %u event %d flags %d", aName, aType, aProtocol,
                 aInterfaceIndex, static_cast<int>(aEvent), static_cast<int>(aFlags));
 
+    VerifyOrExit(aEvent == AVAHI_BROWSER_FAILURE ||
+                 mPublisherAvahi->IsInterfaceInScope(static_cast<uint32_t>(aInterfaceIndex)));
+
     switch (aEvent)
     {
     case AVAHI_BROWSER_NEW:
@@ -1207,6 +1622,9 @@ void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser
         mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahi_client_errno(mPublisherAvahi->mClient));
         break;
     }
+
+exit:
+    return;
 }
 
 void PublisherAvahi::ServiceSubscription::Resolve(uint32_t           aInterfaceIndex,
@@ -1216,12 +1634,13 @@ void PublisherAvahi::ServiceSubscription::Resolve(uint32_t           aInterfaceI
 {
     auto serviceResolver = MakeUnique<ServiceResolver>();
 
-    mPublisherAvahi->mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = Clock::now();
+    mPublisherAvahi->mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = MainloopClock::Now();
 
     otbrLogInfo("Resolve service %s.%s inf %" PRIu32, aInstanceName.c_str(), aType.c_str(), aInterfaceIndex);
 
     serviceResolver->mType            = aType;
     serviceResolver->mPublisherAvahi  = this->mPublisherAvahi;
+    mPublisherAvahi->CountDaemonRequest();
     serviceResolver->mServiceResolver = avahi_service_resolver_new(
         mPublisherAvahi->mClient, aInterfaceIndex, aProtocol, aInstanceName.c_str(), aType.c_str(),
         /* domain */ nullptr, AVAHI_PROTO_UNSPEC, static_cast<AvahiLookupFlags>(AVAHI_LOOKUP_NO_ADDRESS),
@@ -1287,6 +1706,7 @@ void PublisherAvahi::ServiceResolver::HandleResolveServiceResult(AvahiServiceRes
 
     VerifyOrExit(aEvent == AVAHI_RESOLVER_FOUND, avahiError = avahi_client_errno(mPublisherAvahi->mClient));
     VerifyOrExit(aHostName != nullptr, avahiError = AVAHI_ERR_INVALID_HOST_NAME);
+    VerifyOrExit(mPublisherAvahi->IsInterfaceInScope(static_cast<uint32_t>(aInterfaceIndex)));
 
     mInstanceInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
     mInstanceInfo.mName       = aName;
@@ -1320,11 +1740,13 @@ exit:
         // We should free it before switching to the new record browser.
         if (mRecordBrowser)
         {
+            mPublisherAvahi->CountDaemonRequest();
             avahi_record_browser_free(mRecordBrowser);
             mRecordBrowser = nullptr;
             mInstanceInfo.mAddresses.clear();
         }
         // NOTE: This `ServiceResolver` object may be freed in `OnServiceResolved`.
+        mPublisherAvahi->CountDaemonRequest();
         mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, aInterfaceIndex, AVAHI_PROTO_UNSPEC,
                                                   aHostName, AVAHI_DNS_CLASS_IN, AVAHI_DNS_TYPE_AAAA,
                                                   static_cast<AvahiLookupFlags>(0), HandleResolveHostResult, this);
@@ -1450,6 +1872,7 @@ void PublisherAvahi::HostSubscription::Release(void)
 {
     if (mRecordBrowser != nullptr)
     {
+        mPublisherAvahi->CountDaemonRequest();
         avahi_record_browser_free(mRecordBrowser);
         mRecordBrowser = nullptr;
     }
@@ -1457,12 +1880,14 @@ void PublisherAvahi::HostSubscription::Release(void)
 
 void PublisherAvahi::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = MakeFullHostName(mHostName);
+    std::string  fullHostName = MakeFullHostName(mHostName);
+    AvahiIfIndex ifIndex      = mPublisherAvahi->GetQueryInterface();
 
-    mPublisherAvahi->mHostResolutionBeginTime[mHostName] = Clock::now();
+    mPublisherAvahi->mHostResolutionBeginTime[mHostName] = MainloopClock::Now();
 
-    otbrLogInfo("Resolve host %s inf %d", fullHostName.c_str(), static_cast<int>(AVAHI_IF_UNSPEC));
-    mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+    otbrLogInfo("Resolve host %s inf %d", fullHostName.c_str(), static_cast<int>(ifIndex));
+    mPublisherAvahi->CountDaemonRequest();
+    mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, ifIndex, AVAHI_PROTO_UNSPEC,
                                               fullHostName.c_str(), AVAHI_DNS_CLASS_IN, AVAHI_DNS_TYPE_AAAA,
                                               static_cast<AvahiLookupFlags>(0), HandleResolveResult, this);
     if (!mRecordBrowser)
@@ -1516,6 +1941,7 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser
             static_cast<int>(aEvent));
 
     VerifyOrExit(aEvent == AVAHI_BROWSER_NEW || aEvent == AVAHI_BROWSER_REMOVE);
+    VerifyOrExit(mPublisherAvahi->IsInterfaceInScope(static_cast<uint32_t>(aInterfaceIndex)));
     VerifyOrExit(aSize == OTBR_IP6_ADDRESS_SIZE || aSize == OTBR_IP4_ADDRESS_SIZE,
                  otbrLogErr("Unexpected address data length: %zu", aSize), avahiError = AVAHI_ERR_INVALID_ADDRESS);
     VerifyOrExit(aSize == OTBR_IP6_ADDRESS_SIZE, otbrLogInfo("IPv4 address ignored"),
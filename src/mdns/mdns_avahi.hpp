@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -76,13 +77,6 @@ public:
     PublisherAvahi(StateCallback aStateCallback);
     ~PublisherAvahi(void) override;
 
-    void      UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override;
@@ -99,11 +93,23 @@ protected:
                               const AddressList &aAddresses,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      PublishHostBatchImpl(HostBatch &&aBatch) override;
+    otbrError UpdateServiceTxtDataImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData) override;
+    otbrError UpdateHostAddressesImpl(HostRegistration &aHostReg, const AddressList &aAddresses) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
     void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
     otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
 
 private:
     static constexpr size_t   kMaxSizeOfTxtRecord = 1024;
@@ -136,6 +142,7 @@ private:
 
         ~AvahiServiceRegistration(void) override;
         const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        AvahiEntryGroup       *GetEntryGroup(void) { return mEntryGroup; }
 
     private:
         AvahiEntryGroup *mEntryGroup;
@@ -156,6 +163,7 @@ private:
 
         ~AvahiHostRegistration(void) override;
         const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        AvahiEntryGroup       *GetEntryGroup(void) { return mEntryGroup; }
 
     private:
         AvahiEntryGroup *mEntryGroup;
@@ -357,7 +365,23 @@ private:
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
     AvahiEntryGroup *CreateGroup(AvahiClient *aClient);
-    static void      ReleaseGroup(AvahiEntryGroup *aGroup);
+    void             ReleaseGroup(AvahiEntryGroup *aGroup);
+    void             RebuildGroups(void);
+
+    otbrError AddServiceToGroup(AvahiEntryGroup   *aGroup,
+                                const std::string &aHostName,
+                                const std::string &aName,
+                                const std::string &aType,
+                                const SubTypeList &aSubTypeList,
+                                uint16_t           aPort,
+                                const TxtData     &aTxtData);
+    otbrError AddHostToGroup(AvahiEntryGroup *aGroup, const std::string &aName, const AddressList &aAddresses);
+    otbrError AddKeyToGroup(AvahiEntryGroup *aGroup, const std::string &aName, const KeyData &aKeyData);
+
+    // The interfaces to add the records on, which are all the interfaces unless limited with `SetInterfaces()`.
+    std::vector<AvahiIfIndex> GetPublishInterfaces(void) const;
+    // The interface to send the queries on, whose results are filtered if the queries are sent on all the interfaces.
+    AvahiIfIndex GetQueryInterface(void) const;
 
     static void HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void        HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
@@ -368,9 +392,6 @@ private:
                                               size_t            aBufferSize,
                                               AvahiStringList *&aHead);
 
-    ServiceRegistration *FindServiceRegistration(const AvahiEntryGroup *aEntryGroup);
-    HostRegistration    *FindHostRegistration(const AvahiEntryGroup *aEntryGroup);
-    KeyRegistration     *FindKeyRegistration(const AvahiEntryGroup *aEntryGroup);
 
     AvahiClient                 *mClient;
     std::unique_ptr<AvahiPoller> mPoller;
@@ -379,6 +400,11 @@ private:
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
+
+    // The groups shared by the registrations of a host batch -> the number of registrations sharing each group.
+    std::map<AvahiEntryGroup *, size_t> mBatchGroupRefCounts;
+    // The shared groups whose records are to be added again, since some of their registrations are removed.
+    std::set<AvahiEntryGroup *> mGroupsToRebuild;
 };
 
 } // namespace Mdns
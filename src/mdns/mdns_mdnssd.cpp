@@ -214,9 +214,12 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
 }
 
 PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
-    : mHostsRef(nullptr)
+    : MainloopProcessor(kPriorityMdns)
+    , mHostsRef(nullptr)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
+    , mResolutionsRef(nullptr)
+    , mResolvingCount(0)
 {
 }
 
@@ -254,6 +257,7 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
 
     case kStopOnServiceNotRunningError:
         DeallocateHostsRef();
+        DeallocateResolutionsRef();
         break;
     }
 
@@ -264,6 +268,10 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
+    DeallocateResolutionsRef();
+    ClearSubscriptions();
+
+    assert(mQueuedResolutions.empty() && mResolvingCount == 0);
 
     mState = State::kIdle;
 
@@ -271,12 +279,18 @@ exit:
     return;
 }
 
+uint32_t PublisherMDnsSd::GetScopeInterface(void) const
+{
+    return GetInterfaces().size() == 1 ? GetInterfaces().front() : kDNSServiceInterfaceIndexAny;
+}
+
 DNSServiceErrorType PublisherMDnsSd::CreateSharedHostsRef(void)
 {
     DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
 
     VerifyOrExit(mHostsRef == nullptr);
 
+    CountDaemonRequest();
     dnsError = DNSServiceCreateConnection(&mHostsRef);
     otbrLogDebug("Created new shared DNSServiceRef: %p", mHostsRef);
 
@@ -288,6 +302,7 @@ void PublisherMDnsSd::DeallocateHostsRef(void)
 {
     VerifyOrExit(mHostsRef != nullptr);
 
+    CountDaemonRequest();
     HandleServiceRefDeallocating(mHostsRef);
     DNSServiceRefDeallocate(mHostsRef);
     otbrLogDebug("Deallocated DNSServiceRef for hosts: %p", mHostsRef);
@@ -299,66 +314,39 @@ exit:
 
 void PublisherMDnsSd::Update(MainloopContext &aMainloop)
 {
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Update(aMainloop);
-    }
+    // Resolution slots may have been released since the last iteration.
+    StartQueuedResolutions();
 
-    if (mHostsRef != nullptr)
+    for (DNSServiceRef sharedRef : {mHostsRef, mResolutionsRef})
     {
-        int fd = DNSServiceRefSockFD(mHostsRef);
+        int fd;
 
+        if (sharedRef == nullptr)
+        {
+            continue;
+        }
+
+        fd = DNSServiceRefSockFD(sharedRef);
         assert(fd != -1);
 
         FD_SET(fd, &aMainloop.mReadFdSet);
 
         aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
     }
-
-    for (const auto &service : mSubscribedServices)
-    {
-        service->UpdateAll(aMainloop);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Update(aMainloop);
-    }
 }
 
 void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
 {
     mServiceRefsToProcess.clear();
 
-    for (auto &kv : mServiceRegistrations)
+    for (DNSServiceRef sharedRef : {mHostsRef, mResolutionsRef})
     {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Process(aMainloop, mServiceRefsToProcess);
-    }
-
-    if (mHostsRef != nullptr)
-    {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        if (sharedRef != nullptr && FD_ISSET(DNSServiceRefSockFD(sharedRef), &aMainloop.mReadFdSet))
         {
-            mServiceRefsToProcess.push_back(mHostsRef);
+            mServiceRefsToProcess.push_back(sharedRef);
         }
     }
 
-    for (const auto &service : mSubscribedServices)
-    {
-        service->ProcessAll(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Process(aMainloop, mServiceRefsToProcess);
-    }
-
     for (DNSServiceRef serviceRef : mServiceRefsToProcess)
     {
         DNSServiceErrorType error;
@@ -410,34 +398,89 @@ void PublisherMDnsSd::HandleServiceRefDeallocating(const DNSServiceRef &aService
     }
 }
 
-void PublisherMDnsSd::DnssdServiceRegistration::Update(MainloopContext &aMainloop) const
+DNSServiceErrorType PublisherMDnsSd::CreateSharedResolutionsRef(void)
 {
-    int fd;
+    DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    VerifyOrExit(mResolutionsRef == nullptr);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
+    CountDaemonRequest();
+    dnsError = DNSServiceCreateConnection(&mResolutionsRef);
+    otbrLogDebug("Created new shared DNSServiceRef for resolutions: %p", mResolutionsRef);
 
-    FD_SET(fd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+exit:
+    return dnsError;
+}
+
+void PublisherMDnsSd::DeallocateResolutionsRef(void)
+{
+    VerifyOrExit(mResolutionsRef != nullptr);
+
+    CountDaemonRequest();
+    HandleServiceRefDeallocating(mResolutionsRef);
+    DNSServiceRefDeallocate(mResolutionsRef);
+    otbrLogDebug("Deallocated DNSServiceRef for resolutions: %p", mResolutionsRef);
+    mResolutionsRef = nullptr;
 
 exit:
     return;
 }
 
-void PublisherMDnsSd::DnssdServiceRegistration::Process(const MainloopContext      &aMainloop,
-                                                        std::vector<DNSServiceRef> &aReadyServices) const
+void PublisherMDnsSd::QueueResolution(ServiceInstanceResolution &aResolution)
 {
-    int fd;
+    mQueuedResolutions.push_back(&aResolution);
+    StartQueuedResolutions();
+}
 
-    VerifyOrExit(mServiceRef != nullptr);
+void PublisherMDnsSd::RemoveQueuedResolution(ServiceInstanceResolution &aResolution)
+{
+    mQueuedResolutions.erase(std::remove(mQueuedResolutions.begin(), mQueuedResolutions.end(), &aResolution),
+                             mQueuedResolutions.end());
+}
+
+void PublisherMDnsSd::StartQueuedResolutions(void)
+{
+    DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
+
+    VerifyOrExit(!mQueuedResolutions.empty() && mResolvingCount < OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS);
+
+    SuccessOrExit(dnsError = CreateSharedResolutionsRef());
+
+    while (!mQueuedResolutions.empty() && mResolvingCount < OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS)
+    {
+        ServiceInstanceResolution *resolution = mQueuedResolutions.front();
+
+        mQueuedResolutions.pop_front();
+        resolution->Resolve();
+    }
+
+    if (!mQueuedResolutions.empty())
+    {
+        otbrLogInfo("Queued %zu service instance resolutions", mQueuedResolutions.size());
+    }
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("Failed to create DNSServiceRef for resolutions: %s", DNSErrorToString(dnsError));
 
-    VerifyOrExit(FD_ISSET(fd, &aMainloop.mReadFdSet));
-    aReadyServices.push_back(mServiceRef);
+        // Fails the queued resolutions instead of retrying them in every mainloop iteration.
+        while (!mQueuedResolutions.empty())
+        {
+            ServiceInstanceResolution *resolution = mQueuedResolutions.front();
+
+            mQueuedResolutions.pop_front();
+            OnServiceResolveFailed(resolution->mSubscription->mType, resolution->mInstanceName, dnsError);
+        }
+    }
+}
+
+void PublisherMDnsSd::ReleaseResolutionSlot(ServiceInstanceResolution &aResolution)
+{
+    VerifyOrExit(aResolution.mIsResolving);
+
+    aResolution.mIsResolving = false;
+    mResolvingCount--;
 
 exit:
     return;
@@ -472,13 +515,24 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
 
     otbrLogInfo("Registering service %s.%s", mName.c_str(), regType.c_str());
 
-    dnsError = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsNoAutoRename, kDNSServiceInterfaceIndexAny,
-                                  serviceNameCString, regType.c_str(),
-                                  /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(), mTxtData.data(),
-                                  HandleRegisterResult, this);
+    // Services are registered over the connection shared with hosts and keys, instead of connecting to mdnsd for
+    // each of them.
+    dnsError = GetPublisher().CreateSharedHostsRef();
+
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        GetPublisher().CountDaemonRequest();
+        mServiceRef = GetPublisher().mHostsRef;
+        dnsError    = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsNoAutoRename | kDNSServiceFlagsShareConnection,
+                                         GetPublisher().GetScopeInterface(), serviceNameCString, regType.c_str(),
+                                         /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(),
+                                         mTxtData.data(), HandleRegisterResult, this);
+    }
 
     if (dnsError != kDNSServiceErr_NoError)
     {
+        // `mServiceRef` may still refer to the shared connection on failure.
+        mServiceRef = nullptr;
         HandleRegisterResult(/* aFlags */ 0, dnsError);
     }
 
@@ -490,6 +544,28 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
     return GetPublisher().DnsErrorToOtbrError(dnsError);
 }
 
+otbrError PublisherMDnsSd::DnssdServiceRegistration::UpdateTxtData(const TxtData &aTxtData)
+{
+    DNSServiceErrorType dnsError = kDNSServiceErr_BadReference;
+
+    VerifyOrExit(mServiceRef != nullptr);
+
+    otbrLogInfo("Updating TXT data of service %s.%s", mName.c_str(), mType.c_str());
+
+    // A null record reference refers to the TXT record registered along with the service.
+    GetPublisher().CountDaemonRequest();
+    dnsError = DNSServiceUpdateRecord(mServiceRef, /* aRecordRef */ nullptr, /* aFlags */ 0,
+                                      static_cast<uint16_t>(aTxtData.size()), aTxtData.data(), /* aTtl */ 0);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("Failed to update TXT data of service %s.%s: %s", mName.c_str(), mType.c_str(),
+                       DNSErrorToString(dnsError));
+    }
+    return GetPublisher().DnsErrorToOtbrError(dnsError);
+}
+
 void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
 {
     DnssdKeyRegistration *keyReg = mRelatedKeyReg;
@@ -509,8 +585,14 @@ void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
         keyReg->Unregister();
     }
 
-    GetPublisher().HandleServiceRefDeallocating(mServiceRef);
-    DNSServiceRefDeallocate(mServiceRef);
+    // The `mServiceRef` was already freed along with the shared
+    // connection if it has been deallocated.
+
+    if (GetPublisher().mHostsRef != nullptr)
+    {
+        GetPublisher().CountDaemonRequest();
+        DNSServiceRefDeallocate(mServiceRef);
+    }
     mServiceRef = nullptr;
 
     if (keyReg != nullptr)
@@ -570,8 +652,9 @@ otbrError PublisherMDnsSd::DnssdHostRegistration::Register(void)
         dnsError = GetPublisher().CreateSharedHostsRef();
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
+        GetPublisher().CountDaemonRequest();
         dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &recordRef, kDNSServiceFlagsShared,
-                                            kDNSServiceInterfaceIndexAny, MakeFullHostName(mName).c_str(),
+                                            GetPublisher().GetScopeInterface(), MakeFullHostName(mName).c_str(),
                                             kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8), address.m8,
                                             /* ttl */ 0, HandleRegisterResult, this);
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
@@ -589,34 +672,88 @@ exit:
     return GetPublisher().DnsErrorToOtbrError(dnsError);
 }
 
-void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
+otbrError PublisherMDnsSd::DnssdHostRegistration::UpdateAddresses(const AddressList &aAddresses)
 {
-    DNSServiceErrorType dnsError;
+    DNSServiceErrorType       dnsError = kDNSServiceErr_NoError;
+    std::vector<DNSRecordRef> recordRefs;
+    std::vector<bool>         registered;
+    std::vector<bool>         kept(mAddrRecordRefs.size(), false);
 
-    VerifyOrExit(GetPublisher().mHostsRef != nullptr);
+    VerifyOrExit(mAddrRecordRefs.size() == mAddresses.size(), dnsError = kDNSServiceErr_Invalid);
 
-    for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
+    // The records of the unchanged addresses are kept at their index in the new list, the added addresses are
+    // registered as new records.
+    for (const Ip6Address &address : aAddresses)
     {
-        const Ip6Address &address = mAddresses[index];
+        DNSRecordRef recordRef = nullptr;
+        size_t       index     = 0;
 
-        if (mAddrRegistered[index])
+        while (index < mAddresses.size() && (kept[index] || mAddresses[index] != address))
         {
-            // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
-            // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
-            // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
-            // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
-            // sending a goodbye message.
-            // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
-            dnsError = DNSServiceUpdateRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], kDNSServiceFlagsUnique,
-                                              sizeof(address.m8), address.m8, /* ttl */ 1);
-            otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
-                          MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+            index++;
         }
 
-        dnsError = DNSServiceRemoveRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], /* flags */ 0);
+        if (index < mAddresses.size())
+        {
+            kept[index] = true;
+            recordRefs.push_back(mAddrRecordRefs[index]);
+            registered.push_back(mAddrRegistered[index]);
+        }
+        else
+        {
+            dnsError = GetPublisher().CreateSharedHostsRef();
+            VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+            otbrLogInfo("Adding host %s address %s", mName.c_str(), address.ToString().c_str());
+            GetPublisher().CountDaemonRequest();
+            dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &recordRef, kDNSServiceFlagsShared,
+                                                GetPublisher().GetScopeInterface(), MakeFullHostName(mName).c_str(),
+                                                kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8),
+                                                address.m8, /* ttl */ 0, HandleRegisterResult, this);
+            VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+            recordRefs.push_back(recordRef);
+            registered.push_back(false);
+        }
+    }
 
-        otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
-                      MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+    for (size_t index = 0; index < mAddresses.size(); index++)
+    {
+        if (!kept[index])
+        {
+            RemoveAddressRecord(mAddresses[index], mAddrRecordRefs[index], mAddrRegistered[index]);
+        }
+    }
+
+    mAddrRecordRefs.swap(recordRefs);
+    mAddrRegistered.swap(registered);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("Failed to update host %s addresses: %s", mName.c_str(), DNSErrorToString(dnsError));
+
+        // The records registered for the added addresses are removed again, the registration is left unchanged.
+        for (size_t index = 0; index < recordRefs.size(); index++)
+        {
+            if (std::find(mAddrRecordRefs.begin(), mAddrRecordRefs.end(), recordRefs[index]) == mAddrRecordRefs.end())
+            {
+                GetPublisher().CountDaemonRequest();
+                DNSServiceRemoveRecord(GetPublisher().mHostsRef, recordRefs[index], /* flags */ 0);
+            }
+        }
+    }
+
+    return GetPublisher().DnsErrorToOtbrError(dnsError);
+}
+
+void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
+{
+    VerifyOrExit(GetPublisher().mHostsRef != nullptr);
+
+    for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
+    {
+        RemoveAddressRecord(mAddresses[index], mAddrRecordRefs[index], mAddrRegistered[index]);
     }
 
 exit:
@@ -624,6 +761,34 @@ exit:
     mAddrRecordRefs.clear();
 }
 
+void PublisherMDnsSd::DnssdHostRegistration::RemoveAddressRecord(const Ip6Address &aAddress,
+                                                                 DNSRecordRef      aRecordRef,
+                                                                 bool              aRegistered)
+{
+    DNSServiceErrorType dnsError;
+
+    if (aRegistered)
+    {
+        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
+        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
+        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
+        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
+        // sending a goodbye message.
+        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
+        GetPublisher().CountDaemonRequest();
+        dnsError = DNSServiceUpdateRecord(GetPublisher().mHostsRef, aRecordRef, kDNSServiceFlagsUnique,
+                                          sizeof(aAddress.m8), aAddress.m8, /* ttl */ 1);
+        otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
+                      MakeFullHostName(mName).c_str(), aAddress.ToString().c_str(), DNSErrorToString(dnsError));
+    }
+
+    GetPublisher().CountDaemonRequest();
+    dnsError = DNSServiceRemoveRecord(GetPublisher().mHostsRef, aRecordRef, /* flags */ 0);
+
+    otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
+                  MakeFullHostName(mName).c_str(), aAddress.ToString().c_str(), DNSErrorToString(dnsError));
+}
+
 void PublisherMDnsSd::DnssdHostRegistration::HandleRegisterResult(DNSServiceRef       aServiceRef,
                                                                   DNSRecordRef        aRecordRef,
                                                                   DNSServiceFlags     aFlags,
@@ -683,6 +848,7 @@ otbrError PublisherMDnsSd::DnssdKeyRegistration::Register(void)
     {
         otbrLogInfo("Key %s is being registered as a record of an existing service registration", mName.c_str());
 
+        GetPublisher().CountDaemonRequest();
         dnsError = DNSServiceAddRecord(serviceReg->mServiceRef, &mRecordRef, kDNSServiceFlagsUnique,
                                        kDNSServiceType_KEY, mKeyData.size(), mKeyData.data(), /* ttl */ 0);
 
@@ -707,8 +873,9 @@ otbrError PublisherMDnsSd::DnssdKeyRegistration::Register(void)
         dnsError = GetPublisher().CreateSharedHostsRef();
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
+        GetPublisher().CountDaemonRequest();
         dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &mRecordRef, kDNSServiceFlagsUnique,
-                                            kDNSServiceInterfaceIndexAny, MakeFullKeyName(mName).c_str(),
+                                            GetPublisher().GetScopeInterface(), MakeFullKeyName(mName).c_str(),
                                             kDNSServiceType_KEY, kDNSServiceClass_IN, mKeyData.size(), mKeyData.data(),
                                             /* ttl */ 0, HandleRegisterResult, this);
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
@@ -746,8 +913,11 @@ void PublisherMDnsSd::DnssdKeyRegistration::Unregister(void)
         otbrLogInfo("Unregistering key %s (was registered individually)", mName.c_str());
     }
 
-    VerifyOrExit(serviceRef != nullptr);
+    // Service registrations are subordinates of the shared connection,
+    // so the records are all gone once it is deallocated.
+    VerifyOrExit(serviceRef != nullptr && GetPublisher().mHostsRef != nullptr);
 
+    GetPublisher().CountDaemonRequest();
     dnsError = DNSServiceRemoveRecord(serviceRef, mRecordRef, /* flags */ 0);
 
     otbrLogInfo("Unregistered key %s: error:%s", mName.c_str(), DNSErrorToString(dnsError));
@@ -817,7 +987,19 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+otbrError PublisherMDnsSd::UpdateServiceTxtDataImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    return static_cast<DnssdServiceRegistration &>(aServiceReg).UpdateTxtData(aTxtData);
+}
+
+otbrError PublisherMDnsSd::UpdateHostAddressesImpl(HostRegistration &aHostReg, const AddressList &aAddresses)
+{
+    return static_cast<DnssdHostRegistration &>(aHostReg).UpdateAddresses(aAddresses);
+}
+
+void PublisherMDnsSd::UnpublishServiceImpl(const std::string &aName,
+                                           const std::string &aType,
+                                           ResultCallback   &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -854,7 +1036,7 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -892,7 +1074,7 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -918,9 +1100,11 @@ std::string PublisherMDnsSd::MakeRegType(const std::string &aType, SubTypeList a
     return regType;
 }
 
-void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+otbrError PublisherMDnsSd::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    VerifyOrExit(mState == Publisher::State::kReady);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedServices.push_back(MakeUnique<ServiceSubscription>(*this, aType, aInstanceName));
 
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -932,14 +1116,14 @@ void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::stri
     }
     else
     {
-        mSubscribedServices.back()->Resolve(kDNSServiceInterfaceIndexAny, aInstanceName, aType, kDomain);
+        mSubscribedServices.back()->Resolve(GetScopeInterface(), aInstanceName, aType, kDomain);
     }
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -976,9 +1160,11 @@ otbrError PublisherMDnsSd::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DNSErrorToOtbrError(aErrorCode);
 }
 
-void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
+otbrError PublisherMDnsSd::SubscribeHostImpl(const std::string &aHostName)
 {
-    VerifyOrExit(mState == State::kReady);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedHosts.push_back(MakeUnique<HostSubscription>(*this, aHostName));
 
     otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
@@ -986,10 +1172,10 @@ void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
     mSubscribedHosts.back()->Resolve();
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
+void PublisherMDnsSd::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList ::iterator it;
 
@@ -1028,49 +1214,37 @@ void PublisherMDnsSd::ServiceRef::DeallocateServiceRef(void)
     if (mServiceRef != nullptr)
     {
         mPublisher.HandleServiceRefDeallocating(mServiceRef);
-        DNSServiceRefDeallocate(mServiceRef);
+
+        // A subordinate `DNSServiceRef` has already been freed if its shared connection is deallocated.
+        if (mPublisher.mResolutionsRef != nullptr)
+        {
+            mPublisher.CountDaemonRequest();
+            DNSServiceRefDeallocate(mServiceRef);
+        }
         mServiceRef = nullptr;
     }
 }
 
-void PublisherMDnsSd::ServiceRef::Update(MainloopContext &aMainloop) const
+void PublisherMDnsSd::ServiceSubscription::Browse(void)
 {
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
+    DNSServiceErrorType dnsError;
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    FD_SET(fd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
-exit:
-    return;
-}
+    assert(mServiceRef == nullptr);
 
-void PublisherMDnsSd::ServiceRef::Process(const MainloopContext      &aMainloop,
-                                          std::vector<DNSServiceRef> &aReadyServices) const
-{
-    int fd;
+    otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
+    SuccessOrExit(dnsError = mPublisher.CreateSharedResolutionsRef());
 
-    VerifyOrExit(mServiceRef != nullptr);
+    mPublisher.CountDaemonRequest();
+    mServiceRef = mPublisher.mResolutionsRef;
+    dnsError    = DNSServiceBrowse(&mServiceRef, kDNSServiceFlagsShareConnection, mPublisher.GetScopeInterface(),
+                                   mType.c_str(), /* domain */ nullptr, HandleBrowseResult, this);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
     {
-        aReadyServices.push_back(mServiceRef);
+        otbrLogWarning("DNSServiceBrowse failed: %s", DNSErrorToString(dnsError));
+        mServiceRef = nullptr;
     }
-exit:
-    return;
-}
-
-void PublisherMDnsSd::ServiceSubscription::Browse(void)
-{
-    assert(mServiceRef == nullptr);
-
-    otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
-                     /* domain */ nullptr, HandleBrowseResult, this);
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
@@ -1102,6 +1276,7 @@ void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef
                 aErrorCode);
 
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
+    VerifyOrExit(mPublisher.IsInterfaceInScope(aInterfaceIndex));
 
     if (aFlags & kDNSServiceFlagsAdd)
     {
@@ -1127,39 +1302,41 @@ void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t           aInterface
 {
     mResolvingInstances.push_back(
         MakeUnique<ServiceInstanceResolution>(*this, aInstanceName, aType, aDomain, aInterfaceIndex));
-    mResolvingInstances.back()->Resolve();
-}
-
-void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
-{
-    Update(aMainloop);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Update(aMainloop);
-    }
+    mPublisher.QueueResolution(*mResolvingInstances.back());
 }
 
-void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext      &aMainloop,
-                                                      std::vector<DNSServiceRef> &aReadyServices) const
+PublisherMDnsSd::ServiceInstanceResolution::~ServiceInstanceResolution(void)
 {
-    Process(aMainloop, aReadyServices);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Process(aMainloop, aReadyServices);
-    }
+    mPublisher.RemoveQueuedResolution(*this);
+    mPublisher.ReleaseResolutionSlot(*this);
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
+    DNSServiceErrorType dnsError;
+
     assert(mServiceRef == nullptr);
+    assert(mPublisher.mResolutionsRef != nullptr);
 
-    mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = Clock::now();
+    mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = MainloopClock::Now();
 
     otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+    mPublisher.CountDaemonRequest();
+    mServiceRef = mPublisher.mResolutionsRef;
+    dnsError = DNSServiceResolve(&mServiceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsTimeout, mNetifIndex,
+                                 mInstanceName.c_str(), mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceResolve failed: %s", DNSErrorToString(dnsError));
+        mServiceRef = nullptr;
+        mPublisher.OnServiceResolveFailed(mSubscription->mType, mInstanceName, dnsError);
+    }
+    else
+    {
+        mIsResolving = true;
+        mPublisher.mResolvingCount++;
+    }
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -1232,13 +1409,16 @@ otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInte
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
-                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
-                                     mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+    mPublisher.CountDaemonRequest();
+    mServiceRef = mPublisher.mResolutionsRef;
+    dnsError    = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection, aInterfaceIndex,
+                                        kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
+                                        mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
 
     if (dnsError != kDNSServiceErr_NoError)
     {
         otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
+        mServiceRef = nullptr;
     }
 
     return dnsError == kDNSServiceErr_NoError ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
@@ -1308,23 +1488,37 @@ void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
     std::string            serviceName  = mSubscription->mType;
     DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
 
+    // The address changes are still monitored after the first result, without holding a resolution slot.
+    mPublisher.ReleaseResolutionSlot(*this);
+
     // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
     subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
 }
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = MakeFullHostName(mHostName);
+    DNSServiceErrorType dnsError;
+    std::string         fullHostName = MakeFullHostName(mHostName);
 
     assert(mServiceRef == nullptr);
 
-    mPublisher.mHostResolutionBeginTime[mHostName] = Clock::now();
+    mPublisher.mHostResolutionBeginTime[mHostName] = MainloopClock::Now();
+
+    otbrLogInfo("DNSServiceGetAddrInfo %s inf %" PRIu32, fullHostName.c_str(), mPublisher.GetScopeInterface());
+    SuccessOrExit(dnsError = mPublisher.CreateSharedResolutionsRef());
 
-    otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
+    mPublisher.CountDaemonRequest();
+    mServiceRef = mPublisher.mResolutionsRef;
+    dnsError    = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection, mPublisher.GetScopeInterface(),
+                                        kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
+                                        HandleResolveResult, this);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
+        mServiceRef = nullptr;
+    }
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
@@ -1358,6 +1552,7 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
             static_cast<unsigned int>(aAddress->sa_family), aErrorCode);
 
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
+    VerifyOrExit(mPublisher.IsInterfaceInScope(aInterfaceIndex));
     VerifyOrExit(aAddress->sa_family == AF_INET6);
 
     address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
@@ -37,6 +37,7 @@
 #include "openthread-br/config.h"
 
 #include <array>
+#include <deque>
 #include <map>
 #include <memory>
 #include <utility>
@@ -50,6 +51,14 @@
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 
+/**
+ * The maximum number of service instances resolved at the same time, the other instances are queued.
+ *
+ */
+#ifndef OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS
+#define OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS 16
+#endif
+
 namespace otbr {
 
 namespace Mdns {
@@ -67,14 +76,6 @@ public:
 
     // Implementation of Mdns::Publisher.
 
-    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-
-    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override { Stop(kNormalStop); }
@@ -83,6 +84,7 @@ public:
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "PublisherMDnsSd"; }
 
 protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
@@ -96,11 +98,22 @@ protected:
                               const AddressList &aAddress,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError UpdateServiceTxtDataImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData) override;
+    otbrError UpdateHostAddressesImpl(HostRegistration &aHostReg, const AddressList &aAddresses) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
     void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
     otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
 
 private:
     static constexpr uint32_t kDefaultTtl = 10;
@@ -122,9 +135,8 @@ private:
 
         ~DnssdServiceRegistration(void) override { Unregister(); }
 
-        void      Update(MainloopContext &aMainloop) const;
-        void      Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         otbrError Register(void);
+        otbrError UpdateTxtData(const TxtData &aTxtData);
 
     private:
         void             Unregister(void);
@@ -150,9 +162,11 @@ private:
         ~DnssdHostRegistration(void) override { Unregister(); }
 
         otbrError Register(void);
+        otbrError UpdateAddresses(const AddressList &aAddresses);
 
     private:
         void             Unregister(void);
+        void             RemoveAddressRecord(const Ip6Address &aAddress, DNSRecordRef aRecordRef, bool aRegistered);
         PublisherMDnsSd &GetPublisher(void) { return *static_cast<PublisherMDnsSd *>(mPublisher); }
         void             HandleRegisterResult(DNSRecordRef aRecordRef, DNSServiceErrorType aError);
         static void      HandleRegisterResult(DNSServiceRef       aServiceRef,
@@ -192,6 +206,7 @@ private:
 
     struct ServiceRef : private ::NonCopyable
     {
+        // A subordinate of `mPublisher.mResolutionsRef`, whose socket is processed instead.
         DNSServiceRef    mServiceRef;
         PublisherMDnsSd &mPublisher;
 
@@ -203,8 +218,6 @@ private:
 
         ~ServiceRef() { Release(); }
 
-        void Update(MainloopContext &aMainloop) const;
-        void Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         void Release(void);
         void DeallocateServiceRef(void);
     };
@@ -224,9 +237,12 @@ private:
             , mType(std::move(aType))
             , mDomain(std::move(aDomain))
             , mNetifIndex(aNetifIndex)
+            , mIsResolving(false)
         {
         }
 
+        ~ServiceInstanceResolution(void);
+
         void      Resolve(void);
         otbrError GetAddrInfo(uint32_t aInterfaceIndex);
         void      FinishResolution(void);
@@ -272,6 +288,7 @@ private:
         std::string            mDomain;
         uint32_t               mNetifIndex;
         DiscoveredInstanceInfo mInstanceInfo;
+        bool                   mIsResolving; // Whether this resolution holds one of the concurrent resolution slots.
     };
 
     struct ServiceSubscription : public ServiceRef
@@ -288,8 +305,6 @@ private:
                      const std::string &aInstanceName,
                      const std::string &aType,
                      const std::string &aDomain);
-        void UpdateAll(MainloopContext &aMainloop) const;
-        void ProcessAll(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
 
         static void HandleBrowseResult(DNSServiceRef       aServiceRef,
                                        DNSServiceFlags     aFlags,
@@ -350,12 +365,28 @@ private:
     void                Stop(StopMode aStopMode);
     DNSServiceErrorType CreateSharedHostsRef(void);
     void                DeallocateHostsRef(void);
+    DNSServiceErrorType CreateSharedResolutionsRef(void);
     void                HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef);
+    void                QueueResolution(ServiceInstanceResolution &aResolution);
+    void                RemoveQueuedResolution(ServiceInstanceResolution &aResolution);
+    void                StartQueuedResolutions(void);
+    void                ReleaseResolutionSlot(ServiceInstanceResolution &aResolution);
+    void                DeallocateResolutionsRef(void);
+
+    // The interface to register the records and send the queries on. The mDNSResponder only takes a single interface
+    // or all of them, the results received on the other interfaces are filtered if several interfaces are set.
+    uint32_t GetScopeInterface(void) const;
 
     DNSServiceRef mHostsRef;
     State         mState;
     StateCallback mStateCallback;
 
+    // The shared connection of all service browses, service instance resolutions and host resolutions, so that they
+    // don't need a socket each. Registrations share `mHostsRef`.
+    DNSServiceRef                           mResolutionsRef;
+    std::deque<ServiceInstanceResolution *> mQueuedResolutions;
+    uint32_t                                mResolvingCount;
+
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
 
@@ -0,0 +1,127 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the awaitables of the async operations of the Thread host.
+ */
+
+#ifndef OTBR_AGENT_ASYNC_COROUTINE_HPP_
+#define OTBR_AGENT_ASYNC_COROUTINE_HPP_
+
+#include "openthread-br/config.h"
+
+#include "common/coroutine.hpp"
+
+#if OTBR_ENABLE_COROUTINES
+
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <openthread/dataset.h>
+#include <openthread/error.h>
+
+#include "ncp/async_task.hpp"
+#include "ncp/thread_host.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This type represents the result of an async operation, the error and its description.
+ *
+ */
+using AsyncResult = std::tuple<otError, std::string>;
+
+/**
+ * This function returns an awaitable of the chained async operations of an AsyncTask.
+ *
+ * Example usage:
+ *  auto [error, errorInfo] = co_await AwaitAsyncTask([&](AsyncTaskPtr &aTask) {
+ *      aTask->First([](AsyncTaskPtr aNext) { ... })->Then([](AsyncTaskPtr aNext) { ... });
+ *  });
+ *
+ * @param[in] aBuilder  The function setting the operations of the task, which is then run.
+ *
+ */
+template <typename Builder> auto AwaitAsyncTask(Builder aBuilder)
+{
+    return AwaitCallback<otError, const std::string &>(
+        [builder = std::move(aBuilder)](auto aResumer) mutable {
+            AsyncTaskPtr task = AsyncTask::Create(aResumer);
+
+            builder(task);
+            task->Run();
+        });
+}
+
+/**
+ * This function returns an awaitable of `ThreadHost::Join()`.
+ *
+ * @param[in] aHost                  The Thread host.
+ * @param[in] aActiveOpDatasetTlvs   The active operational dataset to join, it must outlive the awaiting.
+ *
+ */
+inline auto Join(ThreadHost &aHost, const otOperationalDatasetTlvs &aActiveOpDatasetTlvs)
+{
+    return AwaitCallback<otError, const std::string &>(
+        [&aHost, &aActiveOpDatasetTlvs](auto aResumer) { aHost.Join(aActiveOpDatasetTlvs, aResumer); });
+}
+
+/**
+ * This function returns an awaitable of `ThreadHost::Leave()`.
+ *
+ * @param[in] aHost  The Thread host.
+ *
+ */
+inline auto Leave(ThreadHost &aHost)
+{
+    return AwaitCallback<otError, const std::string &>([&aHost](auto aResumer) { aHost.Leave(aResumer); });
+}
+
+/**
+ * This function returns an awaitable of `ThreadHost::ScheduleMigration()`.
+ *
+ * @param[in] aHost                   The Thread host.
+ * @param[in] aPendingOpDatasetTlvs   The pending operational dataset to migrate to, it must outlive the awaiting.
+ *
+ */
+inline auto ScheduleMigration(ThreadHost &aHost, const otOperationalDatasetTlvs &aPendingOpDatasetTlvs)
+{
+    return AwaitCallback<otError, const std::string &>([&aHost, &aPendingOpDatasetTlvs](auto aResumer) {
+        aHost.ScheduleMigration(aPendingOpDatasetTlvs, aResumer);
+    });
+}
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_ENABLE_COROUTINES
+
+#endif // OTBR_AGENT_ASYNC_COROUTINE_HPP_
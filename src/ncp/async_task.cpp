@@ -30,14 +30,116 @@
 
 #include <assert.h>
 #include <memory>
+#include <new>
 
 #include "common/code_utils.hpp"
 
+/**
+ * The maximum number of free task blocks kept for reuse by each thread.
+ *
+ */
+#ifndef OTBR_ASYNC_TASK_POOL_SIZE
+#define OTBR_ASYNC_TASK_POOL_SIZE 16
+#endif
+
 namespace otbr {
 namespace Ncp {
 
-AsyncTask::AsyncTask(const ResultHandler &aResultHandler)
-    : mResultHandler(aResultHandler)
+namespace {
+
+thread_local size_t sPoolHeapAllocationCount = 0;
+
+/**
+ * This structure implements the free list of the blocks of a size.
+ *
+ * It is trivially destructible, so that the tasks released during the exit of the program, in any order, can still be
+ * put back. The free blocks are kept until then.
+ *
+ */
+struct FreeBlocks
+{
+    void *Get(size_t aSize)
+    {
+        void *block;
+
+        if (mCount == 0)
+        {
+            block = ::operator new(aSize);
+            sPoolHeapAllocationCount++;
+        }
+        else
+        {
+            block = mBlocks[--mCount];
+        }
+
+        return block;
+    }
+
+    void Put(void *aBlock)
+    {
+        if (mCount < OTBR_ASYNC_TASK_POOL_SIZE)
+        {
+            mBlocks[mCount++] = aBlock;
+        }
+        else
+        {
+            ::operator delete(aBlock);
+        }
+    }
+
+    void  *mBlocks[OTBR_ASYNC_TASK_POOL_SIZE];
+    size_t mCount;
+};
+
+/**
+ * This class implements the allocator of the pooled tasks.
+ *
+ * `std::allocate_shared` rebinds it to the type holding both the task and the control block, whose blocks are pooled.
+ *
+ */
+template <class T> class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    PoolAllocator(void) = default;
+
+    template <class U> PoolAllocator(const PoolAllocator<U> &) {}
+
+    T *allocate(size_t aCount)
+    {
+        return static_cast<T *>(aCount == 1 ? GetFreeBlocks().Get(sizeof(T)) : ::operator new(aCount * sizeof(T)));
+    }
+
+    void deallocate(T *aBlock, size_t aCount)
+    {
+        if (aCount == 1)
+        {
+            GetFreeBlocks().Put(aBlock);
+        }
+        else
+        {
+            ::operator delete(aBlock);
+        }
+    }
+
+    template <class U> bool operator==(const PoolAllocator<U> &) const { return true; }
+    template <class U> bool operator!=(const PoolAllocator<U> &) const { return false; }
+
+private:
+    // The tasks are run by the mainloop, the pool is per thread so that it doesn't need locking.
+    static FreeBlocks &GetFreeBlocks(void)
+    {
+        static thread_local FreeBlocks sFreeBlocks;
+
+        return sFreeBlocks;
+    }
+};
+
+} // namespace
+
+AsyncTask::AsyncTask(ResultHandler aResultHandler)
+    : mResultHandler(std::move(aResultHandler))
 {
 }
 
@@ -52,6 +154,16 @@ AsyncTask::~AsyncTask()
     }
 }
 
+AsyncTaskPtr AsyncTask::Create(ResultHandler aResultHandler)
+{
+    return std::allocate_shared<AsyncTask>(PoolAllocator<AsyncTask>(), std::move(aResultHandler));
+}
+
+size_t AsyncTask::GetPoolHeapAllocationCount(void)
+{
+    return sPoolHeapAllocationCount;
+}
+
 void AsyncTask::Run(void)
 {
     SetResult(OT_ERROR_NONE, "");
@@ -78,19 +190,19 @@ void AsyncTask::SetResult(otError aError, const std::string &aErrorInfo)
     }
 }
 
-AsyncTaskPtr &AsyncTask::First(const ThenHandler &aFirst)
+AsyncTaskPtr &AsyncTask::First(ThenHandler aFirst)
 {
     assert(mNext == nullptr);
 
-    return Then(aFirst);
+    return Then(std::move(aFirst));
 }
 
-AsyncTaskPtr &AsyncTask::Then(const ThenHandler &aThen)
+AsyncTaskPtr &AsyncTask::Then(ThenHandler aThen)
 {
     assert(mNext == nullptr);
 
-    mNext = std::make_shared<AsyncTask>(mResultHandler);
-    mThen = aThen;
+    mNext = Create(std::move(mResultHandler));
+    mThen = std::move(aThen);
 
     return mNext;
 }
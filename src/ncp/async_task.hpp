@@ -35,11 +35,13 @@
 #ifndef OTBR_AGENT_ASYNC_TASK_HPP_
 #define OTBR_AGENT_ASYNC_TASK_HPP_
 
-#include <functional>
 #include <memory>
+#include <string>
 
 #include <openthread/error.h>
 
+#include "common/inline_function.hpp"
+
 namespace otbr {
 namespace Ncp {
 
@@ -49,8 +51,8 @@ using AsyncTaskPtr = std::shared_ptr<AsyncTask>;
 class AsyncTask
 {
 public:
-    using ThenHandler   = std::function<void(AsyncTaskPtr)>;
-    using ResultHandler = std::function<void(otError, const std::string &)>;
+    using ThenHandler   = InlineFunction<void(AsyncTaskPtr)>;
+    using ResultHandler = InlineFunction<void(otError, const std::string &)>;
 
     /**
      * Constructor.
@@ -58,7 +60,28 @@ public:
      * @param[in]  The error handler called when the result is not OT_ERROR_NONE;
      *
      */
-    AsyncTask(const ResultHandler &aResultHandler);
+    AsyncTask(ResultHandler aResultHandler);
+
+    /**
+     * This function creates an AsyncTask whose memory is recycled from the previous tasks.
+     *
+     * The task and the control block of its shared pointer are allocated together from a pool, as are the tasks of
+     * the chained operations, so that a chain of tasks doesn't allocate memory once the pool is warm.
+     *
+     * @param[in] aResultHandler  The handler called with the result of the chained async operations.
+     *
+     * @returns A shared pointer to the new AsyncTask object.
+     *
+     */
+    static AsyncTaskPtr Create(ResultHandler aResultHandler);
+
+    /**
+     * This function returns the number of pooled task blocks which have been allocated from the heap by this thread.
+     *
+     * @returns The number of heap allocations of the task pool, which stops growing once the pool is warm.
+     *
+     */
+    static size_t GetPoolHeapAllocationCount(void);
 
     /**
      * Destructor.
@@ -88,30 +111,27 @@ public:
     /**
      * Set the initial operation of the chained async operations.
      *
-     * @param[in] aFirst  A reference to a function object for the initial action.
+     * @param[in] aFirst  A function object for the initial action.
      *
      * @returns  A shared pointer to a AsyncTask object created in this method.
      *
      */
-    AsyncTaskPtr &First(const ThenHandler &aFirst);
+    AsyncTaskPtr &First(ThenHandler aFirst);
 
     /**
      * Set the next operation of the chained async operations.
      *
-     * @param[in] aThen  A reference to a function object for the next action.
+     * @param[in] aThen  A function object for the next action.
      *
      * @returns A shared pointer to a AsyncTask object created in this method.
      *
      */
-    AsyncTaskPtr &Then(const ThenHandler &aThen);
+    AsyncTaskPtr &Then(ThenHandler aThen);
 
 private:
-    union
-    {
-        ThenHandler   mThen;          // Only valid when `mNext` is not nullptr
-        ResultHandler mResultHandler; // Only valid when `mNext` is nullptr
-    };
-    AsyncTaskPtr mNext;
+    ThenHandler   mThen;          // Only valid when `mNext` is not nullptr
+    ResultHandler mResultHandler; // Only valid when `mNext` is nullptr, it is moved to the last task of the chain
+    AsyncTaskPtr  mNext;
 };
 
 } // namespace Ncp
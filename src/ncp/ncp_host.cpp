@@ -49,6 +49,7 @@ namespace Ncp {
 NcpNetworkProperties::NcpNetworkProperties(void)
     : mDeviceRole(OT_DEVICE_ROLE_DISABLED)
 {
+    mDatasetActiveTlvs.mLength = 0;
 }
 
 otDeviceRole NcpNetworkProperties::GetDeviceRole(void) const
@@ -58,13 +59,32 @@ otDeviceRole NcpNetworkProperties::GetDeviceRole(void) const
 
 void NcpNetworkProperties::SetDeviceRole(otDeviceRole aRole)
 {
+    VerifyOrExit(aRole != mDeviceRole);
+
     mDeviceRole = aRole;
+    NotifyDeviceRoleChanged(aRole);
+
+exit:
+    return;
+}
+
+void NcpNetworkProperties::GetDatasetActiveTlvs(otOperationalDatasetTlvs &aDatasetTlvs) const
+{
+    aDatasetTlvs.mLength = mDatasetActiveTlvs.mLength;
+    memcpy(aDatasetTlvs.mTlvs, mDatasetActiveTlvs.mTlvs, mDatasetActiveTlvs.mLength);
+}
+
+void NcpNetworkProperties::SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs)
+{
+    mDatasetActiveTlvs.mLength = aActiveOpDatasetTlvs.mLength;
+    memcpy(mDatasetActiveTlvs.mTlvs, aActiveOpDatasetTlvs.mTlvs, aActiveOpDatasetTlvs.mLength);
 }
 
 // ===================================== NcpHost ======================================
 
 NcpHost::NcpHost(const char *aInterfaceName, bool aDryRun)
-    : mSpinelDriver(*static_cast<ot::Spinel::SpinelDriver *>(otSysGetSpinelDriver()))
+    : MainloopProcessor(kPriorityThreadStack)
+    , mSpinelDriver(*static_cast<ot::Spinel::SpinelDriver *>(otSysGetSpinelDriver()))
     , mNetif()
 {
     memset(&mConfig, 0, sizeof(mConfig));
@@ -82,14 +102,50 @@ void NcpHost::Init(void)
 {
     otSysInit(&mConfig);
     mNcpSpinel.Init(mSpinelDriver, *this);
-    mNetif.Init(mConfig.mInterfaceName,
-                [this](const uint8_t *aData, uint16_t aLength) { return mNcpSpinel.Ip6Send(aData, aLength); });
+#if OTBR_ENABLE_PACKET_CAPTURE
+    mNcpSpinel.SetPacketCapture(&mPacketCapture);
+    mNetif.Init(mConfig.mInterfaceName, [this](FrameBuffer &aFrame) {
+        mPacketCapture.Capture(Utils::PacketCapture::kInterfaceThread, Utils::PacketCapture::kDirectionOutbound,
+                               aFrame.GetData(), aFrame.GetLength());
+        return mNcpSpinel.Ip6Send(aFrame);
+    });
+#else
+    mNetif.Init(mConfig.mInterfaceName, [this](FrameBuffer &aFrame) { return mNcpSpinel.Ip6Send(aFrame); });
+#endif
+
+    static_assert(Netif::kIp6SendHeadroom >= NcpSpinel::kStreamNetHeaderSize,
+                  "The TUN frames don't have enough headroom for the spinel header");
+#if OTBR_ENABLE_PACKET_CAPTURE
+    mNcpSpinel.Ip6SetReceiveCallback([this](const uint8_t *aData, uint16_t aLength) {
+        mPacketCapture.Capture(Utils::PacketCapture::kInterfaceThread, Utils::PacketCapture::kDirectionInbound, aData,
+                               aLength);
+        mNetif.Ip6Receive(aData, aLength);
+    });
+#else
+    mNcpSpinel.Ip6SetReceiveCallback(
+        [this](const uint8_t *aData, uint16_t aLength) { mNetif.Ip6Receive(aData, aLength); });
+#endif
 
     mNcpSpinel.Ip6SetAddressCallback(
         [this](const std::vector<Ip6AddressInfo> &aAddrInfos) { mNetif.UpdateIp6UnicastAddresses(aAddrInfos); });
     mNcpSpinel.Ip6SetAddressMulticastCallback(
         [this](const std::vector<Ip6Address> &aAddrs) { mNetif.UpdateIp6MulticastAddresses(aAddrs); });
     mNcpSpinel.NetifSetStateChangedCallback([this](bool aState) { mNetif.SetNetifState(aState); });
+
+    // The properties are fetched once and then kept up to date by the notifications of the NCP, so that reading them
+    // never waits for the NCP.
+    {
+        AsyncTaskPtr task = AsyncTask::Create([](otError aError, const std::string &aErrorInfo) {
+            if (aError != OT_ERROR_NONE)
+            {
+                otbrLogWarning("Failed to get the NCP properties: %s %s", otThreadErrorToString(aError),
+                               aErrorInfo.c_str());
+            }
+        });
+
+        task->First([this](AsyncTaskPtr aNext) { mNcpSpinel.GetPropertiesSnapshot(std::move(aNext)); });
+        task->Run();
+    }
 }
 
 void NcpHost::Deinit(void)
@@ -104,7 +160,7 @@ void NcpHost::Join(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs, const A
     AsyncTaskPtr task;
     auto errorHandler = [aReceiver](otError aError, const std::string &aErrorInfo) { aReceiver(aError, aErrorInfo); };
 
-    task = std::make_shared<AsyncTask>(errorHandler);
+    task = AsyncTask::Create(errorHandler);
     task->First([this, aActiveOpDatasetTlvs](AsyncTaskPtr aNext) {
             mNcpSpinel.DatasetSetActiveTlvs(aActiveOpDatasetTlvs, std::move(aNext));
         })
@@ -118,7 +174,7 @@ void NcpHost::Leave(const AsyncResultReceiver &aReceiver)
     AsyncTaskPtr task;
     auto errorHandler = [aReceiver](otError aError, const std::string &aErrorInfo) { aReceiver(aError, aErrorInfo); };
 
-    task = std::make_shared<AsyncTask>(errorHandler);
+    task = AsyncTask::Create(errorHandler);
     task->First([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadDetachGracefully(std::move(aNext)); })
         ->Then([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadErasePersistentInfo(std::move(aNext)); });
     task->Run();
@@ -134,7 +190,7 @@ void NcpHost::ScheduleMigration(const otOperationalDatasetTlvs &aPendingOpDatase
     VerifyOrExit(role != OT_DEVICE_ROLE_DISABLED && role != OT_DEVICE_ROLE_DETACHED, error = OT_ERROR_INVALID_STATE);
 
     mNcpSpinel.DatasetMgmtSetPending(std::make_shared<otOperationalDatasetTlvs>(aPendingOpDatasetTlvs),
-                                     std::make_shared<AsyncTask>(errorHandler));
+                                     AsyncTask::Create(errorHandler));
 
 exit:
     if (error != OT_ERROR_NONE)
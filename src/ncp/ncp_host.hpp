@@ -41,6 +41,7 @@
 #include "ncp/ncp_spinel.hpp"
 #include "ncp/thread_host.hpp"
 #include "posix/netif.hpp"
+#include "utils/packet_capture.hpp"
 
 namespace otbr {
 namespace Ncp {
@@ -60,12 +61,15 @@ public:
 
     // NetworkProperties methods
     otDeviceRole GetDeviceRole(void) const override;
+    void         GetDatasetActiveTlvs(otOperationalDatasetTlvs &aDatasetTlvs) const override;
 
 private:
     // PropsObserver methods
     void SetDeviceRole(otDeviceRole aRole) override;
+    void SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs) override;
 
-    otDeviceRole mDeviceRole;
+    otDeviceRole             mDeviceRole;
+    otOperationalDatasetTlvs mDatasetActiveTlvs;
 };
 
 class NcpHost : public MainloopProcessor, public ThreadHost, public NcpNetworkProperties
@@ -100,6 +104,28 @@ public:
     // MainloopProcessor methods
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "NcpHost"; }
+
+    /**
+     * This method returns the statistics of the spinel transactions sent to the NCP.
+     *
+     * @returns A reference to the spinel transaction statistics.
+     *
+     */
+    const NcpSpinel::TransactionStats &GetSpinelTransactionStats(void) const
+    {
+        return mNcpSpinel.GetTransactionStats();
+    }
+
+#if OTBR_ENABLE_PACKET_CAPTURE
+    /**
+     * This method returns the capture ring of the recent IPv6 datagrams and spinel frames.
+     *
+     * @returns A reference to the capture ring.
+     *
+     */
+    Utils::PacketCapture &GetPacketCapture(void) { return mPacketCapture; }
+#endif
 
 private:
     ot::Spinel::SpinelDriver &mSpinelDriver;
@@ -107,6 +133,9 @@ private:
     NcpSpinel                 mNcpSpinel;
     TaskRunner                mTaskRunner;
     Netif                     mNetif;
+#if OTBR_ENABLE_PACKET_CAPTURE
+    Utils::PacketCapture mPacketCapture;
+#endif
 };
 
 } // namespace Ncp
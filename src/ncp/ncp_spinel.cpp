@@ -30,6 +30,7 @@
 
 #include "ncp_spinel.hpp"
 
+#include <inttypes.h>
 #include <stdarg.h>
 
 #include <algorithm>
@@ -39,6 +40,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/probes.hpp"
 #include "lib/spinel/spinel.h"
 #include "lib/spinel/spinel_decoder.hpp"
 #include "lib/spinel/spinel_driver.hpp"
@@ -49,6 +51,16 @@ namespace Ncp {
 
 static constexpr char kSpinelDataUnpackFormat[] = "CiiD";
 
+// The properties which the NCP reports when they change, so that their values are always known without waiting for
+// the NCP.
+static constexpr spinel_prop_key_t kSnapshotProperties[] = {
+    SPINEL_PROP_NET_ROLE,
+    SPINEL_PROP_NET_IF_UP,
+    SPINEL_PROP_IPV6_ADDRESS_TABLE,
+    SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE,
+    SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS,
+};
+
 NcpSpinel::NcpSpinel(void)
     : mSpinelDriver(nullptr)
     , mCmdTidsInUse(0)
@@ -57,9 +69,17 @@ NcpSpinel::NcpSpinel(void)
     , mEncoder(mNcpBuffer)
     , mIid(SPINEL_HEADER_INVALID_IID)
     , mPropsObserver(nullptr)
+    , mPendingNotifications(0)
+    , mSuppressedNotifications(0)
+    , mDeviceRole(OT_DEVICE_ROLE_DISABLED)
+    , mNetifUp(false)
+#if OTBR_ENABLE_PACKET_CAPTURE
+    , mPacketCapture(nullptr)
+#endif
 {
     std::fill_n(mWaitingKeyTable, SPINEL_PROP_LAST_STATUS, sizeof(mWaitingKeyTable));
     memset(mCmdTable, 0, sizeof(mCmdTable));
+    mDatasetActiveTlvs.mLength = 0;
 }
 
 void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aObserver)
@@ -72,9 +92,51 @@ void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aOb
 
 void NcpSpinel::Deinit(void)
 {
+    std::deque<PendingRequest> pendingRequests;
+
     mSpinelDriver              = nullptr;
     mIp6AddressTableCallback   = nullptr;
     mNetifStateChangedCallback = nullptr;
+    pendingRequests.swap(mPendingRequests);
+    mTransactionStats.mQueueDepth = 0;
+    mPendingNotifications         = 0;
+    mIp6AddressTable.clear();
+    mIp6MulticastAddressTable.clear();
+    mDatasetActiveTlvs.mLength = 0;
+
+    // The requests which are not sent are aborted once the state is reset, new requests of their callbacks fail.
+    for (PendingRequest &request : pendingRequests)
+    {
+        CallAndClear(request.mAsyncTask, OT_ERROR_INVALID_STATE, "Aborted by the deinitialization of NCP");
+    }
+}
+
+void NcpSpinel::GetPropertiesSnapshot(AsyncTaskPtr aAsyncTask)
+{
+    otError      error        = OT_ERROR_NONE;
+    EncodingFunc encodingFunc = [this] {
+        otError result = OT_ERROR_NONE;
+
+        // The first key is encoded with the command.
+        for (size_t i = 1; i < sizeof(kSnapshotProperties) / sizeof(kSnapshotProperties[0]); i++)
+        {
+            SuccessOrExit(result = mEncoder.WriteUintPacked(kSnapshotProperties[i]));
+        }
+
+    exit:
+        return result;
+    };
+
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_PROP_VALUE_MULTI_GET, kSnapshotProperties[0], encodingFunc,
+                                         mPropertiesGetTask, aAsyncTask));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to get the properties!");
+        });
+    }
 }
 
 otbrError NcpSpinel::SpinelDataUnpack(const uint8_t *aDataIn, spinel_size_t aDataLen, const char *aPackFormat, ...)
@@ -100,15 +162,15 @@ void NcpSpinel::DatasetSetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDa
         return mEncoder.WriteData(aActiveOpDatasetTlvs.mTlvs, aActiveOpDatasetTlvs.mLength);
     };
 
-    VerifyOrExit(mDatasetSetActiveTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc));
-    mDatasetSetActiveTask = aAsyncTask;
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS,
+                                         encodingFunc, mDatasetSetActiveTask, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post([aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to set active dataset!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to set active dataset!");
+        });
     }
 }
 
@@ -120,15 +182,15 @@ void NcpSpinel::DatasetMgmtSetPending(std::shared_ptr<otOperationalDatasetTlvs>
         return mEncoder.WriteData(aPendingOpDatasetTlvsPtr->mTlvs, aPendingOpDatasetTlvsPtr->mLength);
     };
 
-    VerifyOrExit(mDatasetMgmtSetPendingTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS, encodingFunc));
-    mDatasetMgmtSetPendingTask = aAsyncTask;
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS,
+                                         encodingFunc, mDatasetMgmtSetPendingTask, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post([aAsyncTask, error] { aAsyncTask->SetResult(error, "Failed to set pending dataset!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error] {
+            aAsyncTask->SetResult(error, "Failed to set pending dataset!");
+        });
     }
 }
 
@@ -137,27 +199,69 @@ void NcpSpinel::Ip6SetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [this, aEnable] { return mEncoder.WriteBool(aEnable); };
 
-    VerifyOrExit(mIp6SetEnabledTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc));
-    mIp6SetEnabledTask = aAsyncTask;
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_IF_UP, encodingFunc,
+                                         mIp6SetEnabledTask, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to enable the network interface!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to enable the network interface!");
+        });
     }
     return;
 }
 
-otbrError NcpSpinel::Ip6Send(const uint8_t *aData, uint16_t aLength)
+otbrError NcpSpinel::Ip6Send(FrameBuffer &aFrame)
 {
-    // TODO: Impelement this function.
-    OTBR_UNUSED_VARIABLE(aData);
-    OTBR_UNUSED_VARIABLE(aLength);
+    otbrError      error = OTBR_ERROR_NONE;
+    uint8_t        header[kStreamNetHeaderSize];
+    uint8_t        frame[kTxBufferSize];
+    const uint8_t *frameData;
+    uint16_t       frameLength;
+    spinel_ssize_t headerLength;
+
+    VerifyOrExit(mSpinelDriver != nullptr, error = OTBR_ERROR_INVALID_STATE);
+
+    // The datagram is sent as "data with length" in a PROP_VALUE_SET of STREAM_NET. Tid 0 is used
+    // as no transaction is tracked for datagrams.
+    headerLength = spinel_datatype_pack(header, sizeof(header), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT16_S,
+                                        SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid), SPINEL_CMD_PROP_VALUE_SET,
+                                        SPINEL_PROP_STREAM_NET, aFrame.GetLength());
+    VerifyOrExit(headerLength > 0 && static_cast<size_t>(headerLength) <= sizeof(header), error = OTBR_ERROR_PARSE);
+
+    if (aFrame.Prepend(header, static_cast<uint16_t>(headerLength)) == OTBR_ERROR_NONE)
+    {
+        frameData   = aFrame.GetData();
+        frameLength = aFrame.GetLength();
+    }
+    else
+    {
+        // Fall back to copying when the frame has no headroom for the spinel header.
+        VerifyOrExit(headerLength + aFrame.GetLength() <= kTxBufferSize, error = OTBR_ERROR_INVALID_ARGS);
+
+        memcpy(frame, header, static_cast<size_t>(headerLength));
+        memcpy(frame + headerLength, aFrame.GetData(), aFrame.GetLength());
+        mIp6Counters.mTxCopies++;
+
+        frameData   = frame;
+        frameLength = static_cast<uint16_t>(headerLength + aFrame.GetLength());
+    }
+
+#if OTBR_ENABLE_PACKET_CAPTURE
+    if (mPacketCapture != nullptr)
+    {
+        mPacketCapture->Capture(Utils::PacketCapture::kInterfaceSpinel, Utils::PacketCapture::kDirectionOutbound,
+                                frameData, frameLength);
+    }
+#endif
 
-    return OTBR_ERROR_NONE;
+    VerifyOrExit(mSpinelDriver->GetSpinelInterface()->SendFrame(frameData, frameLength) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
+    mIp6Counters.mTxPackets++;
+
+exit:
+    return error;
 }
 
 void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
@@ -165,16 +269,15 @@ void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [this, aEnable] { return mEncoder.WriteBool(aEnable); };
 
-    VerifyOrExit(mThreadSetEnabledTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc));
-    mThreadSetEnabledTask = aAsyncTask;
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_STACK_UP, encodingFunc,
+                                         mThreadSetEnabledTask, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to enable the Thread network!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to enable the Thread network!");
+        });
     }
     return;
 }
@@ -184,38 +287,33 @@ void NcpSpinel::ThreadDetachGracefully(AsyncTaskPtr aAsyncTask)
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [] { return OT_ERROR_NONE; };
 
-    VerifyOrExit(mThreadDetachGracefullyTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_LEAVE_GRACEFULLY, encodingFunc));
-    mThreadDetachGracefullyTask = aAsyncTask;
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_LEAVE_GRACEFULLY, encodingFunc,
+                                         mThreadDetachGracefullyTask, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        mTaskRunner.Post([aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to detach gracefully!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to detach gracefully!");
+        });
     }
     return;
 }
 
 void NcpSpinel::ThreadErasePersistentInfo(AsyncTaskPtr aAsyncTask)
 {
-    otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = GetNextTid();
-
-    VerifyOrExit(mThreadErasePersistentInfoTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
+    otError      error        = OT_ERROR_NONE;
+    EncodingFunc encodingFunc = [] { return OT_ERROR_NONE; };
 
-    mWaitingKeyTable[tid]          = SPINEL_PROP_LAST_STATUS;
-    mCmdTable[tid]                 = SPINEL_CMD_NET_CLEAR;
-    mThreadErasePersistentInfoTask = aAsyncTask;
+    SuccessOrExit(error = EnqueueRequest(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, encodingFunc,
+                                         mThreadErasePersistentInfoTask, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        FreeTidTableItem(tid);
-        mTaskRunner.Post(
-            [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to erase persistent info!"); });
+        mTaskRunner.Post(TaskRunner::Priority::kCritical, [aAsyncTask, error](void) {
+            aAsyncTask->SetResult(error, "Failed to erase persistent info!");
+        });
     }
 }
 
@@ -232,6 +330,16 @@ void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength, uin
 {
     spinel_tid_t tid = SPINEL_HEADER_GET_TID(aHeader);
 
+    OTBR_PROBE(ncp__spinel__frame__start, tid, aLength);
+
+#if OTBR_ENABLE_PACKET_CAPTURE
+    if (mPacketCapture != nullptr)
+    {
+        mPacketCapture->Capture(Utils::PacketCapture::kInterfaceSpinel, Utils::PacketCapture::kDirectionInbound, aFrame,
+                                aLength);
+    }
+#endif
+
     if (tid == 0)
     {
         HandleNotification(aFrame, aLength);
@@ -246,6 +354,11 @@ void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength, uin
     }
 
     aShouldSaveFrame = false;
+
+    // A response frees a tid and may complete an operation, which lets the queued requests proceed.
+    ProcessPendingRequests();
+
+    OTBR_PROBE(ncp__spinel__frame__end, tid, aLength);
 }
 
 void NcpSpinel::HandleSavedFrame(const uint8_t *aFrame, uint16_t aLength, void *aContext)
@@ -284,6 +397,12 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
     otbrError         error          = OTBR_ERROR_NONE;
     FailureHandler    failureHandler = nullptr;
 
+    // The response of a multi-property get carries many values.
+    if (mCmdTable[aTid] == SPINEL_CMD_PROP_VALUE_MULTI_GET)
+    {
+        ExitNow(error = HandleResponseForPropMultiGet(aFrame, aLength));
+    }
+
     SuccessOrExit(error = SpinelDataUnpack(aFrame, aLength, kSpinelDataUnpackFormat, &header, &cmd, &key, &data, &len));
 
     VerifyOrExit(cmd == SPINEL_CMD_PROP_VALUE_IS, error = OTBR_ERROR_INVALID_STATE);
@@ -300,6 +419,14 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
         spinel_status_t status = SPINEL_STATUS_OK;
 
         SuccessOrExit(error = SpinelDataUnpack(data, len, SPINEL_DATATYPE_UINT_PACKED_S, &status));
+
+        if (status == SPINEL_STATUS_OK)
+        {
+            // The active dataset is erased with the persistent info.
+            mDatasetActiveTlvs.mLength = 0;
+            ScheduleNotification(kNotificationDatasetActiveTlvs);
+        }
+
         CallAndClear(mThreadErasePersistentInfoTask, ot::Spinel::SpinelStatusToOtError(status));
         break;
     }
@@ -317,6 +444,7 @@ exit:
     {
         otbrLogCrit("Error parsing response with tid:%u", aTid);
     }
+    RecordTransactionLatency(aTid);
     FreeTidTableItem(aTid);
 }
 
@@ -343,8 +471,9 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
 
         SuccessOrExit(error = SpinelDataUnpack(aBuffer, aLength, SPINEL_DATATYPE_UINT8_S, &role));
 
-        deviceRole = SpinelRoleToDeviceRole(role);
-        mPropsObserver->SetDeviceRole(deviceRole);
+        deviceRole  = SpinelRoleToDeviceRole(role);
+        mDeviceRole = deviceRole;
+        ScheduleNotification(kNotificationDeviceRole);
 
         otbrLogInfo("Device role changed to %s", otThreadDeviceRoleToString(deviceRole));
         break;
@@ -367,21 +496,28 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
 
     case SPINEL_PROP_IPV6_ADDRESS_TABLE:
     {
-        std::vector<Ip6AddressInfo> addressInfoTable;
-
-        VerifyOrExit(ParseIp6AddressTable(aBuffer, aLength, addressInfoTable) == OT_ERROR_NONE,
+        mIp6AddressTableScratch.clear();
+        VerifyOrExit(ParseIp6AddressTable(aBuffer, aLength, mIp6AddressTableScratch) == OT_ERROR_NONE,
                      error = OTBR_ERROR_PARSE);
-        SafeInvoke(mIp6AddressTableCallback, addressInfoTable);
+
+        // The NCP reports the whole table on each change, skip the updates which change nothing.
+        std::sort(mIp6AddressTableScratch.begin(), mIp6AddressTableScratch.end());
+        VerifyOrExit(mIp6AddressTableScratch != mIp6AddressTable);
+        mIp6AddressTable.swap(mIp6AddressTableScratch);
+        ScheduleNotification(kNotificationIp6AddressTable);
         break;
     }
 
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
     {
-        std::vector<Ip6Address> addressTable;
-
-        VerifyOrExit(ParseIp6MulticastAddresses(aBuffer, aLength, addressTable) == OT_ERROR_NONE,
+        mIp6MulticastAddressTableScratch.clear();
+        VerifyOrExit(ParseIp6MulticastAddresses(aBuffer, aLength, mIp6MulticastAddressTableScratch) == OT_ERROR_NONE,
                      error = OTBR_ERROR_PARSE);
-        SafeInvoke(mIp6MulticastAddressTableCallback, addressTable);
+
+        std::sort(mIp6MulticastAddressTableScratch.begin(), mIp6MulticastAddressTableScratch.end());
+        VerifyOrExit(mIp6MulticastAddressTableScratch != mIp6MulticastAddressTable);
+        mIp6MulticastAddressTable.swap(mIp6MulticastAddressTableScratch);
+        ScheduleNotification(kNotificationIp6MulticastAddressTable);
         break;
     }
 
@@ -389,7 +525,31 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
     {
         bool isUp;
         SuccessOrExit(error = SpinelDataUnpack(aBuffer, aLength, SPINEL_DATATYPE_BOOL_S, &isUp));
-        SafeInvoke(mNetifStateChangedCallback, isUp);
+        mNetifUp = isUp;
+        ScheduleNotification(kNotificationNetifState);
+        break;
+    }
+
+    case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
+    {
+        VerifyOrExit(aLength <= sizeof(mDatasetActiveTlvs.mTlvs), error = OTBR_ERROR_PARSE);
+        VerifyOrExit(aLength != mDatasetActiveTlvs.mLength || memcmp(aBuffer, mDatasetActiveTlvs.mTlvs, aLength) != 0);
+
+        memcpy(mDatasetActiveTlvs.mTlvs, aBuffer, aLength);
+        mDatasetActiveTlvs.mLength = static_cast<uint8_t>(aLength);
+        ScheduleNotification(kNotificationDatasetActiveTlvs);
+        break;
+    }
+
+    case SPINEL_PROP_STREAM_NET:
+    {
+        const uint8_t *data;
+        spinel_size_t  len;
+
+        // The datagram is passed as a slice of the received frame without copying.
+        SuccessOrExit(error = SpinelDataUnpack(aBuffer, aLength, SPINEL_DATATYPE_DATA_WLEN_S, &data, &len));
+        mIp6Counters.mRxPackets++;
+        SafeInvoke(mIp6ReceiveCallback, data, static_cast<uint16_t>(len));
         break;
     }
 
@@ -403,6 +563,59 @@ exit:
     return;
 }
 
+void NcpSpinel::ScheduleNotification(Notification aNotification)
+{
+    // Unsolicited updates arrive in bursts, e.g. when attaching. Only the latest state of each
+    // property received within a mainloop iteration is dispatched.
+    if (mPendingNotifications & aNotification)
+    {
+        mSuppressedNotifications++;
+        ExitNow();
+    }
+
+    if (mPendingNotifications == 0)
+    {
+        mTaskRunner.Post([this](void) { DispatchNotifications(); });
+    }
+
+    mPendingNotifications |= aNotification;
+
+exit:
+    return;
+}
+
+void NcpSpinel::DispatchNotifications(void)
+{
+    uint8_t notifications = mPendingNotifications;
+
+    mPendingNotifications = 0;
+
+    if ((notifications & kNotificationDeviceRole) && mPropsObserver != nullptr)
+    {
+        mPropsObserver->SetDeviceRole(mDeviceRole);
+    }
+
+    if (notifications & kNotificationIp6AddressTable)
+    {
+        SafeInvoke(mIp6AddressTableCallback, mIp6AddressTable);
+    }
+
+    if (notifications & kNotificationIp6MulticastAddressTable)
+    {
+        SafeInvoke(mIp6MulticastAddressTableCallback, mIp6MulticastAddressTable);
+    }
+
+    if (notifications & kNotificationNetifState)
+    {
+        SafeInvoke(mNetifStateChangedCallback, mNetifUp);
+    }
+
+    if ((notifications & kNotificationDatasetActiveTlvs) && mPropsObserver != nullptr)
+    {
+        mPropsObserver->SetDatasetActiveTlvs(mDatasetActiveTlvs);
+    }
+}
+
 otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
                                               spinel_prop_key_t aKey,
                                               const uint8_t    *aData,
@@ -417,6 +630,8 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
     {
     case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
         VerifyOrExit(aKey == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, error = OTBR_ERROR_INVALID_STATE);
+        // The response carries the new active dataset.
+        HandleValueIs(aKey, aData, aLength);
         CallAndClear(mDatasetSetActiveTask, OT_ERROR_NONE);
         break;
 
@@ -458,6 +673,64 @@ exit:
     return error;
 }
 
+otbrError NcpSpinel::HandleResponseForPropMultiGet(const uint8_t *aFrame, uint16_t aLength)
+{
+    otbrError         error  = OTBR_ERROR_NONE;
+    otError           result = OT_ERROR_NONE;
+    uint8_t           header;
+    unsigned int      cmd;
+    spinel_prop_key_t key;
+    spinel_ssize_t    unpacked;
+
+    unpacked = spinel_datatype_unpack(aFrame, aLength, SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT_PACKED_S, &header,
+                                      &cmd);
+    VerifyOrExit(unpacked > 0, error = OTBR_ERROR_PARSE);
+    aFrame += unpacked;
+    aLength -= static_cast<uint16_t>(unpacked);
+
+    if (cmd == SPINEL_CMD_PROP_VALUE_IS)
+    {
+        // The whole request is rejected with a LAST_STATUS, e.g. by an NCP without multi-property get support.
+        spinel_status_t status = SPINEL_STATUS_OK;
+
+        SuccessOrExit(error = SpinelDataUnpack(aFrame, aLength,
+                                               SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S, &key,
+                                               &status));
+        VerifyOrExit(key == SPINEL_PROP_LAST_STATUS, error = OTBR_ERROR_PARSE);
+        ExitNow(result = ot::Spinel::SpinelStatusToOtError(status));
+    }
+
+    VerifyOrExit(cmd == SPINEL_CMD_PROP_VALUES_ARE, error = OTBR_ERROR_PARSE);
+
+    while (aLength > 0)
+    {
+        const uint8_t *entry;
+        spinel_size_t  entryLength;
+        spinel_ssize_t keyLength;
+        uint16_t       valueLength;
+
+        unpacked = spinel_datatype_unpack(aFrame, aLength, SPINEL_DATATYPE_DATA_WLEN_S, &entry, &entryLength);
+        VerifyOrExit(unpacked > 0, error = OTBR_ERROR_PARSE);
+        aFrame += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+
+        keyLength = spinel_datatype_unpack(entry, entryLength, SPINEL_DATATYPE_UINT_PACKED_S, &key);
+        VerifyOrExit(keyLength > 0, error = OTBR_ERROR_PARSE);
+        valueLength = static_cast<uint16_t>(entryLength - static_cast<spinel_size_t>(keyLength));
+
+        // A property which the NCP fails to get is reported as a LAST_STATUS in place of its value.
+        HandleValueIs(key, entry + keyLength, valueLength);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        result = OT_ERROR_PARSE;
+    }
+    CallAndClear(mPropertiesGetTask, result);
+    return error;
+}
+
 spinel_tid_t NcpSpinel::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -477,6 +750,7 @@ spinel_tid_t NcpSpinel::GetNextTid(void)
 
     mCmdTidsInUse |= (1 << tid);
     mCmdNextTid = SPINEL_GET_NEXT_TID(tid);
+    UpdateInFlightTransactions();
 
 exit:
     return tid;
@@ -485,46 +759,178 @@ exit:
 void NcpSpinel::FreeTidTableItem(spinel_tid_t aTid)
 {
     mCmdTidsInUse &= ~(1 << aTid);
+    UpdateInFlightTransactions();
 
     mCmdTable[aTid]        = SPINEL_CMD_NOOP;
     mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
 }
 
-otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
+void NcpSpinel::UpdateInFlightTransactions(void)
 {
-    otError      error  = OT_ERROR_NONE;
-    spinel_tid_t tid    = GetNextTid();
-    uint8_t      header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
+    mTransactionStats.mInFlightTransactions = static_cast<uint32_t>(std::bitset<kMaxTids>(mCmdTidsInUse).count());
+}
 
-    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
-    SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_SET, aKey));
-    SuccessOrExit(error = aEncodingFunc());
-    SuccessOrExit(error = mEncoder.EndFrame());
-    SuccessOrExit(error = SendEncodedFrame());
+otError NcpSpinel::EnqueueRequest(spinel_command_t    aCmd,
+                                  spinel_prop_key_t   aKey,
+                                  const EncodingFunc &aEncodingFunc,
+                                  AsyncTaskPtr       &aTaskSlot,
+                                  AsyncTaskPtr        aAsyncTask)
+{
+    otError        error = OT_ERROR_NONE;
+    PendingRequest request;
+
+    VerifyOrExit(mSpinelDriver != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(mPendingRequests.size() < kMaxPendingRequests, error = OT_ERROR_BUSY);
+
+    // The frame is encoded right away since the encoding function may refer to the caller's data.
+    SuccessOrExit(error = EncodeFrame(aCmd, aKey, aEncodingFunc, request.mFrame));
+
+    request.mCmd        = aCmd;
+    request.mKey        = aKey;
+    request.mTaskSlot   = &aTaskSlot;
+    request.mAsyncTask  = std::move(aAsyncTask);
+    request.mQueuedTime = Clock::now();
+    mPendingRequests.push_back(std::move(request));
+
+    mTransactionStats.mMaxQueueDepth =
+        std::max(mTransactionStats.mMaxQueueDepth, static_cast<uint32_t>(mPendingRequests.size()));
+
+    ProcessPendingRequests();
 
-    mCmdTable[tid]        = SPINEL_CMD_PROP_VALUE_SET;
-    mWaitingKeyTable[tid] = aKey;
 exit:
-    if (error != OT_ERROR_NONE)
+    return error;
+}
+
+void NcpSpinel::ProcessPendingRequests(void)
+{
+    VerifyOrExit(mSpinelDriver != nullptr);
+
+    for (auto it = mPendingRequests.begin(); it != mPendingRequests.end();)
     {
-        FreeTidTableItem(tid);
+        spinel_tid_t tid;
+        uint16_t     frameLength = static_cast<uint16_t>(it->mFrame.size());
+        otError      error;
+        Timepoint    sendTime;
+        Timepoint    sentTime;
+
+        // Requests of the same operation are sent one by one in the order of queuing, while
+        // requests of different operations are pipelined.
+        if (*it->mTaskSlot != nullptr)
+        {
+            ++it;
+            continue;
+        }
+
+        tid = GetNextTid();
+        VerifyOrExit(tid != 0);
+
+        it->mFrame[0] = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
+
+#if OTBR_ENABLE_PACKET_CAPTURE
+        if (mPacketCapture != nullptr)
+        {
+            mPacketCapture->Capture(Utils::PacketCapture::kInterfaceSpinel, Utils::PacketCapture::kDirectionOutbound,
+                                    it->mFrame.data(), frameLength);
+        }
+#endif
+
+        sendTime = Clock::now();
+        error    = mSpinelDriver->GetSpinelInterface()->SendFrame(it->mFrame.data(), frameLength);
+        sentTime = Clock::now();
+
+        // A slow send means the spinel interface is congested, e.g. the HDLC writes to the UART are blocked.
+        mTransactionStats.mSendTime.Record(std::chrono::duration_cast<Microseconds>(sentTime - sendTime));
+
+        if (error == OT_ERROR_NONE)
+        {
+            mCmdTable[tid]        = it->mCmd;
+            mWaitingKeyTable[tid] = it->mKey;
+            mTidQueuedTime[tid]   = it->mQueuedTime;
+            mTidSentTime[tid]     = sentTime;
+            *it->mTaskSlot        = std::move(it->mAsyncTask);
+            mTransactionStats.mQueueTime.Record(std::chrono::duration_cast<Microseconds>(sendTime - it->mQueuedTime));
+        }
+        else
+        {
+            AsyncTaskPtr task = std::move(it->mAsyncTask);
+
+            FreeTidTableItem(tid);
+            mTaskRunner.Post(TaskRunner::Priority::kCritical, [task, error](void) {
+                task->SetResult(error, "Failed to send the request to NCP!");
+            });
+        }
+
+        it = mPendingRequests.erase(it);
     }
-    return error;
+
+exit:
+    mTransactionStats.mQueueDepth = static_cast<uint32_t>(mPendingRequests.size());
+}
+
+void NcpSpinel::RecordTransactionLatency(spinel_tid_t aTid)
+{
+    Timepoint                 now = Clock::now();
+    uint64_t                  latency;
+    TransactionStats::Command command;
+
+    VerifyOrExit(mCmdTable[aTid] != SPINEL_CMD_NOOP);
+
+    latency = static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(now - mTidQueuedTime[aTid]).count());
+
+    switch (mCmdTable[aTid])
+    {
+    case SPINEL_CMD_PROP_VALUE_GET:
+        command = TransactionStats::kCommandGet;
+        break;
+    case SPINEL_CMD_PROP_VALUE_SET:
+        command = TransactionStats::kCommandSet;
+        break;
+    case SPINEL_CMD_PROP_VALUE_INSERT:
+        command = TransactionStats::kCommandInsert;
+        break;
+    case SPINEL_CMD_PROP_VALUE_REMOVE:
+        command = TransactionStats::kCommandRemove;
+        break;
+    default:
+        command = TransactionStats::kCommandOther;
+        break;
+    }
+
+    mTransactionStats.mCompletedTransactions++;
+    mTransactionStats.mTotalLatencyUs += latency;
+    mTransactionStats.mMaxLatencyUs = std::max(mTransactionStats.mMaxLatencyUs, latency);
+    mTransactionStats.mResponseTime[command].Record(std::chrono::duration_cast<Microseconds>(now - mTidSentTime[aTid]));
+
+    otbrLogDebug("Transaction tid:%u (cmd:%u, key:%u) completed in %" PRIu64 "us", aTid, mCmdTable[aTid],
+                 mWaitingKeyTable[aTid], latency);
+
+exit:
+    return;
 }
 
-otError NcpSpinel::SendEncodedFrame(void)
+otError NcpSpinel::EncodeFrame(spinel_command_t      aCmd,
+                               spinel_prop_key_t     aKey,
+                               const EncodingFunc   &aEncodingFunc,
+                               std::vector<uint8_t> &aFrame)
 {
-    otError  error = OT_ERROR_NONE;
-    uint8_t  frame[kTxBufferSize];
+    otError  error  = OT_ERROR_NONE;
+    uint8_t  header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid); // The tid is filled when sending the frame.
     uint16_t frameLength;
 
+    SuccessOrExit(error = mEncoder.BeginFrame(header, aCmd, aKey));
+    SuccessOrExit(error = aEncodingFunc());
+    SuccessOrExit(error = mEncoder.EndFrame());
+
     SuccessOrExit(error = mNcpBuffer.OutFrameBegin());
     frameLength = mNcpBuffer.OutFrameGetLength();
-    VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, frame) == frameLength, error = OT_ERROR_FAILED);
-    SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(frame, frameLength));
+    aFrame.resize(frameLength);
+    VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, aFrame.data()) == frameLength, error = OT_ERROR_FAILED);
 
 exit:
-    error = mNcpBuffer.OutFrameRemove();
+    if (mNcpBuffer.OutFrameRemove() != OT_ERROR_NONE && error == OT_ERROR_NONE)
+    {
+        error = OT_ERROR_FAILED;
+    }
     return error;
 }
 
@@ -564,7 +970,7 @@ exit:
     return error;
 }
 
-otError NcpSpinel::ParseIp6MulticastAddresses(const uint8_t *aBuf, uint8_t aLen, std::vector<Ip6Address> &aAddressList)
+otError NcpSpinel::ParseIp6MulticastAddresses(const uint8_t *aBuf, uint16_t aLen, std::vector<Ip6Address> &aAddressList)
 {
     otError             error = OT_ERROR_NONE;
     ot::Spinel::Decoder decoder;
@@ -34,8 +34,11 @@
 #ifndef OTBR_AGENT_NCP_SPINEL_HPP_
 #define OTBR_AGENT_NCP_SPINEL_HPP_
 
+#include <bitset>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <openthread/dataset.h>
 #include <openthread/error.h>
@@ -47,9 +50,13 @@
 #include "lib/spinel/spinel_driver.hpp"
 #include "lib/spinel/spinel_encoder.hpp"
 
+#include "common/frame_buffer.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "ncp/async_task.hpp"
+#include "utils/packet_capture.hpp"
 
 namespace otbr {
 namespace Ncp {
@@ -69,6 +76,14 @@ public:
      */
     virtual void SetDeviceRole(otDeviceRole aRole) = 0;
 
+    /**
+     * Updates the active dataset.
+     *
+     * @param[in] aActiveOpDatasetTlvs  The active dataset tlvs, whose length is 0 if there is no active dataset.
+     *
+     */
+    virtual void SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs) = 0;
+
     /**
      * The destructor.
      *
@@ -86,6 +101,60 @@ public:
     using Ip6AddressTableCallback          = std::function<void(const std::vector<Ip6AddressInfo> &)>;
     using Ip6MulticastAddressTableCallback = std::function<void(const std::vector<Ip6Address> &)>;
     using NetifStateChangedCallback        = std::function<void(bool)>;
+    using Ip6ReceiveCallback               = std::function<void(const uint8_t *, uint16_t)>;
+
+    /**
+     * The maximum size of the spinel header, command, key and length before the datagram of a STREAM_NET frame.
+     *
+     */
+    static constexpr uint8_t kStreamNetHeaderSize = 8;
+
+    /**
+     * This structure represents the counters of the IP6 datagrams exchanged with the NCP.
+     *
+     * The copy counters count the copies of the datagram payloads made by NcpSpinel, which
+     * should stay zero unless a frame without enough headroom is sent.
+     *
+     */
+    struct Ip6Counters
+    {
+        uint64_t mTxPackets = 0; ///< The number of datagrams sent to the NCP.
+        uint64_t mTxCopies  = 0; ///< The number of payload copies when sending datagrams.
+        uint64_t mRxPackets = 0; ///< The number of datagrams received from the NCP.
+        uint64_t mRxCopies  = 0; ///< The number of payload copies when receiving datagrams.
+    };
+
+    /**
+     * This structure represents the statistics of the spinel transactions sent to the NCP.
+     *
+     */
+    struct TransactionStats
+    {
+        /**
+         * This enumeration represents the spinel commands whose response times are recorded separately.
+         *
+         */
+        enum Command : uint8_t
+        {
+            kCommandGet,    ///< SPINEL_CMD_PROP_VALUE_GET
+            kCommandSet,    ///< SPINEL_CMD_PROP_VALUE_SET
+            kCommandInsert, ///< SPINEL_CMD_PROP_VALUE_INSERT
+            kCommandRemove, ///< SPINEL_CMD_PROP_VALUE_REMOVE
+            kCommandOther,  ///< The other commands, e.g. SPINEL_CMD_NET_CLEAR
+            kNumCommands,
+        };
+
+        uint32_t mQueueDepth            = 0; ///< The number of requests waiting for a tid or a previous request.
+        uint32_t mMaxQueueDepth         = 0; ///< The maximum number of requests waiting at the same time.
+        uint32_t mInFlightTransactions  = 0; ///< The number of transactions sent and waiting for their response.
+        uint32_t mCompletedTransactions = 0; ///< The number of transactions which received a response.
+        uint64_t mTotalLatencyUs        = 0; ///< The total latency from queuing to receiving the response.
+        uint64_t mMaxLatencyUs          = 0; ///< The maximum latency from queuing to receiving the response.
+
+        MainloopHistogram mQueueTime;                  ///< The time from queuing a request to sending it.
+        MainloopHistogram mSendTime;                   ///< The time taken by the spinel interface to send a request.
+        MainloopHistogram mResponseTime[kNumCommands]; ///< The time from sending a request to receiving its response.
+    };
 
     /**
      * Constructor.
@@ -114,11 +183,37 @@ public:
      */
     const char *GetCoprocessorVersion(void) { return mSpinelDriver->GetVersion(); }
 
+    /**
+     * Returns the statistics of the spinel transactions.
+     *
+     */
+    const TransactionStats &GetTransactionStats(void) const { return mTransactionStats; }
+
+    /**
+     * Returns the number of property change notifications which were merged into a later one.
+     *
+     * Notifications of the same property received within one mainloop iteration are dispatched once
+     * with the final state.
+     *
+     */
+    uint32_t GetSuppressedNotificationCount(void) const { return mSuppressedNotifications; }
+
+    /**
+     * This method gets the properties of the NCP which are then kept up to date by its notifications.
+     *
+     * The properties are requested with a single multi-property get. Each value is reported to the properties
+     * observer and the callbacks in the same way as the notification of its change.
+     *
+     * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
+     *
+     */
+    void GetPropertiesSnapshot(AsyncTaskPtr aAsyncTask);
+
     /**
      * This method sets the active dataset on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * If this method is called again before the previous call completed, the new request is queued
+     * and sent once the previous one completes.
      *
      * @param[in] aActiveOpDatasetTlvs  A reference to the active operational dataset of the Thread network.
      * @param[in] aAsyncTask            A pointer to an async result to receive the result of this operation.
@@ -129,8 +224,8 @@ public:
     /**
      * This method instructs the NCP to send a MGMT_SET to set Thread Pending Operational Dataset.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * If this method is called again before the previous call completed, the new request is queued
+     * and sent once the previous one completes.
      *
      * @param[in] aPendingOpDatasetTlvsPtr  A shared pointer to the pending operational dataset of the Thread network.
      * @param[in] aAsyncTask                A pointer to an async result to receive the result of this operation.
@@ -142,8 +237,8 @@ public:
     /**
      * This method enableds/disables the IP6 on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * If this method is called again before the previous call completed, the new request is queued
+     * and sent once the previous one completes.
      *
      * @param[in] aEnable     TRUE to enable and FALSE to disable.
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
@@ -154,8 +249,8 @@ public:
     /**
      * This method sets the callback to receive the IPv6 address table from the NCP.
      *
-     * The callback will be invoked when receiving an IPv6 address table from the NCP. When the
-     * callback is invoked, the callback MUST copy the otIp6AddressInfo objects and maintain it
+     * The callback will be invoked from the mainloop with the latest IPv6 address table received
+     * from the NCP. When the callback is invoked, the callback MUST copy the otIp6AddressInfo objects and maintain it
      * if it's not used immediately (within the callback).
      *
      * @param[in] aCallback  The callback to handle the IP6 address table.
@@ -168,8 +263,8 @@ public:
      *
      * @param[in] aCallback  The callback to handle the IPv6 address table.
      *
-     * The callback will be invoked when receiving an IPv6 multicast address table from the NCP.
-     * When the callback is invoked, the callback MUST copy the otIp6Address objects and maintain it
+     * The callback will be invoked from the mainloop with the latest IPv6 multicast address table
+     * received from the NCP. When the callback is invoked, the callback MUST copy the otIp6Address objects and maintain it
      * if it's not used immediately (within the callback).
      *
      */
@@ -181,20 +276,50 @@ public:
     /**
      * This methods sends an IP6 datagram through the NCP.
      *
-     * @param[in] aData      A pointer to the beginning of the IP6 datagram.
-     * @param[in] aLength    The length of the datagram.
+     * The spinel header is prepended to @p aFrame in place, the datagram is only copied
+     * when the headroom of @p aFrame is not large enough.
+     *
+     * @param[in] aFrame  The frame holding the IP6 datagram.
+     *
+     * @retval OTBR_ERROR_NONE           The datagram is sent to NCP successfully.
+     * @retval OTBR_ERROR_INVALID_STATE  NcpSpinel is not initialized.
+     * @retval OTBR_ERROR_OPENTHREAD     Failed to send the datagram to NCP.
      *
-     * @retval OTBR_ERROR_NONE  The datagram is sent to NCP successfully.
-     * @retval OTBR_ERROR_BUSY  NcpSpinel is busy with other requests.
+     */
+    otbrError Ip6Send(FrameBuffer &aFrame);
+
+    /**
+     * This method sets the callback to receive IP6 datagrams from the NCP.
+     *
+     * The datagram passed to the callback points into the received spinel frame, the callback
+     * MUST NOT keep the pointer after it returns.
+     *
+     * @param[in] aCallback  The callback to receive IP6 datagrams.
      *
      */
-    otbrError Ip6Send(const uint8_t *aData, uint16_t aLength);
+    void Ip6SetReceiveCallback(const Ip6ReceiveCallback &aCallback) { mIp6ReceiveCallback = aCallback; }
+
+    /**
+     * Returns the counters of the IP6 datagrams exchanged with the NCP.
+     *
+     */
+    const Ip6Counters &GetIp6Counters(void) const { return mIp6Counters; }
+
+#if OTBR_ENABLE_PACKET_CAPTURE
+    /**
+     * This method sets the capture ring of the spinel frames exchanged with the NCP.
+     *
+     * @param[in] aPacketCapture  A pointer to the capture ring, or nullptr to stop capturing.
+     *
+     */
+    void SetPacketCapture(Utils::PacketCapture *aPacketCapture) { mPacketCapture = aPacketCapture; }
+#endif
 
     /**
      * This method enableds/disables the Thread network on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * If this method is called again before the previous call completed, the new request is queued
+     * and sent once the previous one completes.
      *
      * @param[in] aEnable     TRUE to enable and FALSE to disable.
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
@@ -205,8 +330,8 @@ public:
     /**
      * This method instructs the device to leave the current network gracefully.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * If this method is called again before the previous call completed, the new request is queued
+     * and sent once the previous one completes.
      *
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
      *
@@ -216,8 +341,8 @@ public:
     /**
      * This method instructs the NCP to erase the persistent network info.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * If this method is called again before the previous call completed, the new request is queued
+     * and sent once the previous one completes.
      *
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
      *
@@ -238,8 +363,13 @@ public:
 private:
     using FailureHandler = std::function<void(otError)>;
 
+    // Spinel tids are 4 bits wide and tid 0 is reserved for notifications,
+    // so at most 15 transactions can be in flight.
     static constexpr uint8_t kMaxTids = 16;
 
+    // The maximum number of requests waiting for a tid or for a previous request of the same operation.
+    static constexpr uint8_t kMaxPendingRequests = 32;
+
     template <typename Function, typename... Args> static void SafeInvoke(Function &aFunc, Args &&...aArgs)
     {
         if (aFunc)
@@ -281,11 +411,46 @@ private:
     void         FreeTidTableItem(spinel_tid_t aTid);
 
     using EncodingFunc = std::function<otError(void)>;
-    otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
-    otError SendEncodedFrame(void);
+
+    struct PendingRequest
+    {
+        spinel_command_t     mCmd;
+        spinel_prop_key_t    mKey;
+        std::vector<uint8_t> mFrame;     ///< The encoded frame, the tid in the header is filled when sending.
+        AsyncTaskPtr        *mTaskSlot;  ///< The slot to hold @p mAsyncTask while the operation is in flight.
+        AsyncTaskPtr         mAsyncTask;
+        Timepoint            mQueuedTime;
+    };
+
+    otError EnqueueRequest(spinel_command_t    aCmd,
+                           spinel_prop_key_t   aKey,
+                           const EncodingFunc &aEncodingFunc,
+                           AsyncTaskPtr       &aTaskSlot,
+                           AsyncTaskPtr        aAsyncTask);
+    void    ProcessPendingRequests(void);
+    void    RecordTransactionLatency(spinel_tid_t aTid);
+    void    UpdateInFlightTransactions(void);
+    otError EncodeFrame(spinel_command_t      aCmd,
+                        spinel_prop_key_t     aKey,
+                        const EncodingFunc   &aEncodingFunc,
+                        std::vector<uint8_t> &aFrame);
+
+    enum Notification : uint8_t
+    {
+        kNotificationDeviceRole               = 1 << 0,
+        kNotificationIp6AddressTable          = 1 << 1,
+        kNotificationIp6MulticastAddressTable = 1 << 2,
+        kNotificationNetifState               = 1 << 3,
+        kNotificationDatasetActiveTlvs        = 1 << 4,
+    };
+
+    void ScheduleNotification(Notification aNotification);
+    void DispatchNotifications(void);
+
+    otbrError HandleResponseForPropMultiGet(const uint8_t *aFrame, uint16_t aLength);
 
     otError ParseIp6AddressTable(const uint8_t *aBuf, uint16_t aLength, std::vector<Ip6AddressInfo> &aAddressTable);
-    otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint8_t aLen, std::vector<Ip6Address> &aAddressList);
+    otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint16_t aLen, std::vector<Ip6Address> &aAddressList);
 
     ot::Spinel::SpinelDriver *mSpinelDriver;
     uint16_t                  mCmdTidsInUse; ///< Used transaction ids.
@@ -301,20 +466,45 @@ private:
     ot::Spinel::Encoder       mEncoder;
     spinel_iid_t              mIid; /// < Interface Id used to in Spinel header
 
+    std::deque<PendingRequest> mPendingRequests;
+    Timepoint                  mTidQueuedTime[kMaxTids]; ///< The time when the request of each tid was queued.
+    Timepoint                  mTidSentTime[kMaxTids];   ///< The time when the request of each tid was sent.
+    TransactionStats           mTransactionStats;
+
     TaskRunner mTaskRunner;
 
     PropsObserver *mPropsObserver;
 
+    uint8_t      mPendingNotifications;    ///< The notifications waiting to be dispatched.
+    uint32_t     mSuppressedNotifications; ///< The notifications merged into a later one.
+    otDeviceRole mDeviceRole;              ///< The latest device role reported by the NCP.
+    bool         mNetifUp;                 ///< The latest network interface state reported by the NCP.
+
+    otOperationalDatasetTlvs mDatasetActiveTlvs; ///< The latest active dataset reported by the NCP.
+
     AsyncTaskPtr mDatasetSetActiveTask;
     AsyncTaskPtr mDatasetMgmtSetPendingTask;
     AsyncTaskPtr mIp6SetEnabledTask;
     AsyncTaskPtr mThreadSetEnabledTask;
     AsyncTaskPtr mThreadDetachGracefullyTask;
     AsyncTaskPtr mThreadErasePersistentInfoTask;
+    AsyncTaskPtr mPropertiesGetTask;
 
     Ip6AddressTableCallback          mIp6AddressTableCallback;
     Ip6MulticastAddressTableCallback mIp6MulticastAddressTableCallback;
     NetifStateChangedCallback        mNetifStateChangedCallback;
+    Ip6ReceiveCallback               mIp6ReceiveCallback;
+    Ip6Counters                      mIp6Counters;
+
+#if OTBR_ENABLE_PACKET_CAPTURE
+    Utils::PacketCapture *mPacketCapture;
+#endif
+
+    // The last address tables received from the NCP, sorted and reused across updates.
+    std::vector<Ip6AddressInfo> mIp6AddressTable;
+    std::vector<Ip6AddressInfo> mIp6AddressTableScratch;
+    std::vector<Ip6Address>     mIp6MulticastAddressTable;
+    std::vector<Ip6Address>     mIp6MulticastAddressTableScratch;
 };
 
 } // namespace Ncp
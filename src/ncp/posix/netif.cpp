@@ -34,28 +34,50 @@
 #include <fcntl.h>
 #include <net/if.h>
 #include <net/if_arp.h>
+#include <netinet/icmp6.h>
 #include <netinet/in.h>
+#include <netinet/ip6.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <iterator>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/probes.hpp"
 #include "common/types.hpp"
 #include "utils/socket_utils.hpp"
 
 namespace otbr {
 
+constexpr uint16_t Netif::kIp6SendHeadroom;
+constexpr uint8_t  Netif::kEgressClassCount;
+
+static bool IsIp6ExtensionHeader(uint8_t aNextHeader)
+{
+    return aNextHeader == IPPROTO_HOPOPTS || aNextHeader == IPPROTO_ROUTING || aNextHeader == IPPROTO_DSTOPTS;
+}
+
+// The egress queues of the network control traffic drop their oldest packet when full, which has most likely been
+// retransmitted already. The others drop the new packet.
+static constexpr bool kEgressQueueDropsOldest[Netif::kEgressClassCount] = {true, false, false};
+
 Netif::Netif(void)
     : mTunFd(-1)
     , mIpFd(-1)
     , mNetlinkFd(-1)
     , mNetlinkSequence(0)
+    , mTunHeaderSize(0)
     , mNetifIndex(0)
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    , mHostMulticastFilterValid(false)
+    , mHostMulticastFilterChanged(false)
+#endif
 {
 }
 
@@ -66,6 +88,13 @@ otbrError Netif::Init(const std::string &aInterfaceName, const Ip6SendFunc &aIp6
     VerifyOrExit(aIp6SendFunc, error = OTBR_ERROR_INVALID_ARGS);
     mIp6SendFunc = aIp6SendFunc;
 
+    // A packet is always read into a free buffer before it's known which egress queue it belongs to.
+    mEgressPackets.resize(kEgressClassCount * kIp6EgressQueueSize + 1);
+    for (uint16_t i = 0; i < mEgressPackets.size(); i++)
+    {
+        mFreeEgressPackets.push_back(i);
+    }
+
     mIpFd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketNonBlock);
     VerifyOrExit(mIpFd >= 0, error = OTBR_ERROR_ERRNO);
 
@@ -77,6 +106,10 @@ otbrError Netif::Init(const std::string &aInterfaceName, const Ip6SendFunc &aIp6
 
     PlatformSpecificInit();
 
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    UpdateHostMulticastFilter();
+#endif
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -100,7 +133,35 @@ void Netif::Process(const MainloopContext *aContext)
 
     if (FD_ISSET(mTunFd, &aContext->mReadFdSet))
     {
-        ProcessIp6Send();
+        ProcessIp6Send(mTunFd);
+    }
+
+    for (int queueFd : mTunQueueFds)
+    {
+        if (FD_ISSET(queueFd, &aContext->mErrorFdSet))
+        {
+            DieNow("Error on Tun queue Fd!");
+        }
+
+        if (FD_ISSET(queueFd, &aContext->mReadFdSet))
+        {
+            ProcessIp6Send(queueFd);
+        }
+    }
+
+    SendEgressPackets();
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    // All the MLD reports of a mainloop iteration refresh the filter once.
+    if (mHostMulticastFilterChanged)
+    {
+        UpdateHostMulticastFilter();
+    }
+#endif
+
+    if (mNetlinkFd >= 0 && FD_ISSET(mNetlinkFd, &aContext->mReadFdSet))
+    {
+        ProcessNetlinkEvents();
     }
 }
 
@@ -117,61 +178,94 @@ void Netif::UpdateFdSet(MainloopContext *aContext)
     {
         aContext->mMaxFd = mTunFd;
     }
+
+    for (int queueFd : mTunQueueFds)
+    {
+        FD_SET(queueFd, &aContext->mReadFdSet);
+        FD_SET(queueFd, &aContext->mErrorFdSet);
+        aContext->mMaxFd = std::max(aContext->mMaxFd, queueFd);
+    }
+
+    // The packets left in the egress queues are sent in the next iteration without waiting.
+    if (HasEgressPackets())
+    {
+        aContext->mTimeout.tv_sec  = 0;
+        aContext->mTimeout.tv_usec = 0;
+    }
+
+    // Acknowledgements of the netlink requests are processed from the mainloop.
+    if (mNetlinkFd >= 0)
+    {
+        FD_SET(mNetlinkFd, &aContext->mReadFdSet);
+        aContext->mMaxFd = std::max(aContext->mMaxFd, mNetlinkFd);
+    }
 }
 
 void Netif::UpdateIp6UnicastAddresses(const std::vector<Ip6AddressInfo> &aAddrInfos)
 {
-    // Remove stale addresses
-    for (const Ip6AddressInfo &addrInfo : mIp6UnicastAddresses)
+    std::vector<Ip6AddressInfo> addrInfos(aAddrInfos);
+    std::vector<Ip6AddressInfo> removed;
+    std::vector<Ip6AddressInfo> added;
+
+    // Both tables are kept sorted so that the changes are found in a single pass.
+    std::sort(addrInfos.begin(), addrInfos.end());
+    addrInfos.erase(std::unique(addrInfos.begin(), addrInfos.end()), addrInfos.end());
+
+    std::set_difference(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfos.begin(), addrInfos.end(),
+                        std::back_inserter(removed));
+    std::set_difference(addrInfos.begin(), addrInfos.end(), mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(),
+                        std::back_inserter(added));
+
+    for (const Ip6AddressInfo &addrInfo : removed)
     {
-        if (std::find(aAddrInfos.begin(), aAddrInfos.end(), addrInfo) == aAddrInfos.end())
-        {
-            otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, false);
-        }
+        otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
     }
 
-    // Add new addresses
-    for (const Ip6AddressInfo &addrInfo : aAddrInfos)
+    for (const Ip6AddressInfo &addrInfo : added)
     {
-        if (std::find(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfo) == mIp6UnicastAddresses.end())
-        {
-            otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, true);
-        }
+        otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
     }
 
-    mIp6UnicastAddresses.assign(aAddrInfos.begin(), aAddrInfos.end());
+    // Updated before sending the requests, a change that fails or cannot be sent is undone so
+    // that it's sent again with the next update.
+    mIp6UnicastAddresses.swap(addrInfos);
+
+    if (!removed.empty() || !added.empty())
+    {
+        ProcessUnicastAddressChanges(removed, added);
+    }
 }
 
 otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAddrs)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError               error = OTBR_ERROR_NONE;
+    std::vector<Ip6Address> addrs(aAddrs);
+    std::vector<Ip6Address> removed;
+    std::vector<Ip6Address> added;
+
+    std::sort(addrs.begin(), addrs.end());
+    addrs.erase(std::unique(addrs.begin(), addrs.end()), addrs.end());
+
+    std::set_difference(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), addrs.begin(), addrs.end(),
+                        std::back_inserter(removed));
+    std::set_difference(addrs.begin(), addrs.end(), mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(),
+                        std::back_inserter(added));
 
     // Remove stale addresses
-    for (const Ip6Address &address : mIp6MulticastAddresses)
+    for (const Ip6Address &address : removed)
     {
-        if (std::find(aAddrs.begin(), aAddrs.end(), address) == aAddrs.end())
-        {
-            otbrLogInfo("Remove address: %s", Ip6Address(address).ToString().c_str());
-            SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
-        }
+        otbrLogInfo("Remove address: %s", Ip6Address(address).ToString().c_str());
+        SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
     }
 
     // Add new addresses
-    for (const Ip6Address &address : aAddrs)
+    for (const Ip6Address &address : added)
     {
-        if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), address) ==
-            mIp6MulticastAddresses.end())
-        {
-            otbrLogInfo("Add address: %s", Ip6Address(address).ToString().c_str());
-            SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
-        }
+        otbrLogInfo("Add address: %s", Ip6Address(address).ToString().c_str());
+        SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
     }
 
-    mIp6MulticastAddresses.assign(aAddrs.begin(), aAddrs.end());
+    mIp6MulticastAddresses.swap(addrs);
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -201,6 +295,10 @@ otbrError Netif::ProcessMulticastAddressChange(const Ip6Address &aAddress, bool
 
     otbrLogInfo("%s multicast address %s", aIsAdded ? "Added" : "Removed", Ip6Address(aAddress).ToString().c_str());
 
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    mHostMulticastFilterChanged = true;
+#endif
+
 exit:
     return error;
 }
@@ -236,36 +334,118 @@ exit:
 
 void Netif::Ip6Receive(const uint8_t *aBuf, uint16_t aLen)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error                     = OTBR_ERROR_NONE;
+    uint8_t   header[kMaxTunHeaderSize] = {};
+    iovec     iov[2];
+
+    OTBR_PROBE(netif__ip6__receive__start, aLen);
 
     VerifyOrExit(aLen <= kIp6Mtu, error = OTBR_ERROR_DROPPED);
     VerifyOrExit(mTunFd > 0, error = OTBR_ERROR_INVALID_STATE);
 
-    otbrLogInfo("Packet from NCP (%u bytes)", aLen);
-    VerifyOrExit(write(mTunFd, aBuf, aLen) == aLen, error = OTBR_ERROR_ERRNO);
+    otbrLogDebug("Packet from NCP (%u bytes)", aLen);
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    if (!IsHostMulticastGroup(aBuf, aLen))
+    {
+        mCounters.mRxFiltered++;
+        ExitNow();
+    }
+#endif
+
+    // A zeroed virtio-net header requests neither checksum offload nor segmentation, the
+    // header and the packet are written with a single syscall without copying the packet.
+    iov[0].iov_base = header;
+    iov[0].iov_len  = mTunHeaderSize;
+    iov[1].iov_base = const_cast<uint8_t *>(aBuf);
+    iov[1].iov_len  = aLen;
+
+    VerifyOrExit(writev(mTunFd, iov, 2) == static_cast<ssize_t>(mTunHeaderSize + aLen), error = OTBR_ERROR_ERRNO);
+
+    mCounters.mRxPackets++;
+    mCounters.mRxBytes += aLen;
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
+        mCounters.mRxDrops++;
         otbrLogWarning("Failed to receive, error:%s", otbrErrorString(error));
     }
+    OTBR_PROBE(netif__ip6__receive__end, aLen, static_cast<int>(error));
 }
 
-void Netif::ProcessIp6Send(void)
+void Netif::ProcessIp6Send(int aTunFd)
 {
-    ssize_t   rval;
-    uint8_t   packet[kIp6Mtu];
+    uint8_t   header[kMaxTunHeaderSize];
     otbrError error = OTBR_ERROR_NONE;
 
-    rval = read(mTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(!mFreeEgressPackets.empty(), error = OTBR_ERROR_INVALID_STATE);
 
-    otbrLogInfo("Send packet (%hu bytes)", static_cast<uint16_t>(rval));
-
-    if (mIp6SendFunc != nullptr)
+    // Drain a batch of packets per readiness event instead of a single one, the TUN fd is non-blocking.
+    for (uint16_t i = 0; i < kIp6SendBatchSize; i++)
     {
-        error = mIp6SendFunc(packet, rval);
+        uint16_t              index  = mFreeEgressPackets.back();
+        EgressPacket         &packet = mEgressPackets[index];
+        iovec                 iov[2];
+        ssize_t               rval;
+        EgressClass           egressClass;
+        std::deque<uint16_t> *queue;
+
+        // The packet is read after the headroom, so that the spinel header can be prepended in place.
+        iov[0].iov_base = header;
+        iov[0].iov_len  = mTunHeaderSize;
+        iov[1].iov_base = packet.mBuffer + kIp6SendHeadroom;
+        iov[1].iov_len  = kIp6Mtu;
+
+        rval = readv(aTunFd, iov, 2);
+
+        if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        VerifyOrExit(rval > mTunHeaderSize, error = OTBR_ERROR_ERRNO);
+        packet.mLength = static_cast<uint16_t>(rval - mTunHeaderSize);
+
+        otbrLogDebugRateLimited("Send packet (%hu bytes)", packet.mLength);
+
+        mCounters.mTxPackets++;
+        mCounters.mTxBytes += packet.mLength;
+
+        egressClass = ClassifyIp6Packet(packet.mBuffer + kIp6SendHeadroom, packet.mLength);
+        queue       = &mEgressQueues[egressClass];
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+        // The host reports the groups it joins or leaves on the netif to the Thread network.
+        if (egressClass == kEgressClassControl && IsMldReport(packet.mBuffer + kIp6SendHeadroom, packet.mLength))
+        {
+            mHostMulticastFilterChanged = true;
+        }
+#endif
+
+        // There is one more buffer than all the queues could keep, a buffer is left free after a packet is dropped.
+        mFreeEgressPackets.pop_back();
+        queue->push_back(index);
+
+        if (queue->size() > kIp6EgressQueueSize)
+        {
+            uint16_t dropped = kEgressQueueDropsOldest[egressClass] ? queue->front() : queue->back();
+
+            if (kEgressQueueDropsOldest[egressClass])
+            {
+                queue->pop_front();
+            }
+            else
+            {
+                queue->pop_back();
+            }
+
+            mFreeEgressPackets.push_back(dropped);
+            mCounters.mTxDrops++;
+            mEgressCounters[egressClass].mDrops++;
+        }
     }
+
 exit:
     if (error == OTBR_ERROR_ERRNO)
     {
@@ -273,6 +453,188 @@ exit:
     }
 }
 
+void Netif::SendEgressPackets(void)
+{
+    uint8_t egressClass = 0;
+
+    // The queues are served by strict priority.
+    for (uint16_t i = 0; i < kIp6EgressSendBatchSize; i++)
+    {
+        uint16_t index;
+
+        while (egressClass < kEgressClassCount && mEgressQueues[egressClass].empty())
+        {
+            egressClass++;
+        }
+
+        VerifyOrExit(egressClass < kEgressClassCount);
+
+        index = mEgressQueues[egressClass].front();
+        mEgressQueues[egressClass].pop_front();
+
+        {
+            EgressPacket &packet = mEgressPackets[index];
+            FrameBuffer   frame(packet.mBuffer, sizeof(packet.mBuffer), kIp6SendHeadroom);
+
+            frame.SetLength(packet.mLength);
+
+            OTBR_PROBE(netif__ip6__send__start, packet.mLength);
+
+            if (mIp6SendFunc == nullptr || mIp6SendFunc(frame) != OTBR_ERROR_NONE)
+            {
+                mCounters.mTxDrops++;
+            }
+            else
+            {
+                mEgressCounters[egressClass].mPackets++;
+                mEgressCounters[egressClass].mBytes += packet.mLength;
+            }
+
+            OTBR_PROBE(netif__ip6__send__end, packet.mLength);
+        }
+
+        mFreeEgressPackets.push_back(index);
+    }
+
+exit:
+    return;
+}
+
+bool Netif::HasEgressPackets(void) const
+{
+    return std::any_of(std::begin(mEgressQueues), std::end(mEgressQueues),
+                       [](const std::deque<uint16_t> &aQueue) { return !aQueue.empty(); });
+}
+
+Netif::EgressClass Netif::ClassifyIp6Packet(const uint8_t *aPacket, uint16_t aLength)
+{
+    static constexpr uint8_t  kDscpLowerEffort       = 1;
+    static constexpr uint8_t  kDscpCs1               = 8;
+    static constexpr uint8_t  kDscpEf                = 46;
+    static constexpr uint8_t  kDscpCs6               = 48;
+    static constexpr uint8_t  kDscpCs7               = 56;
+    static constexpr uint16_t kDnsPort               = 53;
+    static constexpr uint16_t kUdpDestinationPortEnd = 4;
+
+    EgressClass egressClass = kEgressClassDefault;
+    uint8_t     dscp;
+    uint8_t     protocol;
+    uint16_t    offset;
+
+    VerifyOrExit(aLength >= sizeof(ip6_hdr) && (aPacket[0] >> 4) == 6);
+
+    dscp = static_cast<uint8_t>(((aPacket[0] & 0x0f) << 2) | (aPacket[1] >> 6));
+
+    if (dscp == kDscpEf || dscp == kDscpCs6 || dscp == kDscpCs7)
+    {
+        ExitNow(egressClass = kEgressClassControl);
+    }
+
+    if (dscp == kDscpCs1 || dscp == kDscpLowerEffort)
+    {
+        ExitNow(egressClass = kEgressClassBulk);
+    }
+
+    VerifyOrExit(FindIp6UpperLayer(aPacket, aLength, protocol, offset));
+
+    if (protocol == IPPROTO_ICMPV6)
+    {
+        uint8_t type = aPacket[offset];
+
+        egressClass = (type == ICMP6_ECHO_REQUEST || type == ICMP6_ECHO_REPLY) ? kEgressClassDefault
+                                                                                : kEgressClassControl;
+    }
+    else if (protocol == IPPROTO_UDP && offset + kUdpDestinationPortEnd <= aLength)
+    {
+        uint16_t port = static_cast<uint16_t>((aPacket[offset + 2] << 8) | aPacket[offset + 3]);
+
+        // Only the DNS messages, the SRP server listens on a dynamic port which is not known by the host.
+        egressClass = (port == kDnsPort) ? kEgressClassControl : kEgressClassDefault;
+    }
+
+exit:
+    return egressClass;
+}
+
+bool Netif::FindIp6UpperLayer(const uint8_t *aPacket, uint16_t aLength, uint8_t &aProtocol, uint16_t &aOffset)
+{
+    static constexpr uint8_t kMaxExtensionHeaders = 4;
+
+    bool found = false;
+
+    VerifyOrExit(aLength >= sizeof(ip6_hdr) && (aPacket[0] >> 4) == 6);
+
+    aProtocol = aPacket[offsetof(ip6_hdr, ip6_nxt)];
+    aOffset   = sizeof(ip6_hdr);
+
+    // MLD reports follow a Hop-by-Hop Options header.
+    for (uint8_t i = 0; i < kMaxExtensionHeaders && IsIp6ExtensionHeader(aProtocol); i++)
+    {
+        VerifyOrExit(aOffset + 2 <= aLength);
+        aProtocol = aPacket[aOffset];
+        aOffset += (aPacket[aOffset + 1] + 1) * 8;
+    }
+
+    found = !IsIp6ExtensionHeader(aProtocol) && aOffset < aLength;
+
+exit:
+    return found;
+}
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+void Netif::UpdateHostMulticastFilter(void)
+{
+    std::unordered_set<Ip6Address> groups;
+
+    mHostMulticastFilterChanged = false;
+    mHostMulticastFilterValid   = (ReadHostMulticastGroups(groups) == OTBR_ERROR_NONE);
+
+    if (mHostMulticastFilterValid)
+    {
+        mHostMulticastFilter.swap(groups);
+        otbrLogDebug("Host joined %zu multicast groups", mHostMulticastFilter.size());
+    }
+    else
+    {
+        // Nothing is filtered if the groups of the host are unknown.
+        mHostMulticastFilter.clear();
+        otbrLogWarning("Failed to read the multicast groups of the host");
+    }
+}
+
+bool Netif::IsHostMulticastGroup(const uint8_t *aPacket, uint16_t aLength) const
+{
+    const uint8_t *destination = aPacket + offsetof(ip6_hdr, ip6_dst);
+    bool           joined      = true;
+    Ip6Address     group;
+
+    VerifyOrExit(mHostMulticastFilterValid && aLength >= sizeof(ip6_hdr) && destination[0] == 0xff);
+
+    memcpy(group.m8, destination, sizeof(group.m8));
+    joined = (mHostMulticastFilter.count(group) > 0);
+
+exit:
+    return joined;
+}
+
+bool Netif::IsMldReport(const uint8_t *aPacket, uint16_t aLength)
+{
+    static constexpr uint8_t kMldv2Report = 143;
+
+    uint8_t  protocol;
+    uint16_t offset;
+    bool     isReport = false;
+
+    VerifyOrExit(FindIp6UpperLayer(aPacket, aLength, protocol, offset) && protocol == IPPROTO_ICMPV6);
+
+    isReport = (aPacket[offset] == MLD_LISTENER_REPORT || aPacket[offset] == MLD_LISTENER_REDUCTION ||
+                aPacket[offset] == kMldv2Report);
+
+exit:
+    return isReport;
+}
+#endif // OTBR_ENABLE_NETIF_MULTICAST_FILTER
+
 void Netif::Clear(void)
 {
     if (mTunFd != -1)
@@ -281,6 +643,13 @@ void Netif::Clear(void)
         mTunFd = -1;
     }
 
+    for (int queueFd : mTunQueueFds)
+    {
+        close(queueFd);
+    }
+    mTunQueueFds.clear();
+    mTunHeaderSize = 0;
+
     if (mIpFd != -1)
     {
         close(mIpFd);
@@ -294,9 +663,23 @@ void Netif::Clear(void)
     }
 
     mNetifIndex = 0;
+    mPendingNetlinkRequests.clear();
     mIp6UnicastAddresses.clear();
     mIp6MulticastAddresses.clear();
     mIp6SendFunc = nullptr;
+
+    mEgressPackets.clear();
+    mFreeEgressPackets.clear();
+    for (std::deque<uint16_t> &queue : mEgressQueues)
+    {
+        queue.clear();
+    }
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    mHostMulticastFilter.clear();
+    mHostMulticastFilterValid   = false;
+    mHostMulticastFilterChanged = false;
+#endif
 }
 
 } // namespace otbr
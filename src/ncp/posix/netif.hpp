@@ -36,20 +36,125 @@
 
 #include <net/if.h>
 
+#include <deque>
 #include <functional>
+#include <map>
+#include <unordered_set>
 #include <vector>
 
 #include <openthread/ip6.h>
 
+#include "common/frame_buffer.hpp"
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
 
+#ifndef OTBR_NETIF_IP6_SEND_BATCH_SIZE
+#define OTBR_NETIF_IP6_SEND_BATCH_SIZE 32
+#endif
+
+/**
+ * The maximum number of packets sent to the Thread network per mainloop iteration.
+ *
+ * It's smaller than the number of packets read from the TUN device, so that the packets waiting in the egress queues
+ * are sent by priority instead of in the order they were written to the TUN device.
+ *
+ */
+#ifndef OTBR_NETIF_IP6_EGRESS_SEND_BATCH_SIZE
+#define OTBR_NETIF_IP6_EGRESS_SEND_BATCH_SIZE 8
+#endif
+
+/**
+ * The maximum number of packets waiting in each egress queue.
+ *
+ */
+#ifndef OTBR_NETIF_IP6_EGRESS_QUEUE_SIZE
+#define OTBR_NETIF_IP6_EGRESS_QUEUE_SIZE 32
+#endif
+
+/**
+ * Whether to drop the multicast packets from the Thread network to the groups the host hasn't joined on the Thread
+ * network interface, instead of writing them to the TUN device.
+ *
+ * A multicast router on the host needs the packets of all the groups, so it's disabled by default.
+ *
+ */
+#ifndef OTBR_ENABLE_NETIF_MULTICAST_FILTER
+#define OTBR_ENABLE_NETIF_MULTICAST_FILTER 0
+#endif
+
+#ifndef OTBR_ENABLE_NETIF_MULTI_QUEUE_TUN
+#define OTBR_ENABLE_NETIF_MULTI_QUEUE_TUN 0
+#endif
+
+#ifndef OTBR_NETIF_TUN_QUEUE_COUNT
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_NETIF_TUN_QUEUE_COUNT 1
+#else
+#define OTBR_NETIF_TUN_QUEUE_COUNT 4
+#endif
+#endif
+
 namespace otbr {
 
 class Netif
 {
 public:
-    using Ip6SendFunc = std::function<otbrError(const uint8_t *, uint16_t)>;
+    /**
+     * This function sends an IPv6 packet read from the TUN device.
+     *
+     * The frame has at least `kIp6SendHeadroom` bytes of headroom, so that the
+     * lower layer can prepend its headers without copying the packet.
+     *
+     */
+    using Ip6SendFunc = std::function<otbrError(FrameBuffer &aFrame)>;
+
+    /**
+     * The headroom of the frames passed to `Ip6SendFunc`.
+     *
+     */
+    static constexpr uint16_t kIp6SendHeadroom = 16;
+
+    /**
+     * This structure represents the packet counters of the Thread network interface.
+     *
+     * "Tx" is about packets read from the TUN device and sent to the Thread network,
+     * "Rx" is about packets received from the Thread network and written to the TUN device.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mTxPackets  = 0; ///< The number of packets read from the TUN device.
+        uint64_t mTxBytes    = 0; ///< The number of bytes read from the TUN device.
+        uint64_t mTxDrops    = 0; ///< The number of packets which were dropped when sending to the Thread network.
+        uint64_t mRxPackets  = 0; ///< The number of packets written to the TUN device.
+        uint64_t mRxBytes    = 0; ///< The number of bytes written to the TUN device.
+        uint64_t mRxDrops    = 0; ///< The number of packets which failed to be written to the TUN device.
+        uint64_t mRxFiltered = 0; ///< The number of multicast packets dropped as the host hasn't joined the group.
+    };
+
+    /**
+     * This enumeration represents the egress traffic classes, in the order of their priority.
+     *
+     */
+    enum EgressClass : uint8_t
+    {
+        kEgressClassControl = 0, ///< Network control, e.g. ICMPv6 other than echo, DNS and SRP.
+        kEgressClassDefault = 1, ///< The traffic of no other class.
+        kEgressClassBulk    = 2, ///< Lower effort traffic, marked by the DSCP CS1 or LE.
+    };
+
+    static constexpr uint8_t kEgressClassCount = 3; ///< The number of egress traffic classes.
+
+    /**
+     * This structure represents the packet counters of an egress traffic class.
+     *
+     */
+    struct EgressCounters
+    {
+        uint64_t mPackets = 0; ///< The number of packets sent to the Thread network.
+        uint64_t mBytes   = 0; ///< The number of bytes sent to the Thread network.
+        uint64_t mDrops   = 0; ///< The number of packets dropped because the egress queue was full.
+    };
 
     Netif(void);
 
@@ -64,10 +169,56 @@ public:
 
     void Ip6Receive(const uint8_t *aBuf, uint16_t aLen);
 
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Returns the packet counters of an egress traffic class.
+     *
+     * @param[in] aClass  The egress traffic class.
+     *
+     */
+    const EgressCounters &GetEgressCounters(EgressClass aClass) const { return mEgressCounters[aClass]; }
+
+    /**
+     * Returns the egress traffic class of an IPv6 packet.
+     *
+     * The class is told by the DSCP of the packet first, then by its upper-layer protocol.
+     *
+     * @param[in] aPacket  A pointer to the IPv6 packet.
+     * @param[in] aLength  The length of the IPv6 packet.
+     *
+     */
+    static EgressClass ClassifyIp6Packet(const uint8_t *aPacket, uint16_t aLength);
+
+    /**
+     * Returns the number of netlink requests whose acknowledgement has not been processed yet.
+     *
+     */
+    size_t GetPendingNetlinkRequestCount(void) const { return mPendingNetlinkRequests.size(); }
+
 private:
     // TODO: Retrieve the Maximum Ip6 size from the coprocessor.
     static constexpr size_t kIp6Mtu = 1280;
 
+    // The maximum number of packets read from the TUN device per mainloop iteration.
+    static constexpr uint16_t kIp6SendBatchSize = OTBR_NETIF_IP6_SEND_BATCH_SIZE;
+
+    // The maximum number of packets sent to the Thread network per mainloop iteration.
+    static constexpr uint16_t kIp6EgressSendBatchSize = OTBR_NETIF_IP6_EGRESS_SEND_BATCH_SIZE;
+
+    // The maximum number of packets waiting in each egress queue.
+    static constexpr uint16_t kIp6EgressQueueSize = OTBR_NETIF_IP6_EGRESS_QUEUE_SIZE;
+
+    // The maximum size of the virtio-net header (`struct virtio_net_hdr`).
+    static constexpr uint8_t kMaxTunHeaderSize = 12;
+
+    // A packet read from the TUN device, after the headroom of the frame passed to `Ip6SendFunc`.
+    struct EgressPacket
+    {
+        uint16_t mLength;
+        uint8_t  mBuffer[kIp6SendHeadroom + kIp6Mtu];
+    };
+
     void Clear(void);
 
     otbrError CreateTunDevice(const std::string &aInterfaceName);
@@ -75,21 +226,62 @@ private:
 
     void      PlatformSpecificInit(void);
     void      SetAddrGenModeToNone(void);
-    void      ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded);
+    void      ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemoved,
+                                           const std::vector<Ip6AddressInfo> &aAdded);
     otbrError ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded);
-    void      ProcessIp6Send(void);
+    void      ProcessIp6Send(int aTunFd);
+    void      SendEgressPackets(void);
+    bool      HasEgressPackets(void) const;
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    void      UpdateHostMulticastFilter(void);
+    otbrError ReadHostMulticastGroups(std::unordered_set<Ip6Address> &aGroups) const;
+    bool      IsHostMulticastGroup(const uint8_t *aPacket, uint16_t aLength) const;
+#endif
+
+    static bool FindIp6UpperLayer(const uint8_t *aPacket, uint16_t aLength, uint8_t &aProtocol, uint16_t &aOffset);
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    static bool IsMldReport(const uint8_t *aPacket, uint16_t aLength);
+#endif
+    void      ProcessNetlinkEvents(void);
+    void      HandleNetlinkAck(uint32_t aSequence, int aError);
+    void      ResyncIp6UnicastAddresses(void);
+    otbrError ReadUnicastAddresses(std::unordered_set<Ip6Address> &aAddrs) const;
 
     int      mTunFd;           ///< Used to exchange IPv6 packets.
     int      mIpFd;            ///< Used to manage IPv6 stack on the network interface.
     int      mNetlinkFd;       ///< Used to receive netlink events.
     uint32_t mNetlinkSequence; ///< Netlink message sequence.
 
+    std::vector<int> mTunQueueFds;   ///< The additional queues of a multi-queue TUN device.
+    uint8_t          mTunHeaderSize; ///< The size of the virtio-net header before each packet, 0 if disabled.
+
     unsigned int mNetifIndex;
     std::string  mNetifName;
 
+    // A netlink request sent to the kernel and waiting for its acknowledgement.
+    struct NetlinkRequest
+    {
+        uint16_t       mType;        ///< The netlink message type.
+        Ip6AddressInfo mAddressInfo; ///< The address of an address request.
+    };
+
+    std::map<uint32_t, NetlinkRequest> mPendingNetlinkRequests; ///< The requests keyed by sequence.
+
     std::vector<Ip6AddressInfo> mIp6UnicastAddresses;
     std::vector<Ip6Address>     mIp6MulticastAddresses;
     Ip6SendFunc                 mIp6SendFunc;
+    Counters                    mCounters;
+
+    std::vector<EgressPacket> mEgressPackets;                     ///< The buffers of the egress packets.
+    std::vector<uint16_t>     mFreeEgressPackets;                 ///< The indexes of the free buffers.
+    std::deque<uint16_t>      mEgressQueues[kEgressClassCount];   ///< The indexes of the waiting packets.
+    EgressCounters            mEgressCounters[kEgressClassCount]; ///< The counters of each class.
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+    std::unordered_set<Ip6Address> mHostMulticastFilter;        ///< The groups the host has joined on the netif.
+    bool                           mHostMulticastFilterValid;   ///< Whether the groups could be read from the host.
+    bool                           mHostMulticastFilterChanged; ///< Whether the host may have joined or left a group.
+#endif
 };
 
 } // namespace otbr
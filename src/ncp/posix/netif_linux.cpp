@@ -40,9 +40,15 @@
 #include <linux/rtnetlink.h>
 #include <net/if.h>
 #include <net/if_arp.h>
+#include <stdio.h>
+#include <string.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
@@ -83,6 +89,11 @@ otbrError Netif::CreateTunDevice(const std::string &aInterfaceName)
 
     memset(&ifr, 0, sizeof(ifr));
     ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+#if OTBR_ENABLE_NETIF_MULTI_QUEUE_TUN
+    // Every queue is a separate fd, the kernel spreads the outgoing flows over the queues.
+    // The virtio-net header lets the packets be exchanged with `readv()`/`writev()` as is.
+    ifr.ifr_flags |= IFF_MULTI_QUEUE | IFF_VNET_HDR;
+#endif
     if (aInterfaceName.size() > 0)
     {
         strncpy(ifr.ifr_name, aInterfaceName.c_str(), aInterfaceName.size());
@@ -100,6 +111,33 @@ otbrError Netif::CreateTunDevice(const std::string &aInterfaceName)
     mNetifName.assign(ifr.ifr_name, strlen(ifr.ifr_name));
     otbrLogInfo("Netif name: %s", mNetifName.c_str());
 
+#if OTBR_ENABLE_NETIF_MULTI_QUEUE_TUN
+    {
+        // Size of `struct virtio_net_hdr`, <linux/virtio_net.h> cannot be included from C++.
+        constexpr int kVirtioNetHeaderSize = 10;
+        int           headerSize           = kVirtioNetHeaderSize;
+
+        static_assert(kVirtioNetHeaderSize <= kMaxTunHeaderSize, "kMaxTunHeaderSize is too small");
+
+        VerifyOrExit(ioctl(mTunFd, TUNSETVNETHDRSZ, &headerSize) == 0, error = OTBR_ERROR_ERRNO);
+        mTunHeaderSize = static_cast<uint8_t>(headerSize);
+
+        for (int i = 1; i < OTBR_NETIF_TUN_QUEUE_COUNT; i++)
+        {
+            int queueFd = open(OTBR_POSIX_TUN_DEVICE, O_RDWR | O_CLOEXEC | O_NONBLOCK);
+
+            VerifyOrExit(queueFd >= 0, error = OTBR_ERROR_ERRNO);
+            mTunQueueFds.push_back(queueFd);
+
+            // The name is no longer a format string, so the queue is attached to the same device.
+            VerifyOrExit(ioctl(queueFd, TUNSETIFF, &ifr) == 0, error = OTBR_ERROR_ERRNO);
+            VerifyOrExit(ioctl(queueFd, TUNSETVNETHDRSZ, &headerSize) == 0, error = OTBR_ERROR_ERRNO);
+        }
+
+        otbrLogInfo("Opened %zu TUN queues", mTunQueueFds.size() + 1);
+    }
+#endif
+
     VerifyOrExit(ioctl(mTunFd, TUNSETLINK, ARPHRD_NONE) == 0, error = OTBR_ERROR_ERRNO);
 
     ifr.ifr_mtu = static_cast<int>(kIp6Mtu);
@@ -187,6 +225,7 @@ void Netif::SetAddrGenModeToNone(void)
 
     if (send(mNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
     {
+        mPendingNetlinkRequests[mNetlinkSequence] = {RTM_NEWLINK, Ip6AddressInfo()};
         otbrLogInfo("Sent request#%u to set addr_gen_mode to %d", mNetlinkSequence, mode);
     }
     else
@@ -195,31 +234,40 @@ void Netif::SetAddrGenModeToNone(void)
     }
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
-{
-    struct
-    {
-        nlmsghdr  nh;
-        ifaddrmsg ifa;
-        char      buf[512];
-    } req;
+// The maximum number of netlink requests sent in a single message.
+static constexpr size_t kMaxNetlinkBatchSize = 64;
 
-    assert(mIpFd >= 0);
-    memset(&req, 0, sizeof(req));
+// The size of the buffer to receive netlink messages, as recommended by netlink(7).
+static constexpr size_t kNetlinkReceiveBufferSize = 8192;
 
-    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
-    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
-    req.nh.nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
-    req.nh.nlmsg_pid   = 0;
-    req.nh.nlmsg_seq   = ++mNetlinkSequence;
+struct UnicastAddressRequest
+{
+    nlmsghdr  nh;
+    ifaddrmsg ifa;
+    char      buf[64];
+};
+
+static void PrepareUnicastAddressRequest(UnicastAddressRequest &aRequest,
+                                         const Ip6AddressInfo  &aAddressInfo,
+                                         bool                   aIsAdded,
+                                         unsigned int           aNetifIndex,
+                                         uint32_t               aSequence)
+{
+    memset(&aRequest, 0, sizeof(aRequest));
+
+    aRequest.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
+    aRequest.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    aRequest.nh.nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
+    aRequest.nh.nlmsg_pid   = 0;
+    aRequest.nh.nlmsg_seq   = aSequence;
 
-    req.ifa.ifa_family    = AF_INET6;
-    req.ifa.ifa_prefixlen = aAddressInfo.mPrefixLength;
-    req.ifa.ifa_flags     = IFA_F_NODAD;
-    req.ifa.ifa_scope     = aAddressInfo.mScope;
-    req.ifa.ifa_index     = mNetifIndex;
+    aRequest.ifa.ifa_family    = AF_INET6;
+    aRequest.ifa.ifa_prefixlen = aAddressInfo.mPrefixLength;
+    aRequest.ifa.ifa_flags     = IFA_F_NODAD;
+    aRequest.ifa.ifa_scope     = aAddressInfo.mScope;
+    aRequest.ifa.ifa_index     = aNetifIndex;
 
-    AddRtAttr(&req.nh, sizeof(req), IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
+    AddRtAttr(&aRequest.nh, sizeof(aRequest), IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
 
     if (!aAddressInfo.mPreferred || aAddressInfo.mMeshLocal)
     {
@@ -228,21 +276,282 @@ void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool
         memset(&cacheinfo, 0, sizeof(cacheinfo));
         cacheinfo.ifa_valid = UINT32_MAX;
 
-        AddRtAttr(&req.nh, sizeof(req), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
+        AddRtAttr(&aRequest.nh, sizeof(aRequest), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
     }
+}
 
-    if (send(mNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
+static void InsertAddressInfo(std::vector<Ip6AddressInfo> &aAddrInfos, const Ip6AddressInfo &aAddrInfo)
+{
+    auto it = std::lower_bound(aAddrInfos.begin(), aAddrInfos.end(), aAddrInfo);
+
+    if (it == aAddrInfos.end() || !(*it == aAddrInfo))
     {
-        otbrLogInfo("Sent request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                    Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        aAddrInfos.insert(it, aAddrInfo);
     }
-    else
+}
+
+static void EraseAddressInfo(std::vector<Ip6AddressInfo> &aAddrInfos, const Ip6AddressInfo &aAddrInfo)
+{
+    auto it = std::lower_bound(aAddrInfos.begin(), aAddrInfos.end(), aAddrInfo);
+
+    if (it != aAddrInfos.end() && *it == aAddrInfo)
+    {
+        aAddrInfos.erase(it);
+    }
+}
+
+void Netif::ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemoved,
+                                         const std::vector<Ip6AddressInfo> &aAdded)
+{
+    std::vector<UnicastAddressRequest> requests(aRemoved.size() + aAdded.size());
+    std::vector<iovec>                 iovs(requests.size());
+    size_t                             index = 0;
+
+    assert(mIpFd >= 0);
+
+    // Removals go first so that an address whose info changed is re-added afterwards.
+    for (const Ip6AddressInfo &addrInfo : aRemoved)
+    {
+        PrepareUnicastAddressRequest(requests[index++], addrInfo, /* aIsAdded */ false, mNetifIndex,
+                                     ++mNetlinkSequence);
+    }
+
+    for (const Ip6AddressInfo &addrInfo : aAdded)
+    {
+        PrepareUnicastAddressRequest(requests[index++], addrInfo, /* aIsAdded */ true, mNetifIndex,
+                                     ++mNetlinkSequence);
+    }
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        iovs[i].iov_base = &requests[i];
+        iovs[i].iov_len  = NLMSG_ALIGN(requests[i].nh.nlmsg_len);
+    }
+
+    // The kernel processes all the requests of a single message in order.
+    for (size_t begin = 0; begin < requests.size(); begin += kMaxNetlinkBatchSize)
+    {
+        size_t count = std::min(kMaxNetlinkBatchSize, requests.size() - begin);
+        msghdr msg;
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov    = &iovs[begin];
+        msg.msg_iovlen = count;
+
+        if (sendmsg(mNetlinkFd, &msg, 0) != -1)
+        {
+            for (size_t i = begin; i < begin + count; i++)
+            {
+                const Ip6AddressInfo &addrInfo =
+                    (i < aRemoved.size()) ? aRemoved[i] : aAdded[i - aRemoved.size()];
+
+                mPendingNetlinkRequests[requests[i].nh.nlmsg_seq] = {requests[i].nh.nlmsg_type, addrInfo};
+            }
+            otbrLogInfo("Sent requests#%u-%u to update %zu addresses", requests[begin].nh.nlmsg_seq,
+                        requests[begin + count - 1].nh.nlmsg_seq, count);
+        }
+        else
+        {
+            otbrLogWarning("Failed to send requests#%u-%u to update %zu addresses: %s", requests[begin].nh.nlmsg_seq,
+                           requests[begin + count - 1].nh.nlmsg_seq, count, strerror(errno));
+
+            // Undo the changes of the batch so that they're sent again with the next address table update.
+            for (size_t i = begin; i < begin + count; i++)
+            {
+                if (i < aRemoved.size())
+                {
+                    InsertAddressInfo(mIp6UnicastAddresses, aRemoved[i]);
+                }
+                else
+                {
+                    EraseAddressInfo(mIp6UnicastAddresses, aAdded[i - aRemoved.size()]);
+                }
+            }
+        }
+    }
+}
+
+void Netif::ProcessNetlinkEvents(void)
+{
+    alignas(nlmsghdr) char buffer[kNetlinkReceiveBufferSize];
+    ssize_t                length;
+
+    // The socket also receives the link and address events of the subscribed groups, only
+    // the acknowledgements of our requests are handled here.
+    while ((length = recv(mNetlinkFd, buffer, sizeof(buffer), 0)) > 0)
+    {
+        int remaining = static_cast<int>(length);
+
+        for (nlmsghdr *msg = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(msg, remaining);
+             msg = NLMSG_NEXT(msg, remaining))
+        {
+            if (msg->nlmsg_type == NLMSG_ERROR && msg->nlmsg_len >= NLMSG_LENGTH(sizeof(nlmsgerr)))
+            {
+                HandleNetlinkAck(msg->nlmsg_seq, reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(msg))->error);
+            }
+        }
+    }
+
+    if (length < 0 && errno == ENOBUFS)
+    {
+        // The kernel dropped messages, the acknowledgements lost cannot be matched anymore.
+        otbrLogWarning("Netlink receive buffer overflowed, dropping %zu pending requests",
+                       mPendingNetlinkRequests.size());
+        ResyncIp6UnicastAddresses();
+        mPendingNetlinkRequests.clear();
+    }
+}
+
+void Netif::ResyncIp6UnicastAddresses(void)
+{
+    std::unordered_set<Ip6Address> addrs;
+
+    if (ReadUnicastAddresses(addrs) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to read the addresses of %s: %s", mNetifName.c_str(), strerror(errno));
+        ExitNow();
+    }
+
+    // A pending removal which didn't take effect is sent again with the next address table update.
+    for (const auto &entry : mPendingNetlinkRequests)
     {
-        otbrLogWarning("Failed to send request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                       Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        if (entry.second.mType == RTM_DELADDR && addrs.count(Ip6Address(entry.second.mAddressInfo.mAddress)))
+        {
+            InsertAddressInfo(mIp6UnicastAddresses, entry.second.mAddressInfo);
+        }
     }
+
+    // And so is an address missing on the netif, whether its addition failed or was never acknowledged.
+    mIp6UnicastAddresses.erase(std::remove_if(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(),
+                                              [&addrs](const Ip6AddressInfo &aAddrInfo) {
+                                                  return addrs.count(Ip6Address(aAddrInfo.mAddress)) == 0;
+                                              }),
+                               mIp6UnicastAddresses.end());
+
+exit:
+    return;
 }
 
+otbrError Netif::ReadUnicastAddresses(std::unordered_set<Ip6Address> &aAddrs) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    FILE     *file  = fopen("/proc/net/if_inet6", "r");
+    char      line[128];
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    // Each line is "<address in 32 hex digits> <ifindex> <prefix length> <scope> <flags> <ifname>", in hex.
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        char         hex[33];
+        unsigned int ifIndex;
+        Ip6Address   addr;
+
+        if (sscanf(line, "%32s %x", hex, &ifIndex) != 2 || ifIndex != mNetifIndex || strlen(hex) != 32)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < sizeof(addr.m8); i++)
+        {
+            unsigned int byte;
+
+            sscanf(&hex[i * 2], "%2x", &byte);
+            addr.m8[i] = static_cast<uint8_t>(byte);
+        }
+
+        aAddrs.insert(addr);
+    }
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    return error;
+}
+
+void Netif::HandleNetlinkAck(uint32_t aSequence, int aError)
+{
+    auto           it = mPendingNetlinkRequests.find(aSequence);
+    NetlinkRequest request;
+
+    VerifyOrExit(it != mPendingNetlinkRequests.end());
+    request = it->second;
+    mPendingNetlinkRequests.erase(it);
+
+    // `aError` is 0 for a successful request, or a negative errno.
+    VerifyOrExit(aError != 0);
+
+    switch (request.mType)
+    {
+    case RTM_NEWADDR:
+        VerifyOrExit(aError != -EEXIST);
+        otbrLogWarning("Failed to add %s/%u (request#%u): %s",
+                       Ip6Address(request.mAddressInfo.mAddress).ToString().c_str(), request.mAddressInfo.mPrefixLength,
+                       aSequence, strerror(-aError));
+
+        // Forget the address so that it's added again with the next address table update.
+        EraseAddressInfo(mIp6UnicastAddresses, request.mAddressInfo);
+        break;
+
+    case RTM_DELADDR:
+        VerifyOrExit(aError != -EADDRNOTAVAIL);
+        otbrLogWarning("Failed to remove %s/%u (request#%u): %s",
+                       Ip6Address(request.mAddressInfo.mAddress).ToString().c_str(), request.mAddressInfo.mPrefixLength,
+                       aSequence, strerror(-aError));
+        break;
+
+    default:
+        otbrLogWarning("Netlink request#%u failed: %s", aSequence, strerror(-aError));
+        break;
+    }
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+otbrError Netif::ReadHostMulticastGroups(std::unordered_set<Ip6Address> &aGroups) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    FILE     *file  = fopen("/proc/net/igmp6", "r");
+    char      line[128];
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    // Each line is "<ifindex> <ifname> <group in 32 hex digits> <users> <flags> <timer>".
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        unsigned int ifIndex;
+        char         hex[33];
+        Ip6Address   group;
+
+        if (sscanf(line, "%u %*s %32s", &ifIndex, hex) != 2 || ifIndex != mNetifIndex || strlen(hex) != 32)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < sizeof(group.m8); i++)
+        {
+            unsigned int byte;
+
+            sscanf(&hex[i * 2], "%2x", &byte);
+            group.m8[i] = static_cast<uint8_t>(byte);
+        }
+
+        aGroups.insert(group);
+    }
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    return error;
+}
+#endif
+
 } // namespace otbr
 
 #endif // __linux__
@@ -58,12 +58,32 @@ void Netif::PlatformSpecificInit(void)
     /* Empty */
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+void Netif::ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemoved,
+                                         const std::vector<Ip6AddressInfo> &aAdded)
 {
-    OTBR_UNUSED_VARIABLE(aAddressInfo);
-    OTBR_UNUSED_VARIABLE(aIsAdded);
+    OTBR_UNUSED_VARIABLE(aRemoved);
+    OTBR_UNUSED_VARIABLE(aAdded);
 }
 
+void Netif::ProcessNetlinkEvents(void)
+{
+    /* Empty */
+}
+
+void Netif::HandleNetlinkAck(uint32_t aSequence, int aError)
+{
+    OTBR_UNUSED_VARIABLE(aSequence);
+    OTBR_UNUSED_VARIABLE(aError);
+}
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+otbrError Netif::ReadHostMulticastGroups(std::unordered_set<Ip6Address> &aGroups) const
+{
+    OTBR_UNUSED_VARIABLE(aGroups);
+    return OTBR_ERROR_NOT_IMPLEMENTED;
+}
+#endif
+
 } // namespace otbr
 
 #endif // __APPLE__ || __NetBSD__ || __OpenBSD__
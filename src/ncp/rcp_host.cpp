@@ -30,9 +30,18 @@
 
 #include "ncp/rcp_host.hpp"
 
+#include <algorithm>
+
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
+#if OTBR_ENABLE_BORDER_ROUTING
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
 
 #include <openthread/backbone_router_ftd.h>
 #include <openthread/border_routing.h>
@@ -41,6 +50,7 @@
 #include <openthread/link_metrics.h>
 #include <openthread/logging.h>
 #include <openthread/nat64.h>
+#include <openthread/random_noncrypto.h>
 #include <openthread/srp_server.h>
 #include <openthread/tasklet.h>
 #include <openthread/thread.h>
@@ -52,8 +62,11 @@
 #include <openthread/platform/settings.h>
 
 #include "common/code_utils.hpp"
+#include "common/event_bus.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
+#include "utils/socket_utils.hpp"
 #if OTBR_ENABLE_FEATURE_FLAGS
 #include "proto/feature_flag.pb.h"
 #endif
@@ -66,6 +79,9 @@ static const uint16_t kThreadVersion12 = 3; ///< Thread Version 1.2
 static const uint16_t kThreadVersion13 = 4; ///< Thread Version 1.3
 static const uint16_t kThreadVersion14 = 5; ///< Thread Version 1.4
 
+// OpenThread passes no context to the neighbor table callback, the host of the single instance is kept instead.
+static RcpHost *sNeighborTableHost = nullptr;
+
 // =============================== OtNetworkProperties ===============================
 
 OtNetworkProperties::OtNetworkProperties(void)
@@ -78,6 +94,16 @@ otDeviceRole OtNetworkProperties::GetDeviceRole(void) const
     return otThreadGetDeviceRole(mInstance);
 }
 
+void OtNetworkProperties::GetDatasetActiveTlvs(otOperationalDatasetTlvs &aDatasetTlvs) const
+{
+    otError error = otDatasetGetActiveTlvs(mInstance, &aDatasetTlvs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        aDatasetTlvs.mLength = 0;
+    }
+}
+
 void OtNetworkProperties::SetInstance(otInstance *aInstance)
 {
     mInstance = aInstance;
@@ -90,7 +116,8 @@ RcpHost::RcpHost(const char                      *aInterfaceName,
                  const char                      *aBackboneInterfaceName,
                  bool                             aDryRun,
                  bool                             aEnableAutoAttach)
-    : mInstance(nullptr)
+    : MainloopProcessor(kPriorityThreadStack)
+    , mInstance(nullptr)
     , mEnableAutoAttach(aEnableAutoAttach)
 {
     VerifyOrDie(aRadioUrls.size() <= OT_PLATFORM_CONFIG_MAX_RADIO_URLS, "Too many Radio URLs!");
@@ -103,6 +130,13 @@ RcpHost::RcpHost(const char                      *aInterfaceName,
 
     for (const char *url : aRadioUrls)
     {
+        // The spinel transports are implemented by the OpenThread POSIX platform. An io_uring
+        // transport could only be plugged in as its vendor RCP bus, which is not provided here.
+        if (strstr(url, "io=uring") != nullptr)
+        {
+            otbrLogWarning("io_uring is not supported by the radio transport, 'io=uring' is ignored: %s", url);
+        }
+
         mConfig.mCoprocessorUrls.mUrls[mConfig.mCoprocessorUrls.mNum++] = url;
     }
     mConfig.mSpeedUpFactor = 1;
@@ -205,6 +239,12 @@ void RcpHost::Init(void)
     mInstance = otSysInit(&mConfig);
     assert(mInstance != nullptr);
 
+    {
+        const otRadioSpinelMetrics *spinelMetrics = otSysGetRadioSpinelMetrics();
+
+        mRcpRestorationCount = (spinelMetrics != nullptr) ? spinelMetrics->mRcpRestorationCount : 0;
+    }
+
     {
         otError result = otSetStateChangedCallback(mInstance, &RcpHost::HandleStateChanged, this);
 
@@ -212,11 +252,23 @@ void RcpHost::Init(void)
         VerifyOrExit(result == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
     }
 
+    sNeighborTableHost = this;
+    otThreadRegisterNeighborTableCallback(mInstance, &RcpHost::HandleNeighborTableChanged);
+
 #if OTBR_ENABLE_FEATURE_FLAGS && OTBR_ENABLE_TREL
     // Enable/Disable trel according to feature flag default value.
     otTrelSetEnabled(mInstance, featureFlagList.enable_trel());
 #endif
 
+#if OTBR_ENABLE_FEATURE_FLAGS
+    // The feature flags applied before a reset are lost by the new OpenThread instance.
+    if (mAppliedFeatureFlagList != nullptr)
+    {
+        agent::ThreadHelper::LogOpenThreadResult("Apply feature flags",
+                                                 ApplyFeatureFlagChanges(*mAppliedFeatureFlagList, nullptr));
+    }
+#endif
+
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 #if OTBR_ENABLE_SRP_SERVER_AUTO_ENABLE_MODE
     // Let SRP server use auto-enable mode. The auto-enable mode delegates the control of SRP server to the Border
@@ -244,41 +296,97 @@ void RcpHost::Init(void)
 
     OtNetworkProperties::SetInstance(mInstance);
 
+    if (IsAutoAttachEnabled())
+    {
+        StartAutoAttach();
+    }
+
 exit:
     SuccessOrDie(error, "Failed to initialize the RCP Host!");
 }
 
 #if OTBR_ENABLE_FEATURE_FLAGS
+/* Returns whether a feature flag differs from the applied one, all flags differ if none is applied */
+template <typename ValueType>
+static bool IsFeatureFlagChanged(const FeatureFlagList *aApplied,
+                                 const FeatureFlagList &aFeatureFlagList,
+                                 ValueType (FeatureFlagList::*aGetter)(void) const)
+{
+    return aApplied == nullptr || (aApplied->*aGetter)() != (aFeatureFlagList.*aGetter)();
+}
+
 otError RcpHost::ApplyFeatureFlagList(const FeatureFlagList &aFeatureFlagList)
 {
-    otError error = OT_ERROR_NONE;
+    otError     error = OT_ERROR_NONE;
+    std::string bytes = aFeatureFlagList.SerializeAsString();
+
+    // The same list is pushed periodically, applying it again is a no-op.
+    VerifyOrExit(mAppliedFeatureFlagList == nullptr || bytes != mAppliedFeatureFlagListBytes);
+
+    error = ApplyFeatureFlagChanges(aFeatureFlagList, mAppliedFeatureFlagList.get());
+
+    if (mAppliedFeatureFlagList == nullptr)
+    {
+        mAppliedFeatureFlagList = MakeUnique<FeatureFlagList>();
+    }
+    *mAppliedFeatureFlagList = aFeatureFlagList;
     // Save a cached copy of feature flags for debugging purpose.
-    mAppliedFeatureFlagListBytes = aFeatureFlagList.SerializeAsString();
+    mAppliedFeatureFlagListBytes = std::move(bytes);
+    mAppliedFeatureFlagListVersion++;
 
-#if OTBR_ENABLE_NAT64
-    otNat64SetEnabled(mInstance, aFeatureFlagList.enable_nat64());
-#endif
+    otbrLogInfo("Applied feature flag list version %u", mAppliedFeatureFlagListVersion);
 
-    if (aFeatureFlagList.enable_detailed_logging())
+exit:
+    return error;
+}
+
+otError RcpHost::ApplyFeatureFlagChanges(const FeatureFlagList &aFeatureFlagList, const FeatureFlagList *aApplied)
+{
+    otError error = OT_ERROR_NONE;
+
+#if OTBR_ENABLE_NAT64
+    if (IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::enable_nat64))
     {
-        error = SetOtbrAndOtLogLevel(ConvertProtoToOtbrLogLevel(aFeatureFlagList.detailed_logging_level()));
+        otNat64SetEnabled(mInstance, aFeatureFlagList.enable_nat64());
     }
-    else
+#endif
+
+    if (IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::enable_detailed_logging) ||
+        IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::detailed_logging_level))
     {
-        error = SetOtbrAndOtLogLevel(otbrLogGetDefaultLevel());
+        if (aFeatureFlagList.enable_detailed_logging())
+        {
+            error = SetOtbrAndOtLogLevel(ConvertProtoToOtbrLogLevel(aFeatureFlagList.detailed_logging_level()));
+        }
+        else
+        {
+            error = SetOtbrAndOtLogLevel(otbrLogGetDefaultLevel());
+        }
     }
 
 #if OTBR_ENABLE_TREL
-    otTrelSetEnabled(mInstance, aFeatureFlagList.enable_trel());
+    if (IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::enable_trel))
+    {
+        otTrelSetEnabled(mInstance, aFeatureFlagList.enable_trel());
+    }
 #endif
 #if OTBR_ENABLE_DNS_UPSTREAM_QUERY
-    otDnssdUpstreamQuerySetEnabled(mInstance, aFeatureFlagList.enable_dns_upstream_query());
+    if (IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::enable_dns_upstream_query))
+    {
+        otDnssdUpstreamQuerySetEnabled(mInstance, aFeatureFlagList.enable_dns_upstream_query());
+    }
 #endif
 #if OTBR_ENABLE_DHCP6_PD
-    otBorderRoutingDhcp6PdSetEnabled(mInstance, aFeatureFlagList.enable_dhcp6_pd());
+    if (IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::enable_dhcp6_pd))
+    {
+        otBorderRoutingDhcp6PdSetEnabled(mInstance, aFeatureFlagList.enable_dhcp6_pd());
+    }
 #endif
 #if OTBR_ENABLE_LINK_METRICS_TELEMETRY
-    otLinkMetricsManagerSetEnabled(mInstance, aFeatureFlagList.enable_link_metrics_manager());
+    if (IsFeatureFlagChanged(aApplied, aFeatureFlagList, &FeatureFlagList::enable_link_metrics_manager))
+    {
+        otLinkMetricsManagerSetEnabled(mInstance, aFeatureFlagList.enable_link_metrics_manager());
+    }
 #endif
 
     return error;
@@ -289,22 +397,107 @@ void RcpHost::Deinit(void)
 {
     assert(mInstance != nullptr);
 
+    mTaskRunner.Cancel(mAutoAttachTaskId);
+    mAutoAttachTaskId = 0;
+
     otSysDeinit();
     mInstance = nullptr;
 
     OtNetworkProperties::SetInstance(nullptr);
     mThreadStateChangedCallbacks.clear();
+    mNeighborTableChangedCallbacks.clear();
     mResetHandlers.clear();
+    sNeighborTableHost = nullptr;
 }
 
 void RcpHost::HandleStateChanged(otChangedFlags aFlags)
 {
+    mThreadHelper->InvalidateCaches(aFlags);
+
     for (auto &stateCallback : mThreadStateChangedCallbacks)
     {
         stateCallback(aFlags);
     }
 
+    EventBus::Publish(mStateChangedEvent, [this, aFlags](StateChangedEvent &aEvent) {
+        aEvent.mFlags = aFlags;
+        aEvent.mRole  = otThreadGetDeviceRole(mInstance);
+    });
+
     mThreadHelper->StateChangedCallback(aFlags);
+
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        UpdateTimeToAttach();
+        NotifyDeviceRoleChanged(GetDeviceRole());
+    }
+
+    // All the neighbors are removed when detaching, and the children are restored when becoming a router again.
+    if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_THREAD_ROLE))
+    {
+        ScheduleNeighborTableUpdate();
+    }
+}
+
+void RcpHost::HandleNeighborTableChanged(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo *aEntryInfo)
+{
+    OTBR_UNUSED_VARIABLE(aEvent);
+    OTBR_UNUSED_VARIABLE(aEntryInfo);
+
+    // The neighbor routers have no state changed flag, the event only triggers a new snapshot of the table.
+    if (sNeighborTableHost != nullptr)
+    {
+        sNeighborTableHost->ScheduleNeighborTableUpdate();
+    }
+}
+
+void RcpHost::ScheduleNeighborTableUpdate(void)
+{
+    VerifyOrExit(!mNeighborTableChangedCallbacks.empty() && !mNeighborTableUpdatePending);
+
+    // The changes in a row, e.g. all the children restored by becoming a router, are reported at once and out of the
+    // OpenThread callback context, where the table may be half updated.
+    mNeighborTableUpdatePending = true;
+    mTaskRunner.Post([this]() {
+        mNeighborTableUpdatePending = false;
+        UpdateNeighborTable();
+    });
+
+exit:
+    return;
+}
+
+void RcpHost::UpdateNeighborTable(void)
+{
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
+
+    VerifyOrExit(mInstance != nullptr);
+
+    mNeighborTableSnapshot.clear();
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+    {
+        agent::NeighborTableTracker::Entry entry;
+
+        entry.mExtAddress       = neighborInfo.mExtAddress;
+        entry.mRloc16           = neighborInfo.mRloc16;
+        entry.mIsChild          = neighborInfo.mIsChild;
+        entry.mRxOnWhenIdle     = neighborInfo.mRxOnWhenIdle;
+        entry.mFullThreadDevice = neighborInfo.mFullThreadDevice;
+        entry.mFullNetworkData  = neighborInfo.mFullNetworkData;
+        mNeighborTableSnapshot.push_back(entry);
+    }
+
+    mNeighborTableTracker.Update(mNeighborTableSnapshot, mNeighborTableChanges);
+    VerifyOrExit(!mNeighborTableChanges.empty());
+
+    for (auto &callback : mNeighborTableChangedCallbacks)
+    {
+        callback(mNeighborTableChanges, mNeighborTableTracker.GetGeneration());
+    }
+
+exit:
+    return;
 }
 
 void RcpHost::Update(MainloopContext &aMainloop)
@@ -315,17 +508,85 @@ void RcpHost::Update(MainloopContext &aMainloop)
     }
 
     otSysMainloopUpdate(mInstance, &aMainloop);
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    mThreadHelper->Update(aMainloop);
+#endif
 }
 
 void RcpHost::Process(const MainloopContext &aMainloop)
 {
+    const Timepoint start = Clock::now();
+    Timepoint       taskletsEnd;
+    Timepoint       platformEnd;
+    Timepoint       end;
+    uint32_t        passes = 1;
+
+    ++mSchedulerCounters.mIterations;
+
     otTaskletsProcess(mInstance);
+    taskletsEnd = Clock::now();
 
     otSysMainloopProcess(mInstance, &aMainloop);
+    platformEnd = Clock::now();
+    end         = platformEnd;
+    UpdateRecoveryCounters(std::chrono::duration_cast<Microseconds>(platformEnd - taskletsEnd));
 
-    if (IsAutoAttachEnabled() && mThreadHelper->TryResumeNetwork() == OT_ERROR_NONE)
+    // The tasklets posted by the received frames and the previous tasklets run in this iteration instead of each
+    // taking a whole mainloop iteration, as long as the other processors are not delayed for too long.
+    while (otTaskletsArePending(mInstance))
     {
-        DisableAutoAttach();
+        if (passes >= OTBR_RCP_HOST_TASKLET_PASSES)
+        {
+            ++mSchedulerCounters.mPassLimitReached;
+            break;
+        }
+
+        if (end - start >= Microseconds(OTBR_RCP_HOST_TASKLET_BUDGET_US))
+        {
+            ++mSchedulerCounters.mBudgetExhausted;
+            break;
+        }
+
+        otTaskletsProcess(mInstance);
+        ++passes;
+        end = Clock::now();
+    }
+
+    mSchedulerCounters.mTaskletPasses += passes;
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    mThreadHelper->Process(aMainloop);
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    MainloopManager::GetInstance().RecordProcessDuration(
+        "RcpHost.Tasklets", std::chrono::duration_cast<Microseconds>((taskletsEnd - start) + (end - platformEnd)));
+    MainloopManager::GetInstance().RecordProcessDuration(
+        "RcpHost.Platform", std::chrono::duration_cast<Microseconds>(platformEnd - taskletsEnd));
+#else
+    OTBR_UNUSED_VARIABLE(taskletsEnd);
+#endif
+}
+
+void RcpHost::UpdateRecoveryCounters(Microseconds aProcessDuration)
+{
+    const otRadioSpinelMetrics *spinelMetrics = otSysGetRadioSpinelMetrics();
+
+    VerifyOrExit(spinelMetrics != nullptr && spinelMetrics->mRcpRestorationCount > mRcpRestorationCount);
+
+    // The spinel driver restores the RCP while the platform is processed, so the restoration took at most as long as
+    // this processing. The host subsystems and their publications are kept meanwhile.
+    mRecoveryCounters.mRestorations += spinelMetrics->mRcpRestorationCount - mRcpRestorationCount;
+    mRecoveryCounters.mLastRestorationTime = aProcessDuration;
+    mRecoveryCounters.mMaxRestorationTime  = std::max(mRecoveryCounters.mMaxRestorationTime, aProcessDuration);
+    otbrLogNotice("Restored the RCP in %lld ms without resetting the host",
+                  static_cast<long long>(std::chrono::duration_cast<Milliseconds>(aProcessDuration).count()));
+
+exit:
+    if (spinelMetrics != nullptr)
+    {
+        mRcpRestorationCount = spinelMetrics->mRcpRestorationCount;
     }
 }
 
@@ -339,11 +600,203 @@ void RcpHost::DisableAutoAttach(void)
     mEnableAutoAttach = false;
 }
 
+void RcpHost::StartAutoAttach(void)
+{
+    mTaskRunner.Cancel(mAutoAttachTaskId);
+
+    mAutoAttachBackoff                = Milliseconds(OTBR_RCP_HOST_AUTO_ATTACH_MIN_BACKOFF_MS);
+    mAutoAttachStartTime              = Clock::now();
+    mWaitingForAttach                 = false;
+    mAutoAttachCounters.mRetryDelay   = Milliseconds::zero();
+    mAutoAttachCounters.mTimeToAttach = Microseconds::zero();
+    mAutoAttachCounters.mAttached     = false;
+
+    // The first attempt is made once the mainloop is running.
+    mAutoAttachTaskId = mTaskRunner.Post(Milliseconds::zero(), [this](void) { HandleAutoAttachTask(); });
+}
+
+void RcpHost::HandleAutoAttachTask(void)
+{
+    const Timepoint start = Clock::now();
+    otError         error;
+    Milliseconds    delay;
+
+    mAutoAttachTaskId               = 0;
+    mAutoAttachCounters.mRetryDelay = Milliseconds::zero();
+    VerifyOrExit(IsAutoAttachEnabled());
+
+    ++mAutoAttachCounters.mResumeAttempts;
+    error = mThreadHelper->TryResumeNetwork();
+
+    if (error == OT_ERROR_NONE)
+    {
+        // Without a saved network, the Thread stack stays disabled and no attach is expected.
+        DisableAutoAttach();
+        mWaitingForAttach = (GetDeviceRole() != OT_DEVICE_ROLE_DISABLED);
+        UpdateTimeToAttach();
+        ExitNow();
+    }
+
+    ++mAutoAttachCounters.mResumeFailures;
+
+    // The retries of the border routers restarted at the same time, e.g. after a power outage, are spread over the
+    // second half of the backoff.
+    delay = mAutoAttachBackoff / 2 +
+            Milliseconds(otRandomNonCryptoGetUint32() % static_cast<uint32_t>(mAutoAttachBackoff.count() / 2 + 1));
+    mAutoAttachBackoff = std::min(mAutoAttachBackoff * 2, Milliseconds(OTBR_RCP_HOST_AUTO_ATTACH_MAX_BACKOFF_MS));
+
+    otbrLogWarning("Failed to resume the network: %s, retry in %lld ms", otThreadErrorToString(error),
+                   static_cast<long long>(delay.count()));
+    mAutoAttachCounters.mRetryDelay = delay;
+    mAutoAttachTaskId               = mTaskRunner.Post(delay, [this](void) { HandleAutoAttachTask(); });
+
+exit:
+#if OTBR_ENABLE_MAINLOOP_STATS
+    MainloopManager::GetInstance().RecordProcessDuration(
+        "RcpHost.AutoAttach", std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+#else
+    OTBR_UNUSED_VARIABLE(start);
+#endif
+    return;
+}
+
+void RcpHost::UpdateTimeToAttach(void)
+{
+    otDeviceRole role = GetDeviceRole();
+
+    VerifyOrExit(mWaitingForAttach);
+    VerifyOrExit(role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER);
+
+    mWaitingForAttach                 = false;
+    mAutoAttachCounters.mAttached     = true;
+    mAutoAttachCounters.mTimeToAttach = std::chrono::duration_cast<Microseconds>(Clock::now() - mAutoAttachStartTime);
+    otbrLogInfo("Attached %lld ms after starting to resume the network",
+                static_cast<long long>(
+                    std::chrono::duration_cast<Milliseconds>(mAutoAttachCounters.mTimeToAttach).count()));
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_BORDER_ROUTING
+otbrError RcpHost::SetInfraIf(const char *aInfraIfName)
+{
+    otbrError    error     = OTBR_ERROR_NONE;
+    unsigned int ifIndex   = if_nametoindex(aInfraIfName);
+    int          icmp6Sock = -1;
+    bool         enabled;
+
+    VerifyOrExit(ifIndex != 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit((icmp6Sock = CreateIcmp6Socket(aInfraIfName)) >= 0, error = OTBR_ERROR_ERRNO);
+
+    // The Routing Manager only accepts another interface while it's disabled, the prefixes and routes it advertised
+    // on the previous interface are withdrawn when disabling it.
+    enabled = (otBorderRoutingGetState(mInstance) != OT_BORDER_ROUTING_STATE_DISABLED);
+    if (enabled)
+    {
+        otBorderRoutingSetEnabled(mInstance, /* aEnabled */ false);
+    }
+
+    // The platform takes the ownership of the socket and closes the one of the previous interface.
+    otSysSetInfraNetif(aInfraIfName, icmp6Sock);
+    icmp6Sock = -1;
+
+    VerifyOrExit(otBorderRoutingInit(mInstance, ifIndex, IsInfraIfRunning(aInfraIfName)) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
+
+    if (enabled)
+    {
+        VerifyOrExit(otBorderRoutingSetEnabled(mInstance, /* aEnabled */ true) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_OPENTHREAD);
+    }
+
+    // The OpenThread instance is initialized again on this interface if the co-processor is reset.
+    mConfig.mBackboneInterfaceName = aInfraIfName;
+
+exit:
+    if (icmp6Sock >= 0)
+    {
+        close(icmp6Sock);
+    }
+
+    otbrLogResult(error, "Set infrastructure interface %s", aInfraIfName);
+    return error;
+}
+
+int RcpHost::CreateIcmp6Socket(const char *aInfraIfName)
+{
+    otbrError           error = OTBR_ERROR_ERRNO;
+    int                 sock  = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketNonBlock);
+    struct icmp6_filter filter;
+    const int           kEnable   = 1;
+    const int           kHopLimit = 255;
+
+    VerifyOrExit(sock >= 0);
+
+    // Same as the socket opened by the OpenThread platform, which only receives the RS, RA and NA messages.
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    ICMP6_FILTER_SETPASS(ND_ROUTER_SOLICIT, &filter);
+    ICMP6_FILTER_SETPASS(ND_ROUTER_ADVERT, &filter);
+    ICMP6_FILTER_SETPASS(ND_NEIGHBOR_ADVERT, &filter);
+
+    VerifyOrExit(setsockopt(sock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0);
+    VerifyOrExit(setsockopt(sock, IPPROTO_IPV6, IPV6_RECVPKTINFO, &kEnable, sizeof(kEnable)) == 0);
+    VerifyOrExit(setsockopt(sock, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &kEnable, sizeof(kEnable)) == 0);
+    VerifyOrExit(setsockopt(sock, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &kHopLimit, sizeof(kHopLimit)) == 0);
+    VerifyOrExit(setsockopt(sock, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &kHopLimit, sizeof(kHopLimit)) == 0);
+    VerifyOrExit(setsockopt(sock, SOL_SOCKET, SO_BINDTODEVICE, aInfraIfName, strlen(aInfraIfName)) == 0);
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to create ICMPv6 socket on %s: %s", aInfraIfName, strerror(errno));
+
+        if (sock >= 0)
+        {
+            close(sock);
+            sock = -1;
+        }
+    }
+
+    return sock;
+}
+
+bool RcpHost::IsInfraIfRunning(const char *aInfraIfName)
+{
+    int          sock = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketNonBlock);
+    struct ifreq ifr;
+    bool         running = false;
+
+    VerifyOrExit(sock >= 0);
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, aInfraIfName, sizeof(ifr.ifr_name) - 1);
+
+    VerifyOrExit(ioctl(sock, SIOCGIFFLAGS, &ifr) == 0);
+    running = ((ifr.ifr_flags & IFF_UP) && (ifr.ifr_flags & IFF_RUNNING));
+
+exit:
+    if (sock >= 0)
+    {
+        close(sock);
+    }
+
+    return running;
+}
+#endif // OTBR_ENABLE_BORDER_ROUTING
+
 void RcpHost::PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask)
 {
     mTaskRunner.Post(std::move(aDelay), std::move(aTask));
 }
 
+void RcpHost::PostTimerTask(TaskRunner::Priority aPriority, Milliseconds aDelay, TaskRunner::Task<void> aTask)
+{
+    mTaskRunner.Post(aPriority, std::move(aDelay), std::move(aTask));
+}
+
 void RcpHost::RegisterResetHandler(std::function<void(void)> aHandler)
 {
     mResetHandlers.emplace_back(std::move(aHandler));
@@ -354,19 +807,35 @@ void RcpHost::AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback
     mThreadStateChangedCallbacks.emplace_back(std::move(aCallback));
 }
 
+void RcpHost::AddNeighborTableChangedCallback(NeighborTableChangedCallback aCallback)
+{
+    mNeighborTableChangedCallbacks.emplace_back(std::move(aCallback));
+}
+
 void RcpHost::Reset(void)
 {
+    const Timepoint start = Clock::now();
+
     gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
 
     otSysDeinit();
     mInstance = nullptr;
 
+    // The saved network is resumed by Init().
+    mEnableAutoAttach = true;
     Init();
+
+    // The host subsystems are kept, the handlers only bind them to the new OpenThread instance.
     for (auto &handler : mResetHandlers)
     {
         handler();
     }
-    mEnableAutoAttach = true;
+
+    ++mRecoveryCounters.mResets;
+    mRecoveryCounters.mLastResetTime = std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+    otbrLogInfo("Reset the OpenThread instance in %lld ms",
+                static_cast<long long>(
+                    std::chrono::duration_cast<Milliseconds>(mRecoveryCounters.mLastResetTime).count()));
 }
 
 const char *RcpHost::GetThreadVersion(void)
@@ -45,13 +45,48 @@
 #include <openthread/cli.h>
 #include <openthread/instance.h>
 #include <openthread/openthread-system.h>
+#include <openthread/thread_ftd.h>
 
 #include "common/mainloop.hpp"
 #include "common/task_runner.hpp"
 #include "common/types.hpp"
 #include "ncp/thread_host.hpp"
+#include "utils/neighbor_table_tracker.hpp"
 #include "utils/thread_helper.hpp"
 
+/**
+ * The max number of tasklet passes in one mainloop iteration.
+ *
+ */
+#ifndef OTBR_RCP_HOST_TASKLET_PASSES
+#define OTBR_RCP_HOST_TASKLET_PASSES 4
+#endif
+
+/**
+ * The time budget in microseconds of the Thread stack in one mainloop iteration, no more tasklet pass is started once
+ * it is exceeded.
+ *
+ */
+#ifndef OTBR_RCP_HOST_TASKLET_BUDGET_US
+#define OTBR_RCP_HOST_TASKLET_BUDGET_US 2000
+#endif
+
+/**
+ * The delay (in milliseconds) before the first retry of resuming the saved network, doubled after each failure.
+ *
+ */
+#ifndef OTBR_RCP_HOST_AUTO_ATTACH_MIN_BACKOFF_MS
+#define OTBR_RCP_HOST_AUTO_ATTACH_MIN_BACKOFF_MS 100
+#endif
+
+/**
+ * The maximum delay (in milliseconds) between the retries of resuming the saved network.
+ *
+ */
+#ifndef OTBR_RCP_HOST_AUTO_ATTACH_MAX_BACKOFF_MS
+#define OTBR_RCP_HOST_AUTO_ATTACH_MAX_BACKOFF_MS 30000
+#endif
+
 namespace otbr {
 #if OTBR_ENABLE_FEATURE_FLAGS
 // Forward declaration of FeatureFlagList proto.
@@ -75,6 +110,7 @@ public:
 
     // NetworkProperties methods
     otDeviceRole GetDeviceRole(void) const override;
+    void         GetDatasetActiveTlvs(otOperationalDatasetTlvs &aDatasetTlvs) const override;
 
     // Set the otInstance
     void SetInstance(otInstance *aInstance);
@@ -90,7 +126,57 @@ private:
 class RcpHost : public MainloopProcessor, public ThreadHost, public OtNetworkProperties
 {
 public:
-    using ThreadStateChangedCallback = std::function<void(otChangedFlags aFlags)>;
+    using ThreadStateChangedCallback   = std::function<void(otChangedFlags aFlags)>;
+    using NeighborTableChangedCallback =
+        std::function<void(const std::vector<agent::NeighborTableTracker::Change> &aChanges, uint32_t aGeneration)>;
+
+    /**
+     * This structure represents the event of the Thread state changes published on the `EventBus`.
+     *
+     */
+    struct StateChangedEvent
+    {
+        otChangedFlags mFlags; ///< The flags of the changed states.
+        otDeviceRole   mRole;  ///< The device role after the changes.
+    };
+
+    /**
+     * This structure represents the counters of the tasklet scheduling.
+     *
+     */
+    struct SchedulerCounters
+    {
+        uint64_t mIterations       = 0; ///< The number of processed mainloop iterations.
+        uint64_t mTaskletPasses    = 0; ///< The number of tasklet passes.
+        uint64_t mPassLimitReached = 0; ///< The number of iterations left with tasklets for reaching the pass cap.
+        uint64_t mBudgetExhausted  = 0; ///< The number of iterations left with tasklets for exhausting the budget.
+    };
+
+    /**
+     * This structure represents the counters of the automatic attach to the saved network.
+     *
+     */
+    struct AutoAttachCounters
+    {
+        uint64_t     mResumeAttempts = 0;                    ///< The number of attempts to resume the network.
+        uint64_t     mResumeFailures = 0;                    ///< The number of failed attempts.
+        Milliseconds mRetryDelay     = Milliseconds::zero(); ///< The delay of the scheduled retry, zero if none.
+        Microseconds mTimeToAttach   = Microseconds::zero(); ///< The time to attach, zero until attached.
+        bool         mAttached       = false;                ///< Whether the device attached after resuming.
+    };
+
+    /**
+     * This structure represents the counters of the recoveries from the failures of the RCP.
+     *
+     */
+    struct RecoveryCounters
+    {
+        uint64_t     mRestorations        = 0;                    ///< The number of restorations of the RCP.
+        Microseconds mLastRestorationTime = Microseconds::zero(); ///< The time of the last restoration.
+        Microseconds mMaxRestorationTime  = Microseconds::zero(); ///< The longest time of a restoration.
+        uint64_t     mResets              = 0;                    ///< The number of resets of the OpenThread instance.
+        Microseconds mLastResetTime       = Microseconds::zero(); ///< The time of the last reset.
+    };
 
     /**
      * This constructor initializes this object.
@@ -142,6 +228,40 @@ public:
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RcpHost"; }
+
+    /**
+     * This method returns the counters of the tasklet scheduling.
+     *
+     * With `OTBR_ENABLE_MAINLOOP_STATS`, the durations of the tasklets, the platform processing and the auto attach are
+     * also accounted to the mainloop processors "RcpHost.Tasklets", "RcpHost.Platform" and "RcpHost.AutoAttach".
+     *
+     * @returns The counters of the tasklet scheduling.
+     *
+     */
+    const SchedulerCounters &GetSchedulerCounters(void) const { return mSchedulerCounters; }
+
+    /**
+     * This method returns the counters of the automatic attach to the saved network.
+     *
+     * The time to attach is measured from the start of the automatic attach, i.e. the initialization or the reset of
+     * the host, until the device becomes a child, a router or a leader.
+     *
+     * @returns The counters of the automatic attach.
+     *
+     */
+    const AutoAttachCounters &GetAutoAttachCounters(void) const { return mAutoAttachCounters; }
+
+    /**
+     * This method returns the counters of the recoveries from the failures of the RCP.
+     *
+     * An RCP which resets unexpectedly is restored by the spinel driver, which applies the cached radio configuration
+     * again while the host keeps running. Only if the restoration fails, the whole host is reset.
+     *
+     * @returns The counters of the recoveries.
+     *
+     */
+    const RecoveryCounters &GetRecoveryCounters(void) const { return mRecoveryCounters; }
 
     /**
      * This method posts a task to the timer
@@ -152,6 +272,16 @@ public:
      */
     void PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask);
 
+    /**
+     * This method posts a task of a priority to the timer
+     *
+     * @param[in] aPriority  The priority of the task.
+     * @param[in] aDelay     The delay in milliseconds before executing the task.
+     * @param[in] aTask      The task function.
+     *
+     */
+    void PostTimerTask(TaskRunner::Priority aPriority, Milliseconds aDelay, TaskRunner::Task<void> aTask);
+
     /**
      * This method registers a reset handler.
      *
@@ -168,6 +298,17 @@ public:
      */
     void AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback);
 
+    /**
+     * This method adds a listener of the changes of the neighbor table, i.e. the children and the neighbor routers.
+     *
+     * The changes are reported with the generation of the neighbor table after them, so that a listener which missed
+     * a change, e.g. a dropped event, knows to read the whole table again.
+     *
+     * @param[in] aCallback  The callback to receive the changes of the neighbor table.
+     *
+     */
+    void AddNeighborTableChangedCallback(NeighborTableChangedCallback aCallback);
+
     /**
      * This method resets the OpenThread instance.
      *
@@ -190,12 +331,31 @@ public:
      */
     const char *GetInterfaceName(void) const override { return mConfig.mInterfaceName; }
 
+#if OTBR_ENABLE_BORDER_ROUTING
+    /**
+     * This method moves the border routing to another infrastructure network interface.
+     *
+     * The Thread network stays attached, only the Routing Manager of OpenThread is restarted on the new interface.
+     *
+     * @param[in] aInfraIfName  The infrastructure network interface name.
+     *
+     * @retval OTBR_ERROR_NONE        Successfully moved to the infrastructure network interface.
+     * @retval OTBR_ERROR_ERRNO       Failed to open the ICMPv6 socket on the infrastructure network interface.
+     * @retval OTBR_ERROR_OPENTHREAD  Failed to restart the Routing Manager.
+     *
+     */
+    otbrError SetInfraIf(const char *aInfraIfName);
+#endif
+
     static otbrLogLevel ConvertToOtbrLogLevel(otLogLevel aLogLevel);
 
 #if OTBR_ENABLE_FEATURE_FLAGS
     /**
      * Apply the feature flag values to OpenThread through OpenThread APIs.
      *
+     * Only the features whose flags differ from the applied list are updated, applying the applied list again does
+     * nothing.
+     *
      * @param[in] aFeatureFlagList  The feature flag list to be applied to OpenThread.
      *
      * @returns The error value of underlying OpenThread API calls.
@@ -213,6 +373,20 @@ public:
     {
         return mAppliedFeatureFlagListBytes;
     }
+
+    /**
+     * This method returns the version of the applied FeatureFlagList.
+     *
+     * The version starts at 0 when no FeatureFlagList is applied, and is incremented each time a different
+     * FeatureFlagList is applied.
+     *
+     * @returns The version of the applied FeatureFlagList.
+     *
+     */
+    uint32_t GetAppliedFeatureFlagListVersion(void) const
+    {
+        return mAppliedFeatureFlagListVersion;
+    }
 #endif
 
     ~RcpHost(void) override;
@@ -240,6 +414,10 @@ private:
     }
     void HandleStateChanged(otChangedFlags aFlags);
 
+    static void HandleNeighborTableChanged(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo *aEntryInfo);
+    void        ScheduleNeighborTableUpdate(void);
+    void        UpdateNeighborTable(void);
+
     static void HandleBackboneRouterDomainPrefixEvent(void                             *aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
                                                       const otIp6Prefix                *aDomainPrefix);
@@ -255,9 +433,22 @@ private:
 
     bool IsAutoAttachEnabled(void);
     void DisableAutoAttach(void);
+    void StartAutoAttach(void);
+    void HandleAutoAttachTask(void);
+    void UpdateTimeToAttach(void);
+    void UpdateRecoveryCounters(Microseconds aProcessDuration);
 
     otError SetOtbrAndOtLogLevel(otbrLogLevel aLevel);
 
+#if OTBR_ENABLE_FEATURE_FLAGS
+    otError ApplyFeatureFlagChanges(const FeatureFlagList &aFeatureFlagList, const FeatureFlagList *aApplied);
+#endif
+
+#if OTBR_ENABLE_BORDER_ROUTING
+    static int  CreateIcmp6Socket(const char *aInfraIfName);
+    static bool IsInfraIfRunning(const char *aInfraIfName);
+#endif
+
     otInstance *mInstance;
 
     otPlatformConfig                           mConfig;
@@ -265,11 +456,28 @@ private:
     std::vector<std::function<void(void)>>     mResetHandlers;
     TaskRunner                                 mTaskRunner;
     std::vector<ThreadStateChangedCallback>    mThreadStateChangedCallbacks;
+    StateChangedEvent                          mStateChangedEvent;
     bool                                       mEnableAutoAttach = false;
+    SchedulerCounters                          mSchedulerCounters;
+    TaskRunner::TaskId                         mAutoAttachTaskId = 0;
+    Milliseconds                               mAutoAttachBackoff;
+    Timepoint                                  mAutoAttachStartTime;
+    bool                                       mWaitingForAttach = false;
+    AutoAttachCounters                         mAutoAttachCounters;
+    RecoveryCounters                           mRecoveryCounters;
+    uint32_t                                   mRcpRestorationCount = 0;
+
+    std::vector<NeighborTableChangedCallback>        mNeighborTableChangedCallbacks;
+    agent::NeighborTableTracker                      mNeighborTableTracker;
+    std::vector<agent::NeighborTableTracker::Entry>  mNeighborTableSnapshot;
+    std::vector<agent::NeighborTableTracker::Change> mNeighborTableChanges;
+    bool                                             mNeighborTableUpdatePending = false;
 
 #if OTBR_ENABLE_FEATURE_FLAGS
     // The applied FeatureFlagList in ApplyFeatureFlagList call, used for debugging purpose.
-    std::string mAppliedFeatureFlagListBytes;
+    std::string                      mAppliedFeatureFlagListBytes;
+    std::unique_ptr<FeatureFlagList> mAppliedFeatureFlagList;
+    uint32_t                         mAppliedFeatureFlagListVersion = 0;
 #endif
 };
 
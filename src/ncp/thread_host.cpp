@@ -41,6 +41,19 @@
 namespace otbr {
 namespace Ncp {
 
+void NetworkProperties::AddDeviceRoleChangedCallback(DeviceRoleChangedCallback aCallback)
+{
+    mDeviceRoleChangedCallbacks.push_back(std::move(aCallback));
+}
+
+void NetworkProperties::NotifyDeviceRoleChanged(otDeviceRole aRole)
+{
+    for (const auto &callback : mDeviceRoleChangedCallbacks)
+    {
+        callback(aRole);
+    }
+}
+
 std::unique_ptr<ThreadHost> ThreadHost::Create(const char                      *aInterfaceName,
                                                const std::vector<const char *> &aRadioUrls,
                                                const char                      *aBackboneInterfaceName,
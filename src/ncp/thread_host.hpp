@@ -36,6 +36,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <openthread/dataset.h>
 #include <openthread/error.h>
@@ -56,6 +57,8 @@ namespace Ncp {
 class NetworkProperties
 {
 public:
+    using DeviceRoleChangedCallback = std::function<void(otDeviceRole)>;
+
     /**
      * Returns the device role.
      *
@@ -64,11 +67,36 @@ public:
      */
     virtual otDeviceRole GetDeviceRole(void) const = 0;
 
+    /**
+     * Returns the active operational dataset tlvs.
+     *
+     * @param[out] aDatasetTlvs  A reference to where the Active Operational Dataset will be placed. Its length is 0 if
+     *                           there is no active dataset.
+     *
+     */
+    virtual void GetDatasetActiveTlvs(otOperationalDatasetTlvs &aDatasetTlvs) const = 0;
+
+    /**
+     * This method adds a callback which is called when the device role changes.
+     *
+     * The callbacks are kept when the Thread host is reset.
+     *
+     * @param[in] aCallback  The callback to receive the new device role.
+     *
+     */
+    void AddDeviceRoleChangedCallback(DeviceRoleChangedCallback aCallback);
+
     /**
      * The destructor.
      *
      */
     virtual ~NetworkProperties(void) = default;
+
+protected:
+    void NotifyDeviceRoleChanged(otDeviceRole aRole);
+
+private:
+    std::vector<DeviceRoleChangedCallback> mDeviceRoleChangedCallbacks;
 };
 
 /**
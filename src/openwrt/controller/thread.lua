@@ -243,12 +243,13 @@ function thread_state()
 	luci.http.prepare_content("application/json")
 
 	local result = {}
-	result.state = threadget("state").State
+	local status = threadget("status")
+	result.state = status.State
 
 	if(result.state ~= "disabled") then
-		result.panid = threadget("panid").PanId
-		result.channel = threadget("channel").Channel
-		result.networkname = threadget("networkname").NetworkName
+		result.panid = status.PanId
+		result.channel = status.Channel
+		result.networkname = status.NetworkName
 	end
 	luci.http.write_json(result)
 end
@@ -266,13 +267,12 @@ function thread_neighbors()
 	local neighbor = neighborlist()
 
 	result.neighbor = neighbor.neighborlist
+	result.state = neighbor.state
 
 	local joiner = joinerlist()
 	result.joinernum = joiner.joinernum
 	result.joinerlist = joiner.joinerlist
 
-	result.state = threadget("state").State
-
 	luci.http.write_json(result)
 end
 
@@ -281,17 +281,17 @@ function networkdata()
 	local data = { }
 	local l = { }
 
-	local result = connect_ubus("networkdata")
+	local status = connect_ubus("status")
 
-	for k, v in pairs(result) do
+	for k, v in pairs(status.networkdata) do
 		l[#l+1] = v
 	end
 
 	data.connect = l
-	data.state = threadget("state").State
-	data.rloc16 = threadget("rloc16").rloc16
-	data.joinernum = threadget("joinernum").joinernum
-	data.leader = threadget("leaderdata").leaderdata.LeaderRouterId
+	data.state = status.State
+	data.rloc16 = status.rloc16
+	data.joinernum = status.joinernum
+	data.leader = status.leaderdata and status.leaderdata.LeaderRouterId
 	return data
 end
 
@@ -318,13 +318,11 @@ function neighborlist()
 	local l = { }
 	local data = { }
 
-	local state = threadget("state").State
+	tmpResult = connect_ubus("neighbors")
 
-	if state == 'child' then
-		tmpResult = connect_ubus("parent")
-		result = tmpResult.parent_list
+	if tmpResult.State == 'child' then
+		result = tmpResult.parent_list or { }
 	else
-		tmpResult = connect_ubus("neighbor")
 		result = tmpResult.neighbor_list
 	end
 
@@ -333,6 +331,7 @@ function neighborlist()
 	end
 
 	data.neighborlist = l
+	data.state = tmpResult.State
 	return data
 end
 
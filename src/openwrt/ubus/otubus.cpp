@@ -34,23 +34,31 @@
 
 #include "openwrt/ubus/otubus.hpp"
 
-#include <mutex>
+#include <thread>
+
+#include <errno.h>
+#include <string.h>
 
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <sys/eventfd.h>
+#include <unistd.h>
 
 #include <openthread/commissioner.h>
+#include <openthread/netdata.h>
 #include <openthread/thread.h>
 #include <openthread/thread_ftd.h>
 
 #include "common/logging.hpp"
 #include "ncp/rcp_host.hpp"
+#include "utils/hex.hpp"
+#include "utils/joiner_batch.hpp"
+#include "utils/thread_helper.hpp"
 
 namespace otbr {
 namespace ubus {
 
 static UbusServer *sUbusServerInstance = nullptr;
-static int         sUbusEfd            = -1;
 static void       *sJsonUri            = nullptr;
 static int         sBufNum;
 
@@ -58,19 +66,33 @@ const static int PANID_LENGTH      = 10;
 const static int XPANID_LENGTH     = 64;
 const static int NETWORKKEY_LENGTH = 64;
 
-UbusServer::UbusServer(Ncp::RcpHost *aHost, std::mutex *aMutex)
-    : mIfFinishScan(false)
-    , mContext(nullptr)
+UbusServer::UbusServer(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner)
+    : mContext(nullptr)
     , mSockPath(nullptr)
     , mHost(aHost)
-    , mHostMutex(aMutex)
+    , mTaskRunner(aTaskRunner)
     , mSecond(0)
 {
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
     memset(&mBuf, 0, sizeof(mBuf));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
+    memset(&mNotificationBuf, 0, sizeof(mNotificationBuf));
+    memset(&mReplyEvent, 0, sizeof(mReplyEvent));
 
     blob_buf_init(&mBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
+    blob_buf_init(&mScanBuf, 0);
+    blob_buf_init(&mNotificationBuf, 0);
+
+    mReplyEvent.cb = &UbusServer::HandleReplyEvent;
+    mReplyEvent.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    // The clients subscribe to the notifications instead of polling the state.
+    mHost->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mHost->AddNeighborTableChangedCallback(
+        [this](const std::vector<agent::NeighborTableTracker::Change> &aChanges, uint32_t aGeneration) {
+            HandleNeighborTableChanged(aChanges, aGeneration);
+        });
 }
 
 UbusServer &UbusServer::GetInstance(void)
@@ -78,9 +100,179 @@ UbusServer &UbusServer::GetInstance(void)
     return *sUbusServerInstance;
 }
 
-void UbusServer::Initialize(Ncp::RcpHost *aHost, std::mutex *aMutex)
+void UbusServer::Initialize(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner)
+{
+    sUbusServerInstance = new UbusServer(aHost, aTaskRunner);
+}
+
+int UbusServer::DeferRequest(struct ubus_context      *aContext,
+                             struct ubus_object       *aObj,
+                             struct ubus_request_data *aRequest,
+                             const char               *aMethod,
+                             struct blob_attr         *aMsg,
+                             RequestHandler            aHandler)
+{
+    DeferredRequest *request = new DeferredRequest();
+
+    request->mHandler = aHandler;
+
+    return DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, request);
+}
+
+int UbusServer::DeferRequest(struct ubus_context      *aContext,
+                             struct ubus_object       *aObj,
+                             struct ubus_request_data *aRequest,
+                             const char               *aMethod,
+                             struct blob_attr         *aMsg,
+                             ActionHandler             aHandler,
+                             const char               *aAction)
+{
+    DeferredRequest *request = new DeferredRequest();
+
+    request->mActionHandler = aHandler;
+    request->mAction        = aAction;
+
+    return DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, request);
+}
+
+int UbusServer::DeferRequest(struct ubus_context      *aContext,
+                             struct ubus_object       *aObj,
+                             struct ubus_request_data *aRequest,
+                             const char               *aMethod,
+                             struct blob_attr         *aMsg,
+                             DeferredRequest          *aDeferred)
+{
+    // The object and the method name are static, but the message only lives until this handler returns.
+    aDeferred->mContext = aContext;
+    aDeferred->mObject  = aObj;
+    aDeferred->mMethod  = aMethod;
+    aDeferred->mMsg     = (aMsg != nullptr) ? blob_memdup(aMsg) : nullptr;
+
+    ubus_defer_request(aContext, aRequest, aDeferred);
+    mTaskRunner->Post([this, aDeferred]() { ProcessDeferredRequest(*aDeferred); });
+
+    return UBUS_STATUS_OK;
+}
+
+void UbusServer::ProcessDeferredRequest(DeferredRequest &aRequest)
+{
+    // Runs on the mainloop thread, which is the only one accessing the OpenThread instance.
+    if (aRequest.mActionHandler != nullptr)
+    {
+        (this->*aRequest.mActionHandler)(aRequest.mContext, aRequest.mObject, &aRequest, aRequest.mMethod,
+                                         aRequest.mMsg, aRequest.mAction);
+    }
+    else
+    {
+        (this->*aRequest.mHandler)(aRequest.mContext, aRequest.mObject, &aRequest, aRequest.mMethod, aRequest.mMsg);
+    }
+}
+
+void UbusServer::SendReply(struct ubus_request_data *aRequest, struct blob_attr *aReply)
+{
+    DeferredRequest *request = static_cast<DeferredRequest *>(aRequest);
+
+    request->mReply = blob_memdup(aReply);
+
+    {
+        std::lock_guard<std::mutex> lock(mReplyMutex);
+
+        mReplies.push_back(request);
+    }
+
+    WakeUpUbusThread();
+}
+
+void UbusServer::SendPartialReply(struct ubus_request_data *aRequest, struct blob_attr *aReply)
+{
+    PartialReply reply;
+
+    reply.mRequest = static_cast<DeferredRequest *>(aRequest);
+    reply.mReply   = blob_memdup(aReply);
+
+    {
+        std::lock_guard<std::mutex> lock(mReplyMutex);
+
+        mPartialReplies.push_back(reply);
+    }
+
+    WakeUpUbusThread();
+}
+
+void UbusServer::Notify(const char *aType)
+{
+    Notification notification;
+
+    notification.mType = aType;
+    notification.mMsg  = blob_memdup(mNotificationBuf.head);
+
+    {
+        std::lock_guard<std::mutex> lock(mReplyMutex);
+
+        mNotifications.push_back(notification);
+    }
+
+    WakeUpUbusThread();
+}
+
+void UbusServer::WakeUpUbusThread(void)
+{
+    uint64_t eventNum = 1;
+
+    if (write(mReplyEvent.fd, &eventNum, sizeof(eventNum)) != sizeof(eventNum))
+    {
+        otbrLogWarning("Failed to wake up ubus thread: %s", strerror(errno));
+    }
+}
+
+void UbusServer::HandleReplyEvent(struct uloop_fd *aFd, unsigned int aEvents)
+{
+    GetInstance().HandleReplyEventDetail(aFd, aEvents);
+}
+
+void UbusServer::HandleReplyEventDetail(struct uloop_fd *aFd, unsigned int aEvents)
 {
-    sUbusServerInstance = new UbusServer(aHost, aMutex);
+    OT_UNUSED_VARIABLE(aEvents);
+
+    std::vector<PartialReply>      partialReplies;
+    std::vector<DeferredRequest *> replies;
+    std::vector<Notification>      notifications;
+    uint64_t                       eventNum;
+
+    if (read(aFd->fd, &eventNum, sizeof(eventNum)) != sizeof(eventNum) && errno != EAGAIN)
+    {
+        otbrLogWarning("Failed to read ubus reply event: %s", strerror(errno));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mReplyMutex);
+
+        partialReplies.swap(mPartialReplies);
+        replies.swap(mReplies);
+        notifications.swap(mNotifications);
+    }
+
+    // The partial replies of a request are queued before its final reply, they are sent first.
+    for (const PartialReply &reply : partialReplies)
+    {
+        ubus_send_reply(reply.mRequest->mContext, reply.mRequest, reply.mReply);
+        free(reply.mReply);
+    }
+
+    for (DeferredRequest *request : replies)
+    {
+        if (request->mReply != nullptr)
+        {
+            ubus_send_reply(request->mContext, request, request->mReply);
+        }
+        ubus_complete_deferred_request(request->mContext, request, UBUS_STATUS_OK);
+
+        free(request->mReply);
+        free(request->mMsg);
+        delete request;
+    }
+
+    SendNotifications(notifications);
 }
 
 enum
@@ -96,6 +288,12 @@ enum
     ADD_JOINER_MAX,
 };
 
+enum
+{
+    JOINERS,
+    JOINER_BATCH_MAX,
+};
+
 enum
 {
     NETWORKKEY,
@@ -147,6 +345,10 @@ static const struct blobmsg_policy macfilterSetStatePolicy[SET_NETWORK_MAX] = {
     [SETNETWORK] = {.name = "state", .type = BLOBMSG_TYPE_STRING},
 };
 
+static const struct blobmsg_policy scanPolicy[SET_NETWORK_MAX] = {
+    [SETNETWORK] = {.name = "stream", .type = BLOBMSG_TYPE_BOOL},
+};
+
 static const struct blobmsg_policy removeJoinerPolicy[SET_NETWORK_MAX] = {
     [SETNETWORK] = {.name = "eui64", .type = BLOBMSG_TYPE_STRING},
 };
@@ -156,6 +358,10 @@ static const struct blobmsg_policy addJoinerPolicy[ADD_JOINER_MAX] = {
     [EUI64] = {.name = "eui64", .type = BLOBMSG_TYPE_STRING},
 };
 
+static const struct blobmsg_policy joinerBatchPolicy[JOINER_BATCH_MAX] = {
+    [JOINERS] = {.name = "joiners", .type = BLOBMSG_TYPE_ARRAY},
+};
+
 static const struct blobmsg_policy mgmtsetPolicy[MGMTSET_MAX] = {
     [NETWORKKEY]  = {.name = "networkkey", .type = BLOBMSG_TYPE_STRING},
     [NETWORKNAME] = {.name = "networkname", .type = BLOBMSG_TYPE_STRING},
@@ -166,7 +372,7 @@ static const struct blobmsg_policy mgmtsetPolicy[MGMTSET_MAX] = {
 };
 
 static const struct ubus_method otbrMethods[] = {
-    {"scan", &UbusServer::UbusScanHandler, 0, 0, nullptr, 0},
+    {"scan", &UbusServer::UbusScanHandler, 0, 0, scanPolicy, ARRAY_SIZE(scanPolicy)},
     {"channel", &UbusServer::UbusChannelHandler, 0, 0, nullptr, 0},
     {"setchannel", &UbusServer::UbusSetChannelHandler, 0, 0, setChannelPolicy, ARRAY_SIZE(setChannelPolicy)},
     {"networkname", &UbusServer::UbusNetworknameHandler, 0, 0, nullptr, 0},
@@ -205,8 +411,14 @@ static const struct ubus_method otbrMethods[] = {
     {"macfilterstate", &UbusServer::UbusMacfilterStateHandler, 0, 0, nullptr, 0},
     {"macfilteraddr", &UbusServer::UbusMacfilterAddrHandler, 0, 0, nullptr, 0},
     {"joineradd", &UbusServer::UbusJoinerAddHandler, 0, 0, addJoinerPolicy, ARRAY_SIZE(addJoinerPolicy)},
+    {"joineraddbatch", &UbusServer::UbusJoinerAddBatchHandler, 0, 0, joinerBatchPolicy,
+     ARRAY_SIZE(joinerBatchPolicy)},
+    {"joinerremovebatch", &UbusServer::UbusJoinerRemoveBatchHandler, 0, 0, joinerBatchPolicy,
+     ARRAY_SIZE(joinerBatchPolicy)},
     {"mgmtset", &UbusServer::UbusMgmtsetHandler, 0, 0, mgmtsetPolicy, ARRAY_SIZE(mgmtsetPolicy)},
     {"interfacename", &UbusServer::UbusInterfaceNameHandler, 0, 0, nullptr, 0},
+    {"status", &UbusServer::UbusStatusHandler, 0, 0, nullptr, 0},
+    {"neighbors", &UbusServer::UbusNeighborsHandler, 0, 0, nullptr, 0},
 };
 
 static struct ubus_object_type otbrObjType = {"otbr_prog", 0, otbrMethods, ARRAY_SIZE(otbrMethods)};
@@ -223,75 +435,151 @@ static struct ubus_object otbr = {
     n_methods : ARRAY_SIZE(otbrMethods),
 };
 
-void UbusServer::ProcessScan(void)
+void UbusServer::SendNotifications(std::vector<Notification> &aNotifications)
 {
-    otError  error        = OT_ERROR_NONE;
-    uint32_t scanChannels = 0;
-    uint16_t scanDuration = 0;
+    for (const Notification &notification : aNotifications)
+    {
+        char event[sizeof("otbr.") + 16];
 
-    mHostMutex->lock();
-    SuccessOrExit(error = otLinkActiveScan(mHost->GetInstance(), scanChannels, scanDuration,
-                                           &UbusServer::HandleActiveScanResult, this));
-exit:
-    mHostMutex->unlock();
-    return;
+        if (otbr.has_subscribers && ubus_notify(mContext, &otbr, notification.mType, notification.mMsg, -1) != 0)
+        {
+            otbrLogWarning("Failed to notify %s", notification.mType);
+        }
+
+        snprintf(event, sizeof(event), "otbr.%s", notification.mType);
+        if (ubus_send_event(mContext, event, notification.mMsg) != 0)
+        {
+            otbrLogWarning("Failed to send event %s", event);
+        }
+
+        free(notification.mMsg);
+    }
+
+    aNotifications.clear();
 }
 
-void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
+void UbusServer::HandleThreadStateChanged(otChangedFlags aFlags)
 {
-    static_cast<UbusServer *>(aContext)->HandleActiveScanResultDetail(aResult);
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        char state[10];
+
+        GetState(mHost->GetInstance(), state);
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_string(&mNotificationBuf, "State", state);
+        Notify("role");
+    }
+
+    if (aFlags & (OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_PENDING_DATASET))
+    {
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_u8(&mNotificationBuf, "Active", (aFlags & OT_CHANGED_ACTIVE_DATASET) != 0);
+        blobmsg_add_u8(&mNotificationBuf, "Pending", (aFlags & OT_CHANGED_PENDING_DATASET) != 0);
+        Notify("dataset");
+    }
+
+    if (aFlags & OT_CHANGED_THREAD_NETDATA)
+    {
+        blob_buf_init(&mNotificationBuf, 0);
+        blobmsg_add_u32(&mNotificationBuf, "Version", otNetDataGetVersion(mHost->GetInstance()));
+        blobmsg_add_u32(&mNotificationBuf, "StableVersion", otNetDataGetStableVersion(mHost->GetInstance()));
+        Notify("networkdata");
+    }
 }
 
-void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
+void UbusServer::HandleNeighborTableChanged(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                            uint32_t                                                aGeneration)
 {
-    char byte2char[5] = "";
-    for (int i = 0; i < aLength; i++)
+    static const char *const kChangeTypes[] = {"added", "removed", "updated"};
+
+    void *jsonList;
+
+    blob_buf_init(&mNotificationBuf, 0);
+    blobmsg_add_u32(&mNotificationBuf, "Generation", aGeneration);
+    jsonList = blobmsg_open_array(&mNotificationBuf, "Changes");
+
+    for (const agent::NeighborTableTracker::Change &change : aChanges)
     {
-        sprintf(byte2char, "%02x", aBytes[i]);
-        strcat(aOutput, byte2char);
+        void *json                      = blobmsg_open_table(&mNotificationBuf, nullptr);
+        char  extAddress[XPANID_LENGTH] = "";
+        char  rloc[PANID_LENGTH];
+
+        OutputBytes(change.mEntry.mExtAddress.m8, sizeof(change.mEntry.mExtAddress.m8), extAddress);
+        sprintf(rloc, "0x%04x", change.mEntry.mRloc16);
+        blobmsg_add_string(&mNotificationBuf, "Change", kChangeTypes[change.mType]);
+        blobmsg_add_string(&mNotificationBuf, "ExtAddress", extAddress);
+        blobmsg_add_string(&mNotificationBuf, "Rloc16", rloc);
+        blobmsg_add_u8(&mNotificationBuf, "Child", change.mEntry.mIsChild);
+        blobmsg_close_table(&mNotificationBuf, json);
     }
+
+    blobmsg_close_array(&mNotificationBuf, jsonList);
+    Notify("neighbor");
+}
+
+void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
+{
+    // The hex string is appended to the output, as `strcat()` would.
+    aOutput += strlen(aOutput);
+    aOutput[Utils::Bytes2Hex(aBytes, aLength, aOutput, Utils::HexCase::kLower)] = '\0';
 }
 
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
 {
+    OT_UNUSED_VARIABLE(aContext);
+
     blobmsg_add_u16(&mBuf, "Error", aError);
-    ubus_send_reply(aContext, aRequest, mBuf.head);
+    SendReply(aRequest, mBuf.head);
 }
 
-void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
+void UbusServer::AddScanResult(struct blob_buf &aBuf, const otActiveScanResult &aResult)
 {
-    void *jsonList = nullptr;
-
     char panidstring[PANID_LENGTH];
     char xpanidstring[XPANID_LENGTH] = "";
 
-    if (aResult == nullptr)
-    {
-        blobmsg_close_array(&mBuf, sJsonUri);
-        mIfFinishScan = true;
-        goto exit;
-    }
+    blobmsg_add_string(&aBuf, "NetworkName", aResult.mNetworkName.m8);
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    OutputBytes(aResult.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
+    blobmsg_add_string(&aBuf, "ExtendedPanId", xpanidstring);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    sprintf(panidstring, "0x%04x", aResult.mPanId);
+    blobmsg_add_string(&aBuf, "PanId", panidstring);
 
-    OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    blobmsg_add_u32(&aBuf, "Channel", aResult.mChannel);
 
-    sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_u32(&aBuf, "Rssi", aResult.mRssi);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    blobmsg_add_u32(&aBuf, "Lqi", aResult.mLqi);
+}
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+void UbusServer::HandleScanResult(struct ubus_request_data *aRequest, const otActiveScanResult &aResult)
+{
+    blob_buf_init(&mScanBuf, 0);
+    AddScanResult(mScanBuf, aResult);
+    SendPartialReply(aRequest, mScanBuf.head);
+}
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
+void UbusServer::HandleScanDone(struct ubus_request_data              *aRequest,
+                                otError                                aError,
+                                const std::vector<otActiveScanResult> &aResults)
+{
+    void *scanList;
 
-    blobmsg_close_table(&mBuf, jsonList);
+    // All the requests coalesced into a scan complete one after the other, each reply is copied when it is sent.
+    blob_buf_init(&mScanBuf, 0);
+    scanList = blobmsg_open_array(&mScanBuf, "scan_list");
 
-exit:
-    return;
+    for (const otActiveScanResult &result : aResults)
+    {
+        void *jsonList = blobmsg_open_table(&mScanBuf, nullptr);
+
+        AddScanResult(mScanBuf, result);
+        blobmsg_close_table(&mScanBuf, jsonList);
+    }
+
+    blobmsg_close_array(&mScanBuf, scanList);
+    blobmsg_add_u16(&mScanBuf, "Error", aError);
+    SendReply(aRequest, mScanBuf.head);
 }
 
 int UbusServer::UbusScanHandler(struct ubus_context      *aContext,
@@ -300,7 +588,7 @@ int UbusServer::UbusScanHandler(struct ubus_context      *aContext,
                                 const char               *aMethod,
                                 struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusScanHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusScanHandlerDetail);
 }
 
 int UbusServer::UbusScanHandlerDetail(struct ubus_context      *aContext,
@@ -309,35 +597,33 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context      *aContext,
                                       const char               *aMethod,
                                       struct blob_attr         *aMsg)
 {
+    OT_UNUSED_VARIABLE(aContext);
     OT_UNUSED_VARIABLE(aObj);
     OT_UNUSED_VARIABLE(aMethod);
-    OT_UNUSED_VARIABLE(aMsg);
-
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
-
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
+    struct blob_attr                      *tb[SET_NETWORK_MAX];
+    agent::ThreadHelper::ScanResultHandler resultHandler = nullptr;
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
+    if (aMsg != nullptr)
     {
-        error = OT_ERROR_FAILED;
-        goto exit;
+        blobmsg_parse(scanPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+        if (tb[SETNETWORK] != nullptr && blobmsg_get_bool(tb[SETNETWORK]))
+        {
+            // Each result is sent in a partial reply as soon as it is received, the final reply still has them all.
+            resultHandler = [this, aRequest](const otActiveScanResult &aResult) {
+                HandleScanResult(aRequest, aResult);
+            };
+        }
     }
 
-    while (!mIfFinishScan)
-    {
-        sleep(1);
-    }
+    // The reply is sent when the scan is done, a scan in progress or just completed is shared with the other clients
+    // of the Thread helper.
+    mHost->GetThreadHelper()->Scan(
+        [this, aRequest](otError aError, const std::vector<otActiveScanResult> &aResults) {
+            HandleScanDone(aRequest, aError, aResults);
+        },
+        resultHandler);
 
-exit:
-    AppendResult(error, aContext, aRequest);
     return 0;
 }
 
@@ -347,7 +633,8 @@ int UbusServer::UbusChannelHandler(struct ubus_context      *aContext,
                                    const char               *aMethod,
                                    struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "channel");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "channel");
 }
 
 int UbusServer::UbusSetChannelHandler(struct ubus_context      *aContext,
@@ -356,7 +643,8 @@ int UbusServer::UbusSetChannelHandler(struct ubus_context      *aContext,
                                       const char               *aMethod,
                                       struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "channel");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "channel");
 }
 
 int UbusServer::UbusJoinerNumHandler(struct ubus_context      *aContext,
@@ -365,7 +653,8 @@ int UbusServer::UbusJoinerNumHandler(struct ubus_context      *aContext,
                                      const char               *aMethod,
                                      struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "joinernum");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "joinernum");
 }
 
 int UbusServer::UbusNetworknameHandler(struct ubus_context      *aContext,
@@ -374,7 +663,8 @@ int UbusServer::UbusNetworknameHandler(struct ubus_context      *aContext,
                                        const char               *aMethod,
                                        struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkname");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "networkname");
 }
 
 int UbusServer::UbusSetNetworknameHandler(struct ubus_context      *aContext,
@@ -383,7 +673,8 @@ int UbusServer::UbusSetNetworknameHandler(struct ubus_context      *aContext,
                                           const char               *aMethod,
                                           struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkname");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "networkname");
 }
 
 int UbusServer::UbusStateHandler(struct ubus_context      *aContext,
@@ -392,7 +683,8 @@ int UbusServer::UbusStateHandler(struct ubus_context      *aContext,
                                  const char               *aMethod,
                                  struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "state");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "state");
 }
 
 int UbusServer::UbusRloc16Handler(struct ubus_context      *aContext,
@@ -401,7 +693,8 @@ int UbusServer::UbusRloc16Handler(struct ubus_context      *aContext,
                                   const char               *aMethod,
                                   struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "rloc16");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "rloc16");
 }
 
 int UbusServer::UbusPanIdHandler(struct ubus_context      *aContext,
@@ -410,7 +703,8 @@ int UbusServer::UbusPanIdHandler(struct ubus_context      *aContext,
                                  const char               *aMethod,
                                  struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "panid");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "panid");
 }
 
 int UbusServer::UbusSetPanIdHandler(struct ubus_context      *aContext,
@@ -419,7 +713,8 @@ int UbusServer::UbusSetPanIdHandler(struct ubus_context      *aContext,
                                     const char               *aMethod,
                                     struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "panid");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "panid");
 }
 
 int UbusServer::UbusExtPanIdHandler(struct ubus_context      *aContext,
@@ -428,7 +723,8 @@ int UbusServer::UbusExtPanIdHandler(struct ubus_context      *aContext,
                                     const char               *aMethod,
                                     struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "extpanid");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "extpanid");
 }
 
 int UbusServer::UbusSetExtPanIdHandler(struct ubus_context      *aContext,
@@ -437,7 +733,8 @@ int UbusServer::UbusSetExtPanIdHandler(struct ubus_context      *aContext,
                                        const char               *aMethod,
                                        struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "extpanid");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "extpanid");
 }
 
 int UbusServer::UbusPskcHandler(struct ubus_context      *aContext,
@@ -446,7 +743,7 @@ int UbusServer::UbusPskcHandler(struct ubus_context      *aContext,
                                 const char               *aMethod,
                                 struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "pskc");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation, "pskc");
 }
 
 int UbusServer::UbusSetPskcHandler(struct ubus_context      *aContext,
@@ -455,7 +752,7 @@ int UbusServer::UbusSetPskcHandler(struct ubus_context      *aContext,
                                    const char               *aMethod,
                                    struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "pskc");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation, "pskc");
 }
 
 int UbusServer::UbusNetworkkeyHandler(struct ubus_context      *aContext,
@@ -464,7 +761,8 @@ int UbusServer::UbusNetworkkeyHandler(struct ubus_context      *aContext,
                                       const char               *aMethod,
                                       struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkkey");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "networkkey");
 }
 
 int UbusServer::UbusSetNetworkkeyHandler(struct ubus_context      *aContext,
@@ -473,7 +771,8 @@ int UbusServer::UbusSetNetworkkeyHandler(struct ubus_context      *aContext,
                                          const char               *aMethod,
                                          struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkkey");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "networkkey");
 }
 
 int UbusServer::UbusThreadStartHandler(struct ubus_context      *aContext,
@@ -482,7 +781,7 @@ int UbusServer::UbusThreadStartHandler(struct ubus_context      *aContext,
                                        const char               *aMethod,
                                        struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusThreadHandler(aContext, aObj, aRequest, aMethod, aMsg, "start");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusThreadHandler, "start");
 }
 
 int UbusServer::UbusThreadStopHandler(struct ubus_context      *aContext,
@@ -491,7 +790,7 @@ int UbusServer::UbusThreadStopHandler(struct ubus_context      *aContext,
                                       const char               *aMethod,
                                       struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusThreadHandler(aContext, aObj, aRequest, aMethod, aMsg, "stop");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusThreadHandler, "stop");
 }
 
 int UbusServer::UbusParentHandler(struct ubus_context      *aContext,
@@ -500,7 +799,25 @@ int UbusServer::UbusParentHandler(struct ubus_context      *aContext,
                                   const char               *aMethod,
                                   struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusParentHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusParentHandlerDetail);
+}
+
+int UbusServer::UbusNeighborsHandler(struct ubus_context      *aContext,
+                                     struct ubus_object       *aObj,
+                                     struct ubus_request_data *aRequest,
+                                     const char               *aMethod,
+                                     struct blob_attr         *aMsg)
+{
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusNeighborsHandlerDetail);
+}
+
+int UbusServer::UbusStatusHandler(struct ubus_context      *aContext,
+                                  struct ubus_object       *aObj,
+                                  struct ubus_request_data *aRequest,
+                                  const char               *aMethod,
+                                  struct blob_attr         *aMsg)
+{
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusStatusHandlerDetail);
 }
 
 int UbusServer::UbusNeighborHandler(struct ubus_context      *aContext,
@@ -509,7 +826,7 @@ int UbusServer::UbusNeighborHandler(struct ubus_context      *aContext,
                                     const char               *aMethod,
                                     struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusNeighborHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusNeighborHandlerDetail);
 }
 
 int UbusServer::UbusModeHandler(struct ubus_context      *aContext,
@@ -518,7 +835,7 @@ int UbusServer::UbusModeHandler(struct ubus_context      *aContext,
                                 const char               *aMethod,
                                 struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "mode");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation, "mode");
 }
 
 int UbusServer::UbusSetModeHandler(struct ubus_context      *aContext,
@@ -527,7 +844,7 @@ int UbusServer::UbusSetModeHandler(struct ubus_context      *aContext,
                                    const char               *aMethod,
                                    struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "mode");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation, "mode");
 }
 
 int UbusServer::UbusPartitionIdHandler(struct ubus_context      *aContext,
@@ -536,7 +853,8 @@ int UbusServer::UbusPartitionIdHandler(struct ubus_context      *aContext,
                                        const char               *aMethod,
                                        struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "partitionid");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "partitionid");
 }
 
 int UbusServer::UbusLeaveHandler(struct ubus_context      *aContext,
@@ -545,7 +863,7 @@ int UbusServer::UbusLeaveHandler(struct ubus_context      *aContext,
                                  const char               *aMethod,
                                  struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusLeaveHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusLeaveHandlerDetail);
 }
 
 int UbusServer::UbusLeaderdataHandler(struct ubus_context      *aContext,
@@ -554,7 +872,8 @@ int UbusServer::UbusLeaderdataHandler(struct ubus_context      *aContext,
                                       const char               *aMethod,
                                       struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "leaderdata");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "leaderdata");
 }
 
 int UbusServer::UbusNetworkdataHandler(struct ubus_context      *aContext,
@@ -563,7 +882,8 @@ int UbusServer::UbusNetworkdataHandler(struct ubus_context      *aContext,
                                        const char               *aMethod,
                                        struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "networkdata");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "networkdata");
 }
 
 int UbusServer::UbusCommissionerStartHandler(struct ubus_context      *aContext,
@@ -572,7 +892,7 @@ int UbusServer::UbusCommissionerStartHandler(struct ubus_context      *aContext,
                                              const char               *aMethod,
                                              struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "start");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusCommissioner, "start");
 }
 
 int UbusServer::UbusJoinerRemoveHandler(struct ubus_context      *aContext,
@@ -581,7 +901,8 @@ int UbusServer::UbusJoinerRemoveHandler(struct ubus_context      *aContext,
                                         const char               *aMethod,
                                         struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joinerremove");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusCommissioner,
+                                      "joinerremove");
 }
 
 int UbusServer::UbusMgmtsetHandler(struct ubus_context      *aContext,
@@ -590,7 +911,7 @@ int UbusServer::UbusMgmtsetHandler(struct ubus_context      *aContext,
                                    const char               *aMethod,
                                    struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusMgmtset(aContext, aObj, aRequest, aMethod, aMsg);
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusMgmtset);
 }
 
 int UbusServer::UbusInterfaceNameHandler(struct ubus_context      *aContext,
@@ -599,7 +920,8 @@ int UbusServer::UbusInterfaceNameHandler(struct ubus_context      *aContext,
                                          const char               *aMethod,
                                          struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "interfacename");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "interfacename");
 }
 
 int UbusServer::UbusJoinerAddHandler(struct ubus_context      *aContext,
@@ -608,7 +930,28 @@ int UbusServer::UbusJoinerAddHandler(struct ubus_context      *aContext,
                                      const char               *aMethod,
                                      struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusCommissioner(aContext, aObj, aRequest, aMethod, aMsg, "joineradd");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusCommissioner,
+                                      "joineradd");
+}
+
+int UbusServer::UbusJoinerAddBatchHandler(struct ubus_context      *aContext,
+                                          struct ubus_object       *aObj,
+                                          struct ubus_request_data *aRequest,
+                                          const char               *aMethod,
+                                          struct blob_attr         *aMsg)
+{
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusCommissioner,
+                                      "joineraddbatch");
+}
+
+int UbusServer::UbusJoinerRemoveBatchHandler(struct ubus_context      *aContext,
+                                             struct ubus_object       *aObj,
+                                             struct ubus_request_data *aRequest,
+                                             const char               *aMethod,
+                                             struct blob_attr         *aMsg)
+{
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusCommissioner,
+                                      "joinerremovebatch");
 }
 
 int UbusServer::UbusMacfilterAddrHandler(struct ubus_context      *aContext,
@@ -617,7 +960,8 @@ int UbusServer::UbusMacfilterAddrHandler(struct ubus_context      *aContext,
                                          const char               *aMethod,
                                          struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilteraddr");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "macfilteraddr");
 }
 
 int UbusServer::UbusMacfilterStateHandler(struct ubus_context      *aContext,
@@ -626,7 +970,8 @@ int UbusServer::UbusMacfilterStateHandler(struct ubus_context      *aContext,
                                           const char               *aMethod,
                                           struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterstate");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusGetInformation,
+                                      "macfilterstate");
 }
 
 int UbusServer::UbusMacfilterAddHandler(struct ubus_context      *aContext,
@@ -635,7 +980,8 @@ int UbusServer::UbusMacfilterAddHandler(struct ubus_context      *aContext,
                                         const char               *aMethod,
                                         struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilteradd");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "macfilteradd");
 }
 
 int UbusServer::UbusMacfilterRemoveHandler(struct ubus_context      *aContext,
@@ -644,7 +990,8 @@ int UbusServer::UbusMacfilterRemoveHandler(struct ubus_context      *aContext,
                                            const char               *aMethod,
                                            struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterremove");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "macfilterremove");
 }
 
 int UbusServer::UbusMacfilterSetStateHandler(struct ubus_context      *aContext,
@@ -653,7 +1000,8 @@ int UbusServer::UbusMacfilterSetStateHandler(struct ubus_context      *aContext,
                                              const char               *aMethod,
                                              struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfiltersetstate");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "macfiltersetstate");
 }
 
 int UbusServer::UbusMacfilterClearHandler(struct ubus_context      *aContext,
@@ -662,7 +1010,8 @@ int UbusServer::UbusMacfilterClearHandler(struct ubus_context      *aContext,
                                           const char               *aMethod,
                                           struct blob_attr         *aMsg)
 {
-    return GetInstance().UbusSetInformation(aContext, aObj, aRequest, aMethod, aMsg, "macfilterclear");
+    return GetInstance().DeferRequest(aContext, aObj, aRequest, aMethod, aMsg, &UbusServer::UbusSetInformation,
+                                      "macfilterclear");
 }
 
 int UbusServer::UbusLeaveHandlerDetail(struct ubus_context      *aContext,
@@ -675,25 +1024,12 @@ int UbusServer::UbusLeaveHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    mHostMutex->lock();
     otInstanceFactoryReset(mHost->GetInstance());
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
-
     blob_buf_init(&mBuf, 0);
 
-exit:
-    mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -714,19 +1050,16 @@ int UbusServer::UbusThreadHandler(struct ubus_context      *aContext,
 
     if (!strcmp(aAction, "start"))
     {
-        mHostMutex->lock();
         SuccessOrExit(error = otIp6SetEnabled(mHost->GetInstance(), true));
         SuccessOrExit(error = otThreadSetEnabled(mHost->GetInstance(), true));
     }
     else if (!strcmp(aAction, "stop"))
     {
-        mHostMutex->lock();
         SuccessOrExit(error = otThreadSetEnabled(mHost->GetInstance(), false));
         SuccessOrExit(error = otIp6SetEnabled(mHost->GetInstance(), false));
     }
 
 exit:
-    mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -741,6 +1074,18 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
+    otError error;
+
+    blob_buf_init(&mBuf, 0);
+
+    error = AddParent();
+
+    AppendResult(error, aContext, aRequest);
+    return error;
+}
+
+otError UbusServer::AddParent(void)
+{
     otError      error = OT_ERROR_NONE;
     otRouterInfo parentInfo;
     char         extAddress[XPANID_LENGTH] = "";
@@ -748,9 +1093,6 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context      *aContext,
     void        *jsonList                  = nullptr;
     void        *jsonArray                 = nullptr;
 
-    blob_buf_init(&mBuf, 0);
-
-    mHostMutex->lock();
     SuccessOrExit(error = otThreadGetParentInfo(mHost->GetInstance(), &parentInfo));
 
     jsonArray = blobmsg_open_array(&mBuf, "parent_list");
@@ -772,8 +1114,6 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context      *aContext,
     blobmsg_close_array(&mBuf, jsonArray);
 
 exit:
-    mHostMutex->unlock();
-    AppendResult(error, aContext, aRequest);
     return error;
 }
 
@@ -787,7 +1127,18 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError                error = OT_ERROR_NONE;
+    otError error = OT_ERROR_NONE;
+
+    blob_buf_init(&mBuf, 0);
+
+    AddNeighborList();
+
+    AppendResult(error, aContext, aRequest);
+    return 0;
+}
+
+void UbusServer::AddNeighborList(void)
+{
     otNeighborInfo         neighborInfo;
     otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
     char                   transfer[XPANID_LENGTH]   = "";
@@ -795,11 +1146,8 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context      *aContext,
     char                   mode[5]                   = "";
     char                   extAddress[XPANID_LENGTH] = "";
 
-    blob_buf_init(&mBuf, 0);
-
     sJsonUri = blobmsg_open_array(&mBuf, "neighbor_list");
 
-    mHostMutex->lock();
     while (otThreadGetNextNeighborInfo(mHost->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
     {
         jsonList = blobmsg_open_table(&mBuf, nullptr);
@@ -846,10 +1194,95 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context      *aContext,
     }
 
     blobmsg_close_array(&mBuf, sJsonUri);
+}
 
-    mHostMutex->unlock();
+void UbusServer::AddChildList(void)
+{
+    otChildInfo childInfo;
+    uint16_t    maxChildren               = otThreadGetMaxAllowedChildren(mHost->GetInstance());
+    char        transfer[XPANID_LENGTH]   = "";
+    void       *jsonArray                 = nullptr;
+    void       *jsonList                  = nullptr;
+    char        mode[5]                   = "";
+    char        extAddress[XPANID_LENGTH] = "";
 
-    AppendResult(error, aContext, aRequest);
+    jsonArray = blobmsg_open_array(&mBuf, "child_list");
+
+    for (uint16_t i = 0; i < maxChildren; i++)
+    {
+        if (otThreadGetChildInfoByIndex(mHost->GetInstance(), i, &childInfo) != OT_ERROR_NONE ||
+            childInfo.mIsStateRestoring)
+        {
+            continue;
+        }
+
+        jsonList = blobmsg_open_table(&mBuf, nullptr);
+
+        sprintf(transfer, "0x%04x", childInfo.mRloc16);
+        blobmsg_add_string(&mBuf, "Rloc16", transfer);
+
+        blobmsg_add_u32(&mBuf, "Timeout", childInfo.mTimeout);
+        blobmsg_add_u32(&mBuf, "Age", childInfo.mAge);
+
+        sprintf(transfer, "%d", childInfo.mAverageRssi);
+        blobmsg_add_string(&mBuf, "AvgRssi", transfer);
+
+        if (childInfo.mRxOnWhenIdle)
+        {
+            strcat(mode, "r");
+        }
+
+        if (childInfo.mFullThreadDevice)
+        {
+            strcat(mode, "d");
+        }
+
+        if (childInfo.mFullNetworkData)
+        {
+            strcat(mode, "n");
+        }
+        blobmsg_add_string(&mBuf, "Mode", mode);
+
+        OutputBytes(childInfo.mExtAddress.m8, sizeof(childInfo.mExtAddress.m8), extAddress);
+        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+
+        blobmsg_add_u16(&mBuf, "LinkQualityIn", childInfo.mLinkQualityIn);
+
+        blobmsg_close_table(&mBuf, jsonList);
+
+        memset(mode, 0, sizeof(mode));
+        memset(extAddress, 0, sizeof(extAddress));
+    }
+
+    blobmsg_close_array(&mBuf, jsonArray);
+}
+
+int UbusServer::UbusNeighborsHandlerDetail(struct ubus_context      *aContext,
+                                           struct ubus_object       *aObj,
+                                           struct ubus_request_data *aRequest,
+                                           const char               *aMethod,
+                                           struct blob_attr         *aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+    char state[10];
+
+    blob_buf_init(&mBuf, 0);
+
+    GetState(mHost->GetInstance(), state);
+    blobmsg_add_string(&mBuf, "State", state);
+
+    if (otThreadGetDeviceRole(mHost->GetInstance()) == OT_DEVICE_ROLE_CHILD)
+    {
+        AddParent();
+    }
+
+    AddNeighborList();
+    AddChildList();
+
+    AppendResult(OT_ERROR_NONE, aContext, aRequest);
     return 0;
 }
 
@@ -944,8 +1377,6 @@ int UbusServer::UbusCommissioner(struct ubus_context      *aContext,
 
     otError error = OT_ERROR_NONE;
 
-    mHostMutex->lock();
-
     if (!strcmp(aAction, "start"))
     {
         if (otCommissionerGetState(mHost->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
@@ -1008,9 +1439,78 @@ int UbusServer::UbusCommissioner(struct ubus_context      *aContext,
 
         SuccessOrExit(error = otCommissionerRemoveJoiner(mHost->GetInstance(), addrPtr));
     }
+    else if (!strcmp(aAction, "joineraddbatch"))
+    {
+        struct blob_attr  *tb[JOINER_BATCH_MAX];
+        struct blob_attr  *cur;
+        int                rem;
+        agent::JoinerBatch batch;
+        uint16_t           numAdded;
+
+        blobmsg_parse(joinerBatchPolicy, JOINER_BATCH_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+        VerifyOrExit(tb[JOINERS] != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+        // The whole batch is parsed before the first joiner is added.
+        blobmsg_for_each_attr(cur, tb[JOINERS], rem)
+        {
+            struct blob_attr *joinerTb[ADD_JOINER_MAX];
+            otJoinerInfo      joiner;
+
+            VerifyOrExit(blobmsg_type(cur) == BLOBMSG_TYPE_TABLE, error = OT_ERROR_INVALID_ARGS);
+            blobmsg_parse(addJoinerPolicy, ADD_JOINER_MAX, joinerTb, blobmsg_data(cur), blobmsg_data_len(cur));
+            VerifyOrExit(joinerTb[PSKD] != nullptr, error = OT_ERROR_INVALID_ARGS);
+            VerifyOrExit(strlen(blobmsg_get_string(joinerTb[PSKD])) <= OT_JOINER_MAX_PSKD_LENGTH,
+                         error = OT_ERROR_INVALID_ARGS);
+
+            memset(&joiner, 0, sizeof(joiner));
+            joiner.mType           = OT_JOINER_INFO_TYPE_ANY;
+            joiner.mExpirationTime = kDefaultJoinerTimeout;
+            strncpy(joiner.mPskd.m8, blobmsg_get_string(joinerTb[PSKD]), OT_JOINER_MAX_PSKD_LENGTH);
+            if (joinerTb[EUI64] != nullptr && strcmp(blobmsg_get_string(joinerTb[EUI64]), "*") != 0)
+            {
+                VerifyOrExit(Hex2Bin(blobmsg_get_string(joinerTb[EUI64]), joiner.mSharedId.mEui64.m8,
+                                     sizeof(joiner.mSharedId.mEui64)) == sizeof(joiner.mSharedId.mEui64),
+                             error = OT_ERROR_PARSE);
+                joiner.mType = OT_JOINER_INFO_TYPE_EUI64;
+            }
+            SuccessOrExit(error = batch.AddJoiner(joiner));
+        }
+
+        SuccessOrExit(error = batch.AddToCommissioner(mHost->GetInstance(), numAdded));
+    }
+    else if (!strcmp(aAction, "joinerremovebatch"))
+    {
+        struct blob_attr  *tb[JOINER_BATCH_MAX];
+        struct blob_attr  *cur;
+        int                rem;
+        agent::JoinerBatch batch;
+        uint16_t           numRemoved;
+
+        blobmsg_parse(joinerBatchPolicy, JOINER_BATCH_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+        VerifyOrExit(tb[JOINERS] != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+        blobmsg_for_each_attr(cur, tb[JOINERS], rem)
+        {
+            otJoinerInfo joiner;
+
+            VerifyOrExit(blobmsg_type(cur) == BLOBMSG_TYPE_STRING, error = OT_ERROR_INVALID_ARGS);
+
+            memset(&joiner, 0, sizeof(joiner));
+            joiner.mType = OT_JOINER_INFO_TYPE_ANY;
+            if (strcmp(blobmsg_get_string(cur), "*") != 0)
+            {
+                VerifyOrExit(Hex2Bin(blobmsg_get_string(cur), joiner.mSharedId.mEui64.m8,
+                                     sizeof(joiner.mSharedId.mEui64)) == sizeof(joiner.mSharedId.mEui64),
+                             error = OT_ERROR_PARSE);
+                joiner.mType = OT_JOINER_INFO_TYPE_EUI64;
+            }
+            SuccessOrExit(error = batch.AddJoiner(joiner));
+        }
+
+        batch.RemoveFromCommissioner(mHost->GetInstance(), numRemoved);
+    }
 
 exit:
-    mHostMutex->unlock();
     blob_buf_init(&mBuf, 0);
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -1050,26 +1550,43 @@ void UbusServer::HandleJoinerEvent(otCommissionerJoinerEvent aEvent,
                                    const otExtAddress       *aJoinerId)
 {
     OT_UNUSED_VARIABLE(aJoinerInfo);
-    OT_UNUSED_VARIABLE(aJoinerId);
+
+    const char *event = "";
 
     switch (aEvent)
     {
     case OT_COMMISSIONER_JOINER_START:
         otbrLogInfo("Joiner start");
+        event = "start";
         break;
     case OT_COMMISSIONER_JOINER_CONNECTED:
         otbrLogInfo("Joiner connected");
+        event = "connected";
         break;
     case OT_COMMISSIONER_JOINER_FINALIZE:
         otbrLogInfo("Joiner finalize");
+        event = "finalize";
         break;
     case OT_COMMISSIONER_JOINER_END:
         otbrLogInfo("Joiner end");
+        event = "end";
         break;
     case OT_COMMISSIONER_JOINER_REMOVED:
         otbrLogInfo("Joiner remove");
+        event = "removed";
         break;
     }
+
+    blob_buf_init(&mNotificationBuf, 0);
+    blobmsg_add_string(&mNotificationBuf, "Event", event);
+    if (aJoinerId != nullptr)
+    {
+        char joinerId[XPANID_LENGTH] = "";
+
+        OutputBytes(aJoinerId->m8, sizeof(aJoinerId->m8), joinerId);
+        blobmsg_add_string(&mNotificationBuf, "JoinerId", joinerId);
+    }
+    Notify("joiner");
 }
 
 int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
@@ -1083,11 +1600,26 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError error = OT_ERROR_NONE;
-
     blob_buf_init(&mBuf, 0);
 
-    mHostMutex->lock();
+    if (!strcmp(aAction, "networkdata"))
+    {
+        // Replies the responses of the last query, and starts a new one if they are stale.
+        SendReply(aRequest, mNetworkdataBuf.head);
+        RefreshNetworkdata();
+    }
+    else
+    {
+        AppendResult(AddInformation(aAction), aContext, aRequest);
+    }
+
+    return 0;
+}
+
+otError UbusServer::AddInformation(const char *aAction)
+{
+    otError error = OT_ERROR_NONE;
+
     if (!strcmp(aAction, "networkname"))
         blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(mHost->GetInstance()));
     else if (!strcmp(aAction, "interfacename"))
@@ -1184,32 +1716,6 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
 
         blobmsg_close_table(&mBuf, sJsonUri);
     }
-    else if (!strcmp(aAction, "networkdata"))
-    {
-        ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
-        if (time(nullptr) - mSecond > 10)
-        {
-            static constexpr uint16_t kMaxTlvs = 35;
-
-            struct otIp6Address address;
-            uint8_t             tlvTypes[kMaxTlvs];
-            uint8_t             count             = 0;
-            char                multicastAddr[10] = "ff03::2";
-
-            blob_buf_init(&mNetworkdataBuf, 0);
-
-            SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
-
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
-
-            sBufNum = 0;
-            otThreadSendDiagnosticGet(mHost->GetInstance(), &address, tlvTypes, count,
-                                      &UbusServer::HandleDiagnosticGetResponse, this);
-            mSecond = time(nullptr);
-        }
-        goto exit;
-    }
     else if (!strcmp(aAction, "joinernum"))
     {
         void        *jsonTable = nullptr;
@@ -1219,8 +1725,6 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
         int          joinerNum       = 0;
         char         eui64[EXTPANID] = "";
 
-        blob_buf_init(&mBuf, 0);
-
         jsonArray = blobmsg_open_array(&mBuf, "joinerList");
         while (otCommissionerGetNextJoinerInfo(mHost->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
         {
@@ -1259,8 +1763,6 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
     {
         otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mHost->GetInstance());
 
-        blob_buf_init(&mBuf, 0);
-
         if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
         {
             blobmsg_add_string(&mBuf, "state", "disable");
@@ -1283,8 +1785,6 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
         otMacFilterEntry    entry;
         otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
 
-        blob_buf_init(&mBuf, 0);
-
         sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
 
         while (otLinkFilterGetNextAddress(mHost->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
@@ -1301,9 +1801,73 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
         perror("invalid argument in get information ubus\n");
     }
 
-    AppendResult(error, aContext, aRequest);
 exit:
-    mHostMutex->unlock();
+    return error;
+}
+
+void UbusServer::RefreshNetworkdata(void)
+{
+    static constexpr uint16_t kMaxTlvs = 35;
+
+    otError             error = OT_ERROR_NONE;
+    struct otIp6Address address;
+    uint8_t             tlvTypes[kMaxTlvs];
+    uint8_t             count             = 0;
+    char                multicastAddr[10] = "ff03::2";
+
+    VerifyOrExit(time(nullptr) - mSecond > 10);
+
+    blob_buf_init(&mNetworkdataBuf, 0);
+
+    SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+
+    tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
+    tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+
+    sBufNum = 0;
+    otThreadSendDiagnosticGet(mHost->GetInstance(), &address, tlvTypes, count, &UbusServer::HandleDiagnosticGetResponse,
+                              this);
+    mSecond = time(nullptr);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to query network diagnostics: %s", otThreadErrorToString(error));
+    }
+}
+
+int UbusServer::UbusStatusHandlerDetail(struct ubus_context      *aContext,
+                                        struct ubus_object       *aObj,
+                                        struct ubus_request_data *aRequest,
+                                        const char               *aMethod,
+                                        struct blob_attr         *aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+    // The same fields as the single getters, so that the pages only need one round-trip.
+    static const char *const kStatusActions[] = {
+        "state", "networkname", "interfacename", "channel", "panid", "extpanid", "rloc16", "partitionid", "mode",
+        "leaderdata", "joinernum",
+    };
+
+    void *jsonTable = nullptr;
+
+    blob_buf_init(&mBuf, 0);
+
+    for (const char *action : kStatusActions)
+    {
+        // Some fields such as the leader data are not available when detached, the others are still reported.
+        AddInformation(action);
+    }
+
+    jsonTable = blobmsg_open_table(&mBuf, "networkdata");
+    blob_put_raw(&mBuf, blob_data(mNetworkdataBuf.head), blob_len(mNetworkdataBuf.head));
+    blobmsg_close_table(&mBuf, jsonTable);
+    RefreshNetworkdata();
+
+    AppendResult(OT_ERROR_NONE, aContext, aRequest);
     return 0;
 }
 
@@ -1439,7 +2003,6 @@ int UbusServer::UbusSetInformation(struct ubus_context      *aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    mHostMutex->lock();
     if (!strcmp(aAction, "networkname"))
     {
         struct blob_attr *tb[SET_NETWORK_MAX];
@@ -1613,7 +2176,6 @@ int UbusServer::UbusSetInformation(struct ubus_context      *aContext,
     }
 
 exit:
-    mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -1710,6 +2272,12 @@ int UbusServer::DisplayUbusInit(const char *aPath)
     /* file description */
     UbusAddFd();
 
+    if (mReplyEvent.fd == -1 || uloop_fd_add(&mReplyEvent, ULOOP_READ) != 0)
+    {
+        otbrLogErr("Ubus reply event add failed");
+        return -1;
+    }
+
     /* Add a object */
     if (ubus_add_object(mContext, &otbr) != 0)
     {
@@ -1807,57 +2375,10 @@ exit:
 
 void UBusAgent::Init(void)
 {
-    otbr::ubus::sUbusEfd = eventfd(0, 0);
-
-    otbr::ubus::UbusServer::Initialize(&mHost, &mThreadMutex);
-
-    if (otbr::ubus::sUbusEfd == -1)
-    {
-        perror("Failed to create eventfd for ubus");
-        exit(EXIT_FAILURE);
-    }
+    otbr::ubus::UbusServer::Initialize(&mHost, &mTaskRunner);
 
     std::thread(UbusServerRun).detach();
 }
 
-void UBusAgent::Update(MainloopContext &aMainloop)
-{
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    FD_SET(otbr::ubus::sUbusEfd, &aMainloop.mReadFdSet);
-
-    if (aMainloop.mMaxFd < otbr::ubus::sUbusEfd)
-    {
-        aMainloop.mMaxFd = otbr::ubus::sUbusEfd;
-    }
-
-exit:
-    mThreadMutex.unlock();
-    return;
-}
-
-void UBusAgent::Process(const MainloopContext &aMainloop)
-{
-    ssize_t  retval;
-    uint64_t num;
-
-    mThreadMutex.lock();
-
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    if (FD_ISSET(otbr::ubus::sUbusEfd, &aMainloop.mReadFdSet))
-    {
-        retval = read(otbr::ubus::sUbusEfd, &num, sizeof(uint64_t));
-        if (retval != sizeof(uint64_t))
-        {
-            perror("read ubus eventfd failed\n");
-            exit(EXIT_FAILURE);
-        }
-    }
-
-exit:
-    return;
-}
-
 } // namespace ubus
 } // namespace otbr
@@ -36,6 +36,9 @@
 
 #include "openthread-br/config.h"
 
+#include <mutex>
+#include <vector>
+
 #include <stdarg.h>
 #include <time.h>
 
@@ -46,6 +49,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "ncp/rcp_host.hpp"
 
 extern "C" {
@@ -77,10 +81,13 @@ public:
     /**
      * Constructor
      *
-     * @param[in] aHost  A pointer to OpenThread Controller structure.
-     * @param[in] aMutex       A pointer to mutex.
+     * The ubus requests are handled on the ubus thread by deferring them, the OpenThread APIs are only called in
+     * tasks posted to @p aTaskRunner, and the replies are sent back on the ubus thread.
+     *
+     * @param[in] aHost        A pointer to OpenThread Controller structure.
+     * @param[in] aTaskRunner  A pointer to the task runner of the mainloop.
      */
-    static void Initialize(Ncp::RcpHost *aHost, std::mutex *aMutex);
+    static void Initialize(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner);
 
     /**
      * This method return the instance of the global UbusServer.
@@ -690,6 +697,42 @@ public:
                                     const char               *aMethod,
                                     struct blob_attr         *aMsg);
 
+    /**
+     * This method handle ubus add joiners function request, which adds an array of joiners at once.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     *
+     */
+    static int UbusJoinerAddBatchHandler(struct ubus_context      *aContext,
+                                         struct ubus_object       *aObj,
+                                         struct ubus_request_data *aRequest,
+                                         const char               *aMethod,
+                                         struct blob_attr         *aMsg);
+
+    /**
+     * This method handle ubus remove joiners function request, which removes an array of joiners at once.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     *
+     */
+    static int UbusJoinerRemoveBatchHandler(struct ubus_context      *aContext,
+                                            struct ubus_object       *aObj,
+                                            struct ubus_request_data *aRequest,
+                                            const char               *aMethod,
+                                            struct blob_attr         *aMsg);
+
     /**
      * This method handle ubus remove joiner function request.
      *
@@ -762,6 +805,47 @@ public:
                                         const char               *aMethod,
                                         struct blob_attr         *aMsg);
 
+    /**
+     * This method handle ubus status function request.
+     *
+     * The reply contains the fields of the single getters (state, network name, channel, PAN ID, leader data, ...)
+     * and the latest network diagnostics, read at once.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     *
+     */
+    static int UbusStatusHandler(struct ubus_context      *aContext,
+                                 struct ubus_object       *aObj,
+                                 struct ubus_request_data *aRequest,
+                                 const char               *aMethod,
+                                 struct blob_attr         *aMsg);
+
+    /**
+     * This method handle ubus neighbors function request.
+     *
+     * The reply contains the state, the parent when attached as a child, the neighbor table and the child table.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     *
+     */
+    static int UbusNeighborsHandler(struct ubus_context      *aContext,
+                                    struct ubus_object       *aObj,
+                                    struct ubus_request_data *aRequest,
+                                    const char               *aMethod,
+                                    struct blob_attr         *aMsg);
+
     /**
      * This method handle initial diagnostic get response.
      *
@@ -787,14 +871,68 @@ public:
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
 private:
-    bool                 mIfFinishScan;
-    struct ubus_context *mContext;
-    const char          *mSockPath;
-    struct blob_buf      mBuf;
-    struct blob_buf      mNetworkdataBuf;
-    Ncp::RcpHost        *mHost;
-    std::mutex          *mHostMutex;
-    time_t               mSecond;
+    typedef int (UbusServer::*RequestHandler)(struct ubus_context      *aContext,
+                                              struct ubus_object       *aObj,
+                                              struct ubus_request_data *aRequest,
+                                              const char               *aMethod,
+                                              struct blob_attr         *aMsg);
+    typedef int (UbusServer::*ActionHandler)(struct ubus_context      *aContext,
+                                             struct ubus_object       *aObj,
+                                             struct ubus_request_data *aRequest,
+                                             const char               *aMethod,
+                                             struct blob_attr         *aMsg,
+                                             const char               *aAction);
+
+    /**
+     * This structure represents a ubus request deferred to the mainloop.
+     *
+     */
+    struct DeferredRequest : public ubus_request_data
+    {
+        struct ubus_context *mContext;
+        struct ubus_object  *mObject;
+        const char          *mMethod;
+        const char          *mAction;
+        struct blob_attr    *mMsg;
+        struct blob_attr    *mReply;
+        RequestHandler       mHandler;
+        ActionHandler        mActionHandler;
+    };
+
+    /**
+     * This structure represents a partial reply to a deferred request, which is sent before its final reply.
+     *
+     */
+    struct PartialReply
+    {
+        DeferredRequest  *mRequest;
+        struct blob_attr *mReply;
+    };
+
+    /**
+     * This structure represents a notification built on the mainloop, which is sent on the ubus thread.
+     *
+     */
+    struct Notification
+    {
+        const char       *mType;
+        struct blob_attr *mMsg;
+    };
+
+    struct ubus_context           *mContext;
+    const char                    *mSockPath;
+    struct blob_buf                mBuf;
+    struct blob_buf                mNetworkdataBuf;
+    struct blob_buf                mNotificationBuf;
+    Ncp::RcpHost                  *mHost;
+    TaskRunner                    *mTaskRunner;
+    time_t                         mSecond;
+    struct blob_buf                mScanBuf;
+    struct uloop_fd                mReplyEvent;
+    std::mutex                     mReplyMutex;
+    std::vector<PartialReply>      mPartialReplies;
+    std::vector<DeferredRequest *> mReplies;
+    std::vector<Notification>      mNotifications;
     enum
     {
         kDefaultJoinerTimeout = 120,
@@ -803,16 +941,160 @@ private:
     /**
      * Constructor
      *
-     * @param[in] aHost    The pointer to OpenThread Controller structure.
-     * @param[in] aMutex   A pointer to mutex.
+     * @param[in] aHost        The pointer to OpenThread Controller structure.
+     * @param[in] aTaskRunner  A pointer to the task runner of the mainloop.
+     */
+    UbusServer(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner);
+
+    /**
+     * This method defers a ubus request to be handled on the mainloop.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     * @param[in] aHandler  The handler to run on the mainloop.
+     *
+     * @retval UBUS_STATUS_OK  Successfully deferred the request.
+     *
+     */
+    int DeferRequest(struct ubus_context      *aContext,
+                     struct ubus_object       *aObj,
+                     struct ubus_request_data *aRequest,
+                     const char               *aMethod,
+                     struct blob_attr         *aMsg,
+                     RequestHandler            aHandler);
+
+    /**
+     * This method defers a ubus request to be handled on the mainloop.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     * @param[in] aHandler  The handler to run on the mainloop.
+     * @param[in] aAction   A pointer to the action passed to @p aHandler, must be static.
+     *
+     * @retval UBUS_STATUS_OK  Successfully deferred the request.
+     *
      */
-    UbusServer(Ncp::RcpHost *aHost, std::mutex *aMutex);
+    int DeferRequest(struct ubus_context      *aContext,
+                     struct ubus_object       *aObj,
+                     struct ubus_request_data *aRequest,
+                     const char               *aMethod,
+                     struct blob_attr         *aMsg,
+                     ActionHandler             aHandler,
+                     const char               *aAction);
 
     /**
-     * This method start scan.
+     * This method defers a ubus request and posts its handling to the mainloop.
+     *
+     * @param[in] aContext   A pointer to the ubus context.
+     * @param[in] aObj       A pointer to the ubus object.
+     * @param[in] aRequest   A pointer to the ubus request.
+     * @param[in] aMethod    A pointer to the ubus method.
+     * @param[in] aMsg       A pointer to the ubus message.
+     * @param[in] aDeferred  A pointer to the deferred request with its handler set.
+     *
+     * @retval UBUS_STATUS_OK  Successfully deferred the request.
      *
      */
-    void ProcessScan(void);
+    int DeferRequest(struct ubus_context      *aContext,
+                     struct ubus_object       *aObj,
+                     struct ubus_request_data *aRequest,
+                     const char               *aMethod,
+                     struct blob_attr         *aMsg,
+                     DeferredRequest          *aDeferred);
+
+    /**
+     * This method handles a deferred request on the mainloop.
+     *
+     * @param[in] aRequest  A reference to the deferred request.
+     *
+     */
+    void ProcessDeferredRequest(DeferredRequest &aRequest);
+
+    /**
+     * This method sends the reply of a deferred request from the mainloop.
+     *
+     * The reply is copied and sent on the ubus thread, which completes the request.
+     *
+     * @param[in] aRequest  A pointer to the deferred request.
+     * @param[in] aReply    A pointer to the reply message.
+     *
+     */
+    void SendReply(struct ubus_request_data *aRequest, struct blob_attr *aReply);
+
+    /**
+     * This method sends a partial reply to a deferred request, the request is kept until its final reply.
+     *
+     * @param[in] aRequest  A pointer to the deferred request.
+     * @param[in] aReply    A pointer to the partial reply message.
+     *
+     */
+    void SendPartialReply(struct ubus_request_data *aRequest, struct blob_attr *aReply);
+
+    /**
+     * This method wakes up the ubus thread to send the queued replies and notifications.
+     *
+     */
+    void WakeUpUbusThread(void);
+
+    /**
+     * This method queues the notification built in the notification buffer, to be sent on the ubus thread.
+     *
+     * The notification is sent to the subscribers of the `otbr` object, and as the `otbr.<type>` event.
+     *
+     * @param[in] aType  The type of the notification, must be static.
+     *
+     */
+    void Notify(const char *aType);
+
+    /**
+     * This method sends the queued notifications, called on the ubus thread.
+     *
+     * @param[in] aNotifications  The notifications to send, which are freed.
+     *
+     */
+    void SendNotifications(std::vector<Notification> &aNotifications);
+
+    /**
+     * This method notifies the changes of the Thread state.
+     *
+     * @param[in] aFlags  The flags of the changed states.
+     *
+     */
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+
+    /**
+     * This method notifies the changes of the neighbor table.
+     *
+     * @param[in] aChanges     The changes of the neighbor table.
+     * @param[in] aGeneration  The generation of the neighbor table after the changes.
+     *
+     */
+    void HandleNeighborTableChanged(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                    uint32_t                                                aGeneration);
+
+    /**
+     * This method handles the replies sent from the mainloop (callback function).
+     *
+     * @param[in] aFd      A pointer to the reply event.
+     * @param[in] aEvents  The events of the reply event.
+     *
+     */
+    static void HandleReplyEvent(struct uloop_fd *aFd, unsigned int aEvents);
+
+    /**
+     * This method detailly sends the replies sent from the mainloop, called by HandleReplyEvent.
+     *
+     * @param[in] aFd      A pointer to the reply event.
+     * @param[in] aEvents  The events of the reply event.
+     *
+     */
+    void HandleReplyEventDetail(struct uloop_fd *aFd, unsigned int aEvents);
 
     /**
      * This method detailly start scan.
@@ -833,21 +1115,34 @@ private:
                               struct blob_attr         *aMsg);
 
     /**
-     * This method handle scan result (callback function).
+     * This method adds the fields of a scan result to a message.
      *
-     * @param[in] aResult   A pointer to result.
-     * @param[in] aContext  A pointer to context.
+     * @param[in] aBuf     The buffer of the message.
+     * @param[in] aResult  The scan result.
      *
      */
-    static void HandleActiveScanResult(otActiveScanResult *aResult, void *aContext);
+    void AddScanResult(struct blob_buf &aBuf, const otActiveScanResult &aResult);
 
     /**
-     * This method detailly handler the scan result, called by HandleActiveScanResult.
+     * This method streams a scan result to a scan request in a partial reply.
      *
-     * @param[in] aResult  A pointer to result.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aResult   The scan result.
+     *
+     */
+    void HandleScanResult(struct ubus_request_data *aRequest, const otActiveScanResult &aResult);
+
+    /**
+     * This method replies to a scan request when the scan is done.
+     *
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aError    The error of the scan.
+     * @param[in] aResults  The scan results.
      *
      */
-    void HandleActiveScanResultDetail(otActiveScanResult *aResult);
+    void HandleScanDone(struct ubus_request_data              *aRequest,
+                        otError                                aError,
+                        const std::vector<otActiveScanResult> &aResults);
 
     /**
      * This method detailly handler get neighbor information.
@@ -885,6 +1180,62 @@ private:
                                 const char               *aMethod,
                                 struct blob_attr         *aMsg);
 
+    /**
+     * This method detailly handler get status.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     *
+     */
+    int UbusStatusHandlerDetail(struct ubus_context      *aContext,
+                                struct ubus_object       *aObj,
+                                struct ubus_request_data *aRequest,
+                                const char               *aMethod,
+                                struct blob_attr         *aMsg);
+
+    /**
+     * This method detailly handler get neighbors and children.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     *
+     */
+    int UbusNeighborsHandlerDetail(struct ubus_context      *aContext,
+                                   struct ubus_object       *aObj,
+                                   struct ubus_request_data *aRequest,
+                                   const char               *aMethod,
+                                   struct blob_attr         *aMsg);
+
+    /**
+     * This method appends the parent information to the reply.
+     *
+     * @returns The error of getting the parent information.
+     *
+     */
+    otError AddParent(void);
+
+    /**
+     * This method appends the neighbor table to the reply.
+     *
+     */
+    void AddNeighborList(void);
+
+    /**
+     * This method appends the child table to the reply.
+     *
+     */
+    void AddChildList(void);
+
     /**
      * This method handle mgmtset request.
      *
@@ -961,6 +1312,22 @@ private:
                            struct blob_attr         *aMsg,
                            const char               *action);
 
+    /**
+     * This method appends the information of a get information request to the reply.
+     *
+     * @param[in] aAction  A pointer to the action needed.
+     *
+     * @returns The error of getting the information.
+     *
+     */
+    otError AddInformation(const char *aAction);
+
+    /**
+     * This method starts a new network diagnostic query if the last responses are stale.
+     *
+     */
+    void RefreshNetworkdata(void);
+
     /**
      * This method handle set information request.
      *
@@ -1143,7 +1510,7 @@ private:
     void AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest);
 };
 
-class UBusAgent : public MainloopProcessor
+class UBusAgent
 {
 public:
     /**
@@ -1154,7 +1521,6 @@ public:
      */
     UBusAgent(otbr::Ncp::RcpHost &aHost)
         : mHost(aHost)
-        , mThreadMutex()
     {
     }
 
@@ -1164,14 +1530,11 @@ public:
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
 private:
     static void UbusServerRun(void) { otbr::ubus::UbusServer::GetInstance().InstallUbusObject(); }
 
     otbr::Ncp::RcpHost &mHost;
-    std::mutex          mThreadMutex;
+    TaskRunner          mTaskRunner;
 };
 } // namespace ubus
 } // namespace otbr
@@ -0,0 +1,501 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "REST"
+
+#include "rest/acceptor_pool.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "common/logging.hpp"
+#include "rest/connection.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+// Maximum number of connections served by each acceptor thread at the same time
+static const size_t kMaxClientsPerAcceptor = 64;
+
+// The timeout (in milliseconds) since a connection waits for the rest of a request, it is then handed over to the
+// mainloop which answers it
+static const int kReadTimeout = 1000;
+
+// The timeout (in milliseconds) since a connection waits for a response to be written
+static const int kWriteTimeout = 10000;
+
+// Maximum length of the received data not answered yet, a larger request is handed over to the mainloop
+static const size_t kMaxReadLength = 65536;
+
+static void ConsumeWriteBuffers(std::vector<struct iovec> &aBuffers, size_t &aIndex, size_t aLength)
+{
+    // Skip the fully written buffers and move the start of the partly written one, as `Connection` does.
+    while (aIndex < aBuffers.size() && aLength >= aBuffers[aIndex].iov_len)
+    {
+        aLength -= aBuffers[aIndex].iov_len;
+        aIndex++;
+    }
+
+    if (aIndex < aBuffers.size())
+    {
+        aBuffers[aIndex].iov_base = static_cast<char *>(aBuffers[aIndex].iov_base) + aLength;
+        aBuffers[aIndex].iov_len -= aLength;
+    }
+}
+
+AcceptorPool::Client::Client(int aFd, const std::string &aSource)
+    : mFd(aFd)
+    , mSource(aSource)
+    , mParsedLength(0)
+    , mParser(&mRequest)
+    , mWriteIndex(0)
+    , mTimeStamp(steady_clock::now())
+    , mRequestCount(0)
+    , mKeepAlive(false)
+    , mIdle(false)
+    , mWriting(false)
+{
+    mParser.Init();
+    mRequest.SetReadBuffer(&mReadContent);
+}
+
+AcceptorPool::AcceptorPool(ServeHandler aServeHandler, HandOverHandler aHandOverHandler)
+    : mServeHandler(std::move(aServeHandler))
+    , mHandOverHandler(std::move(aHandOverHandler))
+    , mStopFds{-1, -1}
+    , mServedCount(0)
+    , mHandedOverCount(0)
+{
+}
+
+AcceptorPool::~AcceptorPool(void)
+{
+    Stop();
+}
+
+otbrError AcceptorPool::Start(const std::vector<int> &aListenFds)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mStopFds[kRead] == -1, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(pipe(mStopFds) == 0, error = OTBR_ERROR_ERRNO);
+
+    mListenFds = aListenFds;
+    for (int listenFd : mListenFds)
+    {
+        mThreads.emplace_back(&AcceptorPool::RunAcceptor, this, listenFd);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        int savedErrno = errno;
+
+        for (int listenFd : aListenFds)
+        {
+            close(listenFd);
+        }
+        errno = savedErrno;
+    }
+
+    return error;
+}
+
+void AcceptorPool::Stop(void)
+{
+    const uint8_t kStopByte = 1;
+
+    VerifyOrExit(mStopFds[kRead] != -1);
+
+    // The pipe is never drained, so that every acceptor thread sees it readable.
+    if (write(mStopFds[kWrite], &kStopByte, sizeof(kStopByte)) != sizeof(kStopByte))
+    {
+        otbrLogWarning("Failed to stop the acceptor threads: %s", strerror(errno));
+    }
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    for (int listenFd : mListenFds)
+    {
+        close(listenFd);
+    }
+    mListenFds.clear();
+
+    close(mStopFds[kRead]);
+    close(mStopFds[kWrite]);
+    mStopFds[kRead]  = -1;
+    mStopFds[kWrite] = -1;
+
+exit:
+    return;
+}
+
+void AcceptorPool::RunAcceptor(int aListenFd)
+{
+    ClientList clients;
+    sigset_t   signals;
+
+    // The signals are handled by the mainloop, so that they interrupt its wait.
+    sigfillset(&signals);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    while (true)
+    {
+        std::vector<struct pollfd> fds;
+        steady_clock::time_point   now     = steady_clock::now();
+        int                        timeout = -1;
+        int                        rval;
+        size_t                     numClients;
+
+        fds.push_back({mStopFds[kRead], POLLIN, 0});
+        fds.push_back({aListenFd, static_cast<short>(clients.size() < kMaxClientsPerAcceptor ? POLLIN : 0), 0});
+
+        for (const std::unique_ptr<Client> &client : clients)
+        {
+            int clientTimeout = GetPollTimeout(*client, now);
+
+            fds.push_back({client->mFd, static_cast<short>(client->mWriting ? POLLOUT : POLLIN), 0});
+            timeout = (timeout < 0) ? clientTimeout : std::min(timeout, clientTimeout);
+        }
+
+        rval = poll(fds.data(), fds.size(), timeout);
+        if (rval < 0)
+        {
+            if (errno != EINTR)
+            {
+                otbrLogWarning("The acceptor thread poll failed: %s", strerror(errno));
+            }
+            continue;
+        }
+
+        VerifyOrExit((fds[0].revents & POLLIN) == 0);
+
+        numClients = clients.size();
+        for (size_t i = 0; i < numClients; i++)
+        {
+            Process(*clients[i], fds[i + 2].revents);
+        }
+
+        clients.erase(std::remove_if(clients.begin(), clients.end(),
+                                     [](const std::unique_ptr<Client> &aClient) { return aClient->mFd == -1; }),
+                      clients.end());
+
+        if (fds[1].revents & POLLIN)
+        {
+            Accept(aListenFd, clients);
+        }
+    }
+
+exit:
+    for (std::unique_ptr<Client> &client : clients)
+    {
+        Close(*client);
+    }
+}
+
+void AcceptorPool::Accept(int aListenFd, ClientList &aClients)
+{
+    while (aClients.size() < kMaxClientsPerAcceptor)
+    {
+        char             source[INET6_ADDRSTRLEN] = "";
+        sockaddr_storage peerAddress;
+        socklen_t        addrlen = sizeof(peerAddress);
+        int              fd;
+
+        fd = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&peerAddress), &addrlen);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                otbrLogWarning("Acceptor thread failed to accept: %s", strerror(errno));
+            }
+            break;
+        }
+
+        if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0)
+        {
+            otbrLogWarning("Acceptor thread failed to set nonblock: %s", strerror(errno));
+            close(fd);
+            continue;
+        }
+
+        // The requests are admitted by the address of the peer, as on the mainloop.
+        if (peerAddress.ss_family == AF_INET6)
+        {
+            inet_ntop(AF_INET6, &reinterpret_cast<sockaddr_in6 *>(&peerAddress)->sin6_addr, source, sizeof(source));
+        }
+
+        aClients.emplace_back(new Client(fd, source));
+    }
+}
+
+int AcceptorPool::GetPollTimeout(const Client &aClient, steady_clock::time_point aNow)
+{
+    int64_t timeout;
+    int64_t elapsed = duration_cast<milliseconds>(aNow - aClient.mTimeStamp).count();
+
+    if (aClient.mWriting)
+    {
+        timeout = kWriteTimeout;
+    }
+    else if (aClient.mIdle)
+    {
+        timeout = Connection::GetKeepAliveTimeout() * 1000;
+    }
+    else
+    {
+        timeout = kReadTimeout;
+    }
+
+    return static_cast<int>(std::max<int64_t>(timeout - elapsed, 0));
+}
+
+void AcceptorPool::Process(Client &aClient, short aEvents)
+{
+    bool ready   = (aEvents & (POLLERR | POLLHUP)) != 0;
+    bool expired = GetPollTimeout(aClient, steady_clock::now()) == 0;
+
+    if (aClient.mWriting)
+    {
+        if (ready || (aEvents & POLLOUT))
+        {
+            Write(aClient);
+            HandleRequests(aClient);
+        }
+        else if (expired)
+        {
+            Close(aClient);
+        }
+    }
+    else if (ready || (aEvents & POLLIN))
+    {
+        Read(aClient);
+    }
+    else if (expired)
+    {
+        // A kept alive connection is silently closed, the mainloop answers a request not received in time.
+        if (aClient.mIdle)
+        {
+            Close(aClient);
+        }
+        else
+        {
+            HandOver(aClient);
+        }
+    }
+}
+
+void AcceptorPool::Read(Client &aClient)
+{
+    char    buf[2048];
+    ssize_t received;
+    int     err = 0;
+
+    do
+    {
+        received = read(aClient.mFd, buf, sizeof(buf));
+        err      = errno;
+        if (received > 0)
+        {
+            if (aClient.mIdle)
+            {
+                // The read timeout applies from the first byte of the next request.
+                aClient.mIdle      = false;
+                aClient.mTimeStamp = steady_clock::now();
+            }
+            aClient.mReadContent.append(buf, static_cast<size_t>(received));
+        }
+    } while ((received > 0 && aClient.mReadContent.size() < kMaxReadLength) || (received < 0 && err == EINTR));
+
+    if (received == 0)
+    {
+        // The client closed its side, the mainloop answers the requests received before.
+        VerifyOrExit(aClient.mParsedLength < aClient.mReadContent.size(), Close(aClient));
+        ExitNow(HandOver(aClient));
+    }
+
+    VerifyOrExit(received > 0 || err == EAGAIN || err == EWOULDBLOCK, Close(aClient));
+
+    HandleRequests(aClient);
+
+exit:
+    return;
+}
+
+void AcceptorPool::HandleRequests(Client &aClient)
+{
+    // The pipelined requests are answered in order, until one of them is handed over or waits for its response to
+    // be written.
+    while (aClient.mFd != -1 && !aClient.mWriting && aClient.mParsedLength < aClient.mReadContent.size())
+    {
+        size_t parsedLength;
+
+        aClient.mIdle = false;
+
+        // The mainloop answers a malformed request.
+        VerifyOrExit(aClient.mParser.Process(aClient.mReadContent.data() + aClient.mParsedLength,
+                                             aClient.mReadContent.size() - aClient.mParsedLength,
+                                             parsedLength) == OTBR_ERROR_NONE,
+                     HandOver(aClient));
+        aClient.mParsedLength += parsedLength;
+
+        if (!aClient.mRequest.IsComplete())
+        {
+            VerifyOrExit(aClient.mReadContent.size() < kMaxReadLength, HandOver(aClient));
+            ExitNow();
+        }
+
+        Serve(aClient);
+    }
+
+exit:
+    return;
+}
+
+void AcceptorPool::Serve(Client &aClient)
+{
+    VerifyOrExit(mServeHandler(aClient.mSource, aClient.mRequest, aClient.mResponse), HandOver(aClient));
+
+    aClient.mRequestCount++;
+    aClient.mKeepAlive = Connection::IsKeptAlive(aClient.mRequest, aClient.mRequestCount);
+
+    if (!aClient.mKeepAlive)
+    {
+        // No other request is read from the connection after the last one.
+        VerifyOrExit(shutdown(aClient.mFd, SHUT_RD) == 0, Close(aClient));
+    }
+
+    Connection::PrepareResponse(aClient.mRequest, aClient.mKeepAlive, aClient.mRequestCount, aClient.mResponse);
+    aClient.mResponse.Serialize(aClient.mWriteBuffers);
+    aClient.mWriteIndex = 0;
+    aClient.mWriting    = true;
+    aClient.mTimeStamp  = steady_clock::now();
+    mServedCount++;
+
+    Write(aClient);
+
+exit:
+    return;
+}
+
+void AcceptorPool::Write(Client &aClient)
+{
+    ssize_t sendLength;
+    int     err;
+
+    do
+    {
+        struct msghdr message;
+
+        memset(&message, 0, sizeof(message));
+        message.msg_iov    = &aClient.mWriteBuffers[aClient.mWriteIndex];
+        message.msg_iovlen = std::min<size_t>(aClient.mWriteBuffers.size() - aClient.mWriteIndex, IOV_MAX);
+
+        sendLength = sendmsg(aClient.mFd, &message, MSG_NOSIGNAL);
+        err        = errno;
+
+        if (sendLength > 0)
+        {
+            ConsumeWriteBuffers(aClient.mWriteBuffers, aClient.mWriteIndex, static_cast<size_t>(sendLength));
+        }
+    } while ((sendLength > 0 && aClient.mWriteIndex < aClient.mWriteBuffers.size()) ||
+             (sendLength < 0 && err == EINTR));
+
+    if (aClient.mWriteIndex == aClient.mWriteBuffers.size())
+    {
+        CompleteResponse(aClient);
+    }
+    else if (sendLength >= 0 || (err != EAGAIN && err != EWOULDBLOCK))
+    {
+        Close(aClient);
+    }
+}
+
+void AcceptorPool::CompleteResponse(Client &aClient)
+{
+    VerifyOrExit(aClient.mKeepAlive, Close(aClient));
+
+    // The data of the answered request is only released now, as the request refers to it.
+    aClient.mReadContent.erase(0, aClient.mParsedLength);
+    aClient.mParsedLength = 0;
+    aClient.mRequest      = Request();
+    aClient.mResponse     = Response();
+    aClient.mRequest.SetReadBuffer(&aClient.mReadContent);
+    aClient.mWriteBuffers.clear();
+    aClient.mWriteIndex = 0;
+    aClient.mWriting    = false;
+    aClient.mIdle       = true;
+    aClient.mTimeStamp  = steady_clock::now();
+
+exit:
+    return;
+}
+
+void AcceptorPool::HandOver(Client &aClient)
+{
+    int         fd       = aClient.mFd;
+    std::string source   = aClient.mSource;
+    std::string received = aClient.mReadContent;
+
+    // The answered requests are already released from the received data, the mainloop parses it from the start. The
+    // task runner is destroyed with the pool, so the connection is left open if the pool goes first.
+    aClient.mFd = -1;
+    mHandedOverCount++;
+    mTaskRunner.Post([this, fd, source, received]() { mHandOverHandler(fd, source, received); });
+}
+
+void AcceptorPool::Close(Client &aClient)
+{
+    if (aClient.mFd != -1)
+    {
+        close(aClient.mFd);
+        aClient.mFd = -1;
+    }
+}
+
+} // namespace rest
+} // namespace otbr
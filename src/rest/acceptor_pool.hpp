@@ -0,0 +1,216 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definition of the acceptor threads of the REST server.
+ */
+
+#ifndef OTBR_REST_ACCEPTOR_POOL_HPP_
+#define OTBR_REST_ACCEPTOR_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+#include "rest/response.hpp"
+
+/**
+ * The number of threads accepting the TCP connections of the REST server besides the mainloop, zero accepts them on
+ * the mainloop only.
+ *
+ * Each thread listens on its own socket bound to the REST listen address with `SO_REUSEPORT`, and serves the GETs
+ * answered from the snapshots of the resources.
+ *
+ */
+#ifndef OTBR_REST_ACCEPTOR_THREADS
+#define OTBR_REST_ACCEPTOR_THREADS 0
+#endif
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a pool of threads accepting the connections of the REST server, which serve the read-only
+ * requests answered without the OpenThread instance and hand the others over to the mainloop.
+ *
+ */
+class AcceptorPool : private NonCopyable
+{
+public:
+    /**
+     * This type represents the handler serving a request on an acceptor thread.
+     *
+     * The handler is invoked on the acceptor threads, concurrently with the mainloop, so it must not access the
+     * OpenThread instance.
+     *
+     * @param[in]  aSource    The source address of the connection.
+     * @param[in]  aRequest   The complete request.
+     * @param[out] aResponse  The response to send if the request is served.
+     *
+     * @returns Whether the request is served, otherwise the connection is handed over to the mainloop.
+     *
+     */
+    using ServeHandler = std::function<bool(const std::string &aSource, const Request &aRequest, Response &aResponse)>;
+
+    /**
+     * This type represents the handler taking over a connection on the mainloop.
+     *
+     * @param[in] aFd        The file descriptor of the connection, which is owned by the handler.
+     * @param[in] aSource    The source address of the connection.
+     * @param[in] aReceived  The data received from the connection and not answered yet.
+     *
+     */
+    using HandOverHandler = std::function<void(int aFd, const std::string &aSource, const std::string &aReceived)>;
+
+    /**
+     * The constructor initializes the pool, without any acceptor thread.
+     *
+     * @param[in] aServeHandler     The handler serving the requests on the acceptor threads.
+     * @param[in] aHandOverHandler  The handler taking over the connections on the mainloop.
+     *
+     */
+    AcceptorPool(ServeHandler aServeHandler, HandOverHandler aHandOverHandler);
+
+    /**
+     * The destructor stops the acceptor threads.
+     *
+     */
+    ~AcceptorPool(void);
+
+    /**
+     * This method starts an acceptor thread for each listen socket.
+     *
+     * The pool takes the ownership of the sockets, which must be non-blocking and listening.
+     *
+     * @param[in] aListenFds  The listen sockets of the acceptor threads.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully started the acceptor threads.
+     * @retval OTBR_ERROR_INVALID_STATE  The acceptor threads are already running.
+     * @retval OTBR_ERROR_ERRNO          Failed to create the pipe stopping the threads.
+     *
+     */
+    otbrError Start(const std::vector<int> &aListenFds);
+
+    /**
+     * This method stops the acceptor threads, which close their listen sockets and the connections they serve.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether the acceptor threads are running.
+     *
+     * @returns Whether the acceptor threads are running.
+     *
+     */
+    bool IsRunning(void) const { return !mThreads.empty(); }
+
+    /**
+     * This method returns the number of requests served by the acceptor threads.
+     *
+     * @returns The number of requests served by the acceptor threads.
+     *
+     */
+    size_t GetServedCount(void) const { return mServedCount; }
+
+    /**
+     * This method returns the number of connections handed over to the mainloop.
+     *
+     * @returns The number of connections handed over to the mainloop.
+     *
+     */
+    size_t GetHandedOverCount(void) const { return mHandedOverCount; }
+
+private:
+    enum
+    {
+        kRead  = 0,
+        kWrite = 1,
+    };
+
+    struct Client
+    {
+        Client(int aFd, const std::string &aSource);
+
+        int                                   mFd;
+        std::string                           mSource;
+        std::string                           mReadContent;
+        size_t                                mParsedLength;
+        Request                               mRequest;
+        Parser                                mParser;
+        Response                              mResponse;
+        std::vector<struct iovec>             mWriteBuffers;
+        size_t                                mWriteIndex;
+        std::chrono::steady_clock::time_point mTimeStamp;
+        uint32_t                              mRequestCount;
+        bool                                  mKeepAlive;
+        bool                                  mIdle;
+        bool                                  mWriting;
+    };
+
+    using ClientList = std::vector<std::unique_ptr<Client>>;
+
+    void RunAcceptor(int aListenFd);
+    void Accept(int aListenFd, ClientList &aClients);
+    void Process(Client &aClient, short aEvents);
+    void Read(Client &aClient);
+    void HandleRequests(Client &aClient);
+    void Serve(Client &aClient);
+    void Write(Client &aClient);
+    void CompleteResponse(Client &aClient);
+    void HandOver(Client &aClient);
+    static void Close(Client &aClient);
+    static int  GetPollTimeout(const Client &aClient, std::chrono::steady_clock::time_point aNow);
+
+    ServeHandler             mServeHandler;
+    HandOverHandler          mHandOverHandler;
+    TaskRunner               mTaskRunner;
+    int                      mStopFds[2];
+    std::vector<int>         mListenFds;
+    std::vector<std::thread> mThreads;
+    std::atomic<size_t>      mServedCount;
+    std::atomic<size_t>      mHandedOverCount;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ACCEPTOR_POOL_HPP_
@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/admission_control.hpp"
+
+#include <algorithm>
+
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+// Maximum number of source addresses tracked at the same time
+static const size_t kMaxSources = 1024;
+
+AdmissionControl::AdmissionControl(uint32_t aRate, uint32_t aBurst)
+    : mRate(aRate)
+    , mBurst(std::max<uint32_t>(aBurst, 1))
+    , mRejectedCount(0)
+{
+}
+
+bool AdmissionControl::Admit(const std::string &aSource, Priority aPriority, steady_clock::time_point aNow)
+{
+    bool    admitted = true;
+    Source *source;
+    Bucket *bucket;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    VerifyOrExit(mRate != 0);
+
+    source = FindOrAddSource(aSource, aNow);
+    VerifyOrExit(source != nullptr, admitted = false);
+
+    bucket = &source->mBuckets[static_cast<uint8_t>(aPriority)];
+    Refill(*bucket, aNow);
+    VerifyOrExit(bucket->mTokens >= 1, admitted = false);
+    bucket->mTokens -= 1;
+
+exit:
+    if (!admitted)
+    {
+        mRejectedCount++;
+    }
+    return admitted;
+}
+
+void AdmissionControl::Refill(Bucket &aBucket, steady_clock::time_point aNow) const
+{
+    double elapsed = duration<double>(aNow - aBucket.mUpdateTime).count();
+
+    // The threads admitting requests may read the time in a different order than they call this method.
+    VerifyOrExit(elapsed > 0);
+
+    aBucket.mTokens     = std::min<double>(aBucket.mTokens + elapsed * mRate, mBurst);
+    aBucket.mUpdateTime = aNow;
+
+exit:
+    return;
+}
+
+AdmissionControl::Source *AdmissionControl::FindOrAddSource(const std::string &aSource, steady_clock::time_point aNow)
+{
+    Source *source = nullptr;
+    auto    it     = mSources.find(aSource);
+
+    VerifyOrExit(it == mSources.end(), source = &it->second);
+
+    if (mSources.size() >= kMaxSources)
+    {
+        // The sources whose buckets are refilled are in the same state as new ones, they are forgotten.
+        for (it = mSources.begin(); it != mSources.end();)
+        {
+            bool refilled = true;
+
+            for (Bucket &bucket : it->second.mBuckets)
+            {
+                Refill(bucket, aNow);
+                refilled = refilled && bucket.mTokens >= mBurst;
+            }
+
+            it = refilled ? mSources.erase(it) : std::next(it);
+        }
+        VerifyOrExit(mSources.size() < kMaxSources);
+    }
+
+    source = &mSources[aSource];
+    for (Bucket &bucket : source->mBuckets)
+    {
+        bucket.mTokens     = mBurst;
+        bucket.mUpdateTime = aNow;
+    }
+
+exit:
+    return source;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,153 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definition of the admission control of the REST server.
+ */
+
+#ifndef OTBR_REST_ADMISSION_CONTROL_HPP_
+#define OTBR_REST_ADMISSION_CONTROL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+/**
+ * The number of requests per second admitted from each source address in each priority class, zero admits all the
+ * requests.
+ *
+ */
+#ifndef OTBR_REST_ADMISSION_RATE
+#define OTBR_REST_ADMISSION_RATE 20
+#endif
+
+/**
+ * The number of requests admitted at once from each source address in each priority class.
+ *
+ */
+#ifndef OTBR_REST_ADMISSION_BURST
+#define OTBR_REST_ADMISSION_BURST 40
+#endif
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements the admission of the requests to the REST server, by a token bucket per source address and
+ * priority class.
+ *
+ * The write operations have their own buckets, so that a client polling with bulk GETs doesn't delay the changes of
+ * the state from the same address.
+ *
+ */
+class AdmissionControl : private NonCopyable
+{
+public:
+    /**
+     * This enumeration represents the priority classes of the requests.
+     *
+     */
+    enum class Priority : uint8_t
+    {
+        kBulk  = 0, ///< The requests reading the state.
+        kWrite = 1, ///< The requests changing the state.
+    };
+
+    /**
+     * The constructor initializes the admission control.
+     *
+     * @param[in] aRate   The number of requests per second admitted from each source, zero admits all the requests.
+     * @param[in] aBurst  The number of requests admitted at once from each source.
+     *
+     */
+    AdmissionControl(uint32_t aRate, uint32_t aBurst);
+
+    /**
+     * This method decides whether a request is admitted.
+     *
+     * This method is thread-safe, the requests are also admitted by the acceptor threads.
+     *
+     * @param[in] aSource    The source address of the request.
+     * @param[in] aPriority  The priority class of the request.
+     * @param[in] aNow       The current time.
+     *
+     * @returns Whether the request is admitted, otherwise it is counted as rejected.
+     *
+     */
+    bool Admit(const std::string &aSource, Priority aPriority, std::chrono::steady_clock::time_point aNow);
+
+    /**
+     * This method returns the number of rejected requests.
+     *
+     * @returns The number of rejected requests.
+     *
+     */
+    size_t GetRejectedCount(void) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mRejectedCount;
+    }
+
+private:
+    static constexpr size_t kNumPriorities = 2;
+
+    struct Bucket
+    {
+        double                                mTokens;
+        std::chrono::steady_clock::time_point mUpdateTime;
+    };
+
+    struct Source
+    {
+        Bucket mBuckets[kNumPriorities];
+    };
+
+    void    Refill(Bucket &aBucket, std::chrono::steady_clock::time_point aNow) const;
+    Source *FindOrAddSource(const std::string &aSource, std::chrono::steady_clock::time_point aNow);
+
+    uint32_t                                mRate;
+    uint32_t                                mBurst;
+    mutable std::mutex                      mMutex;
+    std::unordered_map<std::string, Source> mSources;
+    size_t                                  mRejectedCount;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ADMISSION_CONTROL_HPP_
@@ -26,14 +26,22 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_TAG "REST"
+
 #include "rest/connection.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 #include <assert.h>
+#include <limits.h>
 
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+
+#include "common/mainloop_manager.hpp"
+#include "common/probes.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -46,21 +54,38 @@ namespace rest {
 // The timeout (in microseconds) since a connection is in wait callback state
 static const uint32_t kCallbackTimeout = 10000000;
 
-// The time interval (in microseconds) for checking again if there is a connection need callback.
-static const uint32_t kCallbackCheckInterval = 500000;
-
 // The timeout (in microseconds) since a connection is in wait write state
 static const uint32_t kWriteTimeout = 10000000;
 
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+// The timeout (in seconds) of an idle connection kept alive for the next request
+static const uint32_t kKeepAliveTimeout = 5;
+
+// Maximum number of requests handled by one connection
+static const uint32_t kMaxRequestsPerConnection = 100;
+
+// The interval (in microseconds) of the comments sent to keep an idle event stream open
+static const uint32_t kEventStreamHeartbeatInterval = 15000000;
+
+Connection::Connection(steady_clock::time_point aStartTime,
+                       Resource                *aResource,
+                       AdmissionControl        *aAdmissionControl,
+                       const std::string       &aSource,
+                       int                      aFd)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mAdmissionControl(aAdmissionControl)
+    , mSource(aSource)
+    , mWriteIndex(0)
+    , mParsedLength(0)
+    , mRequestCount(0)
+    , mKeepAlive(false)
+    , mIdle(false)
 {
 }
 
@@ -69,46 +94,66 @@ Connection::~Connection(void)
     Disconnect();
 }
 
-void Connection::Init(void)
+void Connection::Init(const std::string &aReceived)
 {
     mParser.Init();
+    mReadContent = aReceived;
+    mRequest.SetReadBuffer(&mReadContent);
+
+    MainloopManager::GetInstance().AddFd(mFd, MainloopManager::kEventReadable,
+                                         [this](uint8_t aEvents) { HandleFdEvents(aEvents); }, GetName());
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+void Connection::UpdateFdEvents(void) const
 {
+    uint8_t events = 0;
+
+    VerifyOrExit(mFd != -1);
+
     if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
     {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        events = MainloopManager::kEventReadable;
     }
-}
-
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
-{
-    if (mState == ConnectionState::kWriteWait)
+    else if (mState == ConnectionState::kWriteWait)
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        events = MainloopManager::kEventWritable;
     }
+
+    MainloopManager::GetInstance().UpdateFd(mFd, events);
+
+exit:
+    return;
 }
 
 void Connection::UpdateTimeout(timeval &aTimeout) const
 {
     struct timeval timeout;
     uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto           duration   = duration_cast<microseconds>(MainloopClock::Now() - mTimeStamp).count();
 
     switch (mState)
     {
     case ConnectionState::kReadWait:
-        timeoutLen = kReadTimeout;
+        if (mParsedLength < mReadContent.size())
+        {
+            // Handle the pipelined request right away.
+            timeoutLen = 0;
+        }
+        else
+        {
+            timeoutLen = mIdle ? kKeepAliveTimeout * 1000000 : kReadTimeout;
+        }
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        // The connection is resumed by `ResumeCallback()`, only wake up for the timeout.
+        timeoutLen = kCallbackTimeout;
         break;
     case ConnectionState::kWriteWait:
         timeoutLen = kWriteTimeout;
         break;
+    case ConnectionState::kStreamWait:
+        timeoutLen = kEventStreamHeartbeatInterval;
+        break;
     case ConnectionState::kComplete:
         timeoutLen = 0;
         break;
@@ -118,8 +163,8 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
 
     if (duration <= timeoutLen)
     {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
+        timeout.tv_sec  = (timeoutLen - duration) / 1000000;
+        timeout.tv_usec = (timeoutLen - duration) % 1000000;
     }
     else
     {
@@ -135,117 +180,222 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
 
 void Connection::Update(MainloopContext &aMainloop)
 {
+    // The connection fd is registered to the `MainloopManager`, only the timeout is updated here.
     UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
 }
 
 void Connection::Disconnect(void)
 {
     mState = ConnectionState::kComplete;
+    mResource->GetEventPublisher().Unsubscribe(mEventSubscriber);
 
     if (mFd != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mFd);
         close(mFd);
         mFd = -1;
     }
 }
 
+void Connection::HandleFdEvents(uint8_t aEvents)
+{
+    bool ready = (aEvents & MainloopManager::kEventError) != 0;
+
+    switch (mState)
+    {
+    case ConnectionState::kInit:
+    case ConnectionState::kReadWait:
+        ProcessWaitRead(ready || (aEvents & MainloopManager::kEventReadable));
+        break;
+    case ConnectionState::kWriteWait:
+        ProcessWaitWrite(ready || (aEvents & MainloopManager::kEventWritable));
+        break;
+    default:
+        break;
+    }
+
+    UpdateFdEvents();
+}
+
 void Connection::Process(const MainloopContext &aMainloop)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    OTBR_UNUSED_VARIABLE(aMainloop);
 
+    // The fd events are handled in `HandleFdEvents()` and the callbacks in `ResumeCallback()`, here only
+    // the initial read and the timeouts are processed.
     switch (mState)
     {
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+        ProcessWaitRead(/* aReadable */ false);
         break;
     case ConnectionState::kCallbackWait:
-        //  Wait for Callback process.
-        ProcessWaitCallback();
+        if (duration_cast<microseconds>(MainloopClock::Now() - mTimeStamp).count() >= kCallbackTimeout)
+        {
+            HandleError(HttpStatusCode::kStatusInternalServerError);
+        }
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(/* aWritable */ false);
+        break;
+    case ConnectionState::kStreamWait:
+        if (duration_cast<microseconds>(MainloopClock::Now() - mTimeStamp).count() >= kEventStreamHeartbeatInterval)
+        {
+            WriteEvents();
+        }
+        break;
+    case ConnectionState::kComplete:
         break;
     default:
         assert(false);
     }
 
-    if (error != OTBR_ERROR_NONE)
-    {
-        Disconnect();
-    }
+    UpdateFdEvents();
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(bool aReadable)
 {
     otbrError error    = OTBR_ERROR_NONE;
-    int32_t   received = 0, err;
+    int32_t   received = 0, err = 0;
     char      buf[2048];
-    auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto      duration = duration_cast<microseconds>(MainloopClock::Now() - mTimeStamp).count();
 
-    // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+    if (mIdle)
+    {
+        // Silently close a kept alive connection which does not receive the next request in time.
+        VerifyOrExit(duration <= kKeepAliveTimeout * 1000000, Disconnect());
+    }
+    else
+    {
+        // Reach a read timeout, will send response about this timeout later.
+        VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+    }
 
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    // Pipelined requests are parsed from the received data first.
+    if (mParsedLength < mReadContent.size())
+    {
+        mIdle = false;
+        SuccessOrExit(error = ParseReadContent());
+    }
 
-    do
+    // It will read either fd is set or it is in kInit state.
+    if (!mRequest.IsComplete() && (aReadable || mState == ConnectionState::kInit))
     {
-        mState   = ConnectionState::kReadWait;
-        received = read(mFd, buf, sizeof(buf));
-        err      = errno;
-        if (received > 0)
+        do
+        {
+            mState   = ConnectionState::kReadWait;
+            received = read(mFd, buf, sizeof(buf));
+            err      = errno;
+            if (received > 0)
+            {
+                if (mIdle)
+                {
+                    // The read timeout applies from the first byte of the next request.
+                    mIdle      = false;
+                    mTimeStamp = MainloopClock::Now();
+                }
+                mReadContent.append(buf, received);
+                SuccessOrExit(error = ParseReadContent());
+            }
+        } while ((received > 0 && !mRequest.IsComplete()) || (received < 0 && err == EINTR));
+
+        // Check first failure situation: received = -1 error(indicates that our system call read raise an error )
+        // then try to send back a response that there is an internal error.
+        VerifyOrExit(received >= 0 || err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+
+        // Check second failure situation: received == 0 (indicate another side at least has closes its write side )
+        // and at the same time, the request has not been parsed completely.
+        if (received == 0 && !mRequest.IsComplete())
         {
-            mParser.Process(buf, received);
+            // The client closed a kept alive connection between two requests.
+            VerifyOrExit(!mIdle, Disconnect());
+            ExitNow(error = OTBR_ERROR_REST);
         }
-    } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
+    }
 
     if (mRequest.IsComplete())
     {
         Handle();
     }
 
-    // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
-    // and at the same time, the request has not been parsed completely.
-    VerifyOrExit(received != 0 || mRequest.IsComplete(), error = OTBR_ERROR_REST);
-
-    // Check second  failure situation : received = -1 error(indicates that our system call read raise an error )
-    // then try to send back a response that there is an internal error.
-    VerifyOrExit(received > 0 || (received == -1 && (err == EAGAIN || err == EWOULDBLOCK)), error = OTBR_ERROR_REST);
-
 exit:
-    if (error != OTBR_ERROR_NONE)
+    if (error == OTBR_ERROR_PARSE)
     {
-        if (received < 0)
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
-        }
-        else
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusRequestTimeout);
-            Write();
-        }
+        HandleError(HttpStatusCode::kStatusBadRequest);
+    }
+    else if (error == OTBR_ERROR_ABORTED)
+    {
+        HandleError(HttpStatusCode::kStatusPayloadTooLarge);
+    }
+    else if (error != OTBR_ERROR_NONE)
+    {
+        HandleError((received < 0) ? HttpStatusCode::kStatusInternalServerError
+                                   : HttpStatusCode::kStatusRequestTimeout);
     }
 }
 
+otbrError Connection::ParseReadContent(void)
+{
+    otbrError error;
+    size_t    parsedLength;
+
+    error = mParser.Process(mReadContent.data() + mParsedLength, mReadContent.size() - mParsedLength, parsedLength);
+    mParsedLength += parsedLength;
+
+    return error;
+}
+
+bool Connection::IsIdle(void) const
+{
+    return mIdle && mState == ConnectionState::kReadWait && mParsedLength == mReadContent.size();
+}
+
 void Connection::Handle(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError                  error = OTBR_ERROR_NONE;
+    AdmissionControl::Priority priority;
+
+    OTBR_PROBE(rest__handle__start, mRequest.GetUrl().c_str(), static_cast<int>(mRequest.GetMethod()));
+
+    mRequestCount++;
+    mKeepAlive = IsKeptAlive(mRequest, mRequestCount);
+
+    if (!mKeepAlive)
+    {
+        // Try to close server read side here, because we have started to handle the last request and no longer read
+        // from socket.
+        VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    }
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    // The requests changing the state are admitted apart from the bulk GETs.
+    priority = (mRequest.GetMethod() == HttpMethod::kGet || mRequest.GetMethod() == HttpMethod::kOptions)
+                   ? AdmissionControl::Priority::kBulk
+                   : AdmissionControl::Priority::kWrite;
+
+    if (!mAdmissionControl->Admit(mSource, priority, MainloopClock::Now()))
+    {
+        otbrLogDebug("Rejected %s request from %s", mRequest.GetUrl().c_str(), mSource.c_str());
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusTooManyRequests);
+        mResponse.SetHeader("Retry-After", "1");
+        Write();
+        ExitNow();
+    }
 
     mResource->Handle(mRequest, mResponse);
 
+    if (mResponse.IsStream())
+    {
+        // The events follow the response until the client closes the connection.
+        mKeepAlive = false;
+        mEventSubscriber.SetEventsAvailableCallback([this]() { HandleEventsAvailable(); });
+        mResource->GetEventPublisher().Subscribe(mEventSubscriber);
+    }
+
     if (mResponse.NeedCallback())
     {
         mState     = ConnectionState::kCallbackWait;
-        mTimeStamp = steady_clock::now();
+        mTimeStamp = MainloopClock::Now();
     }
     else
     {
@@ -257,38 +407,47 @@ exit:
 
     if (error != OTBR_ERROR_NONE)
     {
-        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-        Write();
+        HandleError(HttpStatusCode::kStatusInternalServerError);
     }
+    OTBR_PROBE(rest__handle__end, mResponse.GetResponseCode().c_str());
 }
 
-void Connection::ProcessWaitCallback(void)
+void Connection::HandleError(HttpStatusCode aErrorCode)
+{
+    // The connection state is unknown after an error, don't reuse it.
+    mKeepAlive = false;
+    mResource->ErrorHandler(mResponse, aErrorCode);
+    Write();
+}
+
+void Connection::ResumeCallback(void)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    VerifyOrExit(mState == ConnectionState::kCallbackWait);
+
+    ProcessWaitCallback();
+    UpdateFdEvents();
+
+exit:
+    return;
+}
 
+void Connection::ProcessWaitCallback(void)
+{
     mResource->HandleCallback(mRequest, mResponse);
 
     if (mResponse.IsComplete())
     {
         Write();
     }
-    else
-    {
-        if (duration >= kCallbackTimeout)
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
-        }
-    }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(bool aWritable)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto duration = duration_cast<microseconds>(MainloopClock::Now() - mTimeStamp).count();
 
     if (duration <= kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        if (aWritable)
         {
             Write();
         }
@@ -301,48 +460,51 @@ void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
 
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError error = OTBR_ERROR_NONE;
+    ssize_t   sendLength;
+    int32_t   err;
 
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState     = ConnectionState::kWriteWait;
+        mTimeStamp = MainloopClock::Now();
+
+        PrepareResponse(mRequest, mKeepAlive, mRequestCount, mResponse);
+        mResponse.Serialize(mWriteBuffers);
+        mWriteIndex = 0;
     }
 
     // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
+    VerifyOrExit(mWriteIndex < mWriteBuffers.size(), error = OTBR_ERROR_REST);
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
-    err        = errno;
+    do
+    {
+        struct msghdr message;
+
+        memset(&message, 0, sizeof(message));
+        message.msg_iov    = &mWriteBuffers[mWriteIndex];
+        message.msg_iovlen = std::min<size_t>(mWriteBuffers.size() - mWriteIndex, IOV_MAX);
+
+        // Don't raise SIGPIPE if the client has closed the connection, e.g. an event stream.
+        sendLength = sendmsg(mFd, &message, MSG_NOSIGNAL);
+        err        = errno;
+
+        if (sendLength > 0)
+        {
+            ConsumeWriteBuffers(static_cast<size_t>(sendLength));
+        }
+    } while ((sendLength > 0 && mWriteIndex < mWriteBuffers.size()) || (sendLength < 0 && err == EINTR));
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
+    if (mWriteIndex == mWriteBuffers.size())
     {
         // Normal Exit
-        Disconnect();
-    }
-    else if (sendLength > 0)
-    {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
+        CompleteResponse();
     }
     else
     {
-        if (errno == EINTR)
-        {
-            // Try again
-            Write();
-        }
-        else
-        {
-            // There is an error when we write, if this, we directly disconnect this connection.
-            VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
-        }
+        // There is an error when we write, if this, we directly disconnect this connection.
+        VerifyOrExit(sendLength < 0 && (err == EAGAIN || err == EWOULDBLOCK), error = OTBR_ERROR_REST);
     }
 
 exit:
@@ -352,6 +514,112 @@ exit:
     }
 }
 
+bool Connection::IsKeptAlive(const Request &aRequest, uint32_t aRequestCount)
+{
+    return aRequest.IsKeepAlive() && aRequestCount < kMaxRequestsPerConnection;
+}
+
+void Connection::PrepareResponse(const Request &aRequest, bool aKeepAlive, uint32_t aRequestCount, Response &aResponse)
+{
+    aResponse.SetHeader("Connection", aKeepAlive ? "keep-alive" : "close");
+    if (aKeepAlive)
+    {
+        aResponse.SetHeader("Keep-Alive", "timeout=" + std::to_string(kKeepAliveTimeout) +
+                                              ", max=" + std::to_string(kMaxRequestsPerConnection - aRequestCount));
+    }
+    aResponse.SetChunkedEncodingAllowed(aRequest.IsChunkedEncodingSupported());
+    aResponse.SetGzipAllowed(aRequest.IsGzipAccepted());
+}
+
+uint32_t Connection::GetKeepAliveTimeout(void)
+{
+    return kKeepAliveTimeout;
+}
+
+void Connection::WriteEvents(void)
+{
+    struct iovec buffer;
+
+    mEventContent.clear();
+    mEventSubscriber.TakePendingEvents(mEventContent);
+
+    if (mEventContent.empty())
+    {
+        // A comment is ignored by the client but detects a closed connection.
+        mEventContent = ": heartbeat\n\n";
+    }
+
+    buffer.iov_base = &mEventContent[0];
+    buffer.iov_len  = mEventContent.size();
+    mWriteBuffers.assign(1, buffer);
+    mWriteIndex = 0;
+    mState      = ConnectionState::kWriteWait;
+    mTimeStamp  = MainloopClock::Now();
+
+    Write();
+}
+
+void Connection::HandleEventsAvailable(void)
+{
+    // Events published while writing are sent once the write completes.
+    VerifyOrExit(mState == ConnectionState::kStreamWait);
+
+    WriteEvents();
+    UpdateFdEvents();
+
+exit:
+    return;
+}
+
+void Connection::ConsumeWriteBuffers(size_t aLength)
+{
+    // Skip the fully written buffers and move the start of the partly written one, without copying the content.
+    while (mWriteIndex < mWriteBuffers.size() && aLength >= mWriteBuffers[mWriteIndex].iov_len)
+    {
+        aLength -= mWriteBuffers[mWriteIndex].iov_len;
+        mWriteIndex++;
+    }
+
+    if (mWriteIndex < mWriteBuffers.size())
+    {
+        mWriteBuffers[mWriteIndex].iov_base = static_cast<char *>(mWriteBuffers[mWriteIndex].iov_base) + aLength;
+        mWriteBuffers[mWriteIndex].iov_len -= aLength;
+    }
+}
+
+void Connection::CompleteResponse(void)
+{
+    if (mResponse.IsStream())
+    {
+        mState     = ConnectionState::kStreamWait;
+        mTimeStamp = MainloopClock::Now();
+
+        if (mEventSubscriber.HasPendingEvents())
+        {
+            WriteEvents();
+        }
+        ExitNow();
+    }
+
+    VerifyOrExit(mKeepAlive, Disconnect());
+
+    // Wait for the next request, which may already be received if pipelined. The data of the handled request is only
+    // released now, as the request refers to it.
+    mReadContent.erase(0, mParsedLength);
+    mParsedLength = 0;
+    mRequest      = Request();
+    mResponse     = Response();
+    mState        = ConnectionState::kReadWait;
+    mTimeStamp    = MainloopClock::Now();
+    mIdle         = true;
+    mRequest.SetReadBuffer(&mReadContent);
+    mWriteBuffers.clear();
+    mWriteIndex = 0;
+
+exit:
+    return;
+}
+
 bool Connection::IsComplete() const
 {
     return mState == ConnectionState::kComplete;
@@ -36,10 +36,14 @@
 
 #include "openthread-br/config.h"
 
+#include <vector>
+
 #include <string.h>
 #include <unistd.h>
+#include <sys/uio.h>
 
 #include "common/mainloop.hpp"
+#include "rest/admission_control.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
@@ -62,11 +66,17 @@ public:
      *                        is set when created for the first time and maybe
      *                        reset when transfer to wait callback or wait write
      *                        state.
-     * @param[in] aResource   A pointer to the resource handler.
-     * @param[in] aFd         The file descriptor for the connection.
+     * @param[in] aResource          A pointer to the resource handler.
+     * @param[in] aAdmissionControl  A pointer to the admission control of the requests.
+     * @param[in] aSource            The source address of the connection.
+     * @param[in] aFd                The file descriptor for the connection.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime,
+               Resource                *aResource,
+               AdmissionControl        *aAdmissionControl,
+               const std::string       &aSource,
+               int                      aFd);
 
     /**
      * The desctructor destroys the connection instance.
@@ -77,12 +87,14 @@ public:
     /**
      * This method initializes the connection.
      *
+     * @param[in] aReceived  The data already received from the connection, e.g. by an acceptor thread.
      *
      */
-    void Init(void);
+    void Init(const std::string &aReceived = "");
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RestConnection"; }
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -93,16 +105,87 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method returns the number of requests handled by this connection.
+     *
+     * @returns The number of requests handled by this connection.
+     *
+     */
+    uint32_t GetRequestCount(void) const { return mRequestCount; }
+
+    /**
+     * This method indicates whether this connection is kept alive and waits for the next request.
+     *
+     * An idle connection may be closed at any time to serve another one.
+     *
+     * @retval TRUE   This connection waits for the next request and hasn't received any of it.
+     * @retval FALSE  This connection is handling a request.
+     *
+     */
+    bool IsIdle(void) const;
+
+    /**
+     * This method returns the time of the last check point of this connection.
+     *
+     * @returns The time since when the connection is in its current state.
+     *
+     */
+    steady_clock::time_point GetTimeStamp(void) const { return mTimeStamp; }
+
+    /**
+     * This method resumes the connection if it is waiting for a callback.
+     *
+     * It should be called once the data a callback waits for may be available.
+     *
+     */
+    void ResumeCallback(void);
+
+    /**
+     * This method indicates whether a connection is kept alive after responding to a request.
+     *
+     * @param[in] aRequest       The request being responded to.
+     * @param[in] aRequestCount  The number of requests handled by the connection, including this one.
+     *
+     * @returns Whether the connection waits for the next request after the response.
+     *
+     */
+    static bool IsKeptAlive(const Request &aRequest, uint32_t aRequestCount);
+
+    /**
+     * This method sets the connection headers and the allowed encodings of a response before it is serialized.
+     *
+     * @param[in]     aRequest       The request being responded to.
+     * @param[in]     aKeepAlive     Whether the connection is kept alive after the response.
+     * @param[in]     aRequestCount  The number of requests handled by the connection, including this one.
+     * @param[in,out] aResponse      The response to prepare.
+     *
+     */
+    static void PrepareResponse(const Request &aRequest, bool aKeepAlive, uint32_t aRequestCount, Response &aResponse);
+
+    /**
+     * This method returns the timeout of an idle connection kept alive for the next request.
+     *
+     * @returns The timeout in seconds.
+     *
+     */
+    static uint32_t GetKeepAliveTimeout(void);
+
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
-    void Disconnect(void);
+    void      UpdateFdEvents(void) const;
+    void      UpdateTimeout(timeval &aTimeout) const;
+    void      HandleFdEvents(uint8_t aEvents);
+    void      ProcessWaitRead(bool aReadable);
+    void      ProcessWaitCallback(void);
+    void      ProcessWaitWrite(bool aWritable);
+    otbrError ParseReadContent(void);
+    void      Write(void);
+    void      WriteEvents(void);
+    void      HandleEventsAvailable(void);
+    void      ConsumeWriteBuffers(size_t aLength);
+    void      Handle(void);
+    void      HandleError(HttpStatusCode aErrorCode);
+    void      CompleteResponse(void);
+    void      Disconnect(void);
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
@@ -125,8 +208,37 @@ private:
     // Resource handler instance
     Resource *mResource;
 
-    // Write buffer in case write multiple times
-    std::string mWriteContent;
+    // Admission control of the requests, and the source address they are admitted for
+    AdmissionControl *mAdmissionControl;
+    std::string       mSource;
+
+    // Buffers of the serialized response in case write multiple times
+    std::vector<struct iovec> mWriteBuffers;
+
+    // Index of the first buffer in `mWriteBuffers` which is not fully written
+    size_t mWriteIndex;
+
+    // Subscription to the events if the response is an event stream
+    EventSubscriber mEventSubscriber;
+
+    // Events being written to an event stream
+    std::string mEventContent;
+
+    // Received data of the current request, which refers to it, followed by the data not parsed yet, i.e. pipelined
+    // requests
+    std::string mReadContent;
+
+    // Number of bytes of `mReadContent` which are parsed
+    size_t mParsedLength;
+
+    // Number of requests handled by this connection
+    uint32_t mRequestCount;
+
+    // Whether the connection is kept open after the current response
+    bool mKeepAlive;
+
+    // Whether the connection waits for the next request after a response
+    bool mIdle;
 };
 
 } // namespace rest
@@ -0,0 +1,344 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "REST"
+
+#include "rest/diagnostic_collector.hpp"
+
+#include <algorithm>
+
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/memory_stats.hpp"
+#include "common/time.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+namespace otbr {
+namespace rest {
+
+// MulticastAddr
+static const char *kMulticastAddrAllRouters = "ff03::2";
+
+// Default TlvTypes for Diagnostic inforamtion
+static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
+
+// Interval between two incremental refreshes
+static constexpr Milliseconds kRefreshInterval = Milliseconds(1000);
+
+// Maximum number of routers queried in one incremental refresh
+static constexpr size_t kRefreshBatchSize = 4;
+
+// Age (in Microseconds) after which the diagnostics of a router are refreshed
+static const uint32_t kDiagRefreshAge = 10000000;
+
+// Age (in Microseconds) after which the diagnostics of a router are deleted
+static const uint32_t kDiagExpireAge = 60000000;
+
+// Duration the background refresh keeps running after the cache was last read
+static constexpr std::chrono::minutes kKeepRefreshingDuration = std::chrono::minutes(5);
+
+static uint64_t GetAge(const DiagInfo &aDiagInfo, steady_clock::time_point aNow)
+{
+    return duration_cast<microseconds>(aNow - aDiagInfo.mStartTime).count();
+}
+
+DiagnosticCollector::DiagnosticCollector(Ncp::RcpHost *aHost)
+    : mHost(aHost)
+    , mInstance(nullptr)
+    , mRefreshScheduled(false)
+{
+}
+
+DiagnosticCollector::~DiagnosticCollector(void)
+{
+    MemoryStats::GetInstance().RemoveCounters(this);
+}
+
+void DiagnosticCollector::Init(otInstance *aInstance)
+{
+    mInstance = aInstance;
+
+    // Not added by the constructor, as the collector may be copied before it's initialized.
+    MemoryStats::GetInstance().AddCounter(this, "rest.diag_nodes", [this]() { return mNodes.size(); });
+}
+
+bool DiagnosticCollector::IsTlvTypeCollected(uint8_t aTlvType)
+{
+    return std::find(std::begin(kAllTlvTypes), std::end(kAllTlvTypes), aTlvType) != std::end(kAllTlvTypes);
+}
+
+void DiagnosticCollector::KeepRefreshing(void)
+{
+    mRefreshDeadline = MainloopClock::Now() + kKeepRefreshingDuration;
+    ScheduleRefresh();
+}
+
+void DiagnosticCollector::ScheduleRefresh(void)
+{
+    VerifyOrExit(!mRefreshScheduled);
+
+    mRefreshScheduled = true;
+    mHost->PostTimerTask(kRefreshInterval, [this]() { HandleRefreshTimer(); });
+
+exit:
+    return;
+}
+
+void DiagnosticCollector::HandleRefreshTimer(void)
+{
+    steady_clock::time_point now = MainloopClock::Now();
+    std::vector<uint16_t>    routers;
+    size_t                   count = 0;
+
+    mRefreshScheduled = false;
+
+    DeleteExpiredNodes();
+    VerifyOrExit(now < mRefreshDeadline);
+    VerifyOrExit(otThreadGetDeviceRole(mInstance) > OT_DEVICE_ROLE_DETACHED, ScheduleRefresh());
+
+    GetRouters(routers);
+
+    // Query the routers missing from the cache first, then the ones with the oldest diagnostics.
+    std::sort(routers.begin(), routers.end(), [this](uint16_t aLeft, uint16_t aRight) {
+        auto left  = mNodes.find(aLeft);
+        auto right = mNodes.find(aRight);
+
+        if (left == mNodes.end() || right == mNodes.end())
+        {
+            return left == mNodes.end() && right != mNodes.end();
+        }
+
+        return left->second.mStartTime < right->second.mStartTime;
+    });
+
+    for (uint16_t rloc16 : routers)
+    {
+        auto node = mNodes.find(rloc16);
+
+        VerifyOrExit(count < kRefreshBatchSize, ScheduleRefresh());
+
+        if (node != mNodes.end() && GetAge(node->second, now) < kDiagRefreshAge)
+        {
+            // The routers are sorted by age, the remaining ones are all fresh enough.
+            break;
+        }
+
+        if (SendDiagnosticGet(rloc16) == OTBR_ERROR_NONE)
+        {
+            count++;
+        }
+    }
+
+    ScheduleRefresh();
+
+exit:
+    return;
+}
+
+void DiagnosticCollector::GetRouters(std::vector<uint16_t> &aRloc16s) const
+{
+    uint8_t  maxRouterId = otThreadGetMaxRouterId(mInstance);
+    uint16_t rloc16      = otThreadGetRloc16(mInstance);
+
+    for (uint8_t routerId = 0; routerId <= maxRouterId; routerId++)
+    {
+        otRouterInfo routerInfo;
+
+        if (otThreadGetRouterInfo(mInstance, routerId, &routerInfo) == OT_ERROR_NONE && routerInfo.mAllocated)
+        {
+            aRloc16s.push_back(routerInfo.mRloc16);
+        }
+    }
+
+    // A child is not in the router table but answers the queries on its own.
+    if (std::find(aRloc16s.begin(), aRloc16s.end(), rloc16) == aRloc16s.end())
+    {
+        aRloc16s.push_back(rloc16);
+    }
+}
+
+bool DiagnosticCollector::IsUpToDate(steady_clock::time_point aSince) const
+{
+    std::vector<uint16_t> routers;
+    bool                  upToDate = true;
+
+    GetRouters(routers);
+
+    for (uint16_t rloc16 : routers)
+    {
+        auto node = mNodes.find(rloc16);
+
+        VerifyOrExit(node != mNodes.end() && node->second.mStartTime >= aSince, upToDate = false);
+    }
+
+exit:
+    return upToDate;
+}
+
+otbrError DiagnosticCollector::RefreshAll(void)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    otIp6Address multicastAddress;
+
+    SuccessOrExit(error = SendDiagnosticGet(*otThreadGetRloc(mInstance)));
+    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_REST);
+    error = SendDiagnosticGet(multicastAddress);
+
+exit:
+    return error;
+}
+
+otbrError DiagnosticCollector::SendDiagnosticGet(uint16_t aRloc16)
+{
+    otIp6Address address = *otThreadGetRloc(mInstance);
+
+    // The RLOC of a router shares the mesh local prefix and IID prefix of our own RLOC.
+    address.mFields.m8[14] = static_cast<uint8_t>(aRloc16 >> 8);
+    address.mFields.m8[15] = static_cast<uint8_t>(aRloc16 & 0xff);
+
+    return SendDiagnosticGet(address);
+}
+
+otbrError DiagnosticCollector::SendDiagnosticGet(const otIp6Address &aAddress)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    otError   otErr;
+
+    otErr = otThreadSendDiagnosticGet(mInstance, &aAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
+                                        &DiagnosticCollector::HandleDiagnosticResponse, this);
+    if (otErr != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to send diagnostic get: %s", otThreadErrorToString(otErr));
+        error = OTBR_ERROR_REST;
+    }
+
+    return error;
+}
+
+void DiagnosticCollector::DeleteExpiredNodes(void)
+{
+    steady_clock::time_point now = MainloopClock::Now();
+
+    for (auto it = mNodes.begin(); it != mNodes.end();)
+    {
+        if (GetAge(it->second, now) >= kDiagExpireAge)
+        {
+            it = mNodes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void DiagnosticCollector::GetDiagnostics(const std::vector<uint8_t>                 &aTlvTypes,
+                                         std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet) const
+{
+    steady_clock::time_point now = MainloopClock::Now();
+
+    for (const auto &node : mNodes)
+    {
+        // Expired nodes are only deleted while refreshing, skip them here.
+        if (GetAge(node.second, now) >= kDiagExpireAge)
+        {
+            continue;
+        }
+
+        aDiagSet.emplace_back();
+
+        for (const otNetworkDiagTlv &diagTlv : node.second.mDiagContent)
+        {
+            if (aTlvTypes.empty() || std::find(aTlvTypes.begin(), aTlvTypes.end(), diagTlv.mType) != aTlvTypes.end())
+            {
+                aDiagSet.back().push_back(diagTlv);
+            }
+        }
+    }
+}
+
+void DiagnosticCollector::HandleDiagnosticResponse(otError              aError,
+                                                   otMessage           *aMessage,
+                                                   const otMessageInfo *aMessageInfo,
+                                                   void                *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aMessageInfo);
+
+    static_cast<DiagnosticCollector *>(aContext)->HandleDiagnosticResponse(aError, aMessage);
+}
+
+void DiagnosticCollector::HandleDiagnosticResponse(otError aError, const otMessage *aMessage)
+{
+    DiagInfo              diagInfo;
+    otNetworkDiagTlv      diagTlv;
+    otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
+    bool                  hasRloc16 = false;
+    uint16_t              rloc16    = 0;
+
+    SuccessOrExit(aError);
+
+    while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
+    {
+        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+        {
+            hasRloc16 = true;
+            rloc16    = diagTlv.mData.mAddr16;
+        }
+        diagInfo.mDiagContent.push_back(diagTlv);
+    }
+
+    VerifyOrExit(hasRloc16, aError = OT_ERROR_PARSE);
+
+    if (mNodes.size() >= OTBR_REST_DIAG_MAX_NODES && mNodes.find(rloc16) == mNodes.end())
+    {
+        DeleteExpiredNodes();
+        VerifyOrExit(mNodes.size() < OTBR_REST_DIAG_MAX_NODES, aError = OT_ERROR_NO_BUFS);
+    }
+
+    diagInfo.mStartTime = MainloopClock::Now();
+    mNodes[rloc16]      = std::move(diagInfo);
+
+    if (mUpdatedCallback)
+    {
+        mUpdatedCallback(mNodes[rloc16]);
+    }
+
+exit:
+    if (aError != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,185 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the network diagnostic collector for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_DIAGNOSTIC_COLLECTOR_HPP_
+#define OTBR_REST_DIAGNOSTIC_COLLECTOR_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <openthread/netdiag.h>
+
+#include "ncp/rcp_host.hpp"
+#include "rest/types.hpp"
+
+/**
+ * The maximum number of nodes whose diagnostics are cached, the responses of new nodes are dropped beyond it.
+ *
+ */
+#ifndef OTBR_REST_DIAG_MAX_NODES
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_REST_DIAG_MAX_NODES 64
+#else
+#define OTBR_REST_DIAG_MAX_NODES 512
+#endif
+#endif
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a background collector of the network diagnostics.
+ *
+ * The diagnostics of each router are cached by its RLOC16. While the collector is in use, the routers with the most
+ * stale entries are queried a few at a time so that the cache is refreshed incrementally instead of flooding the
+ * mesh with one multicast query per REST request.
+ *
+ */
+class DiagnosticCollector
+{
+public:
+    using UpdatedCallback = std::function<void(const DiagInfo &aDiagInfo)>;
+
+    /**
+     * The constructor to initialize a diagnostic collector.
+     *
+     * @param[in] aHost  A pointer to the Thread controller.
+     *
+     */
+    explicit DiagnosticCollector(Ncp::RcpHost *aHost);
+
+    /**
+     * The destructor of a diagnostic collector.
+     *
+     */
+    ~DiagnosticCollector(void);
+
+    /**
+     * This method initializes the diagnostic collector.
+     *
+     * @param[in] aInstance  A pointer to the OpenThread instance.
+     *
+     */
+    void Init(otInstance *aInstance);
+
+    /**
+     * This method sets the callback invoked whenever the diagnostics of a node are updated.
+     *
+     * @param[in] aCallback  The callback, which receives the updated diagnostics.
+     *
+     */
+    void SetUpdatedCallback(UpdatedCallback aCallback) { mUpdatedCallback = std::move(aCallback); }
+
+    /**
+     * This method keeps the background refresh running for a while, it should be called whenever the cache is read.
+     *
+     */
+    void KeepRefreshing(void);
+
+    /**
+     * This method queries all routers at once.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully sent the queries.
+     * @retval OTBR_ERROR_REST  Failed to send the queries.
+     *
+     */
+    otbrError RefreshAll(void);
+
+    /**
+     * This method indicates whether all known routers have answered since a given time.
+     *
+     * @param[in] aSince  The time point.
+     *
+     * @returns Whether all known routers have answered since @p aSince.
+     *
+     */
+    bool IsUpToDate(steady_clock::time_point aSince) const;
+
+    /**
+     * This method indicates whether there is any cached diagnostic.
+     *
+     * @returns Whether there is no cached diagnostic.
+     *
+     */
+    bool IsEmpty(void) const { return mNodes.empty(); }
+
+    /**
+     * This method collects the cached diagnostics of all nodes.
+     *
+     * @param[in]  aTlvTypes  The TLV types to be included, an empty list includes all TLVs.
+     * @param[out] aDiagSet   The diagnostic TLVs of each node.
+     *
+     */
+    void GetDiagnostics(const std::vector<uint8_t>                 &aTlvTypes,
+                        std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet) const;
+
+    /**
+     * This method indicates whether a TLV type is collected.
+     *
+     * @param[in] aTlvType  The TLV type.
+     *
+     * @returns Whether @p aTlvType is collected.
+     *
+     */
+    static bool IsTlvTypeCollected(uint8_t aTlvType);
+
+private:
+    void      ScheduleRefresh(void);
+    void      HandleRefreshTimer(void);
+    void      GetRouters(std::vector<uint16_t> &aRloc16s) const;
+    otbrError SendDiagnosticGet(uint16_t aRloc16);
+    otbrError SendDiagnosticGet(const otIp6Address &aAddress);
+    void      DeleteExpiredNodes(void);
+
+    static void HandleDiagnosticResponse(otError              aError,
+                                         otMessage           *aMessage,
+                                         const otMessageInfo *aMessageInfo,
+                                         void                *aContext);
+    void        HandleDiagnosticResponse(otError aError, const otMessage *aMessage);
+
+    Ncp::RcpHost *mHost;
+    otInstance   *mInstance;
+
+    std::map<uint16_t, DiagInfo> mNodes;
+    steady_clock::time_point     mRefreshDeadline;
+    bool                         mRefreshScheduled;
+    UpdatedCallback              mUpdatedCallback;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAGNOSTIC_COLLECTOR_HPP_
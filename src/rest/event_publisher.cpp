@@ -0,0 +1,160 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "REST"
+
+#include "rest/event_publisher.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace rest {
+
+EventSubscriber::EventSubscriber(size_t aMaxPendingEvents)
+    : mMaxPendingEvents(aMaxPendingEvents)
+    , mDropCount(0)
+    , mUnreportedDropCount(0)
+{
+}
+
+void EventSubscriber::Push(const std::shared_ptr<const std::string> &aEvent)
+{
+    bool wasEmpty = !HasPendingEvents();
+
+    if (mPendingEvents.size() >= mMaxPendingEvents)
+    {
+        // Keep the most recent events, which reflect the current state.
+        mPendingEvents.pop_front();
+        mDropCount++;
+        mUnreportedDropCount++;
+    }
+
+    mPendingEvents.push_back(aEvent);
+
+    if (wasEmpty && mEventsAvailableCallback)
+    {
+        mEventsAvailableCallback();
+    }
+}
+
+void EventSubscriber::TakePendingEvents(std::string &aOutput)
+{
+    if (mUnreportedDropCount > 0)
+    {
+        aOutput             += EventPublisher::FormatEvent(0, "dropped", std::to_string(mUnreportedDropCount));
+        mUnreportedDropCount = 0;
+    }
+
+    for (const auto &event : mPendingEvents)
+    {
+        aOutput += *event;
+    }
+
+    mPendingEvents.clear();
+}
+
+EventPublisher::EventPublisher(void)
+    : mLastEventId(0)
+{
+}
+
+void EventPublisher::Subscribe(EventSubscriber &aSubscriber)
+{
+    VerifyOrExit(std::find(mSubscribers.begin(), mSubscribers.end(), &aSubscriber) == mSubscribers.end());
+
+    mSubscribers.push_back(&aSubscriber);
+
+exit:
+    return;
+}
+
+void EventPublisher::Unsubscribe(EventSubscriber &aSubscriber)
+{
+    auto it = std::find(mSubscribers.begin(), mSubscribers.end(), &aSubscriber);
+
+    VerifyOrExit(it != mSubscribers.end());
+
+    if (aSubscriber.GetDropCount() > 0)
+    {
+        otbrLogInfo("Event subscriber dropped %u events", aSubscriber.GetDropCount());
+    }
+    mSubscribers.erase(it);
+
+exit:
+    return;
+}
+
+void EventPublisher::Publish(const char *aType, const std::string &aData)
+{
+    std::shared_ptr<const std::string> event;
+
+    VerifyOrExit(HasSubscribers());
+
+    // The event is formatted once and shared by all subscribers.
+    event = std::make_shared<const std::string>(FormatEvent(++mLastEventId, aType, aData));
+
+    // A subscriber may unsubscribe itself from its callback, iterate over a copy.
+    for (EventSubscriber *subscriber : std::vector<EventSubscriber *>(mSubscribers))
+    {
+        subscriber->Push(event);
+    }
+
+exit:
+    return;
+}
+
+std::string EventPublisher::FormatEvent(uint32_t aId, const char *aType, const std::string &aData)
+{
+    std::string event;
+    size_t      start = 0;
+    size_t      end;
+
+    if (aId != 0)
+    {
+        event += "id: " + std::to_string(aId) + "\n";
+    }
+    event += std::string("event: ") + aType + "\n";
+
+    // Each line of the data is sent in its own data field.
+    do
+    {
+        end    = aData.find('\n', start);
+        event += "data: " + aData.substr(start, end - start) + "\n";
+        start  = end + 1;
+    } while (end != std::string::npos);
+
+    event += "\n";
+
+    return event;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,180 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the event publisher of Server-Sent Events for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_EVENT_PUBLISHER_HPP_
+#define OTBR_REST_EVENT_PUBLISHER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a subscriber of the events, i.e. a client of the event stream.
+ *
+ * The published events are queued until the subscriber takes them. A subscriber which doesn't take its events in time
+ * only keeps the most recent ones, the older ones are dropped and counted.
+ *
+ */
+class EventSubscriber
+{
+public:
+    /**
+     * The constructor to initialize an event subscriber.
+     *
+     * @param[in] aMaxPendingEvents  The maximum number of events queued for this subscriber.
+     *
+     */
+    explicit EventSubscriber(size_t aMaxPendingEvents = kDefaultMaxPendingEvents);
+
+    /**
+     * This method sets the callback invoked when events become available while none were pending.
+     *
+     * @param[in] aCallback  The callback.
+     *
+     */
+    void SetEventsAvailableCallback(std::function<void(void)> aCallback) { mEventsAvailableCallback = aCallback; }
+
+    /**
+     * This method indicates whether there is any event to take.
+     *
+     * @returns Whether there is any event to take.
+     *
+     */
+    bool HasPendingEvents(void) const { return !mPendingEvents.empty() || mUnreportedDropCount > 0; }
+
+    /**
+     * This method takes all pending events.
+     *
+     * If events were dropped since the last time, a `dropped` event with the number of dropped events comes first.
+     *
+     * @param[out] aOutput  A string to which the events are appended in the text/event-stream format.
+     *
+     */
+    void TakePendingEvents(std::string &aOutput);
+
+    /**
+     * This method returns the total number of events dropped for this subscriber.
+     *
+     * @returns The total number of dropped events.
+     *
+     */
+    uint32_t GetDropCount(void) const { return mDropCount; }
+
+private:
+    friend class EventPublisher;
+
+    static constexpr size_t kDefaultMaxPendingEvents = 32;
+
+    void Push(const std::shared_ptr<const std::string> &aEvent);
+
+    std::deque<std::shared_ptr<const std::string>> mPendingEvents;
+    size_t                                         mMaxPendingEvents;
+    uint32_t                                       mDropCount;
+    uint32_t                                       mUnreportedDropCount;
+    std::function<void(void)>                      mEventsAvailableCallback;
+};
+
+/**
+ * This class implements a publisher of the events to all subscribers.
+ *
+ */
+class EventPublisher
+{
+public:
+    /**
+     * The constructor to initialize an event publisher.
+     *
+     */
+    EventPublisher(void);
+
+    /**
+     * This method adds a subscriber, which must be removed before it is destroyed.
+     *
+     * @param[in] aSubscriber  The subscriber.
+     *
+     */
+    void Subscribe(EventSubscriber &aSubscriber);
+
+    /**
+     * This method removes a subscriber, it's a no-op if the subscriber was not added.
+     *
+     * @param[in] aSubscriber  The subscriber.
+     *
+     */
+    void Unsubscribe(EventSubscriber &aSubscriber);
+
+    /**
+     * This method indicates whether there is any subscriber, so that events are only built if needed.
+     *
+     * @returns Whether there is any subscriber.
+     *
+     */
+    bool HasSubscribers(void) const { return !mSubscribers.empty(); }
+
+    /**
+     * This method publishes an event to all subscribers.
+     *
+     * @param[in] aType  The event type.
+     * @param[in] aData  The event data, usually a serialized Json value.
+     *
+     */
+    void Publish(const char *aType, const std::string &aData);
+
+    /**
+     * This method formats an event in the text/event-stream format.
+     *
+     * @param[in] aId    The event id, or 0 to omit it.
+     * @param[in] aType  The event type.
+     * @param[in] aData  The event data, which may span multiple lines.
+     *
+     * @returns A string of the formatted event.
+     *
+     */
+    static std::string FormatEvent(uint32_t aId, const char *aType, const std::string &aData);
+
+private:
+    std::vector<EventSubscriber *> mSubscribers;
+    uint32_t                       mLastEventId;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_EVENT_PUBLISHER_HPP_
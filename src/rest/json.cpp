@@ -32,6 +32,7 @@
 #include "common/api_strings.hpp"
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
+#include "rest/json_writer.hpp"
 
 extern "C" {
 #include <cJSON.h>
@@ -45,34 +46,26 @@ namespace otbr {
 namespace rest {
 namespace Json {
 
-static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
+template <typename ValueType>
+static std::string Serialize(void (*aSerializer)(JsonWriter &, const ValueType &),
+                             const ValueType            &aValue,
+                             const JsonWriter::FieldSet *aFields = nullptr)
 {
-    char hex[2 * aLength + 1];
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
-    hex[2 * aLength] = '\0';
+    writer.SetFieldFilter(aFields);
+    aSerializer(writer, aValue);
 
-    return cJSON_CreateString(hex);
+    return ret;
 }
 
 std::string String2JsonString(const std::string &aString)
 {
     std::string ret;
-    cJSON      *json    = nullptr;
-    char       *jsonOut = nullptr;
 
     VerifyOrExit(aString.size() > 0);
-
-    json    = cJSON_CreateString(aString.c_str());
-    jsonOut = cJSON_Print(json);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
-
-    cJSON_Delete(json);
+    JsonWriter(ret).String(aString);
 
 exit:
     return ret;
@@ -94,49 +87,23 @@ exit:
     return ret;
 }
 
-std::string Json2String(const cJSON *aJson)
+static void Mode2Json(JsonWriter &aWriter, const otLinkModeConfig &aMode)
 {
-    std::string ret;
-    char       *jsonOut = nullptr;
-
-    VerifyOrExit(aJson != nullptr);
-
-    jsonOut = cJSON_Print(aJson);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
-
-exit:
-    return ret;
+    aWriter.BeginObject();
+    aWriter.AddNumber("RxOnWhenIdle", aMode.mRxOnWhenIdle);
+    aWriter.AddNumber("DeviceType", aMode.mDeviceType);
+    aWriter.AddNumber("NetworkData", aMode.mNetworkData);
+    aWriter.EndObject();
 }
 
-static cJSON *CString2Json(const char *aString)
-{
-    return cJSON_CreateString(aString);
-}
-
-static cJSON *Mode2Json(const otLinkModeConfig &aMode)
-{
-    cJSON *mode = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(mode, "RxOnWhenIdle", cJSON_CreateNumber(aMode.mRxOnWhenIdle));
-    cJSON_AddItemToObject(mode, "DeviceType", cJSON_CreateNumber(aMode.mDeviceType));
-    cJSON_AddItemToObject(mode, "NetworkData", cJSON_CreateNumber(aMode.mNetworkData));
-
-    return mode;
-}
-
-static cJSON *IpAddr2Json(const otIp6Address &aAddress)
+static void IpAddr2Json(JsonWriter &aWriter, const otIp6Address &aAddress)
 {
     Ip6Address addr(aAddress.mFields.m8);
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    aWriter.String(addr.ToString());
 }
 
-static cJSON *IpPrefix2Json(const otIp6NetworkPrefix &aAddress)
+static void IpPrefix2Json(JsonWriter &aWriter, const otIp6NetworkPrefix &aAddress)
 {
     std::stringstream ss;
     otIp6Address      address = {};
@@ -146,7 +113,7 @@ static cJSON *IpPrefix2Json(const otIp6NetworkPrefix &aAddress)
 
     ss << addr.ToString() << "/" << OT_IP6_PREFIX_BITSIZE;
 
-    return cJSON_CreateString(ss.str().c_str());
+    aWriter.String(ss.str());
 }
 
 otbrError Json2IpPrefix(const cJSON *aJson, otIp6NetworkPrefix &aIpPrefix)
@@ -164,15 +131,13 @@ exit:
     return error;
 }
 
-static cJSON *Timestamp2Json(const otTimestamp &aTimestamp)
+static void Timestamp2Json(JsonWriter &aWriter, const otTimestamp &aTimestamp)
 {
-    cJSON *timestamp = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(timestamp, "Seconds", cJSON_CreateNumber(aTimestamp.mSeconds));
-    cJSON_AddItemToObject(timestamp, "Ticks", cJSON_CreateNumber(aTimestamp.mTicks));
-    cJSON_AddItemToObject(timestamp, "Authoritative", cJSON_CreateBool(aTimestamp.mAuthoritative));
-
-    return timestamp;
+    aWriter.BeginObject();
+    aWriter.AddNumber("Seconds", aTimestamp.mSeconds);
+    aWriter.AddNumber("Ticks", aTimestamp.mTicks);
+    aWriter.AddBool("Authoritative", aTimestamp.mAuthoritative);
+    aWriter.EndObject();
 }
 
 bool Json2Timestamp(const cJSON *jsonTimestamp, otTimestamp &aTimestamp)
@@ -205,28 +170,20 @@ bool Json2Timestamp(const cJSON *jsonTimestamp, otTimestamp &aTimestamp)
     return true;
 }
 
-static cJSON *SecurityPolicy2Json(const otSecurityPolicy &aSecurityPolicy)
+static void SecurityPolicy2Json(JsonWriter &aWriter, const otSecurityPolicy &aSecurityPolicy)
 {
-    cJSON *securityPolicy = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(securityPolicy, "RotationTime", cJSON_CreateNumber(aSecurityPolicy.mRotationTime));
-    cJSON_AddItemToObject(securityPolicy, "ObtainNetworkKey",
-                          cJSON_CreateBool(aSecurityPolicy.mObtainNetworkKeyEnabled));
-    cJSON_AddItemToObject(securityPolicy, "NativeCommissioning",
-                          cJSON_CreateBool(aSecurityPolicy.mNativeCommissioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "Routers", cJSON_CreateBool(aSecurityPolicy.mRoutersEnabled));
-    cJSON_AddItemToObject(securityPolicy, "ExternalCommissioning",
-                          cJSON_CreateBool(aSecurityPolicy.mExternalCommissioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "CommercialCommissioning",
-                          cJSON_CreateBool(aSecurityPolicy.mCommercialCommissioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "AutonomousEnrollment",
-                          cJSON_CreateBool(aSecurityPolicy.mAutonomousEnrollmentEnabled));
-    cJSON_AddItemToObject(securityPolicy, "NetworkKeyProvisioning",
-                          cJSON_CreateBool(aSecurityPolicy.mNetworkKeyProvisioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "TobleLink", cJSON_CreateBool(aSecurityPolicy.mTobleLinkEnabled));
-    cJSON_AddItemToObject(securityPolicy, "NonCcmRouters", cJSON_CreateBool(aSecurityPolicy.mNonCcmRoutersEnabled));
-
-    return securityPolicy;
+    aWriter.BeginObject();
+    aWriter.AddNumber("RotationTime", aSecurityPolicy.mRotationTime);
+    aWriter.AddBool("ObtainNetworkKey", aSecurityPolicy.mObtainNetworkKeyEnabled);
+    aWriter.AddBool("NativeCommissioning", aSecurityPolicy.mNativeCommissioningEnabled);
+    aWriter.AddBool("Routers", aSecurityPolicy.mRoutersEnabled);
+    aWriter.AddBool("ExternalCommissioning", aSecurityPolicy.mExternalCommissioningEnabled);
+    aWriter.AddBool("CommercialCommissioning", aSecurityPolicy.mCommercialCommissioningEnabled);
+    aWriter.AddBool("AutonomousEnrollment", aSecurityPolicy.mAutonomousEnrollmentEnabled);
+    aWriter.AddBool("NetworkKeyProvisioning", aSecurityPolicy.mNetworkKeyProvisioningEnabled);
+    aWriter.AddBool("TobleLink", aSecurityPolicy.mTobleLinkEnabled);
+    aWriter.AddBool("NonCcmRouters", aSecurityPolicy.mNonCcmRoutersEnabled);
+    aWriter.EndObject();
 }
 
 bool Json2SecurityPolicy(const cJSON *jsonSecurityPolicy, otSecurityPolicy &aSecurityPolicy)
@@ -261,456 +218,442 @@ bool Json2SecurityPolicy(const cJSON *jsonSecurityPolicy, otSecurityPolicy &aSec
     return true;
 }
 
-static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
+static void ChildTableEntry2Json(JsonWriter &aWriter, const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON *childEntry = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(childEntry, "ChildId", cJSON_CreateNumber(aChildEntry.mChildId));
-    cJSON_AddItemToObject(childEntry, "Timeout", cJSON_CreateNumber(aChildEntry.mTimeout));
-
-    cJSON *mode = Mode2Json(aChildEntry.mMode);
-    cJSON_AddItemToObject(childEntry, "Mode", mode);
-
-    return childEntry;
+    aWriter.BeginObject();
+    aWriter.AddNumber("ChildId", aChildEntry.mChildId);
+    aWriter.AddNumber("Timeout", aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    Mode2Json(aWriter, aChildEntry.mMode);
+    aWriter.EndObject();
 }
 
-static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
+static void MacCounters2Json(JsonWriter &aWriter, const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON *macCounters = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(macCounters, "IfInUnknownProtos", cJSON_CreateNumber(aMacCounters.mIfInUnknownProtos));
-    cJSON_AddItemToObject(macCounters, "IfInErrors", cJSON_CreateNumber(aMacCounters.mIfInErrors));
-    cJSON_AddItemToObject(macCounters, "IfOutErrors", cJSON_CreateNumber(aMacCounters.mIfOutErrors));
-    cJSON_AddItemToObject(macCounters, "IfInUcastPkts", cJSON_CreateNumber(aMacCounters.mIfInUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfInBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInDiscards", cJSON_CreateNumber(aMacCounters.mIfInDiscards));
-    cJSON_AddItemToObject(macCounters, "IfOutUcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutDiscards", cJSON_CreateNumber(aMacCounters.mIfOutDiscards));
-
-    return macCounters;
+    aWriter.BeginObject();
+    aWriter.AddNumber("IfInUnknownProtos", aMacCounters.mIfInUnknownProtos);
+    aWriter.AddNumber("IfInErrors", aMacCounters.mIfInErrors);
+    aWriter.AddNumber("IfOutErrors", aMacCounters.mIfOutErrors);
+    aWriter.AddNumber("IfInUcastPkts", aMacCounters.mIfInUcastPkts);
+    aWriter.AddNumber("IfInBroadcastPkts", aMacCounters.mIfInBroadcastPkts);
+    aWriter.AddNumber("IfInDiscards", aMacCounters.mIfInDiscards);
+    aWriter.AddNumber("IfOutUcastPkts", aMacCounters.mIfOutUcastPkts);
+    aWriter.AddNumber("IfOutBroadcastPkts", aMacCounters.mIfOutBroadcastPkts);
+    aWriter.AddNumber("IfOutDiscards", aMacCounters.mIfOutDiscards);
+    aWriter.EndObject();
 }
 
-static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
+static void Connectivity2Json(JsonWriter &aWriter, const otNetworkDiagConnectivity &aConnectivity)
 {
-    cJSON *connectivity = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(connectivity, "ParentPriority", cJSON_CreateNumber(aConnectivity.mParentPriority));
-    cJSON_AddItemToObject(connectivity, "LinkQuality3", cJSON_CreateNumber(aConnectivity.mLinkQuality3));
-    cJSON_AddItemToObject(connectivity, "LinkQuality2", cJSON_CreateNumber(aConnectivity.mLinkQuality2));
-    cJSON_AddItemToObject(connectivity, "LinkQuality1", cJSON_CreateNumber(aConnectivity.mLinkQuality1));
-    cJSON_AddItemToObject(connectivity, "LeaderCost", cJSON_CreateNumber(aConnectivity.mLeaderCost));
-    cJSON_AddItemToObject(connectivity, "IdSequence", cJSON_CreateNumber(aConnectivity.mIdSequence));
-    cJSON_AddItemToObject(connectivity, "ActiveRouters", cJSON_CreateNumber(aConnectivity.mActiveRouters));
-    cJSON_AddItemToObject(connectivity, "SedBufferSize", cJSON_CreateNumber(aConnectivity.mSedBufferSize));
-    cJSON_AddItemToObject(connectivity, "SedDatagramCount", cJSON_CreateNumber(aConnectivity.mSedDatagramCount));
-
-    return connectivity;
+    aWriter.BeginObject();
+    aWriter.AddNumber("ParentPriority", aConnectivity.mParentPriority);
+    aWriter.AddNumber("LinkQuality3", aConnectivity.mLinkQuality3);
+    aWriter.AddNumber("LinkQuality2", aConnectivity.mLinkQuality2);
+    aWriter.AddNumber("LinkQuality1", aConnectivity.mLinkQuality1);
+    aWriter.AddNumber("LeaderCost", aConnectivity.mLeaderCost);
+    aWriter.AddNumber("IdSequence", aConnectivity.mIdSequence);
+    aWriter.AddNumber("ActiveRouters", aConnectivity.mActiveRouters);
+    aWriter.AddNumber("SedBufferSize", aConnectivity.mSedBufferSize);
+    aWriter.AddNumber("SedDatagramCount", aConnectivity.mSedDatagramCount);
+    aWriter.EndObject();
 }
 
-static cJSON *RouteData2Json(const otNetworkDiagRouteData &aRouteData)
+static void RouteData2Json(JsonWriter &aWriter, const otNetworkDiagRouteData &aRouteData)
 {
-    cJSON *routeData = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(routeData, "RouteId", cJSON_CreateNumber(aRouteData.mRouterId));
-    cJSON_AddItemToObject(routeData, "LinkQualityOut", cJSON_CreateNumber(aRouteData.mLinkQualityOut));
-    cJSON_AddItemToObject(routeData, "LinkQualityIn", cJSON_CreateNumber(aRouteData.mLinkQualityIn));
-    cJSON_AddItemToObject(routeData, "RouteCost", cJSON_CreateNumber(aRouteData.mRouteCost));
-
-    return routeData;
+    aWriter.BeginObject();
+    aWriter.AddNumber("RouteId", aRouteData.mRouterId);
+    aWriter.AddNumber("LinkQualityOut", aRouteData.mLinkQualityOut);
+    aWriter.AddNumber("LinkQualityIn", aRouteData.mLinkQualityIn);
+    aWriter.AddNumber("RouteCost", aRouteData.mRouteCost);
+    aWriter.EndObject();
 }
 
-static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
+static void Route2Json(JsonWriter &aWriter, const otNetworkDiagRoute &aRoute)
 {
-    cJSON *route = cJSON_CreateObject();
+    aWriter.BeginObject();
+    aWriter.AddNumber("IdSequence", aRoute.mIdSequence);
 
-    cJSON_AddItemToObject(route, "IdSequence", cJSON_CreateNumber(aRoute.mIdSequence));
-
-    cJSON *RouteData = cJSON_CreateArray();
+    aWriter.Key("RouteData");
+    aWriter.BeginArray();
     for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
     {
-        cJSON *RouteDatavalue = RouteData2Json(aRoute.mRouteData[i]);
-        cJSON_AddItemToArray(RouteData, RouteDatavalue);
+        RouteData2Json(aWriter, aRoute.mRouteData[i]);
     }
+    aWriter.EndArray();
 
-    cJSON_AddItemToObject(route, "RouteData", RouteData);
-
-    return route;
+    aWriter.EndObject();
 }
 
-static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
+static void LeaderData2Json(JsonWriter &aWriter, const otLeaderData &aLeaderData)
 {
-    cJSON *leaderData = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(leaderData, "PartitionId", cJSON_CreateNumber(aLeaderData.mPartitionId));
-    cJSON_AddItemToObject(leaderData, "Weighting", cJSON_CreateNumber(aLeaderData.mWeighting));
-    cJSON_AddItemToObject(leaderData, "DataVersion", cJSON_CreateNumber(aLeaderData.mDataVersion));
-    cJSON_AddItemToObject(leaderData, "StableDataVersion", cJSON_CreateNumber(aLeaderData.mStableDataVersion));
-    cJSON_AddItemToObject(leaderData, "LeaderRouterId", cJSON_CreateNumber(aLeaderData.mLeaderRouterId));
-
-    return leaderData;
+    aWriter.BeginObject();
+    aWriter.AddNumber("PartitionId", aLeaderData.mPartitionId);
+    aWriter.AddNumber("Weighting", aLeaderData.mWeighting);
+    aWriter.AddNumber("DataVersion", aLeaderData.mDataVersion);
+    aWriter.AddNumber("StableDataVersion", aLeaderData.mStableDataVersion);
+    aWriter.AddNumber("LeaderRouterId", aLeaderData.mLeaderRouterId);
+    aWriter.EndObject();
 }
 
 std::string IpAddr2JsonString(const otIp6Address &aAddress)
 {
-    std::string ret;
-    cJSON      *ipAddr = IpAddr2Json(aAddress);
-
-    ret = Json2String(ipAddr);
-    cJSON_Delete(ipAddr);
+    return Serialize(IpAddr2Json, aAddress);
+}
 
-    return ret;
+static void Node2Json(JsonWriter &aWriter, const NodeInfo &aNode)
+{
+    aWriter.BeginObject();
+    aWriter.AddHexString("BaId", aNode.mBaId.mId, sizeof(aNode.mBaId));
+    aWriter.AddString("State", aNode.mRole.c_str());
+    aWriter.AddNumber("NumOfRouter", aNode.mNumOfRouter);
+    aWriter.Key("RlocAddress");
+    IpAddr2Json(aWriter, aNode.mRlocAddress);
+    aWriter.AddHexString("ExtAddress", aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    aWriter.AddString("NetworkName", aNode.mNetworkName.c_str());
+    aWriter.AddNumber("Rloc16", aNode.mRloc16);
+    aWriter.Key("LeaderData");
+    LeaderData2Json(aWriter, aNode.mLeaderData);
+    aWriter.AddHexString("ExtPanId", aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    aWriter.EndObject();
 }
 
 std::string Node2JsonString(const NodeInfo &aNode)
 {
-    cJSON      *node = cJSON_CreateObject();
-    std::string ret;
-
-    cJSON_AddItemToObject(node, "BaId", Bytes2HexJson(aNode.mBaId.mId, sizeof(aNode.mBaId)));
-    cJSON_AddItemToObject(node, "State", cJSON_CreateString(aNode.mRole.c_str()));
-    cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
-    cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
-    cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
-    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
-    cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
-
-    ret = Json2String(node);
-    cJSON_Delete(node);
-
-    return ret;
+    return Serialize(Node2Json, aNode);
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+static void DiagTlv2Json(JsonWriter &aWriter, const otNetworkDiagTlv &aDiagTlv)
 {
-    cJSON      *diagInfo          = cJSON_CreateArray();
-    cJSON      *diagInfoOfOneNode = nullptr;
-    cJSON      *addrList          = nullptr;
-    cJSON      *tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
-
-    for (auto diagItem : aDiagSet)
+    switch (aDiagTlv.mType)
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
-        {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+        aWriter.AddHexString("ExtAddress", aDiagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+        aWriter.AddNumber("Rloc16", aDiagTlv.mData.mAddr16);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+        aWriter.Key("Mode");
+        Mode2Json(aWriter, aDiagTlv.mData.mMode);
 
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+        aWriter.AddNumber("Timeout", static_cast<uint64_t>(aDiagTlv.mData.mTimeout));
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+        aWriter.Key("Connectivity");
+        Connectivity2Json(aWriter, aDiagTlv.mData.mConnectivity);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+        aWriter.Key("Route");
+        Route2Json(aWriter, aDiagTlv.mData.mRoute);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+        aWriter.Key("LeaderData");
+        LeaderData2Json(aWriter, aDiagTlv.mData.mLeaderData);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+        aWriter.AddHexString("NetworkData", aDiagTlv.mData.mNetworkData.m8, aDiagTlv.mData.mNetworkData.mCount);
 
-                addrList = cJSON_CreateArray();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+        aWriter.Key("IP6AddressList");
+        aWriter.BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mIp6AddrList.mCount; ++i)
+        {
+            IpAddr2Json(aWriter, aDiagTlv.mData.mIp6AddrList.mList[i]);
+        }
+        aWriter.EndArray();
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+        aWriter.Key("MACCounters");
+        MacCounters2Json(aWriter, aDiagTlv.mData.mMacCounters);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
+        aWriter.AddNumber("BatteryLevel", aDiagTlv.mData.mBatteryLevel);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
+        aWriter.AddNumber("SupplyVoltage", aDiagTlv.mData.mSupplyVoltage);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
 
-                tableList = cJSON_CreateArray();
+        aWriter.Key("ChildTable");
+        aWriter.BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mChildTable.mCount; ++i)
+        {
+            ChildTableEntry2Json(aWriter, aDiagTlv.mData.mChildTable.mTable[i]);
+        }
+        aWriter.EndArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+        aWriter.AddHexString("ChannelPages", aDiagTlv.mData.mChannelPages.m8, aDiagTlv.mData.mChannelPages.mCount);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+        aWriter.AddNumber("MaxChildTimeout", aDiagTlv.mData.mMaxChildTimeout);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+        break;
+    default:
+        break;
+    }
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+static void NodeDiag2Json(JsonWriter &aWriter, const std::vector<otNetworkDiagTlv> &aDiagTlvs)
+{
+    aWriter.BeginObject();
+    for (const auto &diagTlv : aDiagTlvs)
+    {
+        DiagTlv2Json(aWriter, diagTlv);
+    }
+    aWriter.EndObject();
+}
 
-                break;
-            default:
-                break;
-            }
-        }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
+static void Diag2Json(JsonWriter &aWriter, const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    aWriter.BeginArray();
+    for (const auto &diagItem : aDiagSet)
+    {
+        NodeDiag2Json(aWriter, diagItem);
     }
+    aWriter.EndArray();
+}
+
+std::string NodeDiag2JsonString(const std::vector<otNetworkDiagTlv> &aDiagTlvs)
+{
+    return Serialize(NodeDiag2Json, aDiagTlvs);
+}
 
-    ret = Json2String(diagInfo);
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    return Serialize(Diag2Json, aDiagSet);
+}
 
-    cJSON_Delete(diagInfo);
+bool DiagField2TlvType(const std::string &aField, uint8_t &aTlvType)
+{
+    // The fields written by `DiagTlv2Json()`.
+    static const struct
+    {
+        const char *mField;
+        uint8_t     mTlvType;
+    } kDiagFields[] = {
+        {"ExtAddress", OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS},
+        {"Rloc16", OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS},
+        {"Mode", OT_NETWORK_DIAGNOSTIC_TLV_MODE},
+        {"Timeout", OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT},
+        {"Connectivity", OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY},
+        {"Route", OT_NETWORK_DIAGNOSTIC_TLV_ROUTE},
+        {"LeaderData", OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA},
+        {"NetworkData", OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA},
+        {"IP6AddressList", OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST},
+        {"MACCounters", OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS},
+        {"BatteryLevel", OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL},
+        {"SupplyVoltage", OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE},
+        {"ChildTable", OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE},
+        {"ChannelPages", OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES},
+        {"MaxChildTimeout", OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT},
+    };
+    bool found = false;
+
+    for (const auto &diagField : kDiagFields)
+    {
+        if (aField == diagField.mField)
+        {
+            aTlvType = diagField.mTlvType;
+            ExitNow(found = true);
+        }
+    }
 
-    return ret;
+exit:
+    return found;
 }
 
 std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
 {
-    cJSON      *hex = Bytes2HexJson(aBytes, aLength);
-    std::string ret = Json2String(hex);
+    std::string ret;
 
-    cJSON_Delete(hex);
+    JsonWriter(ret).HexString(aBytes, aLength);
 
     return ret;
 }
 
 int Hex2BytesJsonString(const std::string &aHexString, uint8_t *aBytes, uint8_t aMaxLength)
 {
-    return otbr::Utils::Hex2Bytes(aHexString.c_str(), aBytes, aMaxLength);
+    return otbr::Utils::Hex2Bytes(aHexString.data(), aHexString.size(), aBytes, aMaxLength);
+}
+
+int Hex2BytesJsonString(const char *aHexString, uint8_t *aBytes, uint8_t aMaxLength)
+{
+    return otbr::Utils::Hex2Bytes(aHexString, aBytes, aMaxLength);
 }
 
 std::string Number2JsonString(const uint32_t &aNumber)
 {
-    cJSON      *number = cJSON_CreateNumber(aNumber);
-    std::string ret    = Json2String(number);
+    std::string ret;
 
-    cJSON_Delete(number);
+    JsonWriter(ret).Number(aNumber);
 
     return ret;
 }
 
 std::string Mode2JsonString(const otLinkModeConfig &aMode)
 {
-    cJSON      *mode = Mode2Json(aMode);
-    std::string ret  = Json2String(mode);
-
-    cJSON_Delete(mode);
-
-    return ret;
+    return Serialize(Mode2Json, aMode);
 }
 
 std::string Connectivity2JsonString(const otNetworkDiagConnectivity &aConnectivity)
 {
-    cJSON      *connectivity = Connectivity2Json(aConnectivity);
-    std::string ret          = Json2String(connectivity);
-
-    cJSON_Delete(connectivity);
-
-    return ret;
+    return Serialize(Connectivity2Json, aConnectivity);
 }
 
 std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData)
 {
-    cJSON      *routeData = RouteData2Json(aRouteData);
-    std::string ret       = Json2String(routeData);
-
-    cJSON_Delete(routeData);
-
-    return ret;
+    return Serialize(RouteData2Json, aRouteData);
 }
 
 std::string Route2JsonString(const otNetworkDiagRoute &aRoute)
 {
-    cJSON      *route = Route2Json(aRoute);
-    std::string ret   = Json2String(route);
-
-    cJSON_Delete(route);
-
-    return ret;
+    return Serialize(Route2Json, aRoute);
 }
 
 std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
 {
-    cJSON      *leaderData = LeaderData2Json(aLeaderData);
-    std::string ret        = Json2String(leaderData);
-
-    cJSON_Delete(leaderData);
-
-    return ret;
+    return Serialize(LeaderData2Json, aLeaderData);
 }
 
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON      *macCounters = MacCounters2Json(aMacCounters);
-    std::string ret         = Json2String(macCounters);
-
-    cJSON_Delete(macCounters);
-
-    return ret;
+    return Serialize(MacCounters2Json, aMacCounters);
 }
 
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON      *childEntry = ChildTableEntry2Json(aChildEntry);
-    std::string ret        = Json2String(childEntry);
-
-    cJSON_Delete(childEntry);
-
-    return ret;
+    return Serialize(ChildTableEntry2Json, aChildEntry);
 }
 
 std::string CString2JsonString(const char *aCString)
 {
-    cJSON      *cString = CString2Json(aCString);
-    std::string ret     = Json2String(cString);
+    std::string ret;
 
-    cJSON_Delete(cString);
+    // Keep the previous behavior of serializing a null string to an empty string.
+    VerifyOrExit(aCString != nullptr);
+    JsonWriter(ret).String(aCString);
 
+exit:
     return ret;
 }
 
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
 {
     std::string ret;
-    cJSON      *error = cJSON_CreateObject();
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(error, "ErrorCode", cJSON_CreateNumber(static_cast<int16_t>(aErrorCode)));
-    cJSON_AddItemToObject(error, "ErrorMessage", cJSON_CreateString(aErrorMessage.c_str()));
-
-    ret = Json2String(error);
-
-    cJSON_Delete(error);
+    writer.BeginObject();
+    writer.AddNumber("ErrorCode", static_cast<int16_t>(aErrorCode));
+    writer.AddString("ErrorMessage", aErrorMessage.c_str());
+    writer.EndObject();
 
     return ret;
 }
 
-cJSON *ActiveDataset2Json(const otOperationalDataset &aActiveDataset)
+static void ActiveDataset2Json(JsonWriter &aWriter, const otOperationalDataset &aActiveDataset)
 {
-    cJSON *node = cJSON_CreateObject();
-
+    aWriter.BeginObject();
     if (aActiveDataset.mComponents.mIsActiveTimestampPresent)
     {
-        cJSON_AddItemToObject(node, "ActiveTimestamp", Timestamp2Json(aActiveDataset.mActiveTimestamp));
+        aWriter.Key("ActiveTimestamp");
+        Timestamp2Json(aWriter, aActiveDataset.mActiveTimestamp);
     }
     if (aActiveDataset.mComponents.mIsNetworkKeyPresent)
     {
-        cJSON_AddItemToObject(node, "NetworkKey", Bytes2HexJson(aActiveDataset.mNetworkKey.m8, OT_NETWORK_KEY_SIZE));
+        aWriter.AddHexString("NetworkKey", aActiveDataset.mNetworkKey.m8, OT_NETWORK_KEY_SIZE);
     }
     if (aActiveDataset.mComponents.mIsNetworkNamePresent)
     {
-        cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aActiveDataset.mNetworkName.m8));
+        aWriter.AddString("NetworkName", aActiveDataset.mNetworkName.m8);
     }
     if (aActiveDataset.mComponents.mIsExtendedPanIdPresent)
     {
-        cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aActiveDataset.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE));
+        aWriter.AddHexString("ExtPanId", aActiveDataset.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE);
     }
     if (aActiveDataset.mComponents.mIsMeshLocalPrefixPresent)
     {
-        cJSON_AddItemToObject(node, "MeshLocalPrefix", IpPrefix2Json(aActiveDataset.mMeshLocalPrefix));
+        aWriter.Key("MeshLocalPrefix");
+        IpPrefix2Json(aWriter, aActiveDataset.mMeshLocalPrefix);
     }
     if (aActiveDataset.mComponents.mIsPanIdPresent)
     {
-        cJSON_AddItemToObject(node, "PanId", cJSON_CreateNumber(aActiveDataset.mPanId));
+        aWriter.AddNumber("PanId", aActiveDataset.mPanId);
     }
     if (aActiveDataset.mComponents.mIsChannelPresent)
     {
-        cJSON_AddItemToObject(node, "Channel", cJSON_CreateNumber(aActiveDataset.mChannel));
+        aWriter.AddNumber("Channel", aActiveDataset.mChannel);
     }
     if (aActiveDataset.mComponents.mIsPskcPresent)
     {
-        cJSON_AddItemToObject(node, "PSKc", Bytes2HexJson(aActiveDataset.mPskc.m8, OT_PSKC_MAX_SIZE));
+        aWriter.AddHexString("PSKc", aActiveDataset.mPskc.m8, OT_PSKC_MAX_SIZE);
     }
     if (aActiveDataset.mComponents.mIsSecurityPolicyPresent)
     {
-        cJSON_AddItemToObject(node, "SecurityPolicy", SecurityPolicy2Json(aActiveDataset.mSecurityPolicy));
+        aWriter.Key("SecurityPolicy");
+        SecurityPolicy2Json(aWriter, aActiveDataset.mSecurityPolicy);
     }
     if (aActiveDataset.mComponents.mIsChannelMaskPresent)
     {
-        cJSON_AddItemToObject(node, "ChannelMask", cJSON_CreateNumber(aActiveDataset.mChannelMask));
+        aWriter.AddNumber("ChannelMask", aActiveDataset.mChannelMask);
     }
-
-    return node;
+    aWriter.EndObject();
 }
 
-std::string ActiveDataset2JsonString(const otOperationalDataset &aActiveDataset)
+std::string ActiveDataset2JsonString(const otOperationalDataset &aActiveDataset, const JsonWriter::FieldSet *aFields)
 {
-    cJSON      *node;
-    std::string ret;
-
-    node = ActiveDataset2Json(aActiveDataset);
-    ret  = Json2String(node);
-    cJSON_Delete(node);
-
-    return ret;
+    return Serialize(ActiveDataset2Json, aActiveDataset, aFields);
 }
 
-std::string PendingDataset2JsonString(const otOperationalDataset &aPendingDataset)
+static void PendingDataset2Json(JsonWriter &aWriter, const otOperationalDataset &aPendingDataset)
 {
-    cJSON      *nodeActiveDataset;
-    cJSON      *node = cJSON_CreateObject();
-    std::string ret;
-
-    nodeActiveDataset = ActiveDataset2Json(aPendingDataset);
-    cJSON_AddItemToObject(node, "ActiveDataset", nodeActiveDataset);
+    aWriter.BeginObject();
+    aWriter.Key("ActiveDataset");
+    ActiveDataset2Json(aWriter, aPendingDataset);
     if (aPendingDataset.mComponents.mIsPendingTimestampPresent)
     {
-        cJSON_AddItemToObject(node, "PendingTimestamp", Timestamp2Json(aPendingDataset.mPendingTimestamp));
+        aWriter.Key("PendingTimestamp");
+        Timestamp2Json(aWriter, aPendingDataset.mPendingTimestamp);
     }
     if (aPendingDataset.mComponents.mIsDelayPresent)
     {
-        cJSON_AddItemToObject(node, "Delay", cJSON_CreateNumber(aPendingDataset.mDelay));
+        aWriter.AddNumber("Delay", aPendingDataset.mDelay);
     }
+    aWriter.EndObject();
+}
 
-    ret = Json2String(node);
-    cJSON_Delete(node);
-
-    return ret;
+std::string PendingDataset2JsonString(const otOperationalDataset &aPendingDataset, const JsonWriter::FieldSet *aFields)
+{
+    return Serialize(PendingDataset2Json, aPendingDataset, aFields);
 }
 
 bool JsonActiveDataset2Dataset(const cJSON *jsonActiveDataset, otOperationalDataset &aDataset)
@@ -739,8 +682,8 @@ bool JsonActiveDataset2Dataset(const cJSON *jsonActiveDataset, otOperationalData
     if (cJSON_IsString(value))
     {
         VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aDataset.mNetworkKey.m8,
-                                         OT_NETWORK_KEY_SIZE) == OT_NETWORK_KEY_SIZE,
+        VerifyOrExit(Hex2BytesJsonString(value->valuestring, aDataset.mNetworkKey.m8, OT_NETWORK_KEY_SIZE) ==
+                         OT_NETWORK_KEY_SIZE,
                      ret = false);
         aDataset.mComponents.mIsNetworkKeyPresent = true;
     }
@@ -766,8 +709,8 @@ bool JsonActiveDataset2Dataset(const cJSON *jsonActiveDataset, otOperationalData
     if (cJSON_IsString(value))
     {
         VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aDataset.mExtendedPanId.m8,
-                                         OT_EXT_PAN_ID_SIZE) == OT_EXT_PAN_ID_SIZE,
+        VerifyOrExit(Hex2BytesJsonString(value->valuestring, aDataset.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE) ==
+                         OT_EXT_PAN_ID_SIZE,
                      ret = false);
         aDataset.mComponents.mIsExtendedPanIdPresent = true;
     }
@@ -814,8 +757,7 @@ bool JsonActiveDataset2Dataset(const cJSON *jsonActiveDataset, otOperationalData
     if (cJSON_IsString(value))
     {
         VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aDataset.mPskc.m8, OT_PSKC_MAX_SIZE) ==
-                         OT_PSKC_MAX_SIZE,
+        VerifyOrExit(Hex2BytesJsonString(value->valuestring, aDataset.mPskc.m8, OT_PSKC_MAX_SIZE) == OT_PSKC_MAX_SIZE,
                      ret = false);
         aDataset.mComponents.mIsPskcPresent = true;
     }
@@ -886,8 +828,7 @@ bool JsonPendingDatasetString2Dataset(const std::string &aJsonPendingDataset, ot
         otOperationalDatasetTlvs datasetTlvs;
         int                      len;
 
-        len =
-            Hex2BytesJsonString(std::string(value->valuestring), datasetTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
+        len = Hex2BytesJsonString(value->valuestring, datasetTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
         VerifyOrExit(len > 0, ret = false);
         datasetTlvs.mLength = len;
 
@@ -931,14 +872,13 @@ exit:
     return ret;
 }
 
-cJSON *JoinerInfo2Json(const otJoinerInfo &aJoinerInfo)
+static void JoinerInfo2Json(JsonWriter &aWriter, const otJoinerInfo &aJoinerInfo)
 {
-    cJSON *node = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(node, "Pskd", cJSON_CreateString(aJoinerInfo.mPskd.m8));
+    aWriter.BeginObject();
+    aWriter.AddString("Pskd", aJoinerInfo.mPskd.m8);
     if (aJoinerInfo.mType == OT_JOINER_INFO_TYPE_EUI64)
     {
-        cJSON_AddItemToObject(node, "Eui64", Bytes2HexJson(aJoinerInfo.mSharedId.mEui64.m8, OT_EXT_ADDRESS_SIZE));
+        aWriter.AddHexString("Eui64", aJoinerInfo.mSharedId.mEui64.m8, OT_EXT_ADDRESS_SIZE);
     }
     else if (aJoinerInfo.mType == OT_JOINER_INFO_TYPE_DISCERNER)
     {
@@ -947,27 +887,19 @@ cJSON *JoinerInfo2Json(const otJoinerInfo &aJoinerInfo)
 
         otbr::Utils::Long2Hex(aJoinerInfo.mSharedId.mDiscerner.mValue, hexValue);
         snprintf(string, sizeof(string), "0x%s/%d", hexValue, aJoinerInfo.mSharedId.mDiscerner.mLength);
-        cJSON_AddItemToObject(node, "Discerner", cJSON_CreateString(string));
+        aWriter.AddString("Discerner", string);
     }
     else
     {
-        cJSON_AddItemToObject(node, "JoinerId", cJSON_CreateString("*"));
+        aWriter.AddString("JoinerId", "*");
     }
-    cJSON_AddItemToObject(node, "Timeout", cJSON_CreateNumber(aJoinerInfo.mExpirationTime));
-
-    return node;
+    aWriter.AddNumber("Timeout", aJoinerInfo.mExpirationTime);
+    aWriter.EndObject();
 }
 
 std::string JoinerInfo2JsonString(const otJoinerInfo &aJoinerInfo)
 {
-    cJSON      *node;
-    std::string ret;
-
-    node = JoinerInfo2Json(aJoinerInfo);
-    ret  = Json2String(node);
-    cJSON_Delete(node);
-
-    return ret;
+    return Serialize(JoinerInfo2Json, aJoinerInfo);
 }
 
 otbrError StringDiscerner2Discerner(char *aString, otJoinerDiscerner &aDiscerner)
@@ -990,7 +922,7 @@ otbrError StringDiscerner2Discerner(char *aString, otJoinerDiscerner &aDiscerner
     }
 
     *separator = '\0';
-    byteLength = Hex2BytesJsonString(std::string(aString), byteSwapBuffer, OT_JOINER_MAX_DISCERNER_LENGTH);
+    byteLength = Hex2BytesJsonString(aString, byteSwapBuffer, OT_JOINER_MAX_DISCERNER_LENGTH);
     VerifyOrExit(byteLength <= (1 + ((aDiscerner.mLength - 1) / BITS_PER_BYTE)), error = OTBR_ERROR_INVALID_ARGS);
 
     // The discerner is expected to be big endian
@@ -1033,7 +965,7 @@ bool JsonJoinerInfo2JoinerInfo(const cJSON *jsonJoinerInfo, otJoinerInfo &aJoine
             otbrError err = StringDiscerner2Discerner(value->valuestring, aJoinerInfo.mSharedId.mDiscerner);
             if (err == OTBR_ERROR_NOT_FOUND)
             {
-                VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aJoinerInfo.mSharedId.mEui64.m8,
+                VerifyOrExit(Hex2BytesJsonString(value->valuestring, aJoinerInfo.mSharedId.mEui64.m8,
                                                  OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE);
                 aJoinerInfo.mType = OT_JOINER_INFO_TYPE_EUI64;
             }
@@ -1065,7 +997,7 @@ bool JsonJoinerInfo2JoinerInfo(const cJSON *jsonJoinerInfo, otJoinerInfo &aJoine
         VerifyOrExit(value->valuestring != nullptr);
         if (strncmp(value->valuestring, "*", 1) != 0)
         {
-            VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aJoinerInfo.mSharedId.mEui64.m8,
+            VerifyOrExit(Hex2BytesJsonString(value->valuestring, aJoinerInfo.mSharedId.mEui64.m8,
                                              OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE);
             aJoinerInfo.mType = OT_JOINER_INFO_TYPE_EUI64;
         }
@@ -1099,22 +1031,90 @@ exit:
     return ret;
 }
 
-cJSON *JoinerTable2Json(const std::vector<otJoinerInfo> &aJoinerTable)
+bool JsonJoinerInfoArrayString2JoinerInfos(const std::string &aJsonJoinerInfos, std::vector<otJoinerInfo> &aJoinerInfos)
+{
+    cJSON *jsonJoinerInfos;
+    cJSON *jsonJoinerInfo;
+    bool   ret = true;
+
+    aJoinerInfos.clear();
+
+    VerifyOrExit((jsonJoinerInfos = cJSON_Parse(aJsonJoinerInfos.c_str())) != nullptr, ret = false);
+    VerifyOrExit(cJSON_IsArray(jsonJoinerInfos), ret = false);
+
+    cJSON_ArrayForEach(jsonJoinerInfo, jsonJoinerInfos)
+    {
+        otJoinerInfo joinerInfo;
+
+        VerifyOrExit(cJSON_IsObject(jsonJoinerInfo), ret = false);
+        VerifyOrExit(JsonJoinerInfo2JoinerInfo(jsonJoinerInfo, joinerInfo), ret = false);
+        aJoinerInfos.push_back(joinerInfo);
+    }
+
+exit:
+    cJSON_Delete(jsonJoinerInfos);
+
+    return ret;
+}
+
+bool JsonJoinerIdArrayString2JoinerInfos(const std::string &aJsonJoinerIds, std::vector<otJoinerInfo> &aJoinerInfos)
 {
-    cJSON *table = cJSON_CreateArray();
+    cJSON *jsonJoinerIds;
+    cJSON *jsonJoinerId;
+    bool   ret = true;
 
-    for (const otJoinerInfo joiner : aJoinerTable)
+    aJoinerInfos.clear();
+
+    VerifyOrExit((jsonJoinerIds = cJSON_Parse(aJsonJoinerIds.c_str())) != nullptr, ret = false);
+    VerifyOrExit(cJSON_IsArray(jsonJoinerIds), ret = false);
+
+    cJSON_ArrayForEach(jsonJoinerId, jsonJoinerIds)
     {
-        cJSON *joinerJson = JoinerInfo2Json(joiner);
-        cJSON_AddItemToArray(table, joinerJson);
+        otJoinerInfo joinerInfo;
+        otbrError    error;
+
+        VerifyOrExit(cJSON_IsString(jsonJoinerId) && jsonJoinerId->valuestring != nullptr, ret = false);
+
+        memset(&joinerInfo, 0, sizeof(joinerInfo));
+        joinerInfo.mType = OT_JOINER_INFO_TYPE_ANY;
+        if (strcmp(jsonJoinerId->valuestring, "*") != 0)
+        {
+            error = StringDiscerner2Discerner(jsonJoinerId->valuestring, joinerInfo.mSharedId.mDiscerner);
+            if (error == OTBR_ERROR_NOT_FOUND)
+            {
+                VerifyOrExit(Hex2BytesJsonString(jsonJoinerId->valuestring, joinerInfo.mSharedId.mEui64.m8,
+                                                 OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE,
+                             ret = false);
+                joinerInfo.mType = OT_JOINER_INFO_TYPE_EUI64;
+            }
+            else
+            {
+                VerifyOrExit(error == OTBR_ERROR_NONE, ret = false);
+                joinerInfo.mType = OT_JOINER_INFO_TYPE_DISCERNER;
+            }
+        }
+        aJoinerInfos.push_back(joinerInfo);
     }
 
-    return table;
+exit:
+    cJSON_Delete(jsonJoinerIds);
+
+    return ret;
+}
+
+static void JoinerTable2Json(JsonWriter &aWriter, const std::vector<otJoinerInfo> &aJoinerTable)
+{
+    aWriter.BeginArray();
+    for (const otJoinerInfo &joiner : aJoinerTable)
+    {
+        JoinerInfo2Json(aWriter, joiner);
+    }
+    aWriter.EndArray();
 }
 
-std::string JoinerTable2JsonString(const std::vector<otJoinerInfo> &aJoinerTable)
+std::string JoinerTable2JsonString(const std::vector<otJoinerInfo> &aJoinerTable, const JsonWriter::FieldSet *aFields)
 {
-    return Json2String(JoinerTable2Json(aJoinerTable));
+    return Serialize(JoinerTable2Json, aJoinerTable, aFields);
 }
 
 bool JsonHost2Strings(const cJSON *aJsonHost, std::string &aHostName, std::string &aHostAddress)
@@ -1164,22 +1164,27 @@ exit:
     return ret;
 }
 
-cJSON *Service2Json(const otSrpClientService &aService)
+static void Service2Json(JsonWriter &aWriter, const otSrpClientService &aService)
 {
-    cJSON *node = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(node, "Name", cJSON_CreateString(aService.mName));
-    cJSON_AddItemToObject(node, "InstanceName", cJSON_CreateString(aService.mInstanceName));
-    cJSON_AddItemToObject(node, "Port", cJSON_CreateNumber(aService.mPort));
-    cJSON_AddItemToObject(node, "Priority", cJSON_CreateNumber(aService.mPriority));
-    cJSON_AddItemToObject(node, "Weight", cJSON_CreateNumber(aService.mWeight));
-    cJSON_AddItemToObject(node, "NumTxtEntries", cJSON_CreateNumber(aService.mNumTxtEntries));
-    cJSON_AddItemToObject(node, "State", cJSON_CreateNumber(aService.mState));
-    cJSON_AddItemToObject(node, "Data", cJSON_CreateNumber(aService.mData));
-    cJSON_AddItemToObject(node, "Lease", cJSON_CreateNumber(aService.mLease));
-    cJSON_AddItemToObject(node, "KeyLease", cJSON_CreateNumber(aService.mKeyLease));
-
-    return node;
+    aWriter.BeginObject();
+    // Members with a null name are left out, as they used to be.
+    if (aService.mName != nullptr)
+    {
+        aWriter.AddString("Name", aService.mName);
+    }
+    if (aService.mInstanceName != nullptr)
+    {
+        aWriter.AddString("InstanceName", aService.mInstanceName);
+    }
+    aWriter.AddNumber("Port", aService.mPort);
+    aWriter.AddNumber("Priority", aService.mPriority);
+    aWriter.AddNumber("Weight", aService.mWeight);
+    aWriter.AddNumber("NumTxtEntries", aService.mNumTxtEntries);
+    aWriter.AddNumber("State", aService.mState);
+    aWriter.AddNumber("Data", aService.mData);
+    aWriter.AddNumber("Lease", aService.mLease);
+    aWriter.AddNumber("KeyLease", aService.mKeyLease);
+    aWriter.EndObject();
 }
 
 bool JsonService2Service(const cJSON *aJsonService, otSrpClientBuffersServiceEntry *aServiceEntry)
@@ -1245,6 +1250,53 @@ exit:
     return ret;
 }
 
+otbrError JsonServiceArrayString2ServiceEntries(const std::string                             &aJsonServices,
+                                                otInstance                                    *aInstance,
+                                                std::vector<otSrpClientBuffersServiceEntry *> &aServiceEntries)
+{
+    cJSON    *jsonServices;
+    cJSON    *jsonService;
+    otbrError error = OTBR_ERROR_NONE;
+    int       numServices;
+    size_t    index = 0;
+
+    aServiceEntries.clear();
+
+    VerifyOrExit((jsonServices = cJSON_Parse(aJsonServices.c_str())) != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(cJSON_IsArray(jsonServices), error = OTBR_ERROR_INVALID_ARGS);
+    numServices = cJSON_GetArraySize(jsonServices);
+    VerifyOrExit(numServices > 0, error = OTBR_ERROR_INVALID_ARGS);
+
+    // All the entries are allocated first, so that a batch too large for the buffers is rejected before parsing.
+    for (int i = 0; i < numServices; i++)
+    {
+        otSrpClientBuffersServiceEntry *entry = otSrpClientBuffersAllocateService(aInstance);
+
+        VerifyOrExit(entry != nullptr, error = OTBR_ERROR_ERRNO);
+        aServiceEntries.push_back(entry);
+    }
+
+    cJSON_ArrayForEach(jsonService, jsonServices)
+    {
+        VerifyOrExit(cJSON_IsObject(jsonService), error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(JsonService2Service(jsonService, aServiceEntries[index]), error = OTBR_ERROR_INVALID_ARGS);
+        index++;
+    }
+
+exit:
+    cJSON_Delete(jsonServices);
+    if (error != OTBR_ERROR_NONE)
+    {
+        for (otSrpClientBuffersServiceEntry *entry : aServiceEntries)
+        {
+            otSrpClientBuffersFreeService(aInstance, entry);
+        }
+        aServiceEntries.clear();
+    }
+
+    return error;
+}
+
 bool JsonServiceString2NameStrings(const std::string &aJsonService,
                                    std::string       &aServiceName,
                                    std::string       &aInstanceName)
@@ -1286,52 +1338,361 @@ exit:
     return ret;
 }
 
-cJSON *Services2Json(const std::vector<otSrpClientService> &aServices)
+static void Services2Json(JsonWriter &aWriter, const std::vector<otSrpClientService> &aServices)
 {
-    cJSON *list = cJSON_CreateArray();
-    for (const otSrpClientService service : aServices)
+    aWriter.BeginArray();
+    for (const otSrpClientService &service : aServices)
     {
-        cJSON *serviceJson = Service2Json(service);
-        cJSON_AddItemToArray(list, serviceJson);
+        Service2Json(aWriter, service);
     }
-
-    return list;
+    aWriter.EndArray();
 }
 
 std::string Services2JsonString(const std::vector<otSrpClientService> &aServices)
 {
-    return Json2String(Services2Json(aServices));
+    return Serialize(Services2Json, aServices);
 }
 
-cJSON *HostInfo2Json(const otSrpClientHostInfo &aHostInfo)
+static void HostInfo2Json(JsonWriter &aWriter, const otSrpClientHostInfo &aHostInfo)
 {
-    cJSON *node = cJSON_CreateObject();
+    aWriter.BeginObject();
+    aWriter.AddString("Name", (aHostInfo.mName == NULL) ? "" : aHostInfo.mName);
+    aWriter.AddString("State", GetSrpClientItemStateName(aHostInfo.mState).c_str());
 
-    if (aHostInfo.mName == NULL)
+    aWriter.Key("Addresses");
+    aWriter.BeginArray();
+    for (uint8_t i = 0; i < aHostInfo.mNumAddresses; i++)
     {
-        cJSON_AddItemToObject(node, "Name", cJSON_CreateString(""));
+        char string[OT_IP6_ADDRESS_STRING_SIZE];
+        otIp6AddressToString(&aHostInfo.mAddresses[i], string, OT_IP6_ADDRESS_STRING_SIZE);
+        aWriter.String(string);
     }
-    else
+    aWriter.EndArray();
+
+    aWriter.EndObject();
+}
+
+std::string HostInfo2JsonString(const otSrpClientHostInfo &aHostInfo)
+{
+    return Serialize(HostInfo2Json, aHostInfo);
+}
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+static void SrpServerService2Json(JsonWriter &aWriter, const agent::SrpServerHostPage::Service &aService)
+{
+    aWriter.BeginObject();
+    aWriter.AddString("FullName", aService.mFullName.c_str());
+    aWriter.AddBool("Deleted", aService.mDeleted);
+    aWriter.AddNumber("Port", aService.mPort);
+    aWriter.AddNumber("Priority", aService.mPriority);
+    aWriter.AddNumber("Weight", aService.mWeight);
+    aWriter.AddNumber("LeaseMs", aService.mLease);
+    aWriter.AddNumber("KeyLeaseMs", aService.mKeyLease);
+    aWriter.AddNumber("RemainingLeaseMs", aService.mRemainingLease);
+    aWriter.AddNumber("RemainingKeyLeaseMs", aService.mRemainingKeyLease);
+    aWriter.EndObject();
+}
+
+static void SrpServerHost2Json(JsonWriter &aWriter, const agent::SrpServerHostPage::Host &aHost)
+{
+    aWriter.BeginObject();
+    aWriter.AddString("FullName", aHost.mFullName.c_str());
+    aWriter.AddBool("Deleted", aHost.mDeleted);
+
+    aWriter.Key("Addresses");
+    aWriter.BeginArray();
+    for (const Ip6Address &address : aHost.mAddresses)
     {
-        cJSON_AddItemToObject(node, "Name", cJSON_CreateString(aHostInfo.mName));
+        aWriter.String(address.ToString());
     }
-    cJSON_AddItemToObject(node, "State", cJSON_CreateString(GetSrpClientItemStateName(aHostInfo.mState).c_str()));
+    aWriter.EndArray();
 
-    cJSON *addressNode = cJSON_CreateArray();
-    for (uint8_t i = 0; i < aHostInfo.mNumAddresses; i++)
+    aWriter.AddNumber("LeaseMs", aHost.mLease);
+    aWriter.AddNumber("KeyLeaseMs", aHost.mKeyLease);
+    aWriter.AddNumber("RemainingLeaseMs", aHost.mRemainingLease);
+    aWriter.AddNumber("RemainingKeyLeaseMs", aHost.mRemainingKeyLease);
+
+    aWriter.Key("Services");
+    aWriter.BeginArray();
+    for (const agent::SrpServerHostPage::Service &service : aHost.mServices)
     {
-        char string[OT_IP6_ADDRESS_STRING_SIZE];
-        otIp6AddressToString(&aHostInfo.mAddresses[i], string, OT_IP6_ADDRESS_STRING_SIZE);
-        cJSON_AddItemToArray(addressNode, cJSON_CreateString(string));
+        SrpServerService2Json(aWriter, service);
     }
-    cJSON_AddItemToObject(node, "Addresses", addressNode);
+    aWriter.EndArray();
 
-    return node;
+    aWriter.EndObject();
 }
 
-std::string HostInfo2JsonString(const otSrpClientHostInfo &aHostInfo)
+std::string SrpServerHostPage2JsonString(const std::vector<agent::SrpServerHostPage::Host> &aHosts,
+                                         const std::string                                 &aNextCursor)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    writer.BeginObject();
+
+    writer.Key("Hosts");
+    writer.BeginArray();
+    for (const agent::SrpServerHostPage::Host &host : aHosts)
+    {
+        SrpServerHost2Json(writer, host);
+    }
+    writer.EndArray();
+
+    writer.AddString("NextCursor", aNextCursor.c_str());
+    writer.EndObject();
+
+    return ret;
+}
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+static void MainloopHistogram2Json(JsonWriter &aWriter, const MainloopHistogram &aHistogram)
+{
+    aWriter.BeginObject();
+    aWriter.AddNumber("Count", aHistogram.GetCount());
+    aWriter.AddNumber("SumUs", aHistogram.GetSum());
+    aWriter.AddNumber("MaxUs", aHistogram.GetMax());
+
+    aWriter.Key("Buckets");
+    aWriter.BeginArray();
+    for (uint8_t i = 0; i < MainloopHistogram::kNumBuckets; i++)
+    {
+        aWriter.Number(aHistogram.GetBucketCount(i));
+    }
+    aWriter.EndArray();
+
+    aWriter.EndObject();
+}
+
+static void MainloopStats2Json(JsonWriter &aWriter, const MainloopManager &aMainloopManager)
+{
+    aWriter.BeginObject();
+    aWriter.AddNumber("Iterations", aMainloopManager.GetIterationCount());
+
+    aWriter.Key("Processors");
+    aWriter.BeginObject();
+    for (const auto &entry : aMainloopManager.GetProcessorStats())
+    {
+        const MainloopProcessorStats &processorStats = entry.second;
+
+        aWriter.Key(entry.first.c_str());
+        aWriter.BeginObject();
+        aWriter.Key("UpdateDuration");
+        MainloopHistogram2Json(aWriter, processorStats.mUpdateDuration);
+        aWriter.Key("ProcessDuration");
+        MainloopHistogram2Json(aWriter, processorStats.mProcessDuration);
+        aWriter.Key("Timeout");
+        MainloopHistogram2Json(aWriter, processorStats.mTimeout);
+        aWriter.AddNumber("ReadyFds", processorStats.mReadyFdCount);
+        aWriter.AddNumber("TimeoutShortened", processorStats.mTimeoutShortenedCount);
+        aWriter.EndObject();
+    }
+    aWriter.EndObject();
+
+    aWriter.EndObject();
+}
+
+std::string MainloopStats2JsonString(const MainloopManager &aMainloopManager)
+{
+    return Serialize(MainloopStats2Json, aMainloopManager);
+}
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
+static void MemoryStats2Json(JsonWriter &aWriter, const MemoryStats &aMemoryStats)
 {
-    return Json2String(HostInfo2Json(aHostInfo));
+    MemoryStats::HeapUsage heapUsage = MemoryStats::GetHeapUsage();
+
+    aWriter.BeginObject();
+
+    aWriter.Key("Counters");
+    aWriter.BeginObject();
+    for (const auto &entry : aMemoryStats.GetCounters())
+    {
+        aWriter.AddNumber(entry.first.c_str(), entry.second);
+    }
+    aWriter.EndObject();
+
+    aWriter.AddNumber("ResidentBytes", heapUsage.mResidentBytes);
+    aWriter.AddNumber("HeapInUseBytes", heapUsage.mInUseBytes);
+    aWriter.AddNumber("HeapFreeBytes", heapUsage.mFreeBytes);
+    aWriter.AddNumber("HeapMmappedBytes", heapUsage.mMmappedBytes);
+
+    aWriter.EndObject();
+}
+
+std::string MemoryStats2JsonString(const MemoryStats &aMemoryStats)
+{
+    return Serialize(MemoryStats2Json, aMemoryStats);
+}
+
+std::string NeighborTableChanges2JsonString(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                            uint32_t                                                aGeneration)
+{
+    static const char *const kChangeTypeNames[] = {"added", "removed", "updated"};
+
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    writer.BeginObject();
+    writer.AddNumber("Generation", aGeneration);
+    writer.Key("Changes");
+    writer.BeginArray();
+    for (const agent::NeighborTableTracker::Change &change : aChanges)
+    {
+        otLinkModeConfig mode;
+
+        mode.mRxOnWhenIdle = change.mEntry.mRxOnWhenIdle;
+        mode.mDeviceType   = change.mEntry.mFullThreadDevice;
+        mode.mNetworkData  = change.mEntry.mFullNetworkData;
+
+        writer.BeginObject();
+        writer.AddString("Type", kChangeTypeNames[change.mType]);
+        writer.AddHexString("ExtAddress", change.mEntry.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+        writer.AddNumber("Rloc16", change.mEntry.mRloc16);
+        writer.AddBool("IsChild", change.mEntry.mIsChild);
+        writer.Key("Mode");
+        Mode2Json(writer, mode);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    return ret;
+}
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+static void LinkMetricsPercentiles2Json(JsonWriter                        &aWriter,
+                                        const agent::LinkMetricsHistory   &aHistory,
+                                        agent::LinkMetricsHistory::Metric  aMetric)
+{
+    aWriter.BeginObject();
+    aWriter.AddNumber("P10", aHistory.GetPercentile(aMetric, 10));
+    aWriter.AddNumber("P50", aHistory.GetPercentile(aMetric, 50));
+    aWriter.AddNumber("P90", aHistory.GetPercentile(aMetric, 90));
+    aWriter.EndObject();
+}
+
+static void LinkMetricsHistories2Json(JsonWriter                                                    &aWriter,
+                                      const std::vector<agent::LinkMetricsSampler::NeighborHistory> &aNeighbors)
+{
+    aWriter.BeginArray();
+    for (const agent::LinkMetricsSampler::NeighborHistory &neighbor : aNeighbors)
+    {
+        aWriter.BeginObject();
+        aWriter.AddHexString("ExtAddress", neighbor.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+        aWriter.AddNumber("Rloc16", neighbor.mRloc16);
+        aWriter.AddNumber("Samples", neighbor.mHistory.GetSampleCount());
+        aWriter.Key("Rssi");
+        LinkMetricsPercentiles2Json(aWriter, neighbor.mHistory, agent::LinkMetricsHistory::kRssi);
+        aWriter.Key("Lqi");
+        LinkMetricsPercentiles2Json(aWriter, neighbor.mHistory, agent::LinkMetricsHistory::kLqi);
+        aWriter.Key("LinkMargin");
+        LinkMetricsPercentiles2Json(aWriter, neighbor.mHistory, agent::LinkMetricsHistory::kLinkMargin);
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+}
+
+std::string LinkMetricsHistories2JsonString(const std::vector<agent::LinkMetricsSampler::NeighborHistory> &aNeighbors)
+{
+    return Serialize(LinkMetricsHistories2Json, aNeighbors);
+}
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
+
+static void ChannelQualityHistory2Json(JsonWriter                         &aWriter,
+                                       const agent::ChannelQualityHistory &aHistory,
+                                       uint32_t                            aChannelMask)
+{
+    aWriter.BeginObject();
+    aWriter.AddNumber("Samples", aHistory.GetSampleCount());
+    aWriter.AddNumber("RecommendedChannel", aHistory.GetRecommendedChannel(aChannelMask));
+    aWriter.Key("Channels");
+    aWriter.BeginArray();
+    for (uint8_t i = 0; i < agent::ChannelQualityHistory::kNumChannels; i++)
+    {
+        uint8_t channel = agent::ChannelQualityHistory::kFirstChannel + i;
+
+        if ((aChannelMask & (1U << channel)) == 0)
+        {
+            continue;
+        }
+        aWriter.BeginObject();
+        aWriter.AddNumber("Channel", channel);
+        aWriter.AddNumber("AverageOccupancy", aHistory.GetAverageOccupancy(channel));
+        aWriter.AddNumber("OccupancyDeviation", aHistory.GetOccupancyDeviation(channel));
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
+
+std::string ChannelQualityHistory2JsonString(const agent::ChannelQualityHistory &aHistory, uint32_t aChannelMask)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    ChannelQualityHistory2Json(writer, aHistory, aChannelMask);
+
+    return ret;
+}
+
+static void RadioCoexHistory2Json(JsonWriter &aWriter, const agent::RadioCoexHistory &aHistory)
+{
+    // The names of the counters in the order of `agent::RadioCoexHistory::Counter`.
+    static const char *const kCounterNames[agent::RadioCoexHistory::kNumCounters] = {
+        "GrantGlitch",
+        "TxRequest",
+        "TxGrantImmediate",
+        "TxGrantWait",
+        "TxGrantWaitActivated",
+        "TxGrantWaitTimeout",
+        "TxGrantDeactivatedDuringRequest",
+        "TxDelayedGrant",
+        "RxRequest",
+        "RxGrantImmediate",
+        "RxGrantWait",
+        "RxGrantWaitActivated",
+        "RxGrantWaitTimeout",
+        "RxGrantDeactivatedDuringRequest",
+        "RxDelayedGrant",
+        "RxGrantNone",
+    };
+
+    const otRadioCoexMetrics &metrics = aHistory.GetMetrics();
+
+    aWriter.BeginObject();
+    aWriter.AddNumber("Intervals", aHistory.GetIntervalCount());
+    aWriter.AddNumber("Duration", static_cast<double>(aHistory.GetDuration().count()));
+    aWriter.AddBool("Stopped", metrics.mStopped);
+    aWriter.AddNumber("AvgTxRequestToGrantTime", metrics.mAvgTxRequestToGrantTime);
+    aWriter.AddNumber("AvgRxRequestToGrantTime", metrics.mAvgRxRequestToGrantTime);
+    aWriter.Key("Counters");
+    aWriter.BeginObject();
+    for (uint8_t i = 0; i < agent::RadioCoexHistory::kNumCounters; i++)
+    {
+        agent::RadioCoexHistory::Counter counter = static_cast<agent::RadioCoexHistory::Counter>(i);
+
+        aWriter.Key(kCounterNames[i]);
+        aWriter.BeginObject();
+        aWriter.AddNumber("Total", aHistory.GetTotal(counter));
+        aWriter.AddNumber("Increment", static_cast<double>(aHistory.GetIncrement(counter)));
+        aWriter.AddNumber("LatestIncrement", aHistory.GetLatestIncrement(counter));
+        aWriter.AddNumber("RatePerMinute", aHistory.GetRatePerMinute(counter));
+        aWriter.EndObject();
+    }
+    aWriter.EndObject();
+    aWriter.EndObject();
+}
+
+std::string RadioCoexHistory2JsonString(const agent::RadioCoexHistory &aHistory)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    RadioCoexHistory2Json(writer, aHistory);
+
+    return ret;
 }
 
 } // namespace Json
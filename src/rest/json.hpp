@@ -42,9 +42,19 @@
 #include "openthread/srp_client_buffers.h"
 #include "openthread/thread_ftd.h"
 
+#include "common/mainloop_manager.hpp"
+#include "common/memory_stats.hpp"
 #include "common/types.hpp"
+#include "rest/json_writer.hpp"
 #include "rest/types.hpp"
+#include "utils/channel_quality_history.hpp"
 #include "utils/hex.hpp"
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+#include "utils/link_metrics_sampler.hpp"
+#endif
+#include "utils/neighbor_table_tracker.hpp"
+#include "utils/radio_coex_sampler.hpp"
+#include "utils/srp_server_host_page.hpp"
 
 namespace otbr {
 namespace rest {
@@ -88,6 +98,18 @@ std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength);
  */
 int Hex2BytesJsonString(const std::string &aHexString, uint8_t *aBytes, uint8_t aMaxLength);
 
+/**
+ * This method parses a null-terminated hex string as byte array, without copying it.
+ *
+ * @param[in] aHexString String of bytes in hex.
+ * @param[in] aBytes     Byte array to write to. Must be at least  @p aMaxLength.
+ * @param[in] aMaxLength Maximum length to parse (in bytes).
+ *
+ * @returns Number of bytes effectively parsed.
+ *
+ */
+int Hex2BytesJsonString(const char *aHexString, uint8_t *aBytes, uint8_t aMaxLength);
+
 /**
  * This method formats a C string to a Json string and serialize it to a string.
  *
@@ -138,6 +160,27 @@ std::string Node2JsonString(const NodeInfo &aNode);
  */
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
 
+/**
+ * This method formats the diagnostic TLVs of a node to a Json object and serialize it to a string.
+ *
+ * @param[in] aDiagTlvs  A vector of diagnostic TLVs of a node.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string NodeDiag2JsonString(const std::vector<otNetworkDiagTlv> &aDiagTlvs);
+
+/**
+ * This method finds the type of the diagnostic TLV formatted to a Json field.
+ *
+ * @param[in]  aField    The name of the Json field, such as "Rloc16".
+ * @param[out] aTlvType  The type of the diagnostic TLV.
+ *
+ * @returns If the field is the one of a diagnostic TLV.
+ *
+ */
+bool DiagField2TlvType(const std::string &aField, uint8_t &aTlvType);
+
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
  *
@@ -233,21 +276,25 @@ std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessag
  * This method formats a Json object from an active dataset.
  *
  * @param[in] aDataset  A dataset struct.
+ * @param[in] aFields   A pointer to the names of the fields to format, nullptr to format all the fields.
  *
  * @returns A string of serialized Json object.
  *
  */
-std::string ActiveDataset2JsonString(const otOperationalDataset &aDataset);
+std::string ActiveDataset2JsonString(const otOperationalDataset &aDataset,
+                                     const JsonWriter::FieldSet *aFields = nullptr);
 
 /**
  * This method formats a Json object from a pending dataset.
  *
  * @param[in] aDataset  A dataset struct.
+ * @param[in] aFields   A pointer to the names of the fields to format, nullptr to format all the fields.
  *
  * @returns A string of serialized Json object.
  *
  */
-std::string PendingDataset2JsonString(const otOperationalDataset &aPendingDataset);
+std::string PendingDataset2JsonString(const otOperationalDataset &aPendingDataset,
+                                      const JsonWriter::FieldSet *aFields = nullptr);
 
 /**
  * This method parses a Json string and fills the provided dataset. Fields
@@ -281,12 +328,56 @@ otbrError StringDiscerner2Discerner(char *aString, otJoinerDiscerner &aDiscerner
 
 bool JsonJoinerInfoString2JoinerInfo(const std::string &aJsonJoinerInfo, otJoinerInfo &aJoinerInfo);
 
-std::string JoinerTable2JsonString(const std::vector<otJoinerInfo> &aJoinerTable);
+/**
+ * This method parses a Json array of joiners.
+ *
+ * @param[in]  aJsonJoinerInfos  The Json string to be parsed.
+ * @param[out] aJoinerInfos      The joiners, each in the format of `JsonJoinerInfoString2JoinerInfo`.
+ *
+ * @returns If the Json string has been successfully parsed.
+ *
+ */
+bool JsonJoinerInfoArrayString2JoinerInfos(const std::string         &aJsonJoinerInfos,
+                                           std::vector<otJoinerInfo> &aJoinerInfos);
+
+/**
+ * This method parses a Json array of joiner ids, each either "*", an EUI-64 hex string or a discerner.
+ *
+ * @param[in]  aJsonJoinerIds  The Json string to be parsed.
+ * @param[out] aJoinerInfos    The joiners, only the type and the id of which are set.
+ *
+ * @returns If the Json string has been successfully parsed.
+ *
+ */
+bool JsonJoinerIdArrayString2JoinerInfos(const std::string &aJsonJoinerIds, std::vector<otJoinerInfo> &aJoinerInfos);
+
+std::string JoinerTable2JsonString(const std::vector<otJoinerInfo> &aJoinerTable,
+                                   const JsonWriter::FieldSet      *aFields = nullptr);
 
 bool jsonHostString2Strings(const std::string &aJsonHost, std::string &aHostName, std::string &aHostAddress);
 
 bool JsonServiceString2ServiceEntry(const std::string &aJsonService, otSrpClientBuffersServiceEntry *aServiceEntry);
 
+/**
+ * This method parses a Json array of SRP services into service entries allocated from the SRP client buffers.
+ *
+ * The entries of all the services are allocated before any is parsed. On failure, all the allocated entries are
+ * freed.
+ *
+ * @param[in]  aJsonServices    The Json string to be parsed, each service in the format of
+ *                              `JsonServiceString2ServiceEntry`.
+ * @param[in]  aInstance        The OpenThread instance to allocate the entries from.
+ * @param[out] aServiceEntries  The service entries, owned by the caller on success.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully parsed the services.
+ * @retval OTBR_ERROR_INVALID_ARGS  The Json string is not a valid array of services.
+ * @retval OTBR_ERROR_ERRNO         The SRP client buffers have no room for all the services.
+ *
+ */
+otbrError JsonServiceArrayString2ServiceEntries(const std::string                             &aJsonServices,
+                                                otInstance                                    *aInstance,
+                                                std::vector<otSrpClientBuffersServiceEntry *> &aServiceEntries);
+
 bool JsonServiceString2NameStrings(const std::string &aJsonService,
                                    std::string       &aServiceName,
                                    std::string       &aInstanceName);
@@ -295,6 +386,87 @@ std::string Services2JsonString(const std::vector<otSrpClientService> &aServices
 
 std::string HostInfo2JsonString(const otSrpClientHostInfo &aHostInfo);
 
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+/**
+ * This method formats a page of the SRP server hosts to a Json string.
+ *
+ * @param[in] aHosts       The hosts of the page.
+ * @param[in] aNextCursor  The cursor of the next page, or empty if this is the last page.
+ *
+ * @returns A string of the page in Json format.
+ *
+ */
+std::string SrpServerHostPage2JsonString(const std::vector<agent::SrpServerHostPage::Host> &aHosts,
+                                         const std::string                                 &aNextCursor);
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+/**
+ * This method formats the mainloop statistics of a mainloop manager to a Json string.
+ *
+ * @param[in] aMainloopManager  A reference to the mainloop manager.
+ *
+ * @returns A string of the mainloop statistics in Json format.
+ *
+ */
+std::string MainloopStats2JsonString(const MainloopManager &aMainloopManager);
+#endif
+
+/**
+ * This method formats the memory statistics to a Json string.
+ *
+ * @param[in] aMemoryStats  A reference to the memory statistics.
+ *
+ * @returns A string of the memory statistics in Json format.
+ *
+ */
+std::string MemoryStats2JsonString(const MemoryStats &aMemoryStats);
+
+/**
+ * This method formats the changes of the neighbor table to a Json string.
+ *
+ * @param[in] aChanges     A reference to the changes of the neighbor table.
+ * @param[in] aGeneration  The generation of the neighbor table after the changes.
+ *
+ * @returns A string of the changes in Json format.
+ *
+ */
+std::string NeighborTableChanges2JsonString(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                            uint32_t                                                aGeneration);
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+/**
+ * This method formats the link metrics histories of the neighbor routers to a Json string.
+ *
+ * @param[in] aNeighbors  A reference to the link metrics histories of the neighbor routers.
+ *
+ * @returns A string of the link metrics percentiles in Json format.
+ *
+ */
+std::string LinkMetricsHistories2JsonString(const std::vector<agent::LinkMetricsSampler::NeighborHistory> &aNeighbors);
+#endif
+
+/**
+ * This method formats the history of the channel qualities to a Json string.
+ *
+ * @param[in] aHistory      A reference to the history of the channel qualities.
+ * @param[in] aChannelMask  The mask of the supported channels, bit N for channel N.
+ *
+ * @returns A string of the channel occupancy statistics and the recommended channel in Json format.
+ *
+ */
+std::string ChannelQualityHistory2JsonString(const agent::ChannelQualityHistory &aHistory, uint32_t aChannelMask);
+
+/**
+ * This method formats the radio coex metrics and their history to a Json string.
+ *
+ * @param[in] aHistory  A reference to the history of the radio coex metrics.
+ *
+ * @returns A string of the cumulative counters, with their increments and rates over the history, in Json format.
+ *
+ */
+std::string RadioCoexHistory2JsonString(const agent::RadioCoexHistory &aHistory);
+
 }; // namespace Json
 
 } // namespace rest
@@ -0,0 +1,348 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the streaming Json writer for RESTful HTTP server.
+ */
+
+#include "rest/json_writer.hpp"
+
+#include <assert.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "common/code_utils.hpp"
+#include "utils/hex.hpp"
+
+namespace otbr {
+namespace rest {
+
+JsonWriter::JsonWriter(std::string &aOutput)
+    : mOutput(aOutput)
+    , mDepth(0)
+    , mFields(nullptr)
+    , mSkipDepth(0)
+{
+}
+
+bool JsonWriter::SkipValue(void)
+{
+    bool skip = IsSkipping();
+
+    // A value at the depth of the dropped member is the whole value of the member.
+    if (skip && mDepth == mSkipDepth)
+    {
+        mSkipDepth = 0;
+    }
+
+    return skip;
+}
+
+void JsonWriter::BeginValue(void)
+{
+    if (mDepth > 0)
+    {
+        Scope &scope = mScopes[mDepth - 1];
+
+        // Object members are separated in `Key()`.
+        if (scope.mIsArray)
+        {
+            if (!scope.mIsEmpty)
+            {
+                mOutput += ", ";
+            }
+            scope.mIsEmpty = false;
+        }
+    }
+}
+
+void JsonWriter::BeginScope(bool aIsArray)
+{
+    bool isFiltered = (mFields != nullptr) && !aIsArray;
+
+    assert(mDepth < kMaxDepth);
+
+    for (uint8_t i = 0; i < mDepth && isFiltered; i++)
+    {
+        isFiltered = mScopes[i].mIsArray;
+    }
+
+    if (!IsSkipping())
+    {
+        BeginValue();
+    }
+    mScopes[mDepth].mIsArray    = aIsArray;
+    mScopes[mDepth].mIsEmpty    = true;
+    mScopes[mDepth].mIsFiltered = isFiltered;
+    mDepth++;
+}
+
+void JsonWriter::WriteIndent(uint8_t aDepth)
+{
+    mOutput.append(aDepth, '\t');
+}
+
+void JsonWriter::BeginObject(void)
+{
+    BeginScope(/* aIsArray */ false);
+    VerifyOrExit(!IsSkipping());
+    mOutput += "{\n";
+
+exit:
+    return;
+}
+
+void JsonWriter::EndObject(void)
+{
+    assert(mDepth > 0 && !mScopes[mDepth - 1].mIsArray);
+
+    if (IsSkipping())
+    {
+        mDepth--;
+        SkipValue();
+        ExitNow();
+    }
+
+    if (!mScopes[mDepth - 1].mIsEmpty)
+    {
+        mOutput += '\n';
+    }
+    mDepth--;
+    WriteIndent(mDepth);
+    mOutput += '}';
+
+exit:
+    return;
+}
+
+void JsonWriter::BeginArray(void)
+{
+    BeginScope(/* aIsArray */ true);
+    VerifyOrExit(!IsSkipping());
+    mOutput += '[';
+
+exit:
+    return;
+}
+
+void JsonWriter::EndArray(void)
+{
+    assert(mDepth > 0 && mScopes[mDepth - 1].mIsArray);
+
+    mDepth--;
+    VerifyOrExit(!SkipValue());
+    mOutput += ']';
+
+exit:
+    return;
+}
+
+void JsonWriter::Key(const char *aKey)
+{
+    assert(mDepth > 0 && !mScopes[mDepth - 1].mIsArray);
+
+    VerifyOrExit(!IsSkipping());
+
+    if (mScopes[mDepth - 1].mIsFiltered && mFields->find(aKey) == mFields->end())
+    {
+        // The value of this member is dropped as well.
+        mSkipDepth = mDepth;
+        ExitNow();
+    }
+
+    if (!mScopes[mDepth - 1].mIsEmpty)
+    {
+        mOutput += ",\n";
+    }
+    mScopes[mDepth - 1].mIsEmpty = false;
+
+    WriteIndent(mDepth);
+    WriteEscaped(aKey);
+    mOutput += ":\t";
+
+exit:
+    return;
+}
+
+void JsonWriter::WriteEscaped(const char *aString)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+    const char       *start        = aString;
+
+    mOutput += '"';
+
+    for (const char *cur = aString; *cur != '\0'; cur++)
+    {
+        uint8_t c = static_cast<uint8_t>(*cur);
+        char    escaped;
+
+        if (c >= 32 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        mOutput.append(start, cur);
+        start = cur + 1;
+        mOutput += '\\';
+
+        switch (c)
+        {
+        case '"':
+        case '\\':
+            escaped = static_cast<char>(c);
+            break;
+        case '\b':
+            escaped = 'b';
+            break;
+        case '\f':
+            escaped = 'f';
+            break;
+        case '\n':
+            escaped = 'n';
+            break;
+        case '\r':
+            escaped = 'r';
+            break;
+        case '\t':
+            escaped = 't';
+            break;
+        default:
+            mOutput += "u00";
+            mOutput += kHexDigits[c >> 4];
+            escaped = kHexDigits[c & 0x0f];
+            break;
+        }
+
+        mOutput += escaped;
+    }
+
+    mOutput.append(start);
+    mOutput += '"';
+}
+
+void JsonWriter::String(const char *aString)
+{
+    VerifyOrExit(!SkipValue());
+    BeginValue();
+    WriteEscaped(aString);
+
+exit:
+    return;
+}
+
+void JsonWriter::HexString(const uint8_t *aBytes, uint16_t aLength)
+{
+    size_t offset;
+
+    VerifyOrExit(!SkipValue());
+    BeginValue();
+    mOutput += '"';
+    offset = mOutput.size();
+    mOutput.resize(offset + 2 * aLength);
+    Utils::Bytes2Hex(aBytes, aLength, &mOutput[0] + offset, Utils::HexCase::kUpper);
+    mOutput += '"';
+
+exit:
+    return;
+}
+
+void JsonWriter::Number(double aNumber)
+{
+    // Numbers are printed the same way as cJSON does: integral values which fit in an `int` are printed as integer,
+    // other values with the shortest of 15 or 17 significant digits which parses back to the same value.
+    char   buffer[26];
+    int    integer;
+    double parsed;
+
+    VerifyOrExit(!SkipValue());
+    BeginValue();
+
+    if (isnan(aNumber) || isinf(aNumber))
+    {
+        mOutput += "null";
+        ExitNow();
+    }
+
+    if (aNumber >= INT_MAX)
+    {
+        integer = INT_MAX;
+    }
+    else if (aNumber <= static_cast<double>(INT_MIN))
+    {
+        integer = INT_MIN;
+    }
+    else
+    {
+        integer = static_cast<int>(aNumber);
+    }
+
+    if (aNumber == static_cast<double>(integer))
+    {
+        snprintf(buffer, sizeof(buffer), "%d", integer);
+    }
+    else
+    {
+        snprintf(buffer, sizeof(buffer), "%1.15g", aNumber);
+        if (sscanf(buffer, "%lg", &parsed) != 1 ||
+            fabs(parsed - aNumber) > fmax(fabs(parsed), fabs(aNumber)) * DBL_EPSILON)
+        {
+            snprintf(buffer, sizeof(buffer), "%1.17g", aNumber);
+        }
+    }
+
+    mOutput += buffer;
+
+exit:
+    return;
+}
+
+void JsonWriter::Bool(bool aValue)
+{
+    VerifyOrExit(!SkipValue());
+    BeginValue();
+    mOutput += aValue ? "true" : "false";
+
+exit:
+    return;
+}
+
+void JsonWriter::Null(void)
+{
+    VerifyOrExit(!SkipValue());
+    BeginValue();
+    mOutput += "null";
+
+exit:
+    return;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,241 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes a streaming Json writer for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_JSON_WRITER_HPP_
+#define OTBR_REST_JSON_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <set>
+#include <stdint.h>
+#include <string>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a streaming Json writer.
+ *
+ * The values are appended to the output buffer as they are written, no document tree is built. The output is
+ * formatted the same way as `cJSON_Print()` so that the serialized strings stay compatible with existing clients.
+ *
+ */
+class JsonWriter
+{
+public:
+    /**
+     * This type represents the names of the fields to write.
+     *
+     */
+    using FieldSet = std::set<std::string, std::less<>>;
+
+    /**
+     * The constructor to initialize a Json writer.
+     *
+     * @param[in] aOutput  A reference to the buffer the Json text is appended to.
+     *
+     */
+    explicit JsonWriter(std::string &aOutput);
+
+    /**
+     * This method restricts the members of the outermost objects to some fields.
+     *
+     * The outermost objects are the objects which are not nested in another object, such as the elements of a top
+     * level array. The values of the other members are dropped without being formatted.
+     *
+     * @param[in] aFields  A pointer to the names of the fields to write, nullptr to write all the fields.
+     *
+     */
+    void SetFieldFilter(const FieldSet *aFields) { mFields = aFields; }
+
+    /**
+     * This method starts an object.
+     *
+     */
+    void BeginObject(void);
+
+    /**
+     * This method ends the current object.
+     *
+     */
+    void EndObject(void);
+
+    /**
+     * This method starts an array.
+     *
+     */
+    void BeginArray(void);
+
+    /**
+     * This method ends the current array.
+     *
+     */
+    void EndArray(void);
+
+    /**
+     * This method writes the key of the next member of the current object.
+     *
+     * @param[in] aKey  A pointer to the null-terminated key.
+     *
+     */
+    void Key(const char *aKey);
+
+    /**
+     * This method writes a string value.
+     *
+     * @param[in] aString  A pointer to the null-terminated string.
+     *
+     */
+    void String(const char *aString);
+
+    /**
+     * This method writes a string value.
+     *
+     * @param[in] aString  A reference to the string.
+     *
+     */
+    void String(const std::string &aString) { String(aString.c_str()); }
+
+    /**
+     * This method writes a string value holding the hex representation of a byte array.
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     */
+    void HexString(const uint8_t *aBytes, uint16_t aLength);
+
+    /**
+     * This method writes a number value.
+     *
+     * @param[in] aNumber  The number.
+     *
+     */
+    void Number(double aNumber);
+
+    /**
+     * This method writes a boolean value.
+     *
+     * @param[in] aValue  The boolean.
+     *
+     */
+    void Bool(bool aValue);
+
+    /**
+     * This method writes a null value.
+     *
+     */
+    void Null(void);
+
+    /**
+     * This method writes a string member of the current object.
+     *
+     * @param[in] aKey     A pointer to the null-terminated key.
+     * @param[in] aString  A pointer to the null-terminated string.
+     *
+     */
+    void AddString(const char *aKey, const char *aString)
+    {
+        Key(aKey);
+        String(aString);
+    }
+
+    /**
+     * This method writes a hex string member of the current object.
+     *
+     * @param[in] aKey     A pointer to the null-terminated key.
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     */
+    void AddHexString(const char *aKey, const uint8_t *aBytes, uint16_t aLength)
+    {
+        Key(aKey);
+        HexString(aBytes, aLength);
+    }
+
+    /**
+     * This method writes a number member of the current object.
+     *
+     * @param[in] aKey     A pointer to the null-terminated key.
+     * @param[in] aNumber  The number.
+     *
+     */
+    void AddNumber(const char *aKey, double aNumber)
+    {
+        Key(aKey);
+        Number(aNumber);
+    }
+
+    /**
+     * This method writes a boolean member of the current object.
+     *
+     * @param[in] aKey    A pointer to the null-terminated key.
+     * @param[in] aValue  The boolean.
+     *
+     */
+    void AddBool(const char *aKey, bool aValue)
+    {
+        Key(aKey);
+        Bool(aValue);
+    }
+
+private:
+    static constexpr uint8_t kMaxDepth = 16;
+
+    struct Scope
+    {
+        bool mIsArray;
+        bool mIsEmpty;
+        bool mIsFiltered;
+    };
+
+    bool IsSkipping(void) const { return mSkipDepth != 0; }
+    bool SkipValue(void);
+    void BeginValue(void);
+    void BeginScope(bool aIsArray);
+    void WriteIndent(uint8_t aDepth);
+    void WriteEscaped(const char *aString);
+
+    std::string    &mOutput;
+    Scope           mScopes[kMaxDepth];
+    uint8_t         mDepth;
+    const FieldSet *mFields;
+    uint8_t         mSkipDepth; ///< The depth of the object whose member is dropped, zero if none.
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_JSON_WRITER_HPP_
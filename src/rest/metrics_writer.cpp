@@ -0,0 +1,96 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenMetrics text writer for RESTful HTTP server.
+ */
+
+#include "rest/metrics_writer.hpp"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+namespace otbr {
+namespace rest {
+
+MetricsWriter::MetricsWriter(std::string &aOutput)
+    : mOutput(aOutput)
+    , mName(nullptr)
+    , mType(Type::kGauge)
+{
+}
+
+void MetricsWriter::BeginFamily(const char *aName, Type aType, const char *aHelp)
+{
+    mName = aName;
+    mType = aType;
+
+    mOutput += "# TYPE ";
+    mOutput += aName;
+    mOutput += (aType == Type::kCounter) ? " counter\n" : " gauge\n";
+    mOutput += "# HELP ";
+    mOutput += aName;
+    mOutput += ' ';
+    mOutput += aHelp;
+    mOutput += '\n';
+}
+
+void MetricsWriter::AddSample(const char *aLabels, uint64_t aValue)
+{
+    char value[sizeof("18446744073709551615")];
+
+    assert(mName != nullptr);
+
+    mOutput += mName;
+    if (mType == Type::kCounter)
+    {
+        mOutput += "_total";
+    }
+    if (aLabels != nullptr)
+    {
+        mOutput += '{';
+        mOutput += aLabels;
+        mOutput += '}';
+    }
+
+    snprintf(value, sizeof(value), "%" PRIu64, aValue);
+    mOutput += ' ';
+    mOutput += value;
+    mOutput += '\n';
+}
+
+void MetricsWriter::Finish(void)
+{
+    mOutput += "# EOF\n";
+    mName = nullptr;
+}
+
+} // namespace rest
+} // namespace otbr
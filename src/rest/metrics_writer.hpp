@@ -0,0 +1,143 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes an OpenMetrics text writer for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_METRICS_WRITER_HPP_
+#define OTBR_REST_METRICS_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a writer of the OpenMetrics text exposition format.
+ *
+ * The metric families are appended to the output buffer as they are written, each family is made of its metadata
+ * followed by its samples.
+ *
+ */
+class MetricsWriter
+{
+public:
+    /**
+     * This enumeration represents the type of a metric family.
+     *
+     */
+    enum class Type : uint8_t
+    {
+        kCounter, ///< A monotonically increasing total.
+        kGauge,   ///< A current value which may go up and down.
+    };
+
+    /**
+     * The constructor to initialize an OpenMetrics writer.
+     *
+     * @param[in] aOutput  A reference to the buffer the OpenMetrics text is appended to.
+     *
+     */
+    explicit MetricsWriter(std::string &aOutput);
+
+    /**
+     * This method starts a metric family, the samples written next belong to it.
+     *
+     * @param[in] aName  A pointer to the null-terminated name of the family, without the `_total` suffix of counters.
+     * @param[in] aType  The type of the family.
+     * @param[in] aHelp  A pointer to the null-terminated description of the family, without line breaks.
+     *
+     */
+    void BeginFamily(const char *aName, Type aType, const char *aHelp);
+
+    /**
+     * This method writes a sample of the current metric family.
+     *
+     * @param[in] aLabels  A pointer to the null-terminated labels such as `result="success"`, or nullptr if none.
+     * @param[in] aValue   The value of the sample.
+     *
+     */
+    void AddSample(const char *aLabels, uint64_t aValue);
+
+    /**
+     * This method writes a sample without labels of the current metric family.
+     *
+     * @param[in] aValue  The value of the sample.
+     *
+     */
+    void AddSample(uint64_t aValue) { AddSample(nullptr, aValue); }
+
+    /**
+     * This method writes a counter family with a single sample.
+     *
+     * @param[in] aName   A pointer to the null-terminated name of the family, without the `_total` suffix.
+     * @param[in] aHelp   A pointer to the null-terminated description of the family.
+     * @param[in] aValue  The value of the counter.
+     *
+     */
+    void AddCounter(const char *aName, const char *aHelp, uint64_t aValue)
+    {
+        BeginFamily(aName, Type::kCounter, aHelp);
+        AddSample(aValue);
+    }
+
+    /**
+     * This method writes a gauge family with a single sample.
+     *
+     * @param[in] aName   A pointer to the null-terminated name of the family.
+     * @param[in] aHelp   A pointer to the null-terminated description of the family.
+     * @param[in] aValue  The value of the gauge.
+     *
+     */
+    void AddGauge(const char *aName, const char *aHelp, uint64_t aValue)
+    {
+        BeginFamily(aName, Type::kGauge, aHelp);
+        AddSample(aValue);
+    }
+
+    /**
+     * This method ends the exposition, no family may be written after it.
+     *
+     */
+    void Finish(void);
+
+private:
+    std::string &mOutput;
+    const char  *mName;
+    Type         mType;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_METRICS_WRITER_HPP_
@@ -31,6 +31,9 @@
 #include <string>
 #include <vector>
 
+#include <limits.h>
+#include <string.h>
+
 namespace otbr {
 namespace rest {
 
@@ -49,13 +52,15 @@ static int OnUrl(http_parser *parser, const char *at, size_t len)
 static int OnBody(http_parser *parser, const char *at, size_t len)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      rval    = 0;
 
-    if (len > 0)
+    // The parsing stops at the first fragment exceeding the limits of the body, before the rest is received.
+    if (len > 0 && !request->SetBody(at, len))
     {
-        request->SetBody(at, len);
+        rval = -1;
     }
 
-    return 0;
+    return rval;
 }
 
 static int OnMessageComplete(http_parser *parser)
@@ -64,6 +69,9 @@ static int OnMessageComplete(http_parser *parser)
 
     request->SetReadComplete();
 
+    // Stop after this message so that pipelined requests are left to be parsed once it has been answered.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -78,8 +86,18 @@ static int OnMessageBegin(http_parser *parser)
 static int OnHeaderComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      rval    = 0;
+
     request->SetMethod(parser->method);
-    return 0;
+    request->SetConnectionInfo(http_should_keep_alive(parser) != 0, parser->http_major, parser->http_minor);
+
+    // A body announced larger than allowed is rejected without receiving it, the length of a chunked body is unknown.
+    if (parser->content_length != ULLONG_MAX && !Request::IsBodyLengthAllowed(parser->content_length))
+    {
+        rval = -1;
+    }
+
+    return rval;
 }
 
 static int OnHandlerData(http_parser *, const char *, size_t)
@@ -118,6 +136,8 @@ Parser::Parser(Request *aRequest)
 
 void Parser::Init(void)
 {
+    // The callbacks which are not used must be null.
+    memset(&mSettings, 0, sizeof(mSettings));
     mSettings.on_message_begin    = OnMessageBegin;
     mSettings.on_url              = OnUrl;
     mSettings.on_status           = OnHandlerData;
@@ -129,9 +149,30 @@ void Parser::Init(void)
     http_parser_init(&mParser, HTTP_REQUEST);
 }
 
-void Parser::Process(const char *aBuf, size_t aLength)
+otbrError Parser::Process(const char *aBuf, size_t aLength, size_t &aParsedLength)
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    otbrError error = OTBR_ERROR_NONE;
+
+    // Resume parsing if it was paused after the previous message.
+    http_parser_pause(&mParser, 0);
+
+    aParsedLength = http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+
+    switch (HTTP_PARSER_ERRNO(&mParser))
+    {
+    case HPE_OK:
+    case HPE_PAUSED:
+        break;
+    case HPE_CB_headers_complete:
+    case HPE_CB_body:
+        error = OTBR_ERROR_ABORTED;
+        break;
+    default:
+        error = OTBR_ERROR_PARSE;
+        break;
+    }
+
+    return error;
 }
 
 } // namespace rest
@@ -38,6 +38,7 @@
 
 #include <memory>
 
+#include "common/types.hpp"
 #include "rest/types.hpp"
 
 extern "C" {
@@ -73,11 +74,19 @@ public:
     /**
      * This method performs a parse process.
      *
-     * @param[in] aBuf     A pointer pointing to read buffer.
-     * @param[in] aLength  An integer indicates how much data is to be processed by parser.
+     * The parsing stops at the end of a complete request, the remaining data should be processed again once the
+     * request has been handled.
+     *
+     * @param[in]  aBuf           A pointer pointing to read buffer.
+     * @param[in]  aLength        An integer indicates how much data is to be processed by parser.
+     * @param[out] aParsedLength  The number of bytes parsed.
+     *
+     * @retval OTBR_ERROR_NONE     Successfully parsed the data.
+     * @retval OTBR_ERROR_PARSE    The data is not a valid HTTP request.
+     * @retval OTBR_ERROR_ABORTED  The body of the request exceeds the limits of its size or of its JSON structure.
      *
      */
-    void Process(const char *aBuf, size_t aLength);
+    otbrError Process(const char *aBuf, size_t aLength, size_t &aParsedLength);
 
 private:
     http_parser          mParser;
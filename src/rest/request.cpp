@@ -27,24 +27,141 @@
  */
 
 #include "rest/request.hpp"
+
+#include <sstream>
+
+#include <stdint.h>
+#include <stdlib.h>
+
 #include "utils/string_utils.hpp"
 
 namespace otbr {
 namespace rest {
 
+void Request::Field::Append(const std::string *aReadBuffer, const char *aString, size_t aLength)
+{
+    uintptr_t bufferBegin = (aReadBuffer == nullptr) ? 0 : reinterpret_cast<uintptr_t>(aReadBuffer->data());
+    uintptr_t bufferEnd   = (aReadBuffer == nullptr) ? 0 : bufferBegin + aReadBuffer->size();
+    uintptr_t begin       = reinterpret_cast<uintptr_t>(aString);
+
+    if (!mIsCopied && aReadBuffer != nullptr && begin >= bufferBegin && begin + aLength <= bufferEnd &&
+        (mLength == 0 || mOffset + mLength == begin - bufferBegin))
+    {
+        mOffset  = (mLength == 0) ? begin - bufferBegin : mOffset;
+        mLength += aLength;
+        ExitNow();
+    }
+
+    if (!mIsCopied)
+    {
+        // The data isn't adjacent to the referred one anymore, e.g. the chunks of a body.
+        mCopy     = ToString(aReadBuffer);
+        mIsCopied = true;
+    }
+
+    mCopy.append(aString, aLength);
+
+exit:
+    return;
+}
+
+std::string Request::Field::ToString(const std::string *aReadBuffer) const
+{
+    std::string string;
+
+    if (mIsCopied)
+    {
+        string = mCopy;
+    }
+    else if (mLength > 0)
+    {
+        string = aReadBuffer->substr(mOffset, mLength);
+    }
+
+    return string;
+}
+
+constexpr size_t   Request::kMaxBodySize;
+constexpr uint16_t Request::kMaxBodyJsonDepth;
+constexpr uint32_t Request::kMaxBodyJsonValues;
+
 Request::Request(void)
-    : mComplete(false)
+    : mReadBuffer(nullptr)
+    , mIsHeaderValueSet(true)
+    , mComplete(false)
+    , mKeepAlive(false)
+    , mChunkedEncodingSupported(false)
+    , mBodyLength(0)
+    , mBodyJsonDepth(0)
+    , mBodyJsonValues(0)
+    , mIsInBodyJsonString(false)
+    , mIsBodyJsonEscaped(false)
 {
 }
 
 void Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    mUrl.Append(mReadBuffer, aString, aLength);
 }
 
-void Request::SetBody(const char *aString, size_t aLength)
+bool Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    bool allowed = false;
+
+    VerifyOrExit(aLength <= kMaxBodySize - mBodyLength && ScanBody(aString, aLength));
+
+    mBody.Append(mReadBuffer, aString, aLength);
+    mBodyLength += aLength;
+    allowed = true;
+
+exit:
+    return allowed;
+}
+
+bool Request::ScanBody(const char *aString, size_t aLength)
+{
+    bool allowed = true;
+
+    // Only the nesting and the number of the values are counted, the body is validated once it is parsed. The
+    // values are counted by their containers and separators, which is an upper bound of the parsed values.
+    for (size_t i = 0; i < aLength; i++)
+    {
+        char c = aString[i];
+
+        if (mIsInBodyJsonString)
+        {
+            mIsInBodyJsonString = mIsBodyJsonEscaped || c != '"';
+            mIsBodyJsonEscaped  = !mIsBodyJsonEscaped && c == '\\';
+            continue;
+        }
+
+        switch (c)
+        {
+        case '"':
+            mIsInBodyJsonString = true;
+            break;
+        case '{':
+        case '[':
+            VerifyOrExit(++mBodyJsonDepth <= kMaxBodyJsonDepth, allowed = false);
+            VerifyOrExit(++mBodyJsonValues <= kMaxBodyJsonValues, allowed = false);
+            break;
+        case ',':
+            VerifyOrExit(++mBodyJsonValues <= kMaxBodyJsonValues, allowed = false);
+            break;
+        case '}':
+        case ']':
+            if (mBodyJsonDepth > 0)
+            {
+                mBodyJsonDepth--;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+exit:
+    return allowed;
 }
 
 void Request::SetContentLength(size_t aContentLength)
@@ -57,14 +174,33 @@ void Request::SetMethod(int32_t aMethod)
     mMethod = aMethod;
 }
 
+void Request::SetConnectionInfo(bool aKeepAlive, uint16_t aVersionMajor, uint16_t aVersionMinor)
+{
+    mKeepAlive                = aKeepAlive;
+    mChunkedEncodingSupported = (aVersionMajor > 1) || (aVersionMajor == 1 && aVersionMinor >= 1);
+}
+
 void Request::SetNextHeaderField(const char *aString, size_t aLength)
 {
-    mNextHeaderField = StringUtils::ToLowercase(std::string(aString, aLength));
+    if (mIsHeaderValueSet)
+    {
+        mNextHeaderField.clear();
+        mIsHeaderValueSet = false;
+    }
+
+    mNextHeaderField += StringUtils::ToLowercase(std::string(aString, aLength));
 }
 
 void Request::SetHeaderValue(const char *aString, size_t aLength)
 {
-    mHeaders[mNextHeaderField] = std::string(aString, aLength);
+    if (!mIsHeaderValueSet)
+    {
+        // A repeated header replaces the previous value.
+        mHeaders[mNextHeaderField] = Field();
+        mIsHeaderValueSet          = true;
+    }
+
+    mHeaders[mNextHeaderField].Append(mReadBuffer, aString, aLength);
 }
 
 HttpMethod Request::GetMethod() const
@@ -74,12 +210,12 @@ HttpMethod Request::GetMethod() const
 
 std::string Request::GetBody() const
 {
-    return mBody;
+    return mBody.ToString(mReadBuffer);
 }
 
 std::string Request::GetUrl(void) const
 {
-    std::string url = mUrl;
+    std::string url = mUrl.ToString(mReadBuffer);
 
     size_t urlEnd = url.find("?");
 
@@ -98,11 +234,78 @@ exit:
     return url;
 }
 
+std::string Request::GetQueryParameter(const std::string &aName) const
+{
+    std::string value;
+    std::string url   = mUrl.ToString(mReadBuffer);
+    size_t      begin = url.find("?");
+
+    VerifyOrExit(begin != std::string::npos);
+
+    while (begin != std::string::npos)
+    {
+        size_t      end       = url.find("&", begin + 1);
+        std::string parameter = url.substr(begin + 1, (end == std::string::npos) ? end : end - begin - 1);
+        size_t      separator = parameter.find("=");
+
+        if (parameter.substr(0, separator) == aName)
+        {
+            value = (separator == std::string::npos) ? "" : parameter.substr(separator + 1);
+            break;
+        }
+
+        begin = end;
+    }
+
+exit:
+    return value;
+}
+
+bool Request::IsGzipAccepted(void) const
+{
+    std::istringstream codings(GetHeaderValue(OT_REST_ACCEPT_ENCODING_HEADER));
+    std::string        coding;
+    bool               gzipListed  = false;
+    bool               gzipQuality = false;
+    bool               anyQuality  = false;
+
+    while (std::getline(codings, coding, ','))
+    {
+        size_t      nameBegin = coding.find_first_not_of(" \t");
+        size_t      nameEnd   = coding.find_first_of(" \t;", nameBegin);
+        size_t      quality   = coding.find("q=");
+        std::string name;
+        bool        acceptable;
+
+        if (nameBegin == std::string::npos)
+        {
+            continue;
+        }
+
+        name = StringUtils::ToLowercase(coding.substr(nameBegin, nameEnd - nameBegin));
+
+        // A coding with a zero quality is not acceptable.
+        acceptable = (quality == std::string::npos) || strtod(coding.c_str() + quality + 2, nullptr) > 0;
+
+        if (name == "gzip" || name == "x-gzip")
+        {
+            gzipListed  = true;
+            gzipQuality = acceptable;
+        }
+        else if (name == "*")
+        {
+            anyQuality = acceptable;
+        }
+    }
+
+    return gzipListed ? gzipQuality : anyQuality;
+}
+
 std::string Request::GetHeaderValue(const std::string aHeaderField) const
 {
     auto it = mHeaders.find(StringUtils::ToLowercase(aHeaderField));
 
-    return (it == mHeaders.end()) ? "" : it->second;
+    return (it == mHeaders.end()) ? "" : it->second.ToString(mReadBuffer);
 }
 
 void Request::SetReadComplete(void)
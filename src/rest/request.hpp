@@ -42,6 +42,41 @@
 #include "common/code_utils.hpp"
 #include "rest/types.hpp"
 
+/**
+ * @def OTBR_REST_MAX_BODY_SIZE
+ *
+ * The maximum size in bytes of a request body, a larger body is rejected as soon as its size is known.
+ */
+#ifndef OTBR_REST_MAX_BODY_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_REST_MAX_BODY_SIZE 4096
+#else
+#define OTBR_REST_MAX_BODY_SIZE 32768
+#endif
+#endif
+
+/**
+ * @def OTBR_REST_MAX_BODY_JSON_DEPTH
+ *
+ * The maximum nesting depth of the JSON objects and arrays of a request body.
+ */
+#ifndef OTBR_REST_MAX_BODY_JSON_DEPTH
+#define OTBR_REST_MAX_BODY_JSON_DEPTH 8
+#endif
+
+/**
+ * @def OTBR_REST_MAX_BODY_JSON_VALUES
+ *
+ * The maximum number of JSON values of a request body, which bounds the memory of the parsed body.
+ */
+#ifndef OTBR_REST_MAX_BODY_JSON_VALUES
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_REST_MAX_BODY_JSON_VALUES 256
+#else
+#define OTBR_REST_MAX_BODY_JSON_VALUES 2048
+#endif
+#endif
+
 namespace otbr {
 namespace rest {
 
@@ -58,9 +93,23 @@ public:
      */
     Request(void);
 
+    /**
+     * This method lets the request refer to the read buffer instead of copying the parsed data.
+     *
+     * The data passed to the setters which is in the read buffer is referred to by its offset, later fragments which
+     * are adjacent to it extend the reference, other data is copied. The buffer may grow, but the data of this request
+     * must be kept at the same offsets until the request is no longer used.
+     *
+     * @param[in] aReadBuffer  A pointer to the read buffer, or nullptr to copy the parsed data.
+     *
+     */
+    void SetReadBuffer(const std::string *aReadBuffer) { mReadBuffer = aReadBuffer; }
+
     /**
      * This method sets the Url field of a request.
      *
+     * The fragments of the url are appended.
+     *
      * @param[in] aString  A pointer points to url string.
      * @param[in] aLength  Length of the url string
      *
@@ -70,11 +119,26 @@ public:
     /**
      * This method sets the body field of a request.
      *
+     * The fragments of the body are appended. They are scanned as they arrive, so that a body exceeding the limits
+     * of its size or of its JSON structure is rejected before it is received completely.
+     *
      * @param[in] aString  A pointer points to body string.
      * @param[in] aLength  Length of the body string
      *
+     * @returns Whether the body is still within the limits, it is not appended otherwise.
+     *
+     */
+    bool SetBody(const char *aString, size_t aLength);
+
+    /**
+     * This method checks whether a body of a length is allowed.
+     *
+     * @param[in] aLength  The length of the body, e.g. from the Content-Length header.
+     *
+     * @returns Whether the length is within OTBR_REST_MAX_BODY_SIZE.
+     *
      */
-    void SetBody(const char *aString, size_t aLength);
+    static bool IsBodyLengthAllowed(uint64_t aLength) { return aLength <= kMaxBodySize; }
 
     /**
      * This method sets the content-length field of a request.
@@ -92,11 +156,23 @@ public:
      */
     void SetMethod(int32_t aMethod);
 
+    /**
+     * This method sets the connection persistency and the HTTP version of the parsed request.
+     *
+     * @param[in] aKeepAlive     Whether the client asks to keep the connection open after the response.
+     * @param[in] aVersionMajor  The major version of HTTP.
+     * @param[in] aVersionMinor  The minor version of HTTP.
+     *
+     */
+    void SetConnectionInfo(bool aKeepAlive, uint16_t aVersionMajor, uint16_t aVersionMinor);
+
     /**
      * This method sets the next header field of a request.
      *
-     * @param[in] aString  A pointer points to body string.
-     * @param[in] aLength  Length of the body string
+     * The fragments of a header field are appended until its value is set.
+     *
+     * @param[in] aString  A pointer points to header field string.
+     * @param[in] aLength  Length of the header field string
      *
      */
     void SetNextHeaderField(const char *aString, size_t aLength);
@@ -104,8 +180,10 @@ public:
     /**
      * This method sets the header value of the previously set header of a request.
      *
-     * @param[in] aString  A pointer points to body string.
-     * @param[in] aLength  Length of the body string
+     * The fragments of a header value are appended until the next header field is set.
+     *
+     * @param[in] aString  A pointer points to header value string.
+     * @param[in] aLength  Length of the header value string
      *
      */
     void SetHeaderValue(const char *aString, size_t aLength);
@@ -143,6 +221,15 @@ public:
      */
     std::string GetUrl(void) const;
 
+    /**
+     * This method returns the value of a query parameter of this request.
+     *
+     * @param[in] aName  The name of the query parameter.
+     *
+     * @returns A string contains the value of the query parameter, or an empty string if it is not present.
+     */
+    std::string GetQueryParameter(const std::string &aName) const;
+
     /**
      * This method returns the specified header field for this request.
      *
@@ -151,6 +238,30 @@ public:
      */
     std::string GetHeaderValue(const std::string aHeaderField) const;
 
+    /**
+     * This method indicates whether the client asks to keep the connection open after the response.
+     *
+     * @returns Whether the connection should be kept alive.
+     *
+     */
+    bool IsKeepAlive(void) const { return mKeepAlive; }
+
+    /**
+     * This method indicates whether the client accepts a response with the chunked transfer encoding.
+     *
+     * @returns Whether the chunked transfer encoding is supported (HTTP/1.1 or later).
+     *
+     */
+    bool IsChunkedEncodingSupported(void) const { return mChunkedEncodingSupported; }
+
+    /**
+     * This method indicates whether the client accepts a response with the gzip content encoding.
+     *
+     * @returns Whether the gzip content coding is acceptable according to the Accept-Encoding header.
+     *
+     */
+    bool IsGzipAccepted(void) const;
+
     /**
      * This method indicates whether this request is parsed completely.
      *
@@ -159,13 +270,44 @@ public:
     bool IsComplete(void) const;
 
 private:
-    int32_t                            mMethod;
-    size_t                             mContentLength;
-    std::string                        mUrl;
-    std::string                        mBody;
-    std::string                        mNextHeaderField;
-    std::map<std::string, std::string> mHeaders;
-    bool                               mComplete;
+    static constexpr size_t   kMaxBodySize       = OTBR_REST_MAX_BODY_SIZE;
+    static constexpr uint16_t kMaxBodyJsonDepth  = OTBR_REST_MAX_BODY_JSON_DEPTH;
+    static constexpr uint32_t kMaxBodyJsonValues = OTBR_REST_MAX_BODY_JSON_VALUES;
+
+    bool ScanBody(const char *aString, size_t aLength);
+
+    // A field of the request, which refers to the read buffer as long as it is made of adjacent data in the buffer.
+    class Field
+    {
+    public:
+        void        Append(const std::string *aReadBuffer, const char *aString, size_t aLength);
+        std::string ToString(const std::string *aReadBuffer) const;
+
+    private:
+        bool        mIsCopied = false;
+        size_t      mOffset   = 0;
+        size_t      mLength   = 0;
+        std::string mCopy;
+    };
+
+    int32_t                      mMethod;
+    size_t                       mContentLength;
+    const std::string           *mReadBuffer;
+    Field                        mUrl;
+    Field                        mBody;
+    std::string                  mNextHeaderField;
+    bool                         mIsHeaderValueSet;
+    std::map<std::string, Field> mHeaders;
+    bool                         mComplete;
+    bool                         mKeepAlive;
+    bool                         mChunkedEncodingSupported;
+
+    // The state of scanning the JSON structure of the body, without decoding it.
+    size_t   mBodyLength;
+    uint16_t mBodyJsonDepth;
+    uint32_t mBodyJsonValues;
+    bool     mIsInBodyJsonString;
+    bool     mIsBodyJsonEscaped;
 };
 
 } // namespace rest
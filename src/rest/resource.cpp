@@ -29,17 +29,37 @@
 #define OTBR_LOG_TAG "REST"
 
 #include "rest/resource.hpp"
+
+#include <cinttypes>
+#include <sstream>
+#include <stdlib.h>
+
 #include <openthread/commissioner.h>
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+#include <openthread/dnssd_server.h>
+#endif
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/platform/radio.h>
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 #include <openthread/srp_server.h>
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 #include <openthread/srp_client.h>
 #include <openthread/srp_client_buffers.h>
+#if OTBR_ENABLE_TREL
+#include <openthread/trel.h>
+#endif
+
+#include "common/time.hpp"
+#include "rest/metrics_writer.hpp"
+#include "utils/joiner_batch.hpp"
 
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOSTICS "/diagnostics"
+#define OT_REST_RESOURCE_PATH_EVENTS "/events"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
 #define OT_REST_RESOURCE_PATH_NODE_BAID "/node/ba-id"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
@@ -55,10 +75,17 @@
 #define OT_REST_RESOURCE_PATH_NODE_IPADDR_MLEID "/node/ipaddr/mleid"
 #define OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_STATE "/node/commissioner/state"
 #define OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER "/node/commissioner/joiner"
+#define OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER_BATCH "/node/commissioner/joiner/batch"
 #define OT_REST_RESOURCE_PATH_NODE_SRP_SERVER_STATE "/node/srp/server/state"
+#define OT_REST_RESOURCE_PATH_NODE_SRP_SERVER_HOSTS "/node/srp/server/hosts"
 #define OT_REST_RESOURCE_PATH_NODE_SRP_CLIENT_STATE "/node/srp/client/state"
 #define OT_REST_RESOURCE_PATH_NODE_SRP_CLIENT_HOST "/node/srp/client/host"
 #define OT_REST_RESOURCE_PATH_NODE_SRP_CLIENT_SERVICE "/node/srp/client/service"
+#define OT_REST_RESOURCE_PATH_NODE_MAINLOOP_STATS "/node/mainloop-stats"
+#define OT_REST_RESOURCE_PATH_NODE_MEMORY_STATS "/node/memory-stats"
+#define OT_REST_RESOURCE_PATH_NODE_LINK_METRICS "/node/link-metrics"
+#define OT_REST_RESOURCE_PATH_NODE_CHANNEL_QUALITY "/node/channel-quality"
+#define OT_REST_RESOURCE_PATH_NODE_COEX_METRICS "/node/coex-metrics"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
@@ -67,11 +94,14 @@
 #define OT_REST_HTTP_STATUS_200 "200 OK"
 #define OT_REST_HTTP_STATUS_201 "201 Created"
 #define OT_REST_HTTP_STATUS_204 "204 No Content"
+#define OT_REST_HTTP_STATUS_304 "304 Not Modified"
 #define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
 #define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
 #define OT_REST_HTTP_STATUS_409 "409 Conflict"
+#define OT_REST_HTTP_STATUS_413 "413 Payload Too Large"
+#define OT_REST_HTTP_STATUS_429 "429 Too Many Requests"
 #define OT_REST_HTTP_STATUS_500 "500 Internal Server Error"
 #define OT_REST_HTTP_STATUS_507 "507 Insufficient Storage"
 
@@ -85,17 +115,59 @@ using std::placeholders::_2;
 namespace otbr {
 namespace rest {
 
-// MulticastAddr
-static const char *kMulticastAddrAllRouters = "ff03::2";
+// Timeout (in Microseconds) for collecting diagnostics
+static const uint32_t kDiagCollectTimeout = 2000000;
+
+// Query parameter selecting the diagnostic TLV types, e.g. "/diagnostics?tlvs=0,1,5"
+static const char *kDiagTlvTypesQuery = "tlvs";
 
-// Default TlvTypes for Diagnostic inforamtion
-static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
+// Query parameter selecting the fields of the returned objects, e.g. "/node/dataset/active?fields=Channel,PanId"
+static const char *kFieldsQuery = "fields";
 
-// Timeout (in Microseconds) for deleting outdated diagnostics
-static const uint32_t kDiagResetTimeout = 3000000;
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+// Query parameters paging the SRP server hosts, e.g. "/node/srp/server/hosts?cursor=host1.default.service.arpa."
+static const char *kSrpHostsCursorQuery = "cursor";
+static const char *kSrpHostsPrefixQuery = "prefix";
+static const char *kSrpHostsLimitQuery  = "limit";
+#endif
+
+// Maximum age (in Microseconds) of the snapshots which depend on state without change notification
+static const uint32_t kSnapshotMaxAge = 1000000;
+
+// Maximum age (in Microseconds) of the metrics snapshot, which lets the scrapes of several collectors share it
+static const uint32_t kMetricsMaxAge = 5000000;
+
+// The Thread state changes which invalidate the snapshots
+static const otChangedFlags kRoleFlags     = OT_CHANGED_THREAD_ROLE;
+static const otChangedFlags kRlocFlags     = OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED;
+static const otChangedFlags kLeaderFlags   = OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA;
+static const otChangedFlags kNetworkFlags  = OT_CHANGED_THREAD_NETWORK_NAME | OT_CHANGED_THREAD_EXT_PANID;
+static const otChangedFlags kExtAddrFlags  = OT_CHANGED_THREAD_LL_ADDR;
+static const otChangedFlags kNodeInfoFlags = kRoleFlags | kRlocFlags | kLeaderFlags | kNetworkFlags | kExtAddrFlags;
+
+static std::string ComputeETag(const std::string &aContentType, const std::string &aBody)
+{
+    // 64-bit FNV-1a, the ETag only needs to change when the representation changes.
+    uint64_t hash = 14695981039346656037ULL;
+    char     etag[sizeof("\"0123456789abcdef\"")];
 
-// Timeout (in Microseconds) for collecting diagnostics
-static const uint32_t kDiagCollectTimeout = 2000000;
+    for (const std::string *part : {&aContentType, &aBody})
+    {
+        for (char c : *part)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+        }
+    }
+
+    snprintf(etag, sizeof(etag), "\"%016" PRIx64 "\"", hash);
+
+    return etag;
+}
+
+static bool MatchesETag(const std::string &aIfNoneMatch, const std::string &aETag)
+{
+    return aIfNoneMatch == "*" || aIfNoneMatch.find(aETag) != std::string::npos;
+}
 
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
@@ -112,6 +184,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusNoContent:
         httpStatus = OT_REST_HTTP_STATUS_204;
         break;
+    case HttpStatusCode::kStatusNotModified:
+        httpStatus = OT_REST_HTTP_STATUS_304;
+        break;
     case HttpStatusCode::kStatusBadRequest:
         httpStatus = OT_REST_HTTP_STATUS_400;
         break;
@@ -127,6 +202,12 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusConflict:
         httpStatus = OT_REST_HTTP_STATUS_409;
         break;
+    case HttpStatusCode::kStatusPayloadTooLarge:
+        httpStatus = OT_REST_HTTP_STATUS_413;
+        break;
+    case HttpStatusCode::kStatusTooManyRequests:
+        httpStatus = OT_REST_HTTP_STATUS_429;
+        break;
     case HttpStatusCode::kStatusInternalServerError:
         httpStatus = OT_REST_HTTP_STATUS_500;
         break;
@@ -138,12 +219,235 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     return httpStatus;
 }
 
-Resource::Resource(RcpHost *aHost)
+static void WriteMdnsResponseCounters(MetricsWriter              &aWriter,
+                                      const char                 *aOperation,
+                                      const MdnsResponseCounters &aCounters)
+{
+    std::string labels = std::string("operation=\"") + aOperation + "\",result=";
+
+    aWriter.AddSample((labels + "\"success\"").c_str(), aCounters.mSuccess);
+    aWriter.AddSample((labels + "\"not_found\"").c_str(), aCounters.mNotFound);
+    aWriter.AddSample((labels + "\"invalid_args\"").c_str(), aCounters.mInvalidArgs);
+    aWriter.AddSample((labels + "\"duplicated\"").c_str(), aCounters.mDuplicated);
+    aWriter.AddSample((labels + "\"not_implemented\"").c_str(), aCounters.mNotImplemented);
+    aWriter.AddSample((labels + "\"unknown_error\"").c_str(), aCounters.mUnknownError);
+    aWriter.AddSample((labels + "\"aborted\"").c_str(), aCounters.mAborted);
+    aWriter.AddSample((labels + "\"invalid_state\"").c_str(), aCounters.mInvalidState);
+}
+
+static void WriteMdnsEmaLatency(MetricsWriter &aWriter, const char *aOperation, uint32_t aLatency)
+{
+    std::string labels = std::string("operation=\"") + aOperation + "\"";
+
+    aWriter.AddSample(labels.c_str(), aLatency);
+}
+
+static void WriteMdnsMetrics(MetricsWriter &aWriter, const MdnsTelemetryInfo &aInfo)
+{
+    aWriter.BeginFamily("otbr_mdns_responses", MetricsWriter::Type::kCounter, "The mDNS responses by operation.");
+    WriteMdnsResponseCounters(aWriter, "host_registration", aInfo.mHostRegistrations);
+    WriteMdnsResponseCounters(aWriter, "key_registration", aInfo.mKeyRegistrations);
+    WriteMdnsResponseCounters(aWriter, "service_registration", aInfo.mServiceRegistrations);
+    WriteMdnsResponseCounters(aWriter, "host_resolution", aInfo.mHostResolutions);
+    WriteMdnsResponseCounters(aWriter, "service_resolution", aInfo.mServiceResolutions);
+
+    aWriter.BeginFamily("otbr_mdns_ema_latency_milliseconds", MetricsWriter::Type::kGauge,
+                        "The exponential moving average of the mDNS latencies by operation.");
+    WriteMdnsEmaLatency(aWriter, "host_registration", aInfo.mHostRegistrationEmaLatency);
+    WriteMdnsEmaLatency(aWriter, "key_registration", aInfo.mKeyRegistrationEmaLatency);
+    WriteMdnsEmaLatency(aWriter, "service_registration", aInfo.mServiceRegistrationEmaLatency);
+    WriteMdnsEmaLatency(aWriter, "host_resolution", aInfo.mHostResolutionEmaLatency);
+    WriteMdnsEmaLatency(aWriter, "service_resolution", aInfo.mServiceResolutionEmaLatency);
+
+    aWriter.AddCounter("otbr_mdns_discovery_cache_hits", "The subscriptions answered with cached discovery results.",
+                       aInfo.mDiscoveryCacheHits);
+    aWriter.AddCounter("otbr_mdns_discovery_cache_misses", "The subscriptions waiting for new discovery results.",
+                       aInfo.mDiscoveryCacheMisses);
+    aWriter.AddCounter("otbr_mdns_daemon_requests", "The requests sent to the mDNS daemon.", aInfo.mDaemonRequests);
+}
+
+static void WriteRadioMetrics(MetricsWriter &aWriter, const agent::RadioCoexSampler &aCoexSampler)
+{
+    const otRadioSpinelMetrics    *spinelMetrics    = otSysGetRadioSpinelMetrics();
+    const otRcpInterfaceMetrics   *interfaceMetrics = otSysGetRcpInterfaceMetrics();
+    const agent::RadioCoexHistory &coexHistory      = aCoexSampler.GetHistory();
+    otRadioCoexMetrics             coexMetrics;
+
+    aWriter.AddCounter("otbr_rcp_timeouts", "The timeouts of the RCP.", spinelMetrics->mRcpTimeoutCount);
+    aWriter.AddCounter("otbr_rcp_unexpected_resets", "The unexpected resets of the RCP.",
+                       spinelMetrics->mRcpUnexpectedResetCount);
+    aWriter.AddCounter("otbr_rcp_restorations", "The restorations of the RCP.", spinelMetrics->mRcpRestorationCount);
+    aWriter.AddCounter("otbr_spinel_parse_errors", "The spinel frames failing to be parsed.",
+                       spinelMetrics->mSpinelParseErrorCount);
+
+    aWriter.BeginFamily("otbr_rcp_interface_frames", MetricsWriter::Type::kCounter,
+                        "The frames transferred over the RCP interface.");
+    aWriter.AddSample("type=\"all\"", interfaceMetrics->mTransferredFrameCount);
+    aWriter.AddSample("type=\"valid\"", interfaceMetrics->mTransferredValidFrameCount);
+    aWriter.AddSample("type=\"garbage\"", interfaceMetrics->mTransferredGarbageFrameCount);
+    aWriter.BeginFamily("otbr_rcp_interface_packets", MetricsWriter::Type::kCounter,
+                        "The frames received or sent over the RCP interface.");
+    aWriter.AddSample("direction=\"rx\"", interfaceMetrics->mRxFrameCount);
+    aWriter.AddSample("direction=\"tx\"", interfaceMetrics->mTxFrameCount);
+    aWriter.BeginFamily("otbr_rcp_interface_bytes", MetricsWriter::Type::kCounter,
+                        "The bytes received or sent over the RCP interface.");
+    aWriter.AddSample("direction=\"rx\"", interfaceMetrics->mRxFrameByteCount);
+    aWriter.AddSample("direction=\"tx\"", interfaceMetrics->mTxFrameByteCount);
+
+    // The coex metrics are only available if the radio supports them, they are read by the sampler in the background.
+    VerifyOrExit(aCoexSampler.GetMetrics(coexMetrics) == OT_ERROR_NONE);
+
+    aWriter.AddCounter("otbr_coex_grant_glitches", "The grant glitches of the radio coex.",
+                       coexMetrics.mNumGrantGlitch);
+    aWriter.BeginFamily("otbr_coex_requests", MetricsWriter::Type::kCounter, "The radio coex requests.");
+    aWriter.AddSample("direction=\"rx\"", coexMetrics.mNumRxRequest);
+    aWriter.AddSample("direction=\"tx\"", coexMetrics.mNumTxRequest);
+    aWriter.BeginFamily("otbr_coex_grants", MetricsWriter::Type::kCounter, "The radio coex requests by grant.");
+    aWriter.AddSample("direction=\"rx\",grant=\"immediate\"", coexMetrics.mNumRxGrantImmediate);
+    aWriter.AddSample("direction=\"rx\",grant=\"wait\"", coexMetrics.mNumRxGrantWait);
+    aWriter.AddSample("direction=\"rx\",grant=\"wait_activated\"", coexMetrics.mNumRxGrantWaitActivated);
+    aWriter.AddSample("direction=\"rx\",grant=\"wait_timeout\"", coexMetrics.mNumRxGrantWaitTimeout);
+    aWriter.AddSample("direction=\"rx\",grant=\"deactivated_during_request\"",
+                      coexMetrics.mNumRxGrantDeactivatedDuringRequest);
+    aWriter.AddSample("direction=\"rx\",grant=\"delayed\"", coexMetrics.mNumRxDelayedGrant);
+    aWriter.AddSample("direction=\"rx\",grant=\"none\"", coexMetrics.mNumRxGrantNone);
+    aWriter.AddSample("direction=\"tx\",grant=\"immediate\"", coexMetrics.mNumTxGrantImmediate);
+    aWriter.AddSample("direction=\"tx\",grant=\"wait\"", coexMetrics.mNumTxGrantWait);
+    aWriter.AddSample("direction=\"tx\",grant=\"wait_activated\"", coexMetrics.mNumTxGrantWaitActivated);
+    aWriter.AddSample("direction=\"tx\",grant=\"wait_timeout\"", coexMetrics.mNumTxGrantWaitTimeout);
+    aWriter.AddSample("direction=\"tx\",grant=\"deactivated_during_request\"",
+                      coexMetrics.mNumTxGrantDeactivatedDuringRequest);
+    aWriter.AddSample("direction=\"tx\",grant=\"delayed\"", coexMetrics.mNumTxDelayedGrant);
+    aWriter.BeginFamily("otbr_coex_avg_request_to_grant_microseconds", MetricsWriter::Type::kGauge,
+                        "The average time from a radio coex request to its grant.");
+    aWriter.AddSample("direction=\"rx\"", coexMetrics.mAvgRxRequestToGrantTime);
+    aWriter.AddSample("direction=\"tx\"", coexMetrics.mAvgTxRequestToGrantTime);
+    aWriter.AddGauge("otbr_coex_stopped", "Whether the radio coex metrics collection is stopped.",
+                     coexMetrics.mStopped);
+    aWriter.BeginFamily("otbr_coex_request_rate_per_minute", MetricsWriter::Type::kGauge,
+                        "The radio coex requests per minute over the sampled history.");
+    aWriter.AddSample("direction=\"rx\"", coexHistory.GetRatePerMinute(agent::RadioCoexHistory::kRxRequest));
+    aWriter.AddSample("direction=\"tx\"", coexHistory.GetRatePerMinute(agent::RadioCoexHistory::kTxRequest));
+    aWriter.BeginFamily("otbr_coex_denial_rate_per_minute", MetricsWriter::Type::kGauge,
+                        "The radio coex requests per minute never granted over the sampled history.");
+    aWriter.AddSample("direction=\"rx\"", coexHistory.GetRatePerMinute(agent::RadioCoexHistory::kRxGrantNone));
+    aWriter.AddSample("direction=\"tx\"", coexHistory.GetRatePerMinute(agent::RadioCoexHistory::kTxGrantWaitTimeout));
+
+exit:
+    return;
+}
+
+static void WriteRcpRecoveryMetrics(MetricsWriter &aWriter, const RcpHost::RecoveryCounters &aCounters)
+{
+    aWriter.AddCounter("otbr_rcp_host_restorations", "The restorations of the RCP without resetting the host.",
+                       aCounters.mRestorations);
+    aWriter.AddGauge("otbr_rcp_host_last_restoration_microseconds", "The time of the last restoration of the RCP.",
+                     static_cast<uint64_t>(aCounters.mLastRestorationTime.count()));
+    aWriter.AddGauge("otbr_rcp_host_max_restoration_microseconds", "The longest time of a restoration of the RCP.",
+                     static_cast<uint64_t>(aCounters.mMaxRestorationTime.count()));
+    aWriter.AddCounter("otbr_rcp_host_resets", "The resets of the OpenThread instance.", aCounters.mResets);
+    aWriter.AddGauge("otbr_rcp_host_last_reset_microseconds", "The time of the last reset of the OpenThread instance.",
+                     static_cast<uint64_t>(aCounters.mLastResetTime.count()));
+}
+
+#if OTBR_ENABLE_BORDER_ROUTING_COUNTERS
+static void WriteBorderRoutingMetrics(MetricsWriter &aWriter, otInstance *aInstance)
+{
+    const otBorderRoutingCounters *counters = otIp6GetBorderRoutingCounters(aInstance);
+
+    aWriter.BeginFamily("otbr_border_routing_packets", MetricsWriter::Type::kCounter,
+                        "The packets forwarded between the Thread and infrastructure networks.");
+    aWriter.AddSample("direction=\"inbound\",cast=\"unicast\"", counters->mInboundUnicast.mPackets);
+    aWriter.AddSample("direction=\"inbound\",cast=\"multicast\"", counters->mInboundMulticast.mPackets);
+    aWriter.AddSample("direction=\"outbound\",cast=\"unicast\"", counters->mOutboundUnicast.mPackets);
+    aWriter.AddSample("direction=\"outbound\",cast=\"multicast\"", counters->mOutboundMulticast.mPackets);
+    aWriter.BeginFamily("otbr_border_routing_bytes", MetricsWriter::Type::kCounter,
+                        "The bytes forwarded between the Thread and infrastructure networks.");
+    aWriter.AddSample("direction=\"inbound\",cast=\"unicast\"", counters->mInboundUnicast.mBytes);
+    aWriter.AddSample("direction=\"inbound\",cast=\"multicast\"", counters->mInboundMulticast.mBytes);
+    aWriter.AddSample("direction=\"outbound\",cast=\"unicast\"", counters->mOutboundUnicast.mBytes);
+    aWriter.AddSample("direction=\"outbound\",cast=\"multicast\"", counters->mOutboundMulticast.mBytes);
+    aWriter.BeginFamily("otbr_border_routing_ra", MetricsWriter::Type::kCounter,
+                        "The Router Advertisement messages on the infrastructure network.");
+    aWriter.AddSample("event=\"rx\"", counters->mRaRx);
+    aWriter.AddSample("event=\"tx_success\"", counters->mRaTxSuccess);
+    aWriter.AddSample("event=\"tx_failure\"", counters->mRaTxFailure);
+    aWriter.BeginFamily("otbr_border_routing_rs", MetricsWriter::Type::kCounter,
+                        "The Router Solicitation messages on the infrastructure network.");
+    aWriter.AddSample("event=\"rx\"", counters->mRsRx);
+    aWriter.AddSample("event=\"tx_success\"", counters->mRsTxSuccess);
+    aWriter.AddSample("event=\"tx_failure\"", counters->mRsTxFailure);
+}
+#endif // OTBR_ENABLE_BORDER_ROUTING_COUNTERS
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+static void WriteSrpServerMetrics(MetricsWriter &aWriter, otInstance *aInstance, agent::SrpServerStats &aStats)
+{
+    const otSrpServerResponseCounters  *counters = otSrpServerGetResponseCounters(aInstance);
+    const agent::SrpServerStats::Stats &stats    = aStats.Get();
+
+    aWriter.BeginFamily("otbr_srp_server_responses", MetricsWriter::Type::kCounter,
+                        "The responses of the SRP server by response code.");
+    aWriter.AddSample("rcode=\"success\"", counters->mSuccess);
+    aWriter.AddSample("rcode=\"server_failure\"", counters->mServerFailure);
+    aWriter.AddSample("rcode=\"format_error\"", counters->mFormatError);
+    aWriter.AddSample("rcode=\"name_exists\"", counters->mNameExists);
+    aWriter.AddSample("rcode=\"refused\"", counters->mRefused);
+    aWriter.AddSample("rcode=\"other\"", counters->mOther);
+    aWriter.AddGauge("otbr_srp_server_hosts", "The hosts registered on the SRP server.", stats.mHosts.mFreshCount);
+    aWriter.AddGauge("otbr_srp_server_services", "The services registered on the SRP server.",
+                     stats.mServices.mFreshCount);
+}
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+static void WriteDnssdMetrics(MetricsWriter &aWriter, otInstance *aInstance)
+{
+    const otDnssdCounters *counters = otDnssdGetCounters(aInstance);
+
+    aWriter.BeginFamily("otbr_dnssd_responses", MetricsWriter::Type::kCounter,
+                        "The responses of the DNS-SD server by response code.");
+    aWriter.AddSample("rcode=\"success\"", counters->mSuccessResponse);
+    aWriter.AddSample("rcode=\"server_failure\"", counters->mServerFailureResponse);
+    aWriter.AddSample("rcode=\"format_error\"", counters->mFormatErrorResponse);
+    aWriter.AddSample("rcode=\"name_error\"", counters->mNameErrorResponse);
+    aWriter.AddSample("rcode=\"not_implemented\"", counters->mNotImplementedResponse);
+    aWriter.AddSample("rcode=\"other\"", counters->mOtherResponse);
+    aWriter.AddCounter("otbr_dnssd_resolved_by_srp", "The DNS-SD queries resolved with the SRP server data.",
+                       counters->mResolvedBySrp);
+}
+#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#if OTBR_ENABLE_TREL
+static void WriteTrelMetrics(MetricsWriter &aWriter, otInstance *aInstance)
+{
+    const otTrelCounters *counters = otTrelGetCounters(aInstance);
+
+    aWriter.AddGauge("otbr_trel_enabled", "Whether TREL is enabled.", otTrelIsEnabled(aInstance));
+    aWriter.AddGauge("otbr_trel_peers", "The TREL peers.", otTrelGetNumberOfPeers(aInstance));
+    aWriter.BeginFamily("otbr_trel_packets", MetricsWriter::Type::kCounter, "The TREL packets received or sent.");
+    aWriter.AddSample("direction=\"rx\"", counters->mRxPackets);
+    aWriter.AddSample("direction=\"tx\"", counters->mTxPackets);
+    aWriter.BeginFamily("otbr_trel_bytes", MetricsWriter::Type::kCounter, "The TREL bytes received or sent.");
+    aWriter.AddSample("direction=\"rx\"", counters->mRxBytes);
+    aWriter.AddSample("direction=\"tx\"", counters->mTxBytes);
+    aWriter.AddCounter("otbr_trel_tx_failures", "The TREL packets failing to be sent.", counters->mTxFailure);
+}
+#endif // OTBR_ENABLE_TREL
+
+Resource::Resource(RcpHost *aHost, const Mdns::Publisher &aPublisher)
     : mInstance(nullptr)
     , mHost(aHost)
+    , mPublisher(aPublisher)
+    , mDiagnosticCollector(aHost)
+    , mCallbackResumePending(false)
+    , mWorkerPool(nullptr)
+    , mSrpClientHostState(OT_SRP_CLIENT_ITEM_STATE_REMOVED)
 {
     // Resource Handler
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_EVENTS, &Resource::Events);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_METRICS, &Resource::Metrics);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_BAID, &Resource::BaId);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
@@ -159,21 +463,64 @@ Resource::Resource(RcpHost *aHost)
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_IPADDR_MLEID, &Resource::IpaddrMleid);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_STATE, &Resource::CommissionerState);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER, &Resource::CommissionerJoiner);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_JOINER_BATCH, &Resource::CommissionerJoinerBatch);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COMMISSIONER_STATE, &Resource::CommissionerState);
 #ifdef OTBR_ENABLE_SRP_ADVERTISING_PROXY // SRP server is not forced on
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_SERVER_STATE, &Resource::SrpServerState);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_SERVER_HOSTS, &Resource::SrpServerHosts);
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_CLIENT_STATE, &Resource::SrpClientState);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_CLIENT_HOST, &Resource::SrpClientHost);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_SRP_CLIENT_SERVICE, &Resource::SrpClientService);
+#if OTBR_ENABLE_MAINLOOP_STATS
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_MAINLOOP_STATS, &Resource::MainloopStats);
+#endif
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_MEMORY_STATS, &Resource::MemoryStats);
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LINK_METRICS, &Resource::LinkMetrics);
+#endif
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_CHANNEL_QUALITY, &Resource::ChannelQuality);
+#endif
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_COEX_METRICS, &Resource::CoexMetrics);
 
     // Resource callback handler
     mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
+
+    // Resources whose GET responses are cached, with the state changes invalidating them
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_METRICS, SnapshotPolicy{0, kMetricsMaxAge});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE, SnapshotPolicy{kNodeInfoFlags, kSnapshotMaxAge});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_BAID, SnapshotPolicy{0, kSnapshotMaxAge});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, SnapshotPolicy{kRoleFlags, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, SnapshotPolicy{kExtAddrFlags, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, SnapshotPolicy{kNetworkFlags, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, SnapshotPolicy{kRoleFlags | kRlocFlags, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA,
+                              SnapshotPolicy{kRoleFlags | kLeaderFlags, kSnapshotMaxAge});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER,
+                              SnapshotPolicy{kRoleFlags | kLeaderFlags, kSnapshotMaxAge});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, SnapshotPolicy{kNetworkFlags, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, SnapshotPolicy{kRoleFlags | kRlocFlags, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, SnapshotPolicy{OT_CHANGED_ACTIVE_DATASET, 0});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING,
+                              SnapshotPolicy{OT_CHANGED_PENDING_DATASET, kSnapshotMaxAge});
+    mSnapshotPolicies.emplace(OT_REST_RESOURCE_PATH_NODE_IPADDR_MLEID, SnapshotPolicy{OT_CHANGED_THREAD_ML_ADDR, 0});
 }
 
 void Resource::Init(void)
 {
     mInstance = mHost->GetThreadHelper()->GetInstance();
+    mDiagnosticCollector.Init(mInstance);
+    mDiagnosticCollector.SetUpdatedCallback([this](const DiagInfo &aDiagInfo) { HandleDiagnosticUpdated(aDiagInfo); });
+    mHost->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mHost->AddNeighborTableChangedCallback(
+        [this](const std::vector<agent::NeighborTableTracker::Change> &aChanges, uint32_t aGeneration) {
+            HandleNeighborTableChanged(aChanges, aGeneration);
+        });
+    mHost->GetThreadHelper()->AddActiveDatasetChangeHandler([this](const otOperationalDatasetTlvs &) {
+        mEventPublisher.Publish("dataset", Json::String2JsonString("active"));
+    });
+    otSrpClientSetCallback(mInstance, &Resource::HandleSrpClientEvent, this);
 }
 
 void Resource::Handle(Request &aRequest, Response &aResponse) const
@@ -184,7 +531,26 @@ void Resource::Handle(Request &aRequest, Response &aResponse) const
     if (it != mResourceMap.end())
     {
         ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+
+        if (aRequest.GetMethod() == HttpMethod::kGet)
+        {
+            if (!ServeSnapshot(url, aRequest, aResponse))
+            {
+                (this->*resourceHandler)(aRequest, aResponse);
+                UpdateSnapshot(url, aRequest, aResponse);
+            }
+        }
+        else
+        {
+            // Requests other than GET may change the state served from snapshots.
+            if (aRequest.GetMethod() != HttpMethod::kOptions)
+            {
+                std::lock_guard<std::mutex> lock(mSnapshotMutex);
+
+                mSnapshots.clear();
+            }
+            (this->*resourceHandler)(aRequest, aResponse);
+        }
     }
     else
     {
@@ -192,40 +558,299 @@ void Resource::Handle(Request &aRequest, Response &aResponse) const
     }
 }
 
+std::string Resource::GetSnapshotKey(const std::string &aUrl, const Request &aRequest)
+{
+    // The representation of some resources depends on the accepted content type and the selected fields.
+    return aUrl + '\n' + aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER) + '\n' +
+           aRequest.GetQueryParameter(kFieldsQuery);
+}
+
+const JsonWriter::FieldSet *Resource::GetFieldFilter(const Request &aRequest, JsonWriter::FieldSet &aFields)
+{
+    std::istringstream query(aRequest.GetQueryParameter(kFieldsQuery));
+    std::string        field;
+
+    while (std::getline(query, field, ','))
+    {
+        aFields.insert(field);
+    }
+
+    return aFields.empty() ? nullptr : &aFields;
+}
+
+bool Resource::ServeSnapshot(const Request &aRequest, Response &aResponse) const
+{
+    return aRequest.GetMethod() == HttpMethod::kGet && ServeSnapshot(aRequest.GetUrl(), aRequest, aResponse);
+}
+
+bool Resource::ServeSnapshot(const std::string &aUrl, const Request &aRequest, Response &aResponse) const
+{
+    bool                            served = false;
+    std::shared_ptr<const Snapshot> snapshot;
+
+    {
+        std::lock_guard<std::mutex> lock(mSnapshotMutex);
+        auto                        it = mSnapshots.find(GetSnapshotKey(aUrl, aRequest));
+
+        VerifyOrExit(it != mSnapshots.end());
+
+        if (MainloopClock::Now() >= it->second->mExpireTime)
+        {
+            mSnapshots.erase(it);
+            ExitNow();
+        }
+
+        snapshot = it->second;
+    }
+
+    RespondWithSnapshot(*snapshot, aRequest, aResponse);
+    served = true;
+
+exit:
+    return served;
+}
+
+void Resource::UpdateSnapshot(const std::string &aUrl, const Request &aRequest, Response &aResponse) const
+{
+    auto                      policy = mSnapshotPolicies.find(aUrl);
+    std::shared_ptr<Snapshot> snapshot;
+
+    VerifyOrExit(policy != mSnapshotPolicies.end());
+    VerifyOrExit(aResponse.GetResponseCode() == GetHttpStatus(HttpStatusCode::kStatusOk));
+
+    snapshot                    = std::make_shared<Snapshot>();
+    snapshot->mCode             = aResponse.GetResponseCode();
+    snapshot->mContentType      = aResponse.GetContentType();
+    snapshot->mBody             = aResponse.GetBody();
+    snapshot->mETag             = ComputeETag(snapshot->mContentType, snapshot->mBody);
+    snapshot->mInvalidatedFlags = policy->second.mInvalidatedFlags;
+    snapshot->mExpireTime       = (policy->second.mMaxAge == 0)
+                                      ? steady_clock::time_point::max()
+                                      : MainloopClock::Now() + microseconds(policy->second.mMaxAge);
+
+    RespondWithSnapshot(*snapshot, aRequest, aResponse);
+
+    {
+        std::lock_guard<std::mutex> lock(mSnapshotMutex);
+
+        mSnapshots[GetSnapshotKey(aUrl, aRequest)] = std::move(snapshot);
+    }
+
+exit:
+    return;
+}
+
+void Resource::RespondWithSnapshot(const Snapshot &aSnapshot, const Request &aRequest, Response &aResponse) const
+{
+    std::string code;
+    std::string body;
+
+    aResponse.SetHeader(OT_REST_ETAG_HEADER, aSnapshot.mETag);
+
+    if (MatchesETag(aRequest.GetHeaderValue(OT_REST_IF_NONE_MATCH_HEADER), aSnapshot.mETag))
+    {
+        code = GetHttpStatus(HttpStatusCode::kStatusNotModified);
+    }
+    else
+    {
+        code = aSnapshot.mCode;
+        body = aSnapshot.mBody;
+        aResponse.SetContentType(aSnapshot.mContentType);
+    }
+
+    aResponse.SetResponsCode(code);
+    aResponse.SetBody(body);
+}
+
+void Resource::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    {
+        std::lock_guard<std::mutex> lock(mSnapshotMutex);
+
+        for (auto it = mSnapshots.begin(); it != mSnapshots.end();)
+        {
+            if (it->second->mInvalidatedFlags & aFlags)
+            {
+                it = mSnapshots.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        PublishRoleEvent();
+    }
+
+    if (aFlags & OT_CHANGED_PENDING_DATASET)
+    {
+        mEventPublisher.Publish("dataset", Json::String2JsonString("pending"));
+    }
+}
+
+void Resource::PublishRoleEvent(void) const
+{
+    VerifyOrExit(mEventPublisher.HasSubscribers());
+
+    mEventPublisher.Publish("role", Json::String2JsonString(GetDeviceRoleName(otThreadGetDeviceRole(mInstance))));
+
+exit:
+    return;
+}
+
+void Resource::HandleDiagnosticUpdated(const DiagInfo &aDiagInfo) const
+{
+    ResumeCallbacks();
+
+    VerifyOrExit(mEventPublisher.HasSubscribers());
+
+    mEventPublisher.Publish("diagnostic", Json::NodeDiag2JsonString(aDiagInfo.mDiagContent));
+
+exit:
+    return;
+}
+
+void Resource::HandleNeighborTableChanged(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                          uint32_t                                                aGeneration) const
+{
+    VerifyOrExit(mEventPublisher.HasSubscribers());
+
+    mEventPublisher.Publish("neighbors", Json::NeighborTableChanges2JsonString(aChanges, aGeneration));
+
+exit:
+    return;
+}
+
+void Resource::HandleSrpClientEvent(otError                    aError,
+                                    const otSrpClientHostInfo *aHostInfo,
+                                    const otSrpClientService  *aServices,
+                                    const otSrpClientService  *aRemovedServices,
+                                    void                      *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aServices);
+    OTBR_UNUSED_VARIABLE(aRemovedServices);
+
+    if (aError == OT_ERROR_NONE && aHostInfo != nullptr)
+    {
+        static_cast<Resource *>(aContext)->HandleSrpClientEvent(*aHostInfo);
+    }
+}
+
+void Resource::HandleSrpClientEvent(const otSrpClientHostInfo &aHostInfo)
+{
+    // Only the host being registered or removed is published, not every state transition in between.
+    VerifyOrExit(aHostInfo.mState == OT_SRP_CLIENT_ITEM_STATE_REGISTERED ||
+                 aHostInfo.mState == OT_SRP_CLIENT_ITEM_STATE_REMOVED);
+    VerifyOrExit(aHostInfo.mState != mSrpClientHostState);
+
+    mSrpClientHostState = aHostInfo.mState;
+    mEventPublisher.Publish("srp-host", Json::HostInfo2JsonString(aHostInfo));
+
+exit:
+    return;
+}
+
 void Resource::HandleCallback(Request &aRequest, Response &aResponse)
 {
     std::string url = aRequest.GetUrl();
     auto        it  = mResourceCallbackMap.find(url);
 
-    if (it != mResourceCallbackMap.end())
+    if (aResponse.IsDeferred())
+    {
+        aResponse.CompleteDeferred();
+    }
+    else if (it != mResourceCallbackMap.end())
     {
         ResourceCallbackHandler resourceHandler = it->second;
         (this->*resourceHandler)(aRequest, aResponse);
     }
 }
 
+void Resource::ResumeCallbacks(void) const
+{
+    VerifyOrExit(mCallbackResumeHandler && !mCallbackResumePending);
+
+    // Several triggers in a row resume the connections only once, out of the OpenThread callback context.
+    mCallbackResumePending = true;
+    mHost->PostTimerTask(Milliseconds(0), [this]() {
+        mCallbackResumePending = false;
+        mCallbackResumeHandler();
+    });
+
+exit:
+    return;
+}
+
+void Resource::RunOnWorker(Response &aResponse, std::function<Response::Completion(void)> aWork, bool aUrgent) const
+{
+    std::shared_ptr<Response::Completion> completion;
+    std::shared_ptr<Response::Completion> result;
+
+    if (mWorkerPool == nullptr || !mWorkerPool->IsEnabled())
+    {
+        aWork()(aResponse);
+        ExitNow();
+    }
+
+    // The work only produces the completion, which accesses the OpenThread instance on the mainloop.
+    completion = aResponse.SetDeferred();
+    result     = std::make_shared<Response::Completion>();
+    mWorkerPool->Run([result, aWork]() { *result = aWork(); },
+                     [this, completion, result]() {
+                         *completion = std::move(*result);
+                         ResumeCallbacks();
+                     },
+                     aUrgent);
+
+exit:
+    return;
+}
+
 void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
 {
-    OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    std::vector<uint8_t> tlvTypes;
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
+    auto duration = duration_cast<microseconds>(MainloopClock::Now() - aResponse.GetStartTime()).count();
+
+    // Answer as soon as every known router has replied instead of always waiting for the timeout.
+    if (duration >= kDiagCollectTimeout || mDiagnosticCollector.IsUpToDate(aResponse.GetStartTime()))
     {
-        DeleteOutDatedDiagnostic();
+        ParseDiagTlvTypes(aRequest, tlvTypes);
+        GetDiagnostics(tlvTypes, aResponse);
+    }
+}
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
-        {
-            diagContentSet.push_back(it->second.mDiagContent);
-        }
+void Resource::Events(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+    std::string role;
+    std::string body;
 
-        body      = Json::Diag2JsonString(diagContentSet);
+    switch (aRequest.GetMethod())
+    {
+    case HttpMethod::kGet:
+        // Start with the current role, so that clients don't miss a change before the first event.
+        role      = Json::String2JsonString(GetDeviceRoleName(otThreadGetDeviceRole(mInstance)));
+        body      = EventPublisher::FormatEvent(0, "role", role);
         errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
         aResponse.SetResponsCode(errorCode);
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_EVENT_STREAM);
+        aResponse.SetHeader("Cache-Control", "no-cache");
         aResponse.SetBody(body);
+        aResponse.SetStream();
+        aResponse.SetComplete();
+        break;
+    case HttpMethod::kOptions:
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
         aResponse.SetComplete();
+        break;
+    default:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+        break;
     }
 }
 
@@ -623,20 +1248,190 @@ void Resource::GetDataRloc16(Response &aResponse) const
     std::string body;
     std::string errorCode;
 
-    body = Json::Number2JsonString(rloc16);
+    body = Json::Number2JsonString(rloc16);
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::Rloc16(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataRloc16(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+void Resource::GetMainloopStats(Response &aResponse) const
+{
+    std::string body = Json::MainloopStats2JsonString(MainloopManager::GetInstance());
+    std::string errorCode;
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::MainloopStats(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetMainloopStats(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
+void Resource::GetMemoryStats(Response &aResponse) const
+{
+    std::string body = Json::MemoryStats2JsonString(otbr::MemoryStats::GetInstance());
+    std::string errorCode;
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::MemoryStats(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetMemoryStats(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::GetMetrics(Response &aResponse) const
+{
+    std::string   body;
+    std::string   errorCode;
+    MetricsWriter writer(body);
+
+    WriteRadioMetrics(writer, mHost->GetThreadHelper()->GetRadioCoexSampler());
+    WriteRcpRecoveryMetrics(writer, mHost->GetRecoveryCounters());
+#if OTBR_ENABLE_BORDER_ROUTING_COUNTERS
+    WriteBorderRoutingMetrics(writer, mInstance);
+#endif
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    WriteSrpServerMetrics(writer, mInstance, mHost->GetThreadHelper()->GetSrpServerStats());
+#endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    WriteDnssdMetrics(writer, mInstance);
+#endif
+#if OTBR_ENABLE_TREL
+    WriteTrelMetrics(writer, mInstance);
+#endif
+    WriteMdnsMetrics(writer, mPublisher.GetMdnsTelemetryInfo());
+    writer.Finish();
+
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_OPENMETRICS);
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::Metrics(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetMetrics(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+void Resource::GetLinkMetrics(Response &aResponse) const
+{
+    std::string body =
+        Json::LinkMetricsHistories2JsonString(mHost->GetThreadHelper()->GetLinkMetricsSampler().GetNeighborHistories());
+    std::string errorCode;
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::LinkMetrics(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetLinkMetrics(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+void Resource::GetChannelQuality(Response &aResponse) const
+{
+    const agent::ChannelQualityHistory &history = mHost->GetThreadHelper()->GetChannelMonitorSampler().GetHistory();
+    std::string                         body;
+    std::string                         errorCode;
+
+    body = Json::ChannelQualityHistory2JsonString(history, otLinkGetSupportedChannelMask(mInstance));
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::ChannelQuality(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetChannelQuality(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+
+void Resource::GetCoexMetrics(Response &aResponse) const
+{
+    const agent::RadioCoexSampler &sampler = mHost->GetThreadHelper()->GetRadioCoexSampler();
+    otRadioCoexMetrics             metrics;
+    std::string                    body;
+    std::string                    errorCode;
+
+    // The coex metrics are only available if the radio supports them.
+    VerifyOrExit(sampler.GetMetrics(metrics) == OT_ERROR_NONE,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
 
+    body = Json::RadioCoexHistory2JsonString(sampler.GetHistory());
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
+
+exit:
+    return;
 }
 
-void Resource::Rloc16(const Request &aRequest, Response &aResponse) const
+void Resource::CoexMetrics(const Request &aRequest, Response &aResponse) const
 {
-    std::string errorCode;
-
     if (aRequest.GetMethod() == HttpMethod::kGet)
     {
-        GetDataRloc16(aResponse);
+        GetCoexMetrics(aResponse);
     }
     else
     {
@@ -704,6 +1499,7 @@ void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Res
     std::string              errorCode;
     otOperationalDataset     dataset;
     otOperationalDatasetTlvs datasetTlvs;
+    JsonWriter::FieldSet     fields;
 
     if (aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_PLAIN)
     {
@@ -726,12 +1522,12 @@ void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Res
         if (aDatasetType == DatasetType::kActive)
         {
             VerifyOrExit(otDatasetGetActive(mInstance, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_NOT_FOUND);
-            body = Json::ActiveDataset2JsonString(dataset);
+            body = Json::ActiveDataset2JsonString(dataset, GetFieldFilter(aRequest, fields));
         }
         else if (aDatasetType == DatasetType::kPending)
         {
             VerifyOrExit(otDatasetGetPending(mInstance, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_NOT_FOUND);
-            body = Json::PendingDataset2JsonString(dataset);
+            body = Json::PendingDataset2JsonString(dataset, GetFieldFilter(aRequest, fields));
         }
     }
 
@@ -754,18 +1550,47 @@ exit:
     }
 }
 
-void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
+otbrError Resource::ParseDataset(DatasetType           aDatasetType,
+                                 bool                  aIsTlv,
+                                 const std::string    &aBody,
+                                 otOperationalDataset &aDataset)
 {
-    otError                  errorOt = OT_ERROR_NONE;
-    otbrError                error   = OTBR_ERROR_NONE;
-    struct NodeInfo          node;
-    std::string              body;
+    otbrError                error = OTBR_ERROR_NONE;
+    otOperationalDatasetTlvs datasetUpdateTlvs;
+    int                      ret;
+
+    if (aIsTlv)
+    {
+        ret = Json::Hex2BytesJsonString(aBody, datasetUpdateTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
+        VerifyOrExit(ret >= 0, error = OTBR_ERROR_INVALID_ARGS);
+        datasetUpdateTlvs.mLength = ret;
+
+        VerifyOrExit(otDatasetParseTlvs(&datasetUpdateTlvs, &aDataset) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    }
+    else if (aDatasetType == DatasetType::kActive)
+    {
+        VerifyOrExit(Json::JsonActiveDatasetString2Dataset(aBody, aDataset), error = OTBR_ERROR_INVALID_ARGS);
+    }
+    else if (aDatasetType == DatasetType::kPending)
+    {
+        VerifyOrExit(Json::JsonPendingDatasetString2Dataset(aBody, aDataset), error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aDataset.mComponents.mIsDelayPresent, error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    return error;
+}
+
+void Resource::ApplyDataset(DatasetType                 aDatasetType,
+                            otbrError                   aParseError,
+                            const otOperationalDataset &aDataset,
+                            Response                   &aResponse) const
+{
+    otError                  errorOt   = OT_ERROR_NONE;
+    otbrError                error     = OTBR_ERROR_NONE;
     std::string              errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     otOperationalDataset     dataset   = {};
     otOperationalDatasetTlvs datasetTlvs;
-    otOperationalDatasetTlvs datasetUpdateTlvs;
-    int                      ret;
-    bool                     isTlv;
 
     if (aDatasetType == DatasetType::kActive)
     {
@@ -777,6 +1602,8 @@ void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Res
         errorOt = otDatasetGetPendingTlvs(mInstance, &datasetTlvs);
     }
 
+    SuccessOrExit(error = aParseError);
+
     // Create a new operational dataset if it doesn't exist.
     if (errorOt == OT_ERROR_NOT_FOUND)
     {
@@ -785,32 +1612,7 @@ void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Res
         errorCode = GetHttpStatus(HttpStatusCode::kStatusCreated);
     }
 
-    isTlv = aRequest.GetHeaderValue(OT_REST_CONTENT_TYPE_HEADER) == OT_REST_CONTENT_TYPE_PLAIN;
-
-    if (isTlv)
-    {
-        ret = Json::Hex2BytesJsonString(aRequest.GetBody(), datasetUpdateTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
-        VerifyOrExit(ret >= 0, error = OTBR_ERROR_INVALID_ARGS);
-        datasetUpdateTlvs.mLength = ret;
-
-        VerifyOrExit(otDatasetParseTlvs(&datasetUpdateTlvs, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
-        VerifyOrExit(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
-    }
-    else
-    {
-        if (aDatasetType == DatasetType::kActive)
-        {
-            VerifyOrExit(Json::JsonActiveDatasetString2Dataset(aRequest.GetBody(), dataset),
-                         error = OTBR_ERROR_INVALID_ARGS);
-        }
-        else if (aDatasetType == DatasetType::kPending)
-        {
-            VerifyOrExit(Json::JsonPendingDatasetString2Dataset(aRequest.GetBody(), dataset),
-                         error = OTBR_ERROR_INVALID_ARGS);
-            VerifyOrExit(dataset.mComponents.mIsDelayPresent, error = OTBR_ERROR_INVALID_ARGS);
-        }
-        VerifyOrExit(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
-    }
+    VerifyOrExit(otDatasetUpdateTlvs(&aDataset, &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
 
     if (aDatasetType == DatasetType::kActive)
     {
@@ -822,6 +1624,7 @@ void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Res
     }
 
     aResponse.SetResponsCode(errorCode);
+    aResponse.SetComplete();
 
 exit:
     if (error == OTBR_ERROR_INVALID_ARGS)
@@ -838,6 +1641,26 @@ exit:
     }
 }
 
+void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
+{
+    bool        isTlv = aRequest.GetHeaderValue(OT_REST_CONTENT_TYPE_HEADER) == OT_REST_CONTENT_TYPE_PLAIN;
+    std::string body  = aRequest.GetBody();
+
+    // The body is parsed by a worker, only the update of the dataset is run on the mainloop. A change of the state
+    // is parsed before the queued serializations.
+    RunOnWorker(
+        aResponse,
+        [this, aDatasetType, isTlv, body]() -> Response::Completion {
+            otOperationalDataset dataset = {};
+            otbrError            error   = ParseDataset(aDatasetType, isTlv, body, dataset);
+
+            return [this, aDatasetType, error, dataset](Response &aDeferredResponse) {
+                ApplyDataset(aDatasetType, error, dataset, aDeferredResponse);
+            };
+        },
+        /* aUrgent */ true);
+}
+
 void Resource::Dataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
 {
     std::string errorCode;
@@ -983,20 +1806,21 @@ void Resource::CommissionerState(const Request &aRequest, Response &aResponse) c
     }
 }
 
-void Resource::GetJoiners(Response &aResponse) const
+void Resource::GetJoiners(const Request &aRequest, Response &aResponse) const
 {
     uint16_t                  iter = 0;
     otJoinerInfo              joinerInfo;
     std::vector<otJoinerInfo> joinerTable;
     std::string               joinerJson;
     std::string               errorCode;
+    JsonWriter::FieldSet      fields;
 
     while (otCommissionerGetNextJoinerInfo(mInstance, &iter, &joinerInfo) == OT_ERROR_NONE)
     {
         joinerTable.push_back(joinerInfo);
     }
 
-    joinerJson = Json::JoinerTable2JsonString(joinerTable);
+    joinerJson = Json::JoinerTable2JsonString(joinerTable, GetFieldFilter(aRequest, fields));
     aResponse.SetBody(joinerJson);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
@@ -1132,7 +1956,7 @@ void Resource::CommissionerJoiner(const Request &aRequest, Response &aResponse)
     switch (aRequest.GetMethod())
     {
     case HttpMethod::kGet:
-        GetJoiners(aResponse);
+        GetJoiners(aRequest, aResponse);
         break;
     case HttpMethod::kPost:
         AddJoiner(aRequest, aResponse);
@@ -1152,6 +1976,128 @@ void Resource::CommissionerJoiner(const Request &aRequest, Response &aResponse)
     }
 }
 
+void Resource::AddJoiners(const Request &aRequest, Response &aResponse) const
+{
+    otbrError                 error    = OTBR_ERROR_NONE;
+    otError                   errorOt  = OT_ERROR_NONE;
+    uint16_t                  numAdded = 0;
+    std::vector<otJoinerInfo> joiners;
+    agent::JoinerBatch        batch;
+    std::string               body;
+    std::string               errorCode;
+
+    VerifyOrExit(otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_ACTIVE, error = OTBR_ERROR_INVALID_STATE);
+
+    VerifyOrExit(Json::JsonJoinerInfoArrayString2JoinerInfos(aRequest.GetBody(), joiners),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    for (const otJoinerInfo &joiner : joiners)
+    {
+        VerifyOrExit(batch.AddJoiner(joiner) == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+    errorOt = batch.AddToCommissioner(mInstance, numAdded);
+    VerifyOrExit(errorOt == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
+
+exit:
+    switch (error)
+    {
+    case OTBR_ERROR_NONE:
+        body = Json::Number2JsonString(numAdded);
+        aResponse.SetBody(body);
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        break;
+    case OTBR_ERROR_INVALID_STATE:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusConflict);
+        break;
+    case OTBR_ERROR_INVALID_ARGS:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+        break;
+    case OTBR_ERROR_OPENTHREAD:
+        switch (errorOt)
+        {
+        case OT_ERROR_INVALID_ARGS:
+            ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+            break;
+        case OT_ERROR_NO_BUFS:
+            ErrorHandler(aResponse, HttpStatusCode::kStatusInsufficientStorage);
+            break;
+        default:
+            ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+            break;
+        }
+        break;
+    default:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+        break;
+    }
+}
+
+void Resource::RemoveJoiners(const Request &aRequest, Response &aResponse) const
+{
+    otbrError                 error      = OTBR_ERROR_NONE;
+    uint16_t                  numRemoved = 0;
+    std::vector<otJoinerInfo> joiners;
+    agent::JoinerBatch        batch;
+    std::string               body;
+    std::string               errorCode;
+
+    VerifyOrExit(otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_ACTIVE, error = OTBR_ERROR_INVALID_STATE);
+
+    VerifyOrExit(Json::JsonJoinerIdArrayString2JoinerInfos(aRequest.GetBody(), joiners),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    for (const otJoinerInfo &joiner : joiners)
+    {
+        // The ids are only compared, the joiners to remove have no PSKd.
+        (void)batch.AddJoiner(joiner);
+    }
+
+    batch.RemoveFromCommissioner(mInstance, numRemoved);
+
+exit:
+    switch (error)
+    {
+    case OTBR_ERROR_NONE:
+        body = Json::Number2JsonString(numRemoved);
+        aResponse.SetBody(body);
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        break;
+    case OTBR_ERROR_INVALID_STATE:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusConflict);
+        break;
+    case OTBR_ERROR_INVALID_ARGS:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+        break;
+    default:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+        break;
+    }
+}
+
+void Resource::CommissionerJoinerBatch(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+
+    switch (aRequest.GetMethod())
+    {
+    case HttpMethod::kPost:
+        AddJoiners(aRequest, aResponse);
+        break;
+    case HttpMethod::kDelete:
+        RemoveJoiners(aRequest, aResponse);
+        break;
+    case HttpMethod::kOptions:
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetComplete();
+        break;
+    default:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+        break;
+    }
+}
+
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 void Resource::GetSrpServerState(Response &aResponse) const
 {
@@ -1225,6 +2171,61 @@ void Resource::SrpServerState(const Request &aRequest, Response &aResponse) cons
         break;
     }
 }
+
+void Resource::GetSrpServerHosts(const Request &aRequest, Response &aResponse) const
+{
+    otbrError                                   error    = OTBR_ERROR_NONE;
+    uint32_t                                    maxHosts = OTBR_SRP_SERVER_HOST_PAGE_MAX_HOSTS;
+    std::string                                 limit    = aRequest.GetQueryParameter(kSrpHostsLimitQuery);
+    std::string                                 nextCursor;
+    std::string                                 body;
+    std::string                                 errorCode;
+    std::vector<agent::SrpServerHostPage::Host> hosts;
+
+    if (!limit.empty())
+    {
+        char         *end;
+        unsigned long value = strtoul(limit.c_str(), &end, 10);
+
+        VerifyOrExit(*end == '\0' && value > 0 && value <= UINT32_MAX, error = OTBR_ERROR_INVALID_ARGS);
+        maxHosts = static_cast<uint32_t>(value);
+    }
+
+    SuccessOrExit(error = agent::SrpServerHostPage::Get(mInstance, aRequest.GetQueryParameter(kSrpHostsCursorQuery),
+                                                        aRequest.GetQueryParameter(kSrpHostsPrefixQuery), maxHosts,
+                                                        hosts, nextCursor));
+
+    body = Json::SrpServerHostPage2JsonString(hosts, nextCursor);
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
+}
+
+void Resource::SrpServerHosts(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+
+    switch (aRequest.GetMethod())
+    {
+    case HttpMethod::kGet:
+        GetSrpServerHosts(aRequest, aResponse);
+        break;
+    case HttpMethod::kOptions:
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetComplete();
+        break;
+    default:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+        break;
+    }
+}
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
 void Resource::GetSrpClientState(Response &aResponse) const
@@ -1476,6 +2477,57 @@ exit:
     }
 }
 
+void Resource::AddSrpClientServices(const Request &aRequest, Response &aResponse) const
+{
+    otbrError                                     error    = OTBR_ERROR_NONE;
+    size_t                                        numAdded = 0;
+    std::vector<otSrpClientBuffersServiceEntry *> entries;
+    std::string                                   errorCode;
+
+    SuccessOrExit(error = Json::JsonServiceArrayString2ServiceEntries(aRequest.GetBody(), mInstance, entries));
+
+    // The services added in a row are registered by a single SRP update, which the client sends after a short delay.
+    for (otSrpClientBuffersServiceEntry *entry : entries)
+    {
+        VerifyOrExit(otSrpClientAddService(mInstance, &entry->mService) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_INVALID_STATE);
+        numAdded++;
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        // The services not registered yet are cleared without notifying the server, so that none of them is.
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            if (i < numAdded)
+            {
+                (void)otSrpClientClearService(mInstance, &entries[i]->mService);
+            }
+            otSrpClientBuffersFreeService(mInstance, entries[i]);
+        }
+    }
+    if (error == OTBR_ERROR_INVALID_STATE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusConflict);
+    }
+    else if (error == OTBR_ERROR_INVALID_ARGS)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
+    else if (error == OTBR_ERROR_ERRNO)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInsufficientStorage);
+    }
+    else if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+    }
+}
+
 void Resource::DeleteSrpClientService(const Request &aRequest, Response &aResponse) const
 {
     otbrError                 error = OTBR_ERROR_NONE;
@@ -1525,6 +2577,7 @@ exit:
 void Resource::SrpClientService(const Request &aRequest, Response &aResponse) const
 {
     std::string errorCode;
+    size_t      bodyStart;
 
     switch (aRequest.GetMethod())
     {
@@ -1532,7 +2585,16 @@ void Resource::SrpClientService(const Request &aRequest, Response &aResponse) co
         GetSrpClientServices(aResponse);
         break;
     case HttpMethod::kPost:
-        AddSrpClientService(aRequest, aResponse);
+        // An array of services is registered at once.
+        bodyStart = aRequest.GetBody().find_first_not_of(" \t\r\n");
+        if (bodyStart != std::string::npos && aRequest.GetBody()[bodyStart] == '[')
+        {
+            AddSrpClientServices(aRequest, aResponse);
+        }
+        else
+        {
+            AddSrpClientService(aRequest, aResponse);
+        }
         break;
     case HttpMethod::kDelete:
         DeleteSrpClientService(aRequest, aResponse);
@@ -1548,101 +2610,90 @@ void Resource::SrpClientService(const Request &aRequest, Response &aResponse) co
     }
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+bool Resource::ParseDiagTlvTypes(const Request &aRequest, std::vector<uint8_t> &aTlvTypes)
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
+    std::istringstream query(aRequest.GetQueryParameter(kDiagTlvTypesQuery));
+    std::istringstream fields(aRequest.GetQueryParameter(kFieldsQuery));
+    std::string        tlvType;
+    std::string        field;
+    bool               valid = true;
+
+    while (std::getline(query, tlvType, ','))
     {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+        char         *end;
+        unsigned long value = strtoul(tlvType.c_str(), &end, 10);
 
-        if (duration >= kDiagResetTimeout)
-        {
-            eraseIt = mDiagSet.erase(eraseIt);
-        }
-        else
-        {
-            eraseIt++;
-        }
+        VerifyOrExit(!tlvType.empty() && *end == '\0' && value <= UINT8_MAX, valid = false);
+        VerifyOrExit(DiagnosticCollector::IsTlvTypeCollected(static_cast<uint8_t>(value)), valid = false);
+        aTlvTypes.push_back(static_cast<uint8_t>(value));
     }
-}
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
-{
-    DiagInfo value;
+    // The fields are selected by their TLVs, so that the other TLVs are neither copied nor serialized.
+    while (std::getline(fields, field, ','))
+    {
+        uint8_t type;
+
+        VerifyOrExit(Json::DiagField2TlvType(field, type), valid = false);
+        VerifyOrExit(DiagnosticCollector::IsTlvTypeCollected(type), valid = false);
+        aTlvTypes.push_back(type);
+    }
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+exit:
+    return valid;
 }
 
-void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+void Resource::GetDiagnostics(const std::vector<uint8_t> &aTlvTypes, Response &aResponse) const
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
-    struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
-    struct otIp6Address multicastAddress;
-
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
+    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
 
-exit:
+    mDiagnosticCollector.GetDiagnostics(aTlvTypes, diagContentSet);
 
-    if (error == OTBR_ERROR_NONE)
-    {
-        aResponse.SetStartTime(steady_clock::now());
-        aResponse.SetCallback();
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
-    }
-}
+    // The collected diagnostics are copied, so that they are serialized by a worker.
+    RunOnWorker(
+        aResponse,
+        [diagContentSet = std::move(diagContentSet)]() -> Response::Completion {
+            std::string body = Json::Diag2JsonString(diagContentSet);
 
-void Resource::DiagnosticResponseHandler(otError              aError,
-                                         otMessage           *aMessage,
-                                         const otMessageInfo *aMessageInfo,
-                                         void                *aContext)
-{
-    static_cast<Resource *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
+            return [body](Response &aDeferredResponse) mutable {
+                std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+
+                aDeferredResponse.SetResponsCode(errorCode);
+                aDeferredResponse.SetBody(body);
+                aDeferredResponse.SetComplete();
+            };
+        },
+        /* aUrgent */ false);
 }
 
-void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
+void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
 {
-    std::vector<otNetworkDiagTlv> diagSet;
-    otNetworkDiagTlv              diagTlv;
-    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
+    otbrError            error = OTBR_ERROR_NONE;
+    std::vector<uint8_t> tlvTypes;
 
-    SuccessOrExit(aError);
+    VerifyOrExit(ParseDiagTlvTypes(aRequest, tlvTypes), ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
 
-    OTBR_UNUSED_VARIABLE(aMessageInfo);
+    // Reading the cache keeps the background refresh running.
+    mDiagnosticCollector.KeepRefreshing();
 
-    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
+    if (mDiagnosticCollector.IsEmpty())
     {
-        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
-        {
-            snprintf(rloc, sizeof(rloc), "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
-        }
-        diagSet.push_back(diagTlv);
+        // Nothing was collected yet, wait for the routers to answer before responding.
+        SuccessOrExit(error = mDiagnosticCollector.RefreshAll());
+        aResponse.SetStartTime(MainloopClock::Now());
+        aResponse.SetCallback();
+
+        // Respond with whatever was collected if some routers don't answer.
+        mHost->PostTimerTask(Milliseconds(kDiagCollectTimeout / 1000), [this]() { ResumeCallbacks(); });
+    }
+    else
+    {
+        GetDiagnostics(tlvTypes, aResponse);
     }
-    UpdateDiag(keyRloc, diagSet);
 
 exit:
-    if (aError != OT_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE)
     {
-        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
     }
 }
 
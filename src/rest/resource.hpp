@@ -36,18 +36,25 @@
 
 #include "openthread-br/config.h"
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include <openthread/border_agent.h>
 #include <openthread/border_router.h>
 
 #include "common/api_strings.hpp"
+#include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 #include "openthread/dataset.h"
 #include "openthread/dataset_ftd.h"
+#include "rest/diagnostic_collector.hpp"
+#include "rest/event_publisher.hpp"
 #include "rest/json.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "rest/worker_pool.hpp"
 #include "utils/thread_helper.hpp"
 
 using otbr::Ncp::RcpHost;
@@ -66,10 +73,11 @@ public:
     /**
      * The constructor initializes the resource handler instance.
      *
-     * @param[in] aHost  A pointer to the Thread controller.
+     * @param[in] aHost       A pointer to the Thread controller.
+     * @param[in] aPublisher  A reference to the mDNS publisher, whose telemetry is exported with the metrics.
      *
      */
-    Resource(RcpHost *aHost);
+    Resource(RcpHost *aHost, const Mdns::Publisher &aPublisher);
 
     /**
      * This method initialize the Resource handler.
@@ -97,6 +105,38 @@ public:
      */
     void HandleCallback(Request &aRequest, Response &aResponse);
 
+    /**
+     * This method sets the handler to resume the connections waiting for a callback.
+     *
+     * The handler is invoked from a posted task whenever a callback may be able to complete, thus the connections
+     * don't need to check their callbacks repeatedly.
+     *
+     * @param[in] aHandler  The handler to resume the connections waiting for a callback.
+     *
+     */
+    void SetCallbackResumeHandler(std::function<void(void)> aHandler) { mCallbackResumeHandler = std::move(aHandler); }
+
+    /**
+     * This method sets the worker pool running the CPU-heavy parts of the handlers.
+     *
+     * @param[in] aWorkerPool  A pointer to the worker pool.
+     *
+     */
+    void SetWorkerPool(WorkerPool *aWorkerPool) { mWorkerPool = aWorkerPool; }
+
+    /**
+     * This method serves a GET request from the snapshots of the resources, without accessing the OpenThread instance.
+     *
+     * This method is thread-safe, the snapshots are only updated on the mainloop.
+     *
+     * @param[in]  aRequest   A complete request.
+     * @param[out] aResponse  The response set from the snapshot if there is a fresh one.
+     *
+     * @returns Whether the request is served from a snapshot.
+     *
+     */
+    bool ServeSnapshot(const Request &aRequest, Response &aResponse) const;
+
     /**
      * This method provides a quick handler, which could directly set response code of a response and set error code and
      * error message to the request body.
@@ -107,6 +147,14 @@ public:
      */
     void ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const;
 
+    /**
+     * This method returns the publisher of the events sent to the event stream clients.
+     *
+     * @returns A reference to the event publisher.
+     *
+     */
+    EventPublisher &GetEventPublisher(void) const { return mEventPublisher; }
+
 private:
     /**
      * This enumeration represents the Dataset type (active or pending).
@@ -118,6 +166,22 @@ private:
         kPending, ///< Pending Dataset
     };
 
+    struct SnapshotPolicy
+    {
+        otChangedFlags mInvalidatedFlags; ///< The Thread state changes invalidating the snapshot.
+        uint32_t       mMaxAge;           ///< The maximum age in microseconds, or 0 if only invalidated by changes.
+    };
+
+    struct Snapshot
+    {
+        std::string              mCode;
+        std::string              mContentType;
+        std::string              mBody;
+        std::string              mETag;
+        otChangedFlags           mInvalidatedFlags;
+        steady_clock::time_point mExpireTime;
+    };
+
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
     void NodeInfo(const Request &aRequest, Response &aResponse) const;
@@ -136,12 +200,27 @@ private:
     void IpaddrMleid(const Request &aRequest, Response &aResponse) const;
     void CommissionerState(const Request &aRequest, Response &aResponse) const;
     void CommissionerJoiner(const Request &aRequest, Response &aResponse) const;
+    void CommissionerJoinerBatch(const Request &aRequest, Response &aResponse) const;
     void SrpServerState(const Request &aRequest, Response &aResponse) const;
+    void SrpServerHosts(const Request &aRequest, Response &aResponse) const;
     void SrpClientState(const Request &aRequest, Response &aResponse) const;
     void SrpClientHost(const Request &aRequest, Response &aResponse) const;
     void SrpClientService(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
+    void Events(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+#if OTBR_ENABLE_MAINLOOP_STATS
+    void MainloopStats(const Request &aRequest, Response &aResponse) const;
+#endif
+    void MemoryStats(const Request &aRequest, Response &aResponse) const;
+    void Metrics(const Request &aRequest, Response &aResponse) const;
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    void LinkMetrics(const Request &aRequest, Response &aResponse) const;
+#endif
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    void ChannelQuality(const Request &aRequest, Response &aResponse) const;
+#endif
+    void CoexMetrics(const Request &aRequest, Response &aResponse) const;
 
     void GetNodeInfo(Response &aResponse) const;
     void DeleteNodeInfo(Response &aResponse) const;
@@ -161,11 +240,14 @@ private:
     void GetIpaddrMleid(Response &aResponse) const;
     void GetCommissionerState(Response &aResponse) const;
     void SetCommissionerState(const Request &aRequest, Response &aResponse) const;
-    void GetJoiners(Response &aResponse) const;
+    void GetJoiners(const Request &aRequest, Response &aResponse) const;
     void AddJoiner(const Request &aRequest, Response &aResponse) const;
     void RemoveJoiner(const Request &aRequest, Response &aResponse) const;
+    void AddJoiners(const Request &aRequest, Response &aResponse) const;
+    void RemoveJoiners(const Request &aRequest, Response &aResponse) const;
     void GetSrpServerState(Response &aResponse) const;
     void SetSrpServerState(const Request &aRequest, Response &aResponse) const;
+    void GetSrpServerHosts(const Request &aRequest, Response &aResponse) const;
     void GetSrpClientState(Response &aResponse) const;
     void SetSrpClientState(const Request &aRequest, Response &aResponse) const;
     void GetSrpClientHost(Response &aResponse) const;
@@ -173,24 +255,77 @@ private:
     void DeleteSrpClientHost(Response &aResponse) const;
     void GetSrpClientServices(Response &aResponse) const;
     void AddSrpClientService(const Request &aRequest, Response &aResponse) const;
+    void AddSrpClientServices(const Request &aRequest, Response &aResponse) const;
     void DeleteSrpClientService(const Request &aRequest, Response &aResponse) const;
+#if OTBR_ENABLE_MAINLOOP_STATS
+    void GetMainloopStats(Response &aResponse) const;
+#endif
+    void GetMemoryStats(Response &aResponse) const;
+    void GetMetrics(Response &aResponse) const;
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    void GetLinkMetrics(Response &aResponse) const;
+#endif
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    void GetChannelQuality(Response &aResponse) const;
+#endif
+    void GetCoexMetrics(Response &aResponse) const;
+
+    static std::string GetSnapshotKey(const std::string &aUrl, const Request &aRequest);
+    bool               ServeSnapshot(const std::string &aUrl, const Request &aRequest, Response &aResponse) const;
+    void               UpdateSnapshot(const std::string &aUrl, const Request &aRequest, Response &aResponse) const;
+    void RespondWithSnapshot(const Snapshot &aSnapshot, const Request &aRequest, Response &aResponse) const;
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+
+    void        PublishRoleEvent(void) const;
+    void        HandleDiagnosticUpdated(const DiagInfo &aDiagInfo) const;
+    void        HandleNeighborTableChanged(const std::vector<agent::NeighborTableTracker::Change> &aChanges,
+                                           uint32_t                                                aGeneration) const;
+    static void HandleSrpClientEvent(otError                    aError,
+                                     const otSrpClientHostInfo *aHostInfo,
+                                     const otSrpClientService  *aServices,
+                                     const otSrpClientService  *aRemovedServices,
+                                     void                      *aContext);
+    void        HandleSrpClientEvent(const otSrpClientHostInfo &aHostInfo);
+
+    void ResumeCallbacks(void) const;
+    void RunOnWorker(Response &aResponse, std::function<Response::Completion(void)> aWork, bool aUrgent) const;
+
+    static otbrError ParseDataset(DatasetType           aDatasetType,
+                                  bool                  aIsTlv,
+                                  const std::string    &aBody,
+                                  otOperationalDataset &aDataset);
+    void             ApplyDataset(DatasetType                 aDatasetType,
+                                  otbrError                   aParseError,
+                                  const otOperationalDataset &aDataset,
+                                  Response                   &aResponse) const;
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    static const JsonWriter::FieldSet *GetFieldFilter(const Request &aRequest, JsonWriter::FieldSet &aFields);
 
-    static void DiagnosticResponseHandler(otError              aError,
-                                          otMessage           *aMessage,
-                                          const otMessageInfo *aMessageInfo,
-                                          void                *aContext);
-    void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    static bool ParseDiagTlvTypes(const Request &aRequest, std::vector<uint8_t> &aTlvTypes);
+    void        GetDiagnostics(const std::vector<uint8_t> &aTlvTypes, Response &aResponse) const;
 
-    otInstance *mInstance;
-    RcpHost    *mHost;
+    otInstance            *mInstance;
+    RcpHost               *mHost;
+    const Mdns::Publisher &mPublisher;
 
     std::unordered_map<std::string, ResourceHandler>         mResourceMap;
     std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    mutable DiagnosticCollector mDiagnosticCollector;
+
+    std::function<void(void)> mCallbackResumeHandler;
+    mutable bool              mCallbackResumePending;
+    WorkerPool               *mWorkerPool;
+
+    mutable EventPublisher mEventPublisher;
+    otSrpClientItemState   mSrpClientHostState;
+
+    std::unordered_map<std::string, SnapshotPolicy> mSnapshotPolicies;
+
+    // The cached GET responses keyed by resource, also served by the acceptor threads. A served snapshot is kept by its
+    // shared pointer, so the mutex is only held to look it up or replace it.
+    mutable std::unordered_map<std::string, std::shared_ptr<const Snapshot>> mSnapshots;
+    mutable std::mutex                                                        mSnapshotMutex;
 };
 
 } // namespace rest
@@ -28,7 +28,16 @@
 
 #include "rest/response.hpp"
 
+#include <algorithm>
+
 #include <stdio.h>
+#include <string.h>
+
+#if OTBR_ENABLE_REST_GZIP
+#include <zlib.h>
+#endif
+
+#include "common/code_utils.hpp"
 
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
@@ -37,12 +46,26 @@
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD "DELETE, GET, OPTIONS, PUT"
 #define OT_REST_RESPONSE_CONNECTION "close"
 
+// Bodies larger than this (in bytes) are sent with the chunked transfer encoding if allowed
+static const size_t kChunkedEncodingThreshold = 16384;
+
+// The size (in bytes) of each chunk of a chunked body
+static const size_t kChunkSize = 4096;
+
+#if OTBR_ENABLE_REST_GZIP
+// Bodies smaller than this (in bytes) are not worth compressing
+static const size_t kGzipThreshold = 1024;
+#endif
+
 namespace otbr {
 namespace rest {
 
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mChunkedEncodingAllowed(false)
+    , mGzipAllowed(false)
+    , mStream(false)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1";
@@ -85,6 +108,23 @@ void Response::SetContentType(const std::string &aContentType)
     mHeaders[OT_REST_CONTENT_TYPE_HEADER] = aContentType;
 }
 
+std::string Response::GetContentType(void) const
+{
+    auto it = mHeaders.find(OT_REST_CONTENT_TYPE_HEADER);
+
+    return (it == mHeaders.end()) ? "" : it->second;
+}
+
+std::string Response::GetResponseCode(void) const
+{
+    return mCode;
+}
+
+void Response::SetHeader(const std::string &aField, const std::string &aValue)
+{
+    mHeaders[aField] = aValue;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
@@ -95,29 +135,186 @@ void Response::SetBody(std::string &aBody)
     mBody = aBody;
 }
 
-std::string Response::GetBody(void) const
+const std::string &Response::GetBody(void) const
 {
     return mBody;
 }
 
+void Response::SetStream(void)
+{
+    mStream = true;
+}
+
+bool Response::IsStream(void) const
+{
+    return mStream;
+}
+
 bool Response::NeedCallback(void)
 {
     return mCallback;
 }
 
-std::string Response::Serialize(void) const
+std::shared_ptr<Response::Completion> Response::SetDeferred(void)
+{
+    mCallback = true;
+    mDeferred = std::make_shared<Completion>();
+
+    return mDeferred;
+}
+
+bool Response::IsDeferred(void) const
+{
+    return mDeferred != nullptr;
+}
+
+void Response::CompleteDeferred(void)
+{
+    Completion completion;
+
+    VerifyOrExit(mDeferred != nullptr && *mDeferred);
+
+    completion = std::move(*mDeferred);
+    mDeferred.reset();
+    completion(*this);
+
+exit:
+    return;
+}
+
+void Response::SetChunkedEncodingAllowed(bool aAllowed)
+{
+    mChunkedEncodingAllowed = aAllowed;
+}
+
+void Response::SetGzipAllowed(bool aAllowed)
 {
-    std::string spacer = "\r\n";
-    std::string ret(mProtocol + " " + mCode);
+    mGzipAllowed = aAllowed;
+}
+
+#if OTBR_ENABLE_REST_GZIP
+bool Response::Gzip(const std::string &aInput, std::string &aOutput)
+{
+    z_stream stream;
+    int      ret;
+    bool     done = false;
+
+    memset(&stream, 0, sizeof(stream));
+
+    // A window of 15 bits, plus 16 to write the gzip header and trailer.
+    VerifyOrExit(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+
+    stream.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(aInput.data()));
+    stream.avail_in = static_cast<uInt>(aInput.size());
+    aOutput.clear();
+
+    // The body is deflated to fixed-size pieces of output, so that no bound of the whole output is allocated.
+    do
+    {
+        size_t offset = aOutput.size();
+
+        aOutput.resize(offset + kChunkSize);
+        stream.next_out  = reinterpret_cast<Bytef *>(&aOutput[offset]);
+        stream.avail_out = static_cast<uInt>(kChunkSize);
+        ret              = deflate(&stream, Z_FINISH);
+        aOutput.resize(offset + kChunkSize - stream.avail_out);
+    } while (ret == Z_OK);
+
+    done = (ret == Z_STREAM_END);
+    deflateEnd(&stream);
+
+exit:
+    return done;
+}
+#endif
+
+void Response::Serialize(std::vector<struct iovec> &aBuffers)
+{
+    static const char  kSpacer[]        = "\r\n";
+    static const char  kLastChunk[]     = "0\r\n\r\n";
+    std::string        spacer           = kSpacer;
+    const std::string *body             = &mBody;
+    bool               chunked          = false;
+    size_t             chunkHeaderStart = 0;
+
+#if OTBR_ENABLE_REST_GZIP
+    // Only large bodies are compressed, an event stream is written as is.
+    if (mGzipAllowed && !mStream && mBody.size() >= kGzipThreshold && mCode.compare(0, 3, "304") != 0 &&
+        Gzip(mBody, mEncodedBody) && mEncodedBody.size() < mBody.size())
+    {
+        body                         = &mEncodedBody;
+        mHeaders["Content-Encoding"] = "gzip";
+    }
+    if (!mStream)
+    {
+        mHeaders["Vary"] = "Accept-Encoding";
+    }
+#endif
+
+    // The body of an event stream is only the first events, which is never chunked.
+    chunked            = mChunkedEncodingAllowed && body->size() > kChunkedEncodingThreshold && !mStream;
+    mSerializedHeaders = mProtocol + " " + mCode;
 
     for (const auto &header : mHeaders)
     {
-        ret += (spacer + header.first + ": " + header.second);
+        mSerializedHeaders += (spacer + header.first + ": " + header.second);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
 
-    return ret;
+    if (chunked)
+    {
+        mSerializedHeaders += spacer + "Transfer-Encoding: chunked" + spacer + spacer;
+    }
+    else
+    {
+        // A 304 response has no body and must not announce the length of the unmodified one, the length of an event
+        // stream is unknown.
+        if (!mStream && mCode.compare(0, 3, "304") != 0)
+        {
+            mSerializedHeaders += spacer + "Content-Length: " + std::to_string(body->size());
+        }
+        mSerializedHeaders += spacer + spacer;
+    }
+
+    // The chunk headers are all formatted before referring to them, so that their storage is not reallocated.
+    mSerializedChunkHeaders.clear();
+    for (size_t offset = 0; chunked && offset < body->size(); offset += kChunkSize)
+    {
+        char chunkHeader[sizeof("ffffffffffffffff\r\n")];
+
+        snprintf(chunkHeader, sizeof(chunkHeader), "%zx\r\n", std::min(kChunkSize, body->size() - offset));
+        mSerializedChunkHeaders += chunkHeader;
+    }
+
+    aBuffers.clear();
+    AddBuffer(aBuffers, mSerializedHeaders.data(), mSerializedHeaders.size());
+
+    if (chunked)
+    {
+        for (size_t offset = 0; offset < body->size(); offset += kChunkSize)
+        {
+            size_t chunkHeaderEnd = mSerializedChunkHeaders.find('\n', chunkHeaderStart) + 1;
+
+            AddBuffer(aBuffers, &mSerializedChunkHeaders[chunkHeaderStart], chunkHeaderEnd - chunkHeaderStart);
+            AddBuffer(aBuffers, &(*body)[offset], std::min(kChunkSize, body->size() - offset));
+            AddBuffer(aBuffers, kSpacer, sizeof(kSpacer) - 1);
+            chunkHeaderStart = chunkHeaderEnd;
+        }
+        AddBuffer(aBuffers, kLastChunk, sizeof(kLastChunk) - 1);
+    }
+    else if (!body->empty())
+    {
+        AddBuffer(aBuffers, body->data(), body->size());
+    }
+}
+
+void Response::AddBuffer(std::vector<struct iovec> &aBuffers, const char *aData, size_t aLength)
+{
+    struct iovec buffer;
+
+    // The buffers are only read by `writev()`.
+    buffer.iov_base = const_cast<char *>(aData);
+    buffer.iov_len  = aLength;
+    aBuffers.push_back(buffer);
 }
 
 } // namespace rest
@@ -37,8 +37,13 @@
 #include "openthread-br/config.h"
 
 #include <chrono>
+#include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
+
+#include <sys/uio.h>
 
 #include "rest/types.hpp"
 
@@ -58,6 +63,12 @@ namespace rest {
 class Response
 {
 public:
+    /**
+     * This type represents the function completing a deferred response.
+     *
+     */
+    using Completion = std::function<void(Response &aResponse)>;
+
     /**
      * The constructor to initialize a response instance.
      *
@@ -78,7 +89,7 @@ public:
      *
      * @returns A string containing the body field.
      */
-    std::string GetBody(void) const;
+    const std::string &GetBody(void) const;
 
     /**
      * This method set the response code.
@@ -96,6 +107,31 @@ public:
      */
     void SetContentType(const std::string &aContentType);
 
+    /**
+     * This method returns the content type.
+     *
+     * @returns A string representing response content type such as text/plain.
+     *
+     */
+    std::string GetContentType(void) const;
+
+    /**
+     * This method returns the response code.
+     *
+     * @returns A string representing the response code such as "200 OK".
+     *
+     */
+    std::string GetResponseCode(void) const;
+
+    /**
+     * This method sets a header field of this response.
+     *
+     * @param[in] aField  A string of the header field name.
+     * @param[in] aValue  A string of the header field value.
+     *
+     */
+    void SetHeader(const std::string &aField, const std::string &aValue);
+
     /**
      * This method labels the response as need callback.
      *
@@ -110,6 +146,44 @@ public:
      */
     bool NeedCallback(void);
 
+    /**
+     * This method labels the response as deferred, which needs callback until its completion is set.
+     *
+     * The completion is set on the mainloop once the response can be completed, the slot outlives the response if
+     * the connection is closed meanwhile.
+     *
+     * @returns A shared pointer to the slot of the completion.
+     *
+     */
+    std::shared_ptr<Completion> SetDeferred(void);
+
+    /**
+     * This method checks whether this response is deferred.
+     *
+     * @returns A bool value indicates whether this response is waiting for its completion.
+     */
+    bool IsDeferred(void) const;
+
+    /**
+     * This method runs the completion of a deferred response if it has been set.
+     *
+     */
+    void CompleteDeferred(void);
+
+    /**
+     * This method labels the response as an event stream, whose body is followed by the events until the connection
+     * is closed.
+     *
+     */
+    void SetStream(void);
+
+    /**
+     * This method checks whether this response is an event stream.
+     *
+     * @returns A bool value indicates whether this response is an event stream.
+     */
+    bool IsStream(void) const;
+
     /**
      * This method labels the response as complete which means all fields has been successfully set.
      *
@@ -139,20 +213,56 @@ public:
     steady_clock::time_point GetStartTime() const;
 
     /**
-     * This method serialize a response to a string that could be sent by socket later.
+     * This method allows the body to be sent with the chunked transfer encoding.
+     *
+     * Only large bodies are chunked, and only if the client supports it.
+     *
+     * @param[in] aAllowed  Whether the chunked transfer encoding is allowed.
+     *
+     */
+    void SetChunkedEncodingAllowed(bool aAllowed);
+
+    /**
+     * This method allows the body to be compressed with the gzip content encoding.
+     *
+     * Only large bodies are compressed, and only if the REST server is built with gzip support.
+     *
+     * @param[in] aAllowed  Whether the gzip content encoding is allowed.
+     *
+     */
+    void SetGzipAllowed(bool aAllowed);
+
+    /**
+     * This method serializes a response to buffers that could be sent by socket later.
+     *
+     * The buffers refer to the body kept by this response instead of copying it, so the response must not be modified
+     * until all the buffers are sent.
+     *
+     * @param[out] aBuffers  The buffers containing status line, headers and body of the response.
      *
-     * @returns A string contains status line, headers and body of a response.
      */
-    std::string Serialize(void) const;
+    void Serialize(std::vector<struct iovec> &aBuffers);
 
 private:
+    static void AddBuffer(std::vector<struct iovec> &aBuffers, const char *aData, size_t aLength);
+#if OTBR_ENABLE_REST_GZIP
+    static bool Gzip(const std::string &aInput, std::string &aOutput);
+#endif
+
     bool                               mCallback;
     std::map<std::string, std::string> mHeaders;
     std::string                        mCode;
     std::string                        mProtocol;
     std::string                        mBody;
     bool                               mComplete;
+    bool                               mChunkedEncodingAllowed;
+    bool                               mGzipAllowed;
+    bool                               mStream;
     steady_clock::time_point           mStartTime;
+    std::shared_ptr<Completion>        mDeferred;
+    std::string                        mSerializedHeaders;
+    std::string                        mSerializedChunkHeaders;
+    std::string                        mEncodedBody;
 };
 
 } // namespace rest
@@ -34,7 +34,13 @@
 #include <cerrno>
 
 #include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
 
+#include "common/mainloop_manager.hpp"
+#include "common/memory_stats.hpp"
 #include "utils/socket_utils.hpp"
 
 using std::chrono::duration_cast;
@@ -47,9 +53,51 @@ namespace rest {
 // Maximum number of connection a server support at the same time.
 static const uint32_t kMaxServeNum = 500;
 
-RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort)
-    : mResource(Resource(&aHost))
+static bool IsPeerAuthorized(int32_t aFd)
+{
+    bool authorized = false;
+
+#ifdef SO_PEERCRED
+    struct ucred credentials;
+    socklen_t    length = sizeof(credentials);
+
+    VerifyOrExit(getsockopt(aFd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) == 0);
+
+    // The socket permissions let the group of the agent connect, the same peers are authorized.
+    authorized = credentials.uid == 0 || credentials.uid == geteuid() || credentials.gid == getegid();
+    otbrLogDebug("UNIX socket peer pid %d uid %u gid %u is %sauthorized", static_cast<int>(credentials.pid),
+                 static_cast<unsigned>(credentials.uid), static_cast<unsigned>(credentials.gid),
+                 authorized ? "" : "not ");
+
+exit:
+#else
+    OTBR_UNUSED_VARIABLE(aFd);
+
+    // The peer credentials are not available, only the socket permissions restrict the peers.
+    authorized = true;
+#endif
+    return authorized;
+}
+
+RestWebServer::RestWebServer(RcpHost               &aHost,
+                             const Mdns::Publisher &aPublisher,
+                             const std::string     &aRestListenAddress,
+                             int                    aRestListenPort,
+                             const std::string     &aRestUnixSocketPath)
+    : mResource(&aHost, aPublisher)
     , mListenFd(-1)
+    , mUnixSocketPath(aRestUnixSocketPath)
+    , mUnixListenFd(-1)
+    , mAdmissionControl(OTBR_REST_ADMISSION_RATE, OTBR_REST_ADMISSION_BURST)
+    , mEvictedCount(0)
+    , mWorkerPool(OTBR_REST_WORKER_THREADS)
+    , mAcceptorPool(
+          [this](const std::string &aSource, const Request &aRequest, Response &aResponse) {
+              return ServeOnAcceptor(aSource, aRequest, aResponse);
+          },
+          [this](int aFd, const std::string &aSource, const std::string &aReceived) {
+              HandOverConnection(aFd, aSource, aReceived);
+          })
 {
     mAddress.sin6_family = AF_INET6;
     mAddress.sin6_addr   = in6addr_any;
@@ -61,39 +109,102 @@ RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddre
             otbrLogWarning("Failed to parse REST listen address %s, listening on any address.",
                            aRestListenAddress.c_str());
     }
+
+    MemoryStats &memoryStats = MemoryStats::GetInstance();
+
+    memoryStats.AddCounter(this, "rest.connections", [this]() { return mConnectionSet.size(); });
+    memoryStats.AddCounter(this, "rest.connections.evicted", [this]() { return mEvictedCount; });
+    memoryStats.AddCounter(this, "rest.requests.rejected", [this]() { return mAdmissionControl.GetRejectedCount(); });
+    memoryStats.AddCounter(this, "rest.requests.queued", [this]() { return mWorkerPool.GetQueuedCount(); });
+    memoryStats.AddCounter(this, "rest.requests.served_off_mainloop",
+                           [this]() { return mAcceptorPool.GetServedCount(); });
+    memoryStats.AddCounter(this, "rest.connections.handed_over",
+                           [this]() { return mAcceptorPool.GetHandedOverCount(); });
 }
 
 RestWebServer::~RestWebServer(void)
 {
+    MemoryStats::GetInstance().RemoveCounters(this);
+    mAcceptorPool.Stop();
+
     if (mListenFd != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mListenFd);
         close(mListenFd);
     }
+
+    if (mUnixListenFd != -1)
+    {
+        MainloopManager::GetInstance().RemoveFd(mUnixListenFd);
+        close(mUnixListenFd);
+        unlink(mUnixSocketPath.c_str());
+    }
 }
 
 void RestWebServer::Init(void)
 {
     mResource.Init();
+    mResource.SetCallbackResumeHandler([this]() { ResumeConnections(); });
+    mResource.SetWorkerPool(&mWorkerPool);
     InitializeListenFd();
+    InitializeUnixListenFd();
+    StartAcceptors();
+
+    MainloopManager::GetInstance().AddFd(
+        mListenFd, MainloopManager::kEventReadable,
+        [this](uint8_t aEvents) { HandleListenFdEvents(mListenFd, aEvents); }, GetName());
+
+    if (mUnixListenFd != -1)
+    {
+        MainloopManager::GetInstance().AddFd(
+            mUnixListenFd, MainloopManager::kEventReadable,
+            [this](uint8_t aEvents) { HandleListenFdEvents(mUnixListenFd, aEvents); }, GetName());
+    }
 }
 
 void RestWebServer::Update(MainloopContext &aMainloop)
 {
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    OTBR_UNUSED_VARIABLE(aMainloop);
 
+    // The listen fd is registered to the `MainloopManager`, there is nothing to add to the fd sets.
     return;
 }
 
 void RestWebServer::Process(const MainloopContext &aMainloop)
 {
-    UpdateConnections(aMainloop.mReadFdSet);
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    UpdateConnections();
 }
 
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
+void RestWebServer::HandleListenFdEvents(int32_t aListenFd, uint8_t aEvents)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aEvents & MainloopManager::kEventReadable);
+
+    // Create new connection if listenfd is readable, an idle kept alive connection gives way to it.
+    if (mConnectionSet.size() < kMaxServeNum || EvictIdleConnection())
+    {
+        error = Accept(aListenFd);
+    }
+
+    // Stop watching the listen fds until some connections are released.
+    if (mConnectionSet.size() >= kMaxServeNum)
+    {
+        UpdateListenFds(0);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarningRateLimited("Failed to accept new connection: %s", otbrErrorString(error));
+    }
+}
+
+void RestWebServer::UpdateConnections(void)
+{
+    auto eraseIt = mConnectionSet.begin();
 
     // Erase useless connections
     for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
@@ -102,6 +213,8 @@ void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
 
         if (connection->IsComplete())
         {
+            otbrLogDebugRateLimited("Connection %d closed after %u requests", eraseIt->first,
+                                    connection->GetRequestCount());
             eraseIt = mConnectionSet.erase(eraseIt);
         }
         else
@@ -110,15 +223,53 @@ void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
         }
     }
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+    if (mConnectionSet.size() < kMaxServeNum)
     {
-        error = Accept(mListenFd);
+        UpdateListenFds(MainloopManager::kEventReadable);
     }
+}
 
-    if (error != OTBR_ERROR_NONE)
+bool RestWebServer::EvictIdleConnection(void)
+{
+    auto evictIt = mConnectionSet.end();
+    bool evicted = false;
+
+    // The connection idle for the longest time is the least likely to send another request.
+    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
     {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+        if (it->second->IsIdle() &&
+            (evictIt == mConnectionSet.end() || it->second->GetTimeStamp() < evictIt->second->GetTimeStamp()))
+        {
+            evictIt = it;
+        }
+    }
+
+    VerifyOrExit(evictIt != mConnectionSet.end());
+
+    otbrLogDebug("Connection %d evicted after %u requests", evictIt->first, evictIt->second->GetRequestCount());
+    mConnectionSet.erase(evictIt);
+    mEvictedCount++;
+    evicted = true;
+
+exit:
+    return evicted;
+}
+
+void RestWebServer::UpdateListenFds(uint8_t aEvents)
+{
+    MainloopManager::GetInstance().UpdateFd(mListenFd, aEvents);
+
+    if (mUnixListenFd != -1)
+    {
+        MainloopManager::GetInstance().UpdateFd(mUnixListenFd, aEvents);
+    }
+}
+
+void RestWebServer::ResumeConnections(void)
+{
+    for (auto &connection : mConnectionSet)
+    {
+        connection.second->ResumeCallback();
     }
 }
 
@@ -140,7 +291,7 @@ bool RestWebServer::ParseListenAddress(const std::string listenAddress, struct i
     return false;
 }
 
-void RestWebServer::InitializeListenFd(void)
+otbrError RestWebServer::OpenListenFd(const sockaddr_in6 &aAddress, int32_t &aListenFd)
 {
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorMessage;
@@ -149,48 +300,223 @@ void RestWebServer::InitializeListenFd(void)
     int32_t     yes = 1;
     int32_t     no  = 0;
 
-    mListenFd = SocketWithCloseExec(AF_INET6, SOCK_STREAM, 0, kSocketNonBlock);
-    VerifyOrExit(mListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
+    aListenFd = SocketWithCloseExec(AF_INET6, SOCK_STREAM, 0, kSocketNonBlock);
+    VerifyOrExit(aListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
 
-    ret = setsockopt(mListenFd, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char *>(&no), sizeof(no));
+    ret = setsockopt(aListenFd, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char *>(&no), sizeof(no));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt v6only");
 
-    ret = setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&yes), sizeof(yes));
+    ret = setsockopt(aListenFd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&yes), sizeof(yes));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt reuseaddr");
 
-    ret = bind(mListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), sizeof(mAddress));
+#ifdef SO_REUSEPORT
+    if (OTBR_REST_ACCEPTOR_THREADS > 0)
+    {
+        // The sockets of the mainloop and the acceptor threads share the address, the kernel spreads the connections.
+        ret = setsockopt(aListenFd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char *>(&yes), sizeof(yes));
+        VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt reuseport");
+    }
+#endif
+
+    ret = bind(aListenFd, reinterpret_cast<const struct sockaddr *>(&aAddress), sizeof(aAddress));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
 
-    ret = listen(mListenFd, 5);
+    ret = listen(aListenFd, 5);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
 exit:
 
     if (error != OTBR_ERROR_NONE)
     {
-        otbrLogErr("InitializeListenFd error %s : %s", errorMessage.c_str(), strerror(err));
+        otbrLogErr("Listen fd error %s : %s", errorMessage.c_str(), strerror(err));
+
+        if (aListenFd != -1)
+        {
+            close(aListenFd);
+            aListenFd = -1;
+        }
     }
 
-    VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
+    return error;
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
+void RestWebServer::InitializeListenFd(void)
+{
+    VerifyOrDie(OpenListenFd(mAddress, mListenFd) == OTBR_ERROR_NONE, "otbr rest server init error");
+}
+
+void RestWebServer::ReplaceListenFd(int32_t aListenFd)
+{
+    if (mListenFd != -1)
+    {
+        MainloopManager::GetInstance().RemoveFd(mListenFd);
+        close(mListenFd);
+    }
+
+    mListenFd = aListenFd;
+    VerifyOrExit(mListenFd != -1);
+
+    // The listen fd stays unwatched if there are too many connections, see `HandleListenFdEvents()`.
+    MainloopManager::GetInstance().AddFd(
+        mListenFd, (mConnectionSet.size() < kMaxServeNum) ? MainloopManager::kEventReadable : 0,
+        [this](uint8_t aEvents) { HandleListenFdEvents(mListenFd, aEvents); }, GetName());
+
+exit:
+    return;
+}
+
+void RestWebServer::StartAcceptors(void)
+{
+    otbrError        error = OTBR_ERROR_NONE;
+    std::vector<int> listenFds;
+
+    VerifyOrExit(OTBR_REST_ACCEPTOR_THREADS > 0);
+
+#ifdef SO_REUSEPORT
+    for (size_t i = 0; i < OTBR_REST_ACCEPTOR_THREADS; i++)
+    {
+        int32_t listenFd;
+
+        SuccessOrExit(error = OpenListenFd(mAddress, listenFd));
+        listenFds.push_back(listenFd);
+    }
+
+    SuccessOrExit(error = mAcceptorPool.Start(listenFds));
+    listenFds.clear();
+    otbrLogInfo("Accepting REST connections on %d acceptor threads", OTBR_REST_ACCEPTOR_THREADS);
+#else
+    error = OTBR_ERROR_NOT_IMPLEMENTED;
+#endif
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        // The mainloop keeps accepting all the connections.
+        for (int listenFd : listenFds)
+        {
+            close(listenFd);
+        }
+        otbrLogWarning("Failed to start the REST acceptor threads: %s", otbrErrorString(error));
+    }
+}
+
+otbrError RestWebServer::SetListenAddress(const std::string &aListenAddress, int aListenPort)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    sockaddr_in6 address;
+    int32_t      listenFd;
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    address.sin6_addr   = in6addr_any;
+    address.sin6_port   = htons(aListenPort);
+
+    VerifyOrExit(aListenPort > 0 && aListenPort <= UINT16_MAX, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aListenAddress.empty() || ParseListenAddress(aListenAddress, &address.sin6_addr),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(address.sin6_port != mAddress.sin6_port ||
+                 memcmp(&address.sin6_addr, &mAddress.sin6_addr, sizeof(address.sin6_addr)) != 0);
+    VerifyOrExit(mListenFd != -1, mAddress = address);
+
+    // The accepted connections are kept, only the listen socket is replaced. The new socket is bound first so that
+    // the server keeps listening if it fails, unless the port is held by the current socket, e.g. when moving from
+    // or to the wildcard address.
+    if (OpenListenFd(address, listenFd) != OTBR_ERROR_NONE)
+    {
+        ReplaceListenFd(-1);
+
+        if ((error = OpenListenFd(address, listenFd)) != OTBR_ERROR_NONE)
+        {
+            VerifyOrDie(OpenListenFd(mAddress, listenFd) == OTBR_ERROR_NONE, "otbr rest server listen error");
+        }
+    }
+
+    ReplaceListenFd(listenFd);
+    SuccessOrExit(error);
+    mAddress = address;
+
+    mAcceptorPool.Stop();
+    StartAcceptors();
+
+exit:
+    otbrLogResult(error, "Set REST listen address [%s]:%d", aListenAddress.c_str(), aListenPort);
+    return error;
+}
+
+void RestWebServer::InitializeUnixListenFd(void)
 {
-    std::string errorMessage;
     otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
+    std::string errorMessage;
+    int32_t     ret;
+    int32_t     err = errno;
+    sockaddr_un address;
+    struct stat fileStat;
+
+    VerifyOrExit(!mUnixSocketPath.empty());
+    VerifyOrExit(mUnixSocketPath.size() < sizeof(address.sun_path), err = ENAMETOOLONG, error = OTBR_ERROR_REST,
+                 errorMessage = "unix socket path");
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, mUnixSocketPath.c_str(), mUnixSocketPath.size());
+
+    // Remove the socket left by a previous run, but never another kind of file.
+    if (lstat(mUnixSocketPath.c_str(), &fileStat) == 0 && S_ISSOCK(fileStat.st_mode))
+    {
+        unlink(mUnixSocketPath.c_str());
+    }
+
+    mUnixListenFd = SocketWithCloseExec(AF_UNIX, SOCK_STREAM, 0, kSocketNonBlock);
+    VerifyOrExit(mUnixListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix socket");
+
+    ret = bind(mUnixListenFd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address));
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix socket bind");
 
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
+    ret = chmod(mUnixSocketPath.c_str(), OTBR_REST_UNIX_SOCKET_MODE);
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix socket chmod");
+
+    ret = listen(mUnixListenFd, 5);
+    VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix socket listen");
+
+    otbrLogInfo("Listening on UNIX socket %s", mUnixSocketPath.c_str());
+
+exit:
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("InitializeUnixListenFd error %s : %s", errorMessage.c_str(), strerror(err));
+    }
+
+    VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
+}
+
+otbrError RestWebServer::Accept(int aListenFd)
+{
+    char             source[INET6_ADDRSTRLEN] = "unix";
+    std::string      errorMessage;
+    otbrError        error = OTBR_ERROR_NONE;
+    int32_t          err;
+    int32_t          fd;
+    sockaddr_storage peerAddress;
+    socklen_t        addrlen = sizeof(peerAddress);
+
+    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&peerAddress), &addrlen);
     err = errno;
 
     VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
 
+    VerifyOrExit(aListenFd != mUnixListenFd || IsPeerAuthorized(fd), err = EACCES, error = OTBR_ERROR_REST,
+                 errorMessage = "unix socket peer");
+
     VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
 
-    CreateNewConnection(fd);
+    // The requests are admitted by the address of the peer, the peers of the UNIX domain socket share one.
+    if (peerAddress.ss_family == AF_INET6)
+    {
+        inet_ntop(AF_INET6, &reinterpret_cast<sockaddr_in6 *>(&peerAddress)->sin6_addr, source, sizeof(source));
+    }
+
+    CreateNewConnection(fd, source, "");
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -200,21 +526,21 @@ exit:
             close(fd);
             fd = -1;
         }
-        otbrLogErr("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
+        otbrLogErrRateLimited("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
     }
 
     return error;
 }
 
-void RestWebServer::CreateNewConnection(int &aFd)
+void RestWebServer::CreateNewConnection(int &aFd, const std::string &aSource, const std::string &aReceived)
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    auto it = mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(
+                                              MainloopClock::Now(), &mResource, &mAdmissionControl, aSource, aFd)));
 
     if (it.second == true)
     {
         Connection *connection = it.first->second.get();
-        connection->Init();
+        connection->Init(aReceived);
     }
     else
     {
@@ -224,6 +550,47 @@ void RestWebServer::CreateNewConnection(int &aFd)
     }
 }
 
+void RestWebServer::HandOverConnection(int32_t aFd, const std::string &aSource, const std::string &aReceived)
+{
+    // A connection of an acceptor thread counts as a new one, an idle kept alive connection gives way to it.
+    if (mConnectionSet.size() >= kMaxServeNum && !EvictIdleConnection())
+    {
+        otbrLogWarningRateLimited("Too many connections, closing the one handed over by an acceptor thread");
+        close(aFd);
+        ExitNow();
+    }
+
+    CreateNewConnection(aFd, aSource, aReceived);
+
+    if (mConnectionSet.size() >= kMaxServeNum)
+    {
+        UpdateListenFds(0);
+    }
+
+exit:
+    return;
+}
+
+bool RestWebServer::ServeOnAcceptor(const std::string &aSource, const Request &aRequest, Response &aResponse)
+{
+    bool served = false;
+
+    // Only the fresh snapshots are served off the mainloop, they are admitted as the bulk GETs of the mainloop.
+    VerifyOrExit(mResource.ServeSnapshot(aRequest, aResponse));
+    served = true;
+
+    if (!mAdmissionControl.Admit(aSource, AdmissionControl::Priority::kBulk, MainloopClock::Now()))
+    {
+        otbrLogDebug("Rejected %s request from %s", aRequest.GetUrl().c_str(), aSource.c_str());
+        aResponse = Response();
+        mResource.ErrorHandler(aResponse, HttpStatusCode::kStatusTooManyRequests);
+        aResponse.SetHeader("Retry-After", "1");
+    }
+
+exit:
+    return served;
+}
+
 bool RestWebServer::SetFdNonblocking(int32_t fd)
 {
     int32_t oldMode;
@@ -41,11 +41,22 @@
 #include <sys/socket.h>
 
 #include "common/mainloop.hpp"
+#include "rest/acceptor_pool.hpp"
+#include "rest/admission_control.hpp"
 #include "rest/connection.hpp"
+#include "rest/worker_pool.hpp"
 
 using otbr::Ncp::RcpHost;
 using std::chrono::steady_clock;
 
+/**
+ * The permissions of the UNIX domain socket of the REST server.
+ *
+ */
+#ifndef OTBR_REST_UNIX_SOCKET_MODE
+#define OTBR_REST_UNIX_SOCKET_MODE 0660
+#endif
+
 namespace otbr {
 namespace rest {
 
@@ -59,10 +70,21 @@ public:
     /**
      * The constructor to initialize a REST server.
      *
-     * @param[in] aHost  A reference to the Thread controller.
+     * The connections accepted on the UNIX domain socket are only served if the peer is root, the user or in the
+     * group of the agent.
+     *
+     * @param[in] aHost                A reference to the Thread controller.
+     * @param[in] aPublisher           A reference to the mDNS publisher.
+     * @param[in] aRestListenAddress   The network address to listen on.
+     * @param[in] aRestListenPort      The network port to listen on.
+     * @param[in] aRestUnixSocketPath  The path of the UNIX domain socket to also listen on, empty to only use TCP.
      *
      */
-    RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort);
+    RestWebServer(RcpHost               &aHost,
+                  const Mdns::Publisher &aPublisher,
+                  const std::string     &aRestListenAddress,
+                  int                    aRestListenPort,
+                  const std::string     &aRestUnixSocketPath);
 
     /**
      * The destructor destroys the server instance.
@@ -76,15 +98,42 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method moves the REST server to another TCP listen address, the accepted connections are kept.
+     *
+     * The acceptor threads are restarted on the new address.
+     *
+     * @param[in] aListenAddress  The network address to listen on, empty to listen on any address.
+     * @param[in] aListenPort     The network port to listen on.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully listening on the address or already listening on it.
+     * @retval OTBR_ERROR_INVALID_ARGS  The address or the port is invalid.
+     * @retval OTBR_ERROR_REST          Failed to listen on the address, the server keeps listening on the previous
+     *                                  address.
+     *
+     */
+    otbrError SetListenAddress(const std::string &aListenAddress, int aListenPort);
+
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RestWebServer"; }
 
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
+    void      UpdateConnections(void);
+    void      ResumeConnections(void);
+    void      HandleListenFdEvents(int32_t aListenFd, uint8_t aEvents);
+    void      UpdateListenFds(uint8_t aEvents);
+    bool      EvictIdleConnection(void);
+    void      CreateNewConnection(int32_t &aFd, const std::string &aSource, const std::string &aReceived);
+    void      HandOverConnection(int32_t aFd, const std::string &aSource, const std::string &aReceived);
+    bool      ServeOnAcceptor(const std::string &aSource, const Request &aRequest, Response &aResponse);
     otbrError Accept(int32_t aListenFd);
     bool      ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
+    otbrError OpenListenFd(const sockaddr_in6 &aAddress, int32_t &aListenFd);
     void      InitializeListenFd(void);
+    void      ReplaceListenFd(int32_t aListenFd);
+    void      StartAcceptors(void);
+    void      InitializeUnixListenFd(void);
     bool      SetFdNonblocking(int32_t fd);
 
     // Resource handler
@@ -93,8 +142,18 @@ private:
     sockaddr_in6 mAddress;
     // File descriptor for listening
     int32_t mListenFd;
+    // Path and file descriptor of the UNIX domain socket
+    std::string mUnixSocketPath;
+    int32_t     mUnixListenFd;
     // Connection List
     std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    // Admission of the requests by source address, and number of idle connections closed to serve new ones
+    AdmissionControl mAdmissionControl;
+    size_t           mEvictedCount;
+    // Worker threads of the handlers, stopped before the resource handler is destroyed
+    WorkerPool mWorkerPool;
+    // Threads accepting the TCP connections besides the mainloop, stopped first
+    AcceptorPool mAcceptorPool;
 };
 
 } // namespace rest
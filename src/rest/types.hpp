@@ -45,10 +45,15 @@
 #include "openthread/netdiag.h"
 
 #define OT_REST_ACCEPT_HEADER "Accept"
+#define OT_REST_ACCEPT_ENCODING_HEADER "Accept-Encoding"
 #define OT_REST_CONTENT_TYPE_HEADER "Content-Type"
+#define OT_REST_ETAG_HEADER "ETag"
+#define OT_REST_IF_NONE_MATCH_HEADER "If-None-Match"
 
 #define OT_REST_CONTENT_TYPE_JSON "application/json"
 #define OT_REST_CONTENT_TYPE_PLAIN "text/plain"
+#define OT_REST_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
+#define OT_REST_CONTENT_TYPE_OPENMETRICS "application/openmetrics-text; version=1.0.0; charset=utf-8"
 
 using std::chrono::steady_clock;
 
@@ -71,11 +76,14 @@ enum class HttpStatusCode : std::uint16_t
     kStatusOk                  = 200,
     kStatusCreated             = 201,
     kStatusNoContent           = 204,
+    kStatusNotModified         = 304,
     kStatusBadRequest          = 400,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
     kStatusRequestTimeout      = 408,
     kStatusConflict            = 409,
+    kStatusPayloadTooLarge     = 413,
+    kStatusTooManyRequests     = 429,
     kStatusInternalServerError = 500,
     kStatusInsufficientStorage = 507,
 };
@@ -97,6 +105,7 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kStreamWait    = 8, ///< Wait for events to stream
 
 };
 struct NodeInfo
@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/worker_pool.hpp"
+
+namespace otbr {
+namespace rest {
+
+WorkerPool::WorkerPool(size_t aNumThreads)
+    : mStopping(false)
+{
+    for (size_t i = 0; i < aNumThreads; i++)
+    {
+        mThreads.emplace_back(&WorkerPool::RunJobs, this);
+    }
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+        mCondition.notify_all();
+    }
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void WorkerPool::Run(Work aWork, Work aCompletion, bool aUrgent)
+{
+    if (!IsEnabled())
+    {
+        aWork();
+        aCompletion();
+        ExitNow();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        (aUrgent ? mUrgentJobs : mJobs).push_back({std::move(aWork), std::move(aCompletion)});
+        mCondition.notify_one();
+    }
+
+exit:
+    return;
+}
+
+size_t WorkerPool::GetQueuedCount(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mJobs.size() + mUrgentJobs.size();
+}
+
+void WorkerPool::RunJobs(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true)
+    {
+        Job              job;
+        std::deque<Job> *jobs;
+
+        mCondition.wait(lock, [this]() { return mStopping || !mJobs.empty() || !mUrgentJobs.empty(); });
+        VerifyOrExit(!mStopping);
+
+        jobs = mUrgentJobs.empty() ? &mJobs : &mUrgentJobs;
+        job  = std::move(jobs->front());
+        jobs->pop_front();
+
+        lock.unlock();
+        job.mWork();
+        // The task runner is destroyed with the pool, so the completion is dropped if the pool goes first.
+        mTaskRunner.Post([completion = std::move(job.mCompletion)]() { completion(); });
+        lock.lock();
+    }
+
+exit:
+    return;
+}
+
+} // namespace rest
+} // namespace otbr
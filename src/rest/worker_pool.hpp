@@ -0,0 +1,138 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definition of the worker pool of the REST server.
+ */
+
+#ifndef OTBR_REST_WORKER_POOL_HPP_
+#define OTBR_REST_WORKER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+
+/**
+ * The number of threads running the CPU-heavy parts of the REST handlers, zero runs them on the mainloop.
+ *
+ */
+#ifndef OTBR_REST_WORKER_THREADS
+#define OTBR_REST_WORKER_THREADS 0
+#endif
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a pool of threads running the work which doesn't access the OpenThread instance, such as
+ * parsing and serializing, off the mainloop.
+ *
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    /**
+     * This type represents the work run by a worker thread, or its completion run on the mainloop.
+     *
+     */
+    using Work = std::function<void(void)>;
+
+    /**
+     * The constructor starts the worker threads.
+     *
+     * @param[in] aNumThreads  The number of worker threads, zero runs the work on the calling thread.
+     *
+     */
+    explicit WorkerPool(size_t aNumThreads);
+
+    /**
+     * The destructor stops the worker threads after their current work, the queued work is dropped.
+     *
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method indicates whether the work is run by worker threads.
+     *
+     * @returns Whether the work is run by worker threads.
+     *
+     */
+    bool IsEnabled(void) const { return !mThreads.empty(); }
+
+    /**
+     * This method runs a work by a worker thread, then its completion on the mainloop.
+     *
+     * Without any worker thread, both are run before returning. The urgent work, such as of the requests changing
+     * the state, is run before the queued work which isn't.
+     *
+     * @param[in] aWork        The work to run, which must not access the OpenThread instance.
+     * @param[in] aCompletion  The completion to run on the mainloop after the work.
+     * @param[in] aUrgent      Whether the work is run before the queued work which isn't urgent.
+     *
+     */
+    void Run(Work aWork, Work aCompletion, bool aUrgent = false);
+
+    /**
+     * This method returns the number of queued work, which isn't run by a worker thread yet.
+     *
+     * @returns The number of queued work.
+     *
+     */
+    size_t GetQueuedCount(void) const;
+
+private:
+    struct Job
+    {
+        Work mWork;
+        Work mCompletion;
+    };
+
+    void RunJobs(void);
+
+    TaskRunner               mTaskRunner;
+    mutable std::mutex       mMutex;
+    std::condition_variable  mCondition;
+    std::deque<Job>          mJobs;
+    std::deque<Job>          mUrgentJobs;
+    bool                     mStopping;
+    std::vector<std::thread> mThreads;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_WORKER_POOL_HPP_
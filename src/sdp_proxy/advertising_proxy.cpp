@@ -47,17 +47,31 @@
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
+#include "common/event_bus.hpp"
 #include "common/logging.hpp"
+#include "common/probes.hpp"
 
 namespace otbr {
 
+// The number of hosts published at a time by `PublishAllHostsAndServices()`.
+static constexpr uint16_t kHostsPerPublishRound = 32;
+
+// The interval between publishing two rounds of hosts.
+static constexpr Milliseconds kPublishRoundInterval = Milliseconds(100);
+
 AdvertisingProxy::AdvertisingProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mHost(aHost)
     , mPublisher(aPublisher)
     , mIsEnabled(false)
+    , mLastPublishedHost(nullptr)
+    , mIsPublishingHosts(false)
+    , mUpdateCounters()
+    , mCachedMeshLocalEid()
 {
-    mHost.RegisterResetHandler(
-        [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
+    mHost.RegisterResetHandler([this]() {
+        otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
+        GetSrpServerStats().Invalidate();
+    });
 }
 
 void AdvertisingProxy::SetEnabled(bool aIsEnabled)
@@ -80,6 +94,7 @@ exit:
 void AdvertisingProxy::Start(void)
 {
     otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
+    GetSrpServerStats().SetTracking(true);
 
     otbrLogInfo("Started");
 }
@@ -95,6 +110,10 @@ void AdvertisingProxy::Stop(void)
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
     }
 
+    // The hosts may be updated while the SRP server events are not received.
+    mCachedHosts.clear();
+    GetSrpServerStats().SetTracking(false);
+
     otbrLogInfo("Stopped");
 }
 
@@ -112,51 +131,187 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
 {
     OTBR_UNUSED_VARIABLE(aTimeout);
 
-    OutstandingUpdate *update = nullptr;
-    otbrError          error  = OTBR_ERROR_NONE;
+    OutstandingUpdate             *update       = nullptr;
+    otbrError                      error        = OTBR_ERROR_NONE;
+    std::string                    fullHostName = otSrpServerHostGetFullName(aHost);
+    Timepoint                      startTime    = Clock::now();
+    OutstandingUpdateMap::iterator it;
+
+    OTBR_PROBE(srp__advertising__start, aId, fullHostName.c_str());
 
     VerifyOrExit(IsEnabled());
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
-    update->mId = aId;
+    // The host is also notified before its lease expires and it's removed by the SRP server.
+    GetSrpServerStats().MarkHostStale(fullHostName);
+    mCachedHosts.erase(fullHostName);
+
+    // Renewals are acknowledged at once, even with too many outstanding updates, so that new registrations do not
+    // wait behind the mass renewals after a partition merge.
+    if (IsRenewal(aHost))
+    {
+        OutstandingUpdate renewal;
+
+        otbrLogInfo("SRP service update (id = %u) renews host %s", aId, fullHostName.c_str());
+        renewal.mId           = aId;
+        renewal.mFullHostName = fullHostName;
+        renewal.mClass        = UpdateClass::kRenewal;
+        renewal.mStartTime    = startTime;
+        FinishUpdate(renewal, OTBR_ERROR_NONE);
+        ExitNow();
+    }
+
+    // The publish forms derived to classify the update are discarded, the update is not committed yet.
+    mCachedHosts.erase(fullHostName);
+
+    if (mOutstandingUpdates.size() >= OTBR_SRP_ADVERTISING_PROXY_MAX_OUTSTANDING_UPDATES)
+    {
+        otbrLogWarning("Reject SRP service update (id = %u): %zu updates are outstanding", aId,
+                       mOutstandingUpdates.size());
+        mUpdateCounters.mRejected++;
+        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OT_ERROR_BUSY);
+        ExitNow();
+    }
+
+    update                = &mOutstandingUpdates[aId];
+    update->mId           = aId;
+    update->mFullHostName = fullHostName;
+    update->mClass        = otSrpServerHostIsDeleted(aHost) ? UpdateClass::kRemoval : UpdateClass::kRegistration;
+    update->mStartTime    = startTime;
 
     error = PublishHostAndItsServices(aHost, update);
 
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
+    // The update may already have been finished by results reported while publishing.
+    it = mOutstandingUpdates.find(aId);
+    if (it != mOutstandingUpdates.end() && (error != OTBR_ERROR_NONE || it->second.mCallbackCount == 0))
     {
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        OutstandingUpdate finished = std::move(it->second);
+
+        mOutstandingUpdates.erase(it);
+        FinishUpdate(finished, error);
     }
 
 exit:
-    return;
+    OTBR_PROBE(srp__advertising__end, aId, static_cast<int>(error));
 }
 
 void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
 {
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    auto it = mOutstandingUpdates.find(aUpdateId);
+
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || it->second.mCallbackCount == 1)
+    {
+        // Erase before notifying OpenThread, because there are chances that new
+        // elements may be added to `otSrpServerHandleServiceUpdateResult` and
+        // the iterator will be invalidated.
+        OutstandingUpdate finished = std::move(it->second);
+
+        mOutstandingUpdates.erase(it);
+        FinishUpdate(finished, aError);
+    }
+    else
+    {
+        --it->second.mCallbackCount;
+        otbrLogInfo("Waiting for more publishing callbacks %d", it->second.mCallbackCount);
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::FinishUpdate(const OutstandingUpdate &aUpdate, otbrError aError)
+{
+    uint8_t  updateClass = static_cast<uint8_t>(aUpdate.mClass);
+    uint32_t latency =
+        static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(Clock::now() - aUpdate.mStartTime).count());
+
+    if (aError == OTBR_ERROR_NONE)
+    {
+        mUpdateCounters.mSucceeded++;
+    }
+    else
     {
-        if (update->mId != aUpdateId)
+        mUpdateCounters.mFailed++;
+    }
+
+    mUpdateCounters.mFinished[updateClass]++;
+    mUpdateCounters.mLatencies[updateClass].Record(latency);
+
+    otbrLogDebug("Finished SRP service update (id = %u, class = %s) in %u ms: %s", aUpdate.mId,
+                 UpdateClassToString(aUpdate.mClass), latency, otbrErrorString(aError));
+
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdate.mId, OtbrErrorToOtError(aError));
+
+    // A successful update is committed to the host by the SRP server.
+    if (aError == OTBR_ERROR_NONE)
+    {
+        GetSrpServerStats().MarkHostStale(aUpdate.mFullHostName);
+    }
+
+    EventBus::Publish(mSrpUpdateEvent, [&aUpdate, aError, latency](SrpUpdateEvent &aEvent) {
+        aEvent.mHostName = &aUpdate.mHostName;
+        aEvent.mClass    = aUpdate.mClass;
+        aEvent.mError    = aError;
+        aEvent.mLatency  = latency;
+    });
+}
+
+const char *AdvertisingProxy::UpdateClassToString(UpdateClass aClass)
+{
+    const char *str = "unknown";
+
+    switch (aClass)
+    {
+    case UpdateClass::kRenewal:
+        str = "renewal";
+        break;
+    case UpdateClass::kRegistration:
+        str = "registration";
+        break;
+    case UpdateClass::kRemoval:
+        str = "removal";
+        break;
+    }
+
+    return str;
+}
+
+bool AdvertisingProxy::IsRenewal(const otSrpServerHost *aHost)
+{
+    bool                       isRenewal  = false;
+    const CachedHost          *cachedHost = nullptr;
+    Mdns::Publisher::HostBatch batch;
+
+    VerifyOrExit(!otSrpServerHostIsDeleted(aHost));
+    SuccessOrExit(GetCachedHost(aHost, cachedHost));
+
+    batch.mHostName  = cachedHost->mHostName;
+    batch.mAddresses = cachedHost->mAddresses;
+
+    for (const CachedService &service : cachedHost->mServices)
+    {
+        Mdns::Publisher::BatchService batchService;
+
+        if (service.mIsDeleted)
         {
+            // A service deleted earlier is kept by the SRP server until its key lease expires.
+            VerifyOrExit(!mPublisher.IsServiceRegistered(service.mName, service.mType));
             continue;
         }
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
-        {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
-        }
-        else
-        {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
-        }
-        break;
+        batchService.mName        = service.mName;
+        batchService.mType        = service.mType;
+        batchService.mSubTypeList = service.mSubTypeList;
+        batchService.mPort        = service.mPort;
+        batchService.mTxtData     = service.mTxtData;
+        batch.mServices.push_back(std::move(batchService));
     }
+
+    isRenewal = mPublisher.IsHostBatchPublished(batch);
+
+exit:
+    return isRenewal;
 }
 
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
@@ -197,17 +352,174 @@ exit:
 
 void AdvertisingProxy::PublishAllHostsAndServices(void)
 {
-    const otSrpServerHost *host = nullptr;
-
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
 
     otbrLogInfo("Publish all hosts and services");
-    while ((host = otSrpServerGetNextHost(GetInstance(), host)))
+
+    // Begins again with the first host if the hosts are already being published.
+    mLastPublishedHost = nullptr;
+    if (!mIsPublishingHosts)
+    {
+        PublishNextHosts();
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::PublishNextHosts(void)
+{
+    const otSrpServerHost *host  = nullptr;
+    uint16_t               count = 0;
+
+    mIsPublishingHosts = false;
+
+    VerifyOrExit(IsEnabled());
+    VerifyOrExit(mPublisher.IsStarted());
+
+    InvalidateCachedHosts();
+
+    if (mLastPublishedHost != nullptr)
+    {
+        // Finds the last published host. If it has been removed since, all hosts are published again, which is
+        // harmless since publishing a host which is already published completes at once.
+        while ((host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr && host != mLastPublishedHost)
+        {
+        }
+    }
+
+    while (count < kHostsPerPublishRound && (host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr)
+    {
+        PublishHostAndItsServicesInBatch(host);
+        mLastPublishedHost = host;
+        count++;
+    }
+
+    if (host == nullptr)
+    {
+        otbrLogInfo("Published all hosts and services");
+        mLastPublishedHost = nullptr;
+    }
+    else
+    {
+        mIsPublishingHosts = true;
+        mHost.PostTimerTask(TaskRunner::Priority::kBackground, kPublishRoundInterval, [this]() { PublishNextHosts(); });
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::PublishHostAndItsServicesInBatch(const otSrpServerHost *aHost)
+{
+    otbrError                  error        = OTBR_ERROR_NONE;
+    std::string                fullHostName = otSrpServerHostGetFullName(aHost);
+    const CachedHost          *cachedHost   = nullptr;
+    Mdns::Publisher::HostBatch batch;
+
+    if (otSrpServerHostIsDeleted(aHost))
     {
-        PublishHostAndItsServices(host, nullptr);
+        // Unpublishes the host and its services one by one.
+        ExitNow(error = PublishHostAndItsServices(aHost, nullptr));
     }
 
+    SuccessOrExit(error = GetCachedHost(aHost, cachedHost));
+    batch.mHostName     = cachedHost->mHostName;
+    batch.mAddresses    = cachedHost->mAddresses;
+    batch.mHostCallback = [fullHostName](otbrError aError) {
+        otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
+    };
+
+    for (const CachedService &service : cachedHost->mServices)
+    {
+        Mdns::Publisher::BatchService batchService;
+        std::string                   fullServiceName = service.mFullName;
+
+        if (service.mIsDeleted)
+        {
+            otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
+            mPublisher.UnpublishService(service.mName, service.mType, [fullServiceName](otbrError aError) {
+                // Treat `NOT_FOUND` as success when unpublishing service
+                aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
+                otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
+            });
+            continue;
+        }
+
+        batchService.mName        = service.mName;
+        batchService.mType        = service.mType;
+        batchService.mSubTypeList = service.mSubTypeList;
+        batchService.mPort        = service.mPort;
+        batchService.mTxtData     = service.mTxtData;
+        batchService.mCallback    = [fullServiceName](otbrError aError) {
+            otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
+        };
+        batch.mServices.push_back(std::move(batchService));
+    }
+
+    mPublisher.PublishHostBatch(std::move(batch));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to publish SRP host '%s': %s", fullHostName.c_str(), otbrErrorString(error));
+    }
+}
+
+otbrError AdvertisingProxy::GetCachedHost(const otSrpServerHost *aHost, const CachedHost *&aCachedHost)
+{
+    otbrError                 error        = OTBR_ERROR_NONE;
+    std::string               fullHostName = otSrpServerHostGetFullName(aHost);
+    std::string               hostDomain;
+    const otIp6Address       *hostAddresses;
+    uint8_t                   hostAddressNum;
+    const otSrpServerService *service = nullptr;
+    CachedHost                cachedHost;
+    auto                      it = mCachedHosts.find(fullHostName);
+
+    VerifyOrExit(it == mCachedHosts.end(), aCachedHost = &it->second);
+
+    SuccessOrExit(error = SplitFullHostName(fullHostName, cachedHost.mHostName, hostDomain));
+    hostAddresses         = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
+    cachedHost.mAddresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
+
+    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    {
+        CachedService cachedService;
+        std::string   serviceDomain;
+
+        cachedService.mFullName = otSrpServerServiceGetInstanceName(service);
+        SuccessOrExit(error = SplitFullServiceInstanceName(cachedService.mFullName, cachedService.mName,
+                                                           cachedService.mType, serviceDomain));
+        cachedService.mIsDeleted = otSrpServerServiceIsDeleted(service);
+        cachedService.mPort      = 0;
+
+        if (!cachedService.mIsDeleted)
+        {
+            cachedService.mSubTypeList = MakeSubTypeList(service);
+            cachedService.mPort        = otSrpServerServiceGetPort(service);
+            cachedService.mTxtData     = MakeTxtData(service);
+        }
+        cachedHost.mServices.push_back(std::move(cachedService));
+    }
+
+    aCachedHost = &(mCachedHosts[fullHostName] = std::move(cachedHost));
+
+exit:
+    return error;
+}
+
+void AdvertisingProxy::InvalidateCachedHosts(void)
+{
+    const otIp6Address *meshLocalEid = otThreadGetMeshLocalEid(GetInstance());
+
+    VerifyOrExit(otIp6PrefixMatch(meshLocalEid, &mCachedMeshLocalEid) < OT_IP6_PREFIX_BITSIZE);
+
+    otbrLogInfo("Mesh-local prefix changed, invalidate %zu cached SRP hosts", mCachedHosts.size());
+    mCachedHosts.clear();
+    mCachedMeshLocalEid = *meshLocalEid;
+
 exit:
     return;
 }
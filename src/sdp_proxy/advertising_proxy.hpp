@@ -40,13 +40,29 @@
 
 #include <stdint.h>
 
+#include <unordered_map>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 
+/**
+ * The maximum number of SRP updates being advertised at the same time, the new updates are rejected beyond it.
+ *
+ */
+#ifndef OTBR_SRP_ADVERTISING_PROXY_MAX_OUTSTANDING_UPDATES
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_SRP_ADVERTISING_PROXY_MAX_OUTSTANDING_UPDATES 32
+#else
+#define OTBR_SRP_ADVERTISING_PROXY_MAX_OUTSTANDING_UPDATES 256
+#endif
+#endif
+
 namespace otbr {
 
 /**
@@ -56,6 +72,45 @@ namespace otbr {
 class AdvertisingProxy : private NonCopyable
 {
 public:
+    /**
+     * This enumeration represents the classes of SRP updates, which are handled and reported separately.
+     *
+     */
+    enum class UpdateClass : uint8_t
+    {
+        kRenewal      = 0, ///< A lease renewal of a host and services already published with the same parameters.
+        kRegistration = 1, ///< A new or changed registration of a host and its services.
+        kRemoval      = 2, ///< A removal of a host and all its services.
+    };
+
+    static constexpr uint8_t kNumUpdateClasses = 3;
+
+    /**
+     * This structure represents the counters of SRP updates handled by the Advertising Proxy.
+     *
+     */
+    struct UpdateCounters
+    {
+        uint32_t mSucceeded; ///< The number of updates advertised successfully
+        uint32_t mFailed;    ///< The number of updates failed to be advertised
+        uint32_t mRejected;  ///< The number of updates rejected for too many outstanding updates
+
+        uint32_t             mFinished[kNumUpdateClasses];  ///< The number of finished updates by `UpdateClass`
+        MdnsLatencyHistogram mLatencies[kNumUpdateClasses]; ///< The latencies until the updates are finished
+    };
+
+    /**
+     * This structure represents the event of a finished SRP update published on the `EventBus`.
+     *
+     */
+    struct SrpUpdateEvent
+    {
+        const std::string *mHostName; ///< The host name of the update.
+        UpdateClass        mClass;    ///< The class of the update.
+        otbrError          mError;    ///< The result of advertising the update.
+        uint32_t           mLatency;  ///< The latency (in milliseconds) until the update is finished.
+    };
+
     /**
      * This constructor initializes the Advertising Proxy object.
      *
@@ -76,6 +131,9 @@ public:
     /**
      * This method publishes all registered hosts and services.
      *
+     * The hosts are published a few at a time, each with its services in a batch, so that the mDNS daemon is not
+     * flooded when a large number of hosts are published again after it restarts.
+     *
      */
     void PublishAllHostsAndServices(void);
 
@@ -87,12 +145,45 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method returns the counters of SRP updates.
+     *
+     * @returns The counters of SRP updates.
+     *
+     */
+    const UpdateCounters &GetUpdateCounters(void) const { return mUpdateCounters; }
+
 private:
     struct OutstandingUpdate
     {
         otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
         std::string                mHostName;          // The host name.
+        std::string                mFullHostName;      // The full host name.
         uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        UpdateClass                mClass;             // The class of the update.
+        Timepoint                  mStartTime;         // The time when the update was received.
+    };
+
+    using OutstandingUpdateMap = std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate>;
+
+    // The forms in which an SRP service is published, derived from the SRP server.
+    struct CachedService
+    {
+        std::string                  mFullName;
+        std::string                  mName;
+        std::string                  mType;
+        Mdns::Publisher::SubTypeList mSubTypeList;
+        uint16_t                     mPort;
+        Mdns::Publisher::TxtData     mTxtData;
+        bool                         mIsDeleted;
+    };
+
+    // The forms in which an SRP host and its services are published, derived from the SRP server.
+    struct CachedHost
+    {
+        std::string                  mHostName;
+        Mdns::Publisher::AddressList mAddresses;
+        std::vector<CachedService>   mServices;
     };
 
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
@@ -104,6 +195,12 @@ private:
     static Mdns::Publisher::TxtData     MakeTxtData(const otSrpServerService *aSrpService);
     static Mdns::Publisher::SubTypeList MakeSubTypeList(const otSrpServerService *aSrpService);
     void                                OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError);
+    void                                FinishUpdate(const OutstandingUpdate &aUpdate, otbrError aError);
+    static const char                  *UpdateClassToString(UpdateClass aClass);
+
+    // Tells whether an update of a host only renews the leases of its host and services, which are all already
+    // published with the same parameters, so that the update is acknowledged without waiting for mDNS.
+    bool IsRenewal(const otSrpServerHost *aHost);
 
     std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
 
@@ -126,7 +223,16 @@ private:
      */
     otbrError PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate);
 
-    otInstance *GetInstance(void) { return mHost.GetInstance(); }
+    // Publishes a host with its services in a batch, for which there is no update to report.
+    void PublishHostAndItsServicesInBatch(const otSrpServerHost *aHost);
+
+    // Returns the cached publish forms of a live host, deriving them if the host is not cached yet.
+    otbrError GetCachedHost(const otSrpServerHost *aHost, const CachedHost *&aCachedHost);
+    void      InvalidateCachedHosts(void);
+    void PublishNextHosts(void);
+
+    otInstance            *GetInstance(void) { return mHost.GetInstance(); }
+    agent::SrpServerStats &GetSrpServerStats(void) { return mHost.GetThreadHelper()->GetSrpServerStats(); }
 
     // A reference to the NCP controller, has no ownership.
     Ncp::RcpHost &mHost;
@@ -136,8 +242,21 @@ private:
 
     bool mIsEnabled;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // The last host published by `PublishAllHostsAndServices()`, or null to begin with the first host.
+    const otSrpServerHost *mLastPublishedHost;
+    // Whether publishing the next hosts is scheduled.
+    bool mIsPublishingHosts;
+
+    // The outstanding updates by their IDs.
+    OutstandingUpdateMap mOutstandingUpdates;
+
+    UpdateCounters mUpdateCounters;
+    SrpUpdateEvent mSrpUpdateEvent;
+
+    // The publish forms of the SRP hosts by their full names. A host is removed when it is updated, and all hosts are
+    // removed when the mesh-local prefix, whose addresses are not published, changes.
+    std::unordered_map<std::string, CachedHost> mCachedHosts;
+    otIp6Address                                mCachedMeshLocalEid;
 };
 
 } // namespace otbr
@@ -38,6 +38,7 @@
 #include "sdp_proxy/discovery_proxy.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 
 #include <assert.h>
@@ -64,6 +65,8 @@ DiscoveryProxy::DiscoveryProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     , mIsEnabled(false)
 {
     mHost.RegisterResetHandler([this]() {
+        // The queries are gone with the reset OpenThread instance.
+        ClearSubscriptions();
         otDnssdQuerySetCallbacks(mHost.GetInstance(), &DiscoveryProxy::OnDiscoveryProxySubscribe,
                                  &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
     });
@@ -94,16 +97,22 @@ void DiscoveryProxy::Start(void)
 
     mSubscriberId = mMdnsPublisher.AddSubscriptionCallbacks(
         [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
-            if (!aInstanceInfo.mRemoved)
+            // Repeated results with identical data are dropped before reaching the Thread stack.
+            if (CacheServiceInstance(aType, aInstanceInfo) && !aInstanceInfo.mRemoved)
             {
                 OnServiceDiscovered(aType, aInstanceInfo);
             }
         },
 
         [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
-            OnHostDiscovered(aHostName, aHostInfo);
+            if (CacheHost(aHostName, aHostInfo))
+            {
+                OnHostDiscovered(aHostName, aHostInfo);
+            }
         });
 
+    SubscribeExistingQueries();
+
     otbrLogInfo("Started");
 }
 
@@ -117,9 +126,33 @@ void DiscoveryProxy::Stop(void)
         mSubscriberId = 0;
     }
 
+    ClearSubscriptions();
+    ClearCachedAnswers();
+
     otbrLogInfo("Stopped");
 }
 
+void DiscoveryProxy::HandleMdnsState(Mdns::Publisher::State aState)
+{
+    VerifyOrExit(IsEnabled());
+
+    // The subscriptions are lost with the mDNS daemon or when the interfaces of the publisher change, so the queries
+    // are subscribed again once it's ready. The discovered answers are not refreshed while it's not ready.
+    ClearSubscriptions();
+
+    if (aState == Mdns::Publisher::State::kReady)
+    {
+        SubscribeExistingQueries();
+    }
+    else
+    {
+        ClearCachedAnswers();
+    }
+
+exit:
+    return;
+}
+
 void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFullName)
 {
     reinterpret_cast<DiscoveryProxy *>(aContext)->OnDiscoveryProxySubscribe(aFullName);
@@ -127,22 +160,29 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFull
 
 void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    Subscription &subscription = mSubscriptions[GetSubscriptionKey(aFullName)];
 
-    otbrLogInfo("Subscribe: %s", fullName.c_str());
+    otbrLogInfo("Subscribe: %s", aFullName);
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (subscription.mCount++ == 0)
     {
-        if (nameInfo.mHostName.empty())
+        subscription.mNameInfo = SplitFullDnsName(aFullName);
+
+        if (subscription.mNameInfo.mHostName.empty())
         {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+            mMdnsPublisher.SubscribeService(subscription.mNameInfo.mServiceName, subscription.mNameInfo.mInstanceName);
         }
         else
         {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
+            mMdnsPublisher.SubscribeHost(subscription.mNameInfo.mHostName);
         }
     }
+    else
+    {
+        // The mDNS subscription is shared with the other queries for the same name, whose answers are not reported
+        // again until they change.
+        AnswerFromCache(subscription.mNameInfo);
+    }
 }
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
@@ -152,21 +192,61 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFu
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    auto it = mSubscriptions.find(GetSubscriptionKey(aFullName));
+
+    otbrLogInfo("Unsubscribe: %s", aFullName);
+
+    VerifyOrExit(it != mSubscriptions.end());
+    VerifyOrExit(--it->second.mCount == 0);
+
+    UnsubscribeMdns(it->second.mNameInfo);
+    mSubscriptions.erase(it);
+
+exit:
+    return;
+}
+
+std::string DiscoveryProxy::GetSubscriptionKey(const char *aFullName)
+{
+    DnsNameSpans nameSpans = SplitFullDnsName(aFullName, strlen(aFullName));
+
+    // The name before the domain tells the instance, service and host names apart, as a service name always ends
+    // with its transport label. The domain is ignored like by the mDNS subscriptions.
+    return StringUtils::ToLowercase(std::string(aFullName, static_cast<size_t>(nameSpans.mDomain.mData - aFullName)));
+}
+
+void DiscoveryProxy::SubscribeExistingQueries(void)
+{
+    const otDnssdQuery *query = nullptr;
+
+    // The queries made while the Discovery Proxy was disabled are subscribed as if they were just made.
+    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
+    {
+        char queryName[OT_DNS_MAX_NAME_SIZE];
 
-    otbrLogInfo("Unsubscribe: %s", fullName.c_str());
+        otDnssdGetQueryTypeAndName(query, &queryName);
+        OnDiscoveryProxySubscribe(queryName);
+    }
+}
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+void DiscoveryProxy::ClearSubscriptions(void)
+{
+    for (const auto &entry : mSubscriptions)
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
-        }
+        UnsubscribeMdns(entry.second.mNameInfo);
+    }
+    mSubscriptions.clear();
+}
+
+void DiscoveryProxy::UnsubscribeMdns(const DnsNameInfo &aNameInfo)
+{
+    if (aNameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.UnsubscribeService(aNameInfo.mServiceName, aNameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(aNameInfo.mHostName);
     }
 }
 
@@ -176,6 +256,7 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
     otDnssdServiceInstanceInfo instanceInfo;
     const otDnssdQuery        *query                 = nullptr;
     std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+    std::string                localHostLabel        = GetLocalHostLabel(aInstanceInfo.mHostName);
 
     otbrLogInfo("Service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
@@ -232,7 +313,7 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
             (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
         {
             std::string serviceFullName    = aType + "." + domain;
-            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
+            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, localHostLabel, domain);
             std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
 
             instanceInfo.mFullName = instanceFullName.c_str();
@@ -249,6 +330,7 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
     otDnssdHostInfo     hostInfo;
     const otDnssdQuery *query            = nullptr;
     std::string         resolvedHostName = aHostInfo.mHostName;
+    std::string         localHostLabel;
 
     otbrLogInfo("Host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo.mHostName.c_str(),
                 aHostInfo.mAddresses.size());
@@ -258,6 +340,8 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
         resolvedHostName = aHostName + ".local.";
     }
 
+    localHostLabel = GetLocalHostLabel(resolvedHostName);
+
     hostInfo.mAddressNum = aHostInfo.mAddresses.size();
     if (!aHostInfo.mAddresses.empty())
     {
@@ -293,53 +377,185 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
         if (DnsLabelsEqual(hostName, aHostName))
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+            std::string hostFullName = TranslateDomain(resolvedHostName, localHostLabel, domain);
 
             otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
         }
     }
 }
 
-std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
+std::string DiscoveryProxy::GetLocalHostLabel(const std::string &aName)
 {
-    std::string targetName;
     std::string hostName;
     std::string domain;
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), hostName.clear());
+    VerifyOrExit(DnsLabelsEqual(domain, "local."), hostName.clear());
 
-    targetName = hostName + "." + aTargetDomain;
+exit:
+    otbrLogDebug("Translate domain: %s => %s", aName.c_str(), hostName.empty() ? "(unchanged)" : hostName.c_str());
+    return hostName;
+}
+
+std::string DiscoveryProxy::TranslateDomain(const std::string &aName,
+                                            const std::string &aLocalHostLabel,
+                                            const std::string &aTargetDomain)
+{
+    // Only the names in the `local.` domain, whose host labels are split once per discovered result, are translated.
+    return aLocalHostLabel.empty() ? aName : aLocalHostLabel + "." + aTargetDomain;
+}
+
+uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+{
+    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+}
+
+bool DiscoveryProxy::CacheServiceInstance(const std::string                             &aType,
+                                          const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+{
+    bool        changed = true;
+    Timepoint   now     = Clock::now();
+    std::string key     = StringUtils::ToLowercase(DnsUtils::UnescapeInstanceName(aInstanceInfo.mName) + "." + aType);
+
+    PurgeExpiredAnswers(now);
+
+    if (aInstanceInfo.mRemoved || CapTtl(aInstanceInfo.mTtl) == 0)
+    {
+        mCachedInstances.erase(key);
+        ExitNow();
+    }
+
+    {
+        CachedInstance                                &cachedInstance = mCachedInstances[key];
+        const Mdns::Publisher::DiscoveredInstanceInfo &cachedInfo     = cachedInstance.mInfo;
+
+        // Only the expiry of an unchanged instance is refreshed, as the queries it answered are already done.
+        changed = cachedInstance.mType.empty() || cachedInfo.mName != aInstanceInfo.mName ||
+                  cachedInfo.mHostName != aInstanceInfo.mHostName || cachedInfo.mPort != aInstanceInfo.mPort ||
+                  cachedInfo.mPriority != aInstanceInfo.mPriority || cachedInfo.mWeight != aInstanceInfo.mWeight ||
+                  cachedInfo.mTxtData != aInstanceInfo.mTxtData ||
+                  !IsSameAddressList(cachedInfo.mAddresses, aInstanceInfo.mAddresses);
+
+        cachedInstance.mType       = aType;
+        cachedInstance.mInfo       = aInstanceInfo;
+        cachedInstance.mExpireTime = now + std::chrono::seconds(CapTtl(aInstanceInfo.mTtl));
+    }
+
+    if (!changed)
+    {
+        otbrLogDebug("Drop unchanged service instance %s.%s", aInstanceInfo.mName.c_str(), aType.c_str());
+    }
 
 exit:
-    otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
-    return targetName;
+    return changed;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+bool DiscoveryProxy::CacheHost(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
 {
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
+    bool        changed = true;
+    Timepoint   now     = Clock::now();
+    std::string key     = StringUtils::ToLowercase(aHostName);
 
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
+    PurgeExpiredAnswers(now);
+
+    if (aHostInfo.mAddresses.empty() || CapTtl(aHostInfo.mTtl) == 0)
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        mCachedHosts.erase(key);
+        ExitNow();
+    }
 
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+    {
+        CachedHost &cachedHost = mCachedHosts[key];
 
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
+        changed = cachedHost.mHostName.empty() || cachedHost.mInfo.mHostName != aHostInfo.mHostName ||
+                  !IsSameAddressList(cachedHost.mInfo.mAddresses, aHostInfo.mAddresses);
+
+        cachedHost.mHostName   = aHostName;
+        cachedHost.mInfo       = aHostInfo;
+        cachedHost.mExpireTime = now + std::chrono::seconds(CapTtl(aHostInfo.mTtl));
+    }
+
+    if (!changed)
+    {
+        otbrLogDebug("Drop unchanged host %s", aHostName.c_str());
     }
 
-    return count;
+exit:
+    return changed;
 }
 
-uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+void DiscoveryProxy::AnswerFromCache(const DnsNameInfo &aNameInfo)
 {
-    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+    Timepoint now = Clock::now();
+
+    PurgeExpiredAnswers(now);
+
+    if (!aNameInfo.mHostName.empty())
+    {
+        auto it = mCachedHosts.find(StringUtils::ToLowercase(aNameInfo.mHostName));
+
+        if (it != mCachedHosts.end())
+        {
+            Mdns::Publisher::DiscoveredHostInfo hostInfo = it->second.mInfo;
+
+            hostInfo.mTtl = GetRemainingTtl(it->second.mExpireTime, now);
+            OnHostDiscovered(it->second.mHostName, hostInfo);
+        }
+        ExitNow();
+    }
+
+    for (const auto &entry : mCachedInstances)
+    {
+        const CachedInstance &cachedInstance = entry.second;
+
+        if (DnsLabelsEqual(cachedInstance.mType, aNameInfo.mServiceName) &&
+            (aNameInfo.mInstanceName.empty() ||
+             DnsLabelsEqual(DnsUtils::UnescapeInstanceName(cachedInstance.mInfo.mName), aNameInfo.mInstanceName)))
+        {
+            Mdns::Publisher::DiscoveredInstanceInfo instanceInfo = cachedInstance.mInfo;
+
+            instanceInfo.mTtl = GetRemainingTtl(cachedInstance.mExpireTime, now);
+            OnServiceDiscovered(cachedInstance.mType, instanceInfo);
+        }
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::PurgeExpiredAnswers(Timepoint aNow)
+{
+    for (auto it = mCachedInstances.begin(); it != mCachedInstances.end();)
+    {
+        it = (it->second.mExpireTime <= aNow) ? mCachedInstances.erase(it) : std::next(it);
+    }
+
+    for (auto it = mCachedHosts.begin(); it != mCachedHosts.end();)
+    {
+        it = (it->second.mExpireTime <= aNow) ? mCachedHosts.erase(it) : std::next(it);
+    }
+}
+
+void DiscoveryProxy::ClearCachedAnswers(void)
+{
+    mCachedInstances.clear();
+    mCachedHosts.clear();
+}
+
+uint32_t DiscoveryProxy::GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow)
+{
+    // Rounds up so that an answer which has not expired is never reported with a zero TTL.
+    auto remaining = std::chrono::duration_cast<Milliseconds>(aExpireTime - aNow).count();
+
+    return static_cast<uint32_t>((remaining + 999) / 1000);
+}
+
+bool DiscoveryProxy::IsSameAddressList(const Mdns::Publisher::AddressList &aAddresses1,
+                                       const Mdns::Publisher::AddressList &aAddresses2)
+{
+    // The mDNS backends may report the same addresses in a different order.
+    return aAddresses1.size() == aAddresses2.size() &&
+           std::is_permutation(aAddresses1.begin(), aAddresses1.end(), aAddresses2.begin());
 }
 
 } // namespace Dnssd
@@ -38,7 +38,10 @@
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
+#include <map>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <stdint.h>
@@ -47,6 +50,7 @@
 #include <openthread/instance.h>
 
 #include "common/dns_utils.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 
@@ -83,13 +87,7 @@ public:
      * @param[in] aState  The state of mDNS publisher.
      *
      */
-    void HandleMdnsState(Mdns::Publisher::State aState)
-    {
-        VerifyOrExit(IsEnabled());
-        OTBR_UNUSED_VARIABLE(aState);
-    exit:
-        return;
-    }
+    void HandleMdnsState(Mdns::Publisher::State aState);
 
 private:
     enum : uint32_t
@@ -97,17 +95,57 @@ private:
         kServiceTtlCapLimit = 10, // TTL cap limit for Discovery Proxy (in seconds).
     };
 
+    // A discovered service instance, kept to answer the queries which join an ongoing mDNS subscription.
+    struct CachedInstance
+    {
+        std::string                             mType;
+        Mdns::Publisher::DiscoveredInstanceInfo mInfo;
+        Timepoint                               mExpireTime;
+    };
+
+    // A discovered host, kept to answer the queries which join an ongoing mDNS subscription.
+    struct CachedHost
+    {
+        std::string                         mHostName;
+        Mdns::Publisher::DiscoveredHostInfo mInfo;
+        Timepoint                           mExpireTime;
+    };
+
+    // An mDNS subscription shared by the DNS-SD queries for the same name.
+    struct Subscription
+    {
+        DnsNameInfo mNameInfo;
+        uint32_t    mCount = 0;
+    };
+
     static void        OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
-    static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
+    static std::string GetSubscriptionKey(const char *aFullName);
+    void               SubscribeExistingQueries(void);
+    void               ClearSubscriptions(void);
+    void               UnsubscribeMdns(const DnsNameInfo &aNameInfo);
+    static std::string GetLocalHostLabel(const std::string &aName);
+    static std::string TranslateDomain(const std::string &aName,
+                                       const std::string &aLocalHostLabel,
+                                       const std::string &aTargetDomain);
     void               OnServiceDiscovered(const std::string                             &aSubscription,
                                            const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
     static uint32_t CapTtl(uint32_t aTtl);
 
+    // Caches a discovered result and returns whether it differs from the cached one, so that it is to be answered.
+    bool            CacheServiceInstance(const std::string                             &aType,
+                                         const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
+    bool            CacheHost(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
+    void            AnswerFromCache(const DnsNameInfo &aNameInfo);
+    void            PurgeExpiredAnswers(Timepoint aNow);
+    void            ClearCachedAnswers(void);
+    static uint32_t GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow);
+    static bool     IsSameAddressList(const Mdns::Publisher::AddressList &aAddresses1,
+                                      const Mdns::Publisher::AddressList &aAddresses2);
+
     void Start(void);
     void Stop(void);
     bool IsEnabled(void) const { return mIsEnabled; }
@@ -116,6 +154,16 @@ private:
     Mdns::Publisher &mMdnsPublisher;
     bool             mIsEnabled;
     uint64_t         mSubscriberId = 0;
+
+    // The answers of the ongoing mDNS subscriptions, which live as long as their capped TTLs. The instances are keyed
+    // by their lowercase "<instance>.<type>" names and the hosts by their lowercase host names. A removed instance or
+    // a host without addresses is evicted, so that it is no longer answered.
+    std::map<std::string, CachedInstance> mCachedInstances;
+    std::map<std::string, CachedHost>     mCachedHosts;
+
+    // The mDNS subscriptions keyed by the lowercase names of their queries without the domain, so that a change of
+    // the queries neither walks nor splits all of them.
+    std::unordered_map<std::string, Subscription> mSubscriptions;
 };
 
 } // namespace Dnssd
@@ -0,0 +1,832 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the caching upstream DNS resolver.
+ */
+
+#define OTBR_LOG_TAG "UPDNS"
+
+#include "sdp_proxy/upstream_resolver.hpp"
+
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <arpa/inet.h>
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <openthread/random_crypto.h>
+#include <openthread/udp.h>
+
+#include "common/code_utils.hpp"
+#include "common/dns_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+
+// The upstream queries of the Thread stack are handed to the OpenThread POSIX platform unless the resolver is
+// initialized. The agent is linked with `--wrap` for these symbols, so that the calls of the Thread stack come here and
+// the `__real_` symbols refer to the implementation of the platform.
+extern "C" void __real_otPlatDnsStartUpstreamQuery(otInstance             *aInstance,
+                                                   otPlatDnsUpstreamQuery *aTxn,
+                                                   const otMessage        *aQuery);
+extern "C" void __real_otPlatDnsCancelUpstreamQuery(otInstance *aInstance, otPlatDnsUpstreamQuery *aTxn);
+
+extern "C" void __wrap_otPlatDnsStartUpstreamQuery(otInstance             *aInstance,
+                                                   otPlatDnsUpstreamQuery *aTxn,
+                                                   const otMessage        *aQuery)
+{
+    otbr::UpstreamResolver *resolver = otbr::UpstreamResolver::GetActive();
+
+    if (resolver != nullptr)
+    {
+        resolver->Query(aTxn, aQuery);
+    }
+    else
+    {
+        __real_otPlatDnsStartUpstreamQuery(aInstance, aTxn, aQuery);
+    }
+}
+
+extern "C" void __wrap_otPlatDnsCancelUpstreamQuery(otInstance *aInstance, otPlatDnsUpstreamQuery *aTxn)
+{
+    otbr::UpstreamResolver *resolver = otbr::UpstreamResolver::GetActive();
+
+    // A query started before the resolver is initialized is still resolved by the platform.
+    if (resolver == nullptr || !resolver->Cancel(aTxn))
+    {
+        __real_otPlatDnsCancelUpstreamQuery(aInstance, aTxn);
+    }
+}
+
+namespace otbr {
+
+static constexpr char     kResolvConfPath[]  = "/etc/resolv.conf";
+static constexpr size_t   kMaxServers        = 3; // The `MAXNS` of the system resolver.
+static constexpr uint16_t kDnsPort           = 53;
+static constexpr uint16_t kDnsHeaderSize     = 12;
+static constexpr uint16_t kDnsFlagTruncated  = 0x0200;
+static constexpr size_t   kMaxUdpMessageSize = 4096;
+static constexpr size_t   kTcpLengthSize     = 2;
+
+// The time to wait for the response of an upstream server before trying the next one.
+static constexpr Milliseconds kQueryTimeout = Milliseconds(3000);
+
+// The time after which an idle TCP connection is closed.
+static constexpr Milliseconds kTcpIdleTimeout = Milliseconds(10000);
+
+static constexpr uint16_t kDnsFlagsOffset = 2;
+
+static uint16_t ReadUint16(const uint8_t *aData)
+{
+    return static_cast<uint16_t>((aData[0] << 8) | aData[1]);
+}
+
+static void WriteUint16(uint8_t *aData, uint16_t aValue)
+{
+    aData[0] = static_cast<uint8_t>(aValue >> 8);
+    aData[1] = static_cast<uint8_t>(aValue);
+}
+
+UpstreamResolver *UpstreamResolver::sActive = nullptr;
+
+UpstreamResolver::UpstreamResolver(Ncp::RcpHost &aHost)
+    : mHost(aHost)
+    , mServerIndex(0)
+    , mResolvConfMtime(0)
+    , mUdpFd(-1)
+    , mTimerTaskId(0)
+    , mCounters()
+{
+}
+
+UpstreamResolver::~UpstreamResolver(void)
+{
+    Deinit();
+}
+
+void UpstreamResolver::Init(void)
+{
+    VerifyOrExit(sActive != this);
+    assert(sActive == nullptr);
+
+    RefreshServers();
+    sActive = this;
+    otbrLogInfo("Started with %zu upstream servers", mServers.size());
+
+exit:
+    return;
+}
+
+void UpstreamResolver::Deinit(void)
+{
+    VerifyOrExit(sActive == this);
+    sActive = nullptr;
+
+    while (!mPendingQueries.empty())
+    {
+        FinishQuery(mPendingQueries.begin(), nullptr, 0);
+    }
+
+    CloseTcpConnection();
+    if (mUdpFd != -1)
+    {
+        MainloopManager::GetInstance().RemoveFd(mUdpFd);
+        close(mUdpFd);
+        mUdpFd = -1;
+    }
+
+    mTaskRunner.Cancel(mTimerTaskId);
+    mTimerTaskId = 0;
+    mCache.clear();
+    mCacheLru.clear();
+    otbrLogInfo("Stopped");
+
+exit:
+    return;
+}
+
+void UpstreamResolver::Query(otPlatDnsUpstreamQuery *aTxn, const otMessage *aQuery)
+{
+    otbrError            error  = OTBR_ERROR_NONE;
+    uint16_t             length = otMessageGetLength(aQuery);
+    std::vector<uint8_t> message(length);
+    std::string          key;
+    Waiter               waiter;
+
+    VerifyOrExit(length >= kDnsHeaderSize, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(otMessageRead(aQuery, 0, message.data(), length) == length, error = OTBR_ERROR_PARSE);
+    waiter.mTxn       = aTxn;
+    waiter.mMessageId = ReadUint16(message.data());
+
+    // Queries which are not standard queries with a single question are forwarded as they are.
+    if (GetDnsQueryKey(message.data(), length, key) == OTBR_ERROR_NONE)
+    {
+        auto it = mPendingKeys.find(key);
+
+        VerifyOrExit(!AnswerFromCache(key, waiter));
+        mCounters.mCacheMisses++;
+
+        if (it != mPendingKeys.end())
+        {
+            mPendingQueries[it->second].mWaiters.push_back(waiter);
+            mCounters.mCoalescedQueries++;
+            ExitNow();
+        }
+    }
+    else
+    {
+        key.clear();
+    }
+
+    error = StartQuery(std::move(message), key, waiter);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to resolve upstream query: %s", otbrErrorString(error));
+        otPlatDnsUpstreamQueryDone(GetInstance(), aTxn, nullptr);
+    }
+}
+
+bool UpstreamResolver::Cancel(otPlatDnsUpstreamQuery *aTxn)
+{
+    bool found = false;
+
+    for (auto it = mPendingQueries.begin(); it != mPendingQueries.end() && !found; ++it)
+    {
+        std::vector<Waiter> &waiters = it->second.mWaiters;
+        auto                 waiter  = std::find_if(waiters.begin(), waiters.end(),
+                                                    [aTxn](const Waiter &aWaiter) { return aWaiter.mTxn == aTxn; });
+
+        if (waiter == waiters.end())
+        {
+            continue;
+        }
+
+        found = true;
+        waiters.erase(waiter);
+        otPlatDnsUpstreamQueryDone(GetInstance(), aTxn, nullptr);
+
+        // The response may still be cached for the other queries, and is ignored if none is left.
+        if (waiters.empty())
+        {
+            FinishQuery(it, nullptr, 0);
+            break;
+        }
+    }
+
+    return found;
+}
+
+void UpstreamResolver::RefreshServers(void)
+{
+    struct stat               st;
+    std::ifstream             file;
+    std::string               line;
+    std::vector<sockaddr_in6> servers;
+
+    // The file is read again only when it is modified, e.g. by a DHCP client.
+    VerifyOrExit(stat(kResolvConfPath, &st) == 0);
+    VerifyOrExit(st.st_mtime != mResolvConfMtime);
+    mResolvConfMtime = st.st_mtime;
+
+    file.open(kResolvConfPath);
+    while (servers.size() < kMaxServers && std::getline(file, line))
+    {
+        std::istringstream stream(line);
+        std::string        keyword;
+        std::string        address;
+        std::string        scope;
+        size_t             scopeStart;
+        sockaddr_in6       server;
+        in_addr            address4;
+
+        stream >> keyword >> address;
+        if (keyword != "nameserver" || address.empty())
+        {
+            continue;
+        }
+
+        memset(&server, 0, sizeof(server));
+        server.sin6_family = AF_INET6;
+        server.sin6_port   = htons(kDnsPort);
+
+        scopeStart = address.find('%');
+        if (scopeStart != std::string::npos)
+        {
+            scope = address.substr(scopeStart + 1);
+            address.resize(scopeStart);
+            server.sin6_scope_id = if_nametoindex(scope.c_str());
+        }
+
+        if (inet_pton(AF_INET, address.c_str(), &address4) == 1)
+        {
+            server.sin6_addr.s6_addr[10] = 0xff;
+            server.sin6_addr.s6_addr[11] = 0xff;
+            memcpy(&server.sin6_addr.s6_addr[12], &address4, sizeof(address4));
+        }
+        else if (inet_pton(AF_INET6, address.c_str(), &server.sin6_addr) != 1)
+        {
+            otbrLogWarning("Ignore invalid upstream server %s", address.c_str());
+            continue;
+        }
+
+        servers.push_back(server);
+    }
+
+    otbrLogInfo("Read %zu upstream servers from %s", servers.size(), kResolvConfPath);
+    mServers     = std::move(servers);
+    mServerIndex = 0;
+
+    // The connection to the previous server is not reused.
+    if (!HasPendingTcpQueries())
+    {
+        CloseTcpConnection();
+    }
+
+exit:
+    return;
+}
+
+bool UpstreamResolver::AnswerFromCache(const std::string &aKey, const Waiter &aWaiter)
+{
+    bool                 found = false;
+    Timepoint            now   = Clock::now();
+    auto                 it    = mCache.find(aKey);
+    std::vector<uint8_t> response;
+
+    VerifyOrExit(it != mCache.end());
+
+    if (now >= it->second.mExpireTime)
+    {
+        mCacheLru.erase(it->second.mLruIt);
+        mCache.erase(it);
+        ExitNow();
+    }
+
+    response = it->second.mResponse;
+    AgeDnsResponse(response.data(), static_cast<uint16_t>(response.size()),
+                   static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(now - it->second.mCachedTime).count()));
+    mCacheLru.splice(mCacheLru.begin(), mCacheLru, it->second.mLruIt);
+
+    mCounters.mCacheHits++;
+    Reply(aWaiter, response.data(), static_cast<uint16_t>(response.size()));
+    found = true;
+
+exit:
+    return found;
+}
+
+void UpstreamResolver::AddToCache(const std::string &aKey, const uint8_t *aResponse, uint16_t aLength)
+{
+    uint32_t    ttl = std::min<uint32_t>(GetDnsResponseCacheTtl(aResponse, aLength),
+                                         OTBR_DNS_UPSTREAM_RESOLVER_MAX_CACHE_TTL);
+    Timepoint   now = Clock::now();
+    auto        it  = mCache.find(aKey);
+    CacheEntry *entry;
+
+    VerifyOrExit(ttl > 0);
+
+    if (it == mCache.end())
+    {
+        entry = &mCache[aKey];
+        mCacheLru.push_front(aKey);
+        entry->mLruIt = mCacheLru.begin();
+    }
+    else
+    {
+        entry = &it->second;
+        mCacheLru.splice(mCacheLru.begin(), mCacheLru, entry->mLruIt);
+    }
+
+    entry->mResponse.assign(aResponse, aResponse + aLength);
+    entry->mCachedTime = now;
+    entry->mExpireTime = now + Seconds(ttl);
+
+    while (mCache.size() > OTBR_DNS_UPSTREAM_RESOLVER_CACHE_SIZE)
+    {
+        mCache.erase(mCacheLru.back());
+        mCacheLru.pop_back();
+    }
+
+exit:
+    return;
+}
+
+otbrError UpstreamResolver::StartQuery(std::vector<uint8_t> &&aMessage, const std::string &aKey, const Waiter &aWaiter)
+{
+    otbrError     error = OTBR_ERROR_NONE;
+    uint16_t      messageId;
+    PendingQuery *query;
+
+    RefreshServers();
+    VerifyOrExit(!mServers.empty(), error = OTBR_ERROR_NOT_FOUND);
+
+    // The upstream message IDs are random, so that responses cannot easily be spoofed.
+    do
+    {
+        SuccessOrExit(otRandomCryptoFillBuffer(reinterpret_cast<uint8_t *>(&messageId), sizeof(messageId)),
+                      error = OTBR_ERROR_ABORTED);
+    } while (mPendingQueries.count(messageId) != 0);
+
+    WriteUint16(aMessage.data(), messageId);
+
+    query            = &mPendingQueries[messageId];
+    query->mKey      = aKey;
+    query->mMessage  = std::move(aMessage);
+    query->mDeadline = Clock::now() + kQueryTimeout;
+    query->mOverTcp  = OTBR_DNS_UPSTREAM_RESOLVER_USE_TCP || query->mMessage.size() > kMaxUdpMessageSize;
+    query->mWaiters.push_back(aWaiter);
+    if (!aKey.empty())
+    {
+        mPendingKeys[aKey] = messageId;
+    }
+    mCounters.mUpstreamQueries++;
+
+    // A query lost with a broken connection is finished while it is sent, but the error is only for a query which
+    // could not be sent at all, whose waiter is notified by the caller.
+    error = SendQuery(*query);
+    if (error != OTBR_ERROR_NONE)
+    {
+        mPendingQueries.erase(messageId);
+        mPendingKeys.erase(aKey);
+        ExitNow();
+    }
+
+    ArmTimer();
+
+exit:
+    return error;
+}
+
+otbrError UpstreamResolver::SendQuery(PendingQuery &aQuery)
+{
+    otbrError           error  = OTBR_ERROR_NONE;
+    const sockaddr_in6 &server = mServers[mServerIndex];
+
+    if (aQuery.mOverTcp)
+    {
+        SuccessOrExit(error = OpenTcpConnection());
+
+        mTcpConnection.mSendBuffer.push_back(static_cast<uint8_t>(aQuery.mMessage.size() >> 8));
+        mTcpConnection.mSendBuffer.push_back(static_cast<uint8_t>(aQuery.mMessage.size()));
+        mTcpConnection.mSendBuffer.insert(mTcpConnection.mSendBuffer.end(), aQuery.mMessage.begin(),
+                                          aQuery.mMessage.end());
+        mCounters.mTcpQueries++;
+
+        // The query is pipelined behind the previous ones, which are not necessarily answered yet.
+        if (mTcpConnection.mIsConnected)
+        {
+            FlushTcpConnection();
+        }
+        ExitNow();
+    }
+
+    SuccessOrExit(error = OpenUdpSocket());
+    VerifyOrExit(sendto(mUdpFd, aQuery.mMessage.data(), aQuery.mMessage.size(), 0,
+                        reinterpret_cast<const sockaddr *>(&server), sizeof(server)) >= 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+void UpstreamResolver::HandleResponse(const uint8_t *aResponse, uint16_t aLength)
+{
+    PendingQueryMap::iterator it;
+    std::string               key;
+
+    VerifyOrExit(aLength >= kDnsHeaderSize);
+    it = mPendingQueries.find(ReadUint16(aResponse));
+    VerifyOrExit(it != mPendingQueries.end());
+
+    // The response must answer the question which was asked.
+    VerifyOrExit(it->second.mKey.empty() ||
+                 (GetDnsQueryKey(aResponse, aLength, key) == OTBR_ERROR_NONE && key == it->second.mKey));
+
+    if (ReadUint16(aResponse + kDnsFlagsOffset) & kDnsFlagTruncated)
+    {
+        VerifyOrExit(!it->second.mOverTcp, FinishQuery(it, aResponse, aLength));
+
+        otbrLogDebug("Truncated response, retry over TCP");
+        it->second.mOverTcp = true;
+        if (SendQuery(it->second) != OTBR_ERROR_NONE)
+        {
+            FinishQuery(it, aResponse, aLength);
+        }
+        ExitNow();
+    }
+
+    if (!it->second.mKey.empty())
+    {
+        AddToCache(it->second.mKey, aResponse, aLength);
+    }
+    FinishQuery(it, aResponse, aLength);
+
+exit:
+    return;
+}
+
+void UpstreamResolver::FinishQuery(PendingQueryMap::iterator aIt, const uint8_t *aResponse, uint16_t aLength)
+{
+    PendingQuery query = std::move(aIt->second);
+
+    mPendingQueries.erase(aIt);
+    if (!query.mKey.empty())
+    {
+        mPendingKeys.erase(query.mKey);
+    }
+
+    for (const Waiter &waiter : query.mWaiters)
+    {
+        Reply(waiter, aResponse, aLength);
+    }
+
+    if (query.mOverTcp)
+    {
+        mTcpConnection.mLastActivity = Clock::now();
+    }
+}
+
+void UpstreamResolver::Reply(const Waiter &aWaiter, const uint8_t *aResponse, uint16_t aLength)
+{
+    otMessage           *message = nullptr;
+    std::vector<uint8_t> response;
+
+    VerifyOrExit(aResponse != nullptr);
+
+    response.assign(aResponse, aResponse + aLength);
+    WriteUint16(response.data(), aWaiter.mMessageId);
+
+    message = otUdpNewMessage(GetInstance(), nullptr);
+    VerifyOrExit(message != nullptr);
+    if (otMessageAppend(message, response.data(), aLength) != OT_ERROR_NONE)
+    {
+        otMessageFree(message);
+        message = nullptr;
+    }
+
+exit:
+    // The Thread stack answers with a server failure without response.
+    otPlatDnsUpstreamQueryDone(GetInstance(), aWaiter.mTxn, message);
+}
+
+otbrError UpstreamResolver::OpenUdpSocket(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       v6Only = 0;
+
+    VerifyOrExit(mUdpFd == -1);
+
+    mUdpFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mUdpFd != -1, error = OTBR_ERROR_ERRNO);
+
+    // The IPv4 servers are reached through their IPv4-mapped addresses.
+    if (setsockopt(mUdpFd, IPPROTO_IPV6, IPV6_V6ONLY, &v6Only, sizeof(v6Only)) != 0)
+    {
+        error = OTBR_ERROR_ERRNO;
+        close(mUdpFd);
+        mUdpFd = -1;
+        ExitNow();
+    }
+
+    MainloopManager::GetInstance().AddFd(
+        mUdpFd, MainloopManager::kEventReadable, [this](uint8_t aEvents) { HandleUdpEvents(aEvents); },
+        "UpstreamResolver");
+
+exit:
+    return error;
+}
+
+void UpstreamResolver::HandleUdpEvents(uint8_t aEvents)
+{
+    uint8_t      buffer[kMaxUdpMessageSize];
+    sockaddr_in6 from;
+    socklen_t    fromLength;
+    ssize_t      length;
+
+    VerifyOrExit(aEvents & MainloopManager::kEventReadable);
+
+    while (true)
+    {
+        fromLength = sizeof(from);
+        length     = recvfrom(mUdpFd, buffer, sizeof(buffer), 0, reinterpret_cast<sockaddr *>(&from), &fromLength);
+        VerifyOrExit(length >= 0);
+
+        // Only the responses of the upstream servers are accepted.
+        if (std::none_of(mServers.begin(), mServers.end(), [&from](const sockaddr_in6 &aServer) {
+                return aServer.sin6_port == from.sin6_port &&
+                       memcmp(&aServer.sin6_addr, &from.sin6_addr, sizeof(from.sin6_addr)) == 0;
+            }))
+        {
+            continue;
+        }
+
+        HandleResponse(buffer, static_cast<uint16_t>(length));
+    }
+
+exit:
+    return;
+}
+
+otbrError UpstreamResolver::OpenTcpConnection(void)
+{
+    otbrError           error  = OTBR_ERROR_NONE;
+    const sockaddr_in6 &server = mServers[mServerIndex];
+    int                 v6Only = 0;
+
+    VerifyOrExit(mTcpConnection.mFd == -1);
+
+    mTcpConnection.mFd = socket(AF_INET6, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mTcpConnection.mFd != -1, error = OTBR_ERROR_ERRNO);
+
+    if (setsockopt(mTcpConnection.mFd, IPPROTO_IPV6, IPV6_V6ONLY, &v6Only, sizeof(v6Only)) != 0 ||
+        (connect(mTcpConnection.mFd, reinterpret_cast<const sockaddr *>(&server), sizeof(server)) != 0 &&
+         errno != EINPROGRESS))
+    {
+        error = OTBR_ERROR_ERRNO;
+        close(mTcpConnection.mFd);
+        mTcpConnection.mFd = -1;
+        ExitNow();
+    }
+
+    mTcpConnection.mIsConnected  = false;
+    mTcpConnection.mLastActivity = Clock::now();
+
+    // The connection is writable once it is established.
+    MainloopManager::GetInstance().AddFd(
+        mTcpConnection.mFd, MainloopManager::kEventReadable | MainloopManager::kEventWritable,
+        [this](uint8_t aEvents) { HandleTcpEvents(aEvents); }, "UpstreamResolver");
+
+exit:
+    return error;
+}
+
+void UpstreamResolver::CloseTcpConnection(void)
+{
+    VerifyOrExit(mTcpConnection.mFd != -1);
+
+    MainloopManager::GetInstance().RemoveFd(mTcpConnection.mFd);
+    close(mTcpConnection.mFd);
+    mTcpConnection.mFd          = -1;
+    mTcpConnection.mIsConnected = false;
+    mTcpConnection.mSendBuffer.clear();
+    mTcpConnection.mReceiveBuffer.clear();
+
+    // The queries sent over the connection are lost.
+    for (auto it = mPendingQueries.begin(); it != mPendingQueries.end();)
+    {
+        auto next = std::next(it);
+
+        if (it->second.mOverTcp)
+        {
+            FinishQuery(it, nullptr, 0);
+        }
+        it = next;
+    }
+
+exit:
+    return;
+}
+
+void UpstreamResolver::HandleTcpEvents(uint8_t aEvents)
+{
+    uint8_t buffer[kMaxUdpMessageSize];
+    ssize_t length;
+    bool    isClosed;
+
+    if (!mTcpConnection.mIsConnected && (aEvents & (MainloopManager::kEventWritable | MainloopManager::kEventError)))
+    {
+        int       socketError = 0;
+        socklen_t errorLength = sizeof(socketError);
+
+        if (getsockopt(mTcpConnection.mFd, SOL_SOCKET, SO_ERROR, &socketError, &errorLength) != 0 || socketError != 0)
+        {
+            otbrLogWarning("Failed to connect to the upstream server: %s", strerror(socketError));
+            ExitNow(CloseTcpConnection());
+        }
+        mTcpConnection.mIsConnected = true;
+    }
+
+    if (aEvents & MainloopManager::kEventWritable)
+    {
+        FlushTcpConnection();
+    }
+
+    VerifyOrExit(aEvents & (MainloopManager::kEventReadable | MainloopManager::kEventError));
+
+    while ((length = recv(mTcpConnection.mFd, buffer, sizeof(buffer), 0)) > 0)
+    {
+        mTcpConnection.mReceiveBuffer.insert(mTcpConnection.mReceiveBuffer.end(), buffer, buffer + length);
+    }
+
+    isClosed                     = (length == 0 || (errno != EAGAIN && errno != EWOULDBLOCK));
+    mTcpConnection.mLastActivity = Clock::now();
+
+    // Each message is prefixed with its length.
+    while (mTcpConnection.mReceiveBuffer.size() >= kTcpLengthSize)
+    {
+        const uint8_t *data          = mTcpConnection.mReceiveBuffer.data();
+        size_t         messageLength = ReadUint16(data);
+
+        if (mTcpConnection.mReceiveBuffer.size() < kTcpLengthSize + messageLength)
+        {
+            break;
+        }
+
+        HandleResponse(data + kTcpLengthSize, static_cast<uint16_t>(messageLength));
+
+        // The connection may have been closed while finishing the query.
+        VerifyOrExit(mTcpConnection.mFd != -1);
+        mTcpConnection.mReceiveBuffer.erase(mTcpConnection.mReceiveBuffer.begin(),
+                                            mTcpConnection.mReceiveBuffer.begin() + kTcpLengthSize + messageLength);
+    }
+
+    if (isClosed)
+    {
+        // The server closes the connection when it is idle or after some queries, the unanswered queries fail.
+        otbrLogDebug("Upstream TCP connection closed");
+        CloseTcpConnection();
+    }
+
+exit:
+    return;
+}
+
+void UpstreamResolver::FlushTcpConnection(void)
+{
+    ssize_t sent;
+
+    VerifyOrExit(mTcpConnection.mIsConnected);
+
+    if (!mTcpConnection.mSendBuffer.empty())
+    {
+        sent = send(mTcpConnection.mFd, mTcpConnection.mSendBuffer.data(), mTcpConnection.mSendBuffer.size(),
+                    MSG_NOSIGNAL);
+        if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            otbrLogWarning("Failed to send to the upstream server: %s", strerror(errno));
+            ExitNow(CloseTcpConnection());
+        }
+        if (sent > 0)
+        {
+            mTcpConnection.mSendBuffer.erase(mTcpConnection.mSendBuffer.begin(),
+                                             mTcpConnection.mSendBuffer.begin() + sent);
+        }
+    }
+
+    MainloopManager::GetInstance().UpdateFd(
+        mTcpConnection.mFd, MainloopManager::kEventReadable |
+                                (mTcpConnection.mSendBuffer.empty() ? 0 : MainloopManager::kEventWritable));
+
+exit:
+    return;
+}
+
+bool UpstreamResolver::HasPendingTcpQueries(void) const
+{
+    return std::any_of(mPendingQueries.begin(), mPendingQueries.end(),
+                       [](const PendingQueryMap::value_type &aQuery) { return aQuery.second.mOverTcp; });
+}
+
+void UpstreamResolver::ArmTimer(void)
+{
+    Timepoint now      = Clock::now();
+    Timepoint deadline = Timepoint::max();
+
+    for (const auto &query : mPendingQueries)
+    {
+        deadline = std::min(deadline, query.second.mDeadline);
+    }
+    if (mTcpConnection.mFd != -1)
+    {
+        deadline = std::min(deadline, mTcpConnection.mLastActivity + kTcpIdleTimeout);
+    }
+
+    mTaskRunner.Cancel(mTimerTaskId);
+    mTimerTaskId = 0;
+    VerifyOrExit(deadline != Timepoint::max());
+
+    mTimerTaskId = mTaskRunner.Post(deadline > now ? std::chrono::duration_cast<Milliseconds>(deadline - now)
+                                                   : Milliseconds(0),
+                                    [this]() { HandleTimer(); });
+
+exit:
+    return;
+}
+
+void UpstreamResolver::HandleTimer(void)
+{
+    Timepoint now      = Clock::now();
+    bool      timedOut = false;
+
+    mTimerTaskId = 0;
+
+    for (auto it = mPendingQueries.begin(); it != mPendingQueries.end();)
+    {
+        auto next = std::next(it);
+
+        if (it->second.mDeadline <= now)
+        {
+            mCounters.mTimeouts++;
+            timedOut = true;
+            FinishQuery(it, nullptr, 0);
+        }
+        it = next;
+    }
+
+    if (timedOut && !mServers.empty())
+    {
+        mServerIndex = (mServerIndex + 1) % mServers.size();
+        otbrLogWarning("Upstream queries timed out, switch to upstream server %zu", mServerIndex);
+    }
+
+    // The connection to the previous server, or an idle one, is closed once no query is waiting for it.
+    if (mTcpConnection.mFd != -1 && !HasPendingTcpQueries() &&
+        (timedOut || now >= mTcpConnection.mLastActivity + kTcpIdleTimeout))
+    {
+        CloseTcpConnection();
+    }
+
+    ArmTimer();
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
@@ -0,0 +1,262 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the caching upstream DNS resolver.
+ */
+
+#ifndef OTBR_SDP_PROXY_UPSTREAM_RESOLVER_HPP_
+#define OTBR_SDP_PROXY_UPSTREAM_RESOLVER_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <time.h>
+
+#include <netinet/in.h>
+
+#include <openthread/instance.h>
+#include <openthread/message.h>
+#include <openthread/platform/dns.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "ncp/rcp_host.hpp"
+
+/**
+ * The maximum number of responses kept in the cache of the upstream resolver, the least recently used ones are
+ * evicted beyond it.
+ *
+ */
+#ifndef OTBR_DNS_UPSTREAM_RESOLVER_CACHE_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_DNS_UPSTREAM_RESOLVER_CACHE_SIZE 32
+#else
+#define OTBR_DNS_UPSTREAM_RESOLVER_CACHE_SIZE 256
+#endif
+#endif
+
+/**
+ * The maximum time in seconds for which a response is cached, whatever the TTLs of its records.
+ *
+ */
+#ifndef OTBR_DNS_UPSTREAM_RESOLVER_MAX_CACHE_TTL
+#define OTBR_DNS_UPSTREAM_RESOLVER_MAX_CACHE_TTL 3600
+#endif
+
+/**
+ * Whether all the queries are sent over TCP, otherwise only the queries whose UDP responses are truncated are.
+ *
+ */
+#ifndef OTBR_DNS_UPSTREAM_RESOLVER_USE_TCP
+#define OTBR_DNS_UPSTREAM_RESOLVER_USE_TCP 0
+#endif
+
+namespace otbr {
+
+/**
+ * This class implements a caching resolver of the upstream DNS queries of the Thread stack.
+ *
+ * The queries are answered from a cache of the responses which respects their TTLs. Identical queries are coalesced
+ * while one of them is in flight. The queries over TCP share a single connection to the upstream server, on which they
+ * are pipelined (RFC 7766).
+ *
+ */
+class UpstreamResolver : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the counters of the upstream resolver.
+     *
+     */
+    struct Counters
+    {
+        uint32_t mCacheHits;        ///< The number of queries answered from the cache
+        uint32_t mCacheMisses;      ///< The number of queries not answered from the cache
+        uint32_t mCoalescedQueries; ///< The number of missed queries joining an identical query in flight
+        uint32_t mUpstreamQueries;  ///< The number of queries sent to the upstream servers
+        uint32_t mTcpQueries;       ///< The number of queries sent over TCP
+        uint32_t mTimeouts;         ///< The number of queries not answered in time by the upstream servers
+    };
+
+    /**
+     * This constructor initializes the upstream resolver.
+     *
+     * @param[in] aHost  A reference to the RCP host.
+     *
+     */
+    explicit UpstreamResolver(Ncp::RcpHost &aHost);
+
+    ~UpstreamResolver(void);
+
+    /**
+     * This method starts resolving the upstream queries of the Thread stack.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method stops resolving the upstream queries of the Thread stack.
+     *
+     * The queries in flight are finished without response.
+     *
+     */
+    void Deinit(void);
+
+    /**
+     * This method resolves an upstream query of the Thread stack.
+     *
+     * @param[in] aTxn    A pointer to the transaction of the query.
+     * @param[in] aQuery  A pointer to the DNS query message.
+     *
+     */
+    void Query(otPlatDnsUpstreamQuery *aTxn, const otMessage *aQuery);
+
+    /**
+     * This method cancels an upstream query of the Thread stack.
+     *
+     * @param[in] aTxn  A pointer to the transaction of the query.
+     *
+     * @retval TRUE   The query was being resolved by this resolver and is finished without response.
+     * @retval FALSE  The query is not known by this resolver.
+     *
+     */
+    bool Cancel(otPlatDnsUpstreamQuery *aTxn);
+
+    /**
+     * This method returns the counters of the upstream resolver.
+     *
+     * @returns The counters of the upstream resolver.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method returns the resolver handling the upstream queries of the Thread stack.
+     *
+     * @returns A pointer to the initialized resolver, or null if there is none.
+     *
+     */
+    static UpstreamResolver *GetActive(void) { return sActive; }
+
+private:
+    struct Waiter
+    {
+        otPlatDnsUpstreamQuery *mTxn;       // The transaction of the query.
+        uint16_t                mMessageId; // The message ID of the query, which the response must have.
+    };
+
+    struct PendingQuery
+    {
+        std::string          mKey;     // The cache key, empty if the query is neither cached nor coalesced.
+        std::vector<uint8_t> mMessage; // The query sent upstream, with the upstream message ID.
+        std::vector<Waiter>  mWaiters; // The queries waiting for the response.
+        Timepoint            mDeadline;
+        bool                 mOverTcp;
+    };
+
+    using PendingQueryMap = std::map<uint16_t, PendingQuery>;
+
+    struct CacheEntry
+    {
+        std::vector<uint8_t>             mResponse;
+        Timepoint                        mCachedTime;
+        Timepoint                        mExpireTime;
+        std::list<std::string>::iterator mLruIt;
+    };
+
+    // The connection shared by all the queries over TCP, whose responses may come in any order.
+    struct TcpConnection
+    {
+        int                  mFd          = -1;
+        bool                 mIsConnected = false;
+        std::vector<uint8_t> mSendBuffer;
+        std::vector<uint8_t> mReceiveBuffer;
+        Timepoint            mLastActivity;
+    };
+
+    otInstance *GetInstance(void) { return mHost.GetInstance(); }
+
+    void      RefreshServers(void);
+    bool      AnswerFromCache(const std::string &aKey, const Waiter &aWaiter);
+    void      AddToCache(const std::string &aKey, const uint8_t *aResponse, uint16_t aLength);
+    otbrError StartQuery(std::vector<uint8_t> &&aMessage, const std::string &aKey, const Waiter &aWaiter);
+    otbrError SendQuery(PendingQuery &aQuery);
+    void      HandleResponse(const uint8_t *aResponse, uint16_t aLength);
+    void      FinishQuery(PendingQueryMap::iterator aIt, const uint8_t *aResponse, uint16_t aLength);
+    void      Reply(const Waiter &aWaiter, const uint8_t *aResponse, uint16_t aLength);
+
+    otbrError OpenUdpSocket(void);
+    void      HandleUdpEvents(uint8_t aEvents);
+
+    otbrError OpenTcpConnection(void);
+    void      CloseTcpConnection(void);
+    void      HandleTcpEvents(uint8_t aEvents);
+    void      FlushTcpConnection(void);
+    bool      HasPendingTcpQueries(void) const;
+
+    void ArmTimer(void);
+    void HandleTimer(void);
+
+    static UpstreamResolver *sActive;
+
+    // A reference to the RCP host, has no ownership.
+    Ncp::RcpHost &mHost;
+
+    // The upstream servers read from `resolv.conf`, the IPv4 ones as IPv4-mapped addresses.
+    std::vector<sockaddr_in6> mServers;
+    size_t                    mServerIndex;
+    time_t                    mResolvConfMtime;
+
+    int           mUdpFd;
+    TcpConnection mTcpConnection;
+
+    PendingQueryMap                   mPendingQueries;
+    std::map<std::string, uint16_t>   mPendingKeys;
+    std::map<std::string, CacheEntry> mCache;
+    std::list<std::string>            mCacheLru; // The keys of the cache, the most recently used first.
+
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mTimerTaskId;
+    Counters           mCounters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DNS_UPSTREAM_RESOLVER
+
+#endif // OTBR_SDP_PROXY_UPSTREAM_RESOLVER_HPP_
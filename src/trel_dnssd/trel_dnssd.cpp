@@ -37,15 +37,25 @@
 
 #include "trel_dnssd/trel_dnssd.hpp"
 
+#include <iterator>
+
 #include <inttypes.h>
 #include <net/if.h>
+#include <unistd.h>
+
+#if __linux__
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#endif
 
 #include <openthread/instance.h>
 #include <openthread/link.h>
 #include <openthread/platform/trel.h>
 
 #include "common/code_utils.hpp"
+#include "common/memory_stats.hpp"
 #include "utils/hex.hpp"
+#include "utils/socket_utils.hpp"
 #include "utils/string_utils.hpp"
 
 static const char kTrelServiceName[] = "_trel._udp";
@@ -86,6 +96,19 @@ TrelDnssd::TrelDnssd(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     , mHost(aHost)
 {
     sTrelDnssd = this;
+
+    MemoryStats::GetInstance().AddCounter(this, "trel.peers", [this]() { return mPeers.size(); });
+}
+
+TrelDnssd::~TrelDnssd(void)
+{
+    MemoryStats::GetInstance().RemoveCounters(this);
+
+    if (mNetlinkSocket != -1)
+    {
+        close(mNetlinkSocket);
+        mNetlinkSocket = -1;
+    }
 }
 
 void TrelDnssd::Initialize(std::string aTrelNetif)
@@ -95,6 +118,21 @@ void TrelDnssd::Initialize(std::string aTrelNetif)
     if (IsInitialized())
     {
         otbrLogDebug("Initialized on netif \"%s\"", mTrelNetif.c_str());
+
+#if __linux__
+        // The netif is polled only if its link and address changes can't be received.
+        if (mNetlinkSocket == -1)
+        {
+            mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK | RTMGRP_IPV6_IFADDR);
+
+            if (mNetlinkSocket == -1)
+            {
+                otbrLogWarning("Failed to create netlink socket: %s, will poll netif %s", strerror(errno),
+                               mTrelNetif.c_str());
+            }
+        }
+#endif
+
         CheckTrelNetifReady();
     }
     else
@@ -114,7 +152,7 @@ void TrelDnssd::StartBrowse(void)
         [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
             OnTrelServiceInstanceResolved(aType, aInstanceInfo);
         },
-        /* aHostCallback */ nullptr);
+        /* aHostCallback */ nullptr, kTrelServiceName);
 
     if (IsReady())
     {
@@ -195,7 +233,7 @@ void TrelDnssd::HandleMdnsState(Mdns::Publisher::State aState)
 
     otbrLogDebug("mDNS Publisher is Ready");
     mMdnsPublisherReady = true;
-    RemoveAllPeers();
+    RevalidatePeers();
 
     if (mRegisterInfo.IsPublished())
     {
@@ -251,7 +289,8 @@ void TrelDnssd::PublishTrelService(void)
     mRegisterInfo.mInstanceName = GetTrelInstanceName();
     mPublisher.PublishService(/* aHostName */ "", mRegisterInfo.mInstanceName, kTrelServiceName,
                               Mdns::Publisher::SubTypeList{}, mRegisterInfo.mPort, mRegisterInfo.mTxtData,
-                              [](otbrError aError) { HandlePublishTrelServiceError(aError); });
+                              [](otbrError aError) { HandlePublishTrelServiceError(aError); },
+                              Mdns::Publisher::Priority::kHigh);
 }
 
 void TrelDnssd::HandlePublishTrelServiceError(otbrError aError)
@@ -282,21 +321,22 @@ void TrelDnssd::HandleUnpublishTrelServiceError(otbrError aError)
 
 void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
-    Ip6Address         selectedAddress;
-    otPlatTrelPeerInfo peerInfo;
-
-    // Remove any existing TREL service instance before adding
-    OnTrelServiceInstanceRemoved(instanceName);
-
-    otbrLogDebug("Peer discovered: %s hostname %s addresses %zu port %d priority %d "
-                 "weight %d",
-                 aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(), aInstanceInfo.mAddresses.size(),
-                 aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
+    std::string  instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
+    auto         existing     = mPeersByName.find(instanceName);
+    bool         sameTxtData  = false;
+    Ip6Address   selectedAddress;
+    otSockAddr   sockAddr;
+    otExtAddress extAddr;
+
+    otbrLogDebugRateLimited("Peer discovered: %s hostname %s addresses %zu port %d priority %d "
+                            "weight %d",
+                            aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
+                            aInstanceInfo.mAddresses.size(), aInstanceInfo.mPort, aInstanceInfo.mPriority,
+                            aInstanceInfo.mWeight);
 
     for (const auto &addr : aInstanceInfo.mAddresses)
     {
-        otbrLogDebug("Peer address: %s", addr.ToString().c_str());
+        otbrLogDebugRateLimited("Peer address: %s", addr.ToString().c_str());
 
         // Skip anycast (Refer to https://datatracker.ietf.org/doc/html/rfc2373#section-2.6.1)
         if (addr.m64[1] == 0)
@@ -314,27 +354,46 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
         }
     }
 
+    memcpy(&sockAddr.mAddress, &selectedAddress, sizeof(sockAddr.mAddress));
+    sockAddr.mPort = aInstanceInfo.mPort;
+
+    if (existing != mPeersByName.end() && existing->second->HasTxtData(aInstanceInfo.mTxtData))
+    {
+        // The extended address of a peer resolved again with the same TXT data is not read again.
+        sameTxtData = true;
+        extAddr     = existing->second->mExtAddr;
+
+        // A peer resolved again without any change is neither removed nor notified to OpenThread again.
+        if (!aInstanceInfo.mAddresses.empty() && !memcmp(&existing->second->mSockAddr, &sockAddr, sizeof(sockAddr)))
+        {
+            RefreshPeer(existing->second);
+            HandlePeerDiscovered();
+            ExitNow();
+        }
+    }
+
+    // Remove any existing TREL service instance before adding
+    OnTrelServiceInstanceRemoved(instanceName);
+
     if (aInstanceInfo.mAddresses.empty())
     {
         otbrLogWarning("Peer %s does not have any IPv6 address, ignored", aInstanceInfo.mName.c_str());
         ExitNow();
     }
 
-    peerInfo.mRemoved = false;
-    memcpy(&peerInfo.mSockAddr.mAddress, &selectedAddress, sizeof(peerInfo.mSockAddr.mAddress));
-    peerInfo.mSockAddr.mPort = aInstanceInfo.mPort;
-    peerInfo.mTxtData        = aInstanceInfo.mTxtData.data();
-    peerInfo.mTxtLength      = aInstanceInfo.mTxtData.size();
+    VerifyOrExit(aInstanceInfo.mTxtData.size() <= kMaxPeerTxtLength,
+                 otbrLogWarning("Peer %s has %zu bytes of TXT data, ignored", aInstanceInfo.mName.c_str(),
+                                aInstanceInfo.mTxtData.size()));
 
     {
-        Peer peer(aInstanceInfo.mTxtData, peerInfo.mSockAddr);
+        Peer peer(instanceName, aInstanceInfo.mTxtData, sockAddr, sameTxtData ? &extAddr : nullptr);
 
         VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
 
-        otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
-
-        mPeers.emplace(instanceName, peer);
+        AddPeer(std::move(peer));
+        NotifyAddPeer(mPeers.back());
         CheckPeersNumLimit();
+        HandlePeerDiscovered();
     }
 
 exit:
@@ -344,65 +403,186 @@ exit:
 void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 {
     std::string instanceName = StringUtils::ToLowercase(aInstanceName);
-    auto        it           = mPeers.find(instanceName);
+    auto        it           = mPeersByName.find(instanceName);
 
-    VerifyOrExit(it != mPeers.end());
+    VerifyOrExit(it != mPeersByName.end());
 
-    otbrLogDebug("Peer removed: %s", instanceName.c_str());
+    otbrLogDebugRateLimited("Peer removed: %s", instanceName.c_str());
 
     // Remove the peer only when all instances are removed because one peer can have multiple instances if expired
     // instances were not properly removed by mDNS.
-    if (CountDuplicatePeers(it->second) == 0)
+    if (CountDuplicatePeers(*it->second) == 0)
     {
-        NotifyRemovePeer(it->second);
+        NotifyRemovePeer(*it->second);
     }
 
-    mPeers.erase(it);
+    RemovePeer(it->second);
 
 exit:
     return;
 }
 
-void TrelDnssd::CheckPeersNumLimit(void)
+void TrelDnssd::AddPeer(Peer &&aPeer)
 {
-    const PeerMap::value_type *oldestPeer = nullptr;
+    PeerList::iterator it;
 
-    VerifyOrExit(mPeers.size() >= kPeerCacheSize);
+    assert(mPeersByName.find(aPeer.mInstanceName) == mPeersByName.end());
+
+    it = mPeers.insert(mPeers.end(), std::move(aPeer));
+    mPeersByName.emplace(it->mInstanceName, it);
+    mPeersByExtAddr.emplace(it->GetExtAddrKey(), it);
+}
+
+void TrelDnssd::RemovePeer(PeerList::iterator aPeerIt)
+{
+    auto range = mPeersByExtAddr.equal_range(aPeerIt->GetExtAddrKey());
 
-    for (const auto &entry : mPeers)
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (oldestPeer == nullptr || entry.second.mDiscoverTime < oldestPeer->second.mDiscoverTime)
+        if (it->second == aPeerIt)
         {
-            oldestPeer = &entry;
+            mPeersByExtAddr.erase(it);
+            break;
         }
     }
 
-    OnTrelServiceInstanceRemoved(oldestPeer->first);
+    mPeersByName.erase(aPeerIt->mInstanceName);
+    mPeers.erase(aPeerIt);
+}
+
+void TrelDnssd::RefreshPeer(PeerList::iterator aPeerIt)
+{
+    otbrLogDebugRateLimited("Peer unchanged: %s", aPeerIt->mInstanceName.c_str());
+
+    // The peer is moved to the back as if it were removed and added again, the indexes stay valid.
+    aPeerIt->mStale = false;
+    mPeers.splice(mPeers.end(), mPeers, aPeerIt);
+}
+
+void TrelDnssd::HandlePeerDiscovered(void)
+{
+    VerifyOrExit(mIsWaitingForFirstPeer);
+
+    mIsWaitingForFirstPeer = false;
+    mTimeToFirstPeer       = std::chrono::duration_cast<Milliseconds>(MainloopClock::Now() - mReadyTime);
+    otbrLogInfo("First peer discovered in %" PRId64 " ms", static_cast<int64_t>(mTimeToFirstPeer.count()));
 
 exit:
     return;
 }
 
+void TrelDnssd::CheckPeersNumLimit(void)
+{
+    VerifyOrExit(mPeers.size() >= kPeerCacheSize);
+
+    // The oldest discovered peer is at the front, since a rediscovered peer is removed and added again.
+    OnTrelServiceInstanceRemoved(mPeers.front().mInstanceName);
+
+exit:
+    return;
+}
+
+void TrelDnssd::NotifyAddPeer(const Peer &aPeer)
+{
+    QueuePeerNotification(aPeer, /* aRemoved */ false);
+}
+
 void TrelDnssd::NotifyRemovePeer(const Peer &aPeer)
 {
-    otPlatTrelPeerInfo peerInfo;
+    QueuePeerNotification(aPeer, /* aRemoved */ true);
+}
+
+void TrelDnssd::QueuePeerNotification(const Peer &aPeer, bool aRemoved)
+{
+    auto              result = mPeerNotificationIndex.emplace(aPeer.GetExtAddrKey(), mPeerNotifications.size());
+    PeerNotification *notification;
 
-    peerInfo.mRemoved   = true;
-    peerInfo.mTxtData   = aPeer.mTxtData.data();
-    peerInfo.mTxtLength = aPeer.mTxtData.size();
-    peerInfo.mSockAddr  = aPeer.mSockAddr;
+    if (result.second)
+    {
+        mPeerNotifications.emplace_back();
+
+        if (mPeerNotifications.size() == 1)
+        {
+            mTaskRunner.Post([this]() { FlushPeerNotifications(); });
+        }
+    }
+
+    // OpenThread identifies the peers by their extended addresses, so only the latest change of a peer is notified.
+    // The removal of another address of a peer doesn't cancel its addition, the peer is still discovered.
+    notification = &mPeerNotifications[result.first->second];
+    VerifyOrExit(result.second || !aRemoved || notification->mRemoved ||
+                 !memcmp(&notification->mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)));
 
-    otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+    notification->mRemoved   = aRemoved;
+    notification->mTxtData   = aPeer.mTxtData;
+    notification->mTxtLength = aPeer.mTxtLength;
+    notification->mSockAddr  = aPeer.mSockAddr;
+
+exit:
+    return;
 }
 
-void TrelDnssd::RemoveAllPeers(void)
+void TrelDnssd::FlushPeerNotifications(void)
 {
-    for (const auto &entry : mPeers)
+    std::vector<PeerNotification> notifications;
+
+    notifications.swap(mPeerNotifications);
+    mPeerNotificationIndex.clear();
+
+    otbrLogDebug("Notify %zu peer changes", notifications.size());
+
+    for (const PeerNotification &notification : notifications)
     {
-        NotifyRemovePeer(entry.second);
+        otPlatTrelPeerInfo peerInfo;
+
+        peerInfo.mRemoved   = notification.mRemoved;
+        peerInfo.mTxtData   = notification.mTxtData.data();
+        peerInfo.mTxtLength = notification.mTxtLength;
+        peerInfo.mSockAddr  = notification.mSockAddr;
+
+        otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+    }
+}
+
+void TrelDnssd::RevalidatePeers(void)
+{
+    VerifyOrExit(!mPeers.empty());
+
+    otbrLogInfo("Announce %zu cached peers, to be validated in %u seconds", mPeers.size(),
+                kPeerValidationTimeoutMs / 1000);
+
+    // The cached peers are announced right away so that TREL keeps working, and the peers which are discovered again
+    // replace them before the validation.
+    for (Peer &peer : mPeers)
+    {
+        peer.mStale = true;
+        NotifyAddPeer(peer);
     }
 
-    mPeers.clear();
+    mTaskRunner.Cancel(mPeerValidationTaskId);
+    mPeerValidationTaskId = mTaskRunner.Post(Milliseconds(kPeerValidationTimeoutMs), [this]() {
+        mPeerValidationTaskId = 0;
+        RemoveStalePeers();
+    });
+
+exit:
+    return;
+}
+
+void TrelDnssd::RemoveStalePeers(void)
+{
+    for (auto it = mPeers.begin(); it != mPeers.end();)
+    {
+        auto next = std::next(it);
+
+        if (it->mStale)
+        {
+            otbrLogInfo("Cached peer %s is not discovered again", it->mInstanceName.c_str());
+            OnTrelServiceInstanceRemoved(it->mInstanceName);
+        }
+
+        it = next;
+    }
 }
 
 void TrelDnssd::CheckTrelNetifReady(void)
@@ -416,19 +596,199 @@ void TrelDnssd::CheckTrelNetifReady(void)
         if (mTrelNetifIndex != 0)
         {
             otbrLogDebug("Netif %s is ready: index = %" PRIu32, mTrelNetif.c_str(), mTrelNetifIndex);
+            mIsTrelNetifRunning = true;
             OnBecomeReady();
         }
+        else if (mNetlinkSocket != -1)
+        {
+            otbrLogWarning("Netif %s is not ready (%s), will check again when it changes", mTrelNetif.c_str(),
+                           strerror(errno));
+        }
         else
         {
             uint16_t delay = kCheckNetifReadyIntervalMs;
 
             otbrLogWarning("Netif %s is not ready (%s), will retry after %d seconds", mTrelNetif.c_str(),
                            strerror(errno), delay / 1000);
-            mTaskRunner.Post(Milliseconds(delay), [this]() { CheckTrelNetifReady(); });
+            mTaskRunner.Post(TaskRunner::Priority::kBackground, Milliseconds(delay),
+                             [this]() { CheckTrelNetifReady(); });
+        }
+    }
+}
+
+void TrelDnssd::Update(MainloopContext &aMainloop)
+{
+    if (mNetlinkSocket != -1)
+    {
+        FD_SET(mNetlinkSocket, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(mNetlinkSocket, aMainloop.mMaxFd);
+    }
+}
+
+void TrelDnssd::Process(const MainloopContext &aMainloop)
+{
+    if (mNetlinkSocket != -1 && FD_ISSET(mNetlinkSocket, &aMainloop.mReadFdSet))
+    {
+        ReceiveNetLinkMessage();
+    }
+}
+
+void TrelDnssd::ReceiveNetLinkMessage(void)
+{
+#if __linux__
+    const size_t kMaxNetLinkBufSize = 8192;
+    ssize_t      len;
+    union
+    {
+        nlmsghdr mHeader;
+        uint8_t  mBuffer[kMaxNetLinkBufSize];
+    } msgBuffer;
+
+    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
+    if (len < 0)
+    {
+        otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
+        ExitNow();
+    }
+
+    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+         header                  = NLMSG_NEXT(header, len))
+    {
+        struct ifinfomsg *ifinfo;
+
+        switch (header->nlmsg_type)
+        {
+        case RTM_NEWLINK:
+            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
+            HandleTrelNetifStateChange(ifinfo->ifi_index, (ifinfo->ifi_flags & IFF_RUNNING) != 0);
+            break;
+        case RTM_DELLINK:
+            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
+            HandleTrelNetifStateChange(ifinfo->ifi_index, /* aIsRunning */ false);
+            break;
+        case RTM_NEWADDR:
+        case RTM_DELADDR:
+            if (mTrelNetifIndex == 0)
+            {
+                CheckTrelNetifReady();
+            }
+            break;
+        default:
+            break;
         }
     }
+
+exit:
+    return;
+#endif
 }
 
+void TrelDnssd::HandleTrelNetifStateChange(uint32_t aNetifIndex, bool aIsRunning)
+{
+    VerifyOrExit(IsInitialized());
+
+    if (mTrelNetifIndex == 0)
+    {
+        CheckTrelNetifReady();
+        ExitNow();
+    }
+
+    VerifyOrExit(aNetifIndex == mTrelNetifIndex && aIsRunning != mIsTrelNetifRunning);
+
+    otbrLogInfo("Netif %s is %s", mTrelNetif.c_str(), aIsRunning ? "running" : "not running");
+    mIsTrelNetifRunning = aIsRunning;
+
+    // The peers are kept while the netif is down, and validated again once it is back.
+    if (aIsRunning && IsReady())
+    {
+        RevalidatePeers();
+    }
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_WARM_RESTART
+void TrelDnssd::SavePeers(Utils::SnapshotWriter &aWriter) const
+{
+    VerifyOrExit(IsInitialized());
+
+    aWriter.AddRecord(Utils::kSnapshotRecordTrelNetif, mTrelNetif.data(), mTrelNetif.size());
+
+    for (const Peer &peer : mPeers)
+    {
+        std::vector<uint8_t> record;
+
+        // The address, port, TXT data length, TXT data and then the instance name.
+        record.resize(kPeerRecordHeaderLength);
+        memcpy(&record[0], &peer.mSockAddr.mAddress, sizeof(otIp6Address));
+        memcpy(&record[sizeof(otIp6Address)], &peer.mSockAddr.mPort, sizeof(uint16_t));
+        record[sizeof(otIp6Address) + sizeof(uint16_t)] = peer.mTxtLength;
+        record.insert(record.end(), peer.mTxtData.begin(), peer.mTxtData.begin() + peer.mTxtLength);
+        record.insert(record.end(), peer.mInstanceName.begin(), peer.mInstanceName.end());
+
+        aWriter.AddRecord(Utils::kSnapshotRecordTrelPeer, record.data(), record.size());
+    }
+
+    otbrLogInfo("Saved %zu peers", mPeers.size());
+
+exit:
+    return;
+}
+
+void TrelDnssd::RestorePeers(const Utils::SnapshotReader &aReader)
+{
+    bool   sameNetif = false;
+    size_t count     = 0;
+
+    VerifyOrExit(IsInitialized());
+
+    aReader.ForEachRecord(Utils::kSnapshotRecordTrelNetif, [this, &sameNetif](const uint8_t *aValue, uint16_t aLength) {
+        sameNetif = (mTrelNetif == std::string(reinterpret_cast<const char *>(aValue), aLength));
+    });
+    VerifyOrExit(sameNetif);
+
+    aReader.ForEachRecord(Utils::kSnapshotRecordTrelPeer, [this, &count](const uint8_t *aValue, uint16_t aLength) {
+        count += RestorePeer(aValue, aLength) ? 1 : 0;
+    });
+
+    otbrLogInfo("Restored %zu peers", count);
+
+exit:
+    return;
+}
+
+bool TrelDnssd::RestorePeer(const uint8_t *aRecord, uint16_t aLength)
+{
+    bool           restored = false;
+    otSockAddr     sockAddr;
+    uint8_t        txtLength;
+    const uint8_t *txtData = aRecord + kPeerRecordHeaderLength;
+
+    VerifyOrExit(aLength >= kPeerRecordHeaderLength && mPeers.size() < kPeerCacheSize);
+    txtLength = aRecord[kPeerRecordHeaderLength - 1];
+    VerifyOrExit(aLength > kPeerRecordHeaderLength + txtLength);
+
+    memcpy(&sockAddr.mAddress, aRecord, sizeof(otIp6Address));
+    memcpy(&sockAddr.mPort, aRecord + sizeof(otIp6Address), sizeof(uint16_t));
+
+    {
+        std::string name(reinterpret_cast<const char *>(txtData + txtLength),
+                         aLength - kPeerRecordHeaderLength - txtLength);
+        Peer        peer(name, std::vector<uint8_t>(txtData, txtData + txtLength), sockAddr);
+
+        VerifyOrExit(peer.mValid && mPeersByName.find(name) == mPeersByName.end());
+
+        peer.mStale = true;
+        AddPeer(std::move(peer));
+        restored = true;
+    }
+
+exit:
+    return restored;
+}
+#endif // OTBR_ENABLE_WARM_RESTART
+
 bool TrelDnssd::IsReady(void) const
 {
     assert(IsInitialized());
@@ -452,22 +812,28 @@ void TrelDnssd::OnBecomeReady(void)
         {
             PublishTrelService();
         }
+
+        mReadyTime             = MainloopClock::Now();
+        mIsWaitingForFirstPeer = true;
     }
 }
 
-uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer)
+uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer) const
 {
     uint16_t count = 0;
+    auto     range = mPeersByExtAddr.equal_range(aPeer.GetExtAddrKey());
 
-    for (const auto &entry : mPeers)
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (&entry.second == &aPeer)
+        const Peer &peer = *it->second;
+
+        if (&peer == &aPeer)
         {
             continue;
         }
 
-        if (!memcmp(&entry.second.mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)) &&
-            !memcmp(&entry.second.mExtAddr, &aPeer.mExtAddr, sizeof(otExtAddress)))
+        if (!memcmp(&peer.mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)) &&
+            !memcmp(&peer.mExtAddr, &aPeer.mExtAddr, sizeof(otExtAddress)))
         {
             count++;
         }
@@ -497,24 +863,24 @@ const char TrelDnssd::Peer::kTxtRecordExtAddressKey[] = "xa";
 
 void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
 {
-    std::vector<Mdns::Publisher::TxtEntry> txtEntries;
+    Mdns::Publisher::TxtEntryIterator iterator(mTxtData.data(), mTxtLength);
+    Mdns::Publisher::TxtEntryView     txtEntry;
 
     memset(&mExtAddr, 0, sizeof(mExtAddr));
 
-    SuccessOrExit(Mdns::Publisher::DecodeTxtData(txtEntries, mTxtData.data(), mTxtData.size()));
-
-    for (const auto &txtEntry : txtEntries)
+    // The TXT data is only looked up for the ExtAddr entry, without decoding the other entries.
+    while (iterator.GetNextEntry(txtEntry) == OTBR_ERROR_NONE)
     {
         if (txtEntry.mIsBooleanAttribute)
         {
             continue;
         }
 
-        if (StringUtils::EqualCaseInsensitive(txtEntry.mKey, kTxtRecordExtAddressKey))
+        if (txtEntry.KeyMatches(kTxtRecordExtAddressKey))
         {
-            VerifyOrExit(txtEntry.mValue.size() == sizeof(mExtAddr));
+            VerifyOrExit(txtEntry.mValueLength == sizeof(mExtAddr));
 
-            memcpy(mExtAddr.m8, txtEntry.mValue.data(), sizeof(mExtAddr));
+            memcpy(mExtAddr.m8, txtEntry.mValue, sizeof(mExtAddr));
             mValid = true;
             break;
         }
@@ -530,6 +896,16 @@ exit:
     return;
 }
 
+uint64_t TrelDnssd::Peer::GetExtAddrKey(void) const
+{
+    uint64_t key;
+
+    static_assert(sizeof(key) == sizeof(mExtAddr), "The extended address does not fit in the key");
+    memcpy(&key, mExtAddr.m8, sizeof(key));
+
+    return key;
+}
+
 } // namespace TrelDnssd
 
 } // namespace otbr
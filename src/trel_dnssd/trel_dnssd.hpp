@@ -38,14 +38,38 @@
 
 #if OTBR_ENABLE_TREL
 
-#include <assert.h>
+#include <algorithm>
+#include <array>
+#include <list>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <assert.h>
 
 #include <openthread/instance.h>
 
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
+#include "utils/snapshot.hpp"
+
+/**
+ * The maximum number of discovered TREL peers, the oldest discovered peer is removed beyond it.
+ *
+ */
+#ifndef OTBR_TREL_PEER_CACHE_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_TREL_PEER_CACHE_SIZE 32
+#else
+#define OTBR_TREL_PEER_CACHE_SIZE 256
+#endif
+#endif
 
 namespace otbr {
 
@@ -60,7 +84,7 @@ namespace TrelDnssd {
  * @{
  */
 
-class TrelDnssd
+class TrelDnssd : public MainloopProcessor, private NonCopyable
 {
 public:
     /**
@@ -72,6 +96,12 @@ public:
      */
     explicit TrelDnssd(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher);
 
+    /**
+     * This destructor destroys the TrelDnssd instance.
+     *
+     */
+    ~TrelDnssd(void) override;
+
     /**
      * This method initializes the TrelDnssd instance.
      *
@@ -116,9 +146,54 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method returns the time it took to discover the first TREL peer since TREL DNS-SD last became ready.
+     *
+     * The cached peers which are announced again before being discovered are not counted.
+     *
+     * @returns The time to the first discovered peer, or zero if no peer has been discovered yet.
+     *
+     */
+    Milliseconds GetTimeToFirstPeer(void) const { return mTimeToFirstPeer; }
+
+    /**
+     * This method returns the TREL network interface name.
+     *
+     * @returns The TREL network interface name, or an empty string if not initialized.
+     *
+     */
+    const std::string &GetTrelNetif(void) const { return mTrelNetif; }
+
+#if OTBR_ENABLE_WARM_RESTART
+    /**
+     * This method saves the discovered peers to a warm restart snapshot.
+     *
+     * @param[in] aWriter  The snapshot writer.
+     *
+     */
+    void SavePeers(Utils::SnapshotWriter &aWriter) const;
+
+    /**
+     * This method restores the peers saved to a warm restart snapshot.
+     *
+     * The peers are only restored if they were discovered on the same TREL netif. They are announced and validated
+     * again like the cached peers once the mDNS publisher is ready.
+     *
+     * @param[in] aReader  The snapshot reader.
+     *
+     */
+    void RestorePeers(const Utils::SnapshotReader &aReader);
+#endif
+
 private:
-    static constexpr size_t   kPeerCacheSize             = 256;
+    static constexpr size_t   kPeerCacheSize             = OTBR_TREL_PEER_CACHE_SIZE;
+    static constexpr size_t   kMaxPeerTxtLength          = 255;
     static constexpr uint16_t kCheckNetifReadyIntervalMs = 5000;
+    static constexpr uint16_t kPeerValidationTimeoutMs   = 10000;
+#if OTBR_ENABLE_WARM_RESTART
+    // The length of a peer record before its TXT data.
+    static constexpr size_t kPeerRecordHeaderLength = sizeof(otIp6Address) + sizeof(uint16_t) + sizeof(uint8_t);
+#endif
 
     struct RegisterInfo
     {
@@ -132,35 +207,77 @@ private:
         void Clear(void);
     };
 
-    using Clock = std::chrono::system_clock;
-
     struct Peer
     {
         static const char kTxtRecordExtAddressKey[];
 
-        explicit Peer(std::vector<uint8_t> aTxtData, const otSockAddr &aSockAddr)
-            : mDiscoverTime(Clock::now())
-            , mTxtData(std::move(aTxtData))
+        // The TXT data is only parsed if the extended address already read from the same TXT data isn't given.
+        explicit Peer(std::string                 aInstanceName,
+                      const std::vector<uint8_t> &aTxtData,
+                      const otSockAddr           &aSockAddr,
+                      const otExtAddress         *aExtAddr = nullptr)
+            : mInstanceName(std::move(aInstanceName))
+            , mTxtLength(static_cast<uint8_t>(aTxtData.size()))
             , mSockAddr(aSockAddr)
         {
-            ReadExtAddrFromTxtData();
+            assert(aTxtData.size() <= kMaxPeerTxtLength);
+            std::copy(aTxtData.begin(), aTxtData.end(), mTxtData.begin());
+
+            if (aExtAddr != nullptr)
+            {
+                mExtAddr = *aExtAddr;
+                mValid   = true;
+            }
+            else
+            {
+                ReadExtAddrFromTxtData();
+            }
+        }
+
+        void     ReadExtAddrFromTxtData(void);
+        uint64_t GetExtAddrKey(void) const;
+        bool     HasTxtData(const std::vector<uint8_t> &aTxtData) const
+        {
+            return aTxtData.size() == mTxtLength && std::equal(aTxtData.begin(), aTxtData.end(), mTxtData.begin());
         }
 
-        void ReadExtAddrFromTxtData(void);
+        std::string                            mInstanceName;
+        std::array<uint8_t, kMaxPeerTxtLength> mTxtData;
+        uint8_t                                mTxtLength;
+        otSockAddr                             mSockAddr;
+        otExtAddress                           mExtAddr;
+        bool                                   mValid = false;
+        bool                                   mStale = false;
+    };
 
-        Clock::time_point    mDiscoverTime;
-        std::vector<uint8_t> mTxtData;
-        otSockAddr           mSockAddr;
-        otExtAddress         mExtAddr;
-        bool                 mValid = false;
+    // The latest change of a peer to be notified to OpenThread.
+    struct PeerNotification
+    {
+        bool                                   mRemoved;
+        std::array<uint8_t, kMaxPeerTxtLength> mTxtData;
+        uint8_t                                mTxtLength;
+        otSockAddr                             mSockAddr;
     };
 
-    using PeerMap = std::map<std::string, Peer>;
+    // The peers are kept in the order of discovery, whose oldest peer is evicted first. They are indexed by their
+    // lowercase instance names and by their extended addresses.
+    using PeerList         = std::list<Peer>;
+    using PeerNameIndex    = std::unordered_map<std::string, PeerList::iterator>;
+    using PeerExtAddrIndex = std::unordered_multimap<uint64_t, PeerList::iterator>;
+
+    // The pending notifications are kept in the order of the first change of each peer, indexed by the extended
+    // addresses of the peers.
+    using PeerNotificationIndex = std::unordered_map<uint64_t, size_t>;
 
     bool        IsInitialized(void) const { return !mTrelNetif.empty(); }
     bool        IsReady(void) const;
     void        OnBecomeReady(void);
     void        CheckTrelNetifReady(void);
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "TrelDnssd"; }
+    void        ReceiveNetLinkMessage(void);
+    void        HandleTrelNetifStateChange(uint32_t aNetifIndex, bool aIsRunning);
     std::string GetTrelInstanceName(void);
     void        PublishTrelService(void);
     void        UnpublishTrelService(void);
@@ -171,20 +288,47 @@ private:
     void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void        OnTrelServiceInstanceRemoved(const std::string &aInstanceName);
 
+    void     AddPeer(Peer &&aPeer);
+    void     RemovePeer(PeerList::iterator aPeerIt);
+    void     RefreshPeer(PeerList::iterator aPeerIt);
+    void     HandlePeerDiscovered(void);
+    void     NotifyAddPeer(const Peer &aPeer);
     void     NotifyRemovePeer(const Peer &aPeer);
+    void     QueuePeerNotification(const Peer &aPeer, bool aRemoved);
+    void     FlushPeerNotifications(void);
+    void     RevalidatePeers(void);
+    void     RemoveStalePeers(void);
     void     CheckPeersNumLimit(void);
-    void     RemoveAllPeers(void);
-    uint16_t CountDuplicatePeers(const Peer &aPeer);
+    uint16_t CountDuplicatePeers(const Peer &aPeer) const;
+#if OTBR_ENABLE_WARM_RESTART
+    bool RestorePeer(const uint8_t *aRecord, uint16_t aLength);
+#endif
 
     Mdns::Publisher &mPublisher;
     Ncp::RcpHost    &mHost;
     TaskRunner       mTaskRunner;
     std::string      mTrelNetif;
-    uint32_t         mTrelNetifIndex = 0;
-    uint64_t         mSubscriberId   = 0;
+    uint32_t         mTrelNetifIndex     = 0;
+    int              mNetlinkSocket      = -1;
+    bool             mIsTrelNetifRunning = false;
+    uint64_t         mSubscriberId       = 0;
     RegisterInfo     mRegisterInfo;
-    PeerMap          mPeers;
+    PeerList         mPeers;
+    PeerNameIndex    mPeersByName;
+    PeerExtAddrIndex mPeersByExtAddr;
     bool             mMdnsPublisherReady = false;
+
+    // The peers are kept when mDNS becomes ready again, and those which are not discovered again until the validation
+    // task runs are removed.
+    TaskRunner::TaskId mPeerValidationTaskId = 0;
+    Timepoint          mReadyTime;
+    bool               mIsWaitingForFirstPeer = false;
+    Milliseconds       mTimeToFirstPeer{0};
+
+    // The changes of the peers are coalesced per peer and notified to OpenThread once per mainloop iteration, so that
+    // a burst of discovered peers doesn't call into OpenThread once per mDNS event.
+    std::vector<PeerNotification> mPeerNotifications;
+    PeerNotificationIndex         mPeerNotificationIndex;
 };
 
 /**
@@ -0,0 +1,492 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the batched TREL UDP socket.
+ */
+
+#define OTBR_LOG_TAG "TrelSock"
+
+#include "trel_dnssd/trel_socket.hpp"
+
+#if OTBR_ENABLE_TREL_BATCHED_IO
+
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+
+// The TREL platform of the Thread stack is served by the OpenThread POSIX platform unless a TREL socket is created.
+// The agent is linked with `--wrap` for these symbols, so that the calls of the Thread stack come here and the
+// `__real_` symbols refer to the implementation of the platform.
+extern "C" void __real_otPlatTrelEnable(otInstance *aInstance, uint16_t *aUdpPort);
+extern "C" void __real_otPlatTrelDisable(otInstance *aInstance);
+extern "C" void __real_otPlatTrelSend(otInstance       *aInstance,
+                                      const uint8_t    *aUdpPayload,
+                                      uint16_t          aUdpPayloadLen,
+                                      const otSockAddr *aDestSockAddr);
+extern "C" void __real_otPlatTrelRegisterService(otInstance    *aInstance,
+                                                 uint16_t       aPort,
+                                                 const uint8_t *aTxtData,
+                                                 uint8_t        aTxtLength);
+extern "C" const otPlatTrelCounters *__real_otPlatTrelGetCounters(otInstance *aInstance);
+extern "C" void                      __real_otPlatTrelResetCounters(otInstance *aInstance);
+
+extern "C" void __wrap_otPlatTrelEnable(otInstance *aInstance, uint16_t *aUdpPort)
+{
+    otbr::TrelDnssd::TrelSocket *socket = otbr::TrelDnssd::TrelSocket::GetActive();
+
+    if (socket != nullptr)
+    {
+        socket->Enable(aInstance, aUdpPort);
+    }
+    else
+    {
+        __real_otPlatTrelEnable(aInstance, aUdpPort);
+    }
+}
+
+extern "C" void __wrap_otPlatTrelDisable(otInstance *aInstance)
+{
+    otbr::TrelDnssd::TrelSocket *socket = otbr::TrelDnssd::TrelSocket::GetActive();
+
+    if (socket != nullptr)
+    {
+        socket->Disable();
+    }
+    else
+    {
+        __real_otPlatTrelDisable(aInstance);
+    }
+}
+
+extern "C" void __wrap_otPlatTrelSend(otInstance       *aInstance,
+                                      const uint8_t    *aUdpPayload,
+                                      uint16_t          aUdpPayloadLen,
+                                      const otSockAddr *aDestSockAddr)
+{
+    otbr::TrelDnssd::TrelSocket *socket = otbr::TrelDnssd::TrelSocket::GetActive();
+
+    if (socket != nullptr)
+    {
+        socket->Send(aUdpPayload, aUdpPayloadLen, *aDestSockAddr);
+    }
+    else
+    {
+        __real_otPlatTrelSend(aInstance, aUdpPayload, aUdpPayloadLen, aDestSockAddr);
+    }
+}
+
+extern "C" void __wrap_otPlatTrelRegisterService(otInstance    *aInstance,
+                                                 uint16_t       aPort,
+                                                 const uint8_t *aTxtData,
+                                                 uint8_t        aTxtLength)
+{
+    otbr::TrelDnssd::TrelSocket *socket = otbr::TrelDnssd::TrelSocket::GetActive();
+
+    if (socket != nullptr)
+    {
+        socket->RegisterService(aPort, aTxtData, aTxtLength);
+    }
+    else
+    {
+        __real_otPlatTrelRegisterService(aInstance, aPort, aTxtData, aTxtLength);
+    }
+}
+
+extern "C" const otPlatTrelCounters *__wrap_otPlatTrelGetCounters(otInstance *aInstance)
+{
+    otbr::TrelDnssd::TrelSocket *socket = otbr::TrelDnssd::TrelSocket::GetActive();
+
+    return (socket != nullptr) ? socket->GetTrelCounters() : __real_otPlatTrelGetCounters(aInstance);
+}
+
+extern "C" void __wrap_otPlatTrelResetCounters(otInstance *aInstance)
+{
+    otbr::TrelDnssd::TrelSocket *socket = otbr::TrelDnssd::TrelSocket::GetActive();
+
+    if (socket != nullptr)
+    {
+        socket->ResetTrelCounters();
+    }
+    else
+    {
+        __real_otPlatTrelResetCounters(aInstance);
+    }
+}
+
+namespace otbr {
+namespace TrelDnssd {
+
+constexpr size_t   TrelSocket::kBatchSize;
+constexpr uint16_t TrelSocket::kMaxPacketSize;
+
+TrelSocket *TrelSocket::sActive = nullptr;
+
+bool TrelSocket::PeerKey::operator<(const PeerKey &aOther) const
+{
+    int result = memcmp(&mAddress, &aOther.mAddress, sizeof(mAddress));
+
+    return (result != 0) ? (result < 0) : (mPort < aOther.mPort);
+}
+
+TrelSocket::TrelSocket(TrelDnssd &aTrelDnssd)
+    : mTrelDnssd(aTrelDnssd)
+    , mInstance(nullptr)
+    , mFd(-1)
+    , mIfIndex(0)
+    , mIsFlushPending(false)
+    , mIsWaitingWritable(false)
+    , mTrelCounters()
+    , mCounters()
+{
+    assert(sActive == nullptr);
+    sActive = this;
+}
+
+TrelSocket::~TrelSocket(void)
+{
+    Disable();
+    sActive = nullptr;
+}
+
+void TrelSocket::Enable(otInstance *aInstance, uint16_t *aUdpPort)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    const std::string &netif = mTrelDnssd.GetTrelNetif();
+    sockaddr_in6       sockAddr;
+    socklen_t          sockAddrLength = sizeof(sockAddr);
+
+    VerifyOrExit(mFd == -1);
+
+    mInstance = aInstance;
+    mIfIndex  = if_nametoindex(netif.c_str());
+    VerifyOrExit(mIfIndex != 0, error = OTBR_ERROR_ERRNO);
+
+    mFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mFd != -1, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mFd, SOL_SOCKET, SO_BINDTODEVICE, netif.c_str(), netif.size()) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    memset(&sockAddr, 0, sizeof(sockAddr));
+    sockAddr.sin6_family = AF_INET6;
+    sockAddr.sin6_addr   = in6addr_any;
+    sockAddr.sin6_port   = htons(*aUdpPort);
+    VerifyOrExit(bind(mFd, reinterpret_cast<const sockaddr *>(&sockAddr), sizeof(sockAddr)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(getsockname(mFd, reinterpret_cast<sockaddr *>(&sockAddr), &sockAddrLength) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    *aUdpPort = ntohs(sockAddr.sin6_port);
+
+    mRxBuffers.resize(kBatchSize * kMaxPacketSize);
+    MainloopManager::GetInstance().AddFd(
+        mFd, MainloopManager::kEventReadable, [this](uint8_t aEvents) { HandleEvents(aEvents); }, "TrelSocket");
+    mTrelDnssd.StartBrowse();
+    otbrLogInfo("Enabled on netif %s, port %u", netif.c_str(), *aUdpPort);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to enable on netif %s: %s", netif.c_str(), strerror(errno));
+        if (mFd != -1)
+        {
+            close(mFd);
+            mFd = -1;
+        }
+    }
+}
+
+void TrelSocket::Disable(void)
+{
+    VerifyOrExit(mFd != -1);
+
+    mTrelDnssd.StopBrowse();
+    mTrelDnssd.UnregisterService();
+
+    MainloopManager::GetInstance().RemoveFd(mFd);
+    close(mFd);
+    mFd                = -1;
+    mIsWaitingWritable = false;
+    mTxQueue.clear();
+    mRxBuffers.clear();
+    mRxBuffers.shrink_to_fit();
+    otbrLogInfo("Disabled");
+
+exit:
+    return;
+}
+
+void TrelSocket::Send(const uint8_t *aPayload, uint16_t aLength, const otSockAddr &aSockAddr)
+{
+    TxPacket *packet;
+
+    VerifyOrExit(mFd != -1 && aLength <= kMaxPacketSize, mTrelCounters.mTxFailure++);
+    VerifyOrExit(mTxQueue.size() < kTxQueueSize, mTrelCounters.mTxFailure++, mCounters.mTxDrops++);
+
+    mTxQueue.emplace_back();
+    packet = &mTxQueue.back();
+    memset(&packet->mSockAddr, 0, sizeof(packet->mSockAddr));
+    packet->mSockAddr.sin6_family   = AF_INET6;
+    packet->mSockAddr.sin6_port     = htons(aSockAddr.mPort);
+    packet->mSockAddr.sin6_scope_id = mIfIndex;
+    memcpy(&packet->mSockAddr.sin6_addr, &aSockAddr.mAddress, sizeof(packet->mSockAddr.sin6_addr));
+    packet->mLength = aLength;
+    memcpy(packet->mPayload, aPayload, aLength);
+
+    // The packets sent by the Thread stack until it yields to the mainloop are sent together, the queue is sent once
+    // the socket is writable again if it's blocked.
+    if (!mIsFlushPending && !mIsWaitingWritable)
+    {
+        mIsFlushPending = true;
+        mTaskRunner.Post([this]() {
+            mIsFlushPending = false;
+            Flush();
+        });
+    }
+
+exit:
+    return;
+}
+
+void TrelSocket::RegisterService(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength)
+{
+    mTrelDnssd.RegisterService(aPort, aTxtData, aTxtLength);
+}
+
+void TrelSocket::ResetTrelCounters(void)
+{
+    memset(&mTrelCounters, 0, sizeof(mTrelCounters));
+}
+
+std::vector<TrelSocket::PeerCounters> TrelSocket::GetPeerCounters(void) const
+{
+    std::vector<PeerCounters> counters;
+
+    counters.reserve(mPeers.size());
+    for (const auto &peer : mPeers)
+    {
+        counters.push_back(peer.second.mCounters);
+    }
+
+    return counters;
+}
+
+void TrelSocket::Flush(void)
+{
+    mmsghdr msgs[kBatchSize];
+    iovec   iovs[kBatchSize];
+
+    while (mFd != -1 && !mTxQueue.empty())
+    {
+        size_t count = std::min(kBatchSize, mTxQueue.size());
+        int    sent;
+
+        memset(msgs, 0, sizeof(msgs));
+        for (size_t i = 0; i < count; i++)
+        {
+            TxPacket &packet = mTxQueue[i];
+
+            iovs[i].iov_base            = packet.mPayload;
+            iovs[i].iov_len             = packet.mLength;
+            msgs[i].msg_hdr.msg_name    = &packet.mSockAddr;
+            msgs[i].msg_hdr.msg_namelen = sizeof(packet.mSockAddr);
+            msgs[i].msg_hdr.msg_iov     = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        sent = sendmmsg(mFd, msgs, static_cast<unsigned int>(count), MSG_DONTWAIT);
+        mCounters.mTxSyscalls++;
+
+        if (sent < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                mIsWaitingWritable = true;
+                MainloopManager::GetInstance().UpdateFd(
+                    mFd, MainloopManager::kEventReadable | MainloopManager::kEventWritable);
+                ExitNow();
+            }
+
+            // Only the first packet failed, the following ones are tried again.
+            otbrLogDebug("Failed to send packet: %s", strerror(errno));
+            mTrelCounters.mTxFailure++;
+            mTxQueue.pop_front();
+            continue;
+        }
+
+        for (int i = 0; i < sent; i++)
+        {
+            const TxPacket &packet = mTxQueue.front();
+            PeerEntry      *peer   = FindOrAddPeer(packet.mSockAddr);
+
+            mTrelCounters.mTxPackets++;
+            mTrelCounters.mTxBytes += packet.mLength;
+            mCounters.mTxPackets++;
+
+            if (peer != nullptr)
+            {
+                peer->mCounters.mTxPackets++;
+                if (peer->mLastTxSyscall != mCounters.mTxSyscalls)
+                {
+                    peer->mLastTxSyscall = mCounters.mTxSyscalls;
+                    peer->mCounters.mTxSyscalls++;
+                }
+            }
+
+            mTxQueue.pop_front();
+        }
+    }
+
+exit:
+    return;
+}
+
+void TrelSocket::HandleEvents(uint8_t aEvents)
+{
+    if ((aEvents & MainloopManager::kEventWritable) && mIsWaitingWritable)
+    {
+        mIsWaitingWritable = false;
+        MainloopManager::GetInstance().UpdateFd(mFd, MainloopManager::kEventReadable);
+        Flush();
+    }
+
+    if (aEvents & MainloopManager::kEventReadable)
+    {
+        Receive();
+    }
+}
+
+void TrelSocket::Receive(void)
+{
+    mmsghdr      msgs[kBatchSize];
+    iovec        iovs[kBatchSize];
+    sockaddr_in6 senders[kBatchSize];
+    int          count;
+
+    do
+    {
+        VerifyOrExit(mFd != -1);
+
+        memset(msgs, 0, sizeof(msgs));
+        for (size_t i = 0; i < kBatchSize; i++)
+        {
+            iovs[i].iov_base            = &mRxBuffers[i * kMaxPacketSize];
+            iovs[i].iov_len             = kMaxPacketSize;
+            msgs[i].msg_hdr.msg_name    = &senders[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(senders[i]);
+            msgs[i].msg_hdr.msg_iov     = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        count = recvmmsg(mFd, msgs, kBatchSize, MSG_DONTWAIT, nullptr);
+        mCounters.mRxSyscalls++;
+        VerifyOrExit(count > 0);
+
+        for (int i = 0; i < count; i++)
+        {
+            PeerEntry *peer = FindOrAddPeer(senders[i]);
+            otSockAddr sender;
+
+            // The truncated packets are dropped, a TREL packet never exceeds the buffer.
+            if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+            {
+                continue;
+            }
+
+            mTrelCounters.mRxPackets++;
+            mTrelCounters.mRxBytes += msgs[i].msg_len;
+            mCounters.mRxPackets++;
+
+            if (peer != nullptr)
+            {
+                peer->mCounters.mRxPackets++;
+                if (peer->mLastRxSyscall != mCounters.mRxSyscalls)
+                {
+                    peer->mLastRxSyscall = mCounters.mRxSyscalls;
+                    peer->mCounters.mRxSyscalls++;
+                }
+            }
+
+            memcpy(&sender.mAddress, &senders[i].sin6_addr, sizeof(sender.mAddress));
+            sender.mPort = ntohs(senders[i].sin6_port);
+            otPlatTrelHandleReceived(mInstance, &mRxBuffers[i * kMaxPacketSize], static_cast<uint16_t>(msgs[i].msg_len),
+                                     &sender);
+
+            // TREL may be disabled while handling a packet.
+            VerifyOrExit(mFd != -1);
+        }
+
+        // A partial batch drained the socket, so there is no need for another system call to find it empty.
+    } while (count == static_cast<int>(kBatchSize));
+
+exit:
+    return;
+}
+
+TrelSocket::PeerEntry *TrelSocket::FindOrAddPeer(const sockaddr_in6 &aSockAddr)
+{
+    PeerEntry *entry = nullptr;
+    PeerKey    key;
+
+    key.mAddress = aSockAddr.sin6_addr;
+    key.mPort    = ntohs(aSockAddr.sin6_port);
+
+    {
+        auto it = mPeers.find(key);
+
+        if (it != mPeers.end())
+        {
+            ExitNow(entry = &it->second);
+        }
+    }
+
+    // The peers beyond the limit are only accounted in the aggregate counters.
+    VerifyOrExit(mPeers.size() < kMaxPeers);
+
+    entry = &mPeers[key];
+    memset(entry, 0, sizeof(*entry));
+    memcpy(&entry->mCounters.mSockAddr.mAddress, &aSockAddr.sin6_addr, sizeof(entry->mCounters.mSockAddr.mAddress));
+    entry->mCounters.mSockAddr.mPort = key.mPort;
+
+exit:
+    return entry;
+}
+
+} // namespace TrelDnssd
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TREL_BATCHED_IO
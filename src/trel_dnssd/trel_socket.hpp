@@ -0,0 +1,260 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the batched TREL UDP socket.
+ */
+
+#ifndef OTBR_TREL_DNSSD_TREL_SOCKET_HPP_
+#define OTBR_TREL_DNSSD_TREL_SOCKET_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_TREL_BATCHED_IO
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <stdint.h>
+
+#include <netinet/in.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/trel.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "trel_dnssd/trel_dnssd.hpp"
+
+/**
+ * The maximum number of TREL packets sent or received by a single system call.
+ *
+ */
+#ifndef OTBR_TREL_BATCH_SIZE
+#define OTBR_TREL_BATCH_SIZE 32
+#endif
+
+/**
+ * The maximum number of TREL packets waiting to be sent, the packets beyond it are dropped.
+ *
+ */
+#ifndef OTBR_TREL_TX_QUEUE_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_TREL_TX_QUEUE_SIZE 32
+#else
+#define OTBR_TREL_TX_QUEUE_SIZE 256
+#endif
+#endif
+
+namespace otbr {
+namespace TrelDnssd {
+
+/**
+ * This class implements the TREL UDP socket with batched system calls.
+ *
+ * The packets sent by the Thread stack in a mainloop iteration, such as the copies of a broadcast frame unicast to
+ * each TREL peer, are queued and sent together with `sendmmsg()` once the Thread stack is done. The received packets
+ * are read with `recvmmsg()`.
+ *
+ */
+class TrelSocket : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the system call counters of the TREL socket.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mTxSyscalls; ///< The number of system calls sending packets
+        uint64_t mTxPackets;  ///< The number of packets sent
+        uint64_t mTxDrops;    ///< The number of packets dropped because the send queue was full
+        uint64_t mRxSyscalls; ///< The number of system calls receiving packets
+        uint64_t mRxPackets;  ///< The number of packets received
+    };
+
+    /**
+     * This structure represents the system call counters of a TREL peer.
+     *
+     */
+    struct PeerCounters
+    {
+        otSockAddr mSockAddr;   ///< The socket address of the peer
+        uint64_t   mTxSyscalls; ///< The number of system calls sending packets to the peer
+        uint64_t   mTxPackets;  ///< The number of packets sent to the peer
+        uint64_t   mRxSyscalls; ///< The number of system calls receiving packets from the peer
+        uint64_t   mRxPackets;  ///< The number of packets received from the peer
+    };
+
+    /**
+     * This constructor initializes the TREL socket.
+     *
+     * The socket serves the TREL platform of the Thread stack from then on, so it must be created before the Thread
+     * stack is initialized.
+     *
+     * @param[in] aTrelDnssd  A reference to the TREL DNS-SD, which knows the TREL netif.
+     *
+     */
+    explicit TrelSocket(TrelDnssd &aTrelDnssd);
+
+    ~TrelSocket(void);
+
+    /**
+     * This method opens the socket and starts browsing for TREL peers.
+     *
+     * @param[in]  aInstance  The OpenThread instance.
+     * @param[out] aUdpPort   The UDP port the socket is bound to.
+     *
+     */
+    void Enable(otInstance *aInstance, uint16_t *aUdpPort);
+
+    /**
+     * This method closes the socket and stops browsing for TREL peers.
+     *
+     * The packets waiting to be sent are dropped.
+     *
+     */
+    void Disable(void);
+
+    /**
+     * This method queues a packet to be sent.
+     *
+     * @param[in] aPayload   A pointer to the UDP payload.
+     * @param[in] aLength    The length of the UDP payload.
+     * @param[in] aSockAddr  The socket address of the peer.
+     *
+     */
+    void Send(const uint8_t *aPayload, uint16_t aLength, const otSockAddr &aSockAddr);
+
+    /**
+     * This method registers the TREL service to DNS-SD.
+     *
+     * @param[in] aPort       The UDP port of TREL service.
+     * @param[in] aTxtData    The TXT data of TREL service.
+     * @param[in] aTxtLength  The TXT length of TREL service.
+     *
+     */
+    void RegisterService(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength);
+
+    /**
+     * This method returns the packet counters of the TREL platform.
+     *
+     * @returns A pointer to the packet counters.
+     *
+     */
+    const otPlatTrelCounters *GetTrelCounters(void) const { return &mTrelCounters; }
+
+    /**
+     * This method resets the packet counters of the TREL platform.
+     *
+     */
+    void ResetTrelCounters(void);
+
+    /**
+     * This method returns the system call counters.
+     *
+     * @returns A reference to the system call counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method returns the system call counters of the TREL peers.
+     *
+     * @returns The system call counters of the peers packets were sent to or received from.
+     *
+     */
+    std::vector<PeerCounters> GetPeerCounters(void) const;
+
+    /**
+     * This method returns the TREL socket serving the TREL platform.
+     *
+     * @returns A pointer to the TREL socket, or nullptr if there is none.
+     *
+     */
+    static TrelSocket *GetActive(void) { return sActive; }
+
+private:
+    static constexpr size_t   kBatchSize     = OTBR_TREL_BATCH_SIZE;
+    static constexpr size_t   kTxQueueSize   = OTBR_TREL_TX_QUEUE_SIZE;
+    static constexpr size_t   kMaxPeers      = 256;
+    static constexpr uint16_t kMaxPacketSize = 1400;
+
+    static_assert(kBatchSize > 0, "OTBR_TREL_BATCH_SIZE must be greater than 0");
+
+    struct TxPacket
+    {
+        sockaddr_in6 mSockAddr;
+        uint16_t     mLength;
+        uint8_t      mPayload[kMaxPacketSize];
+    };
+
+    struct PeerKey
+    {
+        bool operator<(const PeerKey &aOther) const;
+
+        in6_addr mAddress;
+        uint16_t mPort;
+    };
+
+    struct PeerEntry
+    {
+        PeerCounters mCounters;
+        uint64_t     mLastTxSyscall; // The value of `mCounters.mTxSyscalls` when a packet was last sent to the peer.
+        uint64_t     mLastRxSyscall; // The value of `mCounters.mRxSyscalls` when a packet was last received from it.
+    };
+
+    void       Flush(void);
+    void       HandleEvents(uint8_t aEvents);
+    void       Receive(void);
+    PeerEntry *FindOrAddPeer(const sockaddr_in6 &aSockAddr);
+
+    static TrelSocket *sActive;
+
+    TrelDnssd                   &mTrelDnssd;
+    otInstance                  *mInstance;
+    int                          mFd;
+    unsigned int                 mIfIndex;
+    bool                         mIsFlushPending;
+    bool                         mIsWaitingWritable;
+    std::deque<TxPacket>         mTxQueue;
+    std::vector<uint8_t>         mRxBuffers;
+    std::map<PeerKey, PeerEntry> mPeers;
+    otPlatTrelCounters           mTrelCounters;
+    Counters                     mCounters;
+    TaskRunner                   mTaskRunner;
+};
+
+} // namespace TrelDnssd
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TREL_BATCHED_IO
+
+#endif // OTBR_TREL_DNSSD_TREL_SOCKET_HPP_
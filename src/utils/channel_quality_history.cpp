@@ -0,0 +1,211 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the history of the channel qualities.
+ */
+
+#define OTBR_LOG_TAG "CHMON"
+
+#include "utils/channel_quality_history.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <string.h>
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+#include <openthread/channel_monitor.h>
+#include <openthread/link.h>
+#endif
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+constexpr uint8_t  ChannelQualityHistory::kFirstChannel;
+constexpr uint8_t  ChannelQualityHistory::kNumChannels;
+constexpr uint16_t ChannelQualityHistory::kMaxSamples;
+
+ChannelQualityHistory::ChannelQualityHistory(void)
+    : mNext(0)
+    , mCount(0)
+{
+    memset(mOccupancies, 0, sizeof(mOccupancies));
+    memset(mSums, 0, sizeof(mSums));
+    memset(mSumsOfSquares, 0, sizeof(mSumsOfSquares));
+}
+
+void ChannelQualityHistory::AddSample(const uint16_t (&aOccupancies)[kNumChannels])
+{
+    bool isFull = (mCount == kMaxSamples);
+
+    for (uint8_t i = 0; i < kNumChannels; i++)
+    {
+        uint16_t &entry = mOccupancies[i][mNext];
+
+        if (isFull)
+        {
+            mSums[i] -= entry;
+            mSumsOfSquares[i] -= static_cast<uint64_t>(entry) * entry;
+        }
+        entry = aOccupancies[i];
+        mSums[i] += entry;
+        mSumsOfSquares[i] += static_cast<uint64_t>(entry) * entry;
+    }
+
+    mNext  = (mNext + 1) % kMaxSamples;
+    mCount = std::min<uint16_t>(mCount + 1, kMaxSamples);
+}
+
+uint16_t ChannelQualityHistory::GetAverageOccupancy(uint8_t aChannel) const
+{
+    uint16_t average = 0;
+
+    VerifyOrExit(mCount > 0 && aChannel >= kFirstChannel && aChannel < kFirstChannel + kNumChannels);
+    average = static_cast<uint16_t>(mSums[aChannel - kFirstChannel] / mCount);
+
+exit:
+    return average;
+}
+
+uint16_t ChannelQualityHistory::GetOccupancyDeviation(uint8_t aChannel) const
+{
+    uint16_t deviation = 0;
+    double   mean;
+    double   variance;
+
+    VerifyOrExit(mCount > 0 && aChannel >= kFirstChannel && aChannel < kFirstChannel + kNumChannels);
+
+    mean     = static_cast<double>(mSums[aChannel - kFirstChannel]) / mCount;
+    variance = static_cast<double>(mSumsOfSquares[aChannel - kFirstChannel]) / mCount - mean * mean;
+
+    // The rounding errors may make the variance of a constant occupancy slightly negative.
+    deviation = static_cast<uint16_t>(std::lround(std::sqrt(std::max(variance, 0.0))));
+
+exit:
+    return deviation;
+}
+
+uint8_t ChannelQualityHistory::GetRecommendedChannel(uint32_t aChannelMask) const
+{
+    uint8_t  channel   = 0;
+    uint32_t bestScore = UINT32_MAX;
+
+    VerifyOrExit(mCount > 0);
+
+    for (uint8_t candidate = kFirstChannel; candidate < kFirstChannel + kNumChannels; candidate++)
+    {
+        uint32_t score;
+
+        if ((aChannelMask & (1U << candidate)) == 0)
+        {
+            continue;
+        }
+
+        // The lowest channel wins a tie.
+        score = static_cast<uint32_t>(GetAverageOccupancy(candidate)) + GetOccupancyDeviation(candidate);
+        if (score < bestScore)
+        {
+            bestScore = score;
+            channel   = candidate;
+        }
+    }
+
+exit:
+    return channel;
+}
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+constexpr Milliseconds ChannelMonitorSampler::kSampleInterval;
+
+ChannelMonitorSampler::ChannelMonitorSampler(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mSampleTaskId(0)
+    , mIsRunning(false)
+{
+}
+
+void ChannelMonitorSampler::Start(void)
+{
+    VerifyOrExit(!mIsRunning);
+
+    mIsRunning = true;
+    ScheduleNextSample();
+
+exit:
+    return;
+}
+
+void ChannelMonitorSampler::Stop(void)
+{
+    VerifyOrExit(mIsRunning);
+
+    mIsRunning = false;
+    mTaskRunner.Cancel(mSampleTaskId);
+    mSampleTaskId = 0;
+
+exit:
+    return;
+}
+
+void ChannelMonitorSampler::ScheduleNextSample(void)
+{
+    mSampleTaskId = mTaskRunner.Post(kSampleInterval, [this]() { Sample(); });
+}
+
+void ChannelMonitorSampler::Sample(void)
+{
+    uint16_t occupancies[ChannelQualityHistory::kNumChannels];
+    uint32_t channelMask = otLinkGetSupportedChannelMask(mInstance);
+
+    mSampleTaskId = 0;
+
+    // The occupancies are only meaningful once the channel monitor has collected samples.
+    VerifyOrExit(otChannelMonitorIsRunning(mInstance) && otChannelMonitorGetSampleCount(mInstance) > 0);
+
+    for (uint8_t i = 0; i < ChannelQualityHistory::kNumChannels; i++)
+    {
+        uint8_t channel = ChannelQualityHistory::kFirstChannel + i;
+
+        // The unsupported channels are recorded as busy, so that they are never recommended.
+        occupancies[i] =
+            (channelMask & (1U << channel)) ? otChannelMonitorGetChannelOccupancy(mInstance, channel) : UINT16_MAX;
+    }
+    mHistory.AddSample(occupancies);
+    otbrLogDebug("Recorded the channel occupancies, %u samples", mHistory.GetSampleCount());
+
+exit:
+    ScheduleNextSample();
+}
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,202 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the history of the channel qualities.
+ */
+
+#ifndef OTBR_UTILS_CHANNEL_QUALITY_HISTORY_HPP_
+#define OTBR_UTILS_CHANNEL_QUALITY_HISTORY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+
+/**
+ * @def OTBR_CHANNEL_MONITOR_SAMPLE_INTERVAL_MS
+ *
+ * The interval in milliseconds at which the channel occupancies of the channel monitor are recorded.
+ */
+#ifndef OTBR_CHANNEL_MONITOR_SAMPLE_INTERVAL_MS
+#define OTBR_CHANNEL_MONITOR_SAMPLE_INTERVAL_MS 60000
+#endif
+
+/**
+ * @def OTBR_CHANNEL_MONITOR_HISTORY_SIZE
+ *
+ * The number of samples of the channel occupancies kept for each channel.
+ */
+#ifndef OTBR_CHANNEL_MONITOR_HISTORY_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_CHANNEL_MONITOR_HISTORY_SIZE 16
+#else
+#define OTBR_CHANNEL_MONITOR_HISTORY_SIZE 64
+#endif
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class keeps the latest occupancy samples of the 2.4 GHz channels in a fixed-size ring buffer.
+ *
+ * The samples of each channel are stored contiguously, and the sums of each channel are updated as samples are added
+ * and overwritten, so that the statistics never scan the history.
+ *
+ */
+class ChannelQualityHistory
+{
+public:
+    static constexpr uint8_t  kFirstChannel = 11;                                ///< The first channel.
+    static constexpr uint8_t  kNumChannels  = 16;                                ///< The number of channels.
+    static constexpr uint16_t kMaxSamples   = OTBR_CHANNEL_MONITOR_HISTORY_SIZE; ///< The samples kept per channel.
+
+    static_assert(kMaxSamples > 0, "OTBR_CHANNEL_MONITOR_HISTORY_SIZE must be greater than 0");
+
+    /**
+     * The constructor starts with an empty history.
+     *
+     */
+    ChannelQualityHistory(void);
+
+    /**
+     * This method adds a sample of all the channels, which replaces the oldest one if the history is full.
+     *
+     * @param[in] aOccupancies  The occupancy of each channel from `kFirstChannel`, 0 for idle and 0xffff for busy.
+     *
+     */
+    void AddSample(const uint16_t (&aOccupancies)[kNumChannels]);
+
+    /**
+     * This method returns the number of samples in the history.
+     *
+     * @returns The number of samples.
+     *
+     */
+    uint16_t GetSampleCount(void) const { return mCount; }
+
+    /**
+     * This method returns the average occupancy of a channel among the samples.
+     *
+     * @param[in] aChannel  The channel, between `kFirstChannel` and `kFirstChannel + kNumChannels - 1`.
+     *
+     * @returns The average occupancy, or 0 if the history is empty.
+     *
+     */
+    uint16_t GetAverageOccupancy(uint8_t aChannel) const;
+
+    /**
+     * This method returns the standard deviation of the occupancy of a channel among the samples.
+     *
+     * @param[in] aChannel  The channel, between `kFirstChannel` and `kFirstChannel + kNumChannels - 1`.
+     *
+     * @returns The standard deviation of the occupancy, or 0 if the history is empty.
+     *
+     */
+    uint16_t GetOccupancyDeviation(uint8_t aChannel) const;
+
+    /**
+     * This method returns the recommended channel, whose average plus standard deviation of the occupancy is the
+     * lowest, so that a quiet channel with bursts of traffic isn't preferred to a steadily quiet one.
+     *
+     * @param[in] aChannelMask  The mask of the channels to choose among, bit N for channel N.
+     *
+     * @returns The recommended channel, or 0 if the history is empty or the mask has no 2.4 GHz channel.
+     *
+     */
+    uint8_t GetRecommendedChannel(uint32_t aChannelMask) const;
+
+private:
+    uint16_t mOccupancies[kNumChannels][kMaxSamples];
+    uint32_t mSums[kNumChannels];
+    uint64_t mSumsOfSquares[kNumChannels];
+    uint16_t mNext;
+    uint16_t mCount;
+};
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+/**
+ * This class records the channel occupancies of the channel monitor every OTBR_CHANNEL_MONITOR_SAMPLE_INTERVAL_MS.
+ *
+ */
+class ChannelMonitorSampler : private NonCopyable
+{
+public:
+    /**
+     * The constructor of the Channel Monitor Sampler.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit ChannelMonitorSampler(otInstance *aInstance);
+
+    /**
+     * This method starts recording the channel occupancies.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops recording, the history is kept.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method returns the history of the channel occupancies.
+     *
+     * @returns A reference to the history.
+     *
+     */
+    const ChannelQualityHistory &GetHistory(void) const { return mHistory; }
+
+private:
+    static constexpr Milliseconds kSampleInterval = Milliseconds(OTBR_CHANNEL_MONITOR_SAMPLE_INTERVAL_MS);
+
+    void ScheduleNextSample(void);
+    void Sample(void);
+
+    otInstance           *mInstance;
+    TaskRunner            mTaskRunner;
+    TaskRunner::TaskId    mSampleTaskId;
+    ChannelQualityHistory mHistory;
+    bool                  mIsRunning;
+};
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_CHANNEL_QUALITY_HISTORY_HPP_
@@ -0,0 +1,117 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "CONFIG"
+
+#include "utils/config_file.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <errno.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Utils {
+
+namespace {
+
+std::string Trim(const std::string &aString)
+{
+    static const char kWhitespaces[] = " \t\r";
+    size_t            begin          = aString.find_first_not_of(kWhitespaces);
+    size_t            end            = aString.find_last_not_of(kWhitespaces);
+
+    return (begin == std::string::npos) ? "" : aString.substr(begin, end + 1 - begin);
+}
+
+} // namespace
+
+otbrError ConfigFile::Parse(const std::string &aContent, std::vector<Entry> &aEntries)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    std::istringstream stream(aContent);
+    std::string        line;
+    uint32_t           lineNumber = 0;
+
+    aEntries.clear();
+
+    while (std::getline(stream, line))
+    {
+        size_t separator;
+        Entry  entry;
+
+        lineNumber++;
+        line = Trim(line);
+
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        separator = line.find('=');
+        VerifyOrExit(separator != std::string::npos && separator > 0, error = OTBR_ERROR_INVALID_ARGS,
+                     otbrLogWarning("Malformed setting at line %u", lineNumber));
+
+        entry.mKey   = Trim(line.substr(0, separator));
+        entry.mValue = Trim(line.substr(separator + 1));
+        entry.mLine  = lineNumber;
+        VerifyOrExit(!entry.mKey.empty(), error = OTBR_ERROR_INVALID_ARGS,
+                     otbrLogWarning("Malformed setting at line %u", lineNumber));
+        aEntries.push_back(std::move(entry));
+    }
+
+exit:
+    return error;
+}
+
+otbrError ConfigFile::Load(const std::string &aPath, std::vector<Entry> &aEntries)
+{
+    otbrError         error = OTBR_ERROR_NONE;
+    std::ifstream     file(aPath);
+    std::stringstream content;
+
+    VerifyOrExit(file.is_open(), error = OTBR_ERROR_ERRNO);
+    content << file.rdbuf();
+    VerifyOrExit(!file.bad(), error = OTBR_ERROR_ERRNO);
+
+    error = Parse(content.str(), aEntries);
+
+exit:
+    if (error == OTBR_ERROR_ERRNO)
+    {
+        otbrLogWarning("Failed to read %s: %s", aPath.c_str(), strerror(errno));
+    }
+    return error;
+}
+
+} // namespace Utils
+} // namespace otbr
@@ -0,0 +1,99 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for reading the runtime configuration file of the agent.
+ */
+
+#ifndef OTBR_UTILS_CONFIG_FILE_HPP_
+#define OTBR_UTILS_CONFIG_FILE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This class implements the reader of a configuration file.
+ *
+ * Each line of the file is either empty, a comment starting with `#`, or a `key=value` setting. The whitespaces
+ * around the keys and the values are ignored, and a key may be set more than once.
+ *
+ */
+class ConfigFile
+{
+public:
+    /**
+     * This structure represents a setting of the configuration file.
+     *
+     */
+    struct Entry
+    {
+        std::string mKey;   ///< The key of the setting.
+        std::string mValue; ///< The value of the setting, may be empty.
+        uint32_t    mLine;  ///< The line number of the setting, starting from 1.
+    };
+
+    /**
+     * This method parses the content of a configuration file.
+     *
+     * @param[in]  aContent  The content of the configuration file.
+     * @param[out] aEntries  The settings in the order of the file.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully parsed the content.
+     * @retval OTBR_ERROR_INVALID_ARGS  A line is neither empty, a comment nor a setting with a key.
+     *
+     */
+    static otbrError Parse(const std::string &aContent, std::vector<Entry> &aEntries);
+
+    /**
+     * This method reads and parses a configuration file.
+     *
+     * @param[in]  aPath     The path of the configuration file.
+     * @param[out] aEntries  The settings in the order of the file.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully read the configuration file.
+     * @retval OTBR_ERROR_ERRNO         Failed to read the configuration file.
+     * @retval OTBR_ERROR_INVALID_ARGS  The configuration file is malformed.
+     *
+     */
+    static otbrError Load(const std::string &aPath, std::vector<Entry> &aEntries);
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // OTBR_UTILS_CONFIG_FILE_HPP_
@@ -36,29 +36,57 @@
 namespace otbr {
 
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTable(GetTable(aPolynomial))
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+void Crc16::Update(const uint8_t *aBuffer, uint16_t aLength)
 {
-    uint8_t i;
-
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        Update(aBuffer[i]);
+    }
+}
 
-    do
+const uint16_t *Crc16::GetTable(Polynomial aPolynomial)
+{
+    // The tables are initialized on first use, which is thread-safe for function-local statics.
+    static const struct Tables
     {
-        if (mCrc & 0x8000)
+        Tables(void)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
+            InitTable(kCcitt, mCcitt);
+            InitTable(kAnsi, mAnsi);
         }
-        else
+
+        uint16_t mCcitt[kTableSize];
+        uint16_t mAnsi[kTableSize];
+    } sTables;
+
+    return (aPolynomial == kCcitt) ? sTables.mCcitt : sTables.mAnsi;
+}
+
+void Crc16::InitTable(uint16_t aPolynomial, uint16_t *aTable)
+{
+    for (uint16_t byte = 0; byte < kTableSize; byte++)
+    {
+        uint16_t crc = static_cast<uint16_t>(byte << 8);
+
+        for (uint8_t i = 0; i < 8; i++)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
+            if (crc & 0x8000)
+            {
+                crc = static_cast<uint16_t>(crc << 1) ^ aPolynomial;
+            }
+            else
+            {
+                crc = static_cast<uint16_t>(crc << 1);
+            }
         }
-    } while (--i);
+
+        aTable[byte] = crc;
+    }
 }
 
 } // namespace otbr
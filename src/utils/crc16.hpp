@@ -73,7 +73,16 @@ public:
      * @param[in] aByte  The byte value.
      *
      */
-    void Update(uint8_t aByte);
+    void Update(uint8_t aByte) { mCrc = static_cast<uint16_t>((mCrc << 8) ^ mTable[(mCrc >> 8) ^ aByte]); }
+
+    /**
+     * This method feeds bytes into the CRC16 computation.
+     *
+     * @param[in] aBuffer  A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     */
+    void Update(const uint8_t *aBuffer, uint16_t aLength);
 
     /**
      * This method gets the current CRC16 value.
@@ -84,8 +93,14 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    static constexpr uint16_t kTableSize = 256;
+
+    static const uint16_t *GetTable(Polynomial aPolynomial);
+    static void            InitTable(uint16_t aPolynomial, uint16_t *aTable);
+
+    // The CRC of each byte value, so that a byte is processed with a single lookup instead of eight shifts.
+    const uint16_t *mTable;
+    uint16_t        mCrc;
 };
 
 } // namespace otbr
@@ -0,0 +1,292 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements keeping the DHCPv6-PD lease across restarts.
+ */
+
+#define OTBR_LOG_TAG "PD"
+
+#include "utils/dhcp6_pd_lease.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if OTBR_ENABLE_DHCP6_PD
+#include <openthread/platform/border_routing.h>
+#endif
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+constexpr uint32_t Dhcp6PdLease::kInfiniteLifetime;
+
+Dhcp6PdLease::Dhcp6PdLease(void)
+{
+    Clear();
+}
+
+void Dhcp6PdLease::Set(const Ip6Prefix &aPrefix,
+                       uint32_t         aValidLifetime,
+                       uint32_t         aPreferredLifetime,
+                       uint64_t         aUpdateTime)
+{
+    mPrefix         = aPrefix;
+    mValidUntil     = GetExpiryTime(aValidLifetime, aUpdateTime);
+    mPreferredUntil = GetExpiryTime(aPreferredLifetime, aUpdateTime);
+}
+
+void Dhcp6PdLease::Clear(void)
+{
+    mPrefix.Clear();
+    mValidUntil     = 0;
+    mPreferredUntil = 0;
+}
+
+bool Dhcp6PdLease::Matches(const Dhcp6PdLease &aOther) const
+{
+    return mPrefix == aOther.mPrefix && IsClose(mValidUntil, aOther.mValidUntil) &&
+           IsClose(mPreferredUntil, aOther.mPreferredUntil);
+}
+
+void Dhcp6PdLease::Save(Utils::SnapshotWriter &aWriter) const
+{
+    uint8_t record[kRecordLength];
+    size_t  offset = 0;
+
+    VerifyOrExit(!IsEmpty());
+
+    // The prefix, its length and then the expiry times.
+    memcpy(&record[offset], &mPrefix.mPrefix, sizeof(Ip6Address));
+    offset += sizeof(Ip6Address);
+    record[offset++] = mPrefix.mLength;
+    memcpy(&record[offset], &mValidUntil, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+    memcpy(&record[offset], &mPreferredUntil, sizeof(uint64_t));
+
+    aWriter.AddRecord(Utils::kSnapshotRecordDhcp6PdLease, record, sizeof(record));
+
+exit:
+    return;
+}
+
+bool Dhcp6PdLease::Restore(const Utils::SnapshotReader &aReader)
+{
+    Clear();
+
+    aReader.ForEachRecord(Utils::kSnapshotRecordDhcp6PdLease, [this](const uint8_t *aValue, uint16_t aLength) {
+        size_t offset = 0;
+
+        if (aLength == kRecordLength)
+        {
+            memcpy(&mPrefix.mPrefix, &aValue[offset], sizeof(Ip6Address));
+            offset += sizeof(Ip6Address);
+            mPrefix.mLength = aValue[offset++];
+            memcpy(&mValidUntil, &aValue[offset], sizeof(uint64_t));
+            offset += sizeof(uint64_t);
+            memcpy(&mPreferredUntil, &aValue[offset], sizeof(uint64_t));
+        }
+    });
+
+    if (!mPrefix.IsValid() || mPreferredUntil > mValidUntil)
+    {
+        Clear();
+    }
+
+    return !IsEmpty();
+}
+
+uint64_t Dhcp6PdLease::GetExpiryTime(uint32_t aLifetime, uint64_t aUpdateTime)
+{
+    return (aLifetime == kInfiniteLifetime) ? kNever : aUpdateTime + aLifetime;
+}
+
+uint32_t Dhcp6PdLease::GetRemainingLifetime(uint64_t aExpiryTime, uint64_t aNow)
+{
+    uint32_t lifetime = 0;
+
+    if (aExpiryTime == kNever)
+    {
+        lifetime = kInfiniteLifetime;
+    }
+    else if (aExpiryTime > aNow)
+    {
+        // A finite lifetime never reaches the infinite one, even if the wall clock was set back.
+        lifetime = static_cast<uint32_t>(std::min<uint64_t>(aExpiryTime - aNow, kInfiniteLifetime - 1));
+    }
+
+    return lifetime;
+}
+
+bool Dhcp6PdLease::IsClose(uint64_t aTime, uint64_t aOtherTime)
+{
+    return (aTime > aOtherTime) ? (aTime - aOtherTime <= kMatchSlack) : (aOtherTime - aTime <= kMatchSlack);
+}
+
+#if OTBR_ENABLE_DHCP6_PD
+constexpr Milliseconds Dhcp6PdLeaseKeeper::kRefreshInterval;
+
+Dhcp6PdLeaseKeeper::Dhcp6PdLeaseKeeper(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mRefreshTaskId(0)
+    , mIsRunning(false)
+    , mIsRestoreDone(false)
+    , mHasPrefix(false)
+{
+    Utils::SnapshotReader reader;
+    otbrError             error;
+
+    // The lease file is as old as the last lease update, the lifetimes of the lease tell whether it's still usable.
+    SuccessOrExit(error = reader.Load(OTBR_DHCP6_PD_LEASE_FILE, Seconds(UINT32_MAX)));
+    VerifyOrExit(mLease.Restore(reader), error = OTBR_ERROR_PARSE);
+
+    otbrLogInfo("Loaded lease of %s, valid for %us", mLease.GetPrefix().ToString().c_str(),
+                mLease.GetValidLifetime(static_cast<uint64_t>(time(nullptr))));
+
+exit:
+    if (error != OTBR_ERROR_NONE && error != OTBR_ERROR_NOT_FOUND)
+    {
+        otbrLogWarning("Failed to load the kept lease: %s", otbrErrorString(error));
+    }
+}
+
+void Dhcp6PdLeaseKeeper::HandleStateChanged(otChangedFlags aFlags)
+{
+    // The delegated prefix is published in the Network Data once it's in use.
+    if (mIsRunning && (aFlags & OT_CHANGED_THREAD_NETDATA))
+    {
+        RefreshLease();
+    }
+}
+
+void Dhcp6PdLeaseKeeper::HandlePdStateChanged(otBorderRoutingDhcp6PdState aState)
+{
+    bool isRunning = (aState == OT_BORDER_ROUTING_DHCP6_PD_STATE_RUNNING);
+
+    VerifyOrExit(isRunning != mIsRunning);
+
+    mIsRunning = isRunning;
+    mHasPrefix = false;
+    mTaskRunner.Cancel(mRefreshTaskId);
+    mRefreshTaskId = 0;
+    VerifyOrExit(mIsRunning);
+
+    // The kept lease is only of use right after starting, a later request is served by the DHCPv6 client.
+    if (!mIsRestoreDone)
+    {
+        mIsRestoreDone = true;
+        RestoreLease();
+    }
+
+    RefreshLease();
+    ScheduleRefresh();
+
+exit:
+    return;
+}
+
+void Dhcp6PdLeaseKeeper::RestoreLease(void)
+{
+    otBorderRoutingPrefixTableEntry entry;
+    uint64_t                        now = static_cast<uint64_t>(time(nullptr));
+
+    VerifyOrExit(!mLease.IsEmpty());
+    VerifyOrExit(mLease.GetValidLifetime(now) > 0, otbrLogInfo("Kept lease has expired"));
+    VerifyOrExit(otBorderRoutingGetPdOmrPrefix(mInstance, &entry) != OT_ERROR_NONE);
+
+    memset(&entry, 0, sizeof(entry));
+    memcpy(entry.mPrefix.mPrefix.mFields.m8, &mLease.GetPrefix().mPrefix, sizeof(entry.mPrefix.mPrefix));
+    entry.mPrefix.mLength      = mLease.GetPrefix().mLength;
+    entry.mValidLifetime       = mLease.GetValidLifetime(now);
+    entry.mPreferredLifetime   = mLease.GetPreferredLifetime(now);
+    entry.mMsecSinceLastUpdate = 0;
+
+    otPlatBorderRoutingProcessDhcp6PdPrefix(mInstance, &entry);
+    otbrLogInfo("Restored %s, valid for %us, preferred for %us", mLease.GetPrefix().ToString().c_str(),
+                entry.mValidLifetime, entry.mPreferredLifetime);
+
+exit:
+    return;
+}
+
+void Dhcp6PdLeaseKeeper::RefreshLease(void)
+{
+    otBorderRoutingPrefixTableEntry entry;
+    Dhcp6PdLease                    lease;
+    Ip6Prefix                       prefix;
+    uint64_t                        now = static_cast<uint64_t>(time(nullptr));
+
+    if (otBorderRoutingGetPdOmrPrefix(mInstance, &entry) != OT_ERROR_NONE)
+    {
+        // The prefix in use was withdrawn while a prefix is still requested, so the lease was revoked or has
+        // expired and must not be restored.
+        VerifyOrExit(mHasPrefix && !mLease.IsEmpty());
+        otbrLogInfo("Lease of %s is gone", mLease.GetPrefix().ToString().c_str());
+        mHasPrefix = false;
+        mLease.Clear();
+        unlink(OTBR_DHCP6_PD_LEASE_FILE);
+        ExitNow();
+    }
+
+    mHasPrefix = true;
+    prefix.Set(entry.mPrefix);
+    lease.Set(prefix, entry.mValidLifetime, entry.mPreferredLifetime, now - entry.mMsecSinceLastUpdate / 1000);
+    VerifyOrExit(!lease.Matches(mLease));
+
+    mLease = lease;
+    {
+        Utils::SnapshotWriter writer;
+
+        mLease.Save(writer);
+        otbrLogResult(writer.Save(OTBR_DHCP6_PD_LEASE_FILE), "Keep lease of %s, valid for %us",
+                      prefix.ToString().c_str(), entry.mValidLifetime);
+    }
+
+exit:
+    return;
+}
+
+void Dhcp6PdLeaseKeeper::ScheduleRefresh(void)
+{
+    // The renewals of the lease with the same prefix don't change the Network Data, they are picked up periodically.
+    mRefreshTaskId = mTaskRunner.Post(kRefreshInterval, [this]() {
+        mRefreshTaskId = 0;
+        RefreshLease();
+        ScheduleRefresh();
+    });
+}
+#endif // OTBR_ENABLE_DHCP6_PD
+
+} // namespace agent
+} // namespace otbr
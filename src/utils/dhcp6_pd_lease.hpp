@@ -0,0 +1,250 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for keeping the DHCPv6-PD lease across restarts.
+ */
+
+#ifndef OTBR_UTILS_DHCP6_PD_LEASE_HPP_
+#define OTBR_UTILS_DHCP6_PD_LEASE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#if OTBR_ENABLE_DHCP6_PD
+#include <openthread/border_routing.h>
+#include <openthread/instance.h>
+#endif
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "utils/snapshot.hpp"
+
+/**
+ * @def OTBR_DHCP6_PD_LEASE_FILE
+ *
+ * The path of the file keeping the DHCPv6-PD lease across restarts.
+ */
+#ifndef OTBR_DHCP6_PD_LEASE_FILE
+#define OTBR_DHCP6_PD_LEASE_FILE "/var/lib/thread/otbr-agent.pd-lease"
+#endif
+
+/**
+ * @def OTBR_DHCP6_PD_LEASE_REFRESH_INTERVAL_MS
+ *
+ * The interval in milliseconds at which the kept DHCPv6-PD lease is compared with the prefix in use, so that the
+ * renewals of the lease are kept.
+ */
+#ifndef OTBR_DHCP6_PD_LEASE_REFRESH_INTERVAL_MS
+#define OTBR_DHCP6_PD_LEASE_REFRESH_INTERVAL_MS 300000
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class represents a DHCPv6-PD lease, whose lifetimes are kept as wall clock times so that they keep running
+ * while the agent is stopped.
+ *
+ */
+class Dhcp6PdLease
+{
+public:
+    /**
+     * The lifetime of a lease which never expires.
+     *
+     */
+    static constexpr uint32_t kInfiniteLifetime = UINT32_MAX;
+
+    /**
+     * The constructor initializes an empty lease.
+     *
+     */
+    Dhcp6PdLease(void);
+
+    /**
+     * This method sets the lease.
+     *
+     * @param[in] aPrefix             The delegated prefix.
+     * @param[in] aValidLifetime      The valid lifetime in seconds at @p aUpdateTime.
+     * @param[in] aPreferredLifetime  The preferred lifetime in seconds at @p aUpdateTime.
+     * @param[in] aUpdateTime         The wall clock time the lifetimes were received, in seconds since the epoch.
+     *
+     */
+    void Set(const Ip6Prefix &aPrefix, uint32_t aValidLifetime, uint32_t aPreferredLifetime, uint64_t aUpdateTime);
+
+    /**
+     * This method clears the lease.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method indicates whether the lease is empty.
+     *
+     * @returns Whether the lease is empty.
+     *
+     */
+    bool IsEmpty(void) const { return !mPrefix.IsValid(); }
+
+    /**
+     * This method returns the delegated prefix.
+     *
+     * @returns The delegated prefix.
+     *
+     */
+    const Ip6Prefix &GetPrefix(void) const { return mPrefix; }
+
+    /**
+     * This method returns the remaining valid lifetime.
+     *
+     * @param[in] aNow  The wall clock time, in seconds since the epoch.
+     *
+     * @returns The remaining valid lifetime in seconds, 0 if the lease is expired or empty.
+     *
+     */
+    uint32_t GetValidLifetime(uint64_t aNow) const { return GetRemainingLifetime(mValidUntil, aNow); }
+
+    /**
+     * This method returns the remaining preferred lifetime.
+     *
+     * @param[in] aNow  The wall clock time, in seconds since the epoch.
+     *
+     * @returns The remaining preferred lifetime in seconds, 0 if the prefix is deprecated or the lease is empty.
+     *
+     */
+    uint32_t GetPreferredLifetime(uint64_t aNow) const { return GetRemainingLifetime(mPreferredUntil, aNow); }
+
+    /**
+     * This method indicates whether the lease is the same as another one.
+     *
+     * The lifetimes are compared with a slack of a few seconds, since the update times are only known to the second.
+     *
+     * @param[in] aOther  The other lease.
+     *
+     * @returns Whether the leases are of the same prefix and expire at about the same times.
+     *
+     */
+    bool Matches(const Dhcp6PdLease &aOther) const;
+
+    /**
+     * This method saves the lease to a snapshot.
+     *
+     * @param[in] aWriter  The snapshot writer.
+     *
+     */
+    void Save(Utils::SnapshotWriter &aWriter) const;
+
+    /**
+     * This method restores the lease saved to a snapshot.
+     *
+     * @param[in] aReader  The snapshot reader.
+     *
+     * @returns Whether a lease was restored.
+     *
+     */
+    bool Restore(const Utils::SnapshotReader &aReader);
+
+private:
+    static constexpr uint64_t kNever        = UINT64_MAX;
+    static constexpr uint64_t kMatchSlack   = 5; // seconds
+    static constexpr size_t   kRecordLength = sizeof(Ip6Address) + sizeof(uint8_t) + 2 * sizeof(uint64_t);
+
+    static uint64_t GetExpiryTime(uint32_t aLifetime, uint64_t aUpdateTime);
+    static uint32_t GetRemainingLifetime(uint64_t aExpiryTime, uint64_t aNow);
+    static bool     IsClose(uint64_t aTime, uint64_t aOtherTime);
+
+    Ip6Prefix mPrefix;
+    uint64_t  mValidUntil;
+    uint64_t  mPreferredUntil;
+};
+
+#if OTBR_ENABLE_DHCP6_PD
+/**
+ * This class keeps the DHCPv6-PD lease in use in a file, and hands it back to OpenThread after a restart.
+ *
+ * The DHCPv6 client runs outside of the agent and may take a while to deliver the prefix again, meanwhile the Thread
+ * network would be left without the delegated OMR prefix. Instead, the kept prefix is handed to OpenThread as soon as
+ * it requests a prefix, as long as its valid lifetime hasn't run out. The prefix delivered by the client later
+ * replaces it.
+ *
+ */
+class Dhcp6PdLeaseKeeper : private NonCopyable
+{
+public:
+    /**
+     * The constructor loads the kept lease.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit Dhcp6PdLeaseKeeper(otInstance *aInstance);
+
+    /**
+     * This method handles the OpenThread state changes.
+     *
+     * @param[in] aFlags  The changed flags.
+     *
+     */
+    void HandleStateChanged(otChangedFlags aFlags);
+
+    /**
+     * This method handles the DHCPv6-PD state changes.
+     *
+     * The kept lease is handed to OpenThread the first time it requests a prefix.
+     *
+     * @param[in] aState  The DHCPv6-PD state.
+     *
+     */
+    void HandlePdStateChanged(otBorderRoutingDhcp6PdState aState);
+
+private:
+    static constexpr Milliseconds kRefreshInterval = Milliseconds(OTBR_DHCP6_PD_LEASE_REFRESH_INTERVAL_MS);
+
+    void RestoreLease(void);
+    void RefreshLease(void);
+    void ScheduleRefresh(void);
+
+    otInstance        *mInstance;
+    Dhcp6PdLease       mLease;
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mRefreshTaskId;
+    bool               mIsRunning;
+    bool               mIsRestoreDone;
+    bool               mHasPrefix;
+};
+#endif // OTBR_ENABLE_DHCP6_PD
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_DHCP6_PD_LEASE_HPP_
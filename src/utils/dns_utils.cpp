@@ -28,6 +28,8 @@
 
 #include "utils/dns_utils.hpp"
 
+#include <algorithm>
+
 #include <assert.h>
 
 #include "common/code_utils.hpp"
@@ -40,12 +42,18 @@ std::string UnescapeInstanceName(const std::string &aName)
 {
     std::string newName;
     auto        nameLen = aName.length();
+    size_t      i       = aName.find('\\');
+
+    // Most names have no escaped characters, which are appended as a whole.
+    VerifyOrExit(i != std::string::npos, newName = aName);
 
     newName.reserve(nameLen);
+    newName.append(aName, 0, i);
 
-    for (unsigned int i = 0; i < nameLen; i++)
+    for (; i < nameLen; i++)
     {
-        char c = aName[i];
+        char   c = aName[i];
+        size_t next;
 
         if (c == '\\')
         {
@@ -66,10 +74,13 @@ std::string UnescapeInstanceName(const std::string &aName)
             }
         }
 
-        // append all not escaped characters
-        newName.push_back(c);
+        // append all not escaped characters up to the next escape
+        next = std::min(aName.find('\\', i + 1), nameLen);
+        newName.append(aName, i, next - i);
+        i = next - 1;
     }
 
+exit:
     return newName;
 }
 
@@ -35,58 +35,203 @@
 
 #include <string>
 
-#include <stdio.h>
 #include <string.h>
 
+#if OTBR_ENABLE_HEX_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define OTBR_HEX_SSE2 1
+#elif OTBR_ENABLE_HEX_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define OTBR_HEX_NEON 1
+#endif
+
 namespace otbr {
 
 namespace Utils {
 
+namespace {
+
+// The value of each hexadecimal digit, or 0xff for the other characters.
+struct HexDigitValues
+{
+    HexDigitValues(void)
+    {
+        memset(mValues, 0xff, sizeof(mValues));
+        for (int i = 0; i < 10; i++)
+        {
+            mValues['0' + i] = static_cast<uint8_t>(i);
+        }
+        for (int i = 0; i < 6; i++)
+        {
+            mValues['A' + i] = static_cast<uint8_t>(10 + i);
+            mValues['a' + i] = static_cast<uint8_t>(10 + i);
+        }
+    }
+
+    uint8_t mValues[256];
+};
+
+const HexDigitValues kHexDigitValues;
+
+const char *GetHexDigits(HexCase aCase)
+{
+    return aCase == HexCase::kUpper ? "0123456789ABCDEF" : "0123456789abcdef";
+}
+
+uint8_t GetHexDigitValue(char aHex)
+{
+    return kHexDigitValues.mValues[static_cast<uint8_t>(aHex)];
+}
+
+#if OTBR_HEX_SSE2
+// Encodes 16 bytes to 32 digits.
+void EncodeBlock(const uint8_t *aBytes, char *aHex, HexCase aCase)
+{
+    const __m128i mask   = _mm_set1_epi8(0x0f);
+    const __m128i nine   = _mm_set1_epi8(9);
+    const __m128i zero   = _mm_set1_epi8('0');
+    const __m128i letter = _mm_set1_epi8(aCase == HexCase::kUpper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    __m128i       bytes  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes));
+    __m128i       high   = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    __m128i       low    = _mm_and_si128(bytes, mask);
+
+    // The nibbles above nine are offset to the letters.
+    high = _mm_add_epi8(_mm_add_epi8(high, zero), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letter));
+    low  = _mm_add_epi8(_mm_add_epi8(low, zero), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letter));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex), _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex + 16), _mm_unpackhi_epi8(high, low));
+}
+
+// Converts 16 digits to their values, and returns false if any of them is not a hexadecimal digit.
+bool DecodeDigits(__m128i &aDigits)
+{
+    const __m128i ten    = _mm_set1_epi8(10);
+    const __m128i six    = _mm_set1_epi8(6);
+    const __m128i zero   = _mm_setzero_si128();
+    __m128i       digit  = _mm_sub_epi8(aDigits, _mm_set1_epi8('0'));
+    __m128i       letter = _mm_sub_epi8(_mm_or_si128(aDigits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i       isDigit;
+    __m128i       isLetter;
+
+    // The comparisons are signed, the characters above 0x7f are negative or out of range of both.
+    isDigit  = _mm_andnot_si128(_mm_cmplt_epi8(digit, zero), _mm_cmplt_epi8(digit, ten));
+    isLetter = _mm_andnot_si128(_mm_cmplt_epi8(letter, zero), _mm_cmplt_epi8(letter, six));
+    aDigits  = _mm_or_si128(_mm_and_si128(isDigit, digit), _mm_and_si128(isLetter, _mm_add_epi8(letter, ten)));
+
+    return _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) == 0xffff;
+}
+
+// Decodes 32 digits to 16 bytes, and returns false if any of them is not a hexadecimal digit.
+bool DecodeBlock(const char *aHex, uint8_t *aBytes)
+{
+    __m128i first  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aHex));
+    __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aHex + 16));
+    bool    valid  = DecodeDigits(first) & DecodeDigits(second);
+
+    // Each 16-bit lane holds the high digit in its low byte and the low digit in its high byte.
+    first  = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(first, 4), _mm_set1_epi16(0xf0)), _mm_srli_epi16(first, 8));
+    second = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(second, 4), _mm_set1_epi16(0xf0)), _mm_srli_epi16(second, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aBytes), _mm_packus_epi16(first, second));
+
+    return valid;
+}
+#elif OTBR_HEX_NEON
+// Encodes 16 bytes to 32 digits.
+void EncodeBlock(const uint8_t *aBytes, char *aHex, HexCase aCase)
+{
+    const uint8x16_t nine   = vdupq_n_u8(9);
+    const uint8x16_t zero   = vdupq_n_u8('0');
+    const uint8x16_t letter = vdupq_n_u8(aCase == HexCase::kUpper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    uint8x16_t       bytes  = vld1q_u8(aBytes);
+    uint8x16x2_t     digits;
+
+    digits.val[0] = vshrq_n_u8(bytes, 4);
+    digits.val[1] = vandq_u8(bytes, vdupq_n_u8(0x0f));
+
+    // The nibbles above nine are offset to the letters.
+    digits.val[0] = vaddq_u8(vaddq_u8(digits.val[0], zero), vandq_u8(vcgtq_u8(digits.val[0], nine), letter));
+    digits.val[1] = vaddq_u8(vaddq_u8(digits.val[1], zero), vandq_u8(vcgtq_u8(digits.val[1], nine), letter));
+
+    // The high and low digits are interleaved by the store.
+    vst2q_u8(reinterpret_cast<uint8_t *>(aHex), digits);
+}
+
+// Converts 16 digits to their values, and returns false if any of them is not a hexadecimal digit.
+bool DecodeDigits(uint8x16_t &aDigits)
+{
+    uint8x16_t digit    = vsubq_u8(aDigits, vdupq_n_u8('0'));
+    uint8x16_t letter   = vsubq_u8(vorrq_u8(aDigits, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t isDigit  = vcltq_u8(digit, vdupq_n_u8(10));
+    uint8x16_t isLetter = vcltq_u8(letter, vdupq_n_u8(6));
+
+    aDigits = vbslq_u8(isDigit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+
+    return vminvq_u8(vorrq_u8(isDigit, isLetter)) == 0xff;
+}
+
+// Decodes 32 digits to 16 bytes, and returns false if any of them is not a hexadecimal digit.
+bool DecodeBlock(const char *aHex, uint8_t *aBytes)
+{
+    // The high and low digits are deinterleaved by the load.
+    uint8x16x2_t digits = vld2q_u8(reinterpret_cast<const uint8_t *>(aHex));
+    bool         valid  = DecodeDigits(digits.val[0]) & DecodeDigits(digits.val[1]);
+
+    vst1q_u8(aBytes, vorrq_u8(vshlq_n_u8(digits.val[0], 4), digits.val[1]));
+
+    return valid;
+}
+#endif
+
+} // namespace
+
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 {
-    size_t      hexLength = strlen(aHex);
-    const char *hexEnd    = aHex + hexLength;
-    uint8_t    *cur       = aBytes;
-    uint8_t     numChars  = hexLength & 1;
-    uint8_t     byte      = 0;
+    return Hex2Bytes(aHex, strlen(aHex), aBytes, aBytesLength);
+}
+
+int Hex2Bytes(const char *aHex, size_t aHexLength, uint8_t *aBytes, uint16_t aBytesLength)
+{
+    const char *hexEnd = aHex + aHexLength;
+    uint8_t    *cur    = aBytes;
 
-    if ((hexLength + 1) / 2 > aBytesLength)
+    if ((aHexLength + 1) / 2 > aBytesLength)
     {
         return -1;
     }
 
-    while (aHex < hexEnd)
+    // The first digit of an odd-length string is a byte by itself.
+    if (aHexLength & 1)
     {
-        if ('A' <= *aHex && *aHex <= 'F')
-        {
-            byte |= 10 + (*aHex - 'A');
-        }
-        else if ('a' <= *aHex && *aHex <= 'f')
-        {
-            byte |= 10 + (*aHex - 'a');
-        }
-        else if ('0' <= *aHex && *aHex <= '9')
+        uint8_t value = GetHexDigitValue(*aHex++);
+
+        if (value > 0x0f)
         {
-            byte |= *aHex - '0';
+            return -1;
         }
-        else
+        *cur++ = value;
+    }
+
+#if OTBR_HEX_SSE2 || OTBR_HEX_NEON
+    for (; hexEnd - aHex >= 32; aHex += 32, cur += 16)
+    {
+        if (!DecodeBlock(aHex, cur))
         {
             return -1;
         }
+    }
+#endif
 
-        aHex++;
-        numChars++;
+    for (; aHex < hexEnd; aHex += 2)
+    {
+        uint8_t high = GetHexDigitValue(aHex[0]);
+        uint8_t low  = GetHexDigitValue(aHex[1]);
 
-        if (numChars >= 2)
-        {
-            numChars = 0;
-            *cur++   = byte;
-            byte     = 0;
-        }
-        else
+        if ((high | low) > 0x0f)
         {
-            byte <<= 4;
+            return -1;
         }
+        *cur++ = static_cast<uint8_t>(high << 4 | low);
     }
 
     return static_cast<int>(cur - aBytes);
@@ -94,49 +239,63 @@ int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
 {
-    char byteHex[3];
+    size_t length = Bytes2Hex(aBytes, aBytesLength, aHex, HexCase::kUpper);
+
+    aHex[length] = '\0';
+
+    return length;
+}
+
+size_t Bytes2Hex(const uint8_t *aBytes, size_t aBytesLength, char *aHex, HexCase aCase)
+{
+    const char *digits = GetHexDigits(aCase);
+    size_t      i      = 0;
 
-    // Make sure strcat appends at the beginning of the output buffer even
-    // if uninitialized.
-    aHex[0] = '\0';
+#if OTBR_HEX_SSE2 || OTBR_HEX_NEON
+    for (; i + 16 <= aBytesLength; i += 16)
+    {
+        EncodeBlock(aBytes + i, aHex + 2 * i, aCase);
+    }
+#endif
 
-    for (int i = 0; i < aBytesLength; i++)
+    for (; i < aBytesLength; i++)
     {
-        snprintf(byteHex, sizeof(byteHex), "%02X", aBytes[i]);
-        strcat(aHex, byteHex);
+        aHex[2 * i]     = digits[aBytes[i] >> 4];
+        aHex[2 * i + 1] = digits[aBytes[i] & 0x0f];
     }
 
-    return strlen(aHex);
+    return 2 * aBytesLength;
+}
+
+void Bytes2Hex(const uint8_t *aBytes, size_t aBytesLength, std::string &aHex, HexCase aCase)
+{
+    aHex.resize(2 * aBytesLength);
+
+    if (aBytesLength > 0)
+    {
+        Bytes2Hex(aBytes, aBytesLength, &aHex[0], aCase);
+    }
 }
 
 std::string Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength)
 {
-    char        hex[2 * aBytesLength + 1];
     std::string s;
-    size_t      len;
 
-    len = Bytes2Hex(aBytes, aBytesLength, hex);
-    s   = std::string(hex, len);
+    Bytes2Hex(aBytes, aBytesLength, s);
 
     return s;
 }
 
 size_t Long2Hex(const uint64_t aLong, char *aHex)
 {
-    char byteHex[3];
-
-    // Make sure strcat appends at the beginning of the output buffer even
-    // if uninitialized.
-    aHex[0] = '\0';
+    uint8_t bytes[sizeof(aLong)];
 
     for (uint8_t i = 0; i < sizeof(aLong); i++)
     {
-        uint8_t byte = (aLong >> (8 * (sizeof(aLong) - i - 1))) & 0xff;
-        snprintf(byteHex, sizeof(byteHex), "%02X", byte);
-        strcat(aHex, byteHex);
+        bytes[i] = (aLong >> (8 * (sizeof(aLong) - i - 1))) & 0xff;
     }
 
-    return strlen(aHex);
+    return Bytes2Hex(bytes, sizeof(bytes), aHex);
 }
 
 } // namespace Utils
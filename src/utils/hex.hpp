@@ -41,10 +41,28 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/**
+ * Whether to convert the hexadecimal strings with SSE2 or NEON when the target supports it.
+ *
+ */
+#ifndef OTBR_ENABLE_HEX_SIMD
+#define OTBR_ENABLE_HEX_SIMD 1
+#endif
+
 namespace otbr {
 
 namespace Utils {
 
+/**
+ * This enumeration defines the case of the hexadecimal digits written.
+ *
+ */
+enum class HexCase : uint8_t
+{
+    kUpper, ///< The digits 'A' to 'F'.
+    kLower, ///< The digits 'a' to 'f'.
+};
+
 /**
  * @brief Converts a hexadecimal string to a byte array.
  *
@@ -56,6 +74,20 @@ namespace Utils {
  */
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength);
 
+/**
+ * @brief Converts a hexadecimal string of a known length to a byte array.
+ *
+ * An odd-length string is converted as if it had a leading '0'.
+ *
+ * @param[in]  aHex          A pointer to the hexadecimal string, which doesn't need to be null-terminated.
+ * @param[in]  aHexLength    The length of the hexadecimal string.
+ * @param[out] aBytes        A pointer to an array to store the resulting byte values.
+ * @param[in]  aBytesLength  The maximum number of bytes that can be stored in the `aBytes` array.
+ *
+ * @return The number of bytes stored in the `aBytes` array, or -1 if an error occurred.
+ */
+int Hex2Bytes(const char *aHex, size_t aHexLength, uint8_t *aBytes, uint16_t aBytesLength);
+
 /**
  * @brief Converts a byte array to a hexadecimal string.
  *
@@ -68,6 +100,29 @@ int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength);
  */
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex);
 
+/**
+ * @brief Converts a byte array to a hexadecimal string of a case, without null-terminating it.
+ *
+ * @param[in]  aBytes        A pointer to the byte array to be converted.
+ * @param[in]  aBytesLength  The length of the byte array.
+ * @param[out] aHex          A character array to store the resulting hexadecimal string.
+ *                           Must be at least 2 * @param aBytesLength long.
+ * @param[in]  aCase         The case of the hexadecimal digits.
+ *
+ * @return The length of the resulting hexadecimal string.
+ */
+size_t Bytes2Hex(const uint8_t *aBytes, size_t aBytesLength, char *aHex, HexCase aCase);
+
+/**
+ * @brief Converts a byte array to a hexadecimal string, reusing the storage of the string.
+ *
+ * @param[in]  aBytes        A pointer to the byte array to be converted.
+ * @param[in]  aBytesLength  The length of the byte array.
+ * @param[out] aHex          The string to store the resulting hexadecimal string.
+ * @param[in]  aCase         The case of the hexadecimal digits.
+ */
+void Bytes2Hex(const uint8_t *aBytes, size_t aBytesLength, std::string &aHex, HexCase aCase = HexCase::kUpper);
+
 /**
  * @brief Converts a byte array to a hexadecimal string.
  *
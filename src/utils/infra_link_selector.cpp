@@ -51,6 +51,7 @@ namespace otbr {
 namespace Utils {
 
 constexpr Milliseconds InfraLinkSelector::kInfraLinkSelectionDelay;
+constexpr Milliseconds InfraLinkSelector::kInfraLinkStateHoldTime;
 
 bool InfraLinkSelector::LinkInfo::Update(LinkState aState)
 {
@@ -80,8 +81,13 @@ InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
 
     for (const char *name : mInfraLinkNames)
     {
-        mInfraLinkInfos[name].Update(QueryInfraLinkState(name));
+        LinkInfo &linkInfo = mInfraLinkInfos[name];
+
+        linkInfo.Update(QueryInfraLinkState(name));
+        linkInfo.mObservedState = linkInfo.mState;
     }
+
+    Select();
 }
 
 InfraLinkSelector::~InfraLinkSelector(void)
@@ -93,6 +99,20 @@ InfraLinkSelector::~InfraLinkSelector(void)
     }
 }
 
+std::vector<InfraLinkSelector::LinkCounters> InfraLinkSelector::GetLinkCounters(void) const
+{
+    std::vector<LinkCounters> counters;
+
+    for (const char *name : mInfraLinkNames)
+    {
+        const LinkInfo &linkInfo = mInfraLinkInfos.at(name);
+
+        counters.push_back({name, linkInfo.mTransitions, linkInfo.mFlaps});
+    }
+
+    return counters;
+}
+
 const char *InfraLinkSelector::Select(void)
 {
     const char *sel;
@@ -104,6 +124,11 @@ const char *InfraLinkSelector::Select(void)
     {
         sel = SelectGeneric();
     }
+    else
+    {
+        mCurrentInfraLink = sel;
+        mRequireReselect  = false;
+    }
 #else
     sel = SelectGeneric();
 #endif
@@ -172,7 +197,10 @@ const char *InfraLinkSelector::SelectGeneric(void)
 
                 otbrLogInfo("Infra link %s was running %lldms ago, wait for %lldms to recheck.", mCurrentInfraLink,
                             timeSinceLastRunning.count(), delay.count());
-                mTaskRunner.Post(delay, [this]() { mRequireReselect = true; });
+                mTaskRunner.Post(delay, [this]() {
+                    mRequireReselect = true;
+                    Reselect();
+                });
                 ExitNow();
             }
         }
@@ -206,6 +234,26 @@ exit:
     return mCurrentInfraLink;
 }
 
+void InfraLinkSelector::Reselect(void)
+{
+    const char *prevInfraLink = mCurrentInfraLink;
+
+    VerifyOrExit(mRequireReselect);
+
+    if (Select() != prevInfraLink && mInfraLinkChangedCallback)
+    {
+        mInfraLinkChangedCallback(mCurrentInfraLink);
+    }
+
+exit:
+    return;
+}
+
+InfraLinkSelector::LinkState InfraLinkSelector::LinkStateFromFlags(unsigned int aFlags)
+{
+    return (aFlags & IFF_UP) ? ((aFlags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+}
+
 InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *aInfraLinkName)
 {
     int                          sock = 0;
@@ -220,7 +268,7 @@ InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *
 
     VerifyOrExit(ioctl(sock, SIOCGIFFLAGS, &ifReq) != -1);
 
-    state = (ifReq.ifr_flags & IFF_UP) ? ((ifReq.ifr_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+    state = LinkStateFromFlags(static_cast<unsigned int>(ifReq.ifr_flags));
 
 exit:
     if (sock != 0)
@@ -260,48 +308,76 @@ void InfraLinkSelector::ReceiveNetLinkMessage(void)
         uint8_t  mBuffer[kMaxNetLinkBufSize];
     } msgBuffer;
 
-    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
-    if (len < 0)
+    // All the pending messages are received at once, so that a burst of link changes is evaluated once.
+    while (true)
     {
-        otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
-    }
-
-    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
-         header                  = NLMSG_NEXT(header, len))
-    {
-        struct ifinfomsg *ifinfo;
-
-        switch (header->nlmsg_type)
+        len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), MSG_DONTWAIT);
+        if (len < 0)
         {
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
-            break;
-        case NLMSG_ERROR:
-        {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+            if (errno == ENOBUFS)
+            {
+                // The messages which didn't fit in the socket buffer are lost, so the states are queried instead.
+                otbrLogWarning("Lost netlink messages, query the states of the infra links");
+                RefreshInfraLinkStates();
+                continue;
+            }
 
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
+            }
             break;
         }
-        default:
-            break;
+
+        for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header                  = NLMSG_NEXT(header, len))
+        {
+            switch (header->nlmsg_type)
+            {
+            case RTM_NEWLINK:
+            case RTM_DELLINK:
+                HandleInfraLinkStateChange(*header);
+                break;
+            case NLMSG_ERROR:
+            {
+                struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+
+                otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+                break;
+            }
+            default:
+                break;
+            }
         }
     }
 
-exit:
-    return;
+    ApplyHeldInfraLinkStates();
+    Reselect();
 }
 
-void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
+void InfraLinkSelector::HandleInfraLinkStateChange(const struct nlmsghdr &aHeader)
 {
-    const char *infraLinkName = nullptr;
+    const struct ifinfomsg *ifinfo        = reinterpret_cast<const struct ifinfomsg *>(NLMSG_DATA(&aHeader));
+    int                     attrLen       = IFLA_PAYLOAD(&aHeader);
+    const char             *ifName        = nullptr;
+    const char             *infraLinkName = nullptr;
+
+    // The link is identified by the name in the message, and its state is given by the flags of the message, so that
+    // neither is queried for each message.
+    for (const struct rtattr *attr = IFLA_RTA(ifinfo); RTA_OK(attr, attrLen); attr = RTA_NEXT(attr, attrLen))
+    {
+        if (attr->rta_type == IFLA_IFNAME)
+        {
+            ifName = static_cast<const char *>(RTA_DATA(attr));
+            break;
+        }
+    }
+
+    VerifyOrExit(ifName != nullptr);
 
     for (const char *name : mInfraLinkNames)
     {
-        if (aInfraLinkIndex == if_nametoindex(name))
+        if (strcmp(name, ifName) == 0)
         {
             infraLinkName = name;
             break;
@@ -309,20 +385,85 @@ void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
     }
 
     VerifyOrExit(infraLinkName != nullptr);
+    ObserveInfraLinkState(infraLinkName, (aHeader.nlmsg_type == RTM_DELLINK) ? kInvalid
+                                                                              : LinkStateFromFlags(ifinfo->ifi_flags));
+
+exit:
+    return;
+}
+
+void InfraLinkSelector::RefreshInfraLinkStates(void)
+{
+    for (const char *name : mInfraLinkNames)
+    {
+        ObserveInfraLinkState(name, QueryInfraLinkState(name));
+    }
+}
+
+void InfraLinkSelector::ObserveInfraLinkState(const char *aInfraLinkName, LinkState aState)
+{
+    LinkInfo &linkInfo = mInfraLinkInfos[aInfraLinkName];
+
+    VerifyOrExit(aState != linkInfo.mObservedState);
+
+    // A link going back to the state considered by the selection within the hold time has flapped.
+    if (aState == linkInfo.mState)
+    {
+        linkInfo.mFlaps++;
+        otbrLogInfo("Infra link %s flapped back to state %s, %u flaps", aInfraLinkName, LinkStateToString(aState),
+                    linkInfo.mFlaps);
+    }
+
+    linkInfo.mObservedState = aState;
+    linkInfo.mObservedTime  = Clock::now();
 
+exit:
+    return;
+}
+
+void InfraLinkSelector::ApplyHeldInfraLinkStates(void)
+{
+    auto         now      = Clock::now();
+    Milliseconds nextHold = Milliseconds::max();
+
+    for (const char *name : mInfraLinkNames)
     {
-        LinkInfo &linkInfo  = mInfraLinkInfos[infraLinkName];
-        LinkState prevState = linkInfo.mState;
+        LinkInfo    &linkInfo  = mInfraLinkInfos[name];
+        LinkState    prevState = linkInfo.mState;
+        Milliseconds heldTime  = std::chrono::duration_cast<Milliseconds>(now - linkInfo.mObservedTime);
 
-        if (linkInfo.Update(QueryInfraLinkState(infraLinkName)))
+        if (linkInfo.mObservedState == prevState)
+        {
+            // Nothing is held.
+        }
+        else if (heldTime < kInfraLinkStateHoldTime)
+        {
+            nextHold = std::min(nextHold, kInfraLinkStateHoldTime - heldTime);
+        }
+        else if (linkInfo.Update(linkInfo.mObservedState))
         {
-            otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", infraLinkName, aInfraLinkIndex,
-                        LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
+            linkInfo.mTransitions++;
+            otbrLogInfo("Infra link name %s state changed: %s -> %s", name, LinkStateToString(prevState),
+                        LinkStateToString(linkInfo.mState));
             mRequireReselect = true;
         }
     }
-exit:
-    return;
+
+    if (mHoldTaskId != 0)
+    {
+        mTaskRunner.Cancel(mHoldTaskId);
+        mHoldTaskId = 0;
+    }
+
+    // The states still held are checked again once they have lasted the hold time.
+    if (nextHold != Milliseconds::max())
+    {
+        mHoldTaskId = mTaskRunner.Post(nextHold, [this]() {
+            mHoldTaskId = 0;
+            ApplyHeldInfraLinkStates();
+            Reselect();
+        });
+    }
 }
 
 const char *InfraLinkSelector::LinkStateToString(LinkState aState)
@@ -39,10 +39,13 @@
 #if __linux__
 
 #include <assert.h>
+#include <functional>
 #include <map>
 #include <utility>
 #include <vector>
 
+#include <linux/netlink.h>
+
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
@@ -50,6 +53,15 @@
 #include "common/task_runner.hpp"
 #include "common/time.hpp"
 
+/**
+ * The time (in milliseconds) a new state of an infrastructure link must last before the selection takes it into
+ * account, so that a flapping link doesn't trigger an evaluation for each transition.
+ *
+ */
+#ifndef OTBR_INFRA_LINK_STATE_HOLD_TIME
+#define OTBR_INFRA_LINK_STATE_HOLD_TIME 1000
+#endif
+
 #if OTBR_ENABLE_VENDOR_INFRA_LINK_SELECT
 /**
  * This function implements platform specific rules for selecting infrastructure link.
@@ -57,6 +69,8 @@
  * This function should return the infrastructure link that is selected by platform specific rules.
  * If the function returns nullptr, the generic infrastructure link selections rules will be applied.
  *
+ * This function is called at initialization and whenever the state of an infrastructure link candidate changes.
+ *
  */
 extern "C" const char *otbrVendorInfraLinkSelect(void);
 #endif
@@ -72,7 +86,26 @@ class InfraLinkSelector : public MainloopProcessor, private NonCopyable
 {
 public:
     /**
-     * This constructor initializes the InfraLinkSelector instance.
+     * This function pointer is called when the selected infrastructure link changes.
+     *
+     * @param[in] aInfraLink  The newly selected infrastructure link.
+     *
+     */
+    using InfraLinkChangedCallback = std::function<void(const char *aInfraLink)>;
+
+    /**
+     * This structure represents the counters of an infrastructure link candidate.
+     *
+     */
+    struct LinkCounters
+    {
+        const char *mName;        ///< The name of the infrastructure link.
+        uint32_t    mTransitions; ///< The number of state transitions taken into account by the selection.
+        uint32_t    mFlaps;       ///< The number of state transitions reverted within the hold time, so ignored.
+    };
+
+    /**
+     * This constructor initializes the InfraLinkSelector instance and selects the initial infrastructure link.
      *
      * @param[in]  aInfraLinkNames  A list of infrastructure link candidates to select from.
      *
@@ -86,7 +119,7 @@ public:
     ~InfraLinkSelector(void);
 
     /**
-     * This method selects an infrastructure link among infrastructure link candidates using rules below:
+     * This method returns the selected infrastructure link.
      *
      * The infrastructure link in the most usable state is selected:
      *      Prefer `up and running` to `up`
@@ -97,10 +130,30 @@ public:
      *      No other interface is `up and running`
      *      The interface has been `up and running` within last 10 seconds
      *
+     * The selection is only re-evaluated when the state of a candidate changes, and once for all the changes
+     * received together, so this method just returns the cached decision. A new state is only taken into account
+     * once it has lasted `OTBR_INFRA_LINK_STATE_HOLD_TIME`.
+     *
      * @returns  The selected infrastructure link.
      *
      */
-    const char *Select(void);
+    const char *GetSelectedInfraLink(void) const { return mCurrentInfraLink; }
+
+    /**
+     * This method sets the callback called when the selected infrastructure link changes.
+     *
+     * @param[in] aCallback  The callback.
+     *
+     */
+    void SetInfraLinkChangedCallback(InfraLinkChangedCallback aCallback) { mInfraLinkChangedCallback = aCallback; }
+
+    /**
+     * This method returns the counters of the infrastructure link candidates.
+     *
+     * @returns The counters of each candidate, in the order of the candidates.
+     *
+     */
+    std::vector<LinkCounters> GetLinkCounters(void) const;
 
 private:
     /**
@@ -121,21 +174,33 @@ private:
         LinkState         mState = kInvalid;
         Clock::time_point mLastRunningTime;
         bool              mWasUpAndRunning = false;
+        LinkState         mObservedState   = kInvalid; // The last reported state, which `mState` follows once held.
+        Clock::time_point mObservedTime;
+        uint32_t          mTransitions = 0;
+        uint32_t          mFlaps       = 0;
 
         bool Update(LinkState aState);
     };
 
     static constexpr const char *kDefaultInfraLinkName    = "";
     static constexpr auto        kInfraLinkSelectionDelay = Milliseconds(10000);
+    static constexpr auto        kInfraLinkStateHoldTime  = Milliseconds(OTBR_INFRA_LINK_STATE_HOLD_TIME);
 
+    const char *Select(void);
     const char *SelectGeneric(void);
+    void        Reselect(void);
 
     static const char *LinkStateToString(LinkState aState);
+    static LinkState   LinkStateFromFlags(unsigned int aFlags);
     static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
     void               Update(MainloopContext &aMainloop) override;
     void               Process(const MainloopContext &aMainloop) override;
+    const char        *GetName(void) const override { return "InfraLinkSelector"; }
     void               ReceiveNetLinkMessage(void);
-    void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
+    void               HandleInfraLinkStateChange(const struct nlmsghdr &aHeader);
+    void               RefreshInfraLinkStates(void);
+    void               ObserveInfraLinkState(const char *aInfraLinkName, LinkState aState);
+    void               ApplyHeldInfraLinkStates(void);
 
     std::vector<const char *>        mInfraLinkNames;
     std::map<const char *, LinkInfo> mInfraLinkInfos;
@@ -143,6 +208,8 @@ private:
     const char                      *mCurrentInfraLink = nullptr;
     TaskRunner                       mTaskRunner;
     bool                             mRequireReselect = true;
+    InfraLinkChangedCallback         mInfraLinkChangedCallback;
+    TaskRunner::TaskId               mHoldTaskId = 0;
 };
 
 } // namespace Utils
@@ -0,0 +1,211 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements adding and removing joiners of the commissioner in batches.
+ */
+
+#define OTBR_LOG_TAG "JOINER"
+
+#include "utils/joiner_batch.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+bool JoinerBatch::Key::operator<(const Key &aOther) const
+{
+    bool isLess;
+
+    if (mType != aOther.mType)
+    {
+        isLess = mType < aOther.mType;
+    }
+    else if (mLength != aOther.mLength)
+    {
+        isLess = mLength < aOther.mLength;
+    }
+    else
+    {
+        isLess = mValue < aOther.mValue;
+    }
+
+    return isLess;
+}
+
+JoinerBatch::Key JoinerBatch::GetKey(const otJoinerInfo &aJoiner)
+{
+    Key key;
+
+    key.mType   = aJoiner.mType;
+    key.mLength = 0;
+    key.mValue  = 0;
+
+    switch (aJoiner.mType)
+    {
+    case OT_JOINER_INFO_TYPE_EUI64:
+        key.mLength = sizeof(aJoiner.mSharedId.mEui64.m8) * 8;
+        for (uint8_t byte : aJoiner.mSharedId.mEui64.m8)
+        {
+            key.mValue = (key.mValue << 8) | byte;
+        }
+        break;
+    case OT_JOINER_INFO_TYPE_DISCERNER:
+        key.mLength = aJoiner.mSharedId.mDiscerner.mLength;
+        key.mValue  = aJoiner.mSharedId.mDiscerner.mValue;
+        break;
+    default:
+        break;
+    }
+
+    return key;
+}
+
+otError JoinerBatch::AddJoiner(const otJoinerInfo &aJoiner)
+{
+    otError error = OT_ERROR_NONE;
+    auto    it    = mJoinerIndexes.find(GetKey(aJoiner));
+
+    if (it != mJoinerIndexes.end())
+    {
+        otJoinerInfo &joiner = mJoiners[it->second];
+
+        VerifyOrExit(strncmp(joiner.mPskd.m8, aJoiner.mPskd.m8, sizeof(joiner.mPskd.m8)) == 0,
+                     error = OT_ERROR_INVALID_ARGS);
+        joiner.mExpirationTime = std::max(joiner.mExpirationTime, aJoiner.mExpirationTime);
+        ExitNow();
+    }
+
+    mJoinerIndexes.emplace(GetKey(aJoiner), mJoiners.size());
+    mJoiners.push_back(aJoiner);
+
+exit:
+    return error;
+}
+
+void JoinerBatch::GetJoinerTable(otInstance *aInstance, JoinerTable &aTable)
+{
+    uint16_t     iterator = 0;
+    otJoinerInfo joiner;
+
+    while (otCommissionerGetNextJoinerInfo(aInstance, &iterator, &joiner) == OT_ERROR_NONE)
+    {
+        aTable.emplace(GetKey(joiner), joiner);
+    }
+}
+
+otError JoinerBatch::AddToCommissioner(otInstance *aInstance, uint16_t &aNumAdded) const
+{
+    otError     error = OT_ERROR_NONE;
+    JoinerTable table;
+
+    aNumAdded = 0;
+    GetJoinerTable(aInstance, table);
+
+    for (const otJoinerInfo &joiner : mJoiners)
+    {
+        auto it = table.find(GetKey(joiner));
+
+        // The expiration time of the joiner table is the time left in milliseconds.
+        if (it != table.end() && strncmp(it->second.mPskd.m8, joiner.mPskd.m8, sizeof(joiner.mPskd.m8)) == 0 &&
+            it->second.mExpirationTime / 1000 >= joiner.mExpirationTime)
+        {
+            continue;
+        }
+
+        switch (joiner.mType)
+        {
+        case OT_JOINER_INFO_TYPE_EUI64:
+            error = otCommissionerAddJoiner(aInstance, &joiner.mSharedId.mEui64, joiner.mPskd.m8,
+                                            joiner.mExpirationTime);
+            break;
+        case OT_JOINER_INFO_TYPE_DISCERNER:
+            error = otCommissionerAddJoinerWithDiscerner(aInstance, &joiner.mSharedId.mDiscerner, joiner.mPskd.m8,
+                                                         joiner.mExpirationTime);
+            break;
+        default:
+            error = otCommissionerAddJoiner(aInstance, nullptr, joiner.mPskd.m8, joiner.mExpirationTime);
+            break;
+        }
+        SuccessOrExit(error);
+        aNumAdded++;
+    }
+
+exit:
+    otbrLogInfo("Added %u of %zu joiners: %s", aNumAdded, mJoiners.size(), otThreadErrorToString(error));
+    return error;
+}
+
+void JoinerBatch::RemoveFromCommissioner(otInstance *aInstance, uint16_t &aNumRemoved) const
+{
+    JoinerTable table;
+
+    aNumRemoved = 0;
+    GetJoinerTable(aInstance, table);
+
+    for (const otJoinerInfo &joiner : mJoiners)
+    {
+        otError error;
+
+        if (table.find(GetKey(joiner)) == table.end())
+        {
+            continue;
+        }
+
+        switch (joiner.mType)
+        {
+        case OT_JOINER_INFO_TYPE_EUI64:
+            error = otCommissionerRemoveJoiner(aInstance, &joiner.mSharedId.mEui64);
+            break;
+        case OT_JOINER_INFO_TYPE_DISCERNER:
+            error = otCommissionerRemoveJoinerWithDiscerner(aInstance, &joiner.mSharedId.mDiscerner);
+            break;
+        default:
+            error = otCommissionerRemoveJoiner(aInstance, nullptr);
+            break;
+        }
+        if (error == OT_ERROR_NONE)
+        {
+            aNumRemoved++;
+        }
+    }
+
+    otbrLogInfo("Removed %u of %zu joiners", aNumRemoved, mJoiners.size());
+}
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for adding and removing joiners of the commissioner in batches.
+ */
+
+#ifndef OTBR_UTILS_JOINER_BATCH_HPP_
+#define OTBR_UTILS_JOINER_BATCH_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/commissioner.h>
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class collects the joiners to add to or remove from the commissioner at once.
+ *
+ * The joiners are deduplicated as they are collected, and the joiner table of the commissioner is indexed once per
+ * batch. The joiners whose entry in the commissioner is already up to date are skipped, since each change of the
+ * joiner table makes OpenThread send the new steering data to the leader.
+ *
+ */
+class JoinerBatch
+{
+public:
+    /**
+     * This method adds a joiner to the batch.
+     *
+     * Only the type and the id of @p aJoiner are used to remove the joiners, the PSKd and the expiration time in
+     * seconds are also used to add them.
+     *
+     * @param[in] aJoiner  The joiner.
+     *
+     * @retval OT_ERROR_NONE          Successfully added the joiner, or it is already in the batch with the same PSKd.
+     * @retval OT_ERROR_INVALID_ARGS  The joiner is already in the batch with another PSKd.
+     *
+     */
+    otError AddJoiner(const otJoinerInfo &aJoiner);
+
+    /**
+     * This method returns the joiners of the batch, in the order they were first added.
+     *
+     * @returns A reference to the joiners.
+     *
+     */
+    const std::vector<otJoinerInfo> &GetJoiners(void) const { return mJoiners; }
+
+    /**
+     * This method adds the joiners of the batch to the commissioner.
+     *
+     * A joiner already in the commissioner with the same PSKd and with at least the requested time left is skipped.
+     * The batch stops at the first joiner the commissioner rejects.
+     *
+     * @param[in]  aInstance   The OpenThread instance.
+     * @param[out] aNumAdded   The number of joiners added or updated in the commissioner.
+     *
+     * @returns The error of the first rejected joiner, or OT_ERROR_NONE.
+     *
+     */
+    otError AddToCommissioner(otInstance *aInstance, uint16_t &aNumAdded) const;
+
+    /**
+     * This method removes the joiners of the batch from the commissioner.
+     *
+     * The joiners not in the commissioner are skipped.
+     *
+     * @param[in]  aInstance    The OpenThread instance.
+     * @param[out] aNumRemoved  The number of joiners removed from the commissioner.
+     *
+     */
+    void RemoveFromCommissioner(otInstance *aInstance, uint16_t &aNumRemoved) const;
+
+private:
+    struct Key
+    {
+        bool operator<(const Key &aOther) const;
+
+        otJoinerInfoType mType;
+        uint8_t          mLength;
+        uint64_t         mValue;
+    };
+
+    using JoinerTable = std::map<Key, otJoinerInfo>;
+
+    static Key  GetKey(const otJoinerInfo &aJoiner);
+    static void GetJoinerTable(otInstance *aInstance, JoinerTable &aTable);
+
+    std::vector<otJoinerInfo> mJoiners;
+    std::map<Key, size_t>     mJoinerIndexes;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_JOINER_BATCH_HPP_
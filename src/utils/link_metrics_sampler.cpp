@@ -0,0 +1,270 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Link Metrics Sampler.
+ */
+
+#define OTBR_LOG_TAG "LMS"
+
+#include "utils/link_metrics_sampler.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+constexpr uint8_t LinkMetricsHistory::kMaxSamples;
+
+void LinkMetricsHistory::AddSample(const Sample &aSample)
+{
+    mSamples[mNext] = aSample;
+    mNext           = (mNext + 1) % kMaxSamples;
+    mCount          = std::min<uint8_t>(mCount + 1, kMaxSamples);
+}
+
+int16_t LinkMetricsHistory::GetPercentile(Metric aMetric, uint8_t aPercentile) const
+{
+    std::array<int16_t, kMaxSamples> values;
+    int16_t                          percentile = 0;
+    uint8_t                          rank;
+
+    VerifyOrExit(mCount > 0);
+
+    // The oldest samples are overwritten in place, so the first `mCount` entries are all valid samples.
+    for (uint8_t i = 0; i < mCount; i++)
+    {
+        values[i] = GetMetric(mSamples[i], aMetric);
+    }
+
+    // The nearest rank, rounded up and counted from 1.
+    rank = static_cast<uint8_t>((static_cast<uint16_t>(mCount) * aPercentile + 99) / 100);
+    rank = std::max<uint8_t>(rank, 1);
+
+    std::nth_element(values.begin(), values.begin() + rank - 1, values.begin() + mCount);
+    percentile = values[rank - 1];
+
+exit:
+    return percentile;
+}
+
+int16_t LinkMetricsHistory::GetMetric(const Sample &aSample, Metric aMetric)
+{
+    int16_t value = 0;
+
+    switch (aMetric)
+    {
+    case kRssi:
+        value = aSample.mRssi;
+        break;
+    case kLqi:
+        value = aSample.mLqi;
+        break;
+    case kLinkMargin:
+        value = aSample.mLinkMargin;
+        break;
+    }
+
+    return value;
+}
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+constexpr Milliseconds LinkMetricsSampler::kSampleInterval;
+
+LinkMetricsSampler::LinkMetricsSampler(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mProbeTaskId(0)
+    , mNextNeighbor(0)
+    , mIsRunning(false)
+{
+}
+
+void LinkMetricsSampler::Start(void)
+{
+    VerifyOrExit(!mIsRunning);
+
+    mIsRunning    = true;
+    mNextNeighbor = 0;
+    ScheduleNextProbe();
+
+exit:
+    return;
+}
+
+void LinkMetricsSampler::Stop(void)
+{
+    VerifyOrExit(mIsRunning);
+
+    mIsRunning = false;
+    mTaskRunner.Cancel(mProbeTaskId);
+    mProbeTaskId = 0;
+    mNeighbors.clear();
+
+exit:
+    return;
+}
+
+void LinkMetricsSampler::ScheduleNextProbe(void)
+{
+    // Each neighbor is probed once per interval, the probes are spread evenly over the interval.
+    Milliseconds delay = kSampleInterval / std::max<size_t>(mNeighbors.size(), 1);
+
+    mProbeTaskId = mTaskRunner.Post(delay, [this]() { ProbeNextNeighbor(); });
+}
+
+void LinkMetricsSampler::ProbeNextNeighbor(void)
+{
+    otLinkMetrics metrics;
+    otIp6Address  destination;
+    otError       error;
+
+    mProbeTaskId = 0;
+
+    if (mNextNeighbor >= mNeighbors.size())
+    {
+        // The neighbors are updated once per round.
+        UpdateNeighbors();
+        mNextNeighbor = 0;
+    }
+    VerifyOrExit(!mNeighbors.empty());
+
+    {
+        const otExtAddress &extAddress = mNeighbors[mNextNeighbor].mExtAddress;
+
+        // The link-local address of the neighbor, whose interface identifier is derived from the extended address.
+        memset(&destination, 0, sizeof(destination));
+        destination.mFields.m8[0] = 0xfe;
+        destination.mFields.m8[1] = 0x80;
+        memcpy(&destination.mFields.m8[8], extAddress.m8, sizeof(extAddress.m8));
+        destination.mFields.m8[8] ^= 0x02;
+    }
+
+    memset(&metrics, 0, sizeof(metrics));
+    metrics.mLqi        = true;
+    metrics.mLinkMargin = true;
+    metrics.mRssi       = true;
+
+    error = otLinkMetricsQuery(mInstance, &destination, /* aSeriesId */ 0, &metrics, HandleReport, this);
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLogDebug("Failed to probe neighbor 0x%04x: %s", mNeighbors[mNextNeighbor].mRloc16,
+                     otThreadErrorToString(error));
+    }
+    mNextNeighbor++;
+
+exit:
+    ScheduleNextProbe();
+}
+
+void LinkMetricsSampler::UpdateNeighbors(void)
+{
+    std::vector<NeighborHistory> neighbors;
+    otNeighborInfoIterator       iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo               neighborInfo;
+
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+    {
+        const NeighborHistory *neighbor;
+
+        // Only the routers supporting Thread 1.2 answer link metrics queries.
+        if (neighborInfo.mIsChild || neighborInfo.mVersion < OT_THREAD_VERSION_1_2)
+        {
+            continue;
+        }
+
+        neighbor = FindNeighbor(neighborInfo.mExtAddress);
+        if (neighbor != nullptr)
+        {
+            neighbors.push_back(*neighbor);
+        }
+        else
+        {
+            neighbors.push_back(NeighborHistory{neighborInfo.mExtAddress, neighborInfo.mRloc16, LinkMetricsHistory()});
+        }
+        neighbors.back().mRloc16 = neighborInfo.mRloc16;
+    }
+
+    mNeighbors = std::move(neighbors);
+}
+
+LinkMetricsSampler::NeighborHistory *LinkMetricsSampler::FindNeighbor(const otExtAddress &aExtAddress)
+{
+    NeighborHistory *neighbor = nullptr;
+
+    for (NeighborHistory &entry : mNeighbors)
+    {
+        if (memcmp(entry.mExtAddress.m8, aExtAddress.m8, sizeof(aExtAddress.m8)) == 0)
+        {
+            neighbor = &entry;
+            break;
+        }
+    }
+
+    return neighbor;
+}
+
+void LinkMetricsSampler::HandleReport(const otIp6Address        *aSource,
+                                      const otLinkMetricsValues *aMetricsValues,
+                                      otLinkMetricsStatus        aStatus,
+                                      void                      *aContext)
+{
+    static_cast<LinkMetricsSampler *>(aContext)->HandleReport(aSource, aMetricsValues, aStatus);
+}
+
+void LinkMetricsSampler::HandleReport(const otIp6Address        *aSource,
+                                      const otLinkMetricsValues *aMetricsValues,
+                                      otLinkMetricsStatus        aStatus)
+{
+    otExtAddress               extAddress;
+    NeighborHistory           *neighbor;
+    LinkMetricsHistory::Sample sample;
+
+    VerifyOrExit(mIsRunning && aStatus == OT_LINK_METRICS_STATUS_SUCCESS && aMetricsValues != nullptr);
+
+    memcpy(extAddress.m8, &aSource->mFields.m8[8], sizeof(extAddress.m8));
+    extAddress.m8[0] ^= 0x02;
+    neighbor = FindNeighbor(extAddress);
+    VerifyOrExit(neighbor != nullptr);
+
+    sample.mRssi       = aMetricsValues->mRssiValue;
+    sample.mLqi        = aMetricsValues->mLqiValue;
+    sample.mLinkMargin = aMetricsValues->mLinkMarginValue;
+    neighbor->mHistory.AddSample(sample);
+
+exit:
+    return;
+}
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,234 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Link Metrics Sampler.
+ */
+
+#ifndef OTBR_UTILS_LINK_METRICS_SAMPLER_HPP_
+#define OTBR_UTILS_LINK_METRICS_SAMPLER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <array>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/link_metrics.h>
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+
+/**
+ * @def OTBR_LINK_METRICS_SAMPLE_INTERVAL_MS
+ *
+ * The interval in milliseconds at which each neighbor router is probed, the probes of the neighbors are spread evenly
+ * over the interval.
+ */
+#ifndef OTBR_LINK_METRICS_SAMPLE_INTERVAL_MS
+#define OTBR_LINK_METRICS_SAMPLE_INTERVAL_MS 60000
+#endif
+
+/**
+ * @def OTBR_LINK_METRICS_HISTORY_SIZE
+ *
+ * The number of link metrics samples kept for each neighbor router.
+ */
+#ifndef OTBR_LINK_METRICS_HISTORY_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_LINK_METRICS_HISTORY_SIZE 8
+#else
+#define OTBR_LINK_METRICS_HISTORY_SIZE 32
+#endif
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class keeps the latest link metrics samples of a neighbor in a fixed-size ring buffer.
+ *
+ */
+class LinkMetricsHistory
+{
+public:
+    static constexpr uint8_t kMaxSamples = OTBR_LINK_METRICS_HISTORY_SIZE;
+
+    static_assert(kMaxSamples > 0, "OTBR_LINK_METRICS_HISTORY_SIZE must be greater than 0");
+
+    /**
+     * This structure represents a link metrics sample.
+     *
+     */
+    struct Sample
+    {
+        int8_t  mRssi;       ///< The RSSI in dBm
+        uint8_t mLqi;        ///< The link quality indicator
+        uint8_t mLinkMargin; ///< The link margin in dB
+    };
+
+    /**
+     * The metrics of a sample.
+     *
+     */
+    enum Metric : uint8_t
+    {
+        kRssi,       ///< `Sample::mRssi`.
+        kLqi,        ///< `Sample::mLqi`.
+        kLinkMargin, ///< `Sample::mLinkMargin`.
+    };
+
+    /**
+     * This method adds a sample, which replaces the oldest one if the history is full.
+     *
+     * @param[in] aSample  The sample to add.
+     *
+     */
+    void AddSample(const Sample &aSample);
+
+    /**
+     * This method returns the number of samples in the history.
+     *
+     * @returns The number of samples.
+     *
+     */
+    uint8_t GetSampleCount(void) const { return mCount; }
+
+    /**
+     * This method returns the latest sample.
+     *
+     * @note The history must not be empty.
+     *
+     * @returns A reference to the latest sample.
+     *
+     */
+    const Sample &GetLatestSample(void) const { return mSamples[(mNext + kMaxSamples - 1) % kMaxSamples]; }
+
+    /**
+     * This method returns a percentile of a metric among the samples.
+     *
+     * @param[in] aMetric      The metric.
+     * @param[in] aPercentile  The percentile, between 1 and 100.
+     *
+     * @returns The nearest-rank percentile of the metric, or 0 if the history is empty.
+     *
+     */
+    int16_t GetPercentile(Metric aMetric, uint8_t aPercentile) const;
+
+private:
+    static int16_t GetMetric(const Sample &aSample, Metric aMetric);
+
+    std::array<Sample, kMaxSamples> mSamples;
+    uint8_t                         mNext  = 0;
+    uint8_t                         mCount = 0;
+};
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+/**
+ * This class samples the link metrics of the neighbor routers with single probe queries.
+ *
+ * Only one neighbor is probed at a time and the probes are spread over OTBR_LINK_METRICS_SAMPLE_INTERVAL_MS, so that
+ * the sampling doesn't cause airtime spikes.
+ *
+ */
+class LinkMetricsSampler : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the link metrics history of a neighbor router.
+     *
+     */
+    struct NeighborHistory
+    {
+        otExtAddress       mExtAddress; ///< The extended address of the neighbor
+        uint16_t           mRloc16;     ///< The RLOC16 of the neighbor
+        LinkMetricsHistory mHistory;    ///< The link metrics samples of the neighbor
+    };
+
+    /**
+     * The constructor of the Link Metrics Sampler.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit LinkMetricsSampler(otInstance *aInstance);
+
+    /**
+     * This method starts sampling the neighbor routers.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops sampling and drops the histories.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method returns the link metrics histories of the neighbor routers.
+     *
+     * @returns The histories of the neighbor routers sampled so far.
+     *
+     */
+    const std::vector<NeighborHistory> &GetNeighborHistories(void) const { return mNeighbors; }
+
+private:
+    static constexpr Milliseconds kSampleInterval = Milliseconds(OTBR_LINK_METRICS_SAMPLE_INTERVAL_MS);
+
+    static void HandleReport(const otIp6Address        *aSource,
+                             const otLinkMetricsValues *aMetricsValues,
+                             otLinkMetricsStatus        aStatus,
+                             void                      *aContext);
+    void        HandleReport(const otIp6Address        *aSource,
+                             const otLinkMetricsValues *aMetricsValues,
+                             otLinkMetricsStatus        aStatus);
+
+    void             ScheduleNextProbe(void);
+    void             ProbeNextNeighbor(void);
+    void             UpdateNeighbors(void);
+    NeighborHistory *FindNeighbor(const otExtAddress &aExtAddress);
+
+    otInstance                  *mInstance;
+    TaskRunner                   mTaskRunner;
+    TaskRunner::TaskId           mProbeTaskId;
+    std::vector<NeighborHistory> mNeighbors;
+    size_t                       mNextNeighbor;
+    bool                         mIsRunning;
+};
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_LINK_METRICS_SAMPLER_HPP_
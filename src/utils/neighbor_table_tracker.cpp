@@ -0,0 +1,97 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements tracking the changes of the neighbor table.
+ */
+
+#include "utils/neighbor_table_tracker.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace otbr {
+namespace agent {
+
+NeighborTableTracker::NeighborTableTracker(void)
+    : mGeneration(0)
+{
+}
+
+void NeighborTableTracker::Update(std::vector<Entry> &aTable, std::vector<Change> &aChanges)
+{
+    auto oldEntry = mTable.begin();
+    auto newEntry = aTable.begin();
+
+    aChanges.clear();
+    std::sort(aTable.begin(), aTable.end(), IsBefore);
+
+    while (oldEntry != mTable.end() || newEntry != aTable.end())
+    {
+        if (newEntry == aTable.end() || (oldEntry != mTable.end() && IsBefore(*oldEntry, *newEntry)))
+        {
+            aChanges.push_back({kChangeRemoved, *oldEntry++});
+        }
+        else if (oldEntry == mTable.end() || IsBefore(*newEntry, *oldEntry))
+        {
+            aChanges.push_back({kChangeAdded, *newEntry++});
+        }
+        else
+        {
+            if (IsUpdated(*oldEntry, *newEntry))
+            {
+                aChanges.push_back({kChangeUpdated, *newEntry});
+            }
+            ++oldEntry;
+            ++newEntry;
+        }
+    }
+
+    mTable.swap(aTable);
+
+    if (!aChanges.empty())
+    {
+        mGeneration++;
+    }
+}
+
+bool NeighborTableTracker::IsBefore(const Entry &aLhs, const Entry &aRhs)
+{
+    return memcmp(aLhs.mExtAddress.m8, aRhs.mExtAddress.m8, sizeof(aLhs.mExtAddress.m8)) < 0;
+}
+
+bool NeighborTableTracker::IsUpdated(const Entry &aOld, const Entry &aNew)
+{
+    return aOld.mRloc16 != aNew.mRloc16 || aOld.mIsChild != aNew.mIsChild || aOld.mRxOnWhenIdle != aNew.mRxOnWhenIdle ||
+           aOld.mFullThreadDevice != aNew.mFullThreadDevice || aOld.mFullNetworkData != aNew.mFullNetworkData;
+}
+
+} // namespace agent
+} // namespace otbr
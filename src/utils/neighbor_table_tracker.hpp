@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for tracking the changes of the neighbor table.
+ */
+
+#ifndef OTBR_UTILS_NEIGHBOR_TABLE_TRACKER_HPP_
+#define OTBR_UTILS_NEIGHBOR_TABLE_TRACKER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/link.h>
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class tracks the neighbor table, i.e. the children and the neighbor routers, and reports the changes between
+ * snapshots of it.
+ *
+ * Only the identity and the mode of the neighbors are tracked, the link quality and the age, which change with every
+ * frame, are not.
+ *
+ */
+class NeighborTableTracker
+{
+public:
+    /**
+     * This structure represents the tracked fields of a neighbor.
+     *
+     */
+    struct Entry
+    {
+        otExtAddress mExtAddress;       ///< The extended address of the neighbor.
+        uint16_t     mRloc16;           ///< The RLOC16 of the neighbor.
+        bool         mIsChild;          ///< Whether the neighbor is a child.
+        bool         mRxOnWhenIdle;     ///< Whether the neighbor is rx-on-when-idle.
+        bool         mFullThreadDevice; ///< Whether the neighbor is a full Thread device.
+        bool         mFullNetworkData;  ///< Whether the neighbor requests the full network data.
+    };
+
+    /**
+     * This enumeration defines the types of the changes.
+     *
+     */
+    enum ChangeType : uint8_t
+    {
+        kChangeAdded   = 0, ///< The neighbor was added.
+        kChangeRemoved = 1, ///< The neighbor was removed, the entry is the last one seen.
+        kChangeUpdated = 2, ///< The RLOC16 or the mode of the neighbor changed.
+    };
+
+    /**
+     * This structure represents a change of the neighbor table.
+     *
+     */
+    struct Change
+    {
+        ChangeType mType;  ///< The type of the change.
+        Entry      mEntry; ///< The neighbor, after the change.
+    };
+
+    /**
+     * The constructor starts with an empty table.
+     *
+     */
+    NeighborTableTracker(void);
+
+    /**
+     * This method takes a new snapshot of the neighbor table and reports the changes since the previous one.
+     *
+     * The snapshots are sorted by extended address and compared in a single pass.
+     *
+     * @param[inout] aTable    The new snapshot in any order, it's swapped with the storage of the previous snapshot
+     *                         so that the storage is reused by the next snapshot.
+     * @param[out]   aChanges  The changes, sorted by extended address, its content is replaced.
+     *
+     */
+    void Update(std::vector<Entry> &aTable, std::vector<Change> &aChanges);
+
+    /**
+     * This method returns the generation of the snapshot, which is incremented every time there are changes.
+     *
+     * A client of the changes detects a missed change by a gap in the generations, and then reads the whole table.
+     *
+     * @returns The generation of the snapshot.
+     *
+     */
+    uint32_t GetGeneration(void) const { return mGeneration; }
+
+private:
+    static bool IsBefore(const Entry &aLhs, const Entry &aRhs);
+    static bool IsUpdated(const Entry &aOld, const Entry &aNew);
+
+    std::vector<Entry> mTable;
+    uint32_t           mGeneration;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_NEIGHBOR_TABLE_TRACKER_HPP_
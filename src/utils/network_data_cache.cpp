@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements caching the decoded network data.
+ */
+
+#include "utils/network_data_cache.hpp"
+
+namespace otbr {
+namespace agent {
+
+// The network data is at most one message of 255 bytes, see `otNetDataGet()`.
+static constexpr uint8_t kNetworkDataMaxSize = 255;
+
+NetworkDataCache::NetworkDataCache(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mValid(false)
+    , mRebuildCount(0)
+{
+}
+
+void NetworkDataCache::HandleStateChanged(otChangedFlags aFlags)
+{
+    if (aFlags & OT_CHANGED_THREAD_NETDATA)
+    {
+        mValid = false;
+    }
+}
+
+const NetworkDataCache::NetworkData &NetworkDataCache::Get(void)
+{
+    // The versions are also checked in case the network data changed before the notification is processed.
+    if (!mValid || mNetworkData.mVersion != otNetDataGetVersion(mInstance) ||
+        mNetworkData.mStableVersion != otNetDataGetStableVersion(mInstance))
+    {
+        Rebuild();
+    }
+
+    return mNetworkData;
+}
+
+void NetworkDataCache::Rebuild(void)
+{
+    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    otBorderRouterConfig  prefix;
+    otExternalRouteConfig route;
+    uint8_t               length;
+
+    mNetworkData.mVersion       = otNetDataGetVersion(mInstance);
+    mNetworkData.mStableVersion = otNetDataGetStableVersion(mInstance);
+
+    mNetworkData.mFullTlvs.resize(kNetworkDataMaxSize);
+    length = kNetworkDataMaxSize;
+    if (otNetDataGet(mInstance, /* aStable */ false, mNetworkData.mFullTlvs.data(), &length) != OT_ERROR_NONE)
+    {
+        length = 0;
+    }
+    mNetworkData.mFullTlvs.resize(length);
+
+    mNetworkData.mStableTlvs.resize(kNetworkDataMaxSize);
+    length = kNetworkDataMaxSize;
+    if (otNetDataGet(mInstance, /* aStable */ true, mNetworkData.mStableTlvs.data(), &length) != OT_ERROR_NONE)
+    {
+        length = 0;
+    }
+    mNetworkData.mStableTlvs.resize(length);
+
+    mNetworkData.mOnMeshPrefixes.clear();
+    while (otNetDataGetNextOnMeshPrefix(mInstance, &iterator, &prefix) == OT_ERROR_NONE)
+    {
+        mNetworkData.mOnMeshPrefixes.push_back(prefix);
+    }
+
+    iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    mNetworkData.mExternalRoutes.clear();
+    while (otNetDataGetNextRoute(mInstance, &iterator, &route) == OT_ERROR_NONE)
+    {
+        mNetworkData.mExternalRoutes.push_back(route);
+    }
+
+    mValid = true;
+    mRebuildCount++;
+}
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for caching the decoded network data.
+ */
+
+#ifndef OTBR_UTILS_NETWORK_DATA_CACHE_HPP_
+#define OTBR_UTILS_NETWORK_DATA_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/netdata.h>
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class caches the network data of the Thread instance, the raw TLVs and the decoded prefixes and routes.
+ *
+ * The network data is only walked again after it has changed, i.e. after an `OT_CHANGED_THREAD_NETDATA`
+ * notification, and only once one of the getters asks for it. All the front-ends (D-Bus, telemetry, firewall) are
+ * served from the same snapshot.
+ *
+ */
+class NetworkDataCache
+{
+public:
+    /**
+     * This structure represents a snapshot of the network data.
+     *
+     */
+    struct NetworkData
+    {
+        uint8_t                            mVersion;        ///< The full network data version.
+        uint8_t                            mStableVersion;  ///< The stable network data version.
+        std::vector<uint8_t>               mFullTlvs;       ///< The TLVs of the full network data.
+        std::vector<uint8_t>               mStableTlvs;     ///< The TLVs of the stable network data.
+        std::vector<otBorderRouterConfig>  mOnMeshPrefixes; ///< The on-mesh prefixes.
+        std::vector<otExternalRouteConfig> mExternalRoutes; ///< The external routes.
+    };
+
+    /**
+     * The constructor of a network data cache.
+     *
+     * @param[in] aInstance  A pointer to the OpenThread instance.
+     *
+     */
+    explicit NetworkDataCache(otInstance *aInstance);
+
+    /**
+     * This method handles the OpenThread state changes, the snapshot is invalidated if the network data changed.
+     *
+     * @param[in] aFlags  The flags of the changed states.
+     *
+     */
+    void HandleStateChanged(otChangedFlags aFlags);
+
+    /**
+     * This method returns the snapshot of the network data, which is rebuilt if it is stale.
+     *
+     * The returned reference is valid until the next call of this method.
+     *
+     * @returns The snapshot of the network data.
+     *
+     */
+    const NetworkData &Get(void);
+
+    /**
+     * This method returns the number of times the snapshot has been rebuilt.
+     *
+     * @returns The number of rebuilds.
+     *
+     */
+    uint32_t GetRebuildCount(void) const { return mRebuildCount; }
+
+private:
+    void Rebuild(void);
+
+    otInstance *mInstance;
+    NetworkData mNetworkData;
+    bool        mValid;
+    uint32_t    mRebuildCount;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_NETWORK_DATA_CACHE_HPP_
@@ -0,0 +1,604 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements programming nftables with netlink batches.
+ */
+
+#define OTBR_LOG_TAG "NFT"
+
+#include "utils/nftables.hpp"
+
+#if __linux__
+
+#include <arpa/inet.h>
+#include <assert.h>
+#include <errno.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+namespace Nftables {
+
+namespace {
+
+constexpr uint32_t kRegister  = NFT_REG_1;
+constexpr uint32_t kIp6Offset = 8; // The offset of the source address in the IPv6 header.
+
+} // namespace
+
+void Batch::Clear(void)
+{
+    mBuffer.clear();
+    mRequestCount = 0;
+    mSetCount     = 0;
+    mFinished     = false;
+
+    AddControlMessage(NFNL_MSG_BATCH_BEGIN);
+}
+
+void Batch::AddTable(uint8_t aFamily, const char *aTable)
+{
+    BeginMessage(NFT_MSG_NEWTABLE, NLM_F_CREATE, aFamily);
+    AddAttributeString(NFTA_TABLE_NAME, aTable);
+    EndMessage();
+}
+
+void Batch::DeleteTable(uint8_t aFamily, const char *aTable)
+{
+    BeginMessage(NFT_MSG_DELTABLE, 0, aFamily);
+    AddAttributeString(NFTA_TABLE_NAME, aTable);
+    EndMessage();
+}
+
+void Batch::AddBaseChain(uint8_t aFamily, const char *aTable, const char *aChain, uint32_t aHook, int32_t aPriority)
+{
+    size_t hook;
+
+    BeginMessage(NFT_MSG_NEWCHAIN, NLM_F_CREATE, aFamily);
+    AddAttributeString(NFTA_CHAIN_TABLE, aTable);
+    AddAttributeString(NFTA_CHAIN_NAME, aChain);
+
+    hook = BeginNested(NFTA_CHAIN_HOOK);
+    AddAttributeU32(NFTA_HOOK_HOOKNUM, aHook);
+    AddAttributeU32(NFTA_HOOK_PRIORITY, static_cast<uint32_t>(aPriority));
+    EndNested(hook);
+
+    AddAttributeU32(NFTA_CHAIN_POLICY, NF_ACCEPT);
+    AddAttributeString(NFTA_CHAIN_TYPE, "filter");
+    EndMessage();
+}
+
+void Batch::FlushChain(uint8_t aFamily, const char *aTable, const char *aChain)
+{
+    // Deleting rules without a handle deletes all of them.
+    BeginMessage(NFT_MSG_DELRULE, 0, aFamily);
+    AddAttributeString(NFTA_RULE_TABLE, aTable);
+    AddAttributeString(NFTA_RULE_CHAIN, aChain);
+    EndMessage();
+}
+
+void Batch::AddSet(uint8_t     aFamily,
+                   const char *aTable,
+                   const char *aSet,
+                   uint32_t    aKeyType,
+                   uint32_t    aKeyLength,
+                   uint32_t    aFlags)
+{
+    BeginMessage(NFT_MSG_NEWSET, NLM_F_CREATE, aFamily);
+    AddAttributeString(NFTA_SET_TABLE, aTable);
+    AddAttributeString(NFTA_SET_NAME, aSet);
+    AddAttributeU32(NFTA_SET_FLAGS, aFlags);
+    AddAttributeU32(NFTA_SET_KEY_TYPE, aKeyType);
+    AddAttributeU32(NFTA_SET_KEY_LEN, aKeyLength);
+    AddAttributeU32(NFTA_SET_ID, ++mSetCount);
+    EndMessage();
+}
+
+void Batch::BeginSetElements(uint8_t aFamily, const char *aTable, const char *aSet, bool aIsAdded)
+{
+    BeginMessage(aIsAdded ? NFT_MSG_NEWSETELEM : NFT_MSG_DELSETELEM, aIsAdded ? NLM_F_CREATE | NLM_F_EXCL : 0,
+                 aFamily);
+    AddAttributeString(NFTA_SET_ELEM_LIST_TABLE, aTable);
+    AddAttributeString(NFTA_SET_ELEM_LIST_SET, aSet);
+    mListOffset = BeginNested(NFTA_SET_ELEM_LIST_ELEMENTS);
+}
+
+void Batch::EndSetElements(void)
+{
+    EndNested(mListOffset);
+    EndMessage();
+}
+
+void Batch::FlushSet(uint8_t aFamily, const char *aTable, const char *aSet)
+{
+    // Deleting elements without a list deletes all of them.
+    BeginMessage(NFT_MSG_DELSETELEM, 0, aFamily);
+    AddAttributeString(NFTA_SET_ELEM_LIST_TABLE, aTable);
+    AddAttributeString(NFTA_SET_ELEM_LIST_SET, aSet);
+    EndMessage();
+}
+
+void Batch::AddSetElement(const void *aKey, uint32_t aLength, bool aIsIntervalEnd)
+{
+    size_t element = BeginNested(NFTA_LIST_ELEM);
+
+    AddData(NFTA_SET_ELEM_KEY, aKey, aLength);
+
+    if (aIsIntervalEnd)
+    {
+        AddAttributeU32(NFTA_SET_ELEM_FLAGS, NFT_SET_ELEM_INTERVAL_END);
+    }
+
+    EndNested(element);
+}
+
+void Batch::AddIp6PrefixInterval(const Ip6Prefix &aPrefix)
+{
+    uint8_t start[sizeof(aPrefix.mPrefix.m8)];
+    uint8_t end[sizeof(start)];
+    bool    isLast = true;
+
+    for (size_t i = 0; i < sizeof(start); i++)
+    {
+        size_t  bits = (aPrefix.mLength > i * 8) ? aPrefix.mLength - i * 8 : 0;
+        uint8_t mask = (bits >= 8) ? 0xff : static_cast<uint8_t>(0xff00 >> bits);
+
+        start[i] = aPrefix.mPrefix.m8[i] & mask;
+        end[i]   = start[i] | static_cast<uint8_t>(~mask);
+    }
+
+    // The interval ends right after the last address of the prefix.
+    for (size_t i = sizeof(end); i-- > 0;)
+    {
+        if (++end[i] != 0)
+        {
+            isLast = false;
+            break;
+        }
+    }
+
+    AddSetElement(start, sizeof(start));
+
+    // The interval which includes the last address has no end element.
+    if (!isLast)
+    {
+        AddSetElement(end, sizeof(end), /* aIsIntervalEnd */ true);
+    }
+}
+
+void Batch::BeginRule(uint8_t aFamily, const char *aTable, const char *aChain)
+{
+    BeginMessage(NFT_MSG_NEWRULE, NLM_F_CREATE | NLM_F_APPEND, aFamily);
+    AddAttributeString(NFTA_RULE_TABLE, aTable);
+    AddAttributeString(NFTA_RULE_CHAIN, aChain);
+    mListOffset = BeginNested(NFTA_RULE_EXPRESSIONS);
+}
+
+void Batch::EndRule(void)
+{
+    EndNested(mListOffset);
+    EndMessage();
+}
+
+void Batch::AddMetaLoad(uint32_t aKey)
+{
+    BeginExpression("meta");
+    AddAttributeU32(NFTA_META_DREG, kRegister);
+    AddAttributeU32(NFTA_META_KEY, aKey);
+    EndExpression();
+}
+
+void Batch::AddPayloadLoad(uint32_t aBase, uint32_t aOffset, uint32_t aLength)
+{
+    BeginExpression("payload");
+    AddAttributeU32(NFTA_PAYLOAD_DREG, kRegister);
+    AddAttributeU32(NFTA_PAYLOAD_BASE, aBase);
+    AddAttributeU32(NFTA_PAYLOAD_OFFSET, aOffset);
+    AddAttributeU32(NFTA_PAYLOAD_LEN, aLength);
+    EndExpression();
+}
+
+void Batch::AddBitwiseMask(const void *aMask, uint32_t aLength)
+{
+    static const uint8_t kZeros[NFT_REG_SIZE] = {};
+
+    BeginExpression("bitwise");
+    AddAttributeU32(NFTA_BITWISE_SREG, kRegister);
+    AddAttributeU32(NFTA_BITWISE_DREG, kRegister);
+    AddAttributeU32(NFTA_BITWISE_LEN, aLength);
+    AddData(NFTA_BITWISE_MASK, aMask, aLength);
+    AddData(NFTA_BITWISE_XOR, kZeros, aLength);
+    EndExpression();
+}
+
+void Batch::AddCompare(const void *aData, uint32_t aLength, bool aNotEqual)
+{
+    BeginExpression("cmp");
+    AddAttributeU32(NFTA_CMP_SREG, kRegister);
+    AddAttributeU32(NFTA_CMP_OP, aNotEqual ? NFT_CMP_NEQ : NFT_CMP_EQ);
+    AddData(NFTA_CMP_DATA, aData, aLength);
+    EndExpression();
+}
+
+void Batch::AddLookup(const char *aSet, bool aIsInverted)
+{
+    BeginExpression("lookup");
+    AddAttributeString(NFTA_LOOKUP_SET, aSet);
+    AddAttributeU32(NFTA_LOOKUP_SREG, kRegister);
+
+    if (aIsInverted)
+    {
+        AddAttributeU32(NFTA_LOOKUP_FLAGS, NFT_LOOKUP_F_INV);
+    }
+
+    EndExpression();
+}
+
+void Batch::AddInterfaceNameMatch(uint32_t aKey, const char *aName)
+{
+    char name[IFNAMSIZ] = {};
+
+    // The whole name is compared, including the zero padding, as `nft` does for names without a wildcard.
+    strncpy(name, aName, sizeof(name) - 1);
+
+    AddMetaLoad(aKey);
+    AddCompare(name, sizeof(name));
+}
+
+void Batch::AddIp6AddressLoad(bool aIsDestination)
+{
+    AddPayloadLoad(NFT_PAYLOAD_NETWORK_HEADER, kIp6Offset + (aIsDestination ? sizeof(Ip6Address) : 0),
+                   sizeof(Ip6Address));
+}
+
+void Batch::AddIp6PrefixMatch(const Ip6Prefix &aPrefix, bool aIsDestination)
+{
+    uint8_t  prefix[sizeof(aPrefix.mPrefix.m8)];
+    uint32_t length = (aPrefix.mLength + 7u) / 8u;
+
+    VerifyOrExit(aPrefix.mLength > 0);
+
+    memcpy(prefix, aPrefix.mPrefix.m8, length);
+
+    AddPayloadLoad(NFT_PAYLOAD_NETWORK_HEADER, kIp6Offset + (aIsDestination ? sizeof(prefix) : 0), length);
+
+    // Only the last byte of prefixes which are not byte-aligned is masked.
+    if (aPrefix.mLength % 8 != 0)
+    {
+        uint8_t mask[sizeof(prefix)];
+
+        memset(mask, 0xff, length);
+        mask[length - 1] = static_cast<uint8_t>(0xff << (8 - aPrefix.mLength % 8));
+        prefix[length - 1] &= mask[length - 1];
+
+        AddBitwiseMask(mask, length);
+    }
+
+    AddCompare(prefix, length);
+
+exit:
+    return;
+}
+
+void Batch::AddVerdict(int32_t aVerdict)
+{
+    size_t data;
+    size_t verdict;
+
+    BeginExpression("immediate");
+    AddAttributeU32(NFTA_IMMEDIATE_DREG, NFT_REG_VERDICT);
+
+    data    = BeginNested(NFTA_IMMEDIATE_DATA);
+    verdict = BeginNested(NFTA_DATA_VERDICT);
+    AddAttributeU32(NFTA_VERDICT_CODE, static_cast<uint32_t>(aVerdict));
+    EndNested(verdict);
+    EndNested(data);
+
+    EndExpression();
+}
+
+void Batch::AddQueue(uint16_t aQueueNum, bool aBypass)
+{
+    BeginExpression("queue");
+    AddAttributeU16(NFTA_QUEUE_NUM, aQueueNum);
+    AddAttributeU16(NFTA_QUEUE_TOTAL, 1);
+    AddAttributeU16(NFTA_QUEUE_FLAGS, aBypass ? NFT_QUEUE_FLAG_BYPASS : 0);
+    EndExpression();
+}
+
+const uint8_t *Batch::Finish(void)
+{
+    if (!mFinished)
+    {
+        AddControlMessage(NFNL_MSG_BATCH_END);
+        mFinished = true;
+    }
+
+    return mBuffer.data();
+}
+
+void Batch::SetSequence(uint32_t aSequence)
+{
+    // The messages are padded to the alignment, so their headers are found by their lengths.
+    for (size_t offset = 0; offset + sizeof(nlmsghdr) <= mBuffer.size();)
+    {
+        nlmsghdr header;
+
+        memcpy(&header, &mBuffer[offset], sizeof(header));
+        header.nlmsg_seq = aSequence++;
+        memcpy(&mBuffer[offset], &header, sizeof(header));
+        offset += header.nlmsg_len;
+    }
+}
+
+void Batch::BeginMessage(uint16_t aType, uint16_t aFlags, uint8_t aFamily)
+{
+    nlmsghdr header;
+    nfgenmsg message;
+
+    assert(!mFinished);
+
+    memset(&header, 0, sizeof(header));
+    header.nlmsg_type  = static_cast<uint16_t>((NFNL_SUBSYS_NFTABLES << 8) | aType);
+    header.nlmsg_flags = static_cast<uint16_t>(NLM_F_REQUEST | NLM_F_ACK | aFlags);
+
+    message.nfgen_family = aFamily;
+    message.version      = NFNETLINK_V0;
+    message.res_id       = 0;
+
+    mMessageOffset = mBuffer.size();
+    Append(&header, sizeof(header));
+    Append(&message, sizeof(message));
+}
+
+void Batch::EndMessage(void)
+{
+    uint32_t length = static_cast<uint32_t>(mBuffer.size() - mMessageOffset);
+
+    memcpy(&mBuffer[mMessageOffset + offsetof(nlmsghdr, nlmsg_len)], &length, sizeof(length));
+    mRequestCount++;
+}
+
+void Batch::AddControlMessage(uint16_t aType)
+{
+    nlmsghdr header;
+    nfgenmsg message;
+
+    memset(&header, 0, sizeof(header));
+    header.nlmsg_len   = NLMSG_LENGTH(sizeof(message));
+    header.nlmsg_type  = aType;
+    header.nlmsg_flags = NLM_F_REQUEST;
+
+    message.nfgen_family = AF_UNSPEC;
+    message.version      = NFNETLINK_V0;
+    message.res_id       = htons(NFNL_SUBSYS_NFTABLES);
+
+    Append(&header, sizeof(header));
+    Append(&message, sizeof(message));
+}
+
+size_t Batch::BeginNested(uint16_t aType)
+{
+    size_t offset = mBuffer.size();
+
+    AddAttribute(aType | NLA_F_NESTED, nullptr, 0);
+
+    return offset;
+}
+
+void Batch::EndNested(size_t aOffset)
+{
+    uint16_t length = static_cast<uint16_t>(mBuffer.size() - aOffset);
+
+    memcpy(&mBuffer[aOffset + offsetof(nlattr, nla_len)], &length, sizeof(length));
+}
+
+void Batch::AddAttribute(uint16_t aType, const void *aData, size_t aLength)
+{
+    static const uint8_t kPadding[NLA_ALIGNTO] = {};
+    nlattr               attribute;
+
+    attribute.nla_len  = static_cast<uint16_t>(NLA_HDRLEN + aLength);
+    attribute.nla_type = aType;
+
+    Append(&attribute, sizeof(attribute));
+    Append(aData, aLength);
+    Append(kPadding, NLA_ALIGN(aLength) - aLength);
+}
+
+void Batch::AddAttributeU32(uint16_t aType, uint32_t aValue)
+{
+    aValue = htonl(aValue);
+    AddAttribute(aType, &aValue, sizeof(aValue));
+}
+
+void Batch::AddAttributeU16(uint16_t aType, uint16_t aValue)
+{
+    aValue = htons(aValue);
+    AddAttribute(aType, &aValue, sizeof(aValue));
+}
+
+void Batch::AddAttributeString(uint16_t aType, const char *aString)
+{
+    AddAttribute(aType, aString, strlen(aString) + 1);
+}
+
+void Batch::AddData(uint16_t aType, const void *aData, size_t aLength)
+{
+    size_t data = BeginNested(aType);
+
+    AddAttribute(NFTA_DATA_VALUE, aData, aLength);
+    EndNested(data);
+}
+
+void Batch::BeginExpression(const char *aName)
+{
+    mExpressionOffset = BeginNested(NFTA_LIST_ELEM);
+    AddAttributeString(NFTA_EXPR_NAME, aName);
+    mExpressionDataOffset = BeginNested(NFTA_EXPR_DATA);
+}
+
+void Batch::EndExpression(void)
+{
+    EndNested(mExpressionDataOffset);
+    EndNested(mExpressionOffset);
+}
+
+void Batch::Append(const void *aData, size_t aLength)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(aData);
+
+    if (aLength > 0)
+    {
+        mBuffer.insert(mBuffer.end(), data, data + aLength);
+    }
+}
+
+Socket::Socket(void)
+    : mFd(-1)
+    , mSequence(0)
+{
+}
+
+void Socket::Close(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+otbrError Socket::Open(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mFd < 0);
+
+    mFd = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_NETFILTER, kSocketBlock);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+#if defined(SOL_NETLINK) && defined(NETLINK_CAP_ACK)
+    {
+        int enable = 1;
+
+        // The acknowledgements of failed requests don't carry the requests back.
+        if (setsockopt(mFd, SOL_NETLINK, NETLINK_CAP_ACK, &enable, sizeof(enable)) != 0)
+        {
+            otbrLogWarning("Failed to enable NETLINK_CAP_ACK: %s", strerror(errno));
+        }
+    }
+#endif
+
+exit:
+    return error;
+}
+
+otbrError Socket::Commit(Batch &aBatch)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    const uint8_t *data;
+    uint32_t       firstSequence;
+
+    VerifyOrExit(aBatch.GetRequestCount() > 0);
+    SuccessOrExit(error = Open());
+
+    data = aBatch.Finish();
+    aBatch.SetSequence(++mSequence);
+    firstSequence = ++mSequence;
+    mSequence += aBatch.GetRequestCount();
+
+    VerifyOrExit(send(mFd, data, aBatch.GetLength(), 0) == static_cast<ssize_t>(aBatch.GetLength()),
+                 error = OTBR_ERROR_ERRNO);
+
+    error = ProcessAcks(firstSequence, aBatch.GetRequestCount());
+
+exit:
+    if (error == OTBR_ERROR_ERRNO)
+    {
+        otbrLogWarning("Failed to commit batch: %s", strerror(errno));
+    }
+    return error;
+}
+
+otbrError Socket::ProcessAcks(uint32_t aFirstSequence, uint32_t aCount)
+{
+    alignas(nlmsghdr) char buffer[kReceiveBufferSize];
+    ssize_t                length;
+    uint32_t               ackCount   = 0;
+    int                    firstError = 0;
+
+    while (ackCount < aCount && (length = recv(mFd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0)
+    {
+        int remaining = static_cast<int>(length);
+
+        for (nlmsghdr *msg = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(msg, remaining);
+             msg = NLMSG_NEXT(msg, remaining))
+        {
+            int error;
+
+            // Acknowledgements left behind by an earlier batch are skipped.
+            if (msg->nlmsg_type != NLMSG_ERROR || msg->nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr)) ||
+                msg->nlmsg_seq - aFirstSequence >= aCount)
+            {
+                continue;
+            }
+
+            error = -reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(msg))->error;
+            ackCount++;
+
+            if (error != 0 && firstError == 0)
+            {
+                firstError = error;
+                otbrLogWarning("Request#%u of batch failed: %s", msg->nlmsg_seq - aFirstSequence, strerror(error));
+            }
+        }
+    }
+
+    // The kernel aborts the whole batch if any of the requests fails.
+    errno = firstError;
+
+    return firstError == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
+}
+
+} // namespace Nftables
+} // namespace otbr
+
+#endif // __linux__
@@ -0,0 +1,407 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for programming nftables with netlink batches.
+ */
+
+#ifndef OTBR_UTILS_NFTABLES_HPP_
+#define OTBR_UTILS_NFTABLES_HPP_
+
+#include "openthread-br/config.h"
+
+#if __linux__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Nftables {
+
+/**
+ * This class builds a batch of nftables requests, which is applied by the kernel atomically.
+ *
+ * The methods mirror the nft commands, e.g. `AddTable()` for `nft add table`, the rule expressions are appended between
+ * `BeginRule()` and `EndRule()` and use the register `NFT_REG_1` if not specified.
+ *
+ */
+class Batch
+{
+public:
+    static constexpr uint32_t kKeyTypeIp6Address = 8; ///< The `nft` data type `ipv6_addr`.
+
+    /**
+     * This constructor initializes an empty batch.
+     *
+     */
+    Batch(void) { Clear(); }
+
+    /**
+     * This method removes all the requests of this batch.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of requests in this batch, which are acknowledged by the kernel.
+     *
+     * @returns The number of requests.
+     *
+     */
+    uint32_t GetRequestCount(void) const { return mRequestCount; }
+
+    /**
+     * This method adds a table, if it doesn't exist.
+     *
+     * @param[in] aFamily  The family of the table, e.g. `NFPROTO_IPV6`.
+     * @param[in] aTable   The name of the table.
+     *
+     */
+    void AddTable(uint8_t aFamily, const char *aTable);
+
+    /**
+     * This method deletes a table and everything in it.
+     *
+     * A missing table fails the whole batch, so the table is added right before being deleted to clear any stale
+     * content.
+     *
+     * @param[in] aFamily  The family of the table.
+     * @param[in] aTable   The name of the table.
+     *
+     */
+    void DeleteTable(uint8_t aFamily, const char *aTable);
+
+    /**
+     * This method adds a base chain of the `filter` type, whose policy is to accept the packets.
+     *
+     * @param[in] aFamily    The family of the table.
+     * @param[in] aTable     The name of the table.
+     * @param[in] aChain     The name of the chain.
+     * @param[in] aHook      The netfilter hook, e.g. `NF_INET_PRE_ROUTING`.
+     * @param[in] aPriority  The priority of the chain at the hook, e.g. `NF_IP6_PRI_RAW`.
+     *
+     */
+    void AddBaseChain(uint8_t aFamily, const char *aTable, const char *aChain, uint32_t aHook, int32_t aPriority);
+
+    /**
+     * This method deletes all the rules of a chain.
+     *
+     * @param[in] aFamily  The family of the table.
+     * @param[in] aTable   The name of the table.
+     * @param[in] aChain   The name of the chain.
+     *
+     */
+    void FlushChain(uint8_t aFamily, const char *aTable, const char *aChain);
+
+    /**
+     * This method adds a set, if it doesn't exist.
+     *
+     * @param[in] aFamily     The family of the table.
+     * @param[in] aTable      The name of the table.
+     * @param[in] aSet        The name of the set.
+     * @param[in] aKeyType    The `nft` data type of the keys, e.g. `kKeyTypeIp6Address`, only used for listing.
+     * @param[in] aKeyLength  The length of the keys in bytes.
+     * @param[in] aFlags      The flags of the set, e.g. `NFT_SET_INTERVAL`.
+     *
+     */
+    void AddSet(uint8_t     aFamily,
+                const char *aTable,
+                const char *aSet,
+                uint32_t    aKeyType,
+                uint32_t    aKeyLength,
+                uint32_t    aFlags);
+
+    /**
+     * This method starts adding elements to, or deleting elements from, a set.
+     *
+     * Adding an existing element or deleting a missing one fails the whole batch.
+     *
+     * @param[in] aFamily   The family of the table.
+     * @param[in] aTable    The name of the table.
+     * @param[in] aSet      The name of the set.
+     * @param[in] aIsAdded  Whether the elements are added instead of deleted.
+     *
+     */
+    void BeginSetElements(uint8_t aFamily, const char *aTable, const char *aSet, bool aIsAdded);
+
+    /**
+     * This method ends the elements started by `BeginSetElements()`.
+     *
+     */
+    void EndSetElements(void);
+
+    /**
+     * This method deletes all the elements of a set.
+     *
+     * @param[in] aFamily  The family of the table.
+     * @param[in] aTable   The name of the table.
+     * @param[in] aSet     The name of the set.
+     *
+     */
+    void FlushSet(uint8_t aFamily, const char *aTable, const char *aSet);
+
+    /**
+     * This method adds an element to the elements started by `BeginSetElements()`.
+     *
+     * @param[in] aKey            A pointer to the key.
+     * @param[in] aLength         The length of the key in bytes.
+     * @param[in] aIsIntervalEnd  Whether the element ends an interval, which starts at the previous element.
+     *
+     */
+    void AddSetElement(const void *aKey, uint32_t aLength, bool aIsIntervalEnd = false);
+
+    /**
+     * This method adds the interval of an IPv6 prefix to the elements started by `BeginSetElements()`.
+     *
+     * The set must have the `NFT_SET_INTERVAL` flag, and the intervals of a set must not overlap.
+     *
+     * @param[in] aPrefix  The prefix.
+     *
+     */
+    void AddIp6PrefixInterval(const Ip6Prefix &aPrefix);
+
+    /**
+     * This method starts a rule appended to a chain.
+     *
+     * @param[in] aFamily  The family of the table.
+     * @param[in] aTable   The name of the table.
+     * @param[in] aChain   The name of the chain.
+     *
+     */
+    void BeginRule(uint8_t aFamily, const char *aTable, const char *aChain);
+
+    /**
+     * This method ends the rule started by `BeginRule()`.
+     *
+     */
+    void EndRule(void);
+
+    /**
+     * This method loads a meta key, e.g. `NFT_META_IIFNAME`, into the register.
+     *
+     * @param[in] aKey  The meta key.
+     *
+     */
+    void AddMetaLoad(uint32_t aKey);
+
+    /**
+     * This method loads bytes of a packet header into the register.
+     *
+     * @param[in] aBase    The header, e.g. `NFT_PAYLOAD_NETWORK_HEADER`.
+     * @param[in] aOffset  The offset of the bytes in the header.
+     * @param[in] aLength  The number of bytes, at most 16.
+     *
+     */
+    void AddPayloadLoad(uint32_t aBase, uint32_t aOffset, uint32_t aLength);
+
+    /**
+     * This method masks the bytes in the register.
+     *
+     * @param[in] aMask    A pointer to the mask.
+     * @param[in] aLength  The number of bytes of the mask.
+     *
+     */
+    void AddBitwiseMask(const void *aMask, uint32_t aLength);
+
+    /**
+     * This method stops evaluating the rule unless the register is equal to (or, if @p aNotEqual, differs from) the
+     * given bytes.
+     *
+     * @param[in] aData      A pointer to the bytes.
+     * @param[in] aLength    The number of bytes.
+     * @param[in] aNotEqual  Whether the comparison is negated.
+     *
+     */
+    void AddCompare(const void *aData, uint32_t aLength, bool aNotEqual = false);
+
+    /**
+     * This method stops evaluating the rule unless the register is (or, if @p aIsInverted, isn't) in a set.
+     *
+     * @param[in] aSet         The name of the set.
+     * @param[in] aIsInverted  Whether the lookup is negated.
+     *
+     */
+    void AddLookup(const char *aSet, bool aIsInverted = false);
+
+    /**
+     * This method matches the packets whose meta key @p aKey is equal to a name, e.g. `iifname "eth0"`.
+     *
+     * @param[in] aKey   The meta key, `NFT_META_IIFNAME` or `NFT_META_OIFNAME`.
+     * @param[in] aName  The interface name.
+     *
+     */
+    void AddInterfaceNameMatch(uint32_t aKey, const char *aName);
+
+    /**
+     * This method loads the source or destination address of IPv6 packets into the register.
+     *
+     * @param[in] aIsDestination  Whether the destination address is loaded instead of the source address.
+     *
+     */
+    void AddIp6AddressLoad(bool aIsDestination);
+
+    /**
+     * This method matches the IPv6 packets whose source or destination address is in a prefix.
+     *
+     * @param[in] aPrefix         The prefix.
+     * @param[in] aIsDestination  Whether the destination address is matched instead of the source address.
+     *
+     */
+    void AddIp6PrefixMatch(const Ip6Prefix &aPrefix, bool aIsDestination);
+
+    /**
+     * This method sets the verdict of the packets, e.g. `NF_DROP`.
+     *
+     * @param[in] aVerdict  The verdict.
+     *
+     */
+    void AddVerdict(int32_t aVerdict);
+
+    /**
+     * This method queues the packets to a NFQUEUE.
+     *
+     * @param[in] aQueueNum  The queue number.
+     * @param[in] aBypass    Whether the packets are accepted instead of being dropped when no program listens to the
+     *                       queue.
+     *
+     */
+    void AddQueue(uint16_t aQueueNum, bool aBypass);
+
+    /**
+     * This method ends the batch, so that it can be sent.
+     *
+     * @returns A pointer to the messages of the batch.
+     *
+     */
+    const uint8_t *Finish(void);
+
+    /**
+     * This method returns the length of the batch ended by `Finish()`.
+     *
+     * @returns The length in bytes.
+     *
+     */
+    size_t GetLength(void) const { return mBuffer.size(); }
+
+    /**
+     * This method numbers the messages of this batch.
+     *
+     * The batch begin message takes @p aSequence, the requests take the following numbers in the order they were
+     * added.
+     *
+     * @param[in] aSequence  The sequence number of the batch begin message.
+     *
+     */
+    void SetSequence(uint32_t aSequence);
+
+private:
+    void   BeginMessage(uint16_t aType, uint16_t aFlags, uint8_t aFamily);
+    void   EndMessage(void);
+    void   AddControlMessage(uint16_t aType);
+    size_t BeginNested(uint16_t aType);
+    void   EndNested(size_t aOffset);
+    void   AddAttribute(uint16_t aType, const void *aData, size_t aLength);
+    void   AddAttributeU32(uint16_t aType, uint32_t aValue);
+    void   AddAttributeString(uint16_t aType, const char *aString);
+    void   AddAttributeU16(uint16_t aType, uint16_t aValue);
+    void   AddData(uint16_t aType, const void *aData, size_t aLength);
+    void   BeginExpression(const char *aName);
+    void   EndExpression(void);
+    void   Append(const void *aData, size_t aLength);
+
+    std::vector<uint8_t> mBuffer;
+    size_t               mMessageOffset;
+    size_t               mListOffset;
+    size_t               mExpressionOffset;
+    size_t               mExpressionDataOffset;
+    uint32_t             mRequestCount;
+    uint32_t             mSetCount;
+    bool                 mFinished;
+};
+
+/**
+ * This class implements a persistent netlink socket to apply nftables batches.
+ *
+ */
+class Socket : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the object, the socket is opened on the first use.
+     *
+     */
+    Socket(void);
+
+    /**
+     * This destructor closes the socket.
+     *
+     */
+    ~Socket(void) { Close(); }
+
+    /**
+     * This method closes the socket.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method applies a batch with a single round trip.
+     *
+     * The kernel processes the whole batch before `sendmsg()` returns, the acknowledgements are collected without
+     * waiting.
+     *
+     * @param[in] aBatch  The batch.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully applied the batch.
+     * @retval OTBR_ERROR_ERRNO  Failed to send the batch, or the kernel rejected it and none of its requests is
+     *                           applied.
+     *
+     */
+    otbrError Commit(Batch &aBatch);
+
+private:
+    static constexpr size_t kReceiveBufferSize = 8192;
+
+    otbrError Open(void);
+    otbrError ProcessAcks(uint32_t aFirstSequence, uint32_t aCount);
+
+    int      mFd;
+    uint32_t mSequence;
+};
+
+} // namespace Nftables
+} // namespace otbr
+
+#endif // __linux__
+
+#endif // OTBR_UTILS_NFTABLES_HPP_
@@ -0,0 +1,209 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the capture ring of the recent packets.
+ */
+
+#include "utils/packet_capture.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <string.h>
+
+namespace otbr {
+namespace Utils {
+
+namespace {
+
+// The pcapng blocks and options, see https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-02.html
+constexpr uint32_t kBlockTypeSectionHeader    = 0x0a0d0d0a;
+constexpr uint32_t kBlockTypeInterface        = 0x00000001;
+constexpr uint32_t kBlockTypeEnhancedPacket   = 0x00000006;
+constexpr uint32_t kByteOrderMagic            = 0x1a2b3c4d;
+constexpr uint16_t kOptionEndOfOptions        = 0;
+constexpr uint16_t kOptionInterfaceName       = 2;
+constexpr uint16_t kOptionEnhancedPacketFlags = 2;
+constexpr uint16_t kLinkTypeIpv6              = 229;
+constexpr uint16_t kLinkTypeUser0             = 147;
+
+// All the fields are written in little endian, the byte order magic tells the readers so.
+void AppendUint16(std::vector<uint8_t> &aOutput, uint16_t aValue)
+{
+    aOutput.push_back(static_cast<uint8_t>(aValue));
+    aOutput.push_back(static_cast<uint8_t>(aValue >> 8));
+}
+
+void AppendUint32(std::vector<uint8_t> &aOutput, uint32_t aValue)
+{
+    AppendUint16(aOutput, static_cast<uint16_t>(aValue));
+    AppendUint16(aOutput, static_cast<uint16_t>(aValue >> 16));
+}
+
+void AppendPadded(std::vector<uint8_t> &aOutput, const uint8_t *aData, size_t aLength)
+{
+    aOutput.insert(aOutput.end(), aData, aData + aLength);
+    aOutput.resize(aOutput.size() + ((4 - aLength % 4) % 4), 0);
+}
+
+size_t BeginBlock(std::vector<uint8_t> &aOutput, uint32_t aType)
+{
+    size_t start = aOutput.size();
+
+    AppendUint32(aOutput, aType);
+    AppendUint32(aOutput, 0); // The total length, set by `EndBlock()`.
+
+    return start;
+}
+
+void EndBlock(std::vector<uint8_t> &aOutput, size_t aStart)
+{
+    uint32_t length = static_cast<uint32_t>(aOutput.size() - aStart + sizeof(uint32_t));
+
+    for (size_t i = 0; i < sizeof(length); i++)
+    {
+        aOutput[aStart + sizeof(uint32_t) + i] = static_cast<uint8_t>(length >> (8 * i));
+    }
+    AppendUint32(aOutput, length);
+}
+
+void AppendInterface(std::vector<uint8_t> &aOutput, uint16_t aLinkType, const char *aName)
+{
+    size_t start = BeginBlock(aOutput, kBlockTypeInterface);
+
+    AppendUint16(aOutput, aLinkType);
+    AppendUint16(aOutput, 0); // Reserved
+    AppendUint32(aOutput, PacketCapture::kSnapLength);
+
+    // The timestamps have the default resolution of microseconds, so `if_tsresol` is omitted.
+    AppendUint16(aOutput, kOptionInterfaceName);
+    AppendUint16(aOutput, static_cast<uint16_t>(strlen(aName)));
+    AppendPadded(aOutput, reinterpret_cast<const uint8_t *>(aName), strlen(aName));
+    AppendUint16(aOutput, kOptionEndOfOptions);
+    AppendUint16(aOutput, 0);
+
+    EndBlock(aOutput, start);
+}
+
+} // namespace
+
+constexpr uint16_t PacketCapture::kNumPackets;
+constexpr uint16_t PacketCapture::kSnapLength;
+
+PacketCapture::PacketCapture(void)
+    : mRecords(new Record[kNumPackets])
+    , mNextRecord(0)
+    , mNumPackets(0)
+    , mNumOverwritten(0)
+{
+}
+
+void PacketCapture::Capture(Interface aInterface, Direction aDirection, const uint8_t *aData, uint16_t aLength)
+{
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+
+    Capture(aInterface, aDirection, aData, aLength,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count()));
+}
+
+void PacketCapture::Capture(Interface      aInterface,
+                            Direction      aDirection,
+                            const uint8_t *aData,
+                            uint16_t       aLength,
+                            uint64_t       aTimestamp)
+{
+    Record &record = mRecords[mNextRecord];
+
+    record.mTimestamp      = aTimestamp;
+    record.mOriginalLength = aLength;
+    record.mCapturedLength = std::min(aLength, kSnapLength);
+    record.mInterface      = aInterface;
+    record.mDirection      = aDirection;
+    memcpy(record.mData, aData, record.mCapturedLength);
+
+    mNextRecord = (mNextRecord + 1) % kNumPackets;
+
+    if (mNumPackets < kNumPackets)
+    {
+        mNumPackets++;
+    }
+    else
+    {
+        mNumOverwritten++;
+    }
+}
+
+void PacketCapture::Clear(void)
+{
+    mNextRecord     = 0;
+    mNumPackets     = 0;
+    mNumOverwritten = 0;
+}
+
+void PacketCapture::WritePcapng(std::vector<uint8_t> &aOutput) const
+{
+    size_t start;
+
+    aOutput.clear();
+
+    start = BeginBlock(aOutput, kBlockTypeSectionHeader);
+    AppendUint32(aOutput, kByteOrderMagic);
+    AppendUint16(aOutput, 1); // Major version
+    AppendUint16(aOutput, 0); // Minor version
+    AppendUint32(aOutput, UINT32_MAX);
+    AppendUint32(aOutput, UINT32_MAX); // The section length is not specified.
+    EndBlock(aOutput, start);
+
+    // The interfaces are written in the order of their ids.
+    AppendInterface(aOutput, kLinkTypeIpv6, "thread");
+    AppendInterface(aOutput, kLinkTypeUser0, "spinel");
+
+    for (uint16_t i = 0; i < mNumPackets; i++)
+    {
+        const Record &record = mRecords[(mNextRecord + kNumPackets - mNumPackets + i) % kNumPackets];
+
+        start = BeginBlock(aOutput, kBlockTypeEnhancedPacket);
+        AppendUint32(aOutput, record.mInterface);
+        AppendUint32(aOutput, static_cast<uint32_t>(record.mTimestamp >> 32));
+        AppendUint32(aOutput, static_cast<uint32_t>(record.mTimestamp));
+        AppendUint32(aOutput, record.mCapturedLength);
+        AppendUint32(aOutput, record.mOriginalLength);
+        AppendPadded(aOutput, record.mData, record.mCapturedLength);
+        AppendUint16(aOutput, kOptionEnhancedPacketFlags);
+        AppendUint16(aOutput, sizeof(uint32_t));
+        AppendUint32(aOutput, record.mDirection);
+        AppendUint16(aOutput, kOptionEndOfOptions);
+        AppendUint16(aOutput, 0);
+        EndBlock(aOutput, start);
+    }
+}
+
+} // namespace Utils
+} // namespace otbr
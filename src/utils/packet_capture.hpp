@@ -0,0 +1,198 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the capture ring of the recent packets.
+ */
+
+#ifndef OTBR_UTILS_PACKET_CAPTURE_HPP_
+#define OTBR_UTILS_PACKET_CAPTURE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <memory>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+#ifndef OTBR_ENABLE_PACKET_CAPTURE
+#define OTBR_ENABLE_PACKET_CAPTURE 0
+#endif
+
+/**
+ * The number of packets kept by the capture ring, the oldest packet is overwritten when the ring is full.
+ *
+ */
+#ifndef OTBR_PACKET_CAPTURE_NUM_PACKETS
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_PACKET_CAPTURE_NUM_PACKETS 32
+#else
+#define OTBR_PACKET_CAPTURE_NUM_PACKETS 256
+#endif
+#endif
+
+/**
+ * The maximum number of bytes captured of each packet, the rest of a longer packet is truncated.
+ *
+ */
+#ifndef OTBR_PACKET_CAPTURE_SNAP_LENGTH
+#define OTBR_PACKET_CAPTURE_SNAP_LENGTH 1280
+#endif
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This class implements a capture ring of the recent packets, which can be dumped as pcapng.
+ *
+ * All the slots are allocated when constructing the ring, so that capturing a packet is only a copy and never
+ * allocates. The ring is only accessed from the mainloop thread and takes no lock.
+ *
+ */
+class PacketCapture : private NonCopyable
+{
+public:
+    static constexpr uint16_t kNumPackets = OTBR_PACKET_CAPTURE_NUM_PACKETS; ///< The number of packets kept.
+    static constexpr uint16_t kSnapLength = OTBR_PACKET_CAPTURE_SNAP_LENGTH; ///< The bytes captured of a packet.
+
+    /**
+     * This enumeration defines the interfaces the packets are captured on.
+     *
+     * The value is the interface id of the interface in the pcapng dump.
+     *
+     */
+    enum Interface : uint8_t
+    {
+        kInterfaceThread = 0, ///< The IPv6 datagrams of the Thread network interface.
+        kInterfaceSpinel = 1, ///< The spinel frames exchanged with the co-processor.
+        kNumInterfaces,
+    };
+
+    /**
+     * This enumeration defines the directions of the packets.
+     *
+     * The value is the direction in the `epb_flags` option of the pcapng dump.
+     *
+     */
+    enum Direction : uint8_t
+    {
+        kDirectionInbound  = 1, ///< Received from the Thread network or the co-processor.
+        kDirectionOutbound = 2, ///< Sent to the Thread network or the co-processor.
+    };
+
+    /**
+     * The constructor allocates all the slots of the ring.
+     *
+     */
+    PacketCapture(void);
+
+    /**
+     * This method captures a packet, timestamped with the current time.
+     *
+     * @param[in] aInterface  The interface of the packet.
+     * @param[in] aDirection  The direction of the packet.
+     * @param[in] aData       A pointer to the packet.
+     * @param[in] aLength     The length of the packet, only the first `kSnapLength` bytes are captured.
+     *
+     */
+    void Capture(Interface aInterface, Direction aDirection, const uint8_t *aData, uint16_t aLength);
+
+    /**
+     * This method captures a packet.
+     *
+     * @param[in] aInterface  The interface of the packet.
+     * @param[in] aDirection  The direction of the packet.
+     * @param[in] aData       A pointer to the packet.
+     * @param[in] aLength     The length of the packet, only the first `kSnapLength` bytes are captured.
+     * @param[in] aTimestamp  The time the packet is captured, in microseconds since the epoch.
+     *
+     */
+    void Capture(Interface      aInterface,
+                 Direction      aDirection,
+                 const uint8_t *aData,
+                 uint16_t       aLength,
+                 uint64_t       aTimestamp);
+
+    /**
+     * This method discards all the captured packets.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of packets in the ring.
+     *
+     * @returns The number of packets in the ring.
+     *
+     */
+    uint16_t GetNumPackets(void) const { return mNumPackets; }
+
+    /**
+     * This method returns the number of packets overwritten by newer ones since the ring was last cleared.
+     *
+     * @returns The number of overwritten packets.
+     *
+     */
+    uint64_t GetNumOverwritten(void) const { return mNumOverwritten; }
+
+    /**
+     * This method writes the packets in the ring as a pcapng section, from the oldest to the newest.
+     *
+     * The section has an interface for each of `Interface`: the Thread interface has the IPv6 link type, while the
+     * spinel interface has the first user link type, for which a dissector of the spinel frames can be configured.
+     *
+     * @param[out] aOutput  The buffer to write the pcapng section to, its content is replaced.
+     *
+     */
+    void WritePcapng(std::vector<uint8_t> &aOutput) const;
+
+private:
+    struct Record
+    {
+        uint64_t mTimestamp;
+        uint16_t mOriginalLength;
+        uint16_t mCapturedLength;
+        uint8_t  mInterface;
+        uint8_t  mDirection;
+        uint8_t  mData[kSnapLength];
+    };
+
+    std::unique_ptr<Record[]> mRecords;
+    uint16_t                  mNextRecord;
+    uint16_t                  mNumPackets;
+    uint64_t                  mNumOverwritten;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // OTBR_UTILS_PACKET_CAPTURE_HPP_
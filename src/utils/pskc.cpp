@@ -33,12 +33,20 @@
 
 #include "utils/pskc.hpp"
 
+#include <algorithm>
+
+#include <mbedtls/aes.h>
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+Pskc::CacheEntry Pskc::sCache[OTBR_PSKC_CACHE_SIZE];
+uint8_t          Pskc::sCacheLength = 0;
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix     = "Thread";
@@ -69,9 +77,8 @@ void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
         cur += networkNameLen;
     }
 
-    mSaltLen = static_cast<uint16_t>(cur);
-
 exit:
+    mSaltLen = static_cast<uint16_t>(cur);
     if (ret != kPskcStatus_Ok)
     {
         otbrLogErr("ExtPanId or NetworkName is nullptr");
@@ -79,53 +86,142 @@ exit:
     return;
 }
 
+void Pskc::ComputeKeyBlock(const char *aPassphrase, uint32_t aBlockCounter, uint8_t *aKeyBlock) const
+{
+    static const uint8_t kZeroKey[MBEDTLS_AES_BLOCK_SIZE] = {0};
+
+    uint8_t             prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t             prfKey[MBEDTLS_AES_BLOCK_SIZE];
+    uint8_t             prfOutput[MBEDTLS_AES_BLOCK_SIZE];
+    uint8_t             subkey[MBEDTLS_AES_BLOCK_SIZE] = {0};
+    uint8_t             block[MBEDTLS_AES_BLOCK_SIZE];
+    uint8_t             carry;
+    size_t              passphraseLen = strlen(aPassphrase);
+    mbedtls_aes_context aes;
+
+    // AES-CMAC-PRF-128 (RFC 4615) uses the passphrase as the key if it is 128 bits long, and otherwise the AES-CMAC of
+    // the passphrase with a zero key. This key is the same for all the iterations so it is derived only once.
+    if (passphraseLen == sizeof(prfKey))
+    {
+        memcpy(prfKey, aPassphrase, sizeof(prfKey));
+    }
+    else
+    {
+        mbedtls_aes_cmac_prf_128(kZeroKey, sizeof(kZeroKey), reinterpret_cast<const uint8_t *>(aPassphrase),
+                                 passphraseLen, prfKey);
+    }
+
+    memcpy(prfInput, mSalt, mSaltLen);
+    prfInput[mSaltLen + 0] = (uint8_t)(aBlockCounter >> 24);
+    prfInput[mSaltLen + 1] = (uint8_t)(aBlockCounter >> 16);
+    prfInput[mSaltLen + 2] = (uint8_t)(aBlockCounter >> 8);
+    prfInput[mSaltLen + 3] = (uint8_t)(aBlockCounter);
+    // Calculate U_1
+    mbedtls_aes_cmac_prf_128(prfKey, sizeof(prfKey), prfInput, mSaltLen + 4, prfOutput);
+    memcpy(aKeyBlock, prfOutput, sizeof(prfOutput));
+
+    mbedtls_aes_init(&aes);
+    mbedtls_aes_setkey_enc(&aes, prfKey, sizeof(prfKey) * 8);
+
+    // The AES-CMAC of a single complete block M is AES(K, M xor K1), where the subkey K1 is AES(K, 0) doubled in
+    // GF(2^128). So each remaining iteration is a single block encryption, which mbedtls runs on AES-NI or the Armv8
+    // Crypto Extensions when they are available.
+    mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, subkey, subkey);
+    carry = subkey[0] >> 7;
+    for (uint8_t j = 0; j < sizeof(subkey) - 1; j++)
+    {
+        subkey[j] = static_cast<uint8_t>((subkey[j] << 1) | (subkey[j + 1] >> 7));
+    }
+    subkey[sizeof(subkey) - 1] = static_cast<uint8_t>((subkey[sizeof(subkey) - 1] << 1) ^ (carry ? 0x87 : 0));
+
+    for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+    {
+        // Calculate U_i
+        for (uint8_t j = 0; j < sizeof(block); j++)
+        {
+            block[j] = prfOutput[j] ^ subkey[j];
+        }
+        mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, block, prfOutput);
+
+        // xor
+        for (uint8_t j = 0; j < sizeof(prfOutput); j++)
+        {
+            aKeyBlock[j] ^= prfOutput[j];
+        }
+    }
+
+    mbedtls_aes_free(&aes);
+}
+
+bool Pskc::FindCachedPskc(const uint8_t *aPassphraseHash)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < sCacheLength; i++)
+    {
+        const CacheEntry &entry = sCache[i];
+
+        if (entry.mSaltLen == mSaltLen && memcmp(entry.mSalt, mSalt, mSaltLen) == 0 &&
+            memcmp(entry.mPassphraseHash, aPassphraseHash, kPassphraseHashLength) == 0)
+        {
+            memcpy(mPskc, entry.mPskc, sizeof(mPskc));
+            std::rotate(sCache, sCache + i, sCache + i + 1);
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void Pskc::CachePskc(const uint8_t *aPassphraseHash)
+{
+    CacheEntry &entry = sCache[0];
+
+    if (sCacheLength < OTBR_PSKC_CACHE_SIZE)
+    {
+        sCacheLength++;
+    }
+    // The least recently used entry is overwritten if the cache is full.
+    std::rotate(sCache, sCache + sCacheLength - 1, sCache + sCacheLength);
+
+    memcpy(entry.mSalt, mSalt, mSaltLen);
+    entry.mSaltLen = mSaltLen;
+    memcpy(entry.mPassphraseHash, aPassphraseHash, kPassphraseHashLength);
+    memcpy(entry.mPskc, mPskc, sizeof(mPskc));
+}
+
 const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
 {
     uint32_t blockCounter = 0;
     uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint16_t prfBlockLen  = MBEDTLS_AES_BLOCK_SIZE;
+    uint8_t  keyBlock[MBEDTLS_AES_BLOCK_SIZE];
+    uint8_t  passphraseHash[kPassphraseHashLength];
     uint16_t keyLen = OT_PSKC_LENGTH;
     uint8_t *pskc   = mPskc;
 
     SetSalt(aExtPanId, aNetworkName);
 
+    // Only the hash of the passphrase is kept by the cache.
+    mbedtls_sha256(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), passphraseHash,
+                   /* is224 */ 0);
+    VerifyOrExit(!FindCachedPskc(passphraseHash));
+
     while (keyLen)
     {
-        memcpy(prfInput, mSalt, mSaltLen);
-
         blockCounter++;
-        prfInput[mSaltLen + 0] = (uint8_t)(blockCounter >> 24);
-        prfInput[mSaltLen + 1] = (uint8_t)(blockCounter >> 16);
-        prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
-        prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
-        // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
-        memcpy(keyBlock, prfOutput, prfBlockLen);
-
-        for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
-        {
-            memcpy(prfInput, prfOutput, prfBlockLen);
-
-            // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
-
-            // xor
-            for (uint32_t j = 0; j < prfBlockLen; j++)
-            {
-                keyBlock[j] ^= prfOutput[j];
-            }
-        }
+        ComputeKeyBlock(aPassphrase, blockCounter, keyBlock);
 
         useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
         memcpy(pskc, keyBlock, useLen);
         pskc += useLen;
         keyLen -= useLen;
     }
+
+    CachePskc(passphraseHash);
+
+exit:
     return mPskc;
 }
 
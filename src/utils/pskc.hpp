@@ -42,6 +42,14 @@
 #define OT_PBKDF2_SALT_MAX_LENGTH 30
 #define OT_PSKC_LENGTH 16
 
+/**
+ * The number of the most recently computed PSKc values which are kept to be returned without computing them again.
+ *
+ */
+#ifndef OTBR_PSKC_CACHE_SIZE
+#define OTBR_PSKC_CACHE_SIZE 4
+#endif
+
 #include <stdint.h>
 #include <string.h>
 
@@ -62,6 +70,9 @@ public:
     /**
      * This method computes the PSKc.
      *
+     * The last OTBR_PSKC_CACHE_SIZE results are shared by all instances and returned without the PBKDF2 iterations, so
+     * this method must not be called from multiple threads at the same time.
+     *
      * @param[in] aExtPanId     A pointer to extended PAN ID.
      * @param[in] aNetworkName  A pointer to network name.
      * @param[in] aPassphrase   A pointer to passphrase.
@@ -72,11 +83,28 @@ public:
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
 private:
+    static constexpr uint8_t kPassphraseHashLength = 32; // SHA-256
+
+    struct CacheEntry
+    {
+        char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
+        uint16_t mSaltLen;
+        uint8_t  mPassphraseHash[kPassphraseHashLength];
+        uint8_t  mPskc[OT_PSKC_LENGTH];
+    };
+
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    void ComputeKeyBlock(const char *aPassphrase, uint32_t aBlockCounter, uint8_t *aKeyBlock) const;
+    bool FindCachedPskc(const uint8_t *aPassphraseHash);
+    void CachePskc(const uint8_t *aPassphraseHash);
 
     char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
     uint16_t mSaltLen;
     uint8_t  mPskc[OT_PSKC_LENGTH];
+
+    // The cache entries are ordered from the most recently used one.
+    static CacheEntry sCache[OTBR_PSKC_CACHE_SIZE];
+    static uint8_t    sCacheLength;
 };
 
 } // namespace Psk
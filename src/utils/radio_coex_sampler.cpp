@@ -0,0 +1,230 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the sampler of the radio coex metrics.
+ */
+
+#define OTBR_LOG_TAG "COEX"
+
+#include "utils/radio_coex_sampler.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+namespace {
+
+// The fields of `otRadioCoexMetrics` in the order of `RadioCoexHistory::Counter`.
+uint32_t otRadioCoexMetrics::*const kCounterFields[RadioCoexHistory::kNumCounters] = {
+    &otRadioCoexMetrics::mNumGrantGlitch,
+    &otRadioCoexMetrics::mNumTxRequest,
+    &otRadioCoexMetrics::mNumTxGrantImmediate,
+    &otRadioCoexMetrics::mNumTxGrantWait,
+    &otRadioCoexMetrics::mNumTxGrantWaitActivated,
+    &otRadioCoexMetrics::mNumTxGrantWaitTimeout,
+    &otRadioCoexMetrics::mNumTxGrantDeactivatedDuringRequest,
+    &otRadioCoexMetrics::mNumTxDelayedGrant,
+    &otRadioCoexMetrics::mNumRxRequest,
+    &otRadioCoexMetrics::mNumRxGrantImmediate,
+    &otRadioCoexMetrics::mNumRxGrantWait,
+    &otRadioCoexMetrics::mNumRxGrantWaitActivated,
+    &otRadioCoexMetrics::mNumRxGrantWaitTimeout,
+    &otRadioCoexMetrics::mNumRxGrantDeactivatedDuringRequest,
+    &otRadioCoexMetrics::mNumRxDelayedGrant,
+    &otRadioCoexMetrics::mNumRxGrantNone,
+};
+
+} // namespace
+
+constexpr uint16_t RadioCoexHistory::kMaxIntervals;
+
+RadioCoexHistory::RadioCoexHistory(void)
+    : mTotalDuration(0)
+    , mNext(0)
+    , mCount(0)
+    , mHasMetrics(false)
+{
+    memset(&mMetrics, 0, sizeof(mMetrics));
+    memset(mIncrements, 0, sizeof(mIncrements));
+    memset(mDurations, 0, sizeof(mDurations));
+    memset(mSums, 0, sizeof(mSums));
+}
+
+void RadioCoexHistory::AddMetrics(const otRadioCoexMetrics &aMetrics, Milliseconds aElapsed)
+{
+    bool isFull  = (mCount == kMaxIntervals);
+    bool isReset = false;
+
+    VerifyOrExit(mHasMetrics);
+
+    for (uint8_t i = 0; i < kNumCounters; i++)
+    {
+        isReset = isReset || (aMetrics.*kCounterFields[i] < mMetrics.*kCounterFields[i]);
+    }
+    if (isReset)
+    {
+        otbrLogInfo("The radio coex counters were reset");
+    }
+
+    for (uint8_t i = 0; i < kNumCounters; i++)
+    {
+        uint32_t &entry = mIncrements[i][mNext];
+
+        if (isFull)
+        {
+            mSums[i] -= entry;
+        }
+        entry = isReset ? aMetrics.*kCounterFields[i] : aMetrics.*kCounterFields[i] - mMetrics.*kCounterFields[i];
+        mSums[i] += entry;
+    }
+
+    if (isFull)
+    {
+        mTotalDuration -= mDurations[mNext];
+    }
+    mDurations[mNext] = static_cast<uint32_t>(std::min<int64_t>(std::max<int64_t>(aElapsed.count(), 0), UINT32_MAX));
+    mTotalDuration += mDurations[mNext];
+
+    mNext  = (mNext + 1) % kMaxIntervals;
+    mCount = std::min<uint16_t>(mCount + 1, kMaxIntervals);
+
+exit:
+    mMetrics    = aMetrics;
+    mHasMetrics = true;
+}
+
+uint32_t RadioCoexHistory::GetTotal(Counter aCounter) const
+{
+    uint32_t total = 0;
+
+    VerifyOrExit(aCounter < kNumCounters);
+    total = mMetrics.*kCounterFields[aCounter];
+
+exit:
+    return total;
+}
+
+uint32_t RadioCoexHistory::GetLatestIncrement(Counter aCounter) const
+{
+    uint32_t increment = 0;
+
+    VerifyOrExit(mCount > 0 && aCounter < kNumCounters);
+    increment = mIncrements[aCounter][(mNext + kMaxIntervals - 1) % kMaxIntervals];
+
+exit:
+    return increment;
+}
+
+uint32_t RadioCoexHistory::GetRatePerMinute(Counter aCounter) const
+{
+    static constexpr uint64_t kMillisecondsPerMinute = 60000;
+
+    uint32_t rate = 0;
+    uint64_t rounded;
+
+    VerifyOrExit(mTotalDuration > 0 && aCounter < kNumCounters);
+    rounded = (mSums[aCounter] * kMillisecondsPerMinute + mTotalDuration / 2) / mTotalDuration;
+    rate    = static_cast<uint32_t>(std::min<uint64_t>(rounded, UINT32_MAX));
+
+exit:
+    return rate;
+}
+
+constexpr Milliseconds RadioCoexSampler::kSampleInterval;
+
+RadioCoexSampler::RadioCoexSampler(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mSampleTaskId(0)
+    , mError(OT_ERROR_INVALID_STATE)
+    , mIsRunning(false)
+{
+}
+
+void RadioCoexSampler::Start(void)
+{
+    VerifyOrExit(!mIsRunning);
+
+    mIsRunning    = true;
+    mSampleTaskId = mTaskRunner.Post(Milliseconds(0), [this]() { Sample(); });
+
+exit:
+    return;
+}
+
+void RadioCoexSampler::Stop(void)
+{
+    VerifyOrExit(mIsRunning);
+
+    mIsRunning = false;
+    mTaskRunner.Cancel(mSampleTaskId);
+    mSampleTaskId = 0;
+
+exit:
+    return;
+}
+
+otError RadioCoexSampler::GetMetrics(otRadioCoexMetrics &aMetrics) const
+{
+    otError error = OT_ERROR_NONE;
+
+    // The latest metrics read successfully are kept over a failed read.
+    VerifyOrExit(mHistory.HasMetrics(), error = mError);
+    aMetrics = mHistory.GetMetrics();
+
+exit:
+    return error;
+}
+
+void RadioCoexSampler::Sample(void)
+{
+    otRadioCoexMetrics metrics;
+    Timepoint          now = Clock::now();
+
+    mSampleTaskId = 0;
+
+    mError = otPlatRadioGetCoexMetrics(mInstance, &metrics);
+    if (mError == OT_ERROR_NONE)
+    {
+        mHistory.AddMetrics(metrics, std::chrono::duration_cast<Milliseconds>(now - mLastSampleTime));
+        mLastSampleTime = now;
+        otbrLogDebug("Read the radio coex metrics, %u intervals", mHistory.GetIntervalCount());
+    }
+
+    mSampleTaskId = mTaskRunner.Post(kSampleInterval, [this]() { Sample(); });
+}
+
+} // namespace agent
+} // namespace otbr
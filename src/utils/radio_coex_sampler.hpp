@@ -0,0 +1,283 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the sampler of the radio coex metrics.
+ */
+
+#ifndef OTBR_UTILS_RADIO_COEX_SAMPLER_HPP_
+#define OTBR_UTILS_RADIO_COEX_SAMPLER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/instance.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+
+/**
+ * @def OTBR_RADIO_COEX_SAMPLE_INTERVAL_MS
+ *
+ * The interval in milliseconds at which the radio coex metrics are read from the radio.
+ */
+#ifndef OTBR_RADIO_COEX_SAMPLE_INTERVAL_MS
+#define OTBR_RADIO_COEX_SAMPLE_INTERVAL_MS 30000
+#endif
+
+/**
+ * @def OTBR_RADIO_COEX_HISTORY_SIZE
+ *
+ * The number of intervals whose increments of the radio coex counters are kept.
+ */
+#ifndef OTBR_RADIO_COEX_HISTORY_SIZE
+#if OTBR_ENABLE_LOW_MEMORY
+#define OTBR_RADIO_COEX_HISTORY_SIZE 8
+#else
+#define OTBR_RADIO_COEX_HISTORY_SIZE 32
+#endif
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class keeps the latest radio coex metrics and the increments of the counters over the latest intervals in a
+ * fixed-size ring buffer.
+ *
+ * The sums of the increments are updated as intervals are added and overwritten, so that the rates never scan the
+ * history.
+ *
+ */
+class RadioCoexHistory
+{
+public:
+    /**
+     * The counters of the radio coex metrics.
+     *
+     */
+    enum Counter : uint8_t
+    {
+        kGrantGlitch,
+        kTxRequest,
+        kTxGrantImmediate,
+        kTxGrantWait,
+        kTxGrantWaitActivated,
+        kTxGrantWaitTimeout,
+        kTxGrantDeactivatedDuringRequest,
+        kTxDelayedGrant,
+        kRxRequest,
+        kRxGrantImmediate,
+        kRxGrantWait,
+        kRxGrantWaitActivated,
+        kRxGrantWaitTimeout,
+        kRxGrantDeactivatedDuringRequest,
+        kRxDelayedGrant,
+        kRxGrantNone,
+        kNumCounters, ///< The number of counters.
+    };
+
+    static constexpr uint16_t kMaxIntervals = OTBR_RADIO_COEX_HISTORY_SIZE; ///< The intervals kept.
+
+    static_assert(kMaxIntervals > 0, "OTBR_RADIO_COEX_HISTORY_SIZE must be greater than 0");
+
+    /**
+     * The constructor starts with an empty history.
+     *
+     */
+    RadioCoexHistory(void);
+
+    /**
+     * This method records the metrics read from the radio, which adds the increments since the previous metrics as
+     * an interval and replaces the oldest one if the history is full.
+     *
+     * The first metrics only set the base of the increments. The counters are considered reset if any of them
+     * decreased, in which case the increments are the new values.
+     *
+     * @param[in] aMetrics  The cumulative radio coex metrics.
+     * @param[in] aElapsed  The time elapsed since the previous metrics.
+     *
+     */
+    void AddMetrics(const otRadioCoexMetrics &aMetrics, Milliseconds aElapsed);
+
+    /**
+     * This method indicates whether any metrics are recorded.
+     *
+     * @returns TRUE if metrics are recorded, FALSE otherwise.
+     *
+     */
+    bool HasMetrics(void) const { return mHasMetrics; }
+
+    /**
+     * This method returns the latest cumulative metrics.
+     *
+     * @returns A reference to the latest metrics, all zeros if none is recorded.
+     *
+     */
+    const otRadioCoexMetrics &GetMetrics(void) const { return mMetrics; }
+
+    /**
+     * This method returns the number of intervals in the history.
+     *
+     * @returns The number of intervals.
+     *
+     */
+    uint16_t GetIntervalCount(void) const { return mCount; }
+
+    /**
+     * This method returns the total duration of the intervals in the history.
+     *
+     * @returns The duration of the history.
+     *
+     */
+    Milliseconds GetDuration(void) const { return Milliseconds(mTotalDuration); }
+
+    /**
+     * This method returns the latest cumulative value of a counter.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The value of the counter, or 0 if no metrics are recorded.
+     *
+     */
+    uint32_t GetTotal(Counter aCounter) const;
+
+    /**
+     * This method returns the increment of a counter over the intervals in the history.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The increment of the counter.
+     *
+     */
+    uint64_t GetIncrement(Counter aCounter) const { return mSums[aCounter]; }
+
+    /**
+     * This method returns the increment of a counter over the latest interval.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The increment of the counter, or 0 if the history is empty.
+     *
+     */
+    uint32_t GetLatestIncrement(Counter aCounter) const;
+
+    /**
+     * This method returns the rate of a counter over the intervals in the history.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The increments of the counter per minute, or 0 if the history is empty.
+     *
+     */
+    uint32_t GetRatePerMinute(Counter aCounter) const;
+
+private:
+    otRadioCoexMetrics mMetrics;
+    uint32_t           mIncrements[kNumCounters][kMaxIntervals];
+    uint32_t           mDurations[kMaxIntervals];
+    uint64_t           mSums[kNumCounters];
+    uint64_t           mTotalDuration;
+    uint16_t           mNext;
+    uint16_t           mCount;
+    bool               mHasMetrics;
+};
+
+/**
+ * This class reads the radio coex metrics every OTBR_RADIO_COEX_SAMPLE_INTERVAL_MS, so that the queries are answered
+ * without any spinel transaction.
+ *
+ */
+class RadioCoexSampler : private NonCopyable
+{
+public:
+    /**
+     * The constructor of the Radio Coex Sampler.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit RadioCoexSampler(otInstance *aInstance);
+
+    /**
+     * This method starts reading the radio coex metrics, the first ones are read as soon as possible.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops reading, the history is kept.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method returns the latest radio coex metrics.
+     *
+     * @param[out] aMetrics  A reference to where the metrics are copied.
+     *
+     * @retval OT_ERROR_NONE           Successfully copied the latest metrics.
+     * @retval OT_ERROR_INVALID_STATE  No metrics are read yet.
+     *
+     * Any other error is the one of the latest read, if the metrics were never read successfully.
+     *
+     */
+    otError GetMetrics(otRadioCoexMetrics &aMetrics) const;
+
+    /**
+     * This method returns the history of the radio coex metrics.
+     *
+     * @returns A reference to the history.
+     *
+     */
+    const RadioCoexHistory &GetHistory(void) const { return mHistory; }
+
+private:
+    static constexpr Milliseconds kSampleInterval = Milliseconds(OTBR_RADIO_COEX_SAMPLE_INTERVAL_MS);
+
+    void Sample(void);
+
+    otInstance        *mInstance;
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mSampleTaskId;
+    RadioCoexHistory   mHistory;
+    Timepoint          mLastSampleTime;
+    otError            mError;
+    bool               mIsRunning;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_RADIO_COEX_SAMPLER_HPP_
@@ -0,0 +1,253 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the coalescing and caching of the results of radio scans.
+ */
+
+#ifndef OTBR_UTILS_SCAN_CACHE_HPP_
+#define OTBR_UTILS_SCAN_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <openthread/error.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class template coalesces the concurrent requests of a radio scan into a single scan and keeps its results for
+ * a while, so that requests received shortly after a scan are served without scanning again.
+ *
+ * A scan is identified by a parameter (e.g. the scan duration), only requests with the same parameter are coalesced
+ * or served from the cache.
+ *
+ * @tparam ResultType  The type of a scan result.
+ *
+ */
+template <typename ResultType> class ScanCache
+{
+public:
+    using Handler       = std::function<void(otError, const std::vector<ResultType> &)>;
+    using ResultHandler = std::function<void(const ResultType &)>;
+
+    /**
+     * The outcome of adding a request.
+     *
+     */
+    enum Action : uint8_t
+    {
+        kStartScan, ///< The caller must start a scan and report its results.
+        kJoined,    ///< The request joined the scan in progress.
+        kCached,    ///< The request was served from the cache.
+        kBusy,      ///< A scan with another parameter is in progress.
+    };
+
+    /**
+     * The constructor of a scan cache.
+     *
+     * @param[in] aMaxAge  How long the results of a scan are served from the cache, zero to disable the cache.
+     *
+     */
+    explicit ScanCache(Milliseconds aMaxAge)
+        : mMaxAge(aMaxAge)
+        , mScanning(false)
+        , mHasResults(false)
+        , mParameter(0)
+    {
+    }
+
+    /**
+     * This method adds a scan request.
+     *
+     * The results received so far are passed to @p aResultHandler before returning, either from the cache or from
+     * the scan in progress. A request served from the cache is also completed before returning.
+     *
+     * @param[in] aParameter      The parameter of the scan.
+     * @param[in] aHandler        The handler called with all the results when the scan completes.
+     * @param[in] aResultHandler  The handler called with each result as it is received, may be nullptr.
+     * @param[in] aNow            The current time.
+     *
+     * @returns What the caller must do with the request.
+     *
+     */
+    Action AddRequest(uint32_t aParameter, Handler aHandler, ResultHandler aResultHandler, Timepoint aNow)
+    {
+        Action action = kStartScan;
+
+        if (mScanning)
+        {
+            VerifyOrExit(aParameter == mParameter, action = kBusy);
+            ReplayResults(aResultHandler);
+            mRequests.push_back({std::move(aHandler), std::move(aResultHandler)});
+            ExitNow(action = kJoined);
+        }
+
+        if (mHasResults && aParameter == mParameter && aNow - mScanTime < mMaxAge)
+        {
+            // The handlers may start another scan, which clears the cached results.
+            std::vector<ResultType> results = mResults;
+
+            for (const ResultType &result : results)
+            {
+                if (aResultHandler != nullptr)
+                {
+                    aResultHandler(result);
+                }
+            }
+            if (aHandler != nullptr)
+            {
+                aHandler(OT_ERROR_NONE, results);
+            }
+            ExitNow(action = kCached);
+        }
+
+        mScanning   = true;
+        mHasResults = false;
+        mParameter  = aParameter;
+        mScanTime   = aNow;
+        mResults.clear();
+        mRequests.push_back({std::move(aHandler), std::move(aResultHandler)});
+
+    exit:
+        return action;
+    }
+
+    /**
+     * This method reports a result of the scan in progress to the requests.
+     *
+     * @param[in] aResult  The scan result.
+     *
+     */
+    void HandleResult(const ResultType &aResult)
+    {
+        VerifyOrExit(mScanning);
+        mResults.push_back(aResult);
+
+        // A result handler may add a request, so the requests are not iterated.
+        for (size_t i = 0; i < mRequests.size(); i++)
+        {
+            if (mRequests[i].mResultHandler != nullptr)
+            {
+                mRequests[i].mResultHandler(aResult);
+            }
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method completes the scan in progress and all its requests.
+     *
+     * The results are only cached if the scan succeeded.
+     *
+     * @param[in] aError  The error of the scan.
+     *
+     */
+    void HandleDone(otError aError)
+    {
+        std::vector<Request>    requests;
+        std::vector<ResultType> results;
+
+        VerifyOrExit(mScanning);
+        mScanning   = false;
+        mHasResults = (aError == OT_ERROR_NONE) && mMaxAge > Milliseconds::zero();
+
+        // The handlers may add requests or start another scan, which must not affect the completion of this scan.
+        requests.swap(mRequests);
+        if (aError == OT_ERROR_NONE)
+        {
+            results = mResults;
+        }
+        for (const Request &request : requests)
+        {
+            if (request.mHandler != nullptr)
+            {
+                request.mHandler(aError, results);
+            }
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method drops the cached results, the scan in progress is not affected.
+     *
+     */
+    void Invalidate(void) { mHasResults = false; }
+
+    /**
+     * This method indicates whether a scan is in progress.
+     *
+     * @retval TRUE   A scan is in progress.
+     * @retval FALSE  No scan is in progress.
+     *
+     */
+    bool IsScanning(void) const { return mScanning; }
+
+private:
+    struct Request
+    {
+        Handler       mHandler;
+        ResultHandler mResultHandler;
+    };
+
+    void ReplayResults(const ResultHandler &aResultHandler) const
+    {
+        VerifyOrExit(aResultHandler != nullptr);
+
+        for (const ResultType &result : mResults)
+        {
+            aResultHandler(result);
+        }
+
+    exit:
+        return;
+    }
+
+    Milliseconds            mMaxAge;
+    bool                    mScanning;
+    bool                    mHasResults;
+    uint32_t                mParameter;
+    Timepoint               mScanTime;
+    std::vector<ResultType> mResults;
+    std::vector<Request>    mRequests;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_SCAN_CACHE_HPP_
@@ -0,0 +1,257 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "SNAPSHOT"
+
+#include "utils/snapshot.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Utils {
+
+namespace {
+
+constexpr size_t kRecordAlignment = 4;
+
+size_t AlignRecordLength(size_t aLength)
+{
+    return (aLength + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+}
+
+uint32_t ComputeChecksum(const uint8_t *aData, size_t aLength)
+{
+    uint32_t checksum = 2166136261u;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        checksum = (checksum ^ aData[i]) * 16777619u;
+    }
+
+    return checksum;
+}
+
+otbrError WriteAll(int aFd, const void *aData, size_t aLength)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    const uint8_t *data  = static_cast<const uint8_t *>(aData);
+
+    while (aLength > 0)
+    {
+        ssize_t rval = write(aFd, data, aLength);
+
+        if (rval < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+        data += rval;
+        aLength -= static_cast<size_t>(rval);
+    }
+
+exit:
+    return error;
+}
+
+} // namespace
+
+constexpr uint32_t SnapshotHeader::kMagic;
+constexpr uint16_t SnapshotHeader::kVersion;
+
+void SnapshotWriter::AddRecord(uint16_t aType, const void *aValue, size_t aLength)
+{
+    SnapshotRecordHeader header;
+    size_t               offset = mRecords.size();
+
+    assert(aLength <= UINT16_MAX);
+
+    header.mType   = aType;
+    header.mLength = static_cast<uint16_t>(aLength);
+
+    mRecords.resize(offset + sizeof(header) + AlignRecordLength(aLength), 0);
+    memcpy(&mRecords[offset], &header, sizeof(header));
+
+    if (aLength > 0)
+    {
+        memcpy(&mRecords[offset + sizeof(header)], aValue, aLength);
+    }
+}
+
+otbrError SnapshotWriter::Save(const std::string &aPath) const
+{
+    otbrError      error   = OTBR_ERROR_NONE;
+    std::string    tmpPath = aPath + ".tmp";
+    SnapshotHeader header;
+    int            fd = -1;
+
+    memset(&header, 0, sizeof(header));
+    header.mMagic    = SnapshotHeader::kMagic;
+    header.mVersion  = SnapshotHeader::kVersion;
+    header.mSaveTime = static_cast<uint64_t>(time(nullptr));
+    header.mLength   = static_cast<uint32_t>(mRecords.size());
+    header.mChecksum = ComputeChecksum(mRecords.data(), mRecords.size());
+
+    fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = WriteAll(fd, &header, sizeof(header)));
+    SuccessOrExit(error = WriteAll(fd, mRecords.data(), mRecords.size()));
+    VerifyOrExit(fsync(fd) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(close(fd) == 0, fd = -1, error = OTBR_ERROR_ERRNO);
+    fd = -1;
+
+    VerifyOrExit(rename(tmpPath.c_str(), aPath.c_str()) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to save snapshot %s: %s", aPath.c_str(), strerror(errno));
+
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+
+        unlink(tmpPath.c_str());
+    }
+    else
+    {
+        otbrLogInfo("Saved snapshot %s: %zu bytes of records", aPath.c_str(), mRecords.size());
+    }
+
+    return error;
+}
+
+SnapshotReader::SnapshotReader(void)
+    : mData(nullptr)
+    , mSize(0)
+{
+}
+
+SnapshotReader::~SnapshotReader(void)
+{
+    Unmap();
+}
+
+otbrError SnapshotReader::Load(const std::string &aPath, Seconds aMaxAge)
+{
+    otbrError             error = OTBR_ERROR_NONE;
+    int                   fd    = -1;
+    struct stat           st;
+    void                 *data;
+    const SnapshotHeader *header;
+    uint64_t              now = static_cast<uint64_t>(time(nullptr));
+
+    Unmap();
+
+    fd = open(aPath.c_str(), O_RDONLY | O_CLOEXEC);
+    VerifyOrExit(fd >= 0, error = (errno == ENOENT) ? OTBR_ERROR_NOT_FOUND : OTBR_ERROR_ERRNO);
+    VerifyOrExit(fstat(fd, &st) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(static_cast<size_t>(st.st_size) >= sizeof(SnapshotHeader), error = OTBR_ERROR_PARSE);
+
+    data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    VerifyOrExit(data != MAP_FAILED, error = OTBR_ERROR_ERRNO);
+    mData = static_cast<const uint8_t *>(data);
+    mSize = static_cast<size_t>(st.st_size);
+
+    header = reinterpret_cast<const SnapshotHeader *>(mData);
+    VerifyOrExit(header->mMagic == SnapshotHeader::kMagic && header->mVersion == SnapshotHeader::kVersion,
+                 error = OTBR_ERROR_PARSE);
+    VerifyOrExit(header->mLength == mSize - sizeof(SnapshotHeader), error = OTBR_ERROR_PARSE);
+    VerifyOrExit(header->mChecksum == ComputeChecksum(mData + sizeof(SnapshotHeader), header->mLength),
+                 error = OTBR_ERROR_PARSE);
+    VerifyOrExit(header->mSaveTime <= now && now - header->mSaveTime <= static_cast<uint64_t>(aMaxAge.count()),
+                 error = OTBR_ERROR_PARSE);
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        Unmap();
+
+        if (error != OTBR_ERROR_NOT_FOUND)
+        {
+            otbrLogWarning("Ignored snapshot %s: %s", aPath.c_str(), otbrErrorString(error));
+        }
+    }
+
+    return error;
+}
+
+void SnapshotReader::ForEachRecord(uint16_t aType, const RecordHandler &aHandler) const
+{
+    size_t offset = sizeof(SnapshotHeader);
+
+    VerifyOrExit(mData != nullptr);
+
+    while (offset + sizeof(SnapshotRecordHeader) <= mSize)
+    {
+        SnapshotRecordHeader header;
+
+        memcpy(&header, mData + offset, sizeof(header));
+        offset += sizeof(header);
+
+        VerifyOrExit(header.mLength <= mSize - offset);
+
+        if (header.mType == aType)
+        {
+            aHandler(mData + offset, header.mLength);
+        }
+
+        offset += AlignRecordLength(header.mLength);
+    }
+
+exit:
+    return;
+}
+
+void SnapshotReader::Unmap(void)
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mData), mSize);
+        mData = nullptr;
+        mSize = 0;
+    }
+}
+
+} // namespace Utils
+} // namespace otbr
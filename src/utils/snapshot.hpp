@@ -0,0 +1,200 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the warm restart snapshot of the host state.
+ */
+
+#ifndef OTBR_UTILS_SNAPSHOT_HPP_
+#define OTBR_UTILS_SNAPSHOT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+#ifndef OTBR_WARM_RESTART_SNAPSHOT_FILE
+#define OTBR_WARM_RESTART_SNAPSHOT_FILE "/var/lib/thread/otbr-agent.snapshot"
+#endif
+
+#ifndef OTBR_WARM_RESTART_SNAPSHOT_MAX_AGE
+#define OTBR_WARM_RESTART_SNAPSHOT_MAX_AGE 600 // seconds
+#endif
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This enumeration defines the types of the snapshot records.
+ *
+ */
+enum SnapshotRecordType : uint16_t
+{
+    kSnapshotRecordTrelNetif    = 1, ///< The TREL network interface name.
+    kSnapshotRecordTrelPeer     = 2, ///< A TREL peer.
+    kSnapshotRecordDhcp6PdLease = 3, ///< A DHCPv6-PD lease.
+};
+
+/**
+ * This structure represents the header of a snapshot file.
+ *
+ * The header is followed by the records, each of which is a `SnapshotRecordHeader` followed by its value and padded
+ * to 4 bytes. All the fields are in the host byte order, since a snapshot is only loaded by the host saving it.
+ *
+ */
+struct SnapshotHeader
+{
+    static constexpr uint32_t kMagic   = 0x5342544f; ///< "OTBS" in little endian.
+    static constexpr uint16_t kVersion = 1;          ///< The version of the snapshot format.
+
+    uint32_t mMagic;    ///< The magic number.
+    uint16_t mVersion;  ///< The version of the snapshot format.
+    uint16_t mReserved; ///< Reserved, zero.
+    uint64_t mSaveTime; ///< The wall clock time the snapshot was saved, in seconds since the epoch.
+    uint32_t mLength;   ///< The length of the records in bytes.
+    uint32_t mChecksum; ///< The FNV-1a checksum of the records.
+};
+
+/**
+ * This structure represents the header of a snapshot record.
+ *
+ */
+struct SnapshotRecordHeader
+{
+    uint16_t mType;   ///< The record type.
+    uint16_t mLength; ///< The length of the value in bytes, excluding the padding.
+};
+
+/**
+ * This class implements the writer of a snapshot file.
+ *
+ */
+class SnapshotWriter : private NonCopyable
+{
+public:
+    /**
+     * This method adds a record.
+     *
+     * @param[in] aType    The record type.
+     * @param[in] aValue   A pointer to the record value.
+     * @param[in] aLength  The length of the record value, must not exceed `UINT16_MAX`.
+     *
+     */
+    void AddRecord(uint16_t aType, const void *aValue, size_t aLength);
+
+    /**
+     * This method saves the records to a snapshot file.
+     *
+     * The snapshot is written to a temporary file which then replaces the file, so that the file is never partially
+     * written.
+     *
+     * @param[in] aPath  The path of the snapshot file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully saved the snapshot.
+     * @retval OTBR_ERROR_ERRNO  Failed to write the snapshot file.
+     *
+     */
+    otbrError Save(const std::string &aPath) const;
+
+private:
+    std::vector<uint8_t> mRecords;
+};
+
+/**
+ * This class implements the reader of a snapshot file.
+ *
+ * The file is mapped to memory and the records are read in place.
+ *
+ */
+class SnapshotReader : private NonCopyable
+{
+public:
+    /**
+     * This function is called for each record of a type.
+     *
+     * @param[in] aValue   A pointer to the record value, valid until the reader is destroyed.
+     * @param[in] aLength  The length of the record value.
+     *
+     */
+    using RecordHandler = std::function<void(const uint8_t *aValue, uint16_t aLength)>;
+
+    /**
+     * The constructor initializes an empty reader.
+     *
+     */
+    SnapshotReader(void);
+
+    /**
+     * The destructor unmaps the snapshot file.
+     *
+     */
+    ~SnapshotReader(void);
+
+    /**
+     * This method loads a snapshot file.
+     *
+     * @param[in] aPath    The path of the snapshot file.
+     * @param[in] aMaxAge  The max age of the snapshot.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully loaded the snapshot.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no snapshot file.
+     * @retval OTBR_ERROR_ERRNO      Failed to map the snapshot file.
+     * @retval OTBR_ERROR_PARSE      The snapshot is of another version, corrupted or too old.
+     *
+     */
+    otbrError Load(const std::string &aPath, Seconds aMaxAge);
+
+    /**
+     * This method calls a handler for each record of a type, in the order they were added.
+     *
+     * @param[in] aType     The record type.
+     * @param[in] aHandler  The handler.
+     *
+     */
+    void ForEachRecord(uint16_t aType, const RecordHandler &aHandler) const;
+
+private:
+    void Unmap(void);
+
+    const uint8_t *mData;
+    size_t         mSize;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // OTBR_UTILS_SNAPSHOT_HPP_
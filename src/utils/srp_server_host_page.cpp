@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements listing the hosts of the SRP server page by page.
+ */
+
+#include "utils/srp_server_host_page.hpp"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <algorithm>
+
+#include <strings.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace agent {
+
+otbrError SrpServerHostPage::Get(otInstance        *aInstance,
+                                 const std::string &aCursor,
+                                 const std::string &aNamePrefix,
+                                 uint32_t           aMaxHosts,
+                                 std::vector<Host> &aHosts,
+                                 std::string       &aNextCursor)
+{
+    otbrError                            error    = OTBR_ERROR_NONE;
+    uint32_t                             maxHosts = std::min<uint32_t>(aMaxHosts, OTBR_SRP_SERVER_HOST_PAGE_MAX_HOSTS);
+    size_t                               services = 0;
+    const otSrpServerHost               *host     = nullptr;
+    std::vector<const otSrpServerHost *> selection;
+
+    aHosts.clear();
+    aNextCursor.clear();
+
+    VerifyOrExit(aMaxHosts > 0, error = OTBR_ERROR_INVALID_ARGS);
+
+    // The heap keeps the first hosts after the cursor seen so far, with the last of them at its front. One more host
+    // than the page is kept to tell whether there is a next page.
+    while ((host = otSrpServerGetNextHost(aInstance, host)) != nullptr)
+    {
+        const char *fullName = otSrpServerHostGetFullName(host);
+
+        if ((!aCursor.empty() && strcasecmp(fullName, aCursor.c_str()) <= 0) ||
+            strncasecmp(fullName, aNamePrefix.c_str(), aNamePrefix.size()) != 0)
+        {
+            continue;
+        }
+
+        selection.push_back(host);
+        std::push_heap(selection.begin(), selection.end(), IsBefore);
+
+        if (selection.size() > maxHosts + 1)
+        {
+            std::pop_heap(selection.begin(), selection.end(), IsBefore);
+            selection.pop_back();
+        }
+    }
+
+    std::sort_heap(selection.begin(), selection.end(), IsBefore);
+
+    // Only the hosts of the page are read, up to a bounded number of their services.
+    for (const otSrpServerHost *selected : selection)
+    {
+        Host pageHost;
+
+        if (aHosts.size() == maxHosts)
+        {
+            aNextCursor = aHosts.back().mFullName;
+            break;
+        }
+
+        pageHost = ReadHost(selected);
+
+        if (!aHosts.empty() && services + pageHost.mServices.size() > OTBR_SRP_SERVER_HOST_PAGE_MAX_SERVICES)
+        {
+            aNextCursor = aHosts.back().mFullName;
+            break;
+        }
+
+        services += pageHost.mServices.size();
+        aHosts.push_back(std::move(pageHost));
+    }
+
+exit:
+    return error;
+}
+
+bool SrpServerHostPage::IsBefore(const otSrpServerHost *aLhs, const otSrpServerHost *aRhs)
+{
+    return strcasecmp(otSrpServerHostGetFullName(aLhs), otSrpServerHostGetFullName(aRhs)) < 0;
+}
+
+SrpServerHostPage::Host SrpServerHostPage::ReadHost(const otSrpServerHost *aHost)
+{
+    Host                      host;
+    const otSrpServerService *service = nullptr;
+    const otIp6Address       *addresses;
+    uint8_t                   addressNum;
+    otSrpServerLeaseInfo      leaseInfo;
+
+    host.mFullName = otSrpServerHostGetFullName(aHost);
+    host.mDeleted  = otSrpServerHostIsDeleted(aHost);
+
+    addresses = otSrpServerHostGetAddresses(aHost, &addressNum);
+    for (uint8_t i = 0; i < addressNum; i++)
+    {
+        host.mAddresses.emplace_back(addresses[i]);
+    }
+
+    otSrpServerHostGetLeaseInfo(aHost, &leaseInfo);
+    host.mLease             = leaseInfo.mLease;
+    host.mKeyLease          = leaseInfo.mKeyLease;
+    host.mRemainingLease    = leaseInfo.mRemainingLease;
+    host.mRemainingKeyLease = leaseInfo.mRemainingKeyLease;
+
+    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    {
+        Service hostService;
+
+        otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
+        hostService.mFullName          = otSrpServerServiceGetInstanceName(service);
+        hostService.mDeleted           = otSrpServerServiceIsDeleted(service);
+        hostService.mPort              = otSrpServerServiceGetPort(service);
+        hostService.mPriority          = otSrpServerServiceGetPriority(service);
+        hostService.mWeight            = otSrpServerServiceGetWeight(service);
+        hostService.mLease             = leaseInfo.mLease;
+        hostService.mKeyLease          = leaseInfo.mKeyLease;
+        hostService.mRemainingLease    = leaseInfo.mRemainingLease;
+        hostService.mRemainingKeyLease = leaseInfo.mRemainingKeyLease;
+        host.mServices.push_back(std::move(hostService));
+    }
+
+    return host;
+}
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
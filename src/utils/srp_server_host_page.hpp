@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for listing the hosts of the SRP server page by page.
+ */
+
+#ifndef OTBR_UTILS_SRP_SERVER_HOST_PAGE_HPP_
+#define OTBR_UTILS_SRP_SERVER_HOST_PAGE_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/srp_server.h>
+
+#include "common/types.hpp"
+
+/**
+ * The maximum number of hosts in a page of the SRP server hosts.
+ *
+ */
+#ifndef OTBR_SRP_SERVER_HOST_PAGE_MAX_HOSTS
+#define OTBR_SRP_SERVER_HOST_PAGE_MAX_HOSTS 64
+#endif
+
+/**
+ * The maximum number of services in a page of the SRP server hosts, a page has at least one host regardless.
+ *
+ */
+#ifndef OTBR_SRP_SERVER_HOST_PAGE_MAX_SERVICES
+#define OTBR_SRP_SERVER_HOST_PAGE_MAX_SERVICES 256
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class lists the hosts of the SRP server and their services page by page.
+ *
+ * The hosts are listed in the case-insensitive order of their full names, and a page continues after the full name
+ * of the last host of the previous page. So a page is consistent even if hosts are added or removed meanwhile, and
+ * producing a page walks only the names of the hosts, the services are read only for the hosts of the page.
+ *
+ */
+class SrpServerHostPage
+{
+public:
+    /**
+     * This structure represents a service of an SRP host.
+     *
+     * The lease times are in milliseconds.
+     *
+     */
+    struct Service
+    {
+        std::string mFullName;          ///< The full name of the service instance.
+        bool        mDeleted;           ///< Whether the service is deleted.
+        uint16_t    mPort;              ///< The port of the service.
+        uint16_t    mPriority;          ///< The priority of the service.
+        uint16_t    mWeight;            ///< The weight of the service.
+        uint32_t    mLease;             ///< The lease time of the service.
+        uint32_t    mKeyLease;          ///< The key lease time of the service.
+        uint32_t    mRemainingLease;    ///< The remaining lease time of the service.
+        uint32_t    mRemainingKeyLease; ///< The remaining key lease time of the service.
+    };
+
+    /**
+     * This structure represents a host of the SRP server.
+     *
+     * The lease times are in milliseconds.
+     *
+     */
+    struct Host
+    {
+        std::string             mFullName;          ///< The full name of the host.
+        bool                    mDeleted;           ///< Whether the host is deleted.
+        std::vector<Ip6Address> mAddresses;         ///< The addresses of the host.
+        uint32_t                mLease;             ///< The lease time of the host.
+        uint32_t                mKeyLease;          ///< The key lease time of the host.
+        uint32_t                mRemainingLease;    ///< The remaining lease time of the host.
+        uint32_t                mRemainingKeyLease; ///< The remaining key lease time of the host.
+        std::vector<Service>    mServices;          ///< The services of the host.
+    };
+
+    /**
+     * This method gets a page of the hosts of the SRP server.
+     *
+     * @param[in]  aInstance    A pointer to the OpenThread instance.
+     * @param[in]  aCursor      The full name of the last host of the previous page, or empty for the first page.
+     * @param[in]  aNamePrefix  Only the hosts whose full names start with this prefix are listed, case-insensitively.
+     * @param[in]  aMaxHosts    The maximum number of hosts of the page, at most `OTBR_SRP_SERVER_HOST_PAGE_MAX_HOSTS`.
+     * @param[out] aHosts       The hosts of the page.
+     * @param[out] aNextCursor  The cursor of the next page, or empty if this is the last page.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully got the page.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aMaxHosts is zero.
+     *
+     */
+    static otbrError Get(otInstance        *aInstance,
+                         const std::string &aCursor,
+                         const std::string &aNamePrefix,
+                         uint32_t           aMaxHosts,
+                         std::vector<Host> &aHosts,
+                         std::string       &aNextCursor);
+
+private:
+    static bool IsBefore(const otSrpServerHost *aLhs, const otSrpServerHost *aRhs);
+    static Host ReadHost(const otSrpServerHost *aHost);
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#endif // OTBR_UTILS_SRP_SERVER_HOST_PAGE_HPP_
@@ -0,0 +1,309 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements maintaining the statistics of the SRP server.
+ */
+
+#define OTBR_LOG_TAG "SRPSTAT"
+
+#include "utils/srp_server_stats.hpp"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+// Returns the monotonic time in milliseconds, to which the remaining leases are added.
+static int64_t GetNow(void)
+{
+    return MainloopClock::Now().time_since_epoch() / Milliseconds(1);
+}
+
+SrpServerStats::SrpServerStats(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mTracking(false)
+    , mValid(false)
+    , mNextCheckTime(0)
+    , mRebuildCount(0)
+    , mTotals()
+    , mStats()
+{
+}
+
+void SrpServerStats::SetTracking(bool aTracking)
+{
+    mTracking = aTracking;
+    mValid    = false;
+    mHosts.clear();
+    mStaleHosts.clear();
+    mExpireTimes.clear();
+}
+
+void SrpServerStats::MarkHostStale(const std::string &aFullHostName)
+{
+    VerifyOrExit(mTracking && mValid);
+
+    mStaleHosts.insert(aFullHostName);
+
+exit:
+    return;
+}
+
+const SrpServerStats::Stats &SrpServerStats::Get(void)
+{
+    int64_t now = GetNow();
+
+    if (!mTracking || !mValid || now >= mNextCheckTime)
+    {
+        Rebuild(now);
+    }
+    else
+    {
+        // The hosts with expired leases are read again, so that a lease only counts until it expires.
+        while (!mExpireTimes.empty() && mExpireTimes.begin()->first < now)
+        {
+            mStaleHosts.insert(mExpireTimes.begin()->second);
+            mExpireTimes.erase(mExpireTimes.begin());
+        }
+
+        if (!mStaleHosts.empty())
+        {
+            UpdateStaleHosts(now);
+        }
+    }
+
+    mStats.mHosts    = ToCounts(mTotals.mHost, now);
+    mStats.mServices = ToCounts(mTotals.mServices, now);
+
+    return mStats;
+}
+
+void SrpServerStats::Rebuild(int64_t aNow)
+{
+    const otSrpServerHost *host     = nullptr;
+    bool                   checking = mTracking && mValid;
+    HostTotals             previous = mTotals;
+
+    mHosts.clear();
+    mStaleHosts.clear();
+    mExpireTimes.clear();
+    mTotals = HostTotals();
+
+    while ((host = otSrpServerGetNextHost(mInstance, host)) != nullptr)
+    {
+        HostTotals hostTotals = ReadHost(host, aNow);
+
+        mTotals.mHost.Add(hostTotals.mHost);
+        mTotals.mServices.Add(hostTotals.mServices);
+
+        if (mTracking)
+        {
+            mHosts[otSrpServerHostGetFullName(host)] = hostTotals;
+            mExpireTimes.emplace(hostTotals.mFirstExpireTime, otSrpServerHostGetFullName(host));
+        }
+    }
+
+    if (checking && !(previous.mHost == mTotals.mHost && previous.mServices == mTotals.mServices))
+    {
+        otbrLogWarning("The maintained statistics of %u hosts and %u services are inconsistent, rebuilt",
+                       mTotals.mHost.mFreshCount + mTotals.mHost.mDeletedCount,
+                       mTotals.mServices.mFreshCount + mTotals.mServices.mDeletedCount);
+    }
+
+    mValid         = true;
+    mNextCheckTime = aNow + OTBR_SRP_SERVER_STATS_CHECK_INTERVAL;
+    mRebuildCount++;
+}
+
+void SrpServerStats::UpdateStaleHosts(int64_t aNow)
+{
+    const otSrpServerHost *host = nullptr;
+
+    // Only the hosts are walked to find the stale ones, the services of the other hosts are not.
+    while (!mStaleHosts.empty() && (host = otSrpServerGetNextHost(mInstance, host)) != nullptr)
+    {
+        auto it = mStaleHosts.find(otSrpServerHostGetFullName(host));
+
+        if (it != mStaleHosts.end())
+        {
+            SetHost(*it, ReadHost(host, aNow));
+            mStaleHosts.erase(it);
+        }
+    }
+
+    // The stale hosts not found have been removed by the SRP server.
+    for (const std::string &fullHostName : mStaleHosts)
+    {
+        RemoveHost(fullHostName);
+    }
+    mStaleHosts.clear();
+}
+
+void SrpServerStats::SetHost(const std::string &aFullHostName, const HostTotals &aHostTotals)
+{
+    auto        result     = mHosts.emplace(aFullHostName, HostTotals());
+    HostTotals &hostTotals = result.first->second;
+
+    if (!result.second)
+    {
+        mTotals.mHost.Subtract(hostTotals.mHost);
+        mTotals.mServices.Subtract(hostTotals.mServices);
+        mExpireTimes.erase({hostTotals.mFirstExpireTime, aFullHostName});
+    }
+
+    hostTotals = aHostTotals;
+    mTotals.mHost.Add(hostTotals.mHost);
+    mTotals.mServices.Add(hostTotals.mServices);
+    mExpireTimes.emplace(hostTotals.mFirstExpireTime, aFullHostName);
+}
+
+void SrpServerStats::RemoveHost(const std::string &aFullHostName)
+{
+    auto it = mHosts.find(aFullHostName);
+
+    VerifyOrExit(it != mHosts.end());
+
+    mTotals.mHost.Subtract(it->second.mHost);
+    mTotals.mServices.Subtract(it->second.mServices);
+    mExpireTimes.erase({it->second.mFirstExpireTime, aFullHostName});
+    mHosts.erase(it);
+
+exit:
+    return;
+}
+
+SrpServerStats::HostTotals SrpServerStats::ReadHost(const otSrpServerHost *aHost, int64_t aNow)
+{
+    HostTotals                hostTotals = HostTotals();
+    const otSrpServerService *service    = nullptr;
+    otSrpServerLeaseInfo      leaseInfo;
+
+    hostTotals.mFirstExpireTime = INT64_MAX;
+
+    otSrpServerHostGetLeaseInfo(aHost, &leaseInfo);
+    hostTotals.mHost.Add(leaseInfo, otSrpServerHostIsDeleted(aHost), aNow);
+    UpdateFirstExpireTime(hostTotals, leaseInfo, otSrpServerHostIsDeleted(aHost), aNow);
+
+    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    {
+        otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
+        hostTotals.mServices.Add(leaseInfo, otSrpServerServiceIsDeleted(service), aNow);
+        UpdateFirstExpireTime(hostTotals, leaseInfo, otSrpServerServiceIsDeleted(service), aNow);
+    }
+
+    return hostTotals;
+}
+
+void SrpServerStats::UpdateFirstExpireTime(HostTotals                 &aHostTotals,
+                                           const otSrpServerLeaseInfo &aLeaseInfo,
+                                           bool                        aIsDeleted,
+                                           int64_t                     aNow)
+{
+    VerifyOrExit(!aIsDeleted);
+
+    aHostTotals.mFirstExpireTime =
+        std::min({aHostTotals.mFirstExpireTime, aNow + static_cast<int64_t>(aLeaseInfo.mRemainingLease),
+                  aNow + static_cast<int64_t>(aLeaseInfo.mRemainingKeyLease)});
+
+exit:
+    return;
+}
+
+SrpServerStats::Counts SrpServerStats::ToCounts(const Totals &aTotals, int64_t aNow)
+{
+    Counts  counts;
+    int64_t nowTotal          = static_cast<int64_t>(aTotals.mFreshCount) * aNow;
+    int64_t remainingLease    = aTotals.mExpireTimeTotal - nowTotal;
+    int64_t remainingKeyLease = aTotals.mKeyExpireTimeTotal - nowTotal;
+
+    counts.mFreshCount        = aTotals.mFreshCount;
+    counts.mDeletedCount      = aTotals.mDeletedCount;
+    counts.mLeaseTimeTotal    = aTotals.mLeaseTimeTotal;
+    counts.mKeyLeaseTimeTotal = aTotals.mKeyLeaseTimeTotal;
+
+    // The hosts are read again once one of their leases expires, the totals are never negative then.
+    counts.mRemainingLeaseTimeTotal    = static_cast<uint64_t>(std::max<int64_t>(remainingLease, 0));
+    counts.mRemainingKeyLeaseTimeTotal = static_cast<uint64_t>(std::max<int64_t>(remainingKeyLease, 0));
+
+    return counts;
+}
+
+void SrpServerStats::Totals::Add(const otSrpServerLeaseInfo &aLeaseInfo, bool aIsDeleted, int64_t aNow)
+{
+    if (aIsDeleted)
+    {
+        mDeletedCount++;
+    }
+    else
+    {
+        mFreshCount++;
+        mLeaseTimeTotal += aLeaseInfo.mLease;
+        mKeyLeaseTimeTotal += aLeaseInfo.mKeyLease;
+        mExpireTimeTotal += aNow + static_cast<int64_t>(aLeaseInfo.mRemainingLease);
+        mKeyExpireTimeTotal += aNow + static_cast<int64_t>(aLeaseInfo.mRemainingKeyLease);
+    }
+}
+
+void SrpServerStats::Totals::Add(const Totals &aTotals)
+{
+    mFreshCount += aTotals.mFreshCount;
+    mDeletedCount += aTotals.mDeletedCount;
+    mLeaseTimeTotal += aTotals.mLeaseTimeTotal;
+    mKeyLeaseTimeTotal += aTotals.mKeyLeaseTimeTotal;
+    mExpireTimeTotal += aTotals.mExpireTimeTotal;
+    mKeyExpireTimeTotal += aTotals.mKeyExpireTimeTotal;
+}
+
+void SrpServerStats::Totals::Subtract(const Totals &aTotals)
+{
+    mFreshCount -= aTotals.mFreshCount;
+    mDeletedCount -= aTotals.mDeletedCount;
+    mLeaseTimeTotal -= aTotals.mLeaseTimeTotal;
+    mKeyLeaseTimeTotal -= aTotals.mKeyLeaseTimeTotal;
+    mExpireTimeTotal -= aTotals.mExpireTimeTotal;
+    mKeyExpireTimeTotal -= aTotals.mKeyExpireTimeTotal;
+}
+
+bool SrpServerStats::Totals::operator==(const Totals &aOther) const
+{
+    // The expiry times are not compared, they vary with the rounding of the remaining leases.
+    return mFreshCount == aOther.mFreshCount && mDeletedCount == aOther.mDeletedCount &&
+           mLeaseTimeTotal == aOther.mLeaseTimeTotal && mKeyLeaseTimeTotal == aOther.mKeyLeaseTimeTotal;
+}
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
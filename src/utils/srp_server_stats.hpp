@@ -0,0 +1,208 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for maintaining the statistics of the SRP server.
+ */
+
+#ifndef OTBR_UTILS_SRP_SERVER_STATS_HPP_
+#define OTBR_UTILS_SRP_SERVER_STATS_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/srp_server.h>
+
+#include "common/time.hpp"
+
+/**
+ * The interval (in milliseconds) between two full walks of the SRP server checking the incrementally maintained
+ * statistics.
+ *
+ */
+#ifndef OTBR_SRP_SERVER_STATS_CHECK_INTERVAL
+#define OTBR_SRP_SERVER_STATS_CHECK_INTERVAL 60000
+#endif
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class maintains the registration statistics of the SRP server, the counts of the fresh and deleted hosts and
+ * services and the totals of their leases.
+ *
+ * While it's tracking, the statistics are maintained per host, and only the hosts marked as stale by the Advertising
+ * Proxy, which sees every update and lease expiry of the SRP server, and the hosts with a lease expired since they
+ * were read are read again. The services of the other hosts are not walked. All hosts are walked again every `OTBR_SRP_SERVER_STATS_CHECK_INTERVAL` milliseconds to check the
+ * statistics. Without tracking, all hosts and services are walked for each request of the statistics.
+ *
+ */
+class SrpServerStats
+{
+public:
+    /**
+     * This structure represents the statistics of the SRP hosts or services.
+     *
+     * The lease times are in milliseconds.
+     *
+     */
+    struct Counts
+    {
+        uint32_t mFreshCount;                 ///< The number of fresh hosts or services.
+        uint32_t mDeletedCount;               ///< The number of deleted hosts or services.
+        uint64_t mLeaseTimeTotal;             ///< The total lease time of the fresh ones.
+        uint64_t mKeyLeaseTimeTotal;          ///< The total key lease time of the fresh ones.
+        uint64_t mRemainingLeaseTimeTotal;    ///< The total remaining lease time of the fresh ones.
+        uint64_t mRemainingKeyLeaseTimeTotal; ///< The total remaining key lease time of the fresh ones.
+    };
+
+    /**
+     * This structure represents the statistics of the SRP server.
+     *
+     */
+    struct Stats
+    {
+        Counts mHosts;    ///< The statistics of the hosts.
+        Counts mServices; ///< The statistics of the services.
+    };
+
+    /**
+     * The constructor of the SRP server statistics.
+     *
+     * @param[in] aInstance  A pointer to the OpenThread instance.
+     *
+     */
+    explicit SrpServerStats(otInstance *aInstance);
+
+    /**
+     * This method starts or stops tracking the hosts marked as stale.
+     *
+     * The statistics are rebuilt on the next request when tracking is started.
+     *
+     * @param[in] aTracking  Whether the updated hosts are marked as stale with `MarkHostStale()`.
+     *
+     */
+    void SetTracking(bool aTracking);
+
+    /**
+     * This method marks a host as stale, it's read again on the next request of the statistics.
+     *
+     * A host is marked when an SRP update or a lease expiry of it is received, and again once an update is committed.
+     *
+     * @param[in] aFullHostName  The full name of the host.
+     *
+     */
+    void MarkHostStale(const std::string &aFullHostName);
+
+    /**
+     * This method invalidates the statistics, e.g. after a reset of the OpenThread instance.
+     *
+     */
+    void Invalidate(void) { mValid = false; }
+
+    /**
+     * This method returns the statistics of the SRP server.
+     *
+     * The returned reference is valid until the next call of this method.
+     *
+     * @returns The statistics of the SRP server.
+     *
+     */
+    const Stats &Get(void);
+
+    /**
+     * This method returns the number of times the statistics have been rebuilt by walking all hosts and services.
+     *
+     * @returns The number of rebuilds.
+     *
+     */
+    uint32_t GetRebuildCount(void) const { return mRebuildCount; }
+
+private:
+    // The statistics of some hosts or services, the remaining leases are kept as the totals of their expiry times.
+    struct Totals
+    {
+        uint32_t mFreshCount;
+        uint32_t mDeletedCount;
+        uint64_t mLeaseTimeTotal;
+        uint64_t mKeyLeaseTimeTotal;
+        int64_t  mExpireTimeTotal;
+        int64_t  mKeyExpireTimeTotal;
+
+        void Add(const otSrpServerLeaseInfo &aLeaseInfo, bool aIsDeleted, int64_t aNow);
+        void Add(const Totals &aTotals);
+        void Subtract(const Totals &aTotals);
+        bool operator==(const Totals &aOther) const;
+    };
+
+    struct HostTotals
+    {
+        Totals  mHost;
+        Totals  mServices;
+        int64_t mFirstExpireTime; ///< The earliest expiry of the fresh leases, INT64_MAX if there is none.
+    };
+
+    static HostTotals ReadHost(const otSrpServerHost *aHost, int64_t aNow);
+    static void       UpdateFirstExpireTime(HostTotals                 &aHostTotals,
+                                            const otSrpServerLeaseInfo &aLeaseInfo,
+                                            bool                        aIsDeleted,
+                                            int64_t                     aNow);
+    static Counts     ToCounts(const Totals &aTotals, int64_t aNow);
+    void              Rebuild(int64_t aNow);
+    void              UpdateStaleHosts(int64_t aNow);
+    void              SetHost(const std::string &aFullHostName, const HostTotals &aHostTotals);
+    void              RemoveHost(const std::string &aFullHostName);
+
+    otInstance                                 *mInstance;
+    bool                                        mTracking;
+    bool                                        mValid;
+    int64_t                                     mNextCheckTime;
+    uint32_t                                    mRebuildCount;
+    std::unordered_map<std::string, HostTotals> mHosts;
+    std::unordered_set<std::string>             mStaleHosts;
+    std::set<std::pair<int64_t, std::string>>   mExpireTimes; ///< The tracked hosts by their first expiry time.
+    HostTotals                                  mTotals;
+    Stats                                       mStats;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#endif // OTBR_UTILS_SRP_SERVER_STATS_HPP_
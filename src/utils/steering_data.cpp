@@ -46,35 +46,39 @@ void SteeringData::Init(uint8_t aLength)
 
 void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
 {
-    const size_t           kSizeHashSha256Output = 32;
-    const size_t           kSizeEui64            = 8;
-    uint8_t                hash[kSizeHashSha256Output];
-    mbedtls_sha256_context sha256;
+    const size_t kSizeHashSha256Output = 32;
+    const size_t kSizeEui64            = 8;
+    uint8_t      hash[kSizeHashSha256Output];
 
-    mbedtls_sha256_init(&sha256);
-    mbedtls_sha256_starts(&sha256, 0);
-    mbedtls_sha256_update(&sha256, aEui64, kSizeEui64);
-    mbedtls_sha256_finish(&sha256, hash);
+    mbedtls_sha256(aEui64, kSizeEui64, hash, /* is224 */ 0);
 
     memcpy(aJoinerId, hash, kSizeJoinerId);
     aJoinerId[0] |= 2;
 }
 
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
+{
+    ComputeBloomFilter(aJoinerId, 1);
+}
+
+void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerIds, uint16_t aNumJoinerIds)
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
+    for (uint16_t i = 0; i < aNumJoinerIds; i++)
     {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+        const uint8_t *joinerId = aJoinerIds + i * kSizeJoinerId;
+
+        ccitt.Init();
+        ansi.Init();
+        ccitt.Update(joinerId, kSizeJoinerId);
+        ansi.Update(joinerId, kSizeJoinerId);
 
-    SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
-    SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+        SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
+        SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+    }
 }
 
 } // namespace otbr
@@ -90,6 +90,15 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method computes the Bloom Filter of multiple joiners.
+     *
+     * @param[in] aJoinerIds     A pointer to the joiner ids, each of kSizeJoinerId bytes, stored contiguously.
+     * @param[in] aNumJoinerIds  The number of joiner ids.
+     *
+     */
+    void ComputeBloomFilter(const uint8_t *aJoinerIds, uint16_t aNumJoinerIds);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -38,7 +38,14 @@ namespace StringUtils {
 
 bool EqualCaseInsensitive(const std::string &aString1, const std::string &aString2)
 {
-    return ToLowercase(aString1) == ToLowercase(aString2);
+    return EqualCaseInsensitive(aString1.data(), aString1.size(), aString2.data(), aString2.size());
+}
+
+bool EqualCaseInsensitive(const char *aString1, size_t aLength1, const char *aString2, size_t aLength2)
+{
+    return aLength1 == aLength2 && std::equal(aString1, aString1 + aLength1, aString2, [](char aChar1, char aChar2) {
+               return std::tolower(aChar1) == std::tolower(aChar2);
+           });
 }
 
 std::string ToLowercase(const std::string &aString)
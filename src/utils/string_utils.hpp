@@ -54,6 +54,19 @@ namespace StringUtils {
  */
 bool EqualCaseInsensitive(const std::string &aString1, const std::string &aString2);
 
+/**
+ * This function compares two character sequences in a case-insensitive manner, without copying them.
+ *
+ * @param[in] aString1  A pointer to the first character sequence.
+ * @param[in] aLength1  The length of the first character sequence.
+ * @param[in] aString2  A pointer to the second character sequence.
+ * @param[in] aLength2  The length of the second character sequence.
+ *
+ * @returns  Whether the two character sequences are equal in a case-insensitive manner.
+ *
+ */
+bool EqualCaseInsensitive(const char *aString1, size_t aLength1, const char *aString2, size_t aLength2);
+
 /**
  * This function converts a given string to lowercase.
  *
@@ -64,33 +64,29 @@
 #endif
 #include <net/if.h>
 #include <openthread/platform/radio.h>
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING && __linux__
+#include <errno.h>
+#include <unistd.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#endif
 
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/memory_stats.hpp"
+#include "common/startup_stats.hpp"
 #include "common/tlv.hpp"
 #include "ncp/rcp_host.hpp"
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+#include "utils/socket_utils.hpp"
+#endif
 
 namespace otbr {
 namespace agent {
 namespace {
-const Tlv *FindTlv(uint8_t aTlvType, const uint8_t *aTlvs, int aTlvsSize)
-{
-    const Tlv *result = nullptr;
-
-    for (const Tlv *tlv = reinterpret_cast<const Tlv *>(aTlvs);
-         reinterpret_cast<const uint8_t *>(tlv) + sizeof(Tlv) < aTlvs + aTlvsSize; tlv = tlv->GetNext())
-    {
-        if (tlv->GetType() == aTlvType)
-        {
-            ExitNow(result = tlv);
-        }
-    }
-
-exit:
-    return result;
-}
-
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 static uint32_t TelemetryNodeTypeFromRoleAndLinkMode(const otDeviceRole &aRole, const otLinkModeConfig &aLinkModeCfg)
 {
@@ -225,13 +221,145 @@ void CopyMdnsResponseCounters(const MdnsResponseCounters &from, threadnetwork::T
     to->set_aborted_count(from.mAborted);
     to->set_invalid_state_count(from.mInvalidState);
 }
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+void CopyMainloopHistogram(const MainloopHistogram &from, threadnetwork::TelemetryData_MainloopHistogram *to)
+{
+    for (uint8_t i = 0; i < MainloopHistogram::kNumBuckets; i++)
+    {
+        to->add_bucket_counts(from.GetBucketCount(i));
+    }
+    to->set_count(from.GetCount());
+    to->set_sum_us(from.GetSum());
+    to->set_max_us(from.GetMax());
+}
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+void CopyLinkMetricsPercentiles(const LinkMetricsHistory                           &aHistory,
+                                LinkMetricsHistory::Metric                          aMetric,
+                                threadnetwork::TelemetryData_LinkMetricsPercentiles *aPercentiles)
+{
+    aPercentiles->set_p10(aHistory.GetPercentile(aMetric, 10));
+    aPercentiles->set_p50(aHistory.GetPercentile(aMetric, 50));
+    aPercentiles->set_p90(aHistory.GetPercentile(aMetric, 90));
+}
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
+
+void CopyTelemetrySections(const threadnetwork::TelemetryData &aFrom,
+                           threadnetwork::TelemetryData       &aTo,
+                           uint32_t                            aSections)
+{
+    if (aSections & ThreadHelper::kTelemetryWpanStats)
+    {
+        aTo.clear_wpan_stats();
+        if (aFrom.has_wpan_stats())
+        {
+            *aTo.mutable_wpan_stats() = aFrom.wpan_stats();
+        }
+    }
+
+    if (aSections & ThreadHelper::kTelemetryTopology)
+    {
+        aTo.clear_wpan_topo_full();
+        if (aFrom.has_wpan_topo_full())
+        {
+            *aTo.mutable_wpan_topo_full() = aFrom.wpan_topo_full();
+        }
+        *aTo.mutable_topo_entries() = aFrom.topo_entries();
+    }
+
+    if (aSections & ThreadHelper::kTelemetryBorderRouter)
+    {
+        aTo.clear_wpan_border_router();
+        if (aFrom.has_wpan_border_router())
+        {
+            *aTo.mutable_wpan_border_router() = aFrom.wpan_border_router();
+        }
+    }
+
+    if (aSections & ThreadHelper::kTelemetryRcp)
+    {
+        aTo.clear_wpan_rcp();
+        if (aFrom.has_wpan_rcp())
+        {
+            *aTo.mutable_wpan_rcp() = aFrom.wpan_rcp();
+        }
+        aTo.clear_coex_metrics();
+        if (aFrom.has_coex_metrics())
+        {
+            *aTo.mutable_coex_metrics() = aFrom.coex_metrics();
+        }
+    }
+
+    if (aSections & ThreadHelper::kTelemetryLowPowerMetrics)
+    {
+        aTo.clear_low_power_metrics();
+        if (aFrom.has_low_power_metrics())
+        {
+            *aTo.mutable_low_power_metrics() = aFrom.low_power_metrics();
+        }
+    }
+
+    if (aSections & ThreadHelper::kTelemetryMainloopStats)
+    {
+        aTo.clear_mainloop_stats();
+        if (aFrom.has_mainloop_stats())
+        {
+            *aTo.mutable_mainloop_stats() = aFrom.mainloop_stats();
+        }
+    }
+
+    if (aSections & ThreadHelper::kTelemetryStartupStats)
+    {
+        aTo.clear_startup_stats();
+        if (aFrom.has_startup_stats())
+        {
+            *aTo.mutable_startup_stats() = aFrom.startup_stats();
+        }
+    }
+
+    if (aSections & ThreadHelper::kTelemetryMemoryStats)
+    {
+        aTo.clear_memory_stats();
+        if (aFrom.has_memory_stats())
+        {
+            *aTo.mutable_memory_stats() = aFrom.memory_stats();
+        }
+    }
+}
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
 } // namespace
 
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::RcpHost *aHost)
     : mInstance(aInstance)
     , mHost(aHost)
+    , mScanCache(Milliseconds(OTBR_THREAD_HELPER_SCAN_CACHE_MS))
+    , mEnergyScanCache(Milliseconds(OTBR_THREAD_HELPER_SCAN_CACHE_MS))
+    , mNetworkDataCache(aInstance)
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    , mSrpServerStats(aInstance)
+#endif
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    , mLinkMetricsSampler(aInstance)
+#endif
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    , mChannelMonitorSampler(aInstance)
+#endif
+    , mRadioCoexSampler(aInstance)
+#if OTBR_ENABLE_DHCP6_PD
+    , mDhcp6PdLeaseKeeper(aInstance)
+#endif
 {
+    // The radio coex metrics don't depend on the Thread role, they are read in the background for the queries.
+    mRadioCoexSampler.Start();
+
+#if OTBR_ENABLE_DHCP6_PD
+    // The kept DHCPv6-PD lease is restored as soon as a prefix is requested, even without a D-Bus client.
+    otBorderRoutingDhcp6PdSetRequestCallback(mInstance, &ThreadHelper::BorderRoutingDhcp6PdCallback, this);
+    mDhcp6PdLeaseKeeper.HandlePdStateChanged(otBorderRoutingDhcp6PdGetState(mInstance));
+#endif
 #if OTBR_ENABLE_TELEMETRY_DATA_API && (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
     otError error;
 
@@ -245,12 +373,143 @@ exit:
 #endif
 }
 
+ThreadHelper::~ThreadHelper(void)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    if (mInfraLinkNetlinkFd != -1)
+    {
+        close(mInfraLinkNetlinkFd);
+    }
+#endif
+}
+
+void ThreadHelper::InvalidateCaches(otChangedFlags aFlags)
+{
+    mNetworkDataCache.HandleStateChanged(aFlags);
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    // The peer border routers are the routers of the infra link which are also in the network data.
+    if (aFlags & (OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_ROLE))
+    {
+        mPeerBrCountValid = false;
+    }
+#endif
+}
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+void ThreadHelper::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mInfraLinkNetlinkFd != -1);
+
+    FD_SET(mInfraLinkNetlinkFd, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(mInfraLinkNetlinkFd, aMainloop.mMaxFd);
+
+exit:
+    return;
+}
+
+void ThreadHelper::Process(const MainloopContext &aMainloop)
+{
+    if (mInfraLinkNetlinkFd != -1 && FD_ISSET(mInfraLinkNetlinkFd, &aMainloop.mReadFdSet))
+    {
+        ReceiveInfraLinkNetlinkMessages();
+    }
+}
+
+void ThreadHelper::ReceiveInfraLinkNetlinkMessages(void)
+{
+#if __linux__
+    const size_t kMaxNetLinkBufSize = 8192;
+    ssize_t      len;
+    union
+    {
+        nlmsghdr mHeader;
+        uint8_t  mBuffer[kMaxNetLinkBufSize];
+    } msgBuffer;
+
+    while ((len = recv(mInfraLinkNetlinkFd, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), MSG_DONTWAIT)) != 0)
+    {
+        if (len < 0)
+        {
+            // The events which didn't fit in the socket buffer are lost, so the cache can't be trusted anymore.
+            if (errno == ENOBUFS)
+            {
+                mInfraLinkInfoValid = false;
+                continue;
+            }
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR,
+                         otbrLogWarning("Failed to receive netlink message: %s", strerror(errno)));
+            ExitNow();
+        }
+
+        for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header                  = NLMSG_NEXT(header, len))
+        {
+            switch (header->nlmsg_type)
+            {
+            case RTM_NEWLINK:
+            case RTM_DELLINK:
+                // The infra link may have been created again with another index.
+                mInfraLinkInfoValid = false;
+                break;
+            case RTM_NEWADDR:
+            case RTM_DELADDR:
+                if (mInfraLinkIndex == 0 ||
+                    reinterpret_cast<const ifaddrmsg *>(NLMSG_DATA(header))->ifa_index == mInfraLinkIndex)
+                {
+                    mInfraLinkInfoValid = false;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+exit:
+    return;
+#endif
+}
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+
 void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
 {
+#if OTBR_ENABLE_DHCP6_PD
+    mDhcp6PdLeaseKeeper.HandleStateChanged(aFlags);
+#endif
+
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
         otDeviceRole role = mHost->GetDeviceRole();
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+        // The cached tables describe the previous role.
+        mTelemetryCachedSections = 0;
+#endif
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+        if (role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED)
+        {
+            mLinkMetricsSampler.Stop();
+        }
+        else
+        {
+            mLinkMetricsSampler.Start();
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        // The channel monitor keeps sampling while detached, the history survives a disabled period.
+        if (role == OT_DEVICE_ROLE_DISABLED)
+        {
+            mChannelMonitorSampler.Stop();
+        }
+        else
+        {
+            mChannelMonitorSampler.Start();
+        }
+#endif
+
         for (const auto &handler : mDeviceRoleHandlers)
         {
             handler(role);
@@ -315,11 +574,17 @@ void ThreadHelper::ActiveDatasetChangedCallback()
     otError                  error;
     otOperationalDatasetTlvs datasetTlvs;
 
-    SuccessOrExit(error = otDatasetGetActiveTlvs(mInstance, &datasetTlvs));
+    // The dataset is notified again once it's set after being cleared.
+    SuccessOrExit(error = otDatasetGetActiveTlvs(mInstance, &datasetTlvs), mActiveDatasetTlvs.mLength = 0);
+
+    // OpenThread also raises the flag without the TLVs changing.
+    VerifyOrExit(datasetTlvs.mLength != mActiveDatasetTlvs.mLength ||
+                 memcmp(datasetTlvs.mTlvs, mActiveDatasetTlvs.mTlvs, datasetTlvs.mLength) != 0);
+    mActiveDatasetTlvs = datasetTlvs;
 
     for (const auto &handler : mActiveDatasetChangeHandlers)
     {
-        handler(datasetTlvs);
+        handler(mActiveDatasetTlvs);
     }
 
 exit:
@@ -348,13 +613,13 @@ void ThreadHelper::AddDeviceRoleHandler(DeviceRoleHandler aHandler)
     mDeviceRoleHandlers.emplace_back(aHandler);
 }
 
-void ThreadHelper::Scan(ScanHandler aHandler)
+void ThreadHelper::Scan(ScanHandler aHandler, ScanResultHandler aResultHandler)
 {
     otError error = OT_ERROR_NONE;
 
-    VerifyOrExit(aHandler != nullptr);
-    mScanHandler = aHandler;
-    mScanResults.clear();
+    VerifyOrExit(aHandler != nullptr || aResultHandler != nullptr);
+    VerifyOrExit(mScanCache.AddRequest(/* aParameter */ 0, std::move(aHandler), std::move(aResultHandler),
+                                       Clock::now()) == ActiveScanCache::kStartScan);
 
     error =
         otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0, &ThreadHelper::ActiveScanHandler, this);
@@ -362,23 +627,23 @@ void ThreadHelper::Scan(ScanHandler aHandler)
 exit:
     if (error != OT_ERROR_NONE)
     {
-        if (aHandler)
-        {
-            mScanHandler(error, {});
-        }
-        mScanHandler = nullptr;
+        mScanCache.HandleDone(error);
     }
 }
 
-void ThreadHelper::EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler)
+void ThreadHelper::EnergyScan(uint32_t                aScanDuration,
+                              EnergyScanHandler       aHandler,
+                              EnergyScanResultHandler aResultHandler)
 {
-    otError  error             = OT_ERROR_NONE;
-    uint32_t preferredChannels = otPlatRadioGetPreferredChannelMask(mInstance);
+    otError                 error             = OT_ERROR_NONE;
+    EnergyScanCache::Action action            = EnergyScanCache::kBusy;
+    uint32_t                preferredChannels = otPlatRadioGetPreferredChannelMask(mInstance);
 
-    VerifyOrExit(aHandler != nullptr, error = OT_ERROR_BUSY);
+    VerifyOrExit(aHandler != nullptr || aResultHandler != nullptr);
     VerifyOrExit(aScanDuration < UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
-    mEnergyScanHandler = aHandler;
-    mEnergyScanResults.clear();
+    action = mEnergyScanCache.AddRequest(aScanDuration, aHandler, std::move(aResultHandler), Clock::now());
+    VerifyOrExit(action != EnergyScanCache::kBusy, error = OT_ERROR_BUSY);
+    VerifyOrExit(action == EnergyScanCache::kStartScan);
 
     error = otLinkEnergyScan(mInstance, preferredChannels, static_cast<uint16_t>(aScanDuration),
                              &ThreadHelper::EnergyScanCallback, this);
@@ -386,11 +651,14 @@ void ThreadHelper::EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler
 exit:
     if (error != OT_ERROR_NONE)
     {
-        if (aHandler)
+        if (action == EnergyScanCache::kStartScan)
         {
-            mEnergyScanHandler(error, {});
+            mEnergyScanCache.HandleDone(error);
+        }
+        else if (aHandler != nullptr)
+        {
+            aHandler(error, {});
         }
-        mEnergyScanHandler = nullptr;
     }
 }
 
@@ -416,14 +684,11 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mScanHandler != nullptr)
-        {
-            mScanHandler(OT_ERROR_NONE, mScanResults);
-        }
+        mScanCache.HandleDone(OT_ERROR_NONE);
     }
     else
     {
-        mScanResults.push_back(*aResult);
+        mScanCache.HandleResult(*aResult);
     }
 }
 
@@ -443,6 +708,8 @@ void ThreadHelper::BorderRoutingDhcp6PdCallback(otBorderRoutingDhcp6PdState aSta
 
 void ThreadHelper::BorderRoutingDhcp6PdCallback(otBorderRoutingDhcp6PdState aState)
 {
+    mDhcp6PdLeaseKeeper.HandlePdStateChanged(aState);
+
     if (mDhcp6PdCallback != nullptr)
     {
         mDhcp6PdCallback(aState);
@@ -461,14 +728,11 @@ void ThreadHelper::EnergyScanCallback(otEnergyScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mEnergyScanHandler != nullptr)
-        {
-            mEnergyScanHandler(OT_ERROR_NONE, mEnergyScanResults);
-        }
+        mEnergyScanCache.HandleDone(OT_ERROR_NONE);
     }
     else
     {
-        mEnergyScanResults.push_back(*aResult);
+        mEnergyScanCache.HandleResult(*aResult);
     }
 }
 
@@ -918,42 +1182,79 @@ void ThreadHelper::DetachGracefullyCallback(void)
 }
 
 #if OTBR_ENABLE_TELEMETRY_DATA_API
+void ThreadHelper::CopyMdnsLatencyHistogram(const MdnsLatencyHistogram                        &aFrom,
+                                            threadnetwork::TelemetryData_MdnsLatencyHistogram *aTo)
+{
+    for (uint32_t count : aFrom.mBucketCounts)
+    {
+        aTo->add_bucket_counts(count);
+    }
+    aTo->set_p50_ms(aFrom.GetPercentile(50));
+    aTo->set_p95_ms(aFrom.GetPercentile(95));
+    aTo->set_p99_ms(aFrom.GetPercentile(99));
+    aTo->set_max_ms(aFrom.mMaxLatency);
+}
+
 #if OTBR_ENABLE_BORDER_ROUTING
 void ThreadHelper::RetrieveInfraLinkInfo(threadnetwork::TelemetryData::InfraLinkInfo &aInfraLinkInfo)
 {
+    Timepoint now = Clock::now();
+
+#if __linux__
+    // The addresses of the infra link are only enumerated again after a netlink event.
+    if (mInfraLinkNetlinkFd == -1)
+    {
+        mInfraLinkNetlinkFd = CreateNetLinkRouteSocket(RTMGRP_LINK | RTMGRP_IPV6_IFADDR);
+        if (mInfraLinkNetlinkFd == -1)
+        {
+            otbrLogWarning("Failed to create the netlink socket of the infra link: %s", strerror(errno));
+        }
+    }
+#endif
+
+    if (!mInfraLinkInfoValid)
     {
         otSysInfraNetIfAddressCounters addressCounters;
         uint32_t                       ifrFlags = otSysGetInfraNetifFlags();
 
         otSysCountInfraNetifAddresses(&addressCounters);
 
-        aInfraLinkInfo.set_name(otSysGetInfraNetifName());
-        aInfraLinkInfo.set_is_up((ifrFlags & IFF_UP) != 0);
-        aInfraLinkInfo.set_is_running((ifrFlags & IFF_RUNNING) != 0);
-        aInfraLinkInfo.set_is_multicast((ifrFlags & IFF_MULTICAST) != 0);
-        aInfraLinkInfo.set_link_local_address_count(addressCounters.mLinkLocalAddresses);
-        aInfraLinkInfo.set_unique_local_address_count(addressCounters.mUniqueLocalAddresses);
-        aInfraLinkInfo.set_global_unicast_address_count(addressCounters.mGlobalUnicastAddresses);
+        mInfraLinkIndex = if_nametoindex(otSysGetInfraNetifName());
+        mInfraLinkInfo.set_name(otSysGetInfraNetifName());
+        mInfraLinkInfo.set_is_up((ifrFlags & IFF_UP) != 0);
+        mInfraLinkInfo.set_is_running((ifrFlags & IFF_RUNNING) != 0);
+        mInfraLinkInfo.set_is_multicast((ifrFlags & IFF_MULTICAST) != 0);
+        mInfraLinkInfo.set_link_local_address_count(addressCounters.mLinkLocalAddresses);
+        mInfraLinkInfo.set_unique_local_address_count(addressCounters.mUniqueLocalAddresses);
+        mInfraLinkInfo.set_global_unicast_address_count(addressCounters.mGlobalUnicastAddresses);
+
+        // Nothing invalidates the cache without the netlink socket.
+        mInfraLinkInfoValid = (mInfraLinkNetlinkFd != -1);
     }
 
     //---- peer_br_count
+    if (!mPeerBrCountValid || now - mPeerBrCountTime >= Milliseconds(OTBR_TELEMETRY_PEER_BR_COUNT_MAX_AGE_MS))
     {
-        uint32_t                           count = 0;
         otBorderRoutingPrefixTableIterator iterator;
         otBorderRoutingRouterEntry         entry;
 
+        mPeerBrCount = 0;
         otBorderRoutingPrefixTableInitIterator(mInstance, &iterator);
 
         while (otBorderRoutingGetNextRouterEntry(mInstance, &iterator, &entry) == OT_ERROR_NONE)
         {
             if (entry.mIsPeerBr)
             {
-                count++;
+                mPeerBrCount++;
             }
         }
 
-        aInfraLinkInfo.set_peer_br_count(count);
+        mPeerBrCountValid = true;
+        mPeerBrCountTime  = now;
     }
+
+    aInfraLinkInfo = mInfraLinkInfo;
+    aInfraLinkInfo.set_peer_br_count(mPeerBrCount);
 }
 
 void ThreadHelper::RetrieveExternalRouteInfo(threadnetwork::TelemetryData::ExternalRoutes &aExternalRouteInfo)
@@ -964,10 +1265,7 @@ void ThreadHelper::RetrieveExternalRouteInfo(threadnetwork::TelemetryData::Exter
     Ip6Prefix prefix;
     uint16_t  rloc16 = otThreadGetRloc16(mInstance);
 
-    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
-    otExternalRouteConfig config;
-
-    while (otNetDataGetNextRoute(mInstance, &iterator, &config) == OT_ERROR_NONE)
+    for (const otExternalRouteConfig &config : mNetworkDataCache.Get().mExternalRoutes)
     {
         if (!config.mStable || config.mRloc16 != rloc16)
         {
@@ -1005,42 +1303,39 @@ void ThreadHelper::RetrievePdInfo(threadnetwork::TelemetryData::WpanBorderRouter
 
 void ThreadHelper::RetrieveHashedPdPrefix(std::string *aHashedPdPrefix)
 {
-    otBorderRoutingPrefixTableEntry aPrefixInfo;
-    const uint8_t                  *prefixAddr          = nullptr;
-    const uint8_t                  *truncatedHash       = nullptr;
-    constexpr size_t                kHashPrefixLength   = 6;
-    constexpr size_t                kHashedPrefixLength = 2;
-    std::vector<uint8_t>            hashedPdHeader      = {0x20, 0x01, 0x0d, 0xb8};
-    std::vector<uint8_t>            hashedPdTailer      = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    std::vector<uint8_t>            hashedPdPrefix;
-    hashedPdPrefix.reserve(16);
-    Sha256       sha256;
-    Sha256::Hash hash;
-
-    SuccessOrExit(otBorderRoutingGetPdOmrPrefix(mInstance, &aPrefixInfo));
-    prefixAddr = aPrefixInfo.mPrefix.mPrefix.mFields.m8;
-
-    // TODO: Put below steps into a reusable function.
-    sha256.Start();
-    sha256.Update(prefixAddr, kHashPrefixLength);
-    sha256.Update(mNat64PdCommonSalt, kNat64PdCommonHashSaltLength);
-    sha256.Finish(hash);
-
-    // Append hashedPdHeader
-    hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdHeader.begin(), hashedPdHeader.end());
-
-    // Append the first 2 bytes of the hashed prefix
-    truncatedHash = hash.GetBytes();
-    hashedPdPrefix.insert(hashedPdPrefix.end(), truncatedHash, truncatedHash + kHashedPrefixLength);
-
-    // Append ip[6] and ip[7]
-    hashedPdPrefix.push_back(prefixAddr[6]);
-    hashedPdPrefix.push_back(prefixAddr[7]);
-
-    // Append hashedPdTailer
-    hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdTailer.begin(), hashedPdTailer.end());
-
-    aHashedPdPrefix->append(reinterpret_cast<const char *>(hashedPdPrefix.data()), hashedPdPrefix.size());
+    otBorderRoutingPrefixTableEntry prefixInfo;
+    const uint8_t                  *prefixAddr = nullptr;
+
+    SuccessOrExit(otBorderRoutingGetPdOmrPrefix(mInstance, &prefixInfo));
+    prefixAddr = prefixInfo.mPrefix.mPrefix.mFields.m8;
+
+    // The prefix is only hashed again if the PD prefix or the salt changed.
+    if (!mHashedPdPrefixValid || memcmp(mHashedPdPrefixSource, prefixAddr, sizeof(mHashedPdPrefixSource)) != 0 ||
+        memcmp(mHashedPdPrefixSalt, mNat64PdCommonSalt, sizeof(mHashedPdPrefixSalt)) != 0)
+    {
+        constexpr size_t kHashPrefixLength   = 6;
+        constexpr size_t kHashedPrefixLength = 2;
+        // The hashed prefix is 2001:db8:<2 bytes of the hash>:<bytes 6 and 7 of the PD prefix>::.
+        uint8_t      hashedPdPrefix[OT_IP6_ADDRESS_SIZE] = {0x20, 0x01, 0x0d, 0xb8};
+        Sha256       sha256;
+        Sha256::Hash hash;
+
+        sha256.Start();
+        sha256.Update(prefixAddr, kHashPrefixLength);
+        sha256.Update(mNat64PdCommonSalt, kNat64PdCommonHashSaltLength);
+        sha256.Finish(hash);
+
+        memcpy(&hashedPdPrefix[4], hash.GetBytes(), kHashedPrefixLength);
+        hashedPdPrefix[6] = prefixAddr[6];
+        hashedPdPrefix[7] = prefixAddr[7];
+
+        mHashedPdPrefix.assign(reinterpret_cast<const char *>(hashedPdPrefix), sizeof(hashedPdPrefix));
+        memcpy(mHashedPdPrefixSource, prefixAddr, sizeof(mHashedPdPrefixSource));
+        memcpy(mHashedPdPrefixSalt, mNat64PdCommonSalt, sizeof(mHashedPdPrefixSalt));
+        mHashedPdPrefixValid = true;
+    }
+
+    aHashedPdPrefix->append(mHashedPdPrefix);
 
 exit:
     return;
@@ -1087,86 +1382,103 @@ void ThreadHelper::RetrieveBorderAgentInfo(threadnetwork::TelemetryData::BorderA
 }
 #endif
 
-otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData)
+otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                            threadnetwork::TelemetryData &telemetryData,
+                                            uint32_t                      aSections)
 {
     otError                     error = OT_ERROR_NONE;
     std::vector<otNeighborInfo> neighborTable;
 
-    // Begin of WpanStats section.
-    auto wpanStats = telemetryData.mutable_wpan_stats();
-
+    if (aSections & (kTelemetryTopology | kTelemetryLowPowerMetrics))
     {
-        otDeviceRole     role  = mHost->GetDeviceRole();
-        otLinkModeConfig otCfg = otThreadGetLinkMode(mInstance);
+        otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+        otNeighborInfo         neighborInfo;
 
-        wpanStats->set_node_type(TelemetryNodeTypeFromRoleAndLinkMode(role, otCfg));
+        while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+        {
+            neighborTable.push_back(neighborInfo);
+        }
     }
 
-    wpanStats->set_channel(otLinkGetChannel(mInstance));
-
+    if (aSections & kTelemetryWpanStats)
     {
-        uint16_t ccaFailureRate = otLinkGetCcaFailureRate(mInstance);
+        // Begin of WpanStats section.
+        auto wpanStats = telemetryData.mutable_wpan_stats();
 
-        wpanStats->set_mac_cca_fail_rate(static_cast<float>(ccaFailureRate) / 0xffff);
-    }
+        {
+            otDeviceRole     role  = mHost->GetDeviceRole();
+            otLinkModeConfig otCfg = otThreadGetLinkMode(mInstance);
 
-    {
-        int8_t radioTxPower;
+            wpanStats->set_node_type(TelemetryNodeTypeFromRoleAndLinkMode(role, otCfg));
+        }
+
+        wpanStats->set_channel(otLinkGetChannel(mInstance));
 
-        if (otPlatRadioGetTransmitPower(mInstance, &radioTxPower) == OT_ERROR_NONE)
         {
-            wpanStats->set_radio_tx_power(radioTxPower);
+            uint16_t ccaFailureRate = otLinkGetCcaFailureRate(mInstance);
+
+            wpanStats->set_mac_cca_fail_rate(static_cast<float>(ccaFailureRate) / 0xffff);
         }
-        else
+
         {
-            error = OT_ERROR_FAILED;
-        }
-    }
+            int8_t radioTxPower;
 
-    {
-        const otMacCounters *linkCounters = otLinkGetCounters(mInstance);
+            if (otPlatRadioGetTransmitPower(mInstance, &radioTxPower) == OT_ERROR_NONE)
+            {
+                wpanStats->set_radio_tx_power(radioTxPower);
+            }
+            else
+            {
+                error = OT_ERROR_FAILED;
+            }
+        }
 
-        wpanStats->set_phy_rx(linkCounters->mRxTotal);
-        wpanStats->set_phy_tx(linkCounters->mTxTotal);
-        wpanStats->set_mac_unicast_rx(linkCounters->mRxUnicast);
-        wpanStats->set_mac_unicast_tx(linkCounters->mTxUnicast);
-        wpanStats->set_mac_broadcast_rx(linkCounters->mRxBroadcast);
-        wpanStats->set_mac_broadcast_tx(linkCounters->mTxBroadcast);
-        wpanStats->set_mac_tx_ack_req(linkCounters->mTxAckRequested);
-        wpanStats->set_mac_tx_no_ack_req(linkCounters->mTxNoAckRequested);
-        wpanStats->set_mac_tx_acked(linkCounters->mTxAcked);
-        wpanStats->set_mac_tx_data(linkCounters->mTxData);
-        wpanStats->set_mac_tx_data_poll(linkCounters->mTxDataPoll);
-        wpanStats->set_mac_tx_beacon(linkCounters->mTxBeacon);
-        wpanStats->set_mac_tx_beacon_req(linkCounters->mTxBeaconRequest);
-        wpanStats->set_mac_tx_other_pkt(linkCounters->mTxOther);
-        wpanStats->set_mac_tx_retry(linkCounters->mTxRetry);
-        wpanStats->set_mac_rx_data(linkCounters->mRxData);
-        wpanStats->set_mac_rx_data_poll(linkCounters->mRxDataPoll);
-        wpanStats->set_mac_rx_beacon(linkCounters->mRxBeacon);
-        wpanStats->set_mac_rx_beacon_req(linkCounters->mRxBeaconRequest);
-        wpanStats->set_mac_rx_other_pkt(linkCounters->mRxOther);
-        wpanStats->set_mac_rx_filter_whitelist(linkCounters->mRxAddressFiltered);
-        wpanStats->set_mac_rx_filter_dest_addr(linkCounters->mRxDestAddrFiltered);
-        wpanStats->set_mac_tx_fail_cca(linkCounters->mTxErrCca);
-        wpanStats->set_mac_rx_fail_decrypt(linkCounters->mRxErrSec);
-        wpanStats->set_mac_rx_fail_no_frame(linkCounters->mRxErrNoFrame);
-        wpanStats->set_mac_rx_fail_unknown_neighbor(linkCounters->mRxErrUnknownNeighbor);
-        wpanStats->set_mac_rx_fail_invalid_src_addr(linkCounters->mRxErrInvalidSrcAddr);
-        wpanStats->set_mac_rx_fail_fcs(linkCounters->mRxErrFcs);
-        wpanStats->set_mac_rx_fail_other(linkCounters->mRxErrOther);
-    }
+        {
+            const otMacCounters *linkCounters = otLinkGetCounters(mInstance);
+
+            wpanStats->set_phy_rx(linkCounters->mRxTotal);
+            wpanStats->set_phy_tx(linkCounters->mTxTotal);
+            wpanStats->set_mac_unicast_rx(linkCounters->mRxUnicast);
+            wpanStats->set_mac_unicast_tx(linkCounters->mTxUnicast);
+            wpanStats->set_mac_broadcast_rx(linkCounters->mRxBroadcast);
+            wpanStats->set_mac_broadcast_tx(linkCounters->mTxBroadcast);
+            wpanStats->set_mac_tx_ack_req(linkCounters->mTxAckRequested);
+            wpanStats->set_mac_tx_no_ack_req(linkCounters->mTxNoAckRequested);
+            wpanStats->set_mac_tx_acked(linkCounters->mTxAcked);
+            wpanStats->set_mac_tx_data(linkCounters->mTxData);
+            wpanStats->set_mac_tx_data_poll(linkCounters->mTxDataPoll);
+            wpanStats->set_mac_tx_beacon(linkCounters->mTxBeacon);
+            wpanStats->set_mac_tx_beacon_req(linkCounters->mTxBeaconRequest);
+            wpanStats->set_mac_tx_other_pkt(linkCounters->mTxOther);
+            wpanStats->set_mac_tx_retry(linkCounters->mTxRetry);
+            wpanStats->set_mac_rx_data(linkCounters->mRxData);
+            wpanStats->set_mac_rx_data_poll(linkCounters->mRxDataPoll);
+            wpanStats->set_mac_rx_beacon(linkCounters->mRxBeacon);
+            wpanStats->set_mac_rx_beacon_req(linkCounters->mRxBeaconRequest);
+            wpanStats->set_mac_rx_other_pkt(linkCounters->mRxOther);
+            wpanStats->set_mac_rx_filter_whitelist(linkCounters->mRxAddressFiltered);
+            wpanStats->set_mac_rx_filter_dest_addr(linkCounters->mRxDestAddrFiltered);
+            wpanStats->set_mac_tx_fail_cca(linkCounters->mTxErrCca);
+            wpanStats->set_mac_rx_fail_decrypt(linkCounters->mRxErrSec);
+            wpanStats->set_mac_rx_fail_no_frame(linkCounters->mRxErrNoFrame);
+            wpanStats->set_mac_rx_fail_unknown_neighbor(linkCounters->mRxErrUnknownNeighbor);
+            wpanStats->set_mac_rx_fail_invalid_src_addr(linkCounters->mRxErrInvalidSrcAddr);
+            wpanStats->set_mac_rx_fail_fcs(linkCounters->mRxErrFcs);
+            wpanStats->set_mac_rx_fail_other(linkCounters->mRxErrOther);
+        }
 
-    {
-        const otIpCounters *ipCounters = otThreadGetIp6Counters(mInstance);
+        {
+            const otIpCounters *ipCounters = otThreadGetIp6Counters(mInstance);
 
-        wpanStats->set_ip_tx_success(ipCounters->mTxSuccess);
-        wpanStats->set_ip_rx_success(ipCounters->mRxSuccess);
-        wpanStats->set_ip_tx_failure(ipCounters->mTxFailure);
-        wpanStats->set_ip_rx_failure(ipCounters->mRxFailure);
+            wpanStats->set_ip_tx_success(ipCounters->mTxSuccess);
+            wpanStats->set_ip_rx_success(ipCounters->mRxSuccess);
+            wpanStats->set_ip_tx_failure(ipCounters->mTxFailure);
+            wpanStats->set_ip_rx_failure(ipCounters->mRxFailure);
+        }
+        // End of WpanStats section.
     }
-    // End of WpanStats section.
 
+    if (aSections & kTelemetryTopology)
     {
         // Begin of WpanTopoFull section.
         auto     wpanTopoFull = telemetryData.mutable_wpan_topo_full();
@@ -1187,13 +1499,6 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
             }
         }
 
-        otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-        otNeighborInfo         neighborInfo;
-
-        while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
-        {
-            neighborTable.push_back(neighborInfo);
-        }
         wpanTopoFull->set_neighbor_table_size(neighborTable.size());
 
         uint16_t                 childIndex = 0;
@@ -1329,6 +1634,7 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
         // End of TopoEntry section.
     }
 
+    if (aSections & kTelemetryBorderRouter)
     {
         // Begin of WpanBorderRouter section.
         auto wpanBorderRouter = telemetryData.mutable_wpan_border_router();
@@ -1441,9 +1747,8 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
         // Begin of SrpServerInfo section.
         {
-            auto                               srpServer = wpanBorderRouter->mutable_srp_server();
-            otSrpServerLeaseInfo               leaseInfo;
-            const otSrpServerHost             *host             = nullptr;
+            auto                               srpServer        = wpanBorderRouter->mutable_srp_server();
+            const SrpServerStats::Stats       &stats            = mSrpServerStats.Get();
             const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
 
             srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
@@ -1455,48 +1760,19 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
             auto srpServerServices         = srpServer->mutable_services();
             auto srpServerResponseCounters = srpServer->mutable_response_counters();
 
-            while ((host = otSrpServerGetNextHost(mInstance, host)))
-            {
-                const otSrpServerService *service = nullptr;
+            srpServerHosts->set_fresh_count(stats.mHosts.mFreshCount);
+            srpServerHosts->set_deleted_count(stats.mHosts.mDeletedCount);
+            srpServerHosts->set_lease_time_total_ms(stats.mHosts.mLeaseTimeTotal);
+            srpServerHosts->set_key_lease_time_total_ms(stats.mHosts.mKeyLeaseTimeTotal);
+            srpServerHosts->set_remaining_lease_time_total_ms(stats.mHosts.mRemainingLeaseTimeTotal);
+            srpServerHosts->set_remaining_key_lease_time_total_ms(stats.mHosts.mRemainingKeyLeaseTimeTotal);
 
-                if (otSrpServerHostIsDeleted(host))
-                {
-                    srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
-                }
-                else
-                {
-                    srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
-                    otSrpServerHostGetLeaseInfo(host, &leaseInfo);
-                    srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
-                    srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
-                                                                leaseInfo.mKeyLease);
-                    srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
-                                                                      leaseInfo.mRemainingLease);
-                    srpServerHosts->set_remaining_key_lease_time_total_ms(
-                        srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                }
-
-                while ((service = otSrpServerHostGetNextService(host, service)))
-                {
-                    if (otSrpServerServiceIsDeleted(service))
-                    {
-                        srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
-                    }
-                    else
-                    {
-                        srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
-                        otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
-                        srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
-                                                                   leaseInfo.mLease);
-                        srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
-                                                                       leaseInfo.mKeyLease);
-                        srpServerServices->set_remaining_lease_time_total_ms(
-                            srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
-                        srpServerServices->set_remaining_key_lease_time_total_ms(
-                            srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                    }
-                }
-            }
+            srpServerServices->set_fresh_count(stats.mServices.mFreshCount);
+            srpServerServices->set_deleted_count(stats.mServices.mDeletedCount);
+            srpServerServices->set_lease_time_total_ms(stats.mServices.mLeaseTimeTotal);
+            srpServerServices->set_key_lease_time_total_ms(stats.mServices.mKeyLeaseTimeTotal);
+            srpServerServices->set_remaining_lease_time_total_ms(stats.mServices.mRemainingLeaseTimeTotal);
+            srpServerServices->set_remaining_key_lease_time_total_ms(stats.mServices.mRemainingKeyLeaseTimeTotal);
 
             srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
             srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
@@ -1553,6 +1829,25 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
             mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
             mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
             mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+            mdns->set_discovery_cache_hits(mdnsInfo.mDiscoveryCacheHits);
+            mdns->set_discovery_cache_misses(mdnsInfo.mDiscoveryCacheMisses);
+            mdns->set_daemon_requests(mdnsInfo.mDaemonRequests);
+            for (uint8_t i = 0; i < MdnsTelemetryInfo::kNumHistogramBuckets; i++)
+            {
+                mdns->add_publication_queue_depth_buckets(mdnsInfo.mPublicationQueueDepths[i]);
+                mdns->add_high_priority_publication_wait_ms_buckets(
+                    mdnsInfo.mPublicationWaitTimes[static_cast<uint8_t>(Mdns::Publisher::Priority::kHigh)][i]);
+                mdns->add_normal_priority_publication_wait_ms_buckets(
+                    mdnsInfo.mPublicationWaitTimes[static_cast<uint8_t>(Mdns::Publisher::Priority::kNormal)][i]);
+            }
+
+            CopyMdnsLatencyHistogram(mdnsInfo.mHostRegistrationLatencies, mdns->mutable_host_registration_latencies());
+            CopyMdnsLatencyHistogram(mdnsInfo.mKeyRegistrationLatencies, mdns->mutable_key_registration_latencies());
+            CopyMdnsLatencyHistogram(mdnsInfo.mServiceRegistrationLatencies,
+                                     mdns->mutable_service_registration_latencies());
+            CopyMdnsLatencyHistogram(mdnsInfo.mHostResolutionLatencies, mdns->mutable_host_resolution_latencies());
+            CopyMdnsLatencyHistogram(mdnsInfo.mServiceResolutionLatencies,
+                                     mdns->mutable_service_resolution_latencies());
         }
         // End of MdnsInfo section.
 
@@ -1603,7 +1898,10 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
         RetrieveBorderAgentInfo(wpanBorderRouter->mutable_border_agent_info());
 #endif // OTBR_ENABLE_BORDER_AGENT
        // End of WpanBorderRouter section.
+    }
 
+    if (aSections & kTelemetryRcp)
+    {
         // Start of WpanRcp section.
         {
             auto                        wpanRcp                = telemetryData.mutable_wpan_rcp();
@@ -1638,6 +1936,18 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
                 rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
                 rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
             }
+
+            {
+                const Ncp::RcpHost::RecoveryCounters &counters     = mHost->GetRecoveryCounters();
+                auto                                  recoveryData = wpanRcp->mutable_rcp_recovery_stats();
+
+                recoveryData->set_restoration_count(counters.mRestorations);
+                recoveryData->set_last_restoration_time_us(
+                    static_cast<uint64_t>(counters.mLastRestorationTime.count()));
+                recoveryData->set_max_restoration_time_us(static_cast<uint64_t>(counters.mMaxRestorationTime.count()));
+                recoveryData->set_reset_count(counters.mResets);
+                recoveryData->set_last_reset_time_us(static_cast<uint64_t>(counters.mLastResetTime.count()));
+            }
         }
         // End of WpanRcp section.
 
@@ -1646,7 +1956,7 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
             auto               coexMetrics = telemetryData.mutable_coex_metrics();
             otRadioCoexMetrics otRadioCoexMetrics;
 
-            if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
+            if (mRadioCoexSampler.GetMetrics(otRadioCoexMetrics) == OT_ERROR_NONE)
             {
                 coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
                 coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
@@ -1675,6 +1985,7 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
     }
 
 #if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    if (aSections & kTelemetryLowPowerMetrics)
     {
         auto lowPowerMetrics = telemetryData.mutable_low_power_metrics();
         // Begin of Link Metrics section.
@@ -1693,34 +2004,187 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
                 linkMetricsStats->set_rssi(values.mRssiValue);
             }
         }
+
+        // Begin of Link Metrics History section.
+        for (const LinkMetricsSampler::NeighborHistory &neighbor : mLinkMetricsSampler.GetNeighborHistories())
+        {
+            const LinkMetricsHistory &history = neighbor.mHistory;
+
+            if (history.GetSampleCount() == 0)
+            {
+                continue;
+            }
+
+            auto entry = lowPowerMetrics->add_link_metrics_histories();
+            entry->set_rloc16(neighbor.mRloc16);
+            entry->set_sample_count(history.GetSampleCount());
+            CopyLinkMetricsPercentiles(history, LinkMetricsHistory::kRssi, entry->mutable_rssi());
+            CopyLinkMetricsPercentiles(history, LinkMetricsHistory::kLqi, entry->mutable_lqi());
+            CopyLinkMetricsPercentiles(history, LinkMetricsHistory::kLinkMargin, entry->mutable_link_margin());
+        }
     }
 #endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
 
+#if OTBR_ENABLE_MAINLOOP_STATS
+    if (aSections & kTelemetryMainloopStats)
+    {
+        // Begin of MainloopStats section.
+        const MainloopManager &mainloopManager = MainloopManager::GetInstance();
+        auto                   mainloopStats   = telemetryData.mutable_mainloop_stats();
+
+        mainloopStats->set_iteration_count(mainloopManager.GetIterationCount());
+
+        for (const auto &entry : mainloopManager.GetProcessorStats())
+        {
+            auto processorStats = mainloopStats->add_processor_stats();
+
+            processorStats->set_name(entry.first);
+            CopyMainloopHistogram(entry.second.mUpdateDuration, processorStats->mutable_update_duration());
+            CopyMainloopHistogram(entry.second.mProcessDuration, processorStats->mutable_process_duration());
+            CopyMainloopHistogram(entry.second.mTimeout, processorStats->mutable_timeout());
+            processorStats->set_ready_fd_count(entry.second.mReadyFdCount);
+            processorStats->set_timeout_shortened_count(entry.second.mTimeoutShortenedCount);
+        }
+
+        {
+            const Ncp::RcpHost::SchedulerCounters &counters       = mHost->GetSchedulerCounters();
+            auto                                   schedulerStats = mainloopStats->mutable_rcp_host_scheduler_stats();
+
+            schedulerStats->set_iteration_count(counters.mIterations);
+            schedulerStats->set_tasklet_pass_count(counters.mTaskletPasses);
+            schedulerStats->set_pass_limit_reached_count(counters.mPassLimitReached);
+            schedulerStats->set_budget_exhausted_count(counters.mBudgetExhausted);
+        }
+        // End of MainloopStats section.
+    }
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
+    if (aSections & kTelemetryStartupStats)
+    {
+        // Begin of StartupStats section.
+        const StartupStats &startupStats = StartupStats::GetInstance();
+        auto                startupData  = telemetryData.mutable_startup_stats();
+
+        for (const StartupStats::Stage &stage : startupStats.GetStages())
+        {
+            auto stageData = startupData->add_stages();
+
+            stageData->set_name(stage.mName);
+            stageData->set_begin_us(static_cast<uint64_t>(stage.mBeginTime.count()));
+            stageData->set_duration_us(static_cast<uint64_t>(stage.mDuration.count()));
+            stageData->set_completed(stage.mCompleted);
+        }
+
+        startupData->set_duration_us(static_cast<uint64_t>(startupStats.GetDuration().count()));
+        startupData->set_completed(startupStats.IsCompleted());
+
+        {
+            const Ncp::RcpHost::AutoAttachCounters &counters       = mHost->GetAutoAttachCounters();
+            auto                                    autoAttachData = startupData->mutable_auto_attach_stats();
+
+            autoAttachData->set_resume_attempt_count(counters.mResumeAttempts);
+            autoAttachData->set_resume_failure_count(counters.mResumeFailures);
+            autoAttachData->set_retry_delay_ms(static_cast<uint64_t>(counters.mRetryDelay.count()));
+            autoAttachData->set_time_to_attach_us(static_cast<uint64_t>(counters.mTimeToAttach.count()));
+            autoAttachData->set_attached(counters.mAttached);
+        }
+        // End of StartupStats section.
+    }
+
+    if (aSections & kTelemetryMemoryStats)
+    {
+        // Begin of MemoryStats section.
+        MemoryStats::HeapUsage heapUsage  = MemoryStats::GetHeapUsage();
+        auto                   memoryData = telemetryData.mutable_memory_stats();
+
+        for (const auto &entry : MemoryStats::GetInstance().GetCounters())
+        {
+            auto counterData = memoryData->add_counters();
+
+            counterData->set_name(entry.first);
+            counterData->set_count(entry.second);
+        }
+
+        memoryData->set_resident_bytes(heapUsage.mResidentBytes);
+        memoryData->set_heap_in_use_bytes(heapUsage.mInUseBytes);
+        memoryData->set_heap_free_bytes(heapUsage.mFreeBytes);
+        memoryData->set_heap_mmapped_bytes(heapUsage.mMmappedBytes);
+        // End of MemoryStats section.
+    }
+
+    return error;
+}
+
+otError ThreadHelper::RetrieveCachedTelemetryData(Mdns::Publisher              *aPublisher,
+                                                  threadnetwork::TelemetryData &aTelemetryData,
+                                                  uint32_t                      aSections)
+{
+    // The sections walking the device tables are reused until they get stale, the counters are always retrieved.
+    static constexpr Milliseconds kTableRefreshInterval(OTBR_TELEMETRY_DATA_TABLE_REFRESH_INTERVAL_MS);
+    static const Milliseconds     kRefreshIntervals[kTelemetrySectionCount] = {
+        /* kTelemetryWpanStats       */ Milliseconds(0),
+        /* kTelemetryTopology        */ kTableRefreshInterval,
+        /* kTelemetryBorderRouter    */ kTableRefreshInterval,
+        /* kTelemetryRcp             */ Milliseconds(0),
+        /* kTelemetryLowPowerMetrics */ kTableRefreshInterval,
+        /* kTelemetryMainloopStats   */ Milliseconds(0),
+        /* kTelemetryStartupStats    */ Milliseconds(0),
+        /* kTelemetryMemoryStats     */ Milliseconds(0),
+    };
+
+    otError   error    = OT_ERROR_NONE;
+    Timepoint now      = Clock::now();
+    uint32_t  outdated = 0;
+
+    for (uint8_t i = 0; i < kTelemetrySectionCount; i++)
+    {
+        uint32_t section = 1u << i;
+
+        if ((aSections & section) &&
+            (!(mTelemetryCachedSections & section) || now - mTelemetryRefreshTime[i] >= kRefreshIntervals[i]))
+        {
+            outdated |= section;
+        }
+    }
+
+    if (outdated != 0)
+    {
+        CopyTelemetrySections(threadnetwork::TelemetryData(), mTelemetryCache, outdated);
+        error = RetrieveTelemetryData(aPublisher, mTelemetryCache, outdated);
+
+        for (uint8_t i = 0; i < kTelemetrySectionCount; i++)
+        {
+            if (outdated & (1u << i))
+            {
+                mTelemetryRefreshTime[i] = now;
+            }
+        }
+
+        // The sections are retrieved again next time if any of them failed.
+        mTelemetryCachedSections = (error == OT_ERROR_NONE) ? (mTelemetryCachedSections | outdated)
+                                                            : (mTelemetryCachedSections & ~outdated);
+    }
+
+    aTelemetryData.Clear();
+    CopyTelemetrySections(mTelemetryCache, aTelemetryData, aSections);
+
     return error;
 }
+
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
 otError ThreadHelper::ProcessDatasetForMigration(otOperationalDatasetTlvs &aDatasetTlvs, uint32_t aDelayMilli)
 {
-    otError  error = OT_ERROR_NONE;
-    Tlv     *tlv;
-    timespec currentTime;
-    uint64_t pendingTimestamp = 0;
+    otError     error = OT_ERROR_NONE;
+    TlvEditor   editor(aDatasetTlvs.mTlvs, aDatasetTlvs.mLength, sizeof(aDatasetTlvs.mTlvs));
+    TlvIterator tlv(nullptr, 0);
+    timespec    currentTime;
+    uint64_t    pendingTimestamp = 0;
 
-    VerifyOrExit(FindTlv(OT_MESHCOP_TLV_PENDINGTIMESTAMP, aDatasetTlvs.mTlvs, aDatasetTlvs.mLength) == nullptr,
-                 error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(FindTlv(OT_MESHCOP_TLV_DELAYTIMER, aDatasetTlvs.mTlvs, aDatasetTlvs.mLength) == nullptr,
-                 error = OT_ERROR_INVALID_ARGS);
-
-    // There must be sufficient space for a Pending Timestamp TLV and a Delay Timer TLV.
-    VerifyOrExit(
-        static_cast<int>(aDatasetTlvs.mLength +
-                         (sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint64_t))    // Pending Timestamp TLV (10 bytes)
-                         + (sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint32_t))) // Delay Timer TLV (6 bytes)
-            <= int{sizeof(aDatasetTlvs.mTlvs)},
-        error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(editor.GetView().IsWellFormed(), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(!editor.GetView().Find(OT_MESHCOP_TLV_PENDINGTIMESTAMP, tlv), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(!editor.GetView().Find(OT_MESHCOP_TLV_DELAYTIMER, tlv), error = OT_ERROR_INVALID_ARGS);
 
-    tlv = reinterpret_cast<Tlv *>(aDatasetTlvs.mTlvs + aDatasetTlvs.mLength);
     /*
      * Pending Timestamp TLV
      *
@@ -1728,19 +2192,19 @@ otError ThreadHelper::ProcessDatasetForMigration(otOperationalDatasetTlvs &aData
      * |  8   |   8   |         48        |         15      |   1   |
      *
      */
-    tlv->SetType(OT_MESHCOP_TLV_PENDINGTIMESTAMP);
     clock_gettime(CLOCK_REALTIME, &currentTime);
     pendingTimestamp |= (static_cast<uint64_t>(currentTime.tv_sec) << 16); // Set the 48 bits of Timestamp seconds.
     pendingTimestamp |= (((static_cast<uint64_t>(currentTime.tv_nsec) * 32768 / 1000000000) & 0x7fff)
                          << 1); // Set the 15 bits of Timestamp ticks, the fractional Unix Time value in 32.768 kHz
                                 // resolution. Leave the U-bit unset.
-    tlv->SetValue(pendingTimestamp);
 
-    tlv = tlv->GetNext();
-    tlv->SetType(OT_MESHCOP_TLV_DELAYTIMER);
-    tlv->SetValue(aDelayMilli);
+    // Both TLVs are appended in place, the length of the dataset is only updated once both fit in it.
+    VerifyOrExit(editor.SetUint64(OT_MESHCOP_TLV_PENDINGTIMESTAMP, pendingTimestamp) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(editor.SetUint32(OT_MESHCOP_TLV_DELAYTIMER, aDelayMilli) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
-    aDatasetTlvs.mLength = reinterpret_cast<uint8_t *>(tlv->GetNext()) - aDatasetTlvs.mTlvs;
+    aDatasetTlvs.mLength = static_cast<uint8_t>(editor.GetLength());
 
 exit:
     return error;
@@ -50,10 +50,48 @@
 #include <openthread/joiner.h>
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
+#include "utils/channel_quality_history.hpp"
+#if OTBR_ENABLE_DHCP6_PD
+#include "utils/dhcp6_pd_lease.hpp"
+#endif
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 #include "proto/thread_telemetry.pb.h"
 #endif
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+#include "utils/link_metrics_sampler.hpp"
+#endif
+#include "utils/network_data_cache.hpp"
+#include "utils/radio_coex_sampler.hpp"
+#include "utils/scan_cache.hpp"
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+#include "utils/srp_server_stats.hpp"
+#endif
+
+#ifndef OTBR_TELEMETRY_DATA_TABLE_REFRESH_INTERVAL_MS
+#define OTBR_TELEMETRY_DATA_TABLE_REFRESH_INTERVAL_MS 5000
+#endif
+
+/**
+ * How long (in milliseconds) the results of a scan are served to new scan requests, zero to always scan again.
+ *
+ */
+#ifndef OTBR_THREAD_HELPER_SCAN_CACHE_MS
+#define OTBR_THREAD_HELPER_SCAN_CACHE_MS 5000
+#endif
+
+/**
+ * How long (in milliseconds) the peer border router count of the telemetry data is reused at most.
+ *
+ * The count is retrieved again after the network data changed, but the routers of the infrastructure link may also
+ * expire silently.
+ *
+ */
+#ifndef OTBR_TELEMETRY_PEER_BR_COUNT_MAX_AGE_MS
+#define OTBR_TELEMETRY_PEER_BR_COUNT_MAX_AGE_MS 60000
+#endif
 
 namespace otbr {
 namespace Ncp {
@@ -73,6 +111,8 @@ public:
     using DeviceRoleHandler       = std::function<void(otDeviceRole)>;
     using ScanHandler             = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
     using EnergyScanHandler       = std::function<void(otError, const std::vector<otEnergyScanResult> &)>;
+    using ScanResultHandler       = std::function<void(const otActiveScanResult &)>;
+    using EnergyScanResultHandler = std::function<void(const otEnergyScanResult &)>;
     using ResultHandler           = std::function<void(otError)>;
     using AttachHandler           = std::function<void(otError, int64_t)>;
     using UpdateMeshCopTxtHandler = std::function<void(std::map<std::string, std::vector<uint8_t>>)>;
@@ -81,6 +121,25 @@ public:
     using Dhcp6PdStateCallback = std::function<void(otBorderRoutingDhcp6PdState)>;
 #endif
 
+    /**
+     * The sections of the telemetry data, which can be retrieved separately.
+     *
+     */
+    enum TelemetrySection : uint32_t
+    {
+        kTelemetryWpanStats       = 1 << 0, ///< `wpan_stats`.
+        kTelemetryTopology        = 1 << 1, ///< `wpan_topo_full` and `topo_entries`.
+        kTelemetryBorderRouter    = 1 << 2, ///< `wpan_border_router`.
+        kTelemetryRcp             = 1 << 3, ///< `wpan_rcp` and `coex_metrics`.
+        kTelemetryLowPowerMetrics = 1 << 4, ///< `low_power_metrics`.
+        kTelemetryMainloopStats   = 1 << 5, ///< `mainloop_stats`.
+        kTelemetryStartupStats    = 1 << 6, ///< `startup_stats`.
+        kTelemetryMemoryStats     = 1 << 7, ///< `memory_stats`.
+        kTelemetryAllSections     = (1 << 8) - 1,
+    };
+
+    static constexpr uint8_t kTelemetrySectionCount = 8;
+
     /**
      * The constructor of a Thread helper.
      *
@@ -90,6 +149,12 @@ public:
      */
     ThreadHelper(otInstance *aInstance, otbr::Ncp::RcpHost *aHost);
 
+    /**
+     * The destructor of a Thread helper.
+     *
+     */
+    ~ThreadHelper(void);
+
     /**
      * This method adds a callback for device role change.
      *
@@ -111,6 +176,9 @@ public:
     /**
      * This method adds a callback for active dataset change.
      *
+     * The handlers are only invoked when the TLVs of the active dataset change, and all refer to the same dataset
+     * kept by this object, which must not be modified.
+     *
      * @param[in]  aHandler   The active dataset change handler.
      */
     void AddActiveDatasetChangeHandler(DatasetChangeHandler aHandler);
@@ -129,19 +197,29 @@ public:
     /**
      * This method performs a Thread network scan.
      *
-     * @param[in] aHandler  The scan result handler.
+     * A request received while a scan is in progress joins it, and the results of a scan completed less than
+     * `OTBR_THREAD_HELPER_SCAN_CACHE_MS` ago are reported without scanning again.
+     *
+     * @param[in] aHandler        The scan result handler, called with all the results when the scan completes.
+     * @param[in] aResultHandler  The handler called with each result as it is received, may be nullptr.
      *
      */
-    void Scan(ScanHandler aHandler);
+    void Scan(ScanHandler aHandler, ScanResultHandler aResultHandler = nullptr);
 
     /**
      * This method performs an IEEE 802.15.4 Energy Scan.
      *
-     * @param[in] aScanDuration  The duration for the scan, in milliseconds.
-     * @param[in] aHandler       The scan result handler.
+     * Requests are coalesced and cached like the ones of `Scan()`, as long as they have the same duration. A request
+     * received while a scan of another duration is in progress fails with OT_ERROR_BUSY.
+     *
+     * @param[in] aScanDuration   The duration for the scan, in milliseconds.
+     * @param[in] aHandler        The scan result handler, called with all the results when the scan completes.
+     * @param[in] aResultHandler  The handler called with each result as it is received, may be nullptr.
      *
      */
-    void EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler);
+    void EnergyScan(uint32_t                aScanDuration,
+                    EnergyScanHandler       aHandler,
+                    EnergyScanResultHandler aResultHandler = nullptr);
 
     /**
      * This method attaches the device to the Thread network.
@@ -242,6 +320,85 @@ public:
         return mInstance;
     }
 
+    /**
+     * This method returns the snapshot of the network data, which is only decoded again after it has changed.
+     *
+     * The returned reference is valid until the next call of this method.
+     *
+     * @returns A reference to the network data snapshot.
+     *
+     */
+    const NetworkDataCache::NetworkData &GetNetworkData(void) { return mNetworkDataCache.Get(); }
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method returns the statistics of the SRP server, which are maintained per host by the Advertising Proxy.
+     *
+     * @returns A reference to the SRP server statistics.
+     *
+     */
+    SrpServerStats &GetSrpServerStats(void) { return mSrpServerStats; }
+#endif
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    /**
+     * This method returns the sampler of the link metrics of the neighbor routers.
+     *
+     * @returns A reference to the Link Metrics Sampler.
+     *
+     */
+    const LinkMetricsSampler &GetLinkMetricsSampler(void) const
+    {
+        return mLinkMetricsSampler;
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    /**
+     * This method returns the sampler of the channel occupancies of the channel monitor.
+     *
+     * @returns A reference to the Channel Monitor Sampler.
+     *
+     */
+    const ChannelMonitorSampler &GetChannelMonitorSampler(void) const { return mChannelMonitorSampler; }
+#endif
+
+    /**
+     * This method returns the sampler of the radio coex metrics.
+     *
+     * @returns A reference to the Radio Coex Sampler.
+     *
+     */
+    const RadioCoexSampler &GetRadioCoexSampler(void) const { return mRadioCoexSampler; }
+
+    /**
+     * This method invalidates the cached states which have changed.
+     *
+     * It must be called before any handler of the state changes, so that the handlers read the new states.
+     *
+     * @param[in] aFlags    A bit-field indicating specific state that has changed.  See `OT_CHANGED_*` definitions.
+     *
+     */
+    void InvalidateCaches(otChangedFlags aFlags);
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    /**
+     * This method updates the mainloop context with the netlink socket invalidating the cached infra link info.
+     *
+     * @param[inout] aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Update(MainloopContext &aMainloop);
+
+    /**
+     * This method processes the netlink events invalidating the cached infra link info.
+     *
+     * @param[in] aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Process(const MainloopContext &aMainloop);
+#endif
+
     /**
      * This method handles OpenThread state changed notification.
      *
@@ -282,11 +439,41 @@ public:
      *
      * @param[in] aPublisher     The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
      * @param[in] telemetryData  The telemetry data to be populated.
+     * @param[in] aSections      The bit mask of `TelemetrySection` to populate.
      *
      * @retval OTBR_ERROR_NONE  There is no error happened in the process.
      * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
      */
-    otError RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData);
+    otError RetrieveTelemetryData(Mdns::Publisher              *aPublisher,
+                                  threadnetwork::TelemetryData &telemetryData,
+                                  uint32_t                      aSections = kTelemetryAllSections);
+
+    /**
+     * This method populates the telemetry data like `RetrieveTelemetryData()`, reusing the sections which walk the
+     * device tables if they were retrieved within OTBR_TELEMETRY_DATA_TABLE_REFRESH_INTERVAL_MS.
+     *
+     * The counter sections are always retrieved again. The cached sections are dropped when the device role changes.
+     *
+     * @param[in]  aPublisher      The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[out] aTelemetryData  The telemetry data to be populated.
+     * @param[in]  aSections       The bit mask of `TelemetrySection` to populate.
+     *
+     * @retval OTBR_ERROR_NONE  There is no error happened in retrieving the outdated sections.
+     * @retval OT_ERRROR_FAILED There is one or more error(s) happened in retrieving the outdated sections.
+     */
+    otError RetrieveCachedTelemetryData(Mdns::Publisher              *aPublisher,
+                                        threadnetwork::TelemetryData &aTelemetryData,
+                                        uint32_t                      aSections = kTelemetryAllSections);
+
+    /**
+     * This method copies a latency histogram to its telemetry message.
+     *
+     * @param[in]  aFrom  The latency histogram.
+     * @param[out] aTo    The telemetry message to populate.
+     *
+     */
+    static void CopyMdnsLatencyHistogram(const MdnsLatencyHistogram                        &aFrom,
+                                         threadnetwork::TelemetryData_MdnsLatencyHistogram *aTo);
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
     /**
@@ -318,6 +505,9 @@ public:
     static otError ProcessDatasetForMigration(otOperationalDatasetTlvs &aDatasetTlvs, uint32_t aDelayMilli);
 
 private:
+    using ActiveScanCache = ScanCache<otActiveScanResult>;
+    using EnergyScanCache = ScanCache<otEnergyScanResult>;
+
     static void ActiveScanHandler(otActiveScanResult *aResult, void *aThreadHelper);
     void        ActiveScanHandler(otActiveScanResult *aResult);
 
@@ -345,6 +535,7 @@ private:
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 #if OTBR_ENABLE_BORDER_ROUTING
     void RetrieveInfraLinkInfo(threadnetwork::TelemetryData::InfraLinkInfo &aInfraLinkInfo);
+    void ReceiveInfraLinkNetlinkMessages(void);
     void RetrieveExternalRouteInfo(threadnetwork::TelemetryData::ExternalRoutes &aExternalRouteInfo);
 #endif
 #if OTBR_ENABLE_DHCP6_PD
@@ -361,13 +552,19 @@ private:
 
     otbr::Ncp::RcpHost *mHost;
 
-    ScanHandler                     mScanHandler;
-    std::vector<otActiveScanResult> mScanResults;
-    EnergyScanHandler               mEnergyScanHandler;
-    std::vector<otEnergyScanResult> mEnergyScanResults;
+    ActiveScanCache  mScanCache;
+    EnergyScanCache  mEnergyScanCache;
+    NetworkDataCache mNetworkDataCache;
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    SrpServerStats mSrpServerStats;
+#endif
 
     std::vector<DeviceRoleHandler>    mDeviceRoleHandlers;
     std::vector<DatasetChangeHandler> mActiveDatasetChangeHandlers;
+    // The active dataset last notified to the handlers, which all refer to it, so that the notifications of an
+    // unchanged dataset are suppressed.
+    otOperationalDatasetTlvs mActiveDatasetTlvs = {};
 
     std::map<uint16_t, size_t> mUnsecurePortRefCounter;
 
@@ -385,6 +582,7 @@ private:
 
 #if OTBR_ENABLE_DHCP6_PD
     Dhcp6PdStateCallback mDhcp6PdCallback;
+    Dhcp6PdLeaseKeeper   mDhcp6PdLeaseKeeper;
 #endif
 
 #if OTBR_ENABLE_DBUS_SERVER
@@ -395,6 +593,41 @@ private:
     static constexpr uint8_t kNat64PdCommonHashSaltLength = 16;
     uint8_t                  mNat64PdCommonSalt[kNat64PdCommonHashSaltLength];
 #endif
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    // The addresses and the flags of the infra link only change with a netlink event.
+    int                                         mInfraLinkNetlinkFd = -1;
+    uint32_t                                    mInfraLinkIndex     = 0;
+    bool                                        mInfraLinkInfoValid = false;
+    threadnetwork::TelemetryData::InfraLinkInfo mInfraLinkInfo;
+    bool                                        mPeerBrCountValid = false;
+    uint32_t                                    mPeerBrCount      = 0;
+    Timepoint                                   mPeerBrCountTime;
+#endif
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_DHCP6_PD
+    // The hashed PD prefix only changes with the PD prefix or the salt.
+    bool        mHashedPdPrefixValid = false;
+    uint8_t     mHashedPdPrefixSource[OT_IP6_PREFIX_SIZE];
+    uint8_t     mHashedPdPrefixSalt[kNat64PdCommonHashSaltLength];
+    std::string mHashedPdPrefix;
+#endif
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    threadnetwork::TelemetryData mTelemetryCache;
+    uint32_t                     mTelemetryCachedSections = 0;
+    Timepoint                    mTelemetryRefreshTime[kTelemetrySectionCount];
+#endif
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    LinkMetricsSampler mLinkMetricsSampler;
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    ChannelMonitorSampler mChannelMonitorSampler;
+#endif
+
+    RadioCoexSampler mRadioCoexSampler;
 };
 
 } // namespace agent
@@ -50,7 +50,17 @@
             };
         });
 
-    function AppCtrl($scope, $http, $mdDialog, $interval, sharedProperties) {
+    function AppCtrl($scope, $http, $mdDialog, $interval, $q, $timeout, sharedProperties) {
+        // Scan, join and commission run as jobs on the server, their result is polled until the job is finished.
+        function waitForJob(response) {
+            if (response.data.job === undefined) {
+                return $q.resolve(response);
+            }
+            return $timeout(function() {
+                return $http.get('jobs/' + response.data.job);
+            }, 500).then(waitForJob);
+        }
+
         $scope.menu = [{
                 title: 'Home',
                 icon: 'home',
@@ -110,6 +120,47 @@
 
         $scope.isLoading = false;
 
+        function updateStatus(statusJson) {
+            $scope.status = [];
+            for (var i = 0; i < Object.keys(statusJson).length; i++) {
+                $scope.status.push({
+                    name: Object.keys(statusJson)[i],
+                    value: statusJson[Object.keys(statusJson)[i]],
+                    icon: 'res/img/icon-info.png',
+                });
+            }
+        }
+
+        // The server pushes the status and the scanned networks to all the open pages, instead of each polling them.
+        function connectWebSocket() {
+            var url = new URL('ws', window.location.href);
+            var socket;
+
+            url.protocol = url.protocol.replace('http', 'ws');
+            socket = new WebSocket(url.href);
+            socket.onmessage = function(event) {
+                var message = JSON.parse(event.data);
+
+                if (message.data.error != 0) {
+                    return;
+                }
+                $scope.$apply(function() {
+                    if (message.type == 'properties') {
+                        updateStatus(message.data.result);
+                    } else if (message.type == 'available_network') {
+                        $scope.networksInfo = message.data.result;
+                    }
+                });
+            };
+            socket.onclose = function() {
+                $timeout(connectWebSocket, 5000);
+            };
+        }
+
+        if (window.WebSocket) {
+            connectWebSocket();
+        }
+
         $scope.showScanAlert = function(ev) {
             $mdDialog.show(
                 $mdDialog.alert()
@@ -130,7 +181,7 @@
             $scope.menu[index].show = true;
             if (index == 1) {
                 $scope.isLoading = true;
-                $http.get('available_network').then(function(response) {
+                $http.get('available_network').then(waitForJob).then(function(response) {
                     $scope.isLoading = false;
                     if (response.data.error == 0) {
                         $scope.networksInfo = response.data.result;
@@ -143,15 +194,7 @@
                 $http.get('get_properties').then(function(response) {
                     console.log(response);
                     if (response.data.error == 0) {
-                        var statusJson = response.data.result;
-                        $scope.status = [];
-                        for (var i = 0; i < Object.keys(statusJson).length; i++) {
-                            $scope.status.push({
-                                name: Object.keys(statusJson)[i],
-                                value: statusJson[Object.keys(statusJson)[i]],
-                                icon: 'res/img/icon-info.png',
-                            });
-                        }
+                        updateStatus(response.data.result);
                     }
                 });
             }
@@ -261,7 +304,7 @@
                     data: data,
                 });
 
-                httpRequest.then(function successCallback(response) {
+                httpRequest.then(waitForJob).then(function successCallback(response) {
                     $scope.res = response.data.result;
                     if (response.data.result == 'successful') {
                         $mdDialog.hide();
@@ -422,7 +465,7 @@
             
             ev.target.disabled = true;
             
-            httpRequest.then(function successCallback(response) {
+            httpRequest.then(waitForJob).then(function successCallback(response) {
                 if (response.data.error == 0) {
                     $scope.showAlert(event, 'Commission', 'success');
                 } else {
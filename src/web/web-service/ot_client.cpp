@@ -38,6 +38,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <poll.h>
 #include <string.h>
 #include <sys/select.h>
 #include <sys/socket.h>
@@ -46,6 +47,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 
 // Temporary solution before posix platform header files are cleaned up.
 #ifndef OPENTHREAD_POSIX_DAEMON_SOCKET_NAME
@@ -138,16 +140,13 @@ void OpenThreadClient::DiscardRead(void)
 
 char *OpenThreadClient::Execute(const char *aFormat, ...)
 {
-    va_list args;
-    int     ret;
-    char   *rval = nullptr;
-    ssize_t count;
-    size_t  rxLength = 0;
-
-    DiscardRead();
+    va_list                  args;
+    int                      ret;
+    char                    *rval = nullptr;
+    std::vector<std::string> outputs;
 
     va_start(args, aFormat);
-    ret = vsnprintf(&mBuffer[1], sizeof(mBuffer) - 2, aFormat, args);
+    ret = vsnprintf(mBuffer, sizeof(mBuffer) - 2, aFormat, args);
     va_end(args);
 
     if (ret < 0)
@@ -161,55 +160,104 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
         ExitNow();
     }
 
-    mBuffer[0]       = '\n';
-    mBuffer[ret + 1] = '\n';
-    ret += 2;
+    VerifyOrExit(ExecuteBatch({mBuffer}, outputs));
+    VerifyOrExit(outputs[0].size() < sizeof(mBuffer), otbrLogErr("Output exceeds maximum limit: %d", kBufferSize));
+
+    memcpy(mBuffer, outputs[0].c_str(), outputs[0].size() + 1);
+    rval = mBuffer;
+
+exit:
+    return rval;
+}
+
+bool OpenThreadClient::ExecuteBatch(const std::vector<std::string> &aCommands, std::vector<std::string> &aOutputs)
+{
+    // The leading empty line discards any partial input of the CLI.
+    std::string request = "\n";
+    std::string line;
+    std::string output;
+    Timepoint   deadline;
+    ssize_t     count;
+    bool        rval = false;
 
-    count = write(mSocket, mBuffer, ret);
+    DiscardRead();
+    aOutputs.clear();
 
-    if (count != ret)
+    for (const std::string &command : aCommands)
     {
-        mBuffer[ret] = '\0';
-        otbrLogErr("Failed to send command: %s", mBuffer);
+        request += command + "\n";
+    }
+
+    count = write(mSocket, request.data(), request.size());
+
+    if (count < 0 || static_cast<size_t>(count) != request.size())
+    {
+        otbrLogErr("Failed to send commands: %s", request.c_str());
         ExitNow();
     }
 
-    for (int i = 0; i < mTimeout; ++i)
+    deadline = Clock::now() + Milliseconds(mTimeout);
+
+    // The output is tokenized into lines as it is received. The prompt preceding the output of the next command is
+    // not terminated by a line break, so it's stripped from the beginning of the lines.
+    while (aOutputs.size() < aCommands.size())
     {
-        fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char   *done;
+        struct pollfd pollFd  = {mSocket, POLLIN, 0};
+        auto          timeout = std::chrono::duration_cast<Milliseconds>(deadline - Clock::now()).count();
+        int           ret;
 
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+        VerifyOrExit(timeout > 0, otbrLogErr("Timed out waiting for command: %s", aCommands[aOutputs.size()].c_str()));
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
+        ret = poll(&pollFd, 1, static_cast<int>(timeout));
         VerifyOrExit(ret != -1 || errno == EINTR);
         if (ret <= 0)
         {
             continue;
         }
 
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
+        count = read(mSocket, mBuffer, sizeof(mBuffer));
         VerifyOrExit(count > 0);
-        rxLength += count;
-
-        mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n> ");
 
-        if (done != nullptr)
+        for (ssize_t i = 0; i < count && aOutputs.size() < aCommands.size(); i++)
         {
-            // remove trailing \r\n
-            if (done - mBuffer > 2)
+            if (mBuffer[i] != '\n')
             {
-                done[-2] = '\0';
+                line.push_back(mBuffer[i]);
+                continue;
             }
 
-            rval = mBuffer;
-            break;
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+
+            while (line.compare(0, 2, "> ") == 0)
+            {
+                line.erase(0, 2);
+            }
+
+            if (line == "Done")
+            {
+                aOutputs.push_back(std::move(output));
+                output.clear();
+                deadline = Clock::now() + Milliseconds(mTimeout);
+            }
+            else if (line.compare(0, 6, "Error ") == 0)
+            {
+                otbrLogErr("Command %s failed: %s", aCommands[aOutputs.size()].c_str(), line.c_str());
+                ExitNow();
+            }
+            else if (!line.empty())
+            {
+                output += (output.empty() ? "" : "\r\n") + line;
+            }
+
+            line.clear();
         }
     }
 
+    rval = true;
+
 exit:
     return rval;
 }
@@ -36,6 +36,9 @@
 
 #include "openthread-br/config.h"
 
+#include <string>
+#include <vector>
+
 #include <stdint.h>
 
 namespace otbr {
@@ -101,6 +104,21 @@ public:
      */
     char *Execute(const char *aFormat, ...);
 
+    /**
+     * This method executes a batch of OpenThread CLI commands in a single round-trip.
+     *
+     * The commands are sent at once and their outputs are parsed as they are received. Only the commands which
+     * complete without waiting for the Thread network, e.g. getting properties, should be batched.
+     *
+     * @param[in]  aCommands  The commands.
+     * @param[out] aOutputs   The output of each command succeeded, without the prompts and the `Done` line.
+     *
+     * @retval TRUE   All the commands succeeded.
+     * @retval FALSE  A command failed or didn't complete in time.
+     *
+     */
+    bool ExecuteBatch(const std::vector<std::string> &aCommands, std::vector<std::string> &aOutputs);
+
     /**
      * This method reads from OpenThread CLI.
      *
@@ -35,6 +35,9 @@
 
 #include "web/web-service/web_server.hpp"
 
+#include <inttypes.h>
+#include <stdio.h>
+
 #define BOOST_NO_CXX11_SCOPED_ENUMS
 #include <boost/filesystem.hpp>
 #undef BOOST_NO_CXX11_SCOPED_ENUMS
@@ -53,16 +56,28 @@
 #define OT_GET_QRCODE_PATH "^/get_qrcode$"
 #define OT_SET_NETWORK_PATH "^/settings$"
 #define OT_COMMISSIONER_START_PATH "^/commission$"
+#define OT_GET_JOB_PATH "^/jobs/([0-9]+)$"
+#define OT_WEB_SOCKET_PATH "/ws"
 #define OT_REQUEST_METHOD_GET "GET"
 #define OT_REQUEST_METHOD_POST "POST"
 #define OT_RESPONSE_SUCCESS_STATUS "HTTP/1.1 200 OK\r\n"
 #define OT_RESPONSE_HEADER_LENGTH "Content-Length: "
 #define OT_RESPONSE_HEADER_CSS_TYPE "\r\nContent-Type: text/css"
 #define OT_RESPONSE_HEADER_TEXT_HTML_TYPE "\r\nContent-Type: text/html; charset=utf-8"
+#define OT_RESPONSE_HEADER_JS_TYPE "\r\nContent-Type: application/javascript"
+#define OT_RESPONSE_HEADER_JSON_TYPE "\r\nContent-Type: application/json"
+#define OT_RESPONSE_HEADER_PNG_TYPE "\r\nContent-Type: image/png"
+#define OT_RESPONSE_HEADER_SVG_TYPE "\r\nContent-Type: image/svg+xml"
+#define OT_RESPONSE_HEADER_ICON_TYPE "\r\nContent-Type: image/x-icon"
+#define OT_RESPONSE_HEADER_ETAG "\r\nETag: "
+#define OT_RESPONSE_HEADER_CACHE_CONTROL "\r\nCache-Control: "
+#define OT_RESPONSE_HEADER_VARY "\r\nVary: Accept-Encoding"
+#define OT_RESPONSE_HEADER_GZIP_ENCODING "\r\nContent-Encoding: gzip"
 #define OT_RESPONSE_HEADER_TYPE "Content-Type: application/json\r\n charset=utf-8"
 #define OT_RESPONSE_PLACEHOLD "\r\n\r\n"
 #define OT_RESPONSE_FAILURE_STATUS "HTTP/1.1 400 Bad Request\r\n"
-#define OT_BUFFER_SIZE 1024
+#define OT_RESPONSE_NOT_MODIFIED_STATUS "HTTP/1.1 304 Not Modified\r\nContent-Length: 0"
+#define OT_ASSET_GZIP_EXTENSION ".gz"
 
 namespace otbr {
 namespace Web {
@@ -102,11 +117,16 @@ static void EscapeHtml(std::string &content)
 
 WebServer::WebServer(void)
     : mServer(new HttpServer())
+    , mNextJobId(1)
+    , mJobWorkerStopping(false)
+    , mWebSocketHub("properties", [this]() { return mWpanService.HandleStatusRequest(); })
 {
 }
 
 WebServer::~WebServer(void)
 {
+    StopJobWorker();
+    mWebSocketHub.Stop();
     delete mServer;
 }
 
@@ -129,6 +149,7 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     mServer->config.port = aPort;
     mWpanService.SetInterfaceName(aIfName);
     Init();
+    LoadAssets();
     ResponseGetQRCode();
     ResponseJoinNetwork();
     ResponseFormNetwork();
@@ -137,7 +158,10 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     ResponseGetStatus();
     ResponseGetAvailableNetwork();
     ResponseCommission();
+    ResponseGetJob();
+    ResponseWebSocket();
     DefaultHttpResponse();
+    StartJobWorker();
 
     try
     {
@@ -147,6 +171,10 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
         otbrLogCrit("failed to start web server: %s", e.what());
         abort();
     }
+
+    // The server is stopped from the signal handler, the worker is joined here instead.
+    StopJobWorker();
+    mWebSocketHub.Stop();
 }
 
 void WebServer::StopWebServer(void)
@@ -184,94 +212,340 @@ void WebServer::HandleHttpRequest(const char *aUrl, const char *aMethod, HttpReq
     };
 }
 
-void DefaultResourceSend(const HttpServer                            &aServer,
-                         const std::shared_ptr<HttpServer::Response> &aResponse,
-                         const std::shared_ptr<std::ifstream>        &aIfStream)
+void WebServer::ResponseGetJob(void)
+{
+    mServer->resource[OT_GET_JOB_PATH][OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
+                                                                       std::shared_ptr<HttpServer::Request>  request) {
+        try
+        {
+            std::string httpResponse = GetJobResponse(static_cast<uint32_t>(std::stoul(request->path_match[1])));
+
+            *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << httpResponse.length()
+                      << OT_RESPONSE_PLACEHOLD << httpResponse;
+        } catch (std::exception &e)
+        {
+            std::string content = e.what();
+            EscapeHtml(content);
+            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
+                      << OT_RESPONSE_PLACEHOLD << content;
+        }
+    };
+}
+
+void WebServer::ResponseWebSocket(void)
+{
+    mServer->on_upgrade = [this](std::unique_ptr<SimpleWeb::HTTP>     &socket,
+                                 std::shared_ptr<HttpServer::Request>  request) {
+        auto upgrade = request->header.find("Upgrade");
+        auto key     = request->header.find("Sec-WebSocket-Key");
+
+        // Any other upgrade is refused by closing the connection.
+        if (request->path == OT_WEB_SOCKET_PATH && upgrade != request->header.end() &&
+            SimpleWeb::case_insensitive_equal(upgrade->second, "websocket"))
+        {
+            mWebSocketHub.Accept(mServer->io_service, socket, key == request->header.end() ? "" : key->second);
+        }
+    };
+}
+
+std::string WebServer::PostJob(JobHandler aHandler)
+{
+    Json::Value                 root;
+    Json::FastWriter            jsonWriter;
+    std::lock_guard<std::mutex> lock(mJobMutex);
+
+    RemoveExpiredJobResults(Clock::now());
+
+    if (mJobQueue.size() >= OTBR_WEB_MAX_PENDING_JOBS)
+    {
+        root["error"]   = 1;
+        root["result"]  = "failed";
+        root["message"] = "Too many pending operations, please retry later.";
+    }
+    else
+    {
+        uint32_t jobId = mNextJobId++;
+
+        mJobQueue.push_back({jobId, std::move(aHandler)});
+        mJobResults[jobId].mDone = false;
+        mJobCondition.notify_one();
+
+        root["error"] = 0;
+        root["job"]   = jobId;
+        root["state"] = "pending";
+    }
+
+    return jsonWriter.write(root);
+}
+
+std::string WebServer::GetJobResponse(uint32_t aJobId)
 {
-    static std::vector<char> buffer(OT_BUFFER_SIZE); // Safe when server is running on one thread
+    Json::Value                 root;
+    Json::FastWriter            jsonWriter;
+    std::string                 response;
+    std::lock_guard<std::mutex> lock(mJobMutex);
+    auto                        it = mJobResults.find(aJobId);
 
-    std::streamsize readLength;
+    if (it == mJobResults.end())
+    {
+        root["error"]   = 1;
+        root["result"]  = "failed";
+        root["message"] = "The operation is unknown or its result has expired.";
+        response        = jsonWriter.write(root);
+    }
+    else if (!it->second.mDone)
+    {
+        root["error"] = 0;
+        root["job"]   = aJobId;
+        root["state"] = "pending";
+        response      = jsonWriter.write(root);
+    }
+    else
+    {
+        // The result is only delivered once, to the client which posted the job.
+        response = std::move(it->second.mResponse);
+        mJobResults.erase(it);
+    }
+
+    return response;
+}
 
-    if ((readLength = aIfStream->read(&buffer[0], buffer.size()).gcount()) > 0)
+void WebServer::RemoveExpiredJobResults(Timepoint aNow)
+{
+    for (auto it = mJobResults.begin(); it != mJobResults.end();)
     {
-        aResponse->write(&buffer[0], readLength);
-        if (readLength == static_cast<std::streamsize>(buffer.size()))
+        if (it->second.mDone && aNow >= it->second.mExpireTime)
         {
-            aResponse->send([&aServer, aResponse, aIfStream](const boost::system::error_code &ec) {
-                if (!ec)
-                {
-                    DefaultResourceSend(aServer, aResponse, aIfStream);
-                }
-                else
-                {
-                    std::cerr << "Connection interrupted" << std::endl;
-                }
-            });
+            it = mJobResults.erase(it);
+        }
+        else
+        {
+            ++it;
         }
     }
 }
 
-void WebServer::DefaultHttpResponse(void)
+void WebServer::StartJobWorker(void)
 {
-    mServer->default_resource[OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
-                                                              std::shared_ptr<HttpServer::Request>  request) {
+    mJobWorkerStopping = false;
+    mJobWorker         = std::thread(&WebServer::RunJobs, this);
+}
+
+void WebServer::StopJobWorker(void)
+{
+    VerifyOrExit(mJobWorker.joinable());
+
+    {
+        std::lock_guard<std::mutex> lock(mJobMutex);
+
+        mJobWorkerStopping = true;
+        mJobCondition.notify_one();
+    }
+
+    mJobWorker.join();
+
+exit:
+    return;
+}
+
+void WebServer::RunJobs(void)
+{
+    std::unique_lock<std::mutex> lock(mJobMutex);
+
+    // The jobs are run one at a time, a join relies on the networks found by the previous scan.
+    while (true)
+    {
+        Job         job;
+        std::string response;
+
+        mJobCondition.wait(lock, [this]() { return mJobWorkerStopping || !mJobQueue.empty(); });
+        VerifyOrExit(!mJobWorkerStopping);
+
+        job = std::move(mJobQueue.front());
+        mJobQueue.pop_front();
+
+        lock.unlock();
         try
         {
-            auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
-            auto path        = boost::filesystem::canonical(webRootPath / request->path);
+            response = job.mHandler();
+        } catch (const std::exception &e)
+        {
+            Json::Value      root;
+            Json::FastWriter jsonWriter;
+
+            otbrLogWarning("Job %u failed: %s", job.mId, e.what());
+            root["error"]   = 1;
+            root["result"]  = "failed";
+            root["message"] = e.what();
+            response        = jsonWriter.write(root);
+        }
+        lock.lock();
+
+        JobResult &result = mJobResults[job.mId];
+
+        result.mDone       = true;
+        result.mResponse   = std::move(response);
+        result.mExpireTime = Clock::now() + Milliseconds(OTBR_WEB_JOB_RESULT_KEEP_TIME_MS);
+    }
+
+exit:
+    return;
+}
+
+static std::string ComputeEtag(const std::string &aContent)
+{
+    uint64_t hash = 14695981039346656037ull;
+    char     etag[sizeof("\"ffffffffffffffff-ffffffffffffffff\"")];
+
+    for (unsigned char c : aContent)
+    {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+
+    snprintf(etag, sizeof(etag), "\"%" PRIx64 "-%zx\"", hash, aContent.size());
+
+    return etag;
+}
+
+static const char *GetContentType(const std::string &aExtension)
+{
+    static const struct
+    {
+        const char *mExtension;
+        const char *mContentType;
+    } kContentTypes[] = {
+        {".css", OT_RESPONSE_HEADER_CSS_TYPE},   {".html", OT_RESPONSE_HEADER_TEXT_HTML_TYPE},
+        {".js", OT_RESPONSE_HEADER_JS_TYPE},     {".json", OT_RESPONSE_HEADER_JSON_TYPE},
+        {".png", OT_RESPONSE_HEADER_PNG_TYPE},   {".svg", OT_RESPONSE_HEADER_SVG_TYPE},
+        {".ico", OT_RESPONSE_HEADER_ICON_TYPE},
+    };
+
+    const char *contentType = "";
+
+    for (const auto &entry : kContentTypes)
+    {
+        if (aExtension == entry.mExtension)
+        {
+            contentType = entry.mContentType;
+            break;
+        }
+    }
+
+    return contentType;
+}
+
+static bool ReadFile(const boost::filesystem::path &aPath, std::string &aContent)
+{
+    std::ifstream ifs(aPath.string(), std::ifstream::in | std::ios::binary);
+
+    aContent.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+    return !ifs.bad();
+}
 
-            // Check if path is within webRootPath
-            if (std::distance(webRootPath.begin(), webRootPath.end()) > std::distance(path.begin(), path.end()) ||
-                !std::equal(webRootPath.begin(), webRootPath.end(), path.begin()))
+void WebServer::LoadAssets(void)
+{
+    size_t totalSize = 0;
+
+    mAssets.clear();
+
+    try
+    {
+        auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
+
+        for (boost::filesystem::recursive_directory_iterator it(webRootPath), end; it != end; ++it)
+        {
+            const boost::filesystem::path &path = it->path();
+            Asset                          asset;
+
+            // The precompressed variants are loaded along with the asset they are compressed from.
+            if (!boost::filesystem::is_regular_file(path) || path.extension() == OT_ASSET_GZIP_EXTENSION)
             {
-                throw std::invalid_argument("path must be within root path");
+                continue;
             }
-            if (boost::filesystem::is_directory(path))
+
+            if (!ReadFile(path, asset.mContent))
             {
-                path /= "index.html";
+                otbrLogWarning("Failed to read asset %s", path.c_str());
+                continue;
             }
-            if (!(boost::filesystem::exists(path) && boost::filesystem::is_regular_file(path)))
+
+            if (boost::filesystem::is_regular_file(path.string() + OT_ASSET_GZIP_EXTENSION) &&
+                !ReadFile(path.string() + OT_ASSET_GZIP_EXTENSION, asset.mGzipContent))
             {
-                throw std::invalid_argument("file does not exist");
+                asset.mGzipContent.clear();
             }
 
-            std::string cacheControl, etag;
+            asset.mContentType = GetContentType(path.extension().string());
+            asset.mEtag        = ComputeEtag(asset.mContent);
+            totalSize += asset.mContent.size() + asset.mGzipContent.size();
 
-            auto ifs = std::make_shared<std::ifstream>();
-            ifs->open(path.string(), std::ifstream::in | std::ios::binary | std::ios::ate);
-            std::string extension = path.extension().string();
-            std::string header    = "";
-            if (extension == ".css")
-            {
-                header = OT_RESPONSE_HEADER_CSS_TYPE;
-            }
-            else if (extension == ".html")
-            {
-                header = OT_RESPONSE_HEADER_TEXT_HTML_TYPE;
-            }
+            // The assets are looked up by the request path, which is relative to the web root.
+            mAssets[path.string().substr(webRootPath.string().size())] = std::move(asset);
+        }
+    } catch (const std::exception &e)
+    {
+        otbrLogWarning("Failed to load the web assets: %s", e.what());
+    }
 
-            if (*ifs)
-            {
-                auto length = ifs->tellg();
-                ifs->seekg(0, std::ios::beg);
+    otbrLogInfo("Loaded %zu web assets of %zu bytes", mAssets.size(), totalSize);
+}
 
-                *response << OT_RESPONSE_SUCCESS_STATUS << cacheControl << etag << OT_RESPONSE_HEADER_LENGTH << length
-                          << header << OT_RESPONSE_PLACEHOLD;
+const WebServer::Asset *WebServer::FindAsset(const std::string &aPath) const
+{
+    auto it = mAssets.find(aPath);
 
-                DefaultResourceSend(*mServer, response, ifs);
-            }
-            else
-            {
-                throw std::invalid_argument("could not read file");
-            }
+    if (it == mAssets.end())
+    {
+        it = mAssets.find(aPath + (aPath.empty() || aPath.back() != '/' ? "/" : "") + "index.html");
+    }
 
-        } catch (const std::exception &e)
+    return it == mAssets.end() ? nullptr : &it->second;
+}
+
+void WebServer::DefaultHttpResponse(void)
+{
+    mServer->default_resource[OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
+                                                              std::shared_ptr<HttpServer::Request>  request) {
+        // Only the assets loaded from the web root are served, so the request path can't escape it.
+        const Asset *asset = FindAsset(request->path);
+
+        if (asset == nullptr)
         {
-            std::string content = "Could not open path `" + request->path + "`: " + e.what();
+            std::string content = "Could not open path `" + request->path + "`: file does not exist";
+
             EscapeHtml(content);
             *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
                       << OT_RESPONSE_PLACEHOLD << content;
         }
+        else
+        {
+            auto        ifNoneMatch    = request->header.find("If-None-Match");
+            auto        acceptEncoding = request->header.find("Accept-Encoding");
+            std::string cacheControl   = "no-cache";
+            bool        gzip;
+
+            gzip = !asset->mGzipContent.empty() && acceptEncoding != request->header.end() &&
+                   acceptEncoding->second.find("gzip") != std::string::npos;
+#if OTBR_WEB_ASSET_MAX_AGE > 0
+            cacheControl = "max-age=" + std::to_string(OTBR_WEB_ASSET_MAX_AGE);
+#endif
+
+            if (ifNoneMatch != request->header.end() && ifNoneMatch->second == asset->mEtag)
+            {
+                *response << OT_RESPONSE_NOT_MODIFIED_STATUS << OT_RESPONSE_HEADER_ETAG << asset->mEtag
+                          << OT_RESPONSE_HEADER_CACHE_CONTROL << cacheControl << OT_RESPONSE_PLACEHOLD;
+            }
+            else
+            {
+                const std::string &body = gzip ? asset->mGzipContent : asset->mContent;
+
+                *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << body.size()
+                          << asset->mContentType << OT_RESPONSE_HEADER_ETAG << asset->mEtag
+                          << OT_RESPONSE_HEADER_CACHE_CONTROL << cacheControl << OT_RESPONSE_HEADER_VARY
+                          << (gzip ? OT_RESPONSE_HEADER_GZIP_ENCODING : "") << OT_RESPONSE_PLACEHOLD << body;
+            }
+        }
     };
 }
 
@@ -374,7 +648,7 @@ void WebServer::ResponseCommission(void)
 
 std::string WebServer::HandleJoinNetworkRequest(const std::string &aJoinRequest)
 {
-    return mWpanService.HandleJoinNetworkRequest(aJoinRequest);
+    return PostJob([this, aJoinRequest]() { return mWpanService.HandleJoinNetworkRequest(aJoinRequest); });
 }
 
 std::string WebServer::HandleGetQRCodeRequest(const std::string &aGetQRCodeRequest)
@@ -407,12 +681,19 @@ std::string WebServer::HandleGetStatusRequest(const std::string &aGetStatusReque
 std::string WebServer::HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest)
 {
     OTBR_UNUSED_VARIABLE(aGetAvailableNetworkRequest);
-    return mWpanService.HandleAvailableNetworkRequest();
+    return PostJob([this]() {
+        std::string response = mWpanService.HandleAvailableNetworkRequest();
+
+        // The other pages are pushed the networks found by the scan.
+        mWebSocketHub.Publish("available_network", response);
+
+        return response;
+    });
 }
 
 std::string WebServer::HandleCommission(const std::string &aCommissionRequest)
 {
-    return mWpanService.HandleCommission(aCommissionRequest);
+    return PostJob([this, aCommissionRequest]() { return mWpanService.HandleCommission(aCommissionRequest); });
 }
 
 } // namespace Web
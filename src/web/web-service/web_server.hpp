@@ -37,9 +37,15 @@
 #include "openthread-br/config.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <net/if.h>
@@ -47,8 +53,34 @@
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include "web/web-service/web_socket_hub.hpp"
 #include "web/web-service/wpan_service.hpp"
 
+/**
+ * The maximum number of long operations (scan, join and commission) waiting for the job worker.
+ *
+ */
+#ifndef OTBR_WEB_MAX_PENDING_JOBS
+#define OTBR_WEB_MAX_PENDING_JOBS 8
+#endif
+
+/**
+ * The time the result of a finished job is kept for, until it is polled by the client.
+ *
+ */
+#ifndef OTBR_WEB_JOB_RESULT_KEEP_TIME_MS
+#define OTBR_WEB_JOB_RESULT_KEEP_TIME_MS 60000
+#endif
+
+/**
+ * The time (in seconds) the browsers may use the frontend assets without revalidating their ETag, 0 to always
+ * revalidate them.
+ *
+ */
+#ifndef OTBR_WEB_ASSET_MAX_AGE
+#define OTBR_WEB_ASSET_MAX_AGE 0
+#endif
+
 namespace SimpleWeb {
 template <class T> class Server;
 typedef boost::asio::ip::tcp::socket HTTP;
@@ -96,6 +128,29 @@ public:
 
 private:
     typedef std::string (*HttpRequestCallback)(const std::string &aRequest, void *aUserData);
+    using JobHandler = std::function<std::string(void)>;
+
+    struct Job
+    {
+        uint32_t   mId;
+        JobHandler mHandler;
+    };
+
+    struct JobResult
+    {
+        bool        mDone;
+        std::string mResponse;
+        Timepoint   mExpireTime;
+    };
+
+    struct Asset
+    {
+        std::string mContent;
+        std::string mGzipContent; ///< Empty if the asset has no precompressed variant.
+        std::string mEtag;
+        const char *mContentType; ///< The Content-Type header line, empty if unknown.
+    };
+
     static std::string HandleJoinNetworkRequest(const std::string &aJoinRequest, void *aUserData);
     static std::string HandleGetQRCodeRequest(const std::string &aGetQRCodeRequest, void *aUserData);
     static std::string HandleFormNetworkRequest(const std::string &aFormRequest, void *aUserData);
@@ -125,11 +180,31 @@ private:
     void ResponseGetAvailableNetwork(void);
     void DefaultHttpResponse(void);
     void ResponseCommission(void);
-
-    void Init(void);
-
-    HttpServer            *mServer;
-    otbr::Web::WpanService mWpanService;
+    void ResponseGetJob(void);
+    void ResponseWebSocket(void);
+
+    std::string PostJob(JobHandler aHandler);
+    std::string GetJobResponse(uint32_t aJobId);
+    void        RemoveExpiredJobResults(Timepoint aNow);
+    void        StartJobWorker(void);
+    void        StopJobWorker(void);
+    void        RunJobs(void);
+
+    void         Init(void);
+    void         LoadAssets(void);
+    const Asset *FindAsset(const std::string &aPath) const;
+
+    HttpServer                   *mServer;
+    otbr::Web::WpanService        mWpanService;
+    std::thread                   mJobWorker;
+    std::mutex                    mJobMutex;
+    std::condition_variable       mJobCondition;
+    std::deque<Job>               mJobQueue;
+    std::map<uint32_t, JobResult> mJobResults;
+    uint32_t                      mNextJobId;
+    bool                          mJobWorkerStopping;
+    std::map<std::string, Asset>  mAssets;
+    WebSocketHub                  mWebSocketHub;
 };
 
 } // namespace Web
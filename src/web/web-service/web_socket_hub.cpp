@@ -0,0 +1,509 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the WebSocket clients of the web server.
+ */
+
+#define OTBR_LOG_TAG "WEB"
+
+#include "web/web-service/web_socket_hub.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <mbedtls/base64.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Web {
+
+// The GUID appended to the key of the handshake, see RFC 6455
+static const char kAcceptGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// Maximum length of the payload of a frame sent by a client, which only sends control frames
+static const size_t kMaxPayloadLength = 4096;
+
+// Maximum number of frames waiting to be sent to a client, a client which doesn't keep up is dropped
+static const size_t kMaxQueuedFrames = 16;
+
+static const size_t kSha1Size = 20;
+
+static uint32_t RotateLeft(uint32_t aValue, uint8_t aBits)
+{
+    return (aValue << aBits) | (aValue >> (32 - aBits));
+}
+
+// The WebSocket handshake requires SHA-1, which isn't enabled in the mbedtls configuration of OpenThread.
+static void Sha1(const std::string &aInput, uint8_t aDigest[kSha1Size])
+{
+    uint32_t    state[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+    std::string message  = aInput;
+    uint64_t    bitLength = static_cast<uint64_t>(aInput.size()) * 8;
+
+    // Pad the message with a bit '1', zeros and the length in bits to a multiple of 64 bytes.
+    message.push_back(static_cast<char>(0x80));
+    while (message.size() % 64 != 56)
+    {
+        message.push_back(0);
+    }
+    for (int shift = 56; shift >= 0; shift -= 8)
+    {
+        message.push_back(static_cast<char>(bitLength >> shift));
+    }
+
+    for (size_t offset = 0; offset < message.size(); offset += 64)
+    {
+        uint32_t words[80];
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+        for (int i = 0; i < 16; i++)
+        {
+            const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&message[offset + i * 4]);
+
+            words[i] = (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+                       (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+        }
+        for (int i = 16; i < 80; i++)
+        {
+            words[i] = RotateLeft(words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16], 1);
+        }
+
+        for (int i = 0; i < 80; i++)
+        {
+            uint32_t f;
+            uint32_t k;
+            uint32_t temp;
+
+            if (i < 20)
+            {
+                f = (b & c) | (~b & d);
+                k = 0x5a827999;
+            }
+            else if (i < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ed9eba1;
+            }
+            else if (i < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8f1bbcdc;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xca62c1d6;
+            }
+
+            temp = RotateLeft(a, 5) + f + e + k + words[i];
+            e    = d;
+            d    = c;
+            c    = RotateLeft(b, 30);
+            b    = a;
+            a    = temp;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+
+    for (int i = 0; i < 20; i++)
+    {
+        aDigest[i] = static_cast<uint8_t>(state[i / 4] >> (24 - (i % 4) * 8));
+    }
+}
+
+WebSocketHub::Client::Client(std::unique_ptr<boost::asio::ip::tcp::socket> aSocket)
+    : mSocket(std::move(aSocket))
+    , mClosing(false)
+{
+}
+
+WebSocketHub::WebSocketHub(const std::string &aType, Fetcher aFetcher)
+    : mType(aType)
+    , mFetcher(std::move(aFetcher))
+    , mWatcherRunning(false)
+{
+}
+
+std::string WebSocketHub::ComputeAcceptKey(const std::string &aKey)
+{
+    uint8_t       digest[kSha1Size];
+    unsigned char encoded[(kSha1Size + 2) / 3 * 4 + 1];
+    size_t        length = 0;
+
+    Sha1(aKey + kAcceptGuid, digest);
+    if (mbedtls_base64_encode(encoded, sizeof(encoded), &length, digest, sizeof(digest)) != 0)
+    {
+        length = 0;
+    }
+
+    return std::string(reinterpret_cast<const char *>(encoded), length);
+}
+
+std::string WebSocketHub::EncodeFrame(uint8_t aOpcode, const std::string &aPayload)
+{
+    std::string frame;
+    uint64_t    length = aPayload.size();
+
+    // A server sends unfragmented and unmasked frames.
+    frame.push_back(static_cast<char>(0x80 | aOpcode));
+    if (length < 126)
+    {
+        frame.push_back(static_cast<char>(length));
+    }
+    else if (length <= UINT16_MAX)
+    {
+        frame.push_back(126);
+        frame.push_back(static_cast<char>(length >> 8));
+        frame.push_back(static_cast<char>(length));
+    }
+    else
+    {
+        frame.push_back(127);
+        for (int shift = 56; shift >= 0; shift -= 8)
+        {
+            frame.push_back(static_cast<char>(length >> shift));
+        }
+    }
+    frame += aPayload;
+
+    return frame;
+}
+
+std::string WebSocketHub::MakeMessage(const std::string &aType, const std::string &aData)
+{
+    return EncodeFrame(kOpcodeText, "{\"type\":\"" + aType + "\",\"data\":" + aData + "}");
+}
+
+void WebSocketHub::Accept(const std::shared_ptr<boost::asio::io_context> &aIoService,
+                          std::unique_ptr<boost::asio::ip::tcp::socket>  &aSocket,
+                          const std::string                              &aKey)
+{
+    std::shared_ptr<Client> client = std::make_shared<Client>(std::move(aSocket));
+
+    {
+        std::lock_guard<std::mutex> lock(mIoServiceMutex);
+
+        mIoService = aIoService;
+    }
+
+    if (aKey.empty() || mClients.size() >= OTBR_WEB_MAX_WEB_SOCKETS)
+    {
+        otbrLogWarning("Rejected a WebSocket client, %zu clients", mClients.size());
+        client->mClosing = true;
+        Send(client, std::make_shared<const std::string>(aKey.empty()
+                                                             ? "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n"
+                                                             : "HTTP/1.1 503 Service Unavailable\r\n"
+                                                               "Content-Length: 0\r\n\r\n"));
+        ExitNow();
+    }
+
+    mClients.push_back(client);
+    Send(client, std::make_shared<const std::string>("HTTP/1.1 101 Switching Protocols\r\n"
+                                                     "Upgrade: websocket\r\n"
+                                                     "Connection: Upgrade\r\n"
+                                                     "Sec-WebSocket-Accept: " +
+                                                     ComputeAcceptKey(aKey) + "\r\n\r\n"));
+
+    // The client is sent the last state right away, the watcher fetches it for the first client.
+    if (mLastFrame != nullptr)
+    {
+        Send(client, mLastFrame);
+    }
+
+    ReadHeader(client);
+    StartWatcher();
+
+exit:
+    return;
+}
+
+void WebSocketHub::Publish(const std::string &aType, const std::string &aData)
+{
+    std::shared_ptr<boost::asio::io_context> ioService;
+    std::shared_ptr<const std::string>       frame;
+
+    {
+        std::lock_guard<std::mutex> lock(mIoServiceMutex);
+
+        ioService = mIoService;
+    }
+
+    // There is no client before the first one is accepted.
+    VerifyOrExit(ioService != nullptr);
+
+    frame = std::make_shared<const std::string>(MakeMessage(aType, aData));
+    boost::asio::post(*ioService, [this, frame]() { Broadcast(frame); });
+
+exit:
+    return;
+}
+
+void WebSocketHub::Stop(void)
+{
+    boost::system::error_code error;
+
+    if (mWatcherTimer != nullptr)
+    {
+        mWatcherTimer->cancel(error);
+        mWatcherTimer.reset();
+    }
+    mWatcherRunning = false;
+    mLastFrame.reset();
+
+    for (const std::shared_ptr<Client> &client : mClients)
+    {
+        client->mSocket->close(error);
+    }
+    mClients.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(mIoServiceMutex);
+
+        mIoService.reset();
+    }
+}
+
+void WebSocketHub::StartWatcher(void)
+{
+    VerifyOrExit(!mWatcherRunning);
+
+    if (mWatcherTimer == nullptr)
+    {
+        mWatcherTimer.reset(new boost::asio::steady_timer(*mIoService));
+    }
+
+    mWatcherRunning = true;
+    mWatcherTimer->expires_after(std::chrono::milliseconds(0));
+    mWatcherTimer->async_wait([this](const boost::system::error_code &aError) { HandleWatcherTimer(aError); });
+
+exit:
+    return;
+}
+
+void WebSocketHub::HandleWatcherTimer(const boost::system::error_code &aError)
+{
+    std::string frame;
+
+    VerifyOrExit(!aError, mWatcherRunning = false);
+
+    // The watcher only runs while there are clients, the state is fetched again for the next one.
+    if (mClients.empty())
+    {
+        mWatcherRunning = false;
+        mLastFrame.reset();
+        ExitNow();
+    }
+
+    try
+    {
+        frame = MakeMessage(mType, mFetcher());
+    } catch (const std::exception &e)
+    {
+        otbrLogWarning("Failed to fetch the %s pushed to the WebSocket clients: %s", mType.c_str(), e.what());
+    }
+
+    // Only the changes are pushed.
+    if (!frame.empty() && (mLastFrame == nullptr || *mLastFrame != frame))
+    {
+        mLastFrame = std::make_shared<const std::string>(std::move(frame));
+        Broadcast(mLastFrame);
+    }
+
+    mWatcherTimer->expires_after(std::chrono::milliseconds(OTBR_WEB_PUSH_INTERVAL_MS));
+    mWatcherTimer->async_wait([this](const boost::system::error_code &aError) { HandleWatcherTimer(aError); });
+
+exit:
+    return;
+}
+
+void WebSocketHub::Broadcast(const std::shared_ptr<const std::string> &aFrame)
+{
+    // A client may be removed while sending to it.
+    std::vector<std::shared_ptr<Client>> clients = mClients;
+
+    for (const std::shared_ptr<Client> &client : clients)
+    {
+        Send(client, aFrame);
+    }
+}
+
+void WebSocketHub::Send(const std::shared_ptr<Client> &aClient, const std::shared_ptr<const std::string> &aFrame)
+{
+    bool writing = !aClient->mWriteQueue.empty();
+
+    VerifyOrExit(aClient->mWriteQueue.size() < kMaxQueuedFrames, Remove(aClient));
+
+    aClient->mWriteQueue.push_back(aFrame);
+    if (!writing)
+    {
+        WriteNext(aClient);
+    }
+
+exit:
+    return;
+}
+
+void WebSocketHub::WriteNext(const std::shared_ptr<Client> &aClient)
+{
+    // The frame is kept alive by the queue until it is written.
+    boost::asio::async_write(*aClient->mSocket, boost::asio::buffer(*aClient->mWriteQueue.front()),
+                             [this, aClient](const boost::system::error_code &aError, size_t) {
+                                 boost::system::error_code error;
+
+                                 VerifyOrExit(!aError, Remove(aClient));
+
+                                 aClient->mWriteQueue.pop_front();
+                                 if (!aClient->mWriteQueue.empty())
+                                 {
+                                     WriteNext(aClient);
+                                 }
+                                 else if (aClient->mClosing)
+                                 {
+                                     aClient->mSocket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+                                     aClient->mSocket->close(error);
+                                 }
+
+                             exit:
+                                 return;
+                             });
+}
+
+void WebSocketHub::ReadHeader(const std::shared_ptr<Client> &aClient)
+{
+    boost::asio::async_read(
+        *aClient->mSocket, boost::asio::buffer(aClient->mHeader, 2),
+        [this, aClient](const boost::system::error_code &aError, size_t) {
+            size_t length       = aClient->mHeader[1] & 0x7f;
+            size_t headerLength = 2 + (length == 126 ? 2 : (length == 127 ? 8 : 0)) + 4;
+
+            VerifyOrExit(!aError, Remove(aClient));
+
+            // The frames sent by a client are always masked.
+            VerifyOrExit(aClient->mHeader[1] & 0x80, Remove(aClient));
+
+            boost::asio::async_read(*aClient->mSocket, boost::asio::buffer(aClient->mHeader + 2, headerLength - 2),
+                                    [this, aClient, headerLength](const boost::system::error_code &aError, size_t) {
+                                        if (aError)
+                                        {
+                                            Remove(aClient);
+                                        }
+                                        else
+                                        {
+                                            ReadPayload(aClient, headerLength);
+                                        }
+                                    });
+
+        exit:
+            return;
+        });
+}
+
+void WebSocketHub::ReadPayload(const std::shared_ptr<Client> &aClient, size_t aHeaderLength)
+{
+    uint64_t length = aClient->mHeader[1] & 0x7f;
+
+    if (length >= 126)
+    {
+        length = 0;
+        for (size_t i = 2; i < aHeaderLength - 4; i++)
+        {
+            length = (length << 8) | aClient->mHeader[i];
+        }
+    }
+
+    VerifyOrExit(length <= kMaxPayloadLength, Remove(aClient));
+
+    aClient->mPayload.resize(static_cast<size_t>(length));
+    boost::asio::async_read(*aClient->mSocket, boost::asio::buffer(&aClient->mPayload[0], aClient->mPayload.size()),
+                            [this, aClient, aHeaderLength](const boost::system::error_code &aError, size_t) {
+                                const uint8_t *mask = &aClient->mHeader[aHeaderLength - 4];
+
+                                VerifyOrExit(!aError, Remove(aClient));
+
+                                for (size_t i = 0; i < aClient->mPayload.size(); i++)
+                                {
+                                    aClient->mPayload[i] = static_cast<char>(aClient->mPayload[i] ^ mask[i % 4]);
+                                }
+                                HandleFrame(aClient, aClient->mHeader[0] & 0x0f);
+
+                            exit:
+                                return;
+                            });
+
+exit:
+    return;
+}
+
+void WebSocketHub::HandleFrame(const std::shared_ptr<Client> &aClient, uint8_t aOpcode)
+{
+    switch (aOpcode)
+    {
+    case kOpcodeClose:
+        // The close frame is echoed, then the connection is closed once it is sent.
+        mClients.erase(std::remove(mClients.begin(), mClients.end(), aClient), mClients.end());
+        aClient->mClosing = true;
+        Send(aClient, std::make_shared<const std::string>(EncodeFrame(kOpcodeClose, aClient->mPayload.substr(0, 2))));
+        ExitNow();
+    case kOpcodePing:
+        Send(aClient, std::make_shared<const std::string>(EncodeFrame(kOpcodePong, aClient->mPayload)));
+        break;
+    default:
+        // The clients are only pushed the state, their messages are ignored.
+        break;
+    }
+
+    ReadHeader(aClient);
+
+exit:
+    return;
+}
+
+void WebSocketHub::Remove(const std::shared_ptr<Client> &aClient)
+{
+    boost::system::error_code error;
+
+    mClients.erase(std::remove(mClients.begin(), mClients.end(), aClient), mClients.end());
+    aClient->mClosing = true;
+    aClient->mSocket->close(error);
+}
+
+} // namespace Web
+} // namespace otbr
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definition of the WebSocket clients of the web server.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_WEB_SOCKET_HUB_HPP_
+#define OTBR_WEB_WEB_SERVICE_WEB_SOCKET_HUB_HPP_
+
+#include "openthread-br/config.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+/**
+ * The interval (in milliseconds) of the shared watcher fetching the state pushed to the WebSocket clients.
+ *
+ */
+#ifndef OTBR_WEB_PUSH_INTERVAL_MS
+#define OTBR_WEB_PUSH_INTERVAL_MS 2000
+#endif
+
+/**
+ * The maximum number of WebSocket clients served at the same time.
+ *
+ */
+#ifndef OTBR_WEB_MAX_WEB_SOCKETS
+#define OTBR_WEB_MAX_WEB_SOCKETS 16
+#endif
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class implements the WebSocket clients of the web server, which are pushed the state fetched by a single
+ * shared watcher instead of each polling it.
+ *
+ * Except `Publish()`, the methods must be called on the thread running the io_context of the web server.
+ *
+ */
+class WebSocketHub
+{
+public:
+    /**
+     * This type represents the function fetching the state pushed to the clients, as a JSON text.
+     *
+     */
+    using Fetcher = std::function<std::string(void)>;
+
+    /**
+     * This constructor initializes the hub, without any client.
+     *
+     * @param[in] aType     The type of the messages carrying the state fetched by the watcher.
+     * @param[in] aFetcher  The function fetching the state, which is only called while there are clients.
+     *
+     */
+    WebSocketHub(const std::string &aType, Fetcher aFetcher);
+
+    /**
+     * This method completes the WebSocket handshake of an upgraded HTTP connection and adds it to the clients.
+     *
+     * The client is sent the last state right away, or the watcher fetches it if there is none.
+     *
+     * @param[in]    aIoService  The io_context running the web server.
+     * @param[inout] aSocket     The socket of the connection, which is taken by the hub.
+     * @param[in]    aKey        The value of the `Sec-WebSocket-Key` header of the upgrade request.
+     *
+     */
+    void Accept(const std::shared_ptr<boost::asio::io_context> &aIoService,
+                std::unique_ptr<boost::asio::ip::tcp::socket>  &aSocket,
+                const std::string                              &aKey);
+
+    /**
+     * This method pushes a message to all the clients.
+     *
+     * This method is thread-safe, the message is sent from the thread running the io_context.
+     *
+     * @param[in] aType  The type of the message.
+     * @param[in] aData  The JSON text of the message.
+     *
+     */
+    void Publish(const std::string &aType, const std::string &aData);
+
+    /**
+     * This method closes all the clients and stops the watcher.
+     *
+     * This method must be called before the io_context is destroyed.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method computes the `Sec-WebSocket-Accept` header value of the handshake response.
+     *
+     * @param[in] aKey  The value of the `Sec-WebSocket-Key` header of the upgrade request.
+     *
+     * @returns The value of the `Sec-WebSocket-Accept` header.
+     *
+     */
+    static std::string ComputeAcceptKey(const std::string &aKey);
+
+    /**
+     * This method encodes a message to an unmasked WebSocket frame, as sent by a server.
+     *
+     * @param[in] aOpcode   The opcode of the frame.
+     * @param[in] aPayload  The payload of the frame.
+     *
+     * @returns The encoded frame.
+     *
+     */
+    static std::string EncodeFrame(uint8_t aOpcode, const std::string &aPayload);
+
+private:
+    static constexpr uint8_t kOpcodeText  = 0x1;
+    static constexpr uint8_t kOpcodeClose = 0x8;
+    static constexpr uint8_t kOpcodePing  = 0x9;
+    static constexpr uint8_t kOpcodePong  = 0xa;
+
+    struct Client
+    {
+        explicit Client(std::unique_ptr<boost::asio::ip::tcp::socket> aSocket);
+
+        std::unique_ptr<boost::asio::ip::tcp::socket>  mSocket;
+        std::deque<std::shared_ptr<const std::string>> mWriteQueue;
+        uint8_t                                        mHeader[14];
+        std::string                                    mPayload;
+        bool                                           mClosing;
+    };
+
+    void               StartWatcher(void);
+    void               HandleWatcherTimer(const boost::system::error_code &aError);
+    void               Broadcast(const std::shared_ptr<const std::string> &aFrame);
+    void               Send(const std::shared_ptr<Client> &aClient, const std::shared_ptr<const std::string> &aFrame);
+    void               WriteNext(const std::shared_ptr<Client> &aClient);
+    void               ReadHeader(const std::shared_ptr<Client> &aClient);
+    void               ReadPayload(const std::shared_ptr<Client> &aClient, size_t aHeaderLength);
+    void               HandleFrame(const std::shared_ptr<Client> &aClient, uint8_t aOpcode);
+    void               Remove(const std::shared_ptr<Client> &aClient);
+    static std::string MakeMessage(const std::string &aType, const std::string &aData);
+
+    std::string                                mType;
+    Fetcher                                    mFetcher;
+    std::vector<std::shared_ptr<Client>>       mClients;
+    std::shared_ptr<boost::asio::io_context>   mIoService;
+    std::unique_ptr<boost::asio::steady_timer> mWatcherTimer;
+    bool                                       mWatcherRunning;
+    std::shared_ptr<const std::string>         mLastFrame;
+    std::mutex                                 mIoServiceMutex;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_WEB_SOCKET_HUB_HPP_
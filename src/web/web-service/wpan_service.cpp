@@ -101,6 +101,8 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
     otbr::Web::OpenThreadClient client(mIfName);
     char                       *rval;
 
+    InvalidateStatus();
+
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aJoinRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -201,6 +203,8 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     int                         ret = kWpanStatus_Ok;
     otbr::Web::OpenThreadClient client(mIfName);
 
+    InvalidateStatus();
+
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
@@ -257,6 +261,8 @@ std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixReq
     int                         ret = kWpanStatus_Ok;
     otbr::Web::OpenThreadClient client(mIfName);
 
+    InvalidateStatus();
+
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aAddPrefixRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -296,6 +302,8 @@ std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteReq
     int                         ret = kWpanStatus_Ok;
     otbr::Web::OpenThreadClient client(mIfName);
 
+    InvalidateStatus();
+
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aDeleteRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -323,14 +331,52 @@ exit:
     return response;
 }
 
-std::string WpanService::HandleStatusRequest()
+std::string WpanService::HandleStatusRequest(void)
+{
+    std::lock_guard<std::mutex> lock(mStatusMutex);
+    Timepoint                   now = Clock::now();
+    int                         ret;
+
+    if (mStatusResponse.empty() || now >= mStatusExpireTime)
+    {
+        mStatusResponse   = QueryStatus(ret);
+        mStatusExpireTime = (ret == kWpanStatus_Ok) ? now + Milliseconds(OTBR_WEB_STATUS_CACHE_TIME_MS) : now;
+    }
+
+    return mStatusResponse;
+}
+
+void WpanService::InvalidateStatus(void)
+{
+    std::lock_guard<std::mutex> lock(mStatusMutex);
+
+    mStatusResponse.clear();
+}
+
+std::string WpanService::QueryStatus(int &aRet)
 {
+    struct PropertyCommand
+    {
+        const char *mCommand;
+        const char *mName;
+    };
+
+    static const PropertyCommand kPropertyCommands[] = {
+        {"version", "OpenThread:Version"}, {"version api", "OpenThread:Version API"},
+        {"rcp version", "RCP:Version"},    {"eui64", "RCP:EUI64"},
+        {"channel", "RCP:Channel"},        {"txpower", "RCP:TxPower"},
+        {"networkname", "Network:Name"},   {"extpanid", "Network:XPANID"},
+        {"panid", "Network:PANID"},        {"partitionid", "Network:PartitionID"},
+    };
+
     Json::Value                 root, networkInfo;
     Json::FastWriter            jsonWriter;
     std::string                 response, networkName, extPanId, propertyValue;
     int                         ret = kWpanStatus_Ok;
     otbr::Web::OpenThreadClient client(mIfName);
     char                       *rval;
+    std::vector<std::string>    commands;
+    std::vector<std::string>    outputs;
 
     networkInfo["WPAN service"] = "uninitialized";
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
@@ -353,35 +399,19 @@ std::string WpanService::HandleStatusRequest()
         networkInfo["WPAN service"] = "associated";
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version API"] = rval;
-
-    VerifyOrExit((rval = client.Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:EUI64"] = rval;
-
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Channel"] = rval;
-
-    VerifyOrExit((rval = client.Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:TxPower"] = rval;
-
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:Name"] = rval;
-
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:XPANID"] = rval;
-
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PANID"] = rval;
+    // The other properties are retrieved in a single round-trip.
+    for (const PropertyCommand &property : kPropertyCommands)
+    {
+        commands.push_back(property.mCommand);
+    }
+    commands.push_back("dataset active");
+    commands.push_back("ipaddr");
+    VerifyOrExit(client.ExecuteBatch(commands, outputs), ret = kWpanStatus_GetPropertyFailed);
 
-    VerifyOrExit((rval = client.Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PartitionID"] = rval;
+    for (size_t i = 0; i < sizeof(kPropertyCommands) / sizeof(kPropertyCommands[0]); i++)
+    {
+        networkInfo[kPropertyCommands[i].mName] = outputs[i];
+    }
 
     {
         static const char kMeshLocalPrefixLocator[]       = "Mesh Local Prefix: ";
@@ -389,9 +419,10 @@ std::string WpanService::HandleStatusRequest()
         static const char localAddressToken[]             = "fd";
         static const char linkLocalAddressToken[]         = "fe80";
         std::string       meshLocalPrefix                 = "";
+        std::string      &datasetOutput                   = outputs[commands.size() - 2];
+        std::string      &ipaddrOutput                    = outputs[commands.size() - 1];
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-        rval = strstr(rval, kMeshLocalPrefixLocator);
+        rval = strstr(&datasetOutput[0], kMeshLocalPrefixLocator);
         if (rval != nullptr)
         {
             rval += sizeof(kMeshLocalPrefixLocator) - 1;
@@ -402,9 +433,7 @@ std::string WpanService::HandleStatusRequest()
             meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
         }
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-
-        for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
+        for (rval = strtok(&ipaddrOutput[0], "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
             char *meshLocalAddressToken = nullptr;
 
@@ -463,6 +492,7 @@ exit:
     }
     root["error"] = ret;
     response      = jsonWriter.write(root);
+    aRet          = ret;
     return response;
 }
 
@@ -544,6 +574,8 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     std::string      response;
     const char      *rval;
 
+    InvalidateStatus();
+
     VerifyOrExit(reader.parse(aCommissionRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     pskd = root["pskd"].asString();
 
@@ -36,6 +36,8 @@
 
 #include "openthread-br/config.h"
 
+#include <mutex>
+
 #include <net/if.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -46,6 +48,7 @@
 #include <json/writer.h>
 
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
 #include "web/web-service/ot_client.hpp"
@@ -63,6 +66,14 @@
 #define OT_HEX_PREFIX_LENGTH 2
 #define OT_PUBLISH_SERVICE_INTERVAL 20
 
+/**
+ * The time the network status is cached for, so that the browser tabs and their status refreshes share the queries.
+ *
+ */
+#ifndef OTBR_WEB_STATUS_CACHE_TIME_MS
+#define OTBR_WEB_STATUS_CACHE_TIME_MS 1000
+#endif
+
 namespace otbr {
 namespace Web {
 
@@ -124,6 +135,8 @@ public:
     /**
      * This method handles http request to get netowrk status.
      *
+     * The status is cached for `OTBR_WEB_STATUS_CACHE_TIME_MS`, or until a request changing it is handled.
+     *
      * @returns The string to the http response of getting status.
      *
      */
@@ -194,12 +207,17 @@ private:
                                          uint16_t                     aChannel,
                                          uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
+    std::string        QueryStatus(int &aRet);
+    void               InvalidateStatus(void);
 
     WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
     int             mNetworksCount;
     char            mIfName[IFNAMSIZ];
     std::string     mNetworkName;
     std::string     mExtPanId;
+    std::mutex      mStatusMutex; // The status is shared by the HTTP thread and the job worker of the web server.
+    std::string     mStatusResponse;
+    Timepoint       mStatusExpireTime;
 
     enum
     {
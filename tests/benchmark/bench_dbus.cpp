@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a benchmark of fetching properties from the D-Bus server.
+ *
+ *   The properties of `ThreadApiDBus::GetNetworkProperties()` are fetched from a running otbr-agent, one property per
+ *   round-trip and all in a single batched round-trip. It reports the fetches/s, p50 and p99 latency of both.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sysexits.h>
+
+#include <memory>
+#include <string>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/client/thread_api_dbus.hpp"
+
+#include "samples.hpp"
+
+using otbr::Benchmark::Clock;
+using otbr::Benchmark::Samples;
+using otbr::DBus::ClientError;
+using otbr::DBus::DeviceRole;
+using otbr::DBus::NetworkProperties;
+using otbr::DBus::ThreadApiDBus;
+
+namespace {
+
+constexpr char     kDefaultInterfaceName[] = "wpan0";
+constexpr uint32_t kDefaultFetches         = 1000;
+
+/**
+ * This function fetches the network properties one property per round-trip.
+ *
+ */
+ClientError FetchOneByOne(ThreadApiDBus &aApi, NetworkProperties &aProperties)
+{
+    ClientError error;
+
+    SuccessOrExit(error = aApi.GetDeviceRole(aProperties.mDeviceRole));
+    SuccessOrExit(error = aApi.GetNetworkName(aProperties.mNetworkName));
+    SuccessOrExit(error = aApi.GetPanId(aProperties.mPanId));
+    SuccessOrExit(error = aApi.GetExtPanId(aProperties.mExtPanId));
+    SuccessOrExit(error = aApi.GetChannel(aProperties.mChannel));
+    SuccessOrExit(error = aApi.GetRloc16(aProperties.mRloc16));
+    SuccessOrExit(error = aApi.GetExtendedAddress(aProperties.mExtendedAddress));
+    SuccessOrExit(error = aApi.GetPartitionId(aProperties.mPartitionId));
+
+exit:
+    return error;
+}
+
+/**
+ * This function fetches the network properties for a number of times and reports the latency.
+ *
+ * @returns Whether all the fetches succeeded.
+ *
+ */
+template <typename Fetch> bool Run(const char *aName, uint32_t aFetches, Fetch aFetch)
+{
+    Samples           samples(aFetches);
+    uint64_t          failures = 0;
+    NetworkProperties properties;
+    Clock::time_point start = Clock::now();
+
+    for (uint32_t i = 0; i < aFetches; i++)
+    {
+        Clock::time_point fetchStart = Clock::now();
+
+        if (aFetch(properties) == ClientError::ERROR_NONE)
+        {
+            samples.Add(Clock::now() - fetchStart);
+        }
+        else
+        {
+            failures++;
+        }
+    }
+
+    samples.Print(aName, samples.GetCount(), Clock::now() - start, failures);
+
+    return failures == 0;
+}
+
+void PrintUsage(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [-I interface] [-n fetches]\n"
+            "    -I  Thread network interface of the otbr-agent (default: %s)\n"
+            "    -n  Number of fetches of the network properties in each mode (default: %u)\n",
+            aProgramName, kDefaultInterfaceName, kDefaultFetches);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const char                    *interfaceName = kDefaultInterfaceName;
+    unsigned long                  fetches       = kDefaultFetches;
+    DBusError                      error;
+    DBusConnection                *connection = nullptr;
+    std::unique_ptr<ThreadApiDBus> api;
+    int                            opt;
+    int                            ret = EXIT_SUCCESS;
+
+    dbus_error_init(&error);
+
+    while ((opt = getopt(argc, argv, "I:n:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'I':
+            interfaceName = optarg;
+            break;
+        case 'n':
+            fetches = strtoul(optarg, nullptr, 0);
+            break;
+        default:
+            PrintUsage(argv[0]);
+            ExitNow(ret = (opt == 'h' ? EXIT_SUCCESS : EX_USAGE));
+        }
+    }
+
+    VerifyOrExit(fetches > 0 && fetches <= UINT32_MAX, PrintUsage(argv[0]), ret = EX_USAGE);
+
+    connection = dbus_bus_get(DBUS_BUS_SYSTEM, &error);
+    VerifyOrExit(connection != nullptr, fprintf(stderr, "Failed to connect to the system bus: %s\n", error.message),
+                 ret = EX_UNAVAILABLE);
+
+    api = std::unique_ptr<ThreadApiDBus>(new ThreadApiDBus(connection, interfaceName));
+
+    printf("%lu fetches of %s network properties\n", fetches, interfaceName);
+    VerifyOrExit(Run("one property per call", static_cast<uint32_t>(fetches),
+                     [&api](NetworkProperties &aProperties) { return FetchOneByOne(*api, aProperties); }),
+                 ret = EX_UNAVAILABLE);
+    VerifyOrExit(Run("batched", static_cast<uint32_t>(fetches),
+                     [&api](NetworkProperties &aProperties) { return api->GetNetworkProperties(aProperties); }),
+                 ret = EX_UNAVAILABLE);
+
+exit:
+    api.reset();
+    if (connection != nullptr)
+    {
+        dbus_connection_unref(connection);
+    }
+    dbus_error_free(&error);
+    return ret;
+}
@@ -0,0 +1,340 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements micro-benchmarks of the common and utils primitives.
+ *
+ *   The benchmarks are built with Google Benchmark, so the usual options apply, for example the results are exported
+ *   for regression tracking with:
+ *
+ *     otbr-microbench --benchmark_out=microbench.json --benchmark_out_format=json
+ */
+
+#include <stdio.h>
+#include <sys/select.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "common/dns_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+#include "utils/crc16.hpp"
+#include "utils/hex.hpp"
+#include "utils/pskc.hpp"
+#include "utils/steering_data.hpp"
+
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD
+#include "mdns/mdns.hpp"
+#endif
+
+#if OTBR_ENABLE_DBUS_SERVER
+#include <dbus/dbus.h>
+
+#include "dbus/common/dbus_message_helper.hpp"
+#endif
+
+namespace {
+
+std::vector<uint8_t> MakeBytes(size_t aLength)
+{
+    std::vector<uint8_t> bytes(aLength);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    return bytes;
+}
+
+void BM_Ip6AddressFromString(benchmark::State &aState)
+{
+    otbr::Ip6Address address;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(otbr::Ip6Address::FromString("fd11:22:0:0:7a5b:3c4d:5e6f:1234", address));
+    }
+}
+BENCHMARK(BM_Ip6AddressFromString);
+
+void BM_Ip6AddressToString(benchmark::State &aState)
+{
+    otbr::Ip6Address address("fd11:22::7a5b:3c4d:5e6f:1234");
+    char             buffer[otbr::Ip6Address::kStringSize];
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(address.ToString(buffer, sizeof(buffer)));
+    }
+}
+BENCHMARK(BM_Ip6AddressToString);
+
+void BM_SplitFullDnsName(benchmark::State &aState)
+{
+    const std::string name = "OpenThread Border Router._meshcop._udp.default.service.arpa.";
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(SplitFullDnsName(name));
+    }
+}
+BENCHMARK(BM_SplitFullDnsName);
+
+void BM_SplitFullDnsNameSpans(benchmark::State &aState)
+{
+    const std::string name = "OpenThread Border Router._meshcop._udp.default.service.arpa.";
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(SplitFullDnsName(name.data(), name.size()));
+    }
+}
+BENCHMARK(BM_SplitFullDnsNameSpans);
+
+void BM_SplitFullServiceInstanceName(benchmark::State &aState)
+{
+    const std::string name = "OpenThread Border Router._meshcop._udp.default.service.arpa.";
+    std::string       instanceName;
+    std::string       type;
+    std::string       domain;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(SplitFullServiceInstanceName(name, instanceName, type, domain));
+    }
+}
+BENCHMARK(BM_SplitFullServiceInstanceName);
+
+#if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD
+// The TXT entries of a typical MeshCoP service.
+otbr::Mdns::Publisher::TxtList MakeMeshcopTxtList(void)
+{
+    otbr::Mdns::Publisher::TxtList txtList;
+    std::vector<uint8_t>           xpanid = MakeBytes(8);
+    std::vector<uint8_t>           state  = MakeBytes(4);
+
+    txtList.emplace_back("rv", "1");
+    txtList.emplace_back("tv", "1.3.0");
+    txtList.emplace_back("nn", "OpenThread");
+    txtList.emplace_back("vn", "OpenThread");
+    txtList.emplace_back("mn", "BorderRouter");
+    txtList.emplace_back("xp", xpanid.data(), xpanid.size());
+    txtList.emplace_back("sb", state.data(), state.size());
+    txtList.emplace_back("dn", "DefaultDomain");
+
+    return txtList;
+}
+
+void BM_EncodeTxtData(benchmark::State &aState)
+{
+    otbr::Mdns::Publisher::TxtList txtList = MakeMeshcopTxtList();
+    otbr::Mdns::Publisher::TxtData txtData;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(otbr::Mdns::Publisher::EncodeTxtData(txtList, txtData));
+    }
+}
+BENCHMARK(BM_EncodeTxtData);
+
+void BM_DecodeTxtData(benchmark::State &aState)
+{
+    otbr::Mdns::Publisher::TxtData txtData;
+    otbr::Mdns::Publisher::TxtList txtList;
+
+    otbr::Mdns::Publisher::EncodeTxtData(MakeMeshcopTxtList(), txtData);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(otbr::Mdns::Publisher::DecodeTxtData(txtList, txtData.data(), txtData.size()));
+    }
+}
+BENCHMARK(BM_DecodeTxtData);
+#endif // OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD
+
+void BM_Hex2Bytes(benchmark::State &aState)
+{
+    std::vector<uint8_t> bytes = MakeBytes(static_cast<size_t>(aState.range(0)));
+    std::string          hex;
+
+    otbr::Utils::Bytes2Hex(bytes.data(), bytes.size(), hex);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(
+            otbr::Utils::Hex2Bytes(hex.data(), hex.size(), bytes.data(), static_cast<uint16_t>(bytes.size())));
+    }
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations()) * hex.size());
+}
+BENCHMARK(BM_Hex2Bytes)->Arg(8)->Arg(32)->Arg(254);
+
+void BM_Bytes2Hex(benchmark::State &aState)
+{
+    std::vector<uint8_t> bytes = MakeBytes(static_cast<size_t>(aState.range(0)));
+    std::vector<char>    hex(bytes.size() * 2);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(
+            otbr::Utils::Bytes2Hex(bytes.data(), bytes.size(), hex.data(), otbr::Utils::HexCase::kUpper));
+    }
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations()) * bytes.size());
+}
+BENCHMARK(BM_Bytes2Hex)->Arg(8)->Arg(32)->Arg(254);
+
+void BM_ComputePskc(benchmark::State &aState)
+{
+    const uint8_t   extPanId[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    otbr::Psk::Pskc pskc;
+    char            passphrase[sizeof("passphrase-4294967295")];
+    uint32_t        count = 0;
+
+    // A distinct passphrase on each iteration, so that the PBKDF2 iterations are measured rather than the cache.
+    for (auto _ : aState)
+    {
+        snprintf(passphrase, sizeof(passphrase), "passphrase-%u", count++);
+        benchmark::DoNotOptimize(pskc.ComputePskc(extPanId, "OpenThread", passphrase));
+    }
+}
+BENCHMARK(BM_ComputePskc)->Unit(benchmark::kMillisecond);
+
+void BM_ComputePskcCached(benchmark::State &aState)
+{
+    const uint8_t   extPanId[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    otbr::Psk::Pskc pskc;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(pskc.ComputePskc(extPanId, "OpenThread", "123456"));
+    }
+}
+BENCHMARK(BM_ComputePskcCached);
+
+void BM_ComputeBloomFilter(benchmark::State &aState)
+{
+    uint16_t             joinerCount = static_cast<uint16_t>(aState.range(0));
+    std::vector<uint8_t> joinerIds   = MakeBytes(joinerCount * otbr::SteeringData::kSizeJoinerId);
+    otbr::SteeringData   steeringData;
+
+    for (auto _ : aState)
+    {
+        steeringData.Init(otbr::SteeringData::kMaxSizeOfBloomFilter);
+        steeringData.ComputeBloomFilter(joinerIds.data(), joinerCount);
+        benchmark::ClobberMemory();
+    }
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations()) * joinerCount);
+}
+BENCHMARK(BM_ComputeBloomFilter)->Arg(1)->Arg(16)->Arg(256);
+
+void BM_Crc16(benchmark::State &aState)
+{
+    std::vector<uint8_t> bytes = MakeBytes(static_cast<size_t>(aState.range(0)));
+    otbr::Crc16          crc16(otbr::Crc16::kCcitt);
+
+    for (auto _ : aState)
+    {
+        crc16.Init();
+        crc16.Update(bytes.data(), static_cast<uint16_t>(bytes.size()));
+        benchmark::DoNotOptimize(crc16.Get());
+    }
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations()) * bytes.size());
+}
+BENCHMARK(BM_Crc16)->Arg(16)->Arg(127)->Arg(1280);
+
+void RunTaskRunner(otbr::TaskRunner &aTaskRunner)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+    aTaskRunner.Process(mainloop);
+}
+
+void BM_TaskRunnerPostAndRun(benchmark::State &aState)
+{
+    otbr::TaskRunner taskRunner;
+    int64_t          taskCount = aState.range(0);
+    int64_t          executed  = 0;
+
+    // The tasks are run by `Process()`, which pops all the posted tasks.
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < taskCount; i++)
+        {
+            taskRunner.Post([&executed]() { executed++; });
+        }
+        RunTaskRunner(taskRunner);
+    }
+    benchmark::DoNotOptimize(executed);
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations()) * taskCount);
+}
+BENCHMARK(BM_TaskRunnerPostAndRun)->Arg(1)->Arg(64)->Arg(1024);
+
+#if OTBR_ENABLE_DBUS_SERVER
+void BM_DBusMessageEncodeChildTable(benchmark::State &aState)
+{
+    std::vector<otbr::DBus::ChildInfo> childTable(static_cast<size_t>(aState.range(0)));
+
+    for (size_t i = 0; i < childTable.size(); i++)
+    {
+        childTable[i].mExtAddress = 0x1122334455667700 + i;
+        childTable[i].mRloc16     = static_cast<uint16_t>(0x0400 + i);
+        childTable[i].mChildId    = static_cast<uint16_t>(i);
+    }
+
+    for (auto _ : aState)
+    {
+        DBusMessage    *message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        DBusMessageIter iter;
+
+        dbus_message_iter_init_append(message, &iter);
+        benchmark::DoNotOptimize(otbr::DBus::DBusMessageEncode(&iter, childTable));
+        dbus_message_unref(message);
+    }
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations()) * childTable.size());
+}
+BENCHMARK(BM_DBusMessageEncodeChildTable)->Arg(10)->Arg(100)->Arg(511);
+#endif // OTBR_ENABLE_DBUS_SERVER
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,695 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a benchmark of the NCP host data path.
+ *
+ *   The benchmark drives `NcpSpinel` and `Netif` against a simulated NCP which is attached to
+ *   `ot::Spinel::SpinelDriver` as its spinel interface. It measures:
+ *     - TUN -> spinel: UDP datagrams sent to the TUN device until the simulated NCP receives them.
+ *     - spinel -> TUN: STREAM_NET frames from the simulated NCP until the datagrams are received on a socket.
+ *     - Property set round trip: `NcpSpinel::Ip6SetEnabled()` until the asynchronous task completes.
+ *
+ *   Creating the TUN device requires root privileges.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include <arpa/inet.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "lib/spinel/spinel.h"
+#include "lib/spinel/spinel_driver.hpp"
+#include "lib/spinel/spinel_interface.hpp"
+#include "ncp/async_task.hpp"
+#include "ncp/ncp_spinel.hpp"
+#include "ncp/posix/netif.hpp"
+
+#include "samples.hpp"
+
+using otbr::Benchmark::Clock;
+using otbr::Benchmark::Samples;
+
+namespace {
+
+constexpr char     kDefaultInterfaceName[] = "otbr-bench";
+constexpr uint32_t kDefaultIterations      = 10000;
+constexpr uint16_t kDefaultPayloadSize     = 64;
+constexpr uint16_t kMaxPayloadSize         = 1232;
+constexpr uint32_t kBurstSize              = 32;
+constexpr uint16_t kBenchPort              = 12345;
+
+// Address of the TUN device and of the simulated peer behind the NCP, in fd76:a5d1:fcb0:1707::/64.
+constexpr otIp6Address kLocalAddress = {
+    {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0xf3, 0xc7, 0xd8, 0x8c, 0xef, 0xd1, 0x24, 0xa9}};
+constexpr char kPeerAddress[] = "fd76:a5d1:fcb0:1707:3f1:47ce:85d3:77f";
+
+// Offsets of the fields swapped to reflect a UDP datagram, the checksum stays valid after swapping.
+constexpr size_t kIp6NextHeaderOffset  = 6;
+constexpr size_t kIp6SourceOffset      = 8;
+constexpr size_t kIp6DestinationOffset = 24;
+constexpr size_t kIp6AddressSize       = 16;
+constexpr size_t kUdpPortsOffset       = 40;
+constexpr size_t kUdpPortSize          = 2;
+
+/**
+ * This class implements a simulated NCP as a spinel interface.
+ *
+ * Frames to the host are queued and delivered from `Process()` or `WaitForFrame()`, the way a real
+ * interface delivers frames read from its file descriptor.
+ *
+ */
+class SimulatedNcp : public ot::Spinel::SpinelInterface
+{
+public:
+    otError Init(ReceiveFrameCallback aCallback, void *aCallbackContext, RxFrameBuffer &aFrameBuffer) override
+    {
+        mReceiveFrameCallback = aCallback;
+        mReceiveFrameContext  = aCallbackContext;
+        mRxFrameBuffer        = &aFrameBuffer;
+
+        return OT_ERROR_NONE;
+    }
+
+    void Deinit(void) override
+    {
+        mReceiveFrameCallback = nullptr;
+        mReceiveFrameContext  = nullptr;
+        mRxFrameBuffer        = nullptr;
+        mPendingFrames.clear();
+    }
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength) override;
+
+    otError WaitForFrame(uint64_t aTimeoutUs) override
+    {
+        OTBR_UNUSED_VARIABLE(aTimeoutUs);
+
+        return DeliverFrames() > 0 ? OT_ERROR_NONE : OT_ERROR_RESPONSE_TIMEOUT;
+    }
+
+    void UpdateFdSet(void *aMainloopContext) override
+    {
+        otbr::MainloopContext *context = static_cast<otbr::MainloopContext *>(aMainloopContext);
+
+        if (!mPendingFrames.empty())
+        {
+            context->mTimeout = {0, 0};
+        }
+    }
+
+    void Process(const void *aMainloopContext) override
+    {
+        OTBR_UNUSED_VARIABLE(aMainloopContext);
+
+        DeliverFrames();
+    }
+
+    uint32_t GetBusSpeed(void) const override { return 0; }
+
+    otError HardwareReset(void) override { return OT_ERROR_NOT_IMPLEMENTED; }
+
+    const otRcpInterfaceMetrics *GetRcpInterfaceMetrics(void) const override { return nullptr; }
+
+    /**
+     * Queues a STREAM_NET frame carrying @p aDatagram to the host.
+     *
+     */
+    void SendDatagram(const std::vector<uint8_t> &aDatagram);
+
+    uint64_t                    GetReceivedDatagrams(void) const { return mReceivedDatagrams; }
+    Clock::time_point           GetLastDatagramTime(void) const { return mLastDatagramTime; }
+    const std::vector<uint8_t> &GetLastDatagram(void) const { return mLastDatagram; }
+
+private:
+    void   QueueFrame(const uint8_t *aFrame, spinel_ssize_t aLength);
+    void   QueueLastStatus(uint8_t aHeader, spinel_status_t aStatus);
+    void   HandleGet(uint8_t aHeader, spinel_prop_key_t aKey);
+    size_t DeliverFrames(void);
+
+    ReceiveFrameCallback             mReceiveFrameCallback = nullptr;
+    void                            *mReceiveFrameContext  = nullptr;
+    RxFrameBuffer                   *mRxFrameBuffer        = nullptr;
+    std::deque<std::vector<uint8_t>> mPendingFrames;
+    uint64_t                         mReceivedDatagrams = 0;
+    Clock::time_point                mLastDatagramTime;
+    std::vector<uint8_t>             mLastDatagram;
+};
+
+otError SimulatedNcp::SendFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    otError        error = OT_ERROR_NONE;
+    uint8_t        header;
+    unsigned int   cmd;
+    unsigned int   key;
+    spinel_ssize_t offset;
+
+    offset = spinel_datatype_unpack(aFrame, aLength, SPINEL_DATATYPE_COMMAND_S, &header, &cmd);
+    VerifyOrExit(offset > 0, error = OT_ERROR_PARSE);
+
+    if (cmd == SPINEL_CMD_RESET)
+    {
+        QueueLastStatus(SPINEL_HEADER_FLAG | (header & SPINEL_HEADER_IID_MASK), SPINEL_STATUS_RESET_SOFTWARE);
+        ExitNow();
+    }
+
+    offset = spinel_datatype_unpack(aFrame, aLength, SPINEL_DATATYPE_COMMAND_PROP_S, &header, &cmd, &key);
+    VerifyOrExit(offset > 0, error = OT_ERROR_PARSE);
+
+    switch (cmd)
+    {
+    case SPINEL_CMD_PROP_VALUE_GET:
+        HandleGet(header, static_cast<spinel_prop_key_t>(key));
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_SET:
+        if (key == SPINEL_PROP_STREAM_NET)
+        {
+            const uint8_t *datagram;
+            spinel_size_t  length;
+
+            VerifyOrExit(spinel_datatype_unpack(aFrame + offset, aLength - offset, SPINEL_DATATYPE_DATA_WLEN_S,
+                                                &datagram, &length) > 0,
+                         error = OT_ERROR_PARSE);
+
+            // Only count the benchmark datagrams, not the ICMPv6 messages sent by the kernel.
+            VerifyOrExit(length > kIp6NextHeaderOffset && datagram[kIp6NextHeaderOffset] == IPPROTO_UDP);
+            mLastDatagramTime = Clock::now();
+            mLastDatagram.assign(datagram, datagram + length);
+            mReceivedDatagrams++;
+        }
+        else
+        {
+            // Echo the value back to acknowledge the request.
+            uint8_t        frame[ot::Spinel::SpinelInterface::kMaxFrameSize];
+            spinel_ssize_t length;
+
+            length = spinel_datatype_pack(frame, sizeof(frame), SPINEL_DATATYPE_COMMAND_PROP_S, header,
+                                          SPINEL_CMD_PROP_VALUE_IS, key);
+            VerifyOrExit(length > 0 && length + (aLength - offset) <= static_cast<spinel_ssize_t>(sizeof(frame)),
+                         error = OT_ERROR_NO_BUFS);
+            memcpy(frame + length, aFrame + offset, aLength - offset);
+            QueueFrame(frame, length + (aLength - offset));
+        }
+        break;
+
+    default:
+        QueueLastStatus(header, SPINEL_STATUS_INVALID_COMMAND);
+        break;
+    }
+
+exit:
+    return error;
+}
+
+void SimulatedNcp::HandleGet(uint8_t aHeader, spinel_prop_key_t aKey)
+{
+    uint8_t        frame[ot::Spinel::SpinelInterface::kMaxFrameSize];
+    spinel_ssize_t length;
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_PROTOCOL_VERSION:
+        length = spinel_datatype_pack(frame, sizeof(frame),
+                                      SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S
+                                          SPINEL_DATATYPE_UINT_PACKED_S,
+                                      aHeader, SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
+                                      SPINEL_PROTOCOL_VERSION_THREAD_MINOR);
+        break;
+
+    case SPINEL_PROP_NCP_VERSION:
+        length = spinel_datatype_pack(frame, sizeof(frame), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UTF8_S,
+                                      aHeader, SPINEL_CMD_PROP_VALUE_IS, aKey, "OTBR-BENCH-NCP/1.0");
+        break;
+
+    case SPINEL_PROP_CAPS:
+        // Advertise an FTD so that the driver detects an NCP rather than an RCP.
+        length = spinel_datatype_pack(frame, sizeof(frame),
+                                      SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S, aHeader,
+                                      SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_CAP_CONFIG_FTD);
+        break;
+
+    default:
+        QueueLastStatus(aHeader, SPINEL_STATUS_PROP_NOT_FOUND);
+        ExitNow();
+    }
+
+    QueueFrame(frame, length);
+
+exit:
+    return;
+}
+
+void SimulatedNcp::SendDatagram(const std::vector<uint8_t> &aDatagram)
+{
+    uint8_t        frame[ot::Spinel::SpinelInterface::kMaxFrameSize];
+    spinel_ssize_t length;
+
+    length = spinel_datatype_pack(frame, sizeof(frame), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                  SPINEL_HEADER_FLAG, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_NET,
+                                  aDatagram.data(), static_cast<unsigned int>(aDatagram.size()));
+    QueueFrame(frame, length);
+}
+
+void SimulatedNcp::QueueLastStatus(uint8_t aHeader, spinel_status_t aStatus)
+{
+    uint8_t        frame[ot::Spinel::SpinelInterface::kMaxFrameSize];
+    spinel_ssize_t length;
+
+    length = spinel_datatype_pack(frame, sizeof(frame), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S,
+                                  aHeader, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, aStatus);
+    QueueFrame(frame, length);
+}
+
+void SimulatedNcp::QueueFrame(const uint8_t *aFrame, spinel_ssize_t aLength)
+{
+    if (aLength > 0)
+    {
+        mPendingFrames.emplace_back(aFrame, aFrame + aLength);
+    }
+}
+
+size_t SimulatedNcp::DeliverFrames(void)
+{
+    size_t delivered = 0;
+
+    VerifyOrExit(mRxFrameBuffer != nullptr && mReceiveFrameCallback != nullptr);
+
+    while (!mPendingFrames.empty())
+    {
+        std::vector<uint8_t> frame = std::move(mPendingFrames.front());
+
+        mPendingFrames.pop_front();
+
+        // Drop the frame when the host has no room left, like a real interface would.
+        if (!mRxFrameBuffer->CanWrite(static_cast<uint16_t>(frame.size())))
+        {
+            mRxFrameBuffer->DiscardFrame();
+            continue;
+        }
+
+        memcpy(mRxFrameBuffer->GetFrame(), frame.data(), frame.size());
+        mRxFrameBuffer->SetLength(static_cast<uint16_t>(frame.size()));
+        mReceiveFrameCallback(mReceiveFrameContext);
+        delivered++;
+    }
+
+exit:
+    return delivered;
+}
+
+class BenchObserver : public otbr::Ncp::PropsObserver
+{
+public:
+    void SetDeviceRole(otDeviceRole aRole) override { OTBR_UNUSED_VARIABLE(aRole); }
+    void SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs) override
+    {
+        OTBR_UNUSED_VARIABLE(aActiveOpDatasetTlvs);
+    }
+};
+
+class NcpBenchmark
+{
+public:
+    NcpBenchmark(uint32_t aIterations, uint16_t aPayloadSize)
+        : mIterations(aIterations)
+        , mPayload(aPayloadSize, 0x5a)
+        , mSocket(-1)
+    {
+    }
+
+    otbrError Init(const char *aInterfaceName);
+    void      Deinit(void);
+
+    void RunTunToSpinel(void);
+    void RunSpinelToTun(void);
+    void RunPropertySet(void);
+
+private:
+    bool RunMainloopUntil(const std::function<bool(void)> &aCondition);
+    void SendToTun(void);
+    bool ReceiveFromTun(void);
+
+    uint32_t                 mIterations;
+    std::vector<uint8_t>     mPayload;
+    SimulatedNcp             mNcp;
+    ot::Spinel::SpinelDriver mSpinelDriver;
+    otbr::Ncp::NcpSpinel     mNcpSpinel;
+    otbr::Netif              mNetif;
+    BenchObserver            mObserver;
+    int                      mSocket;
+    sockaddr_in6             mPeerAddress;
+};
+
+otbrError NcpBenchmark::Init(const char *aInterfaceName)
+{
+    static const spinel_iid_t kIids[] = {SPINEL_HEADER_IID_0};
+
+    otbrError                         error = OTBR_ERROR_NONE;
+    std::vector<otbr::Ip6AddressInfo> addresses{{kLocalAddress, 64, 0, 1, 0}};
+
+    mSpinelDriver.Init(mNcp, /* aSoftwareReset */ true, kIids, sizeof(kIids) / sizeof(kIids[0]));
+    mNcpSpinel.Init(mSpinelDriver, mObserver);
+    mNcpSpinel.Ip6SetReceiveCallback(
+        [this](const uint8_t *aData, uint16_t aLength) { mNetif.Ip6Receive(aData, aLength); });
+
+    SuccessOrExit(error = mNetif.Init(aInterfaceName,
+                                      [this](otbr::FrameBuffer &aFrame) { return mNcpSpinel.Ip6Send(aFrame); }));
+    mNetif.UpdateIp6UnicastAddresses(addresses);
+    mNetif.SetNetifState(true);
+
+    mSocket = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mSocket >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&mPeerAddress, 0, sizeof(mPeerAddress));
+    mPeerAddress.sin6_family = AF_INET6;
+    mPeerAddress.sin6_port   = htons(kBenchPort);
+    VerifyOrExit(inet_pton(AF_INET6, kPeerAddress, &mPeerAddress.sin6_addr) == 1, error = OTBR_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+void NcpBenchmark::Deinit(void)
+{
+    if (mSocket >= 0)
+    {
+        close(mSocket);
+        mSocket = -1;
+    }
+
+    mNetif.Deinit();
+    mNcpSpinel.Deinit();
+    mSpinelDriver.Deinit();
+}
+
+bool NcpBenchmark::RunMainloopUntil(const std::function<bool(void)> &aCondition)
+{
+    static constexpr int kIdleTimeoutMs = 1000;
+
+    bool                  satisfied = aCondition();
+    Clock::time_point     deadline  = Clock::now() + std::chrono::milliseconds(kIdleTimeoutMs);
+    otbr::MainloopContext context;
+
+    while (!satisfied && Clock::now() < deadline)
+    {
+        context.mMaxFd   = mSocket;
+        context.mTimeout = {0, kIdleTimeoutMs * 1000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+        FD_SET(mSocket, &context.mReadFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        mNetif.UpdateFdSet(&context);
+        mNcp.UpdateFdSet(&context);
+
+        if (select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                   &context.mTimeout) < 0)
+        {
+            perror("select");
+            break;
+        }
+
+        mSpinelDriver.Process(&context);
+        mNetif.Process(&context);
+        otbr::MainloopManager::GetInstance().Process(context);
+
+        satisfied = aCondition();
+    }
+
+    return satisfied;
+}
+
+void NcpBenchmark::SendToTun(void)
+{
+    if (sendto(mSocket, mPayload.data(), mPayload.size(), 0, reinterpret_cast<const sockaddr *>(&mPeerAddress),
+               sizeof(mPeerAddress)) < 0)
+    {
+        perror("sendto");
+    }
+}
+
+bool NcpBenchmark::ReceiveFromTun(void)
+{
+    uint8_t buffer[kMaxPayloadSize];
+
+    return recv(mSocket, buffer, sizeof(buffer), 0) >= 0;
+}
+
+void NcpBenchmark::RunTunToSpinel(void)
+{
+    Samples           samples(mIterations);
+    uint64_t          target;
+    uint64_t          lost = 0;
+    Clock::time_point start;
+
+    // Latency of a single datagram while the path is otherwise idle.
+    for (uint32_t i = 0; i < mIterations; i++)
+    {
+        Clock::time_point sent = Clock::now();
+
+        target = mNcp.GetReceivedDatagrams() + 1;
+        SendToTun();
+        if (RunMainloopUntil([this, target] { return mNcp.GetReceivedDatagrams() >= target; }))
+        {
+            samples.Add(mNcp.GetLastDatagramTime() - sent);
+        }
+        else
+        {
+            lost++;
+        }
+    }
+
+    // Throughput with bursts of datagrams queued on the TUN device.
+    start = Clock::now();
+    for (uint32_t i = 0; i < mIterations; i += kBurstSize)
+    {
+        uint32_t burst = std::min(kBurstSize, mIterations - i);
+
+        target = mNcp.GetReceivedDatagrams() + burst;
+        for (uint32_t j = 0; j < burst; j++)
+        {
+            SendToTun();
+        }
+        if (!RunMainloopUntil([this, target] { return mNcp.GetReceivedDatagrams() >= target; }))
+        {
+            lost += target - mNcp.GetReceivedDatagrams();
+        }
+    }
+
+    samples.Print("TUN -> spinel", mIterations, Clock::now() - start, lost);
+}
+
+void NcpBenchmark::RunSpinelToTun(void)
+{
+    Samples              samples(mIterations);
+    uint64_t             lost = 0;
+    uint32_t             received;
+    std::vector<uint8_t> datagram;
+    Clock::time_point    start;
+
+    // Reflect a datagram captured from the TUN device back to the socket which sent it.
+    SendToTun();
+    if (!RunMainloopUntil([this] { return !mNcp.GetLastDatagram().empty(); }) ||
+        mNcp.GetLastDatagram().size() < kUdpPortsOffset + 2 * kUdpPortSize)
+    {
+        fprintf(stderr, "No datagram captured from the TUN device\n");
+        ExitNow();
+    }
+
+    datagram = mNcp.GetLastDatagram();
+    std::swap_ranges(&datagram[kIp6SourceOffset], &datagram[kIp6SourceOffset + kIp6AddressSize],
+                     &datagram[kIp6DestinationOffset]);
+    std::swap_ranges(&datagram[kUdpPortsOffset], &datagram[kUdpPortsOffset + kUdpPortSize],
+                     &datagram[kUdpPortsOffset + kUdpPortSize]);
+
+    while (ReceiveFromTun())
+    {
+    }
+
+    for (uint32_t i = 0; i < mIterations; i++)
+    {
+        Clock::time_point sent = Clock::now();
+
+        mNcp.SendDatagram(datagram);
+        if (RunMainloopUntil([this] { return ReceiveFromTun(); }))
+        {
+            samples.Add(Clock::now() - sent);
+        }
+        else
+        {
+            lost++;
+        }
+    }
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < mIterations; i += kBurstSize)
+    {
+        uint32_t burst = std::min(kBurstSize, mIterations - i);
+
+        received = 0;
+        for (uint32_t j = 0; j < burst; j++)
+        {
+            mNcp.SendDatagram(datagram);
+        }
+        RunMainloopUntil([this, &received, burst] {
+            while (received < burst && ReceiveFromTun())
+            {
+                received++;
+            }
+            return received >= burst;
+        });
+        lost += burst - received;
+    }
+
+    samples.Print("spinel -> TUN", mIterations, Clock::now() - start, lost);
+
+exit:
+    return;
+}
+
+void NcpBenchmark::RunPropertySet(void)
+{
+    Samples           samples(mIterations);
+    uint64_t          lost  = 0;
+    Clock::time_point start = Clock::now();
+
+    for (uint32_t i = 0; i < mIterations; i++)
+    {
+        Clock::time_point       sent   = Clock::now();
+        bool                    done   = false;
+        otError                 result = OT_ERROR_NONE;
+        otbr::Ncp::AsyncTaskPtr task =
+            otbr::Ncp::AsyncTask::Create([&done, &result](otError aError, const std::string &aErrorInfo) {
+                OTBR_UNUSED_VARIABLE(aErrorInfo);
+                result = aError;
+                done   = true;
+            });
+
+        mNcpSpinel.Ip6SetEnabled(true, task);
+        if (RunMainloopUntil([&done] { return done; }) && result == OT_ERROR_NONE)
+        {
+            samples.Add(Clock::now() - sent);
+        }
+        else
+        {
+            lost++;
+        }
+    }
+
+    samples.Print("property set RTT", mIterations, Clock::now() - start, lost);
+}
+
+void PrintUsage(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [-I interface] [-n iterations] [-s payload-size]\n"
+            "    -I  Name of the TUN device to create (default: %s)\n"
+            "    -n  Number of operations of each benchmark (default: %u)\n"
+            "    -s  UDP payload size in bytes, at most %u (default: %u)\n",
+            aProgramName, kDefaultInterfaceName, kDefaultIterations, kMaxPayloadSize, kDefaultPayloadSize);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const char   *interfaceName = kDefaultInterfaceName;
+    unsigned long iterations    = kDefaultIterations;
+    unsigned long payloadSize   = kDefaultPayloadSize;
+    int           opt;
+    int           ret = EXIT_SUCCESS;
+
+    while ((opt = getopt(argc, argv, "I:n:s:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'I':
+            interfaceName = optarg;
+            break;
+        case 'n':
+            iterations = strtoul(optarg, nullptr, 0);
+            break;
+        case 's':
+            payloadSize = strtoul(optarg, nullptr, 0);
+            break;
+        default:
+            PrintUsage(argv[0]);
+            ExitNow(ret = (opt == 'h' ? EXIT_SUCCESS : EX_USAGE));
+        }
+    }
+
+    VerifyOrExit(iterations > 0 && iterations <= UINT32_MAX && payloadSize > 0 && payloadSize <= kMaxPayloadSize,
+                 PrintUsage(argv[0]), ret = EX_USAGE);
+
+    otbrLogInit(argv[0], OTBR_LOG_WARNING, /* aPrintStderr */ true, /* aSyslogDisable */ true);
+
+    {
+        NcpBenchmark benchmark(static_cast<uint32_t>(iterations), static_cast<uint16_t>(payloadSize));
+
+        if (benchmark.Init(interfaceName) != OTBR_ERROR_NONE)
+        {
+            fprintf(stderr, "Failed to create the TUN device %s, root privileges are required\n", interfaceName);
+            ret = EX_NOPERM;
+        }
+        else
+        {
+            printf("%lu operations, %lu bytes payload\n", iterations, payloadSize);
+            benchmark.RunTunToSpinel();
+            benchmark.RunSpinelToTun();
+            benchmark.RunPropertySet();
+        }
+
+        benchmark.Deinit();
+    }
+
+    otbrLogDeinit();
+
+exit:
+    return ret;
+}
@@ -0,0 +1,623 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a load generator of the REST server.
+ *
+ *   A number of concurrent clients send keep-alive HTTP/1.1 requests to the REST server of a running otbr-agent,
+ *   each client cycles through the resources and waits for a response before sending the next request. It reports:
+ *     - Requests/s, p50 and p99 latency of each resource and in total.
+ *     - Growth of the resident set size of the otbr-agent process, if its pid is given.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+#include "samples.hpp"
+
+using otbr::Benchmark::Clock;
+using otbr::Benchmark::Samples;
+
+namespace {
+
+constexpr char     kDefaultAddress[]   = "127.0.0.1";
+constexpr uint16_t kDefaultPort        = 8081;
+constexpr uint32_t kDefaultClients     = 8;
+constexpr uint32_t kDefaultRequests    = 1000;
+constexpr auto     kResponseTimeout    = std::chrono::seconds(10);
+constexpr int      kPollIntervalMs     = 100;
+const char *const  kDefaultResources[] = {"/node", "/diagnostics", "/node/dataset/active"};
+
+/**
+ * This function parses an HTTP response at the beginning of @p aInput.
+ *
+ * @param[in]  aInput   The received data.
+ * @param[out] aLength  The length of the response if it's complete.
+ * @param[out] aStatus  The status code if the response is complete.
+ * @param[out] aClose   Whether the server closes the connection after the response.
+ *
+ * @returns Whether the response is complete.
+ *
+ */
+bool ParseResponse(const std::string &aInput, size_t &aLength, int &aStatus, bool &aClose)
+{
+    bool   complete      = false;
+    bool   chunked       = false;
+    size_t contentLength = 0;
+    size_t headerEnd     = aInput.find("\r\n\r\n");
+    size_t bodyStart;
+
+    VerifyOrExit(headerEnd != std::string::npos);
+    bodyStart = headerEnd + 4;
+
+    aStatus = 0;
+    aClose  = false;
+    sscanf(aInput.c_str(), "HTTP/%*d.%*d %d", &aStatus);
+
+    for (size_t lineStart = aInput.find("\r\n") + 2; lineStart < headerEnd;)
+    {
+        size_t      lineEnd = aInput.find("\r\n", lineStart);
+        std::string line    = aInput.substr(lineStart, lineEnd - lineStart);
+        size_t      colon   = line.find(':');
+        std::string name    = line.substr(0, colon);
+        std::string value   = (colon == std::string::npos) ? "" : line.substr(colon + 1);
+
+        if (strcasecmp(name.c_str(), "Content-Length") == 0)
+        {
+            contentLength = strtoul(value.c_str(), nullptr, 10);
+        }
+        else if (strcasecmp(name.c_str(), "Transfer-Encoding") == 0)
+        {
+            chunked = (value.find("chunked") != std::string::npos);
+        }
+        else if (strcasecmp(name.c_str(), "Connection") == 0)
+        {
+            aClose = (value.find("close") != std::string::npos);
+        }
+
+        lineStart = lineEnd + 2;
+    }
+
+    if (chunked)
+    {
+        size_t chunkStart = bodyStart;
+
+        while (true)
+        {
+            size_t lineEnd = aInput.find("\r\n", chunkStart);
+            size_t chunkSize;
+
+            VerifyOrExit(lineEnd != std::string::npos);
+            chunkSize = strtoul(aInput.c_str() + chunkStart, nullptr, 16);
+
+            // The server sends no trailer, the last chunk is followed by an empty line.
+            chunkStart = lineEnd + 2 + chunkSize + 2;
+            VerifyOrExit(chunkStart <= aInput.size());
+
+            if (chunkSize == 0)
+            {
+                aLength = chunkStart;
+                break;
+            }
+        }
+    }
+    else
+    {
+        VerifyOrExit(bodyStart + contentLength <= aInput.size());
+        aLength = bodyStart + contentLength;
+    }
+
+    complete = true;
+
+exit:
+    return complete;
+}
+
+/**
+ * This function returns the resident set size of a process.
+ *
+ * @param[in] aPid  The process id.
+ *
+ * @returns The resident set size in kB, or -1 if it's not available.
+ *
+ */
+long GetResidentSetSize(pid_t aPid)
+{
+    long  rss = -1;
+    char  path[sizeof("/proc/4294967295/status")];
+    char  line[128];
+    FILE *file;
+
+    snprintf(path, sizeof(path), "/proc/%d/status", static_cast<int>(aPid));
+    file = fopen(path, "r");
+    VerifyOrExit(file != nullptr);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        if (sscanf(line, "VmRSS: %ld kB", &rss) == 1)
+        {
+            break;
+        }
+    }
+
+    fclose(file);
+
+exit:
+    return rss;
+}
+
+class RestLoadGenerator
+{
+public:
+    RestLoadGenerator(const sockaddr_storage         &aAddress,
+                      socklen_t                       aAddressLength,
+                      const std::vector<std::string> &aResources,
+                      uint32_t                        aRequests);
+
+    otbrError Run(uint32_t aClients);
+    void      Print(void);
+
+private:
+    struct Client
+    {
+        int               mFd                = -1;
+        bool              mConnected         = false;
+        uint32_t          mCompletedRequests = 0;
+        size_t            mResourceIndex     = 0;
+        size_t            mRequestOffset     = 0;
+        std::string       mRequest;
+        std::string       mResponse;
+        Clock::time_point mSentTime;
+    };
+
+    otbrError Connect(Client &aClient);
+    void      Disconnect(Client &aClient);
+    void      StartRequest(Client &aClient);
+    otbrError HandleWritable(Client &aClient);
+    otbrError HandleReadable(Client &aClient);
+    void      HandleFailure(Client &aClient);
+    void      CompleteRequest(Client &aClient, bool aSucceeded);
+    bool      IsDone(const Client &aClient) const { return aClient.mCompletedRequests >= mRequests; }
+
+    sockaddr_storage         mAddress;
+    socklen_t                mAddressLength;
+    std::vector<std::string> mResources;
+    uint32_t                 mRequests;
+    std::vector<Client>      mClients;
+    std::vector<Samples>     mSamples;
+    std::vector<uint64_t>    mFailures;
+    Samples                  mTotalSamples;
+    uint64_t                 mTotalFailures;
+    uint64_t                 mReconnections;
+    Clock::duration          mElapsed;
+};
+
+RestLoadGenerator::RestLoadGenerator(const sockaddr_storage         &aAddress,
+                                     socklen_t                       aAddressLength,
+                                     const std::vector<std::string> &aResources,
+                                     uint32_t                        aRequests)
+    : mAddress(aAddress)
+    , mAddressLength(aAddressLength)
+    , mResources(aResources)
+    , mRequests(aRequests)
+    , mSamples(aResources.size(), Samples(aRequests))
+    , mFailures(aResources.size(), 0)
+    , mTotalSamples(aRequests)
+    , mTotalFailures(0)
+    , mReconnections(0)
+    , mElapsed(Clock::duration::zero())
+{
+}
+
+otbrError RestLoadGenerator::Connect(Client &aClient)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       yes   = 1;
+
+    aClient.mFd = socket(mAddress.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(aClient.mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    // Requests are small and sent one at a time, don't let Nagle's algorithm delay them.
+    setsockopt(aClient.mFd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+    aClient.mConnected = false;
+    VerifyOrExit(connect(aClient.mFd, reinterpret_cast<const sockaddr *>(&mAddress), mAddressLength) == 0 ||
+                     errno == EINPROGRESS,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        perror("connect");
+        Disconnect(aClient);
+    }
+
+    return error;
+}
+
+void RestLoadGenerator::Disconnect(Client &aClient)
+{
+    if (aClient.mFd >= 0)
+    {
+        close(aClient.mFd);
+        aClient.mFd = -1;
+    }
+
+    aClient.mConnected = false;
+    aClient.mResponse.clear();
+}
+
+void RestLoadGenerator::StartRequest(Client &aClient)
+{
+    aClient.mRequest = "GET " + mResources[aClient.mResourceIndex] +
+                       " HTTP/1.1\r\n"
+                       "Host: otbr\r\n"
+                       "Accept: application/json\r\n"
+                       "\r\n";
+    aClient.mRequestOffset = 0;
+    aClient.mSentTime      = Clock::now();
+}
+
+otbrError RestLoadGenerator::HandleWritable(Client &aClient)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ssize_t   sent;
+
+    if (!aClient.mConnected)
+    {
+        int       socketError = 0;
+        socklen_t length      = sizeof(socketError);
+
+        VerifyOrExit(getsockopt(aClient.mFd, SOL_SOCKET, SO_ERROR, &socketError, &length) == 0 && socketError == 0,
+                     errno = socketError, error = OTBR_ERROR_ERRNO);
+        aClient.mConnected = true;
+    }
+
+    sent = send(aClient.mFd, aClient.mRequest.data() + aClient.mRequestOffset,
+                aClient.mRequest.size() - aClient.mRequestOffset, MSG_NOSIGNAL);
+    VerifyOrExit(sent >= 0 || errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+
+    if (sent > 0)
+    {
+        aClient.mRequestOffset += static_cast<size_t>(sent);
+    }
+
+exit:
+    return error;
+}
+
+otbrError RestLoadGenerator::HandleReadable(Client &aClient)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      buffer[4096];
+    ssize_t   received;
+    size_t    length;
+    int       status;
+    bool      close;
+
+    received = recv(aClient.mFd, buffer, sizeof(buffer), 0);
+    VerifyOrExit(received != 0, errno = ECONNRESET, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(received > 0 || errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(received > 0);
+
+    aClient.mResponse.append(buffer, static_cast<size_t>(received));
+    VerifyOrExit(ParseResponse(aClient.mResponse, length, status, close));
+
+    // A response to an unpipelined request is never followed by more data.
+    aClient.mResponse.erase(0, length);
+    CompleteRequest(aClient, (status >= 200 && status < 300) || status == 304);
+
+    if (close)
+    {
+        // The server limits the number of requests of a connection.
+        Disconnect(aClient);
+        mReconnections++;
+    }
+
+exit:
+    return error;
+}
+
+void RestLoadGenerator::CompleteRequest(Client &aClient, bool aSucceeded)
+{
+    Clock::duration latency = Clock::now() - aClient.mSentTime;
+
+    if (aSucceeded)
+    {
+        mSamples[aClient.mResourceIndex].Add(latency);
+        mTotalSamples.Add(latency);
+    }
+    else
+    {
+        mFailures[aClient.mResourceIndex]++;
+        mTotalFailures++;
+    }
+
+    aClient.mCompletedRequests++;
+    aClient.mResourceIndex = (aClient.mResourceIndex + 1) % mResources.size();
+
+    if (IsDone(aClient))
+    {
+        Disconnect(aClient);
+    }
+    else
+    {
+        StartRequest(aClient);
+    }
+}
+
+void RestLoadGenerator::HandleFailure(Client &aClient)
+{
+    // Count the request as failed and retry with a new connection.
+    Disconnect(aClient);
+    CompleteRequest(aClient, false);
+    mReconnections++;
+}
+
+otbrError RestLoadGenerator::Run(uint32_t aClients)
+{
+    otbrError             error = OTBR_ERROR_NONE;
+    std::vector<pollfd>   pollFds;
+    std::vector<Client *> polledClients;
+    Clock::time_point     start = Clock::now();
+    bool                  done  = false;
+
+    mClients.assign(aClients, Client());
+
+    for (uint32_t i = 0; i < aClients; i++)
+    {
+        // Spread the clients over the resources.
+        mClients[i].mResourceIndex = i % mResources.size();
+        StartRequest(mClients[i]);
+    }
+
+    while (!done)
+    {
+        pollFds.clear();
+        polledClients.clear();
+        done = true;
+
+        for (Client &client : mClients)
+        {
+            if (IsDone(client))
+            {
+                continue;
+            }
+
+            done = false;
+
+            if (client.mFd < 0)
+            {
+                SuccessOrExit(error = Connect(client));
+                client.mSentTime = Clock::now();
+            }
+
+            if (Clock::now() - client.mSentTime > kResponseTimeout)
+            {
+                fprintf(stderr, "Request of %s timed out\n", mResources[client.mResourceIndex].c_str());
+                HandleFailure(client);
+                continue;
+            }
+
+            pollFds.push_back({client.mFd,
+                               static_cast<short>(client.mRequestOffset < client.mRequest.size() ? POLLOUT : POLLIN),
+                               0});
+            polledClients.push_back(&client);
+        }
+
+        VerifyOrExit(!pollFds.empty());
+        VerifyOrExit(poll(pollFds.data(), pollFds.size(), kPollIntervalMs) >= 0, error = OTBR_ERROR_ERRNO);
+
+        for (size_t i = 0; i < pollFds.size(); i++)
+        {
+            Client   &client = *polledClients[i];
+            otbrError result = OTBR_ERROR_NONE;
+
+            if (pollFds[i].revents & POLLOUT)
+            {
+                result = HandleWritable(client);
+            }
+            else if (pollFds[i].revents & (POLLIN | POLLERR | POLLHUP))
+            {
+                result = HandleReadable(client);
+            }
+
+            if (result != OTBR_ERROR_NONE)
+            {
+                // The server is not reachable at all if the first connection fails.
+                VerifyOrExit(client.mConnected || mTotalSamples.GetCount() > 0, error = result);
+                HandleFailure(client);
+            }
+        }
+    }
+
+exit:
+    mElapsed = Clock::now() - start;
+
+    for (Client &client : mClients)
+    {
+        Disconnect(client);
+    }
+
+    return error;
+}
+
+void RestLoadGenerator::Print(void)
+{
+    for (size_t i = 0; i < mResources.size(); i++)
+    {
+        mSamples[i].Print(mResources[i].c_str(), mSamples[i].GetCount() + mFailures[i], mElapsed, mFailures[i]);
+    }
+
+    mTotalSamples.Print("total", mTotalSamples.GetCount() + mTotalFailures, mElapsed, mTotalFailures);
+    printf("%" PRIu64 " reconnections\n", mReconnections);
+}
+
+bool ParseAddress(const char *aAddress, uint16_t aPort, sockaddr_storage &aSockAddr, socklen_t &aLength)
+{
+    bool          parsed   = true;
+    sockaddr_in6 *address6 = reinterpret_cast<sockaddr_in6 *>(&aSockAddr);
+    sockaddr_in  *address4 = reinterpret_cast<sockaddr_in *>(&aSockAddr);
+
+    memset(&aSockAddr, 0, sizeof(aSockAddr));
+
+    if (inet_pton(AF_INET6, aAddress, &address6->sin6_addr) == 1)
+    {
+        address6->sin6_family = AF_INET6;
+        address6->sin6_port   = htons(aPort);
+        aLength               = sizeof(*address6);
+    }
+    else if (inet_pton(AF_INET, aAddress, &address4->sin_addr) == 1)
+    {
+        address4->sin_family = AF_INET;
+        address4->sin_port   = htons(aPort);
+        aLength              = sizeof(*address4);
+    }
+    else
+    {
+        parsed = false;
+    }
+
+    return parsed;
+}
+
+void PrintUsage(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [-a address] [-p port] [-c clients] [-n requests] [-r resource]... [-P pid]\n"
+            "    -a  Address of the REST server (default: %s)\n"
+            "    -p  Port of the REST server (default: %u)\n"
+            "    -c  Number of concurrent keep-alive clients (default: %u)\n"
+            "    -n  Number of requests sent by each client (default: %u)\n"
+            "    -r  Resource to request, may be repeated (default: /node, /diagnostics, /node/dataset/active)\n"
+            "    -P  Pid of the otbr-agent process, to report the growth of its resident set size\n",
+            aProgramName, kDefaultAddress, kDefaultPort, kDefaultClients, kDefaultRequests);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const char              *address  = kDefaultAddress;
+    unsigned long            port     = kDefaultPort;
+    unsigned long            clients  = kDefaultClients;
+    unsigned long            requests = kDefaultRequests;
+    pid_t                    pid      = 0;
+    long                     rssBefore;
+    long                     rssAfter;
+    std::vector<std::string> resources;
+    sockaddr_storage         sockAddr;
+    socklen_t                sockAddrLength;
+    int                      opt;
+    int                      ret = EXIT_SUCCESS;
+
+    while ((opt = getopt(argc, argv, "a:p:c:n:r:P:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'a':
+            address = optarg;
+            break;
+        case 'p':
+            port = strtoul(optarg, nullptr, 0);
+            break;
+        case 'c':
+            clients = strtoul(optarg, nullptr, 0);
+            break;
+        case 'n':
+            requests = strtoul(optarg, nullptr, 0);
+            break;
+        case 'r':
+            resources.push_back(optarg);
+            break;
+        case 'P':
+            pid = static_cast<pid_t>(strtol(optarg, nullptr, 0));
+            break;
+        default:
+            PrintUsage(argv[0]);
+            ExitNow(ret = (opt == 'h' ? EXIT_SUCCESS : EX_USAGE));
+        }
+    }
+
+    VerifyOrExit(port > 0 && port <= UINT16_MAX && clients > 0 && clients <= 1000 && requests > 0 &&
+                     requests <= UINT32_MAX,
+                 PrintUsage(argv[0]), ret = EX_USAGE);
+    VerifyOrExit(ParseAddress(address, static_cast<uint16_t>(port), sockAddr, sockAddrLength), PrintUsage(argv[0]),
+                 ret = EX_USAGE);
+
+    if (resources.empty())
+    {
+        resources.assign(std::begin(kDefaultResources), std::end(kDefaultResources));
+    }
+
+    {
+        RestLoadGenerator generator(sockAddr, sockAddrLength, resources, static_cast<uint32_t>(requests));
+
+        rssBefore = (pid > 0) ? GetResidentSetSize(pid) : -1;
+
+        printf("%lu clients, %lu requests each\n", clients, requests);
+        if (generator.Run(static_cast<uint32_t>(clients)) != OTBR_ERROR_NONE)
+        {
+            fprintf(stderr, "Failed to reach the REST server at %s port %lu: %s\n", address, port, strerror(errno));
+            ExitNow(ret = EX_UNAVAILABLE);
+        }
+        generator.Print();
+
+        rssAfter = (pid > 0) ? GetResidentSetSize(pid) : -1;
+        if (rssBefore >= 0 && rssAfter >= 0)
+        {
+            printf("otbr-agent RSS %ld kB -> %ld kB (%+ld kB)\n", rssBefore, rssAfter, rssAfter - rssBefore);
+        }
+    }
+
+exit:
+    return ret;
+}
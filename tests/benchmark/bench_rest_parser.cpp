@@ -0,0 +1,320 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a fuzz target and a benchmark of the REST request parser.
+ *
+ *   The input is parsed the way `Connection` parses the received data: the data is appended to the read buffer in
+ *   fragments, the pipelined requests are parsed one at a time and the data of a request is released once it is
+ *   handled.
+ *     - Built as a libFuzzer target (OTBR_REST_PARSER_FUZZER), an input is parsed at once and in fragments of
+ *       several sizes, with requests copying the parsed data and referring to the read buffer. All of them must
+ *       give the same requests.
+ *     - Otherwise, pipelined GET and PUT requests, with and without a chunked body, are parsed in fragments of
+ *       several sizes. It reports MB/s and requests/s with requests copying the parsed data and referring to the
+ *       read buffer.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sysexits.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+
+#include "samples.hpp"
+
+using otbr::Benchmark::Clock;
+using otbr::rest::HttpMethod;
+using otbr::rest::Parser;
+using otbr::rest::Request;
+
+namespace {
+
+constexpr size_t kFragmentSizes[] = {1, 7, 64, 1460};
+
+/**
+ * This structure represents the fields of a parsed request which are used by the resource handlers.
+ *
+ */
+struct ParsedRequest
+{
+    HttpMethod  mMethod;
+    std::string mUrl;
+    std::string mQuery;
+    std::string mBody;
+    std::string mContentType;
+    bool        mKeepAlive;
+
+    bool operator==(const ParsedRequest &aOther) const
+    {
+        return mMethod == aOther.mMethod && mUrl == aOther.mUrl && mQuery == aOther.mQuery &&
+               mBody == aOther.mBody && mContentType == aOther.mContentType && mKeepAlive == aOther.mKeepAlive;
+    }
+};
+
+/**
+ * This function parses a stream of requests received in fragments.
+ *
+ * @param[in]  aData          A pointer to the received data.
+ * @param[in]  aLength        The length of the received data.
+ * @param[in]  aFragmentSize  The number of bytes received at a time.
+ * @param[in]  aZeroCopy      Whether the requests refer to the read buffer instead of copying the parsed data.
+ * @param[out] aRequests      The complete requests.
+ *
+ * @returns Whether the data is valid, the last request may however be incomplete.
+ *
+ */
+bool ParseStream(const char                 *aData,
+                 size_t                      aLength,
+                 size_t                      aFragmentSize,
+                 bool                        aZeroCopy,
+                 std::vector<ParsedRequest> &aRequests)
+{
+    bool        valid        = true;
+    size_t      parsedLength = 0;
+    std::string readBuffer;
+    Request     request;
+    Parser      parser(&request);
+
+    parser.Init();
+    request.SetReadBuffer(aZeroCopy ? &readBuffer : nullptr);
+
+    for (size_t offset = 0; valid && offset < aLength; offset += aFragmentSize)
+    {
+        readBuffer.append(aData + offset, std::min(aFragmentSize, aLength - offset));
+
+        while (parsedLength < readBuffer.size())
+        {
+            size_t length;
+
+            if (parser.Process(readBuffer.data() + parsedLength, readBuffer.size() - parsedLength, length) !=
+                OTBR_ERROR_NONE)
+            {
+                valid = false;
+                break;
+            }
+
+            parsedLength += length;
+
+            // The parser doesn't continue after e.g. a protocol upgrade.
+            if (!request.IsComplete())
+            {
+                valid = (length > 0);
+                break;
+            }
+
+            aRequests.push_back({request.GetMethod(), request.GetUrl(), request.GetQueryParameter("q"),
+                                 request.GetBody(), request.GetHeaderValue("Content-Type"), request.IsKeepAlive()});
+
+            readBuffer.erase(0, parsedLength);
+            parsedLength = 0;
+            request      = Request();
+            request.SetReadBuffer(aZeroCopy ? &readBuffer : nullptr);
+        }
+    }
+
+    return valid;
+}
+
+} // namespace
+
+#if OTBR_REST_PARSER_FUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *aData, size_t aSize)
+{
+    const char                *data = reinterpret_cast<const char *>(aData);
+    std::vector<ParsedRequest> expectedRequests;
+    bool                       expectedValid;
+
+    VerifyOrExit(aSize > 0);
+
+    expectedValid = ParseStream(data, aSize, aSize, /* aZeroCopy */ false, expectedRequests);
+
+    for (size_t fragmentSize : kFragmentSizes)
+    {
+        for (bool zeroCopy : {false, true})
+        {
+            std::vector<ParsedRequest> requests;
+            bool                       valid = ParseStream(data, aSize, fragmentSize, zeroCopy, requests);
+
+            // Whether a prefix of an invalid input is parsed may depend on the fragments.
+            if (valid != expectedValid || (expectedValid && requests != expectedRequests))
+            {
+                abort();
+            }
+        }
+    }
+
+exit:
+    return 0;
+}
+
+#else // OTBR_REST_PARSER_FUZZER
+
+namespace {
+
+constexpr unsigned long kDefaultRequests = 20000;
+constexpr unsigned long kDefaultRuns     = 5;
+
+/**
+ * This function generates pipelined requests like the ones sent by REST clients.
+ *
+ */
+std::string MakeRequests(uint32_t aCount)
+{
+    static const char kGetRequest[] = "GET /node/dataset/active?q=1 HTTP/1.1\r\n"
+                                      "Host: localhost:8081\r\n"
+                                      "User-Agent: otbr-bench-rest-parser\r\n"
+                                      "Accept: application/json\r\n"
+                                      "\r\n";
+    static const char kPutRequest[] = "PUT /node/state HTTP/1.1\r\n"
+                                      "Host: localhost:8081\r\n"
+                                      "Content-Type: application/json\r\n"
+                                      "Content-Length: 8\r\n"
+                                      "\r\n"
+                                      "\"enable\"";
+    static const char kChunkedRequest[] = "PUT /node/dataset/pending HTTP/1.1\r\n"
+                                          "Host: localhost:8081\r\n"
+                                          "Content-Type: application/json\r\n"
+                                          "Transfer-Encoding: chunked\r\n"
+                                          "\r\n"
+                                          "1a\r\n{\"ActiveTimestamp\":{\"Secon\r\n"
+                                          "1c\r\nds\":1},\"NetworkName\":\"bench\"\r\n"
+                                          "1\r\n}\r\n"
+                                          "0\r\n\r\n";
+    static const char *const kRequests[] = {kGetRequest, kGetRequest, kPutRequest, kChunkedRequest};
+
+    std::string requests;
+
+    for (uint32_t i = 0; i < aCount; i++)
+    {
+        requests += kRequests[i % (sizeof(kRequests) / sizeof(kRequests[0]))];
+    }
+
+    return requests;
+}
+
+void RunParser(const std::string &aRequests, uint32_t aCount, uint32_t aRuns, size_t aFragmentSize, bool aZeroCopy)
+{
+    Clock::duration elapsed = Clock::duration::zero();
+    uint64_t        lost    = 0;
+    double          seconds;
+    char            name[32];
+
+    for (uint32_t run = 0; run < aRuns; run++)
+    {
+        std::vector<ParsedRequest> requests;
+        Clock::time_point          start = Clock::now();
+
+        requests.reserve(aCount);
+        if (!ParseStream(aRequests.data(), aRequests.size(), aFragmentSize, aZeroCopy, requests))
+        {
+            fprintf(stderr, "Failed to parse the requests\n");
+        }
+        elapsed += Clock::now() - start;
+        lost += aCount - requests.size();
+    }
+
+    seconds = std::chrono::duration<double>(elapsed).count();
+    snprintf(name, sizeof(name), "%s %zu B", aZeroCopy ? "zero-copy" : "copy", aFragmentSize);
+    printf("%-24s %10.1f MB/s %12.0f requests/s   lost %" PRIu64 "\n", name,
+           seconds > 0 ? aRequests.size() * static_cast<double>(aRuns) / seconds / 1e6 : 0.0,
+           seconds > 0 ? static_cast<double>(aCount) * aRuns / seconds : 0.0, lost);
+}
+
+void PrintUsage(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [-n requests] [-r runs]\n"
+            "    -n  Number of pipelined requests (default: %lu)\n"
+            "    -r  Number of runs of each benchmark (default: %lu)\n",
+            aProgramName, kDefaultRequests, kDefaultRuns);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    unsigned long count = kDefaultRequests;
+    unsigned long runs  = kDefaultRuns;
+    int           opt;
+    int           ret = EXIT_SUCCESS;
+    std::string   requests;
+
+    while ((opt = getopt(argc, argv, "n:r:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            count = strtoul(optarg, nullptr, 0);
+            break;
+        case 'r':
+            runs = strtoul(optarg, nullptr, 0);
+            break;
+        default:
+            PrintUsage(argv[0]);
+            ExitNow(ret = (opt == 'h' ? EXIT_SUCCESS : EX_USAGE));
+        }
+    }
+
+    VerifyOrExit(count > 0 && count <= UINT32_MAX && runs > 0 && runs <= UINT32_MAX, PrintUsage(argv[0]),
+                 ret = EX_USAGE);
+
+    otbrLogInit(argv[0], OTBR_LOG_WARNING, /* aPrintStderr */ true, /* aSyslogDisable */ true);
+
+    requests = MakeRequests(static_cast<uint32_t>(count));
+    printf("%lu pipelined requests, %zu bytes, %lu runs\n", count, requests.size(), runs);
+
+    for (size_t fragmentSize : kFragmentSizes)
+    {
+        for (bool zeroCopy : {false, true})
+        {
+            RunParser(requests, static_cast<uint32_t>(count), static_cast<uint32_t>(runs), fragmentSize, zeroCopy);
+        }
+    }
+
+    otbrLogDeinit();
+
+exit:
+    return ret;
+}
+
+#endif // OTBR_REST_PARSER_FUZZER
@@ -0,0 +1,95 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the latency samples shared by the benchmarks.
+ */
+
+#ifndef OTBR_TESTS_BENCHMARK_SAMPLES_HPP_
+#define OTBR_TESTS_BENCHMARK_SAMPLES_HPP_
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace otbr {
+namespace Benchmark {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * This class collects latency samples and reports throughput and percentiles.
+ *
+ */
+class Samples
+{
+public:
+    explicit Samples(uint32_t aCapacity) { mLatencies.reserve(aCapacity); }
+
+    void Add(Clock::duration aLatency) { mLatencies.push_back(aLatency); }
+
+    void Add(const Samples &aSamples)
+    {
+        mLatencies.insert(mLatencies.end(), aSamples.mLatencies.begin(), aSamples.mLatencies.end());
+    }
+
+    size_t GetCount(void) const { return mLatencies.size(); }
+
+    void Print(const char *aName, uint64_t aOperations, Clock::duration aElapsed, uint64_t aLost)
+    {
+        double seconds = std::chrono::duration<double>(aElapsed).count();
+
+        std::sort(mLatencies.begin(), mLatencies.end());
+        printf("%-24s %10.0f ops/s   p50 %8.1f us   p99 %8.1f us   lost %" PRIu64 "\n", aName,
+               seconds > 0 ? aOperations / seconds : 0.0, ToMicroseconds(Percentile(50)),
+               ToMicroseconds(Percentile(99)), aLost);
+    }
+
+private:
+    Clock::duration Percentile(uint32_t aPercent) const
+    {
+        return mLatencies.empty() ? Clock::duration::zero()
+                                  : mLatencies[std::min(mLatencies.size() - 1, mLatencies.size() * aPercent / 100)];
+    }
+
+    static double ToMicroseconds(Clock::duration aDuration)
+    {
+        return std::chrono::duration<double, std::micro>(aDuration).count();
+    }
+
+    std::vector<Clock::duration> mLatencies;
+};
+
+} // namespace Benchmark
+} // namespace otbr
+
+#endif // OTBR_TESTS_BENCHMARK_SAMPLES_HPP_
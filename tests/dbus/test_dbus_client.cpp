@@ -27,16 +27,26 @@
  */
 
 #include <assert.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <dbus/dbus.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/tlv.hpp"
 #include "dbus/client/thread_api_dbus.hpp"
 #include "dbus/common/constants.hpp"
 #if OTBR_ENABLE_TELEMETRY_DATA_API
@@ -44,6 +54,8 @@
 #endif
 #include "proto/capabilities.pb.h"
 
+#include "samples.hpp"
+
 using otbr::DBus::ActiveScanResult;
 using otbr::DBus::ClientError;
 using otbr::DBus::DeviceRole;
@@ -51,11 +63,15 @@ using otbr::DBus::EnergyScanResult;
 using otbr::DBus::ExternalRoute;
 using otbr::DBus::Ip6Prefix;
 using otbr::DBus::LinkModeConfig;
+using otbr::DBus::NetworkProperties;
 using otbr::DBus::OnMeshPrefix;
 using otbr::DBus::SrpServerInfo;
 using otbr::DBus::ThreadApiDBus;
 using otbr::DBus::TxtEntry;
 
+using otbr::Benchmark::Clock;
+using otbr::Benchmark::Samples;
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 using otbr::DBus::DnssdCounters;
 #endif
@@ -155,6 +171,34 @@ static void CheckFeatureFlagUpdate(ThreadApiDBus *aApi)
 #endif
 }
 
+void CheckNetworkProperties(ThreadApiDBus *aApi)
+{
+    NetworkProperties properties;
+    DeviceRole        role;
+    std::string       networkName;
+    uint16_t          panId;
+    uint64_t          extPanId;
+    uint16_t          channel;
+    uint16_t          rloc16;
+    uint64_t          extAddress;
+
+    TEST_ASSERT(aApi->GetNetworkProperties(properties) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetDeviceRole(role) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetNetworkName(networkName) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetPanId(panId) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExtPanId(extPanId) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetChannel(channel) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetRloc16(rloc16) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetExtendedAddress(extAddress) == OTBR_ERROR_NONE);
+    TEST_ASSERT(properties.mDeviceRole == role);
+    TEST_ASSERT(properties.mNetworkName == networkName);
+    TEST_ASSERT(properties.mPanId == panId);
+    TEST_ASSERT(properties.mExtPanId == extPanId);
+    TEST_ASSERT(properties.mChannel == channel);
+    TEST_ASSERT(properties.mRloc16 == rloc16);
+    TEST_ASSERT(properties.mExtendedAddress == extAddress);
+}
+
 void CheckSrpServerInfo(ThreadApiDBus *aApi)
 {
     SrpServerInfo srpServerInfo;
@@ -373,6 +417,31 @@ void CheckTelemetryData(ThreadApiDBus *aApi)
     CheckBorderAgentInfo(telemetryData.wpan_border_router().border_agent_info());
 #endif
 }
+
+void CheckTelemetryDataFd(ThreadApiDBus *aApi)
+{
+    int                          fd = -1;
+    struct stat                  fileStat;
+    void                        *data;
+    threadnetwork::TelemetryData telemetryData;
+
+    TEST_ASSERT(aApi->GetTelemetryDataFd(/* aSections */ 0x01, fd) == OTBR_ERROR_NONE);
+    TEST_ASSERT(fd != -1);
+    TEST_ASSERT(fstat(fd, &fileStat) == 0);
+    TEST_ASSERT(fileStat.st_size > 0);
+
+    // The file is sealed, it can't be written by the client.
+    TEST_ASSERT(write(fd, "", 1) == -1);
+
+    data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    TEST_ASSERT(data != MAP_FAILED);
+    TEST_ASSERT(telemetryData.ParseFromArray(data, static_cast<int>(fileStat.st_size)));
+    TEST_ASSERT(telemetryData.wpan_stats().node_type() == threadnetwork::TelemetryData::NODE_TYPE_LEADER);
+    TEST_ASSERT(!telemetryData.has_wpan_topo_full());
+
+    munmap(data, fileStat.st_size);
+    close(fd);
+}
 #endif
 
 void CheckCapabilities(ThreadApiDBus *aApi)
@@ -394,7 +463,361 @@ void CheckCapabilities(ThreadApiDBus *aApi)
     TEST_ASSERT(capabilities.nat64() == OTBR_ENABLE_NAT64);
 }
 
-int main()
+void CheckPropertyCache(ThreadApiDBus *aApi)
+{
+    DeviceRole role;
+    DeviceRole cachedRole;
+
+    TEST_ASSERT(aApi->EnablePropertyCache() == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetDeviceRole(role) == OTBR_ERROR_NONE);
+    // The second read is answered from the reply of the first one.
+    TEST_ASSERT(aApi->GetDeviceRole(cachedRole) == OTBR_ERROR_NONE);
+    TEST_ASSERT(cachedRole == role);
+}
+
+void CheckAsyncGetters(ThreadApiDBus *aApi, DBusConnection *aConnection)
+{
+    std::vector<otbr::DBus::ChildInfo>    childTable;
+    std::vector<otbr::DBus::NeighborInfo> neighborTable;
+    int                                   pendingCount = 2;
+
+    TEST_ASSERT(aApi->GetChildTable(childTable) == OTBR_ERROR_NONE);
+    TEST_ASSERT(aApi->GetNeighborTable(neighborTable) == OTBR_ERROR_NONE);
+
+    auto childTableHandler = [&childTable, &pendingCount](ClientError                               aError,
+                                                          const std::vector<otbr::DBus::ChildInfo> &aTable) {
+        TEST_ASSERT(aError == ClientError::ERROR_NONE);
+        TEST_ASSERT(aTable.size() == childTable.size());
+        pendingCount--;
+    };
+    auto neighborTableHandler = [&neighborTable, &pendingCount](ClientError                                  aError,
+                                                                const std::vector<otbr::DBus::NeighborInfo> &aTable) {
+        TEST_ASSERT(aError == ClientError::ERROR_NONE);
+        TEST_ASSERT(aTable.size() == neighborTable.size());
+        pendingCount--;
+    };
+
+    // Both requests are pending at the same time.
+    TEST_ASSERT(aApi->GetChildTableAsync(childTableHandler) == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetNeighborTableAsync(neighborTableHandler) == ClientError::ERROR_NONE);
+
+    while (pendingCount > 0)
+    {
+        dbus_connection_read_write_dispatch(aConnection, 0);
+    }
+}
+
+/**
+ * This function creates a thread API on a private connection, so that each benchmark thread has its own.
+ *
+ */
+static std::unique_ptr<ThreadApiDBus> CreatePrivateApi(UniqueDBusConnection &aConnection)
+{
+    DBusError error;
+
+    dbus_error_init(&error);
+    aConnection = UniqueDBusConnection(dbus_bus_get_private(DBUS_BUS_SYSTEM, &error));
+    TEST_ASSERT(aConnection != nullptr);
+    dbus_connection_set_exit_on_disconnect(aConnection.get(), false);
+    dbus_error_free(&error);
+
+    return std::unique_ptr<ThreadApiDBus>(new ThreadApiDBus(aConnection.get()));
+}
+
+static void ClosePrivateConnection(UniqueDBusConnection &aConnection)
+{
+    dbus_connection_close(aConnection.get());
+    aConnection.reset();
+}
+
+struct BenchmarkCall
+{
+    const char                                  *mName;
+    std::function<ClientError(ThreadApiDBus &)> mCall;
+};
+
+static std::vector<BenchmarkCall> GetBenchmarkCalls(void)
+{
+    std::vector<BenchmarkCall> calls;
+
+    calls.push_back({"DeviceRole", [](ThreadApiDBus &aApi) {
+                         DeviceRole role;
+
+                         return aApi.GetDeviceRole(role);
+                     }});
+    calls.push_back({"ChildTable", [](ThreadApiDBus &aApi) {
+                         std::vector<otbr::DBus::ChildInfo> childTable;
+
+                         return aApi.GetChildTable(childTable);
+                     }});
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    calls.push_back({"TelemetryData", [](ThreadApiDBus &aApi) {
+                         std::vector<uint8_t> telemetryData;
+
+                         return aApi.GetTelemetryData(telemetryData);
+                     }});
+#endif
+    calls.push_back({"GetProperties", [](ThreadApiDBus &aApi) {
+                         NetworkProperties properties;
+
+                         return aApi.GetNetworkProperties(properties);
+                     }});
+
+    return calls;
+}
+
+/**
+ * This function measures a call made by concurrent clients, each on its own connection.
+ *
+ */
+static void BenchmarkConcurrentCalls(const BenchmarkCall &aCall, uint32_t aClientCount, uint32_t aCallCount)
+{
+    std::vector<Samples>     samples(aClientCount, Samples(aCallCount));
+    std::vector<std::thread> clients;
+    std::atomic<uint64_t>    errorCount(0);
+    Samples                  allSamples(aClientCount * aCallCount);
+    Clock::time_point        start = Clock::now();
+
+    for (uint32_t i = 0; i < aClientCount; i++)
+    {
+        clients.emplace_back([&aCall, aCallCount, &errorCount, &samples, i]() {
+            Samples                       &clientSamples = samples[i];
+            UniqueDBusConnection           connection;
+            std::unique_ptr<ThreadApiDBus> api = CreatePrivateApi(connection);
+
+            for (uint32_t n = 0; n < aCallCount; n++)
+            {
+                Clock::time_point callStart = Clock::now();
+
+                if (aCall.mCall(*api) != ClientError::ERROR_NONE)
+                {
+                    errorCount++;
+                }
+                clientSamples.Add(Clock::now() - callStart);
+            }
+
+            api.reset();
+            ClosePrivateConnection(connection);
+        });
+    }
+
+    for (std::thread &client : clients)
+    {
+        client.join();
+    }
+
+    for (const Samples &clientSamples : samples)
+    {
+        allSamples.Add(clientSamples);
+    }
+    allSamples.Print(aCall.mName, static_cast<uint64_t>(aClientCount) * aCallCount, Clock::now() - start, errorCount);
+}
+
+/**
+ * This class receives the `PropertiesChanged` signals of the active dataset on its own connection and thread.
+ *
+ */
+class DatasetSignalReceiver
+{
+public:
+    DatasetSignalReceiver(void)
+        : mStopped(false)
+        , mReceived(false)
+    {
+        static const char kMatchRule[] = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES
+                                         "',member='" DBUS_PROPERTIES_CHANGED_SIGNAL "',path='" OTBR_DBUS_OBJECT_PREFIX
+                                         "wpan0'";
+        DBusError         error;
+
+        dbus_error_init(&error);
+        mConnection = UniqueDBusConnection(dbus_bus_get_private(DBUS_BUS_SYSTEM, &error));
+        TEST_ASSERT(mConnection != nullptr);
+        dbus_connection_set_exit_on_disconnect(mConnection.get(), false);
+        dbus_bus_add_match(mConnection.get(), kMatchRule, &error);
+        TEST_ASSERT(!dbus_error_is_set(&error));
+        TEST_ASSERT(dbus_connection_add_filter(mConnection.get(), HandleMessage, this, nullptr));
+        dbus_error_free(&error);
+
+        mThread = std::thread([this]() {
+            while (!mStopped && dbus_connection_read_write_dispatch(mConnection.get(), 100))
+            {
+            }
+        });
+    }
+
+    ~DatasetSignalReceiver(void)
+    {
+        mStopped = true;
+        mThread.join();
+        dbus_connection_remove_filter(mConnection.get(), HandleMessage, this);
+        ClosePrivateConnection(mConnection);
+    }
+
+    void Reset(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mReceived = false;
+    }
+
+    bool Wait(Clock::time_point &aReceivedTime)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        bool                         received;
+
+        received      = mCondition.wait_for(lock, std::chrono::seconds(5), [this]() { return mReceived; });
+        aReceivedTime = mReceivedTime;
+
+        return received;
+    }
+
+private:
+    static DBusHandlerResult HandleMessage(DBusConnection *aConnection, DBusMessage *aMessage, void *aReceiver)
+    {
+        OTBR_UNUSED_VARIABLE(aConnection);
+
+        static_cast<DatasetSignalReceiver *>(aReceiver)->HandleMessage(aMessage);
+
+        return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    }
+
+    void HandleMessage(DBusMessage *aMessage)
+    {
+        Clock::time_point now = Clock::now();
+        DBusMessageIter   iter;
+        DBusMessageIter   changes;
+
+        VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
+        VerifyOrExit(dbus_message_iter_init(aMessage, &iter) && dbus_message_iter_next(&iter));
+        VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
+
+        for (dbus_message_iter_recurse(&iter, &changes);
+             dbus_message_iter_get_arg_type(&changes) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&changes))
+        {
+            DBusMessageIter entry;
+            const char     *name;
+
+            dbus_message_iter_recurse(&changes, &entry);
+            VerifyOrExit(dbus_message_iter_get_arg_type(&entry) == DBUS_TYPE_STRING);
+            dbus_message_iter_get_basic(&entry, &name);
+
+            if (strcmp(name, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS) == 0)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+
+                mReceived     = true;
+                mReceivedTime = now;
+                mCondition.notify_one();
+                break;
+            }
+        }
+
+    exit:
+        return;
+    }
+
+    UniqueDBusConnection    mConnection;
+    std::thread             mThread;
+    std::atomic<bool>       mStopped;
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+    bool                    mReceived;
+    Clock::time_point       mReceivedTime;
+};
+
+/**
+ * This function measures the delivery of the `PropertiesChanged` signal of the active dataset.
+ *
+ * The network name of the active dataset is toggled, and restored at the end.
+ *
+ */
+static void BenchmarkSignalDelivery(ThreadApiDBus &aApi, uint32_t aSignalCount)
+{
+    static constexpr uint8_t kNetworkNameTlvType = 3;
+    static const char *const kNetworkNames[]     = {"OTBR-Bench-A", "OTBR-Bench-B"};
+
+    std::vector<uint8_t>  originalDataset;
+    DatasetSignalReceiver receiver;
+    Samples               samples(aSignalCount);
+    uint64_t              lostCount = 0;
+    Clock::time_point     start;
+
+    TEST_ASSERT(aApi.GetActiveDatasetTlvs(originalDataset) == ClientError::ERROR_NONE);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < aSignalCount; i++)
+    {
+        const char          *networkName = kNetworkNames[i % 2];
+        std::vector<uint8_t> dataset     = originalDataset;
+        Clock::time_point    setTime;
+        Clock::time_point    receivedTime;
+
+        dataset.resize(originalDataset.size() + sizeof("OTBR-Bench-A") + 2);
+        {
+            otbr::TlvEditor editor(dataset.data(), originalDataset.size(), dataset.size());
+
+            TEST_ASSERT(editor.Set(kNetworkNameTlvType, networkName, static_cast<uint16_t>(strlen(networkName))) ==
+                        OTBR_ERROR_NONE);
+            dataset.resize(editor.GetLength());
+        }
+
+        receiver.Reset();
+        setTime = Clock::now();
+        TEST_ASSERT(aApi.SetActiveDatasetTlvs(dataset) == ClientError::ERROR_NONE);
+
+        if (receiver.Wait(receivedTime))
+        {
+            samples.Add(receivedTime - setTime);
+        }
+        else
+        {
+            lostCount++;
+        }
+    }
+    samples.Print("ActiveDatasetTlvs signal", aSignalCount, Clock::now() - start, lostCount);
+
+    TEST_ASSERT(aApi.SetActiveDatasetTlvs(originalDataset) == ClientError::ERROR_NONE);
+}
+
+/**
+ * This function runs the benchmark mode:
+ *
+ *   otbr-test-dbus-client --bench [clients] [calls] [signals]
+ *
+ * Each call is made `calls` times by each of `clients` concurrent clients, then the active dataset is changed `signals`
+ * times to measure the delivery of the signal.
+ *
+ */
+static int RunBenchmark(int aArgCount, char *aArgVector[])
+{
+    uint32_t clientCount = aArgCount > 2 ? static_cast<uint32_t>(strtoul(aArgVector[2], nullptr, 0)) : 4;
+    uint32_t callCount   = aArgCount > 3 ? static_cast<uint32_t>(strtoul(aArgVector[3], nullptr, 0)) : 1000;
+    uint32_t signalCount = aArgCount > 4 ? static_cast<uint32_t>(strtoul(aArgVector[4], nullptr, 0)) : 20;
+
+    TEST_ASSERT(clientCount > 0 && callCount > 0);
+    TEST_ASSERT(dbus_threads_init_default());
+
+    printf("D-Bus benchmark: %" PRIu32 " clients x %" PRIu32 " calls, %" PRIu32 " signals\n", clientCount, callCount,
+           signalCount);
+    for (const BenchmarkCall &call : GetBenchmarkCalls())
+    {
+        BenchmarkConcurrentCalls(call, clientCount, callCount);
+    }
+
+    if (signalCount > 0)
+    {
+        UniqueDBusConnection           connection;
+        std::unique_ptr<ThreadApiDBus> api = CreatePrivateApi(connection);
+
+        BenchmarkSignalDelivery(*api, signalCount);
+        api.reset();
+        ClosePrivateConnection(connection);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
 {
     DBusError                      error;
     UniqueDBusConnection           connection;
@@ -405,6 +828,11 @@ int main()
     bool                           stepDone             = false;
     uint32_t                       preferredChannelMask = 0;
 
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+    {
+        return RunBenchmark(argc, argv);
+    }
+
     dbus_error_init(&error);
     connection = UniqueDBusConnection(dbus_bus_get(DBUS_BUS_SYSTEM, &error));
 
@@ -423,6 +851,8 @@ int main()
 
     TEST_ASSERT(api->GetPreferredChannelMask(preferredChannelMask) == ClientError::ERROR_NONE);
 
+    CheckAsyncGetters(api.get(), connection.get());
+
     api->EnergyScan(scanDuration, [&stepDone](const std::vector<EnergyScanResult> &aResult) {
         TEST_ASSERT(!aResult.empty());
         printf("Energy Scan:\n");
@@ -500,6 +930,7 @@ int main()
                             TEST_ASSERT(api->GetInstantRssi(rssi) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetRadioTxPower(txPower) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetActiveDatasetTlvs(activeDataset) == OTBR_ERROR_NONE);
+                            CheckNetworkProperties(api.get());
                             CheckSrpServerInfo(api.get());
                             CheckTrelInfo(api.get());
                             CheckMdnsInfo(api.get());
@@ -508,8 +939,10 @@ int main()
                             CheckEphemeralKey(api.get());
 #if OTBR_ENABLE_TELEMETRY_DATA_API
                             CheckTelemetryData(api.get());
+                            CheckTelemetryDataFd(api.get());
 #endif
                             CheckCapabilities(api.get());
+                            CheckPropertyCache(api.get());
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->GetNetworkName(name) == OTBR_ERROR_NONE);
                             TEST_ASSERT(rloc16 != 0xffff);
@@ -198,3 +198,61 @@ TEST(AsyncTask, TestMultipleStepsFailedHalfWay)
     EXPECT_EQ(resultHandlerCalledTimes, 1);
     EXPECT_EQ(error, OT_ERROR_BUSY);
 }
+
+TEST(AsyncTask, TestPooledTasksReuseMemory)
+{
+    int resultHandlerCalledTimes = 0;
+    int stepCount                = 0;
+
+    auto runChain = [&resultHandlerCalledTimes, &stepCount](otError aStep2Error) {
+        AsyncTaskPtr task = AsyncTask::Create([&resultHandlerCalledTimes](otError, const std::string &) {
+            resultHandlerCalledTimes++;
+        });
+
+        task->First([&stepCount](AsyncTaskPtr aNext) {
+                stepCount++;
+                aNext->SetResult(OT_ERROR_NONE, "");
+            })
+            ->Then([&stepCount, aStep2Error](AsyncTaskPtr aNext) {
+                stepCount++;
+                aNext->SetResult(aStep2Error, "");
+            })
+            ->Then([&stepCount](AsyncTaskPtr aNext) {
+                stepCount++;
+                aNext->SetResult(OT_ERROR_NONE, "");
+            });
+        task->Run();
+    };
+
+    // Warms up the pool.
+    runChain(OT_ERROR_NONE);
+    EXPECT_EQ(resultHandlerCalledTimes, 1);
+    EXPECT_EQ(stepCount, 3);
+
+    size_t heapAllocationCount = AsyncTask::GetPoolHeapAllocationCount();
+
+    for (int i = 0; i < 100; i++)
+    {
+        runChain(i % 2 == 0 ? OT_ERROR_NONE : OT_ERROR_BUSY);
+    }
+
+    EXPECT_EQ(resultHandlerCalledTimes, 101);
+    EXPECT_EQ(stepCount, 3 + 50 * 3 + 50 * 2);
+    EXPECT_EQ(AsyncTask::GetPoolHeapAllocationCount(), heapAllocationCount);
+}
+
+TEST(AsyncTask, TestPooledTaskEndsWithoutResult)
+{
+    AsyncTaskPtr task;
+    AsyncTaskPtr step1;
+    otError      error = OT_ERROR_NONE;
+
+    task = AsyncTask::Create([&error](otError aError, const std::string &) { error = aError; });
+    task->First([&step1](AsyncTaskPtr aNext) { step1 = std::move(aNext); })->Then([](AsyncTaskPtr) {});
+    task->Run();
+
+    step1 = nullptr;
+    task  = nullptr;
+
+    EXPECT_EQ(error, OT_ERROR_FAILED);
+}
@@ -0,0 +1,232 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TEST"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "common/binary_log.hpp"
+
+using otbr::BinaryLog;
+using otbr::BinaryLogReader;
+using otbr::BinaryLogWriter;
+
+namespace {
+
+const char kBinaryLogPath[] = "/tmp/otbr-test.binlog";
+
+void WriteLog(BinaryLogWriter &aWriter, otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    EXPECT_TRUE(aWriter.Log(aLevel, aLogTag, aFormat, args));
+    va_end(args);
+}
+
+bool TryWriteLog(BinaryLogWriter &aWriter, otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
+{
+    va_list args;
+    bool    handled;
+
+    va_start(args, aFormat);
+    handled = aWriter.Log(aLevel, aLogTag, aFormat, args);
+    va_end(args);
+
+    return handled;
+}
+
+std::string Format(const char *aFormat, ...)
+{
+    va_list args;
+    char    buffer[1024];
+
+    va_start(args, aFormat);
+    vsnprintf(buffer, sizeof(buffer), aFormat, args);
+    va_end(args);
+
+    return buffer;
+}
+
+// Strips the time preceding the message.
+std::string ReadNext(BinaryLogReader &aReader)
+{
+    std::string text;
+
+    EXPECT_EQ(aReader.ReadNext(text), OTBR_ERROR_NONE);
+
+    return text.substr(text.find(' ') + 1);
+}
+
+} // namespace
+
+TEST(BinaryLog, ParseFormat)
+{
+    std::vector<BinaryLog::Conversion> conversions;
+
+    EXPECT_EQ(BinaryLog::ParseFormat("100%% %-08lx %*.*s %.4s %zu %p %Lf", conversions), OTBR_ERROR_NONE);
+    ASSERT_EQ(conversions.size(), 7U);
+    EXPECT_EQ(conversions[0].mArg, BinaryLog::Arg::kNone);
+    EXPECT_EQ(conversions[1].mArg, BinaryLog::Arg::kUnsignedLong);
+    EXPECT_EQ(conversions[1].mOffset, 6);
+    EXPECT_EQ(conversions[1].mLength, 6);
+    EXPECT_EQ(conversions[2].mArg, BinaryLog::Arg::kString);
+    EXPECT_EQ(conversions[2].mNumStars, 2);
+    EXPECT_EQ(conversions[2].mPrecision, BinaryLog::kPrecisionStar);
+    EXPECT_EQ(conversions[3].mPrecision, 4);
+    EXPECT_EQ(conversions[4].mArg, BinaryLog::Arg::kSize);
+    EXPECT_EQ(conversions[5].mArg, BinaryLog::Arg::kPointer);
+    EXPECT_EQ(conversions[6].mArg, BinaryLog::Arg::kLongDouble);
+
+    EXPECT_EQ(BinaryLog::ParseFormat("%ls", conversions), OTBR_ERROR_PARSE);
+    EXPECT_EQ(BinaryLog::ParseFormat("%y", conversions), OTBR_ERROR_PARSE);
+    EXPECT_EQ(BinaryLog::ParseFormat("%", conversions), OTBR_ERROR_PARSE);
+}
+
+TEST(BinaryLog, WriteAndRead)
+{
+    static const char kBytes[] = {'a', 'b', 'c', 'd', 'e', 'f'};
+    static const char kFormat[] = "%d %u %hhx %ld %llu %zu %5.2f %c %s|%.3s|%*.*s| 100%%";
+
+    BinaryLogWriter writer;
+    BinaryLogReader reader;
+    std::string     text;
+
+    ASSERT_EQ(writer.Open(kBinaryLogPath), OTBR_ERROR_NONE);
+    EXPECT_EQ(writer.Open(kBinaryLogPath), OTBR_ERROR_INVALID_STATE);
+
+    for (int i = 0; i < 2; i++)
+    {
+        WriteLog(writer, OTBR_LOG_INFO, "MDNS", kFormat, -1 - i, 4000000000U, 0x1ff, -2L, 1ULL << 40, sizeof(kBytes),
+                 3.14159, 'z', "str", kBytes, 4, 2, "xyz");
+    }
+    WriteLog(writer, OTBR_LOG_WARNING, nullptr, "no prefix %s", "here");
+    WriteLog(writer, OTBR_LOG_DEBUG, "A-LONG-TAG", "unsupported %ls", L"wide");
+    EXPECT_TRUE(writer.Dump(OTBR_LOG_NOTICE, "DUMP", "bytes", "0123456789abcdefXYZ", 19));
+    writer.Close();
+
+    EXPECT_FALSE(writer.Dump(OTBR_LOG_NOTICE, "DUMP", "bytes", "0123", 4));
+
+    ASSERT_EQ(reader.Open(kBinaryLogPath), OTBR_ERROR_NONE);
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(ReadNext(reader), "[INFO]-MDNS----: " + Format(kFormat, -1 - i, 4000000000U, 0x1ff, -2L, 1ULL << 40,
+                                                                 sizeof(kBytes), 3.14159, 'z', "str", kBytes, 4, 2,
+                                                                 "xyz"));
+    }
+    EXPECT_EQ(ReadNext(reader), "no prefix here");
+    EXPECT_EQ(ReadNext(reader), "[DEBG]-A-LONG--: " + Format("unsupported %ls", L"wide"));
+
+    text = ReadNext(reader);
+    ASSERT_NE(text.find('\n'), std::string::npos);
+    EXPECT_EQ(text.substr(0, text.find('\n')),
+              "[NOTE]-DUMP----: bytes: 0000: 30 31 32 33 34 35 36 37 38 39 61 62 63 64 65 66");
+    EXPECT_EQ(text.substr(text.find(' ', text.find('\n')) + 1), "[NOTE]-DUMP----: bytes: 0010: 58 59 5a");
+
+    EXPECT_EQ(reader.ReadNext(text), OTBR_ERROR_NOT_FOUND);
+    reader.Close();
+
+    unlink(kBinaryLogPath);
+}
+
+TEST(BinaryLog, FormatTableFull)
+{
+    static constexpr size_t kMaxFormats = 4096;
+
+    // The formats are identified by their addresses.
+    static char sFormats[kMaxFormats + 1][16];
+
+    BinaryLogWriter writer;
+    BinaryLogReader reader;
+    std::string     text;
+
+    ASSERT_EQ(writer.Open(kBinaryLogPath), OTBR_ERROR_NONE);
+    for (size_t i = 0; i < kMaxFormats; i++)
+    {
+        snprintf(sFormats[i], sizeof(sFormats[i]), "format %zu", i);
+        WriteLog(writer, OTBR_LOG_INFO, "TEST", sFormats[i]);
+    }
+    EXPECT_EQ(writer.GetDroppedMessageCount(), 0U);
+
+    // The messages of new formats are left to the text logger.
+    snprintf(sFormats[kMaxFormats], sizeof(sFormats[kMaxFormats]), "full %%d");
+    EXPECT_FALSE(TryWriteLog(writer, OTBR_LOG_INFO, "TEST", sFormats[kMaxFormats], 1));
+    EXPECT_FALSE(writer.Dump(OTBR_LOG_NOTICE, "DUMP", "bytes", "0123", 4));
+    EXPECT_EQ(writer.GetDroppedMessageCount(), 2U);
+
+    WriteLog(writer, OTBR_LOG_INFO, "TEST", sFormats[0]);
+    writer.Close();
+
+    ASSERT_EQ(reader.Open(kBinaryLogPath), OTBR_ERROR_NONE);
+    for (size_t i = 0; i < kMaxFormats; i++)
+    {
+        ASSERT_EQ(ReadNext(reader), "[INFO]-TEST----: " + Format("format %zu", i));
+    }
+    EXPECT_EQ(ReadNext(reader), "[INFO]-TEST----: format 0");
+    EXPECT_EQ(reader.ReadNext(text), OTBR_ERROR_NOT_FOUND);
+    reader.Close();
+
+    unlink(kBinaryLogPath);
+}
+
+TEST(BinaryLog, ReadTruncated)
+{
+    BinaryLogWriter writer;
+    BinaryLogReader reader;
+    std::string     text;
+    long            size;
+
+    ASSERT_EQ(writer.Open(kBinaryLogPath), OTBR_ERROR_NONE);
+    WriteLog(writer, OTBR_LOG_INFO, "TEST", "%s", "a message");
+    writer.Close();
+
+    {
+        FILE *file = fopen(kBinaryLogPath, "r+");
+
+        ASSERT_NE(file, nullptr);
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fclose(file);
+        ASSERT_EQ(truncate(kBinaryLogPath, size - 1), 0);
+    }
+
+    ASSERT_EQ(reader.Open(kBinaryLogPath), OTBR_ERROR_NONE);
+    EXPECT_EQ(reader.ReadNext(text), OTBR_ERROR_PARSE);
+    reader.Close();
+
+    ASSERT_EQ(truncate(kBinaryLogPath, 4), 0);
+    EXPECT_EQ(reader.Open(kBinaryLogPath), OTBR_ERROR_PARSE);
+
+    unlink(kBinaryLogPath);
+}
@@ -0,0 +1,110 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "utils/channel_quality_history.hpp"
+
+using otbr::agent::ChannelQualityHistory;
+
+static constexpr uint32_t kAllChannels = 0x07fff800;
+
+static void AddUniformSample(ChannelQualityHistory &aHistory, uint16_t aOccupancy)
+{
+    uint16_t occupancies[ChannelQualityHistory::kNumChannels];
+
+    for (uint16_t &occupancy : occupancies)
+    {
+        occupancy = aOccupancy;
+    }
+    aHistory.AddSample(occupancies);
+}
+
+TEST(ChannelQualityHistory, EmptyHistoryHasNoRecommendation)
+{
+    ChannelQualityHistory history;
+
+    EXPECT_EQ(history.GetSampleCount(), 0);
+    EXPECT_EQ(history.GetAverageOccupancy(11), 0);
+    EXPECT_EQ(history.GetOccupancyDeviation(11), 0);
+    EXPECT_EQ(history.GetRecommendedChannel(kAllChannels), 0);
+}
+
+TEST(ChannelQualityHistory, AverageAndDeviation)
+{
+    ChannelQualityHistory history;
+
+    AddUniformSample(history, 1000);
+    AddUniformSample(history, 3000);
+
+    EXPECT_EQ(history.GetSampleCount(), 2);
+    EXPECT_EQ(history.GetAverageOccupancy(15), 2000);
+    EXPECT_EQ(history.GetOccupancyDeviation(15), 1000);
+    EXPECT_EQ(history.GetAverageOccupancy(10), 0);
+    EXPECT_EQ(history.GetAverageOccupancy(27), 0);
+}
+
+TEST(ChannelQualityHistory, OldestSamplesAreOverwritten)
+{
+    ChannelQualityHistory history;
+
+    AddUniformSample(history, 0xffff);
+    for (uint16_t i = 0; i < ChannelQualityHistory::kMaxSamples; i++)
+    {
+        AddUniformSample(history, 500);
+    }
+
+    EXPECT_EQ(history.GetSampleCount(), ChannelQualityHistory::kMaxSamples);
+    EXPECT_EQ(history.GetAverageOccupancy(20), 500);
+    EXPECT_EQ(history.GetOccupancyDeviation(20), 0);
+}
+
+TEST(ChannelQualityHistory, RecommendsTheSteadilyQuietChannel)
+{
+    ChannelQualityHistory history;
+
+    for (uint16_t i = 0; i < 10; i++)
+    {
+        uint16_t occupancies[ChannelQualityHistory::kNumChannels];
+
+        for (uint16_t &occupancy : occupancies)
+        {
+            occupancy = 20000;
+        }
+        // Channel 15 is idle but has bursts of traffic, channel 20 is steadily a little busy.
+        occupancies[15 - ChannelQualityHistory::kFirstChannel] = (i % 5 == 0) ? 30000 : 0;
+        occupancies[20 - ChannelQualityHistory::kFirstChannel] = 7000;
+        history.AddSample(occupancies);
+    }
+
+    EXPECT_EQ(history.GetAverageOccupancy(15), 6000);
+    EXPECT_EQ(history.GetRecommendedChannel(kAllChannels), 20);
+    EXPECT_EQ(history.GetRecommendedChannel(kAllChannels & ~(1U << 20)), 15);
+    EXPECT_EQ(history.GetRecommendedChannel(1U << 11), 11);
+    EXPECT_EQ(history.GetRecommendedChannel(0), 0);
+}
@@ -28,11 +28,47 @@
 
 #include <gtest/gtest.h>
 
+#include <unordered_set>
+
 #include "common/types.hpp"
 
 //-------------------------------------------------------------
 // Test for Ip6Address
-// TODO: Add Ip6Address tests
+
+TEST(Ip6Address, ToStringBuffer)
+{
+    using otbr::Ip6Address;
+
+    char buffer[Ip6Address::kStringSize];
+    char smallBuffer[8];
+
+    EXPECT_STREQ(Ip6Address("2001:db8::1").ToString(buffer, sizeof(buffer)), "2001:db8::1");
+    EXPECT_STREQ(Ip6Address("ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255").ToString(buffer, sizeof(buffer)),
+                 "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+    EXPECT_STREQ(Ip6Address("2001:db8::1").ToString(smallBuffer, sizeof(smallBuffer)), "");
+}
+
+TEST(Ip6Address, PrefixMatchLength)
+{
+    using otbr::Ip6Address;
+
+    EXPECT_EQ(Ip6Address("2001:db8::1").GetPrefixMatchLength(Ip6Address("2001:db8::1")), 128);
+    EXPECT_EQ(Ip6Address("2001:db8::1").GetPrefixMatchLength(Ip6Address("2001:db8::")), 127);
+    EXPECT_EQ(Ip6Address("2001:db8::").GetPrefixMatchLength(Ip6Address("2001:db8:0:0:8000::")), 64);
+    EXPECT_EQ(Ip6Address("2001:db8::").GetPrefixMatchLength(Ip6Address("2001:db8:0:1::")), 63);
+    EXPECT_EQ(Ip6Address("fc00::").GetPrefixMatchLength(Ip6Address("fd00::")), 7);
+    EXPECT_EQ(Ip6Address("::").GetPrefixMatchLength(Ip6Address("8000::")), 0);
+}
+
+TEST(Ip6Address, StdHash)
+{
+    using otbr::Ip6Address;
+
+    std::unordered_set<Ip6Address> addresses{Ip6Address("2001:db8::1"), Ip6Address("2001:db8::2")};
+
+    EXPECT_EQ(addresses.count(Ip6Address("2001:db8::1")), 1u);
+    EXPECT_EQ(addresses.count(Ip6Address("2001:db8::3")), 0u);
+}
 
 //-------------------------------------------------------------
 // Test for Ip6Prefix
@@ -96,8 +132,111 @@ TEST(Ip6Prefix, EqualityOperator)
     EXPECT_NE(Ip6Prefix("2001:db8:0:1::", 63), Ip6Prefix("2001:db8::", 64));
 }
 
-// TODO: add more test cases for otbr::Ip6Prefix
+TEST(Ip6Prefix, ContainsAddress)
+{
+    using otbr::Ip6Address;
+    using otbr::Ip6Prefix;
+
+    EXPECT_TRUE(Ip6Prefix("::", 0).ContainsAddress(Ip6Address("2001:db8::1")));
+    EXPECT_TRUE(Ip6Prefix("fc00::", 7).ContainsAddress(Ip6Address("fd12:3456::1")));
+    EXPECT_FALSE(Ip6Prefix("fc00::", 7).ContainsAddress(Ip6Address("fe80::1")));
+    EXPECT_TRUE(Ip6Prefix("2001:db8::", 64).ContainsAddress(Ip6Address("2001:db8::abcd")));
+    EXPECT_FALSE(Ip6Prefix("2001:db8::", 64).ContainsAddress(Ip6Address("2001:db8:0:1::abcd")));
+    EXPECT_TRUE(Ip6Prefix("2001:db8::1", 128).ContainsAddress(Ip6Address("2001:db8::1")));
+    EXPECT_FALSE(Ip6Prefix("2001:db8::1", 128).ContainsAddress(Ip6Address("2001:db8::2")));
+}
+
+TEST(Ip6Prefix, ToStringBuffer)
+{
+    using otbr::Ip6Prefix;
+
+    char buffer[Ip6Prefix::kStringSize];
+    char smallBuffer[12];
+
+    EXPECT_STREQ(Ip6Prefix("2001:db8::", 64).ToString(buffer, sizeof(buffer)), "2001:db8::/64");
+    EXPECT_STREQ(Ip6Prefix("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", 128).ToString(buffer, sizeof(buffer)),
+                 "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128");
+    EXPECT_STREQ(Ip6Prefix("2001:db8::", 64).ToString(smallBuffer, sizeof(smallBuffer)), "");
+}
+
+TEST(Ip6Prefix, StdHash)
+{
+    using otbr::Ip6Prefix;
+
+    std::hash<Ip6Prefix> hash;
+
+    // Equal prefixes have equal hashes, whatever the bits after their length.
+    EXPECT_EQ(hash(Ip6Prefix("2001:db8::", 64)), hash(Ip6Prefix("2001:db8::1", 64)));
+    EXPECT_EQ(hash(Ip6Prefix("fc00::", 7)), hash(Ip6Prefix("fd00::", 7)));
+    EXPECT_EQ(hash(Ip6Prefix("::", 0)), hash(Ip6Prefix("2001::", 0)));
+    EXPECT_NE(hash(Ip6Prefix("2001:db8::", 64)), hash(Ip6Prefix("2001:db8::", 63)));
+
+    std::unordered_set<Ip6Prefix> prefixes{Ip6Prefix("2001:db8::", 64), Ip6Prefix("fc00::", 7)};
+
+    EXPECT_EQ(prefixes.count(Ip6Prefix("2001:db8::1", 64)), 1u);
+    EXPECT_EQ(prefixes.count(Ip6Prefix("2001:db8:0:1::", 64)), 0u);
+}
 
 //-------------------------------------------------------------
 // Test for MacAddress
-// TODO: Add MacAddress tests
+
+TEST(MacAddress, ToStringAndHash)
+{
+    using otbr::MacAddress;
+
+    MacAddress mac1;
+    MacAddress mac2;
+    char       buffer[MacAddress::kStringSize];
+
+    mac1.m8[0] = 0x02;
+    mac1.m8[5] = 0xab;
+    EXPECT_STREQ(mac1.ToString(buffer, sizeof(buffer)), "02:00:00:00:00:ab");
+    EXPECT_EQ(mac1.ToString(), "02:00:00:00:00:ab");
+
+    EXPECT_NE(mac1, mac2);
+    mac2 = mac1;
+    EXPECT_EQ(mac1, mac2);
+    EXPECT_EQ(std::hash<MacAddress>()(mac1), std::hash<MacAddress>()(mac2));
+}
+
+//-------------------------------------------------------------
+// Test for MdnsLatencyHistogram
+
+TEST(MdnsLatencyHistogram, TestPercentiles)
+{
+    otbr::MdnsLatencyHistogram histogram{};
+
+    EXPECT_EQ(histogram.GetPercentile(50), 0u);
+
+    for (uint32_t i = 0; i < 90; i++)
+    {
+        histogram.Record(5);
+    }
+    for (uint32_t i = 0; i < 9; i++)
+    {
+        histogram.Record(200);
+    }
+    histogram.Record(45000);
+
+    EXPECT_EQ(histogram.mBucketCounts[0], 90u);
+    EXPECT_EQ(histogram.mBucketCounts[4], 9u);
+    EXPECT_EQ(histogram.mBucketCounts[otbr::MdnsLatencyHistogram::kNumBuckets - 1], 1u);
+    EXPECT_EQ(histogram.mMaxLatency, 45000u);
+
+    EXPECT_EQ(histogram.GetPercentile(50), 10u);
+    EXPECT_EQ(histogram.GetPercentile(90), 10u);
+    EXPECT_EQ(histogram.GetPercentile(95), 250u);
+    EXPECT_EQ(histogram.GetPercentile(99), 250u);
+    EXPECT_EQ(histogram.GetPercentile(100), 45000u);
+}
+
+TEST(MdnsLatencyHistogram, TestPercentileBoundedByMaxLatency)
+{
+    otbr::MdnsLatencyHistogram histogram{};
+
+    histogram.Record(10);
+    histogram.Record(12);
+
+    EXPECT_EQ(histogram.mBucketCounts[1], 2u);
+    EXPECT_EQ(histogram.GetPercentile(50), 12u);
+}
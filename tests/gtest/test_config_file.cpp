@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "utils/config_file.hpp"
+
+using otbr::Utils::ConfigFile;
+
+TEST(ConfigFile, TestParseSettings)
+{
+    std::vector<ConfigFile::Entry> entries;
+
+    EXPECT_EQ(ConfigFile::Parse("# comment\n"
+                                "\n"
+                                "debug-level = 7\n"
+                                "  tag-debug-level=MDNS=6  \r\n"
+                                "vendor-name=\n"
+                                "debug-level=5",
+                                entries),
+              OTBR_ERROR_NONE);
+
+    ASSERT_EQ(entries.size(), 4u);
+    EXPECT_EQ(entries[0].mKey, "debug-level");
+    EXPECT_EQ(entries[0].mValue, "7");
+    EXPECT_EQ(entries[0].mLine, 3u);
+    EXPECT_EQ(entries[1].mKey, "tag-debug-level");
+    EXPECT_EQ(entries[1].mValue, "MDNS=6");
+    EXPECT_EQ(entries[2].mKey, "vendor-name");
+    EXPECT_EQ(entries[2].mValue, "");
+    EXPECT_EQ(entries[3].mKey, "debug-level");
+    EXPECT_EQ(entries[3].mValue, "5");
+    EXPECT_EQ(entries[3].mLine, 6u);
+}
+
+TEST(ConfigFile, TestParseMalformedSettings)
+{
+    std::vector<ConfigFile::Entry> entries;
+
+    EXPECT_EQ(ConfigFile::Parse("debug-level=7\nverbose\n", entries), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ConfigFile::Parse("=7\n", entries), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ConfigFile::Parse(" \t=7\n", entries), OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(ConfigFile, TestLoad)
+{
+    char                           path[] = "/tmp/test_config_file_XXXXXX";
+    int                            fd     = mkstemp(path);
+    std::vector<ConfigFile::Entry> entries;
+
+    ASSERT_NE(fd, -1);
+    close(fd);
+    std::ofstream(path) << "rest-listen-port=8082\n";
+
+    EXPECT_EQ(ConfigFile::Load(path, entries), OTBR_ERROR_NONE);
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].mKey, "rest-listen-port");
+    EXPECT_EQ(entries[0].mValue, "8082");
+
+    unlink(path);
+    EXPECT_EQ(ConfigFile::Load(path, entries), OTBR_ERROR_ERRNO);
+}
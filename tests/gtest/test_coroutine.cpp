@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <sys/select.h>
+
+#include <openthread/error.h>
+
+#include "common/callback.hpp"
+#include "common/coroutine.hpp"
+#include "common/types.hpp"
+#include "ncp/async_coroutine.hpp"
+
+using otbr::AwaitCallback;
+using otbr::Coroutine;
+using otbr::OnceCallback;
+using otbr::TaskRunner;
+using otbr::Ncp::AsyncTaskPtr;
+
+static void RunTaskRunnerOnce(TaskRunner &aTaskRunner)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+    aTaskRunner.Process(mainloop);
+}
+
+static Coroutine PostSteps(TaskRunner &aTaskRunner, std::string &aSteps)
+{
+    aSteps.push_back('a');
+    co_await otbr::ResumeOn(aTaskRunner);
+    aSteps.push_back('b');
+    co_await otbr::ResumeAfter(aTaskRunner, otbr::Milliseconds(10));
+    aSteps.push_back('c');
+}
+
+TEST(Coroutine, TestResumeOnTaskRunner)
+{
+    TaskRunner  taskRunner;
+    std::string steps;
+
+    PostSteps(taskRunner, steps);
+    EXPECT_EQ(steps, "a");
+
+    while (steps.size() < 3)
+    {
+        RunTaskRunnerOnce(taskRunner);
+    }
+
+    EXPECT_EQ(steps, "abc");
+}
+
+static Coroutine PublishTwice(OnceCallback<void(otbrError)> &aPending, otbrError &aLastError, int &aDone)
+{
+    aLastError = co_await AwaitCallback<otbrError>(
+        [&aPending](OnceCallback<void(otbrError)> aCallback) { aPending = std::move(aCallback); });
+    aLastError = co_await AwaitCallback<otbrError>(
+        [&aPending](OnceCallback<void(otbrError)> aCallback) { aPending = std::move(aCallback); });
+    aDone++;
+}
+
+TEST(Coroutine, TestAwaitOnceCallback)
+{
+    OnceCallback<void(otbrError)> pending(nullptr);
+    otbrError                     lastError = OTBR_ERROR_NONE;
+    int                           done      = 0;
+
+    PublishTwice(pending, lastError, done);
+    ASSERT_FALSE(pending.IsNull());
+
+    std::move(pending)(OTBR_ERROR_DUPLICATED);
+    EXPECT_EQ(lastError, OTBR_ERROR_DUPLICATED);
+    EXPECT_EQ(done, 0);
+    ASSERT_FALSE(pending.IsNull());
+
+    std::move(pending)(OTBR_ERROR_NONE);
+    EXPECT_EQ(lastError, OTBR_ERROR_NONE);
+    EXPECT_EQ(done, 1);
+}
+
+static Coroutine ReceiveSynchronously(otError &aError, std::string &aErrorInfo)
+{
+    std::tie(aError, aErrorInfo) = co_await AwaitCallback<otError, const std::string &>(
+        [](std::function<void(otError, const std::string &)> aReceiver) { aReceiver(OT_ERROR_BUSY, "busy"); });
+}
+
+TEST(Coroutine, TestAwaitCallbackInvokedSynchronously)
+{
+    otError     error = OT_ERROR_NONE;
+    std::string errorInfo;
+
+    ReceiveSynchronously(error, errorInfo);
+
+    EXPECT_EQ(error, OT_ERROR_BUSY);
+    EXPECT_EQ(errorInfo, "busy");
+}
+
+static Coroutine RunAsyncTask(AsyncTaskPtr &aPendingStep, otError &aError, int &aDone)
+{
+    auto [error, errorInfo] = co_await otbr::Ncp::AwaitAsyncTask([&aPendingStep](AsyncTaskPtr &aTask) {
+        aTask->First([](AsyncTaskPtr aNext) { aNext->SetResult(OT_ERROR_NONE, ""); })
+            ->Then([&aPendingStep](AsyncTaskPtr aNext) { aPendingStep = std::move(aNext); });
+    });
+
+    OTBR_UNUSED_VARIABLE(errorInfo);
+    aError = error;
+    aDone++;
+}
+
+TEST(Coroutine, TestAwaitAsyncTask)
+{
+    AsyncTaskPtr pendingStep;
+    otError      error = OT_ERROR_NONE;
+    int          done  = 0;
+
+    RunAsyncTask(pendingStep, error, done);
+    ASSERT_NE(pendingStep, nullptr);
+    EXPECT_EQ(done, 0);
+
+    pendingStep->SetResult(OT_ERROR_INVALID_STATE, "Invalid state");
+    pendingStep.reset();
+
+    EXPECT_EQ(error, OT_ERROR_INVALID_STATE);
+    EXPECT_EQ(done, 1);
+}
+
+TEST(Coroutine, TestFramesArePooled)
+{
+    TaskRunner  taskRunner;
+    std::string steps;
+    size_t      allocationCount;
+
+    // Warm up the frame pool.
+    PostSteps(taskRunner, steps);
+    while (steps.size() < 3)
+    {
+        RunTaskRunnerOnce(taskRunner);
+    }
+
+    allocationCount = Coroutine::GetFrameHeapAllocationCount();
+
+    for (int i = 0; i < 10; i++)
+    {
+        steps.clear();
+        PostSteps(taskRunner, steps);
+        while (steps.size() < 3)
+        {
+            RunTaskRunnerOnce(taskRunner);
+        }
+    }
+
+    EXPECT_EQ(allocationCount, Coroutine::GetFrameHeapAllocationCount());
+}
@@ -26,8 +26,12 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <gtest/gtest.h>
+#include <chrono>
+#include <stdio.h>
 #include <string.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
 
 #include "dbus/common/dbus_message_helper.hpp"
 
@@ -64,12 +68,15 @@ bool operator==(const TestStruct &aLhs, const TestStruct &aRhs)
     return aLhs.tag == aRhs.tag && aLhs.val == aRhs.val && aLhs.name == aRhs.name;
 }
 
-bool operator==(const otbr::DBus::ChannelQuality &aLhs, const otbr::DBus::ChannelQuality &aRhs)
+namespace otbr {
+namespace DBus {
+
+bool operator==(const ChannelQuality &aLhs, const ChannelQuality &aRhs)
 {
     return aLhs.mChannel == aRhs.mChannel && aLhs.mOccupancy == aRhs.mOccupancy;
 }
 
-bool operator==(const otbr::DBus::ChildInfo &aLhs, const otbr::DBus::ChildInfo &aRhs)
+bool operator==(const ChildInfo &aLhs, const ChildInfo &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mTimeout == aRhs.mTimeout && aLhs.mAge == aRhs.mAge &&
            aLhs.mRloc16 == aRhs.mRloc16 && aLhs.mChildId == aRhs.mChildId &&
@@ -80,7 +87,7 @@ bool operator==(const otbr::DBus::ChildInfo &aLhs, const otbr::DBus::ChildInfo &
            aLhs.mFullNetworkData == aRhs.mFullNetworkData && aLhs.mIsStateRestoring == aRhs.mIsStateRestoring;
 }
 
-bool operator==(const otbr::DBus::NeighborInfo &aLhs, const otbr::DBus::NeighborInfo &aRhs)
+bool operator==(const NeighborInfo &aLhs, const NeighborInfo &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mAge == aRhs.mAge && aLhs.mRloc16 == aRhs.mRloc16 &&
            aLhs.mLinkFrameCounter == aRhs.mLinkFrameCounter && aLhs.mMleFrameCounter == aRhs.mMleFrameCounter &&
@@ -91,14 +98,14 @@ bool operator==(const otbr::DBus::NeighborInfo &aLhs, const otbr::DBus::Neighbor
            aLhs.mIsChild == aRhs.mIsChild;
 }
 
-bool operator==(const otbr::DBus::LeaderData &aLhs, const otbr::DBus::LeaderData &aRhs)
+bool operator==(const LeaderData &aLhs, const LeaderData &aRhs)
 {
     return aLhs.mPartitionId == aRhs.mPartitionId && aLhs.mWeighting == aRhs.mWeighting &&
            aLhs.mDataVersion == aRhs.mDataVersion && aLhs.mStableDataVersion == aRhs.mStableDataVersion &&
            aLhs.mLeaderRouterId == aRhs.mLeaderRouterId;
 }
 
-bool operator==(const otbr::DBus::ActiveScanResult &aLhs, const otbr::DBus::ActiveScanResult &aRhs)
+bool operator==(const ActiveScanResult &aLhs, const ActiveScanResult &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mNetworkName == aRhs.mNetworkName &&
            aLhs.mExtendedPanId == aRhs.mExtendedPanId && aLhs.mSteeringData == aRhs.mSteeringData &&
@@ -107,7 +114,7 @@ bool operator==(const otbr::DBus::ActiveScanResult &aLhs, const otbr::DBus::Acti
            aLhs.mIsNative == aRhs.mIsNative;
 }
 
-bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6Prefix &aRhs)
+bool operator==(const Ip6Prefix &aLhs, const Ip6Prefix &aRhs)
 {
     bool prefixDataEquality = (aLhs.mPrefix.size() == aRhs.mPrefix.size()) &&
                               (memcmp(&aLhs.mPrefix[0], &aRhs.mPrefix[0], aLhs.mPrefix.size()) == 0);
@@ -115,12 +122,31 @@ bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6Prefix &
     return prefixDataEquality && aLhs.mLength == aRhs.mLength;
 }
 
-bool operator==(const otbr::DBus::ExternalRoute &aLhs, const otbr::DBus::ExternalRoute &aRhs)
+bool operator==(const ExternalRoute &aLhs, const ExternalRoute &aRhs)
 {
     return aLhs.mPrefix == aRhs.mPrefix && aLhs.mRloc16 == aRhs.mRloc16 && aLhs.mPreference == aRhs.mPreference &&
            aLhs.mStable == aRhs.mStable && aLhs.mNextHopIsThisDevice == aRhs.mNextHopIsThisDevice;
 }
 
+bool operator==(const SrpServerService &aLhs, const SrpServerService &aRhs)
+{
+    return aLhs.mFullName == aRhs.mFullName && aLhs.mDeleted == aRhs.mDeleted && aLhs.mPort == aRhs.mPort &&
+           aLhs.mPriority == aRhs.mPriority && aLhs.mWeight == aRhs.mWeight && aLhs.mLease == aRhs.mLease &&
+           aLhs.mKeyLease == aRhs.mKeyLease && aLhs.mRemainingLease == aRhs.mRemainingLease &&
+           aLhs.mRemainingKeyLease == aRhs.mRemainingKeyLease;
+}
+
+bool operator==(const SrpServerHost &aLhs, const SrpServerHost &aRhs)
+{
+    return aLhs.mFullName == aRhs.mFullName && aLhs.mDeleted == aRhs.mDeleted && aLhs.mAddresses == aRhs.mAddresses &&
+           aLhs.mLease == aRhs.mLease && aLhs.mKeyLease == aRhs.mKeyLease &&
+           aLhs.mRemainingLease == aRhs.mRemainingLease && aLhs.mRemainingKeyLease == aRhs.mRemainingKeyLease &&
+           aLhs.mServices == aRhs.mServices;
+}
+
+} // namespace DBus
+} // namespace otbr
+
 inline otbrError DBusMessageEncode(DBusMessageIter *aIter, const TestStruct &aValue)
 {
     otbrError       error = OTBR_ERROR_DBUS;
@@ -155,8 +181,6 @@ exit:
     return error;
 }
 
-TEST_GROUP(DBusMessage){};
-
 TEST(DBusMessage, TestVectorMessage)
 {
     DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -213,6 +237,35 @@ TEST(DBusMessage, TestNumberMessage)
     dbus_message_unref(msg);
 }
 
+TEST(DBusMessage, TestUnixFdMessage)
+{
+    DBusMessage              *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    int                       fds[2];
+    tuple<otbr::DBus::UnixFd> setVals;
+    tuple<otbr::DBus::UnixFd> getVals;
+    char                      buf[sizeof("test")];
+
+    EXPECT_NE(msg, nullptr);
+    ASSERT_EQ(pipe(fds), 0);
+
+    std::get<0>(setVals).mFd = fds[0];
+    std::get<0>(getVals).mFd = -1;
+    EXPECT_EQ(TupleToDBusMessage(*msg, setVals), OTBR_ERROR_NONE);
+    EXPECT_EQ(DBusMessageToTuple(*msg, getVals), OTBR_ERROR_NONE);
+
+    // The extracted descriptor is a duplicate of the encoded one.
+    EXPECT_NE(std::get<0>(getVals).mFd, -1);
+    EXPECT_NE(std::get<0>(getVals).mFd, fds[0]);
+    EXPECT_EQ(write(fds[1], "test", sizeof("test")), static_cast<ssize_t>(sizeof("test")));
+    EXPECT_EQ(read(std::get<0>(getVals).mFd, buf, sizeof(buf)), static_cast<ssize_t>(sizeof("test")));
+    EXPECT_STREQ(buf, "test");
+
+    close(std::get<0>(getVals).mFd);
+    close(fds[0]);
+    close(fds[1]);
+    dbus_message_unref(msg);
+}
+
 TEST(DBusMessage, TestStructMessage)
 {
     DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -328,3 +381,134 @@ TEST(DBusMessage, TestOtbrExternalRoute)
 
     dbus_message_unref(msg);
 }
+
+TEST(DBusMessage, TestOtbrSrpServerHosts)
+{
+    DBusMessage                                               *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    otbr::DBus::SrpServerHost                                  host{};
+    otbr::DBus::SrpServerService                               service{};
+    tuple<std::vector<otbr::DBus::SrpServerHost>, std::string> setVals;
+    tuple<std::vector<otbr::DBus::SrpServerHost>, std::string> getVals;
+
+    service.mFullName          = "printer._ipp._tcp.default.service.arpa.";
+    service.mPort              = 631;
+    service.mPriority          = 1;
+    service.mWeight            = 2;
+    service.mLease             = 7200000;
+    service.mKeyLease          = 1209600000;
+    service.mRemainingLease    = 7100000;
+    service.mRemainingKeyLease = 1209500000;
+
+    host.mFullName          = "host.default.service.arpa.";
+    host.mAddresses         = {{0xfd, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0, 0, 0, 0, 0, 0, 0, 0x01}};
+    host.mLease             = 7200000;
+    host.mKeyLease          = 1209600000;
+    host.mRemainingLease    = 7100000;
+    host.mRemainingKeyLease = 1209500000;
+    host.mServices          = {service, service};
+
+    host.mServices[1].mDeleted = true;
+
+    std::get<0>(setVals) = {host, otbr::DBus::SrpServerHost{}};
+    std::get<1>(setVals) = host.mFullName;
+
+    EXPECT_NE(msg, nullptr);
+
+    EXPECT_EQ(TupleToDBusMessage(*msg, setVals), OTBR_ERROR_NONE);
+    EXPECT_EQ(DBusMessageToTuple(*msg, getVals), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(std::get<0>(getVals).size(), 2u);
+    EXPECT_EQ(std::get<0>(setVals)[0], std::get<0>(getVals)[0]);
+    EXPECT_EQ(std::get<0>(setVals)[1], std::get<0>(getVals)[1]);
+    EXPECT_EQ(std::get<1>(setVals), std::get<1>(getVals));
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestInt8VectorMessage)
+{
+    DBusMessage          *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<vector<int8_t>> setVals({-128, -1, 0, 127});
+    tuple<vector<int8_t>> getVals;
+
+    EXPECT_NE(msg, nullptr);
+
+    EXPECT_EQ(TupleToDBusMessage(*msg, setVals), OTBR_ERROR_NONE);
+    EXPECT_EQ(DBusMessageToTuple(*msg, getVals), OTBR_ERROR_NONE);
+
+    EXPECT_EQ(setVals, getVals);
+
+    dbus_message_unref(msg);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+long long ElapsedUs(Clock::time_point aStart)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - aStart).count();
+}
+
+template <typename T> long long EncodeUs(const T &aValue, int aRepeat)
+{
+    Clock::time_point start = Clock::now();
+
+    for (int i = 0; i < aRepeat; i++)
+    {
+        DBusMessage    *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        DBusMessageIter iter;
+
+        dbus_message_iter_init_append(msg, &iter);
+        EXPECT_EQ(DBusMessageEncode(&iter, aValue), OTBR_ERROR_NONE);
+        dbus_message_unref(msg);
+    }
+
+    return ElapsedUs(start);
+}
+
+long long EncodeBytesOneByOneUs(const vector<uint8_t> &aValue, int aRepeat)
+{
+    Clock::time_point start = Clock::now();
+
+    for (int i = 0; i < aRepeat; i++)
+    {
+        DBusMessage    *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        DBusMessageIter iter, subIter;
+
+        dbus_message_iter_init_append(msg, &iter);
+        EXPECT_TRUE(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, DBUS_TYPE_BYTE_AS_STRING, &subIter));
+        for (uint8_t byte : aValue)
+        {
+            EXPECT_TRUE(dbus_message_iter_append_basic(&subIter, DBUS_TYPE_BYTE, &byte));
+        }
+        EXPECT_TRUE(dbus_message_iter_close_container(&iter, &subIter));
+        dbus_message_unref(msg);
+    }
+
+    return ElapsedUs(start);
+}
+
+} // namespace
+
+TEST(DBusMessageBenchmark, TestEncodeTables)
+{
+    static constexpr int    kRepeat    = 100;
+    static constexpr size_t kTableSize = 511;
+    static constexpr size_t kBlobSize  = 65536;
+
+    vector<otbr::DBus::ChildInfo>    childTable;
+    vector<otbr::DBus::NeighborInfo> neighborTable;
+    vector<uint8_t>                  blob(kBlobSize, 0xa5);
+
+    for (size_t i = 0; i < kTableSize; i++)
+    {
+        childTable.push_back({i, 240, 3, 0x6801, 1, 2, 3, -40, -42, 0, 0, true, false, true, false});
+        neighborTable.push_back({i, 3, 0x6800, 100, 200, 3, -40, -42, 0, 0, 4, true, true, true, false});
+    }
+
+    printf("DBusMessage encode(x%d) child-table=%zu %8lldus neighbor-table=%zu %8lldus\n", kRepeat, kTableSize,
+           EncodeUs(childTable, kRepeat), kTableSize, EncodeUs(neighborTable, kRepeat));
+    printf("DBusMessage encode(x%d) bytes=%zu fixed-array=%8lldus one-by-one=%8lldus\n", kRepeat, kBlobSize,
+           EncodeUs(blob, kRepeat), EncodeBytesOneByOneUs(blob, kRepeat));
+}
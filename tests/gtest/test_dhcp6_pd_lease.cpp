@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "common/types.hpp"
+#include "utils/dhcp6_pd_lease.hpp"
+#include "utils/snapshot.hpp"
+
+using otbr::Ip6Prefix;
+using otbr::Seconds;
+using otbr::agent::Dhcp6PdLease;
+using otbr::Utils::SnapshotReader;
+using otbr::Utils::SnapshotWriter;
+
+TEST(Dhcp6PdLease, TestLifetimes)
+{
+    Dhcp6PdLease lease;
+
+    EXPECT_TRUE(lease.IsEmpty());
+    EXPECT_EQ(lease.GetValidLifetime(1000), 0u);
+
+    lease.Set(Ip6Prefix("2001:db8:1:2::", 64), 3600, 1800, 1000);
+    EXPECT_FALSE(lease.IsEmpty());
+    EXPECT_EQ(lease.GetPrefix(), Ip6Prefix("2001:db8:1:2::", 64));
+
+    // The lifetimes keep running from the update time.
+    EXPECT_EQ(lease.GetValidLifetime(1000), 3600u);
+    EXPECT_EQ(lease.GetPreferredLifetime(1000), 1800u);
+    EXPECT_EQ(lease.GetValidLifetime(2000), 2600u);
+    EXPECT_EQ(lease.GetPreferredLifetime(2000), 800u);
+    EXPECT_EQ(lease.GetPreferredLifetime(2800), 0u);
+    EXPECT_EQ(lease.GetValidLifetime(4600), 0u);
+    EXPECT_EQ(lease.GetValidLifetime(10000), 0u);
+
+    lease.Set(Ip6Prefix("2001:db8:1:2::", 64), Dhcp6PdLease::kInfiniteLifetime, 1800, 1000);
+    EXPECT_EQ(lease.GetValidLifetime(UINT32_MAX), Dhcp6PdLease::kInfiniteLifetime);
+    EXPECT_EQ(lease.GetPreferredLifetime(1000), 1800u);
+
+    lease.Clear();
+    EXPECT_TRUE(lease.IsEmpty());
+}
+
+TEST(Dhcp6PdLease, TestMatches)
+{
+    Dhcp6PdLease lease;
+    Dhcp6PdLease other;
+
+    lease.Set(Ip6Prefix("2001:db8:1:2::", 64), 3600, 1800, 1000);
+
+    // The update times are only known to the second.
+    other.Set(Ip6Prefix("2001:db8:1:2::", 64), 3600, 1800, 1002);
+    EXPECT_TRUE(lease.Matches(other));
+
+    // A renewal.
+    other.Set(Ip6Prefix("2001:db8:1:2::", 64), 3600, 1800, 2000);
+    EXPECT_FALSE(lease.Matches(other));
+
+    other.Set(Ip6Prefix("2001:db8:1:3::", 64), 3600, 1800, 1000);
+    EXPECT_FALSE(lease.Matches(other));
+
+    other.Set(Ip6Prefix("2001:db8:1:2::", 63), 3600, 1800, 1000);
+    EXPECT_FALSE(lease.Matches(other));
+
+    other.Clear();
+    EXPECT_FALSE(lease.Matches(other));
+}
+
+TEST(Dhcp6PdLease, TestSaveAndRestore)
+{
+    char           path[] = "/tmp/otbr-pd-lease-XXXXXX";
+    int            fd     = mkstemp(path);
+    Dhcp6PdLease   lease;
+    Dhcp6PdLease   restored;
+    SnapshotWriter writer;
+    SnapshotReader reader;
+
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    lease.Set(Ip6Prefix("2001:db8:1:2::", 64), Dhcp6PdLease::kInfiniteLifetime, 1800, 1000);
+    lease.Save(writer);
+    ASSERT_EQ(writer.Save(path), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(reader.Load(path, Seconds(60)), OTBR_ERROR_NONE);
+    EXPECT_TRUE(restored.Restore(reader));
+    EXPECT_TRUE(restored.Matches(lease));
+    EXPECT_EQ(restored.GetValidLifetime(1000), Dhcp6PdLease::kInfiniteLifetime);
+    EXPECT_EQ(restored.GetPreferredLifetime(1000), 1800u);
+
+    // An empty lease isn't saved.
+    {
+        SnapshotWriter emptyWriter;
+        SnapshotReader emptyReader;
+
+        lease.Clear();
+        lease.Save(emptyWriter);
+        ASSERT_EQ(emptyWriter.Save(path), OTBR_ERROR_NONE);
+        ASSERT_EQ(emptyReader.Load(path, Seconds(60)), OTBR_ERROR_NONE);
+        EXPECT_FALSE(restored.Restore(emptyReader));
+        EXPECT_TRUE(restored.IsEmpty());
+    }
+
+    unlink(path);
+}
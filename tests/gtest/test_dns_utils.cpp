@@ -28,9 +28,13 @@
 
 #include "common/dns_utils.hpp"
 
+#include <chrono>
+
 #include <assert.h>
 #include <gtest/gtest.h>
 
+#include "utils/dns_utils.hpp"
+
 static void CheckSplitFullDnsName(const std::string &aFullName,
                                   bool               aIsServiceInstance,
                                   bool               aIsService,
@@ -63,6 +67,25 @@ static void CheckSplitFullDnsName(const std::string &aFullName,
     EXPECT_EQ(aServiceName, info.mServiceName);
     EXPECT_EQ(aHostName, info.mHostName);
     EXPECT_EQ(aDomain, info.mDomain);
+
+    for (const std::string &fullName : {aFullName, aFullName + "."})
+    {
+        DnsNameSpans spans  = SplitFullDnsName(fullName.data(), fullName.size());
+        std::string  domain = spans.mDomain.ToString();
+
+        EXPECT_EQ(aIsServiceInstance, spans.IsServiceInstance());
+        EXPECT_EQ(aIsService, spans.IsService());
+        EXPECT_EQ(aIsHost, spans.IsHost());
+        EXPECT_EQ(aInstanceName, spans.mInstanceName.ToString());
+        EXPECT_EQ(aServiceName, spans.mServiceName.ToString());
+        EXPECT_EQ(aHostName, spans.mHostName.ToString());
+
+        // The domain span excludes the trailing dot which the name lacks, the root domain is empty.
+        EXPECT_EQ(fullName == aFullName || aDomain == ".", domain.empty() || domain.back() != '.');
+        EXPECT_EQ(aDomain, domain.empty() || domain.back() != '.' ? domain + "." : domain);
+        EXPECT_GE(spans.mDomain.mData, fullName.data());
+        EXPECT_LE(spans.mDomain.mData + spans.mDomain.mLength, fullName.data() + fullName.size());
+    }
 }
 
 TEST(DnsUtils, TestSplitFullDnsName)
@@ -92,3 +115,284 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestUnescapeInstanceName)
+{
+    using otbr::DnsUtils::UnescapeInstanceName;
+
+    EXPECT_EQ(UnescapeInstanceName(""), "");
+    EXPECT_EQ(UnescapeInstanceName("Instance Name"), "Instance Name");
+    EXPECT_EQ(UnescapeInstanceName("Instance\\.Name"), "Instance.Name");
+    EXPECT_EQ(UnescapeInstanceName("Instance\\032Name\\."), "Instance Name.");
+    EXPECT_EQ(UnescapeInstanceName("\\\\Instance\\\\Name"), "\\Instance\\Name");
+    EXPECT_EQ(UnescapeInstanceName("Instance Name\\"), "Instance Name\\");
+}
+
+namespace {
+
+class DnsMessageBuilder
+{
+public:
+    DnsMessageBuilder(uint16_t aId, uint16_t aFlags, uint16_t aQuestions, uint16_t aAnswers, uint16_t aAuthorities)
+    {
+        AppendUint16(aId);
+        AppendUint16(aFlags);
+        AppendUint16(aQuestions);
+        AppendUint16(aAnswers);
+        AppendUint16(aAuthorities);
+        AppendUint16(0);
+    }
+
+    DnsMessageBuilder &AppendName(const std::string &aName)
+    {
+        size_t start = 0;
+
+        while (start < aName.size())
+        {
+            size_t end = aName.find('.', start);
+
+            end = (end == std::string::npos) ? aName.size() : end;
+            mMessage.push_back(static_cast<uint8_t>(end - start));
+            mMessage.insert(mMessage.end(), aName.begin() + start, aName.begin() + end);
+            start = end + 1;
+        }
+        mMessage.push_back(0);
+
+        return *this;
+    }
+
+    DnsMessageBuilder &AppendQuestion(const std::string &aName, uint16_t aType)
+    {
+        AppendName(aName).AppendUint16(aType).AppendUint16(1);
+
+        return *this;
+    }
+
+    // Appends a record whose name is compressed to the question name.
+    DnsMessageBuilder &AppendRecord(uint16_t aType, uint32_t aTtl, const std::vector<uint8_t> &aRdata)
+    {
+        AppendUint16(0xc000 | 12).AppendUint16(aType).AppendUint16(1).AppendUint32(aTtl);
+        AppendUint16(static_cast<uint16_t>(aRdata.size()));
+        mMessage.insert(mMessage.end(), aRdata.begin(), aRdata.end());
+
+        return *this;
+    }
+
+    DnsMessageBuilder &AppendUint16(uint16_t aValue)
+    {
+        mMessage.push_back(static_cast<uint8_t>(aValue >> 8));
+        mMessage.push_back(static_cast<uint8_t>(aValue));
+
+        return *this;
+    }
+
+    DnsMessageBuilder &AppendUint32(uint32_t aValue)
+    {
+        AppendUint16(static_cast<uint16_t>(aValue >> 16)).AppendUint16(static_cast<uint16_t>(aValue));
+
+        return *this;
+    }
+
+    void SetAdditionalCount(uint16_t aCount)
+    {
+        mMessage[10] = static_cast<uint8_t>(aCount >> 8);
+        mMessage[11] = static_cast<uint8_t>(aCount);
+    }
+
+    std::vector<uint8_t> &Get(void) { return mMessage; }
+
+private:
+    std::vector<uint8_t> mMessage;
+};
+
+std::string GetQueryKey(std::vector<uint8_t> aMessage)
+{
+    std::string key;
+
+    EXPECT_EQ(GetDnsQueryKey(aMessage.data(), static_cast<uint16_t>(aMessage.size()), key), OTBR_ERROR_NONE);
+
+    return key;
+}
+
+std::vector<uint8_t> MakeQuery(uint16_t aId, uint16_t aFlags, const std::string &aName, uint16_t aType)
+{
+    return DnsMessageBuilder(aId, aFlags, 1, 0, 0).AppendQuestion(aName, aType).Get();
+}
+
+uint32_t ReadTtl(const std::vector<uint8_t> &aMessage, size_t aRecordOffset)
+{
+    size_t offset = aRecordOffset + 6;
+
+    return (static_cast<uint32_t>(aMessage[offset]) << 24) | (static_cast<uint32_t>(aMessage[offset + 1]) << 16) |
+           (static_cast<uint32_t>(aMessage[offset + 2]) << 8) | aMessage[offset + 3];
+}
+
+} // namespace
+
+TEST(DnsUtils, TestGetDnsQueryKey)
+{
+    static constexpr uint16_t kFlagsRecursion = 0x0100;
+    static constexpr uint16_t kTypeA          = 1;
+    static constexpr uint16_t kTypeAaaa       = 28;
+    static constexpr uint16_t kTypeHttps      = 65;
+
+    std::string          key;
+    std::vector<uint8_t> message;
+
+    // The message ID and the case of the name do not matter.
+    EXPECT_EQ(GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "Example.COM", kTypeA)),
+              GetQueryKey(MakeQuery(0x9999, kFlagsRecursion, "example.com", kTypeA)));
+
+    // The question type and the recursion flag do.
+    EXPECT_NE(GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeA)),
+              GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeAaaa)));
+    EXPECT_NE(GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeA)),
+              GetQueryKey(MakeQuery(0x1234, 0, "example.com", kTypeA)));
+
+    // Only the name is case-insensitive, the type 65 (0x0041) is not the type 97 (0x0061).
+    EXPECT_NE(GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeHttps)),
+              GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeHttps + 32)));
+
+    // A response shares the key of its query.
+    EXPECT_EQ(GetQueryKey(MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeA)),
+              GetQueryKey(DnsMessageBuilder(0x1234, 0x8080 | kFlagsRecursion, 1, 1, 0)
+                              .AppendQuestion("example.com", kTypeA)
+                              .AppendRecord(kTypeA, 300, {192, 0, 2, 1})
+                              .Get()));
+
+    message = DnsMessageBuilder(0x1234, kFlagsRecursion, 2, 0, 0)
+                  .AppendQuestion("example.com", kTypeA)
+                  .AppendQuestion("example.org", kTypeA)
+                  .Get();
+    EXPECT_EQ(GetDnsQueryKey(message.data(), static_cast<uint16_t>(message.size()), key), OTBR_ERROR_NOT_IMPLEMENTED);
+
+    // A truncated question
+    message = MakeQuery(0x1234, kFlagsRecursion, "example.com", kTypeA);
+    EXPECT_EQ(GetDnsQueryKey(message.data(), static_cast<uint16_t>(message.size() - 1), key), OTBR_ERROR_PARSE);
+    EXPECT_EQ(GetDnsQueryKey(message.data(), 14, key), OTBR_ERROR_PARSE);
+}
+
+TEST(DnsUtils, TestGetDnsResponseCacheTtl)
+{
+    static constexpr uint16_t kFlagsResponse = 0x8180;
+    static constexpr uint16_t kTypeA         = 1;
+    static constexpr uint16_t kTypeSoa       = 6;
+    static constexpr uint16_t kTypeOpt       = 41;
+
+    const std::vector<uint8_t> address = {192, 0, 2, 1};
+    std::vector<uint8_t>       soa     = {0xc0, 12, 0xc0, 12};
+    std::vector<uint8_t>       message;
+
+    // The SOA RDATA is made of two compressed names and five 32-bit fields, the last of which is MINIMUM (900).
+    soa.insert(soa.end(), 16, 0);
+    soa.insert(soa.end(), {0, 0, 0x03, 0x84});
+
+    {
+        DnsMessageBuilder builder(0x1234, kFlagsResponse, 1, 2, 0);
+
+        builder.AppendQuestion("example.com", kTypeA)
+            .AppendRecord(kTypeA, 300, address)
+            .AppendRecord(kTypeA, 60, address)
+            .AppendName("")
+            .AppendUint16(kTypeOpt)
+            .AppendUint16(1232)
+            .AppendUint32(0)
+            .AppendUint16(0);
+        builder.SetAdditionalCount(1);
+        message = builder.Get();
+    }
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size())), 60u);
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size() - 1)), 0u);
+
+    // A truncated response is not cached.
+    message[2] |= 0x02;
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size())), 0u);
+
+    // A server failure is not cached.
+    message = MakeQuery(0x1234, kFlagsResponse | 2, "example.com", kTypeA);
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size())), 0u);
+
+    // A negative response is cached for the SOA MINIMUM (900) if smaller than the SOA TTL.
+    message = DnsMessageBuilder(0x1234, kFlagsResponse | 3, 1, 0, 1)
+                  .AppendQuestion("example.com", kTypeA)
+                  .AppendRecord(kTypeSoa, 3600, soa)
+                  .Get();
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size())), 900u);
+
+    message = DnsMessageBuilder(0x1234, kFlagsResponse, 1, 0, 1)
+                  .AppendQuestion("example.com", kTypeA)
+                  .AppendRecord(kTypeSoa, 120, soa)
+                  .Get();
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size())), 120u);
+
+    // A negative response without SOA record is not cached.
+    message = MakeQuery(0x1234, kFlagsResponse | 3, "example.com", kTypeA);
+    EXPECT_EQ(GetDnsResponseCacheTtl(message.data(), static_cast<uint16_t>(message.size())), 0u);
+}
+
+TEST(DnsUtils, TestAgeDnsResponse)
+{
+    static constexpr uint16_t kFlagsResponse = 0x8180;
+    static constexpr uint16_t kTypeA         = 1;
+    static constexpr size_t   kFirstRecord   = 12 + 13 + 4;
+    static constexpr size_t   kRecordSize    = 2 + 10 + 4;
+
+    const std::vector<uint8_t> address = {192, 0, 2, 1};
+    std::vector<uint8_t>       message;
+
+    message = DnsMessageBuilder(0x1234, kFlagsResponse, 1, 2, 0)
+                  .AppendQuestion("example.com", kTypeA)
+                  .AppendRecord(kTypeA, 300, address)
+                  .AppendRecord(kTypeA, 60, address)
+                  .Get();
+
+    AgeDnsResponse(message.data(), static_cast<uint16_t>(message.size()), 100);
+    EXPECT_EQ(ReadTtl(message, kFirstRecord), 200u);
+    EXPECT_EQ(ReadTtl(message, kFirstRecord + kRecordSize), 0u);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+long long ElapsedUs(Clock::time_point aStart)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - aStart).count();
+}
+
+} // namespace
+
+TEST(DnsUtilsBenchmark, TestSplitFullDnsName)
+{
+    static constexpr int kRepeat = 100000;
+
+    const std::string names[] = {"Instance Name._ipps._tcp.default.service.arpa.", "_meshcop._udp.default.service.arpa",
+                                 "host.default.service.arpa."};
+    size_t            count   = 0;
+    Clock::time_point start;
+    long long         stringsUs;
+    long long         spansUs;
+
+    start = Clock::now();
+    for (int i = 0; i < kRepeat; i++)
+    {
+        for (const std::string &name : names)
+        {
+            count += SplitFullDnsName(name).mDomain.size();
+        }
+    }
+    stringsUs = ElapsedUs(start);
+
+    start = Clock::now();
+    for (int i = 0; i < kRepeat; i++)
+    {
+        for (const std::string &name : names)
+        {
+            count += SplitFullDnsName(name.data(), name.size()).mDomain.mLength;
+        }
+    }
+    spansUs = ElapsedUs(start);
+
+    EXPECT_GT(count, 0u);
+    printf("SplitFullDnsName(x%d) strings=%8lldus spans=%8lldus\n", kRepeat * 3, stringsUs, spansUs);
+}
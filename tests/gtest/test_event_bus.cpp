@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/event_bus.hpp"
+
+namespace {
+
+struct TestEvent
+{
+    int mValue;
+};
+
+struct OtherEvent
+{
+    int mValue;
+};
+
+} // namespace
+
+TEST(EventBus, TestPublishToSubscribers)
+{
+    otbr::EventChannel<TestEvent> &channel = otbr::EventBus::Get<TestEvent>();
+    std::vector<int>               received;
+    TestEvent                      event;
+    bool                           filled = false;
+    uint64_t                       id;
+
+    EXPECT_EQ(&channel, &otbr::EventBus::Get<TestEvent>());
+    EXPECT_FALSE(channel.HasSubscribers());
+
+    // The event record is not filled without subscribers.
+    otbr::EventBus::Publish(event, [&filled](TestEvent &aEvent) {
+        aEvent.mValue = 1;
+        filled        = true;
+    });
+    EXPECT_FALSE(filled);
+
+    id = channel.Subscribe([&received](const TestEvent &aEvent) { received.push_back(aEvent.mValue); });
+    EXPECT_TRUE(channel.HasSubscribers());
+    EXPECT_FALSE(otbr::EventBus::Get<OtherEvent>().HasSubscribers());
+
+    otbr::EventBus::Publish(event, [](TestEvent &aEvent) { aEvent.mValue = 2; });
+    EXPECT_EQ(received, std::vector<int>({2}));
+
+    channel.Unsubscribe(id);
+    EXPECT_FALSE(channel.HasSubscribers());
+    channel.Publish({3});
+    EXPECT_EQ(received, std::vector<int>({2}));
+}
+
+TEST(EventBus, TestSubscribeAndUnsubscribeWhilePublishing)
+{
+    otbr::EventChannel<OtherEvent> &channel = otbr::EventBus::Get<OtherEvent>();
+    std::vector<int>                received;
+    uint64_t                        id;
+
+    id = channel.Subscribe([&](const OtherEvent &aEvent) {
+        received.push_back(aEvent.mValue);
+        channel.Unsubscribe(id);
+        channel.Subscribe([&received](const OtherEvent &aEvent) { received.push_back(aEvent.mValue * 10); });
+    });
+
+    // The handler subscribed while publishing only receives the next events.
+    channel.Publish({1});
+    EXPECT_EQ(received, std::vector<int>({1}));
+
+    channel.Publish({2});
+    EXPECT_EQ(received, std::vector<int>({1, 20}));
+}
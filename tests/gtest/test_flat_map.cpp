@@ -0,0 +1,106 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "common/flat_map.hpp"
+
+TEST(FlatMap, TestInsertFindErase)
+{
+    otbr::FlatMap<std::string, int> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.find("a") == map.end());
+    EXPECT_EQ(map.erase("a"), 0u);
+
+    EXPECT_TRUE(map.emplace("b", 2).second);
+    EXPECT_TRUE(map.emplace("a", 1).second);
+    EXPECT_FALSE(map.emplace("a", 3).second);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at("a"), 1);
+    EXPECT_EQ(map.count("b"), 1u);
+    EXPECT_EQ(map.count("c"), 0u);
+    EXPECT_THROW(map.at("c"), std::out_of_range);
+
+    map["c"] = 3;
+    map["a"] = 4;
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.at("a"), 4);
+    EXPECT_EQ(map.at("c"), 3);
+
+    EXPECT_EQ(map.erase("b"), 1u);
+    EXPECT_TRUE(map.find("b") == map.end());
+    EXPECT_EQ(map.size(), 2u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(FlatMap, TestOrderedLikeStdMap)
+{
+    otbr::FlatMap<int, int> map;
+    std::map<int, int>      expected;
+
+    for (int i = 0; i < 200; i++)
+    {
+        int key = (i * 37) % 101;
+
+        map[key] += i;
+        expected[key] += i;
+    }
+
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (it->first % 3 == 0)
+        {
+            expected.erase(it->first);
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    ASSERT_EQ(map.size(), expected.size());
+
+    {
+        auto expectedIt = expected.begin();
+
+        for (const auto &entry : map)
+        {
+            EXPECT_EQ(entry.first, expectedIt->first);
+            EXPECT_EQ(entry.second, expectedIt->second);
+            ++expectedIt;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/frame_buffer.hpp"
+
+TEST(FrameBuffer, PrependInPlace)
+{
+    uint8_t           buffer[16];
+    otbr::FrameBuffer frame(buffer, sizeof(buffer), 4);
+    const uint8_t     header[] = {0xaa, 0xbb};
+
+    EXPECT_EQ(frame.GetHeadroom(), 4);
+    EXPECT_EQ(frame.GetCapacity(), 12);
+
+    memcpy(frame.GetData(), "abc", 3);
+    frame.SetLength(3);
+
+    EXPECT_EQ(frame.Prepend(header, sizeof(header)), OTBR_ERROR_NONE);
+    EXPECT_EQ(frame.GetData(), buffer + 2);
+    EXPECT_EQ(frame.GetLength(), 5);
+    EXPECT_EQ(frame.GetHeadroom(), 2);
+    EXPECT_EQ(memcmp(frame.GetData(), "\xaa\xbb" "abc", 5), 0);
+}
+
+TEST(FrameBuffer, PrependWithoutHeadroom)
+{
+    uint8_t           buffer[16];
+    otbr::FrameBuffer frame(buffer, sizeof(buffer), 1);
+    const uint8_t     header[] = {0xaa, 0xbb};
+
+    frame.SetLength(10);
+
+    EXPECT_EQ(frame.Prepend(header, sizeof(header)), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(frame.GetData(), buffer + 1);
+    EXPECT_EQ(frame.GetLength(), 10);
+}
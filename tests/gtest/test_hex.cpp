@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "utils/hex.hpp"
+
+using otbr::Utils::Bytes2Hex;
+using otbr::Utils::Hex2Bytes;
+using otbr::Utils::HexCase;
+
+static std::string ReferenceHex(const std::vector<uint8_t> &aBytes, const char *aDigits)
+{
+    std::string hex;
+
+    for (uint8_t byte : aBytes)
+    {
+        hex += aDigits[byte >> 4];
+        hex += aDigits[byte & 0x0f];
+    }
+
+    return hex;
+}
+
+static std::vector<uint8_t> MakeBytes(size_t aLength)
+{
+    std::vector<uint8_t> bytes(aLength);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    return bytes;
+}
+
+TEST(Hex, Bytes2HexMatchesReferenceForAllLengths)
+{
+    // The lengths cover the vectorized blocks and the remainders.
+    for (size_t length = 0; length <= 70; length++)
+    {
+        std::vector<uint8_t> bytes = MakeBytes(length);
+        std::vector<char>    hex(2 * length + 1, 'x');
+        std::string          str;
+
+        EXPECT_EQ(Bytes2Hex(bytes.data(), static_cast<uint16_t>(length), hex.data()), 2 * length);
+        EXPECT_EQ(std::string(hex.data()), ReferenceHex(bytes, "0123456789ABCDEF"));
+        EXPECT_EQ(Bytes2Hex(bytes.data(), static_cast<uint16_t>(length)), ReferenceHex(bytes, "0123456789ABCDEF"));
+
+        Bytes2Hex(bytes.data(), length, str, HexCase::kLower);
+        EXPECT_EQ(str, ReferenceHex(bytes, "0123456789abcdef"));
+    }
+}
+
+TEST(Hex, Bytes2HexCoversAllByteValues)
+{
+    std::vector<uint8_t> bytes(256);
+    std::string          str;
+
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    Bytes2Hex(bytes.data(), bytes.size(), str, HexCase::kUpper);
+    EXPECT_EQ(str, ReferenceHex(bytes, "0123456789ABCDEF"));
+}
+
+TEST(Hex, Hex2BytesRoundTripsForAllLengths)
+{
+    for (size_t length = 0; length <= 70; length++)
+    {
+        std::vector<uint8_t> bytes = MakeBytes(length);
+        std::vector<uint8_t> decoded(length + 1);
+        std::string          upper = ReferenceHex(bytes, "0123456789ABCDEF");
+        std::string          lower = ReferenceHex(bytes, "0123456789abcdef");
+
+        ASSERT_EQ(Hex2Bytes(upper.c_str(), decoded.data(), static_cast<uint16_t>(length)), static_cast<int>(length));
+        EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), decoded.begin()));
+        ASSERT_EQ(Hex2Bytes(lower.data(), lower.size(), decoded.data(), static_cast<uint16_t>(length)),
+                  static_cast<int>(length));
+        EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), decoded.begin()));
+    }
+}
+
+TEST(Hex, Hex2BytesConvertsOddLengthWithLeadingNibble)
+{
+    uint8_t bytes[2];
+
+    ASSERT_EQ(Hex2Bytes("abc", bytes, sizeof(bytes)), 2);
+    EXPECT_EQ(bytes[0], 0x0a);
+    EXPECT_EQ(bytes[1], 0xbc);
+}
+
+TEST(Hex, Hex2BytesRejectsInvalidDigitsAtAnyPosition)
+{
+    const char           kInvalid[] = {'g', 'G', '/', ':', '@', '`', ' ', '\x80', '\xff', '\xc1'};
+    std::vector<uint8_t> bytes      = MakeBytes(40);
+    std::string          hex        = ReferenceHex(bytes, "0123456789abcdef");
+    uint8_t              decoded[40];
+
+    for (size_t i = 0; i < hex.size(); i++)
+    {
+        for (char invalid : kInvalid)
+        {
+            std::string corrupted = hex;
+
+            corrupted[i] = invalid;
+            EXPECT_EQ(Hex2Bytes(corrupted.data(), corrupted.size(), decoded, sizeof(decoded)), -1);
+        }
+    }
+}
+
+TEST(Hex, Hex2BytesRejectsTooShortBuffer)
+{
+    uint8_t bytes[2];
+
+    EXPECT_EQ(Hex2Bytes("aabbcc", bytes, sizeof(bytes)), -1);
+    EXPECT_EQ(Hex2Bytes("aab", bytes, 1), -1);
+}
+
+TEST(Hex, Long2HexIsBigEndian)
+{
+    char hex[17];
+
+    EXPECT_EQ(otbr::Utils::Long2Hex(0x0123456789abcdefull, hex), 16u);
+    EXPECT_STREQ(hex, "0123456789ABCDEF");
+}
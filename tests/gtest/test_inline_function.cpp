@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "common/inline_function.hpp"
+
+TEST(InlineFunction, NullptrIsNull)
+{
+    otbr::InlineFunction<void(void)> noop = nullptr;
+    std::function<void(void)>        empty;
+
+    EXPECT_FALSE(noop);
+    EXPECT_FALSE(otbr::InlineFunction<void(void)>(empty));
+}
+
+TEST(InlineFunction, InvokeMoveOnlyCallable)
+{
+    std::unique_ptr<int>           value(new int(5));
+    otbr::InlineFunction<int(int)> add = [value = std::move(value)](int x) { return x + *value; };
+    otbr::InlineFunction<int(int)> moved;
+
+    EXPECT_TRUE(add);
+    EXPECT_EQ(add(1), 6);
+
+    moved = std::move(add);
+    EXPECT_FALSE(add);
+    EXPECT_EQ(moved(2), 7);
+}
+
+TEST(InlineFunction, LargeCallableFallsBackToHeap)
+{
+    struct Large
+    {
+        char mData[128];
+        int  operator()(void) const { return mData[0]; }
+    };
+
+    Large                           large{{42}};
+    otbr::InlineFunction<int(void)> func = large;
+
+    EXPECT_FALSE(otbr::InlineFunction<int(void)>::IsStoredInline<Large>());
+    EXPECT_TRUE(otbr::InlineFunction<int(void)>::IsStoredInline<std::function<int(void)>>());
+    EXPECT_EQ(func(), 42);
+}
+
+TEST(InlineFunction, DestroysCallable)
+{
+    std::shared_ptr<int> value = std::make_shared<int>(0);
+
+    {
+        otbr::InlineFunction<void(void)> func = [value]() {};
+
+        EXPECT_EQ(value.use_count(), 2);
+    }
+
+    EXPECT_EQ(value.use_count(), 1);
+}
@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include "utils/joiner_batch.hpp"
+
+using otbr::agent::JoinerBatch;
+
+static otJoinerInfo MakeEui64Joiner(uint8_t aLastByte, const char *aPskd, uint32_t aTimeout)
+{
+    otJoinerInfo joiner;
+
+    memset(&joiner, 0, sizeof(joiner));
+    joiner.mType                  = OT_JOINER_INFO_TYPE_EUI64;
+    joiner.mSharedId.mEui64.m8[7] = aLastByte;
+    joiner.mExpirationTime        = aTimeout;
+    strncpy(joiner.mPskd.m8, aPskd, OT_JOINER_MAX_PSKD_LENGTH);
+
+    return joiner;
+}
+
+static otJoinerInfo MakeDiscernerJoiner(uint64_t aValue, uint8_t aLength, const char *aPskd)
+{
+    otJoinerInfo joiner;
+
+    memset(&joiner, 0, sizeof(joiner));
+    joiner.mType                        = OT_JOINER_INFO_TYPE_DISCERNER;
+    joiner.mSharedId.mDiscerner.mValue  = aValue;
+    joiner.mSharedId.mDiscerner.mLength = aLength;
+    joiner.mExpirationTime              = 60;
+    strncpy(joiner.mPskd.m8, aPskd, OT_JOINER_MAX_PSKD_LENGTH);
+
+    return joiner;
+}
+
+TEST(JoinerBatch, DuplicatesAreMerged)
+{
+    JoinerBatch batch;
+
+    EXPECT_EQ(batch.AddJoiner(MakeEui64Joiner(1, "J01NME", 60)), OT_ERROR_NONE);
+    EXPECT_EQ(batch.AddJoiner(MakeEui64Joiner(2, "J01NME", 60)), OT_ERROR_NONE);
+    EXPECT_EQ(batch.AddJoiner(MakeEui64Joiner(1, "J01NME", 120)), OT_ERROR_NONE);
+
+    ASSERT_EQ(batch.GetJoiners().size(), 2u);
+    EXPECT_EQ(batch.GetJoiners()[0].mSharedId.mEui64.m8[7], 1);
+    EXPECT_EQ(batch.GetJoiners()[0].mExpirationTime, 120u);
+    EXPECT_EQ(batch.GetJoiners()[1].mSharedId.mEui64.m8[7], 2);
+}
+
+TEST(JoinerBatch, ConflictingPskdIsRejected)
+{
+    JoinerBatch batch;
+
+    EXPECT_EQ(batch.AddJoiner(MakeEui64Joiner(1, "J01NME", 60)), OT_ERROR_NONE);
+    EXPECT_EQ(batch.AddJoiner(MakeEui64Joiner(1, "J02NME", 60)), OT_ERROR_INVALID_ARGS);
+    EXPECT_EQ(batch.GetJoiners().size(), 1u);
+}
+
+TEST(JoinerBatch, DiscernersOfDifferentLengthsAreDistinct)
+{
+    JoinerBatch batch;
+
+    EXPECT_EQ(batch.AddJoiner(MakeDiscernerJoiner(0x12, 8, "J01NME")), OT_ERROR_NONE);
+    EXPECT_EQ(batch.AddJoiner(MakeDiscernerJoiner(0x12, 16, "J01NME")), OT_ERROR_NONE);
+    EXPECT_EQ(batch.AddJoiner(MakeDiscernerJoiner(0x12, 8, "J01NME")), OT_ERROR_NONE);
+
+    // An EUI-64 whose value equals a discerner is another joiner.
+    EXPECT_EQ(batch.AddJoiner(MakeEui64Joiner(0x12, "J01NME", 60)), OT_ERROR_NONE);
+    EXPECT_EQ(batch.GetJoiners().size(), 3u);
+}
@@ -0,0 +1,96 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "utils/link_metrics_sampler.hpp"
+
+using otbr::agent::LinkMetricsHistory;
+
+static LinkMetricsHistory::Sample MakeSample(int8_t aRssi, uint8_t aLqi, uint8_t aLinkMargin)
+{
+    LinkMetricsHistory::Sample sample;
+
+    sample.mRssi       = aRssi;
+    sample.mLqi        = aLqi;
+    sample.mLinkMargin = aLinkMargin;
+
+    return sample;
+}
+
+TEST(LinkMetricsHistory, EmptyHistoryHasZeroPercentiles)
+{
+    LinkMetricsHistory history;
+
+    EXPECT_EQ(history.GetSampleCount(), 0);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 50), 0);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kLinkMargin, 90), 0);
+}
+
+TEST(LinkMetricsHistory, NearestRankPercentiles)
+{
+    LinkMetricsHistory history;
+
+    // RSSI -100..-91, LQI 10..100 and link margin 1..10, added out of order.
+    for (int i : {5, 2, 9, 0, 7, 3, 8, 1, 6, 4})
+    {
+        history.AddSample(MakeSample(static_cast<int8_t>(-100 + i), static_cast<uint8_t>(10 * (i + 1)),
+                                     static_cast<uint8_t>(i + 1)));
+    }
+
+    EXPECT_EQ(history.GetSampleCount(), 10);
+    EXPECT_EQ(history.GetLatestSample().mRssi, -96);
+
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 10), -100);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 50), -96);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 90), -92);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 100), -91);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kLqi, 50), 50);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kLinkMargin, 90), 9);
+}
+
+TEST(LinkMetricsHistory, OldestSamplesAreReplaced)
+{
+    LinkMetricsHistory history;
+
+    for (uint8_t i = 0; i < LinkMetricsHistory::kMaxSamples; i++)
+    {
+        history.AddSample(MakeSample(-90, 0, 0));
+    }
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 100), -90);
+
+    // A full history of newer samples drops all the older ones.
+    for (uint8_t i = 0; i < LinkMetricsHistory::kMaxSamples; i++)
+    {
+        history.AddSample(MakeSample(-50, 0, 0));
+    }
+
+    EXPECT_EQ(history.GetSampleCount(), LinkMetricsHistory::kMaxSamples);
+    EXPECT_EQ(history.GetLatestSample().mRssi, -50);
+    EXPECT_EQ(history.GetPercentile(LinkMetricsHistory::kRssi, 1), -50);
+}
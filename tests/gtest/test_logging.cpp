@@ -32,6 +32,11 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "common/logging.hpp"
@@ -128,3 +133,171 @@ TEST(Logging, TestLoggingDump)
     snprintf(cmd, sizeof(cmd), "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     EXPECT_EQ(system(cmd), 0);
 }
+
+TEST(Logging, TestLoggingConcurrentTags)
+{
+    static constexpr int kNumThreads        = 4;
+    static constexpr int kNumMessages       = 100;
+    static const char   *kTags[kNumThreads] = {"A", "BB", "CCC", "DDDD"};
+
+    std::vector<std::thread> threads;
+    std::istringstream       output;
+    std::string              line;
+    int                      numLines = 0;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    testing::internal::CaptureStdout();
+
+    for (int i = 0; i < kNumThreads; i++)
+    {
+        threads.emplace_back([i] {
+            for (int j = 0; j < kNumMessages; j++)
+            {
+                otbrLog(OTBR_LOG_INFO, kTags[i], "tag=%s", kTags[i]);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    otbrLogDeinit();
+    output.str(testing::internal::GetCapturedStdout());
+
+    // Each message carries the prefix of its own tag.
+    while (std::getline(output, line))
+    {
+        if (line.find("messages dropped") != std::string::npos)
+        {
+            continue;
+        }
+
+        for (const char *tag : kTags)
+        {
+            std::string prefix = std::string("-") + tag;
+
+            if (line.find(std::string("tag=") + tag) != std::string::npos)
+            {
+                EXPECT_EQ(line.compare(6, prefix.size(), prefix), 0) << line;
+                EXPECT_EQ(line[6 + prefix.size()], '-') << line;
+            }
+        }
+        numLines++;
+    }
+
+    EXPECT_EQ(numLines + otbrLogGetDroppedCount(), static_cast<uint32_t>(kNumThreads * kNumMessages));
+}
+
+static int sNumEvaluations = 0;
+
+static int Evaluate(void)
+{
+    return ++sNumEvaluations;
+}
+
+TEST(Logging, TestLoggingTagLevel)
+{
+    std::string output;
+
+    sNumEvaluations = 0;
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    testing::internal::CaptureStdout();
+
+    // The arguments of filtered messages are not evaluated.
+    otbrLogDebug("debug-filtered %d", Evaluate());
+    EXPECT_EQ(sNumEvaluations, 0);
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    EXPECT_EQ(otbrLogGetTagLevel(OTBR_LOG_TAG), OTBR_LOG_DEBUG);
+    EXPECT_EQ(otbrLogGetTagLevel("OTHER"), OTBR_LOG_INFO);
+    otbrLogDebug("debug-tag %d", Evaluate());
+    otbrLog(OTBR_LOG_DEBUG, "OTHER", "debug-other");
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_WARNING), OTBR_ERROR_NONE);
+    otbrLogInfo("info-filtered %d", Evaluate());
+
+    otbrLogClearTagLevels();
+    otbrLogInfo("info-global %d", Evaluate());
+
+    EXPECT_EQ(otbrLogSetTagLevel("A-VERY-LONG-LOG-TAG", OTBR_LOG_DEBUG), OTBR_ERROR_INVALID_ARGS);
+
+    otbrLogDeinit();
+    output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(sNumEvaluations, 2);
+    EXPECT_EQ(output.find("filtered"), std::string::npos);
+    EXPECT_EQ(output.find("debug-other"), std::string::npos);
+    EXPECT_NE(output.find("debug-tag 1"), std::string::npos);
+    EXPECT_NE(output.find("info-global 2"), std::string::npos);
+}
+
+TEST(Logging, TestLoggingIsEnabled)
+{
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+
+    EXPECT_TRUE(otbrLogIsEnabled(OTBR_LOG_WARNING));
+    EXPECT_TRUE(otbrLogIsEnabled(OTBR_LOG_INFO));
+    EXPECT_FALSE(otbrLogIsEnabled(OTBR_LOG_DEBUG));
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    EXPECT_TRUE(otbrLogIsEnabled(OTBR_LOG_DEBUG));
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_WARNING), OTBR_ERROR_NONE);
+    EXPECT_FALSE(otbrLogIsEnabled(OTBR_LOG_INFO));
+
+    otbrLogClearTagLevels();
+    otbrLogDeinit();
+}
+
+static void LogRateLimited(int aValue)
+{
+    otbrLogInfoRateLimited("info-limited %d %d", aValue, Evaluate());
+}
+
+TEST(Logging, TestLoggingRateLimited)
+{
+    std::string output;
+    size_t      numLines = 0;
+
+    sNumEvaluations = 0;
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    testing::internal::CaptureStdout();
+
+    // The filtered messages take no tokens.
+    for (int i = 0; i < 20; i++)
+    {
+        otbrLogDebugRateLimited("debug-filtered %d", Evaluate());
+    }
+
+    // Only a burst is logged, the arguments of the suppressed messages are not evaluated.
+    for (int i = 0; i < 15; i++)
+    {
+        LogRateLimited(i);
+    }
+    EXPECT_EQ(sNumEvaluations, 10);
+
+    // Another call site has its own rate limit.
+    otbrLogInfoRateLimited("info-other");
+
+    // The count of the suppressed messages is logged before the next message of the call site.
+    usleep(1100 * 1000);
+    LogRateLimited(15);
+
+    otbrLogDeinit();
+    output = testing::internal::GetCapturedStdout();
+
+    for (size_t pos = output.find("info-limited"); pos != std::string::npos; pos = output.find("info-limited", pos + 1))
+    {
+        numLines++;
+    }
+
+    EXPECT_EQ(numLines, 11u);
+    EXPECT_EQ(output.find("filtered"), std::string::npos);
+    EXPECT_NE(output.find("info-limited 9 10"), std::string::npos);
+    EXPECT_EQ(output.find("info-limited 10 "), std::string::npos);
+    EXPECT_NE(output.find("info-other"), std::string::npos);
+    EXPECT_NE(output.find("5 similar messages suppressed"), std::string::npos);
+    EXPECT_LT(output.find("5 similar messages suppressed"), output.find("info-limited 15 11"));
+}
@@ -0,0 +1,455 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+
+#include "common/mainloop_manager.hpp"
+
+static void RunMainloopOnce(otbr::MainloopManager &aManager, const timeval &aTimeout)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = aTimeout;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aManager.Update(mainloop);
+    EXPECT_GE(aManager.Poll(mainloop), 0);
+    aManager.Process(mainloop);
+}
+
+TEST(MainloopManager, TestRegisteredFdIsDispatched)
+{
+    otbr::MainloopManager manager;
+    int                   fds[2];
+    int                   calls  = 0;
+    uint8_t               events = 0;
+    const uint8_t         kOne   = 1;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    manager.AddFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t aEvents) {
+        uint8_t n;
+
+        ++calls;
+        events = aEvents;
+        EXPECT_EQ(read(fds[0], &n, sizeof(n)), 1);
+    });
+
+    // Nothing is readable, the handler is not invoked.
+    RunMainloopOnce(manager, {0, 10000});
+    EXPECT_EQ(calls, 0);
+
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {1, 0});
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(events & otbr::MainloopManager::kEventReadable);
+
+    // A disarmed fd is not dispatched.
+    manager.UpdateFd(fds[0], 0);
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {0, 10000});
+    EXPECT_EQ(calls, 1);
+
+    // The fd is dispatched again once re-armed.
+    manager.UpdateFd(fds[0], otbr::MainloopManager::kEventReadable);
+    RunMainloopOnce(manager, {1, 0});
+    EXPECT_EQ(calls, 2);
+
+    manager.RemoveFd(fds[0]);
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {0, 10000});
+    EXPECT_EQ(calls, 2);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestHandlerRemovesItsFd)
+{
+    otbr::MainloopManager manager;
+    int                   fds[2];
+    int                   calls = 0;
+    const uint8_t         kOne  = 1;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    manager.AddFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t) {
+        ++calls;
+        manager.RemoveFd(fds[0]);
+    });
+
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {1, 0});
+    RunMainloopOnce(manager, {0, 10000});
+    EXPECT_EQ(calls, 1);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestClockIsCachedWhileProcessing)
+{
+    otbr::MainloopManager manager;
+    int                   fds[2];
+    otbr::Timepoint       first;
+    otbr::Timepoint       second;
+    const uint8_t         kOne = 1;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    manager.AddFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t) {
+        uint8_t n;
+
+        EXPECT_EQ(read(fds[0], &n, sizeof(n)), 1);
+        first = otbr::MainloopClock::Now();
+        usleep(2000);
+        second = otbr::MainloopClock::Now();
+    });
+
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {1, 0});
+    EXPECT_TRUE(first == second);
+
+    // The clock is read again outside of the mainloop.
+    EXPECT_GE(otbr::MainloopClock::Now() - first, otbr::Milliseconds(2));
+
+    manager.RemoveFd(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+class OrderedProcessor : public otbr::MainloopProcessor
+{
+public:
+    OrderedProcessor(Priority aPriority, char aName, std::string &aOrder)
+        : MainloopProcessor(aPriority)
+        , mName(aName)
+        , mOrder(aOrder)
+    {
+    }
+
+    void Update(otbr::MainloopContext &) override {}
+    void Process(const otbr::MainloopContext &) override { mOrder += mName; }
+
+private:
+    char         mName;
+    std::string &mOrder;
+};
+
+TEST(MainloopManager, TestThreadStackIsProcessedFirst)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    std::string            order;
+    int                    fds[2];
+    const uint8_t          kOne = 1;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    {
+        OrderedProcessor mdns(otbr::MainloopProcessor::kPriorityMdns, 'm', order);
+        OrderedProcessor management1(otbr::MainloopProcessor::kPriorityDefault, 'a', order);
+        OrderedProcessor threadStack(otbr::MainloopProcessor::kPriorityThreadStack, 'T', order);
+        OrderedProcessor management2(otbr::MainloopProcessor::kPriorityDefault, 'b', order);
+
+        manager.AddFd(fds[0], otbr::MainloopManager::kEventReadable, [&](uint8_t) {
+            uint8_t n;
+
+            order += 'f';
+            EXPECT_EQ(read(fds[0], &n, sizeof(n)), 1);
+        });
+
+        ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+        RunMainloopOnce(manager, {1, 0});
+        EXPECT_EQ(order, "Tfabm");
+
+        manager.RemoveFd(fds[0]);
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#if OTBR_ENABLE_RADIO_THREAD
+class ThreadStackProcessor : public otbr::MainloopProcessor
+{
+public:
+    ThreadStackProcessor(void)
+        : MainloopProcessor(kPriorityThreadStack)
+    {
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        // Wait for the pipe to be readable, then process it.
+        FD_SET(mFds[0], &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mFds[0]);
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        uint8_t n;
+
+        if (FD_ISSET(mFds[0], &aMainloop.mReadFdSet) && read(mFds[0], &n, sizeof(n)) == 1)
+        {
+            mProcessedOnRadioThread = otbr::MainloopManager::GetInstance().IsRadioThread();
+            mProcessThread          = std::this_thread::get_id();
+            ++mProcessCount;
+        }
+    }
+
+    int             mFds[2];
+    int             mProcessCount          = 0;
+    bool            mProcessedOnRadioThread = false;
+    std::thread::id mProcessThread;
+};
+
+TEST(MainloopManager, TestRadioThread)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    ThreadStackProcessor   threadStack;
+    std::string            order;
+    OrderedProcessor       management(otbr::MainloopProcessor::kPriorityDefault, 'a', order);
+    const uint8_t          kOne = 1;
+
+    ASSERT_EQ(pipe(threadStack.mFds), 0);
+
+    ASSERT_EQ(manager.StartRadioThread(/* aPriority */ 0, /* aCpu */ -1), OTBR_ERROR_NONE);
+    EXPECT_EQ(manager.StartRadioThread(0, -1), OTBR_ERROR_INVALID_STATE);
+    EXPECT_FALSE(manager.IsRadioThread());
+
+    ASSERT_EQ(write(threadStack.mFds[1], &kOne, sizeof(kOne)), 1);
+
+    // The radio thread wakes the mainloop up once it has processed the Thread stack.
+    for (int i = 0; i < 100 && threadStack.mProcessCount == 0; i++)
+    {
+        RunMainloopOnce(manager, {0, 10000});
+    }
+
+    EXPECT_EQ(threadStack.mProcessCount, 1);
+    EXPECT_TRUE(threadStack.mProcessedOnRadioThread);
+    EXPECT_NE(threadStack.mProcessThread, std::this_thread::get_id());
+    EXPECT_FALSE(order.empty());
+    EXPECT_EQ(order.find_first_not_of('a'), std::string::npos);
+
+    manager.StopRadioThread();
+
+    // The Thread stack is processed by the mainloop again.
+    ASSERT_EQ(write(threadStack.mFds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {1, 0});
+    EXPECT_EQ(threadStack.mProcessCount, 2);
+    EXPECT_FALSE(threadStack.mProcessedOnRadioThread);
+    EXPECT_EQ(threadStack.mProcessThread, std::this_thread::get_id());
+
+    close(threadStack.mFds[0]);
+    close(threadStack.mFds[1]);
+}
+#endif // OTBR_ENABLE_RADIO_THREAD
+
+#if OTBR_ENABLE_MDNS_THREAD
+class MdnsProcessor : public otbr::MainloopProcessor
+{
+public:
+    MdnsProcessor(void)
+        : MainloopProcessor(kPriorityMdns)
+    {
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        FD_SET(mFds[0], &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mFds[0]);
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        uint8_t n;
+
+        if (FD_ISSET(mFds[0], &aMainloop.mReadFdSet) && read(mFds[0], &n, sizeof(n)) == 1)
+        {
+            mProcessedOnMdnsThread = otbr::MainloopManager::GetInstance().IsMdnsThread();
+            mProcessThread         = std::this_thread::get_id();
+            ++mProcessCount;
+        }
+    }
+
+    int             mFds[2];
+    int             mProcessCount          = 0;
+    bool            mProcessedOnMdnsThread = false;
+    std::thread::id mProcessThread;
+};
+
+TEST(MainloopManager, TestMdnsThread)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    MdnsProcessor          mdns;
+    std::string            order;
+    OrderedProcessor       management(otbr::MainloopProcessor::kPriorityDefault, 'a', order);
+    const uint8_t          kOne = 1;
+
+    ASSERT_EQ(pipe(mdns.mFds), 0);
+
+    ASSERT_EQ(manager.StartMdnsThread(), OTBR_ERROR_NONE);
+    EXPECT_EQ(manager.StartMdnsThread(), OTBR_ERROR_INVALID_STATE);
+    EXPECT_FALSE(manager.IsMdnsThread());
+
+    ASSERT_EQ(write(mdns.mFds[1], &kOne, sizeof(kOne)), 1);
+
+    // The mDNS thread wakes the mainloop up once it has processed the ready fds.
+    for (int i = 0; i < 100 && mdns.mProcessCount == 0; i++)
+    {
+        RunMainloopOnce(manager, {0, 10000});
+    }
+
+    EXPECT_EQ(mdns.mProcessCount, 1);
+    EXPECT_TRUE(mdns.mProcessedOnMdnsThread);
+    EXPECT_NE(mdns.mProcessThread, std::this_thread::get_id());
+    EXPECT_FALSE(order.empty());
+
+    manager.StopMdnsThread();
+
+    // The mDNS publisher is processed by the mainloop again.
+    ASSERT_EQ(write(mdns.mFds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {1, 0});
+    EXPECT_EQ(mdns.mProcessCount, 2);
+    EXPECT_FALSE(mdns.mProcessedOnMdnsThread);
+    EXPECT_EQ(mdns.mProcessThread, std::this_thread::get_id());
+
+    close(mdns.mFds[0]);
+    close(mdns.mFds[1]);
+}
+
+#if OTBR_ENABLE_RADIO_THREAD
+TEST(MainloopManager, TestRadioAndMdnsThreads)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    ThreadStackProcessor   threadStack;
+    MdnsProcessor          mdns;
+    const uint8_t          kOne = 1;
+
+    ASSERT_EQ(pipe(threadStack.mFds), 0);
+    ASSERT_EQ(pipe(mdns.mFds), 0);
+
+    ASSERT_EQ(manager.StartRadioThread(0, -1), OTBR_ERROR_NONE);
+    ASSERT_EQ(manager.StartMdnsThread(), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(write(threadStack.mFds[1], &kOne, sizeof(kOne)), 1);
+    ASSERT_EQ(write(mdns.mFds[1], &kOne, sizeof(kOne)), 1);
+
+    for (int i = 0; i < 100 && (threadStack.mProcessCount == 0 || mdns.mProcessCount == 0); i++)
+    {
+        RunMainloopOnce(manager, {0, 10000});
+    }
+
+    EXPECT_TRUE(threadStack.mProcessedOnRadioThread);
+    EXPECT_TRUE(mdns.mProcessedOnMdnsThread);
+    EXPECT_NE(threadStack.mProcessThread, mdns.mProcessThread);
+
+    // The radio thread keeps running once the mDNS thread is stopped.
+    manager.StopMdnsThread();
+
+    ASSERT_EQ(write(threadStack.mFds[1], &kOne, sizeof(kOne)), 1);
+    for (int i = 0; i < 100 && threadStack.mProcessCount == 1; i++)
+    {
+        RunMainloopOnce(manager, {0, 10000});
+    }
+
+    EXPECT_EQ(threadStack.mProcessCount, 2);
+    EXPECT_TRUE(threadStack.mProcessedOnRadioThread);
+
+    manager.StopRadioThread();
+
+    for (int fd : {threadStack.mFds[0], threadStack.mFds[1], mdns.mFds[0], mdns.mFds[1]})
+    {
+        close(fd);
+    }
+}
+#endif // OTBR_ENABLE_RADIO_THREAD
+#endif // OTBR_ENABLE_MDNS_THREAD
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+TEST(MainloopManager, TestHistogramBuckets)
+{
+    otbr::MainloopHistogram histogram;
+
+    histogram.Record(otbr::Microseconds(0));
+    histogram.Record(otbr::Microseconds(1));
+    histogram.Record(otbr::Microseconds(2));
+    histogram.Record(otbr::Microseconds(1000));
+    histogram.Record(otbr::Seconds(10));
+
+    EXPECT_EQ(histogram.GetCount(), 5u);
+    EXPECT_EQ(histogram.GetMax(), 10000000u);
+    EXPECT_EQ(histogram.GetSum(), 10001003u);
+    EXPECT_EQ(histogram.GetBucketCount(0), 2u);
+    EXPECT_EQ(histogram.GetBucketCount(1), 1u);
+    EXPECT_EQ(histogram.GetBucketCount(9), 1u);
+    EXPECT_EQ(histogram.GetBucketCount(otbr::MainloopHistogram::kNumBuckets - 1), 1u);
+}
+
+TEST(MainloopManager, TestRegisteredFdStats)
+{
+    otbr::MainloopManager manager;
+    int                   fds[2];
+    const uint8_t         kOne = 1;
+
+    ASSERT_EQ(pipe(fds), 0);
+
+    manager.AddFd(
+        fds[0], otbr::MainloopManager::kEventReadable,
+        [&](uint8_t) {
+            uint8_t n;
+
+            EXPECT_EQ(read(fds[0], &n, sizeof(n)), 1);
+        },
+        "TestPipe");
+
+    ASSERT_EQ(write(fds[1], &kOne, sizeof(kOne)), 1);
+    RunMainloopOnce(manager, {1, 0});
+
+    EXPECT_EQ(manager.GetIterationCount(), 1u);
+    ASSERT_EQ(manager.GetProcessorStats().count("TestPipe"), 1u);
+    EXPECT_EQ(manager.GetProcessorStats().at("TestPipe").mReadyFdCount, 1u);
+    EXPECT_EQ(manager.GetProcessorStats().at("TestPipe").mProcessDuration.GetCount(), 1u);
+
+    manager.ResetStats();
+    EXPECT_EQ(manager.GetIterationCount(), 0u);
+    EXPECT_TRUE(manager.GetProcessorStats().empty());
+
+    manager.RemoveFd(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+#endif // OTBR_ENABLE_MAINLOOP_STATS
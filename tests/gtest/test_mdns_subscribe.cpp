@@ -61,8 +61,7 @@ int RunMainloopUntilTimeout(int aSeconds)
         FD_ZERO(&mainloop.mErrorFdSet);
 
         MainloopManager::GetInstance().Update(mainloop);
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      (mainloop.mTimeout.tv_sec == INT_MAX ? nullptr : &mainloop.mTimeout));
+        rval = MainloopManager::GetInstance().Poll(mainloop);
 
         if (rval < 0)
         {
@@ -325,3 +324,66 @@ TEST_F(MdnsTest, SubscribeServiceType)
     CheckServiceInstanceAdded(lastInstanceInfo, "host2.local.", {sAddr4}, "service3", 44444, {});
     clearLastInstance();
 }
+
+TEST_F(MdnsTest, SubscribeServiceTypeFilteredCallbacks)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+    std::string                testServiceName;
+    std::string                otherServiceName;
+
+    pub->AddSubscriptionCallbacks(
+        [&testServiceName](const std::string &aType, const Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+            OTBR_UNUSED_VARIABLE(aType);
+            testServiceName = aInstanceInfo.mName;
+        },
+        nullptr, "_test._tcp");
+    pub->AddSubscriptionCallbacks(
+        [&otherServiceName](const std::string &aType, const Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+            OTBR_UNUSED_VARIABLE(aType);
+            otherServiceName = aInstanceInfo.mName;
+        },
+        nullptr, "_other._tcp");
+    pub->SubscribeService("_test._tcp", "");
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, {}, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ("service1", testServiceName);
+    EXPECT_EQ("", otherServiceName);
+}
+
+TEST(MdnsTxtData, IterateTxtEntries)
+{
+    // "a=1", an empty entry, "Flag", "b=" and "xA=" followed by two value bytes.
+    const uint8_t kTxtData[] = {3, 'a', '=', '1', 0, 4, 'F', 'l', 'a', 'g', 2, 'b', '=', 5, 'x', 'A', '=', 0x12, 0x34};
+    const uint8_t kTruncatedTxtData[] = {3, 'a', '=', '1', 4, 'b', '='};
+    Publisher::TxtEntryIterator iterator(kTxtData, sizeof(kTxtData));
+    Publisher::TxtEntryIterator truncatedIterator(kTruncatedTxtData, sizeof(kTruncatedTxtData));
+    Publisher::TxtEntryView     entry;
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(std::string(entry.mKey, entry.mKeyLength), "a");
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+    ASSERT_EQ(entry.mValueLength, 1);
+    EXPECT_EQ(entry.mValue[0], '1');
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.KeyMatches("flag"));
+    EXPECT_TRUE(entry.mIsBooleanAttribute);
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.KeyMatches("b"));
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(entry.mValueLength, 0);
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.KeyMatches("xa"));
+    EXPECT_FALSE(entry.KeyMatches("x"));
+    ASSERT_EQ(entry.mValueLength, 2);
+    EXPECT_EQ(entry.mValue[1], 0x34);
+
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NOT_FOUND);
+
+    ASSERT_EQ(truncatedIterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(truncatedIterator.GetNextEntry(entry), OTBR_ERROR_PARSE);
+}
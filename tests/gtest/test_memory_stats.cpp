@@ -0,0 +1,86 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/memory_stats.hpp"
+#include "common/task_runner.hpp"
+
+using otbr::MemoryStats;
+
+TEST(MemoryStats, TestCountersAreSummedByName)
+{
+    MemoryStats &stats  = MemoryStats::GetInstance();
+    size_t       queued = 3;
+    int          owner1;
+    int          owner2;
+
+    stats.AddCounter(&owner1, "test.entries", [&queued]() { return queued; });
+    stats.AddCounter(&owner2, "test.entries", []() { return size_t(2); });
+    stats.AddCounter(&owner2, "test.others", []() { return size_t(1); });
+
+    EXPECT_EQ(stats.GetCounters()["test.entries"], 5u);
+    EXPECT_EQ(stats.GetCounters()["test.others"], 1u);
+
+    // The counters are evaluated when retrieved.
+    queued = 4;
+    EXPECT_EQ(stats.GetCounters()["test.entries"], 6u);
+
+    stats.RemoveCounters(&owner2);
+    EXPECT_EQ(stats.GetCounters()["test.entries"], 4u);
+    EXPECT_EQ(stats.GetCounters().count("test.others"), 0u);
+
+    stats.RemoveCounters(&owner1);
+    EXPECT_EQ(stats.GetCounters().count("test.entries"), 0u);
+}
+
+TEST(MemoryStats, TestTaskRunnerCounter)
+{
+    MemoryStats &stats = MemoryStats::GetInstance();
+
+    {
+        otbr::TaskRunner taskRunner;
+        size_t           count = stats.GetCounters()["task_runner.tasks"];
+
+        taskRunner.Post(otbr::Milliseconds(1000), []() {});
+        taskRunner.Post(otbr::Milliseconds(2000), []() {});
+        EXPECT_EQ(stats.GetCounters()["task_runner.tasks"], count + 2);
+    }
+
+    EXPECT_EQ(stats.GetCounters()["task_runner.tasks"], 0u);
+}
+
+TEST(MemoryStats, TestHeapUsage)
+{
+    MemoryStats::HeapUsage usage = MemoryStats::GetHeapUsage();
+
+#if defined(__linux__)
+    EXPECT_GT(usage.mResidentBytes, 0u);
+#endif
+    OTBR_UNUSED_VARIABLE(usage);
+}
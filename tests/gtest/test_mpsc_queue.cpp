@@ -0,0 +1,110 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mpsc_queue.hpp"
+
+TEST(MpscQueue, TestPushPop)
+{
+    otbr::MpscQueue<int, 4> queue;
+    int                     item = 0;
+
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_FALSE(queue.TryPop(item));
+
+    for (int round = 0; round < 3; round++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(queue.TryPush(round * 10 + i));
+        }
+
+        // The queue is full.
+        EXPECT_FALSE(queue.TryPush(100));
+        EXPECT_FALSE(queue.IsEmpty());
+
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(queue.TryPop(item));
+            EXPECT_EQ(item, round * 10 + i);
+        }
+
+        EXPECT_TRUE(queue.IsEmpty());
+    }
+}
+
+TEST(MpscQueue, TestMultipleProducers)
+{
+    static constexpr int kProducerCount = 4;
+    static constexpr int kItemCount     = 20000;
+
+    otbr::MpscQueue<int, 64> queue;
+    std::vector<std::thread> producers;
+    std::vector<int>         lastItems(kProducerCount, -1);
+    int                      popped = 0;
+
+    for (int producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (int i = 0; i < kItemCount; i++)
+            {
+                while (!queue.TryPush(producer * kItemCount + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    while (popped < kProducerCount * kItemCount)
+    {
+        int item;
+
+        if (!queue.TryPop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Items of the same producer are popped in the order of pushing.
+        EXPECT_EQ(lastItems[item / kItemCount] + 1, item % kItemCount);
+        lastItems[item / kItemCount] = item % kItemCount;
+        popped++;
+    }
+
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(queue.IsEmpty());
+}
@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/neighbor_table_tracker.hpp"
+
+using otbr::agent::NeighborTableTracker;
+
+static NeighborTableTracker::Entry MakeEntry(uint8_t aId, uint16_t aRloc16, bool aIsChild)
+{
+    NeighborTableTracker::Entry entry = {};
+
+    entry.mExtAddress.m8[7] = aId;
+    entry.mRloc16           = aRloc16;
+    entry.mIsChild          = aIsChild;
+    entry.mRxOnWhenIdle     = !aIsChild;
+    entry.mFullThreadDevice = !aIsChild;
+    entry.mFullNetworkData  = true;
+
+    return entry;
+}
+
+TEST(NeighborTableTracker, TestAddRemoveUpdate)
+{
+    NeighborTableTracker                      tracker;
+    std::vector<NeighborTableTracker::Entry>  table;
+    std::vector<NeighborTableTracker::Change> changes;
+
+    table = {MakeEntry(3, 0x0401, true), MakeEntry(1, 0x0800, false)};
+    tracker.Update(table, changes);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].mType, NeighborTableTracker::kChangeAdded);
+    EXPECT_EQ(changes[0].mEntry.mRloc16, 0x0800);
+    EXPECT_EQ(changes[1].mType, NeighborTableTracker::kChangeAdded);
+    EXPECT_EQ(changes[1].mEntry.mRloc16, 0x0401);
+    EXPECT_EQ(tracker.GetGeneration(), 1u);
+
+    // Only the tracked fields are compared, the same table in another order has no change.
+    table = {MakeEntry(1, 0x0800, false), MakeEntry(3, 0x0401, true)};
+    tracker.Update(table, changes);
+    EXPECT_TRUE(changes.empty());
+    EXPECT_EQ(tracker.GetGeneration(), 1u);
+
+    table = {MakeEntry(2, 0x0402, true), MakeEntry(1, 0x0c00, false)};
+    tracker.Update(table, changes);
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].mType, NeighborTableTracker::kChangeUpdated);
+    EXPECT_EQ(changes[0].mEntry.mRloc16, 0x0c00);
+    EXPECT_EQ(changes[1].mType, NeighborTableTracker::kChangeAdded);
+    EXPECT_EQ(changes[1].mEntry.mRloc16, 0x0402);
+    EXPECT_EQ(changes[2].mType, NeighborTableTracker::kChangeRemoved);
+    EXPECT_EQ(changes[2].mEntry.mRloc16, 0x0401);
+    EXPECT_EQ(tracker.GetGeneration(), 2u);
+
+    table.clear();
+    tracker.Update(table, changes);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].mType, NeighborTableTracker::kChangeRemoved);
+    EXPECT_EQ(changes[1].mType, NeighborTableTracker::kChangeRemoved);
+    EXPECT_EQ(tracker.GetGeneration(), 3u);
+}
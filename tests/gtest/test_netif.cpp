@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include <arpa/inet.h>
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <ifaddrs.h>
@@ -167,10 +168,9 @@ std::vector<std::string> GetAllIp6MulAddrs(const char *aInterfaceName)
     return ip6MulAddrs;
 }
 
-otbrError Ip6SendEmptyImpl(const uint8_t *aData, uint16_t aLength)
+otbrError Ip6SendEmptyImpl(otbr::FrameBuffer &aFrame)
 {
-    OTBR_UNUSED_VARIABLE(aData);
-    OTBR_UNUSED_VARIABLE(aLength);
+    OTBR_UNUSED_VARIABLE(aFrame);
     return OTBR_ERROR_NONE;
 }
 
@@ -374,6 +374,73 @@ TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingUnicastAddresses)
     netif.Deinit();
 }
 
+TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingManyUnicastAddresses)
+{
+    // More addresses than the requests sent in a single netlink message.
+    static constexpr uint8_t kAddressCount = 100;
+
+    const char *wpan = "wpan0";
+
+    otbr::Netif netif;
+    EXPECT_EQ(netif.Init(wpan, Ip6SendEmptyImpl), OT_ERROR_NONE);
+
+    std::vector<otbr::Ip6AddressInfo> addrs;
+    for (uint8_t i = 0; i < kAddressCount; i++)
+    {
+        otIp6Address address = {
+            {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+        address.mFields.m8[15] = i + 1;
+        addrs.emplace_back(address, 64, 0, 1, 0);
+    }
+
+    // The table from the NCP is not sorted.
+    std::reverse(addrs.begin(), addrs.end());
+    netif.UpdateIp6UnicastAddresses(addrs);
+    std::vector<std::string> wpan_addrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpan_addrs.size(), kAddressCount);
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd76:a5d1:fcb0:1707::1"));
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd76:a5d1:fcb0:1707::64"));
+
+    // The acknowledgements of all the requests are processed from the mainloop.
+    EXPECT_GE(netif.GetPendingNetlinkRequestCount(), kAddressCount);
+    for (int i = 0; i < 10 && netif.GetPendingNetlinkRequestCount() > 0; i++)
+    {
+        otbr::MainloopContext context;
+
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        netif.UpdateFdSet(&context);
+        ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                         &context.mTimeout),
+                  0);
+        netif.Process(&context);
+    }
+    EXPECT_EQ(netif.GetPendingNetlinkRequestCount(), 0u);
+
+    // Keep every other address.
+    std::vector<otbr::Ip6AddressInfo> halfAddrs;
+    for (size_t i = 0; i < addrs.size(); i += 2)
+    {
+        halfAddrs.push_back(addrs[i]);
+    }
+    netif.UpdateIp6UnicastAddresses(halfAddrs);
+    wpan_addrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpan_addrs.size(), kAddressCount / 2);
+    EXPECT_THAT(wpan_addrs, ::testing::Contains("fd76:a5d1:fcb0:1707::64"));
+    EXPECT_THAT(wpan_addrs, ::testing::Not(::testing::Contains("fd76:a5d1:fcb0:1707::63")));
+
+    netif.UpdateIp6UnicastAddresses({});
+    wpan_addrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpan_addrs.size(), 0);
+
+    netif.Deinit();
+}
+
 TEST(Netif, WpanIfHasCorrectMulticastAddresses_AfterUpdatingMulticastAddresses)
 {
     const char *wpan = "wpan0";
@@ -528,11 +595,13 @@ TEST(Netif, WpanIfSendIp6PacketCorrectly_AfterReceivingOnIf)
     std::string receivedPayload;
     const char *hello = "Hello Otbr Netif!";
 
-    auto Ip6SendTestImpl = [&received, &receivedPayload](const uint8_t *aData, uint16_t aLength) {
-        const ip6_hdr *ipv6_header = reinterpret_cast<const ip6_hdr *>(aData);
+    auto Ip6SendTestImpl = [&received, &receivedPayload](otbr::FrameBuffer &aFrame) {
+        const uint8_t *data        = aFrame.GetData();
+        uint16_t       length      = aFrame.GetLength();
+        const ip6_hdr *ipv6_header = reinterpret_cast<const ip6_hdr *>(data);
         if (ipv6_header->ip6_nxt == IPPROTO_UDP)
         {
-            const uint8_t *udpPayload    = aData + aLength - ntohs(ipv6_header->ip6_plen) + sizeof(udphdr);
+            const uint8_t *udpPayload    = data + length - ntohs(ipv6_header->ip6_plen) + sizeof(udphdr);
             uint16_t       udpPayloadLen = ntohs(ipv6_header->ip6_plen) - sizeof(udphdr);
             receivedPayload              = std::string(reinterpret_cast<const char *>(udpPayload), udpPayloadLen);
 
@@ -603,4 +672,187 @@ TEST(Netif, WpanIfSendIp6PacketCorrectly_AfterReceivingOnIf)
 
     netif.Deinit();
 }
+TEST(Netif, WpanIfSendsBatchOfIp6Packets_AfterReceivingOnIf)
+{
+    static constexpr int kPacketCount = 8;
+
+    int         receivedCount = 0;
+    const char *hello         = "Hello Otbr Netif!";
+
+    auto Ip6SendTestImpl = [&receivedCount](otbr::FrameBuffer &aFrame) {
+        const ip6_hdr *ipv6_header = reinterpret_cast<const ip6_hdr *>(aFrame.GetData());
+
+        // The lower layer may prepend its headers in place.
+        EXPECT_GE(aFrame.GetHeadroom(), otbr::Netif::kIp6SendHeadroom);
+
+        if (ipv6_header->ip6_nxt == IPPROTO_UDP)
+        {
+            receivedCount++;
+        }
+
+        return OTBR_ERROR_NONE;
+    };
+
+    otbr::Netif netif;
+    EXPECT_EQ(netif.Init("wpan0", Ip6SendTestImpl), OT_ERROR_NONE);
+
+    // OMR Prefix: fd76:a5d1:fcb0:1707::/64
+    const otIp6Address kOmr = {
+        {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0xf3, 0xc7, 0xd8, 0x8c, 0xef, 0xd1, 0x24, 0xa9}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    // Queue several UDP packets on the TUN device before running the mainloop.
+    {
+        int                 sockFd;
+        const uint16_t      destPort = 12345;
+        struct sockaddr_in6 destAddr;
+        const char         *destIp = "fd76:a5d1:fcb0:1707:3f1:47ce:85d3:77f";
+
+        if ((sockFd = socket(AF_INET6, SOCK_DGRAM, 0)) < 0)
+        {
+            perror("socket creation failed");
+            exit(EXIT_FAILURE);
+        }
+
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin6_family = AF_INET6;
+        destAddr.sin6_port   = htons(destPort);
+        inet_pton(AF_INET6, destIp, &(destAddr.sin6_addr));
+
+        for (int i = 0; i < kPacketCount; i++)
+        {
+            if (sendto(sockFd, hello, strlen(hello), MSG_CONFIRM, (const struct sockaddr *)&destAddr,
+                       sizeof(destAddr)) < 0)
+            {
+                FAIL() << "Failed to send UDP packet through WPAN interface";
+            }
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    while (receivedCount < kPacketCount)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {100, 0};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        netif.UpdateFdSet(&context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        netif.Process(&context);
+    }
+
+    EXPECT_EQ(receivedCount, kPacketCount);
+    EXPECT_GE(netif.GetCounters().mTxPackets, static_cast<uint64_t>(kPacketCount));
+    EXPECT_GE(netif.GetCounters().mTxBytes, static_cast<uint64_t>(kPacketCount * strlen(hello)));
+    EXPECT_EQ(netif.GetCounters().mTxDrops, 0u);
+
+    netif.Deinit();
+}
+
+#if OTBR_ENABLE_NETIF_MULTICAST_FILTER
+TEST(Netif, WpanIfFiltersMulticastGroupsNotJoinedByHost)
+{
+    uint8_t packet[sizeof(ip6_hdr) + sizeof(udphdr)] = {};
+    auto   *header                                  = reinterpret_cast<ip6_hdr *>(packet);
+
+    otbr::Netif netif;
+    EXPECT_EQ(netif.Init("wpan0", Ip6SendEmptyImpl), OTBR_ERROR_NONE);
+    netif.SetNetifState(true);
+
+    header->ip6_vfc  = 0x60;
+    header->ip6_nxt  = IPPROTO_UDP;
+    header->ip6_plen = htons(sizeof(udphdr));
+    inet_pton(AF_INET6, "fe80::1", &header->ip6_src);
+
+    // The link-local all nodes group is always joined.
+    inet_pton(AF_INET6, "ff02::1", &header->ip6_dst);
+    netif.Ip6Receive(packet, sizeof(packet));
+    EXPECT_EQ(netif.GetCounters().mRxFiltered, 0u);
+
+    inet_pton(AF_INET6, "ff05::1234", &header->ip6_dst);
+    netif.Ip6Receive(packet, sizeof(packet));
+    EXPECT_EQ(netif.GetCounters().mRxFiltered, 1u);
+
+    // The groups joined by the netif are the same as those of the Thread network.
+    {
+        otbr::Ip6Address group;
+
+        inet_pton(AF_INET6, "ff05::1234", group.m8);
+        EXPECT_EQ(netif.UpdateIp6MulticastAddresses({group}), OTBR_ERROR_NONE);
+    }
+
+    otbr::MainloopContext context;
+    context.mMaxFd   = -1;
+    context.mTimeout = {0, 0};
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    netif.UpdateFdSet(&context);
+    EXPECT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                     &context.mTimeout),
+              0);
+    netif.Process(&context);
+
+    netif.Ip6Receive(packet, sizeof(packet));
+    EXPECT_EQ(netif.GetCounters().mRxFiltered, 1u);
+
+    netif.Deinit();
+}
+#endif // OTBR_ENABLE_NETIF_MULTICAST_FILTER
 #endif // __linux__
+
+TEST(Netif, ClassifiesIp6PacketsByDscpAndProtocol)
+{
+    uint8_t packet[sizeof(ip6_hdr) + 8 + 8] = {};
+    auto   *header                          = reinterpret_cast<ip6_hdr *>(packet);
+
+    header->ip6_vfc  = 0x60;
+    header->ip6_nxt  = IPPROTO_UDP;
+    packet[40 + 2]   = 0x30; // UDP destination port 12345
+    packet[40 + 3]   = 0x39;
+    header->ip6_plen = htons(8);
+
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, 48), otbr::Netif::kEgressClassDefault);
+
+    // DSCP CS1
+    packet[0] = 0x62;
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, 48), otbr::Netif::kEgressClassBulk);
+
+    // DSCP CS6
+    packet[0] = 0x6c;
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, 48), otbr::Netif::kEgressClassControl);
+
+    // DNS
+    packet[0]      = 0x60;
+    packet[40 + 2] = 0;
+    packet[40 + 3] = 53;
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, 48), otbr::Netif::kEgressClassControl);
+
+    // Echo request
+    header->ip6_nxt = IPPROTO_ICMPV6;
+    packet[40]      = 128;
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, 48), otbr::Netif::kEgressClassDefault);
+
+    // MLDv2 report after a Hop-by-Hop Options header
+    header->ip6_nxt = IPPROTO_HOPOPTS;
+    packet[40]      = IPPROTO_ICMPV6;
+    packet[41]      = 0;
+    packet[48]      = 143;
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, sizeof(packet)), otbr::Netif::kEgressClassControl);
+
+    // Truncated packet
+    EXPECT_EQ(otbr::Netif::ClassifyIp6Packet(packet, 20), otbr::Netif::kEgressClassDefault);
+}
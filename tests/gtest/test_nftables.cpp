@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <vector>
+
+#include <netinet/in.h>
+#include <string.h>
+
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netfilter_ipv6.h>
+#include <linux/netlink.h>
+
+#include <gtest/gtest.h>
+
+#include "utils/nftables.hpp"
+
+namespace {
+
+std::vector<nlmsghdr> ParseMessages(const uint8_t *aData, size_t aLength)
+{
+    std::vector<nlmsghdr> messages;
+
+    for (size_t offset = 0; offset + sizeof(nlmsghdr) <= aLength;)
+    {
+        nlmsghdr header;
+
+        memcpy(&header, aData + offset, sizeof(header));
+        EXPECT_EQ(header.nlmsg_len % NLMSG_ALIGNTO, 0u);
+        EXPECT_LE(offset + header.nlmsg_len, aLength);
+        messages.push_back(header);
+        offset += header.nlmsg_len;
+    }
+
+    return messages;
+}
+
+uint16_t NftType(uint16_t aMessage)
+{
+    return static_cast<uint16_t>((NFNL_SUBSYS_NFTABLES << 8) | aMessage);
+}
+
+} // namespace
+
+TEST(Nftables, BatchFraming)
+{
+    otbr::Nftables::Batch batch;
+    otbr::Ip6Prefix       prefix("fd00:7d03:7d03:7d03::", 64);
+    uint8_t               protocol = 58;
+
+    batch.AddTable(NFPROTO_IPV6, "otbr");
+    batch.DeleteTable(NFPROTO_IPV6, "otbr");
+    batch.AddTable(NFPROTO_IPV6, "otbr");
+    batch.AddBaseChain(NFPROTO_IPV6, "otbr", "prerouting", NF_INET_PRE_ROUTING, NF_IP6_PRI_RAW);
+    batch.BeginRule(NFPROTO_IPV6, "otbr", "prerouting");
+    batch.AddMetaLoad(NFT_META_L4PROTO);
+    batch.AddCompare(&protocol, sizeof(protocol));
+    batch.AddIp6PrefixMatch(prefix, /* aIsDestination */ true);
+    batch.AddQueue(88, /* aBypass */ true);
+    batch.EndRule();
+    EXPECT_EQ(batch.GetRequestCount(), 5u);
+
+    const uint8_t *data = batch.Finish();
+    batch.SetSequence(100);
+
+    std::vector<nlmsghdr> messages = ParseMessages(data, batch.GetLength());
+
+    ASSERT_EQ(messages.size(), 7u);
+    EXPECT_EQ(messages.front().nlmsg_type, NFNL_MSG_BATCH_BEGIN);
+    EXPECT_EQ(messages.back().nlmsg_type, NFNL_MSG_BATCH_END);
+    EXPECT_EQ(messages[1].nlmsg_type, NftType(NFT_MSG_NEWTABLE));
+    EXPECT_EQ(messages[2].nlmsg_type, NftType(NFT_MSG_DELTABLE));
+    EXPECT_EQ(messages[4].nlmsg_type, NftType(NFT_MSG_NEWCHAIN));
+    EXPECT_EQ(messages[5].nlmsg_type, NftType(NFT_MSG_NEWRULE));
+
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        bool isRequest = (i != 0 && i != messages.size() - 1);
+
+        EXPECT_EQ(messages[i].nlmsg_seq, 100 + i);
+        EXPECT_EQ((messages[i].nlmsg_flags & NLM_F_ACK) != 0, isRequest);
+    }
+}
+
+TEST(Nftables, PrefixMatch)
+{
+    otbr::Nftables::Batch aligned;
+    otbr::Nftables::Batch unaligned;
+    otbr::Nftables::Batch any;
+
+    aligned.BeginRule(NFPROTO_IPV6, "otbr", "forward");
+    aligned.AddIp6PrefixMatch(otbr::Ip6Prefix("fd00:1::", 64), /* aIsDestination */ false);
+    aligned.EndRule();
+
+    unaligned.BeginRule(NFPROTO_IPV6, "otbr", "forward");
+    unaligned.AddIp6PrefixMatch(otbr::Ip6Prefix("fd00:1::", 60), /* aIsDestination */ false);
+    unaligned.EndRule();
+
+    any.BeginRule(NFPROTO_IPV6, "otbr", "forward");
+    any.AddIp6PrefixMatch(otbr::Ip6Prefix("::", 0), /* aIsDestination */ false);
+    any.EndRule();
+
+    std::string alignedRule(reinterpret_cast<const char *>(aligned.Finish()), aligned.GetLength());
+    std::string unalignedRule(reinterpret_cast<const char *>(unaligned.Finish()), unaligned.GetLength());
+    std::string anyRule(reinterpret_cast<const char *>(any.Finish()), any.GetLength());
+
+    // Only prefixes which are not byte-aligned need masking, a zero-length prefix matches without any expression.
+    EXPECT_NE(alignedRule.find("payload"), std::string::npos);
+    EXPECT_EQ(alignedRule.find("bitwise"), std::string::npos);
+    EXPECT_NE(unalignedRule.find("bitwise"), std::string::npos);
+    EXPECT_EQ(anyRule.find("payload"), std::string::npos);
+}
+
+TEST(Nftables, PrefixInterval)
+{
+    otbr::Nftables::Batch batch;
+    otbr::Nftables::Batch last;
+    otbr::Ip6Address      end("fd00:0:0:1::");
+
+    batch.BeginSetElements(NFPROTO_IPV6, "otbr", "prefixes", /* aIsAdded */ true);
+    batch.AddIp6PrefixInterval(otbr::Ip6Prefix("fd00::1", 64));
+    batch.EndSetElements();
+
+    last.BeginSetElements(NFPROTO_IPV6, "otbr", "prefixes", /* aIsAdded */ true);
+    last.AddIp6PrefixInterval(otbr::Ip6Prefix("ffff::", 16));
+    last.EndSetElements();
+
+    std::string elements(reinterpret_cast<const char *>(batch.Finish()), batch.GetLength());
+    std::string lastElements(reinterpret_cast<const char *>(last.Finish()), last.GetLength());
+
+    // The interval ends right after the prefix, except for the prefix including the last address.
+    EXPECT_NE(elements.find(std::string(reinterpret_cast<const char *>(end.m8), sizeof(end.m8))), std::string::npos);
+    EXPECT_LT(lastElements.size(), elements.size());
+}
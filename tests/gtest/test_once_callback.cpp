@@ -28,8 +28,46 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+
 #include "common/callback.hpp"
 
+namespace {
+
+// Counts the heap allocations of the callables themselves, since the global allocator is counted by other tests.
+template <size_t kSize> struct CountedCallable
+{
+    static void *operator new(size_t aSize)
+    {
+        sAllocationCount++;
+        return ::operator new(aSize);
+    }
+
+    static void operator delete(void *aPtr)
+    {
+        sFreeCount++;
+        ::operator delete(aPtr);
+    }
+
+    int operator()(int aValue) { return aValue + mPadding[0]; }
+
+    char mPadding[kSize];
+
+    static size_t sAllocationCount;
+    static size_t sFreeCount;
+};
+
+template <size_t kSize> size_t CountedCallable<kSize>::sAllocationCount = 0;
+template <size_t kSize> size_t CountedCallable<kSize>::sFreeCount       = 0;
+
+using SmallCallable = CountedCallable<32>;
+using LargeCallable = CountedCallable<OTBR_ONCE_CALLBACK_INLINE_SIZE + 1>;
+
+} // namespace
+
 TEST(IsNull, NullptrIsNull)
 {
     otbr::OnceCallback<void(void)> noop = nullptr;
@@ -61,3 +99,92 @@ TEST(VerifyInvocation, CallbackResultIsExpected)
 
     EXPECT_EQ(ret, 25);
 }
+
+TEST(IsNull, EmptyStdFunctionIsNull)
+{
+    otbr::OnceCallback<void(void)> noop = std::function<void(void)>();
+
+    EXPECT_TRUE(noop.IsNull());
+}
+
+TEST(Allocation, SmallCallableIsStoredInline)
+{
+    SmallCallable callable = {};
+
+    static_assert(otbr::OnceCallback<int(int)>::IsStoredInline<SmallCallable>(), "must be stored inline");
+
+    callable.mPadding[0] = 1;
+
+    {
+        otbr::OnceCallback<int(int)> callback = callable;
+        otbr::OnceCallback<int(int)> moved    = std::move(callback);
+
+        EXPECT_TRUE(callback.IsNull());
+        EXPECT_EQ(std::move(moved)(5), 6);
+    }
+
+    EXPECT_EQ(SmallCallable::sAllocationCount, 0u);
+    EXPECT_EQ(SmallCallable::sFreeCount, 0u);
+}
+
+TEST(Allocation, LargeCallableFallsBackToHeap)
+{
+    LargeCallable callable = {};
+
+    static_assert(!otbr::OnceCallback<int(int)>::IsStoredInline<LargeCallable>(), "must be stored on heap");
+
+    {
+        otbr::OnceCallback<int(int)> callback = callable;
+        otbr::OnceCallback<int(int)> moved    = std::move(callback);
+
+        // Moving the callback moves the pointer to the callable, without allocating again.
+        EXPECT_EQ(LargeCallable::sAllocationCount, 1u);
+        EXPECT_EQ(std::move(moved)(5), 5);
+        EXPECT_EQ(LargeCallable::sFreeCount, 1u);
+    }
+
+    EXPECT_EQ(LargeCallable::sAllocationCount, 1u);
+    EXPECT_EQ(LargeCallable::sFreeCount, 1u);
+}
+
+TEST(Allocation, TypicalCapturesAreStoredInline)
+{
+    auto capturesPointers = [](void) {
+        int  *a = nullptr;
+        void *b = nullptr;
+        auto  f = [a, b](int x) { return x + (a == b); };
+
+        return otbr::OnceCallback<int(int)>::IsStoredInline<decltype(f)>();
+    };
+    auto capturesSharedPointer = [](void) {
+        std::shared_ptr<int> a;
+        auto                 f = [a](int x) { return x + (a == nullptr); };
+
+        return otbr::OnceCallback<int(int)>::IsStoredInline<decltype(f)>();
+    };
+
+    EXPECT_TRUE(capturesPointers());
+    EXPECT_TRUE(capturesSharedPointer());
+}
+
+TEST(VerifyInvocation, MoveOnlyCallableIsInvoked)
+{
+    std::unique_ptr<int> value(new int(3));
+    int                  result = 0;
+
+    // A move-only callable, which `std::function` can't hold.
+    struct MoveOnly
+    {
+        void operator()(int aFactor) { *mResult = *mValue * aFactor; }
+
+        std::unique_ptr<int> mValue;
+        int                 *mResult;
+    };
+
+    otbr::OnceCallback<void(int)> callback = MoveOnly{std::move(value), &result};
+
+    std::move(callback)(4);
+
+    EXPECT_EQ(result, 12);
+    EXPECT_TRUE(callback.IsNull());
+}
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "common/open_hash_set.hpp"
+
+namespace {
+
+// Puts all the keys in a few probe sequences to exercise collisions.
+struct CollidingHash
+{
+    size_t operator()(int aKey) const { return static_cast<size_t>(aKey % 3); }
+};
+
+} // namespace
+
+TEST(OpenHashSet, TestInsertEraseContains)
+{
+    otbr::OpenHashSet<int> set;
+
+    EXPECT_TRUE(set.IsEmpty());
+    EXPECT_FALSE(set.Contains(1));
+    EXPECT_FALSE(set.Erase(1));
+
+    EXPECT_TRUE(set.Insert(1));
+    EXPECT_FALSE(set.Insert(1));
+    EXPECT_TRUE(set.Insert(2));
+    EXPECT_EQ(set.GetSize(), 2u);
+    EXPECT_TRUE(set.Contains(1));
+    EXPECT_TRUE(set.Contains(2));
+    EXPECT_FALSE(set.Contains(3));
+
+    EXPECT_TRUE(set.Erase(1));
+    EXPECT_FALSE(set.Erase(1));
+    EXPECT_FALSE(set.Contains(1));
+    EXPECT_TRUE(set.Contains(2));
+    EXPECT_EQ(set.GetSize(), 1u);
+
+    set.Clear();
+    EXPECT_TRUE(set.IsEmpty());
+    EXPECT_FALSE(set.Contains(2));
+    EXPECT_TRUE(set.begin() == set.end());
+}
+
+TEST(OpenHashSet, TestCollisionsAndGrowth)
+{
+    otbr::OpenHashSet<int, CollidingHash> set;
+    std::set<int>                         keys;
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(set.Insert(i));
+        keys.insert(i);
+    }
+
+    // Erasing from the middle of the probe sequences must keep the following keys reachable.
+    for (int i = 0; i < 100; i += 2)
+    {
+        EXPECT_TRUE(set.Erase(i));
+        keys.erase(i);
+    }
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(set.Contains(i), keys.count(i) == 1) << i;
+    }
+
+    EXPECT_EQ(set.GetSize(), keys.size());
+}
+
+TEST(OpenHashSet, TestIterate)
+{
+    otbr::OpenHashSet<int> set;
+    std::set<int>          iterated;
+
+    for (int i = 0; i < 40; i++)
+    {
+        set.Insert(i * 7);
+    }
+
+    for (int key : set)
+    {
+        EXPECT_TRUE(iterated.insert(key).second);
+        EXPECT_TRUE(set.Contains(key));
+    }
+
+    EXPECT_EQ(iterated.size(), 40u);
+}
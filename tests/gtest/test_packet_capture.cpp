@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <stdint.h>
+
+#include <gtest/gtest.h>
+
+#include "utils/packet_capture.hpp"
+
+using otbr::Utils::PacketCapture;
+
+namespace {
+
+uint32_t ReadUint32(const std::vector<uint8_t> &aData, size_t aOffset)
+{
+    return static_cast<uint32_t>(aData[aOffset]) | (static_cast<uint32_t>(aData[aOffset + 1]) << 8) |
+           (static_cast<uint32_t>(aData[aOffset + 2]) << 16) | (static_cast<uint32_t>(aData[aOffset + 3]) << 24);
+}
+
+// Returns the offsets of the blocks of a pcapng section, after checking their lengths.
+std::vector<size_t> SplitBlocks(const std::vector<uint8_t> &aData)
+{
+    std::vector<size_t> blocks;
+    size_t              offset = 0;
+
+    while (offset < aData.size())
+    {
+        uint32_t length = ReadUint32(aData, offset + 4);
+
+        EXPECT_EQ(length % 4, 0u);
+        EXPECT_LE(offset + length, aData.size());
+        EXPECT_EQ(ReadUint32(aData, offset + length - 4), length);
+        blocks.push_back(offset);
+        offset += length;
+    }
+
+    return blocks;
+}
+
+} // namespace
+
+TEST(PacketCapture, TestEmptyCapture)
+{
+    PacketCapture        capture;
+    std::vector<uint8_t> pcapng;
+    std::vector<size_t>  blocks;
+
+    capture.WritePcapng(pcapng);
+    blocks = SplitBlocks(pcapng);
+
+    ASSERT_EQ(blocks.size(), 3u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[0]), 0x0a0d0d0au);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[0] + 8), 0x1a2b3c4du);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[1]), 1u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[1] + 8) & 0xffff, 229u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[2]), 1u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[2] + 8) & 0xffff, 147u);
+}
+
+TEST(PacketCapture, TestCapturePackets)
+{
+    PacketCapture        capture;
+    std::vector<uint8_t> pcapng;
+    std::vector<size_t>  blocks;
+    const uint8_t        datagram[] = {0x60, 0x00, 0x00, 0x00, 0x00};
+    const uint8_t        frame[]    = {0x81, 0x03, 0x72};
+
+    capture.Capture(PacketCapture::kInterfaceThread, PacketCapture::kDirectionOutbound, datagram, sizeof(datagram),
+                    0x100000002ull);
+    capture.Capture(PacketCapture::kInterfaceSpinel, PacketCapture::kDirectionInbound, frame, sizeof(frame), 3);
+    EXPECT_EQ(capture.GetNumPackets(), 2u);
+
+    capture.WritePcapng(pcapng);
+    blocks = SplitBlocks(pcapng);
+    ASSERT_EQ(blocks.size(), 5u);
+
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3]), 6u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 8), 0u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 12), 1u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 16), 2u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 20), sizeof(datagram));
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 24), sizeof(datagram));
+    EXPECT_EQ(pcapng[blocks[3] + 28], 0x60);
+    // The datagram is padded to 8 bytes and followed by the `epb_flags` option.
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 36), 0x00040002u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 40), PacketCapture::kDirectionOutbound);
+
+    EXPECT_EQ(ReadUint32(pcapng, blocks[4] + 8), 1u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[4] + 16), 3u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[4] + 36), PacketCapture::kDirectionInbound);
+
+    capture.Clear();
+    capture.WritePcapng(pcapng);
+    EXPECT_EQ(SplitBlocks(pcapng).size(), 3u);
+}
+
+TEST(PacketCapture, TestOverwriteOldestAndTruncate)
+{
+    PacketCapture        capture;
+    std::vector<uint8_t> pcapng;
+    std::vector<size_t>  blocks;
+    std::vector<uint8_t> packet(PacketCapture::kSnapLength + 100, 0xab);
+
+    for (uint32_t i = 0; i < PacketCapture::kNumPackets + 2u; i++)
+    {
+        capture.Capture(PacketCapture::kInterfaceThread, PacketCapture::kDirectionInbound, packet.data(),
+                        static_cast<uint16_t>(packet.size()), i);
+    }
+
+    EXPECT_EQ(capture.GetNumPackets(), PacketCapture::kNumPackets);
+    EXPECT_EQ(capture.GetNumOverwritten(), 2u);
+
+    capture.WritePcapng(pcapng);
+    blocks = SplitBlocks(pcapng);
+    ASSERT_EQ(blocks.size(), 3u + PacketCapture::kNumPackets);
+
+    // The two oldest packets are overwritten, and the packets are written from the oldest.
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 16), 2u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks.back() + 16), PacketCapture::kNumPackets + 1u);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 20), PacketCapture::kSnapLength);
+    EXPECT_EQ(ReadUint32(pcapng, blocks[3] + 24), packet.size());
+}
@@ -26,12 +26,14 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 using ::testing::ElementsAreArray;
+using ::testing::Not;
 
 #include "utils/pskc.hpp"
 
@@ -63,3 +65,46 @@ TEST(Pskc, Test_TruncatedNetworkNamePskc_OpenThread)
 
     EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
 }
+
+TEST(Pskc, Test0123456789abcdef_1122334455667788_OpenThread)
+{
+    otbr::Psk::Pskc pskc;
+
+    // A passphrase of 16 bytes is used as the key of AES-CMAC-PRF-128 directly.
+    uint8_t extpanid[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    uint8_t expected[] = {
+        0xba, 0x78, 0xf2, 0x87, 0xbc, 0xec, 0x42, 0x3a, 0xd3, 0x6b, 0xad, 0xff, 0xd5, 0x11, 0x1f, 0x24,
+    };
+
+    const uint8_t *actual = pskc.ComputePskc(extpanid, "OpenThread", "0123456789abcdef");
+    EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
+}
+
+TEST(Pskc, Test_CachedPskc)
+{
+    otbr::Psk::Pskc pskc;
+    uint8_t         extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t         expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    const uint8_t  *actual;
+
+    actual = pskc.ComputePskc(extpanid, "OpenThread", "123456");
+    EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
+
+    // The result is the same whether it is cached or not, while other passphrases fill up the cache.
+    for (uint8_t i = 0; i <= OTBR_PSKC_CACHE_SIZE; i++)
+    {
+        std::string passphrase = "123456" + std::to_string(i);
+
+        actual = pskc.ComputePskc(extpanid, "OpenThread", passphrase.c_str());
+        EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), Not(ElementsAreArray(expected)));
+
+        actual = pskc.ComputePskc(extpanid, "OpenThread", "123456");
+        EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
+    }
+
+    extpanid[7] = 0x08;
+    actual      = pskc.ComputePskc(extpanid, "OpenThread", "123456");
+    EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), Not(ElementsAreArray(expected)));
+}
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include "utils/radio_coex_sampler.hpp"
+
+using otbr::Milliseconds;
+using otbr::agent::RadioCoexHistory;
+
+static otRadioCoexMetrics MakeMetrics(uint32_t aNumTxRequest, uint32_t aNumRxRequest)
+{
+    otRadioCoexMetrics metrics;
+
+    memset(&metrics, 0, sizeof(metrics));
+    metrics.mNumTxRequest = aNumTxRequest;
+    metrics.mNumRxRequest = aNumRxRequest;
+
+    return metrics;
+}
+
+TEST(RadioCoexHistory, FirstMetricsOnlySetTheBase)
+{
+    RadioCoexHistory history;
+
+    EXPECT_FALSE(history.HasMetrics());
+
+    history.AddMetrics(MakeMetrics(100, 50), Milliseconds(0));
+
+    EXPECT_TRUE(history.HasMetrics());
+    EXPECT_EQ(history.GetMetrics().mNumTxRequest, 100u);
+    EXPECT_EQ(history.GetIntervalCount(), 0);
+    EXPECT_EQ(history.GetIncrement(RadioCoexHistory::kTxRequest), 0u);
+    EXPECT_EQ(history.GetRatePerMinute(RadioCoexHistory::kTxRequest), 0u);
+}
+
+TEST(RadioCoexHistory, IncrementsAndRates)
+{
+    RadioCoexHistory history;
+
+    history.AddMetrics(MakeMetrics(100, 50), Milliseconds(0));
+    history.AddMetrics(MakeMetrics(130, 50), Milliseconds(30000));
+    history.AddMetrics(MakeMetrics(190, 65), Milliseconds(30000));
+
+    EXPECT_EQ(history.GetIntervalCount(), 2);
+    EXPECT_EQ(history.GetDuration(), Milliseconds(60000));
+    EXPECT_EQ(history.GetIncrement(RadioCoexHistory::kTxRequest), 90u);
+    EXPECT_EQ(history.GetLatestIncrement(RadioCoexHistory::kTxRequest), 60u);
+    EXPECT_EQ(history.GetRatePerMinute(RadioCoexHistory::kTxRequest), 90u);
+    EXPECT_EQ(history.GetRatePerMinute(RadioCoexHistory::kRxRequest), 15u);
+}
+
+TEST(RadioCoexHistory, ResetCountersAreNewIncrements)
+{
+    RadioCoexHistory history;
+
+    history.AddMetrics(MakeMetrics(100, 50), Milliseconds(0));
+    history.AddMetrics(MakeMetrics(10, 60), Milliseconds(30000));
+
+    EXPECT_EQ(history.GetLatestIncrement(RadioCoexHistory::kTxRequest), 10u);
+    EXPECT_EQ(history.GetLatestIncrement(RadioCoexHistory::kRxRequest), 60u);
+}
+
+TEST(RadioCoexHistory, OldestIntervalsAreReplaced)
+{
+    RadioCoexHistory history;
+    uint32_t         txRequests = 0;
+
+    history.AddMetrics(MakeMetrics(txRequests, 0), Milliseconds(0));
+
+    // The first intervals have 1000 requests each, the ones replacing them have 1.
+    for (uint16_t i = 0; i < RadioCoexHistory::kMaxIntervals; i++)
+    {
+        txRequests += 1000;
+        history.AddMetrics(MakeMetrics(txRequests, 0), Milliseconds(1000));
+    }
+    for (uint16_t i = 0; i < RadioCoexHistory::kMaxIntervals; i++)
+    {
+        txRequests += 1;
+        history.AddMetrics(MakeMetrics(txRequests, 0), Milliseconds(1000));
+    }
+
+    EXPECT_EQ(history.GetIntervalCount(), RadioCoexHistory::kMaxIntervals);
+    EXPECT_EQ(history.GetDuration(), Milliseconds(1000 * RadioCoexHistory::kMaxIntervals));
+    EXPECT_EQ(history.GetIncrement(RadioCoexHistory::kTxRequest),
+              static_cast<uint64_t>(RadioCoexHistory::kMaxIntervals));
+    EXPECT_EQ(history.GetRatePerMinute(RadioCoexHistory::kTxRequest), 60u);
+}
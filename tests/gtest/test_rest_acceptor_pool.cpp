@@ -0,0 +1,214 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop_manager.hpp"
+#include "rest/acceptor_pool.hpp"
+
+using otbr::rest::AcceptorPool;
+using otbr::rest::HttpMethod;
+using otbr::rest::Request;
+using otbr::rest::Response;
+
+static void RunMainloopOnce(void)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 100000};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+    EXPECT_GE(otbr::MainloopManager::GetInstance().Poll(mainloop), 0);
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+}
+
+static int OpenListenFd(uint16_t &aPort)
+{
+    sockaddr_in6 address;
+    socklen_t    length = sizeof(address);
+    int          fd     = socket(AF_INET6, SOCK_STREAM | SOCK_NONBLOCK, 0);
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    address.sin6_addr   = in6addr_loopback;
+
+    EXPECT_NE(fd, -1);
+    EXPECT_EQ(bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+    EXPECT_EQ(listen(fd, 5), 0);
+    EXPECT_EQ(getsockname(fd, reinterpret_cast<sockaddr *>(&address), &length), 0);
+    aPort = ntohs(address.sin6_port);
+
+    return fd;
+}
+
+static int Connect(uint16_t aPort)
+{
+    sockaddr_in6 address;
+    timeval      timeout = {5, 0};
+    int          fd      = socket(AF_INET6, SOCK_STREAM, 0);
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    address.sin6_addr   = in6addr_loopback;
+    address.sin6_port   = htons(aPort);
+
+    EXPECT_EQ(connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+    EXPECT_EQ(setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)), 0);
+
+    return fd;
+}
+
+static std::string ReadResponses(int aFd, size_t aNumResponses)
+{
+    std::string received;
+    size_t      numResponses = 0;
+    char        buf[1024];
+    ssize_t     length;
+
+    // Each response of the test handler ends with its body, which is the URL.
+    while (numResponses < aNumResponses && (length = read(aFd, buf, sizeof(buf))) > 0)
+    {
+        received.append(buf, static_cast<size_t>(length));
+        numResponses = 0;
+        for (size_t offset = received.find("\r\n\r\n/hit"); offset != std::string::npos;
+             offset        = received.find("\r\n\r\n/hit", offset + 1))
+        {
+            numResponses++;
+        }
+    }
+
+    return received;
+}
+
+static bool ServeHits(const std::string &aSource, const Request &aRequest, Response &aResponse)
+{
+    bool        served = aRequest.GetMethod() == HttpMethod::kGet && aRequest.GetUrl() == "/hit";
+    std::string code   = "200 OK";
+    std::string body   = aRequest.GetUrl();
+
+    EXPECT_EQ(aSource, "::1");
+
+    if (served)
+    {
+        aResponse.SetResponsCode(code);
+        aResponse.SetBody(body);
+    }
+
+    return served;
+}
+
+TEST(RestAcceptorPool, ServesPipelinedRequests)
+{
+    std::thread::id mainloopThread = std::this_thread::get_id();
+    AcceptorPool    pool(
+        [mainloopThread](const std::string &aSource, const Request &aRequest, Response &aResponse) {
+            EXPECT_NE(std::this_thread::get_id(), mainloopThread);
+            return ServeHits(aSource, aRequest, aResponse);
+        },
+        [](int aFd, const std::string &, const std::string &) {
+            ADD_FAILURE() << "Unexpected hand over";
+            close(aFd);
+        });
+    uint16_t    port;
+    int         fd;
+    std::string request  = "GET /hit HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    std::string requests = request + request;
+    std::string responses;
+
+    ASSERT_EQ(pool.Start({OpenListenFd(port)}), OTBR_ERROR_NONE);
+    EXPECT_TRUE(pool.IsRunning());
+    EXPECT_EQ(pool.Start({}), OTBR_ERROR_INVALID_STATE);
+
+    fd = Connect(port);
+    ASSERT_EQ(write(fd, requests.data(), requests.size()), static_cast<ssize_t>(requests.size()));
+    responses = ReadResponses(fd, 2);
+
+    EXPECT_EQ(responses.find("HTTP/1.1 200 OK"), 0u);
+    EXPECT_NE(responses.find("HTTP/1.1 200 OK", 1), std::string::npos);
+    EXPECT_NE(responses.find("Connection: keep-alive"), std::string::npos);
+    EXPECT_EQ(pool.GetServedCount(), 2u);
+    EXPECT_EQ(pool.GetHandedOverCount(), 0u);
+
+    close(fd);
+    pool.Stop();
+    EXPECT_FALSE(pool.IsRunning());
+}
+
+TEST(RestAcceptorPool, HandsOverOtherRequests)
+{
+    std::thread::id mainloopThread = std::this_thread::get_id();
+    std::string     handedOver;
+    int             handedOverFd = -1;
+    AcceptorPool    pool(ServeHits, [&](int aFd, const std::string &aSource, const std::string &aReceived) {
+        EXPECT_EQ(std::this_thread::get_id(), mainloopThread);
+        EXPECT_EQ(aSource, "::1");
+        handedOverFd = aFd;
+        handedOver   = aReceived;
+    });
+    uint16_t    port;
+    int         fd;
+    std::string put      = "PUT /state HTTP/1.1\r\nHost: localhost\r\nContent-Length: 6\r\n\r\n\"able\"";
+    std::string requests = "GET /hit HTTP/1.1\r\nHost: localhost\r\n\r\n" + put;
+
+    ASSERT_EQ(pool.Start({OpenListenFd(port)}), OTBR_ERROR_NONE);
+
+    fd = Connect(port);
+    ASSERT_EQ(write(fd, requests.data(), requests.size()), static_cast<ssize_t>(requests.size()));
+    EXPECT_EQ(ReadResponses(fd, 1).find("HTTP/1.1 200 OK"), 0u);
+
+    for (int i = 0; i < 50 && handedOverFd == -1; i++)
+    {
+        RunMainloopOnce();
+    }
+
+    // The connection is handed over from the start of the request which isn't answered.
+    EXPECT_NE(handedOverFd, -1);
+    EXPECT_EQ(handedOver, put);
+    EXPECT_EQ(pool.GetServedCount(), 1u);
+    EXPECT_EQ(pool.GetHandedOverCount(), 1u);
+
+    close(handedOverFd);
+    close(fd);
+}
@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "rest/admission_control.hpp"
+
+using otbr::rest::AdmissionControl;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+TEST(RestAdmissionControl, RejectsBurstAboveBucketSize)
+{
+    AdmissionControl         admission(10, 5);
+    steady_clock::time_point now = steady_clock::now();
+
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_TRUE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now));
+    }
+    EXPECT_FALSE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now));
+    EXPECT_EQ(admission.GetRejectedCount(), 1u);
+
+    // The tokens are refilled at the rate.
+    EXPECT_TRUE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now + milliseconds(100)));
+    EXPECT_FALSE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now + milliseconds(100)));
+}
+
+TEST(RestAdmissionControl, AdmitsWritesAndOtherSourcesApart)
+{
+    AdmissionControl         admission(1, 2);
+    steady_clock::time_point now = steady_clock::now();
+
+    EXPECT_TRUE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now));
+    EXPECT_TRUE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now));
+    EXPECT_FALSE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now));
+
+    EXPECT_TRUE(admission.Admit("fd00::1", AdmissionControl::Priority::kWrite, now));
+    EXPECT_TRUE(admission.Admit("fd00::2", AdmissionControl::Priority::kBulk, now));
+}
+
+TEST(RestAdmissionControl, AdmitsAllWithZeroRate)
+{
+    AdmissionControl         admission(0, 1);
+    steady_clock::time_point now = steady_clock::now();
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(admission.Admit("fd00::1", AdmissionControl::Priority::kBulk, now));
+    }
+    EXPECT_EQ(admission.GetRejectedCount(), 0u);
+}
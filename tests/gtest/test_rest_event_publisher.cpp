@@ -0,0 +1,75 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "rest/event_publisher.hpp"
+
+using otbr::rest::EventPublisher;
+using otbr::rest::EventSubscriber;
+
+TEST(RestEventPublisher, FormatsMultiLineData)
+{
+    EXPECT_EQ(EventPublisher::FormatEvent(0, "role", "\"leader\""), "event: role\ndata: \"leader\"\n\n");
+    EXPECT_EQ(EventPublisher::FormatEvent(7, "diagnostic", "{\n\t\"Rloc16\":\t1024\n}"),
+              "id: 7\nevent: diagnostic\ndata: {\ndata: \t\"Rloc16\":\t1024\ndata: }\n\n");
+}
+
+TEST(RestEventPublisher, NotifiesAndDropsOldestEvents)
+{
+    EventPublisher  publisher;
+    EventSubscriber subscriber(2);
+    int             notifications = 0;
+    std::string     output;
+
+    subscriber.SetEventsAvailableCallback([&notifications]() { notifications++; });
+
+    publisher.Publish("role", "\"child\"");
+    EXPECT_FALSE(subscriber.HasPendingEvents());
+
+    publisher.Subscribe(subscriber);
+    publisher.Publish("role", "\"router\"");
+    publisher.Publish("role", "\"leader\"");
+    publisher.Publish("dataset", "\"active\"");
+
+    EXPECT_EQ(notifications, 1);
+    EXPECT_EQ(subscriber.GetDropCount(), 1u);
+
+    subscriber.TakePendingEvents(output);
+    EXPECT_EQ(output, "event: dropped\ndata: 1\n\n"
+                      "id: 2\nevent: role\ndata: \"leader\"\n\n"
+                      "id: 3\nevent: dataset\ndata: \"active\"\n\n");
+    EXPECT_FALSE(subscriber.HasPendingEvents());
+
+    publisher.Unsubscribe(subscriber);
+    publisher.Publish("role", "\"disabled\"");
+    EXPECT_FALSE(subscriber.HasPendingEvents());
+    EXPECT_EQ(notifications, 1);
+}
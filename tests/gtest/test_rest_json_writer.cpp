@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "rest/json_writer.hpp"
+
+using otbr::rest::JsonWriter;
+
+TEST(JsonWriter, WritesScalars)
+{
+    std::string output;
+
+    JsonWriter(output).Number(42);
+    EXPECT_EQ(output, "42");
+
+    output.clear();
+    JsonWriter(output).Number(4294967295.0);
+    EXPECT_EQ(output, "4294967295");
+
+    output.clear();
+    JsonWriter(output).Number(0.1);
+    EXPECT_EQ(output, "0.1");
+
+    output.clear();
+    JsonWriter(output).String("a\"b\\c\n\x01");
+    EXPECT_EQ(output, "\"a\\\"b\\\\c\\n\\u0001\"");
+
+    output.clear();
+    const uint8_t bytes[] = {0xde, 0xad, 0x01};
+    JsonWriter(output).HexString(bytes, sizeof(bytes));
+    EXPECT_EQ(output, "\"DEAD01\"");
+}
+
+TEST(JsonWriter, FormatsLikeCJsonPrint)
+{
+    std::string output;
+    JsonWriter  writer(output);
+
+    writer.BeginArray();
+    writer.BeginObject();
+    writer.AddString("Name", "node");
+    writer.AddBool("Enabled", true);
+    writer.Key("Empty");
+    writer.BeginObject();
+    writer.EndObject();
+    writer.Key("List");
+    writer.BeginArray();
+    writer.Number(1);
+    writer.Number(2);
+    writer.EndArray();
+    writer.EndObject();
+    writer.BeginObject();
+    writer.EndObject();
+    writer.EndArray();
+
+    EXPECT_EQ(output, "[{\n"
+                      "\t\t\"Name\":\t\"node\",\n"
+                      "\t\t\"Enabled\":\ttrue,\n"
+                      "\t\t\"Empty\":\t{\n"
+                      "\t\t},\n"
+                      "\t\t\"List\":\t[1, 2]\n"
+                      "\t}, {\n"
+                      "\t}]");
+}
+
+TEST(JsonWriter, FiltersFieldsOfOutermostObjects)
+{
+    std::string          output;
+    JsonWriter           writer(output);
+    JsonWriter::FieldSet fields = {"Name", "Nested"};
+
+    writer.SetFieldFilter(&fields);
+    writer.BeginArray();
+    writer.BeginObject();
+    writer.Key("List");
+    writer.BeginArray();
+    writer.BeginObject();
+    writer.AddNumber("Value", 1);
+    writer.EndObject();
+    writer.EndArray();
+    writer.AddString("Name", "node");
+    writer.AddBool("Enabled", true);
+    writer.Key("Nested");
+    writer.BeginObject();
+    writer.AddNumber("Value", 2);
+    writer.EndObject();
+    writer.EndObject();
+    writer.BeginObject();
+    writer.AddBool("Enabled", false);
+    writer.EndObject();
+    writer.EndArray();
+
+    EXPECT_EQ(output, "[{\n"
+                      "\t\t\"Name\":\t\"node\",\n"
+                      "\t\t\"Nested\":\t{\n"
+                      "\t\t\t\"Value\":\t2\n"
+                      "\t\t}\n"
+                      "\t}, {\n"
+                      "\t}]");
+}
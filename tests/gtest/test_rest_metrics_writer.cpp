@@ -0,0 +1,66 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "rest/metrics_writer.hpp"
+
+using otbr::rest::MetricsWriter;
+
+TEST(MetricsWriter, WritesCountersAndGauges)
+{
+    std::string   output;
+    MetricsWriter writer(output);
+
+    writer.AddCounter("otbr_rcp_timeouts", "The number of RCP timeouts.", 3);
+    writer.AddGauge("otbr_trel_peers", "The number of TREL peers.", 18446744073709551615ull);
+    writer.Finish();
+
+    EXPECT_EQ(output, "# TYPE otbr_rcp_timeouts counter\n"
+                      "# HELP otbr_rcp_timeouts The number of RCP timeouts.\n"
+                      "otbr_rcp_timeouts_total 3\n"
+                      "# TYPE otbr_trel_peers gauge\n"
+                      "# HELP otbr_trel_peers The number of TREL peers.\n"
+                      "otbr_trel_peers 18446744073709551615\n"
+                      "# EOF\n");
+}
+
+TEST(MetricsWriter, WritesLabelledSamples)
+{
+    std::string   output;
+    MetricsWriter writer(output);
+
+    writer.BeginFamily("otbr_dnssd_responses", MetricsWriter::Type::kCounter, "The DNS-SD responses.");
+    writer.AddSample("rcode=\"success\"", 5);
+    writer.AddSample("rcode=\"name_error\"", 0);
+
+    EXPECT_EQ(output, "# TYPE otbr_dnssd_responses counter\n"
+                      "# HELP otbr_dnssd_responses The DNS-SD responses.\n"
+                      "otbr_dnssd_responses_total{rcode=\"success\"} 5\n"
+                      "otbr_dnssd_responses_total{rcode=\"name_error\"} 0\n");
+}
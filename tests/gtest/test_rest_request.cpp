@@ -0,0 +1,93 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "rest/request.hpp"
+
+using otbr::rest::Request;
+
+static std::string Nest(size_t aDepth)
+{
+    return std::string(aDepth, '[') + std::string(aDepth, ']');
+}
+
+TEST(RestRequest, AcceptsBodyWithinLimits)
+{
+    Request     request;
+    std::string body = "{\"a\":[1,2,{\"b\":\"}]]]]]]]]]]\"}]}";
+
+    EXPECT_TRUE(request.SetBody(body.data(), 10));
+    EXPECT_TRUE(request.SetBody(body.data() + 10, body.size() - 10));
+    EXPECT_EQ(request.GetBody(), body);
+}
+
+TEST(RestRequest, RejectsTooDeepBody)
+{
+    Request     accepted;
+    Request     rejected;
+    std::string body = Nest(OTBR_REST_MAX_BODY_JSON_DEPTH + 1);
+
+    EXPECT_TRUE(accepted.SetBody(Nest(OTBR_REST_MAX_BODY_JSON_DEPTH).data(), OTBR_REST_MAX_BODY_JSON_DEPTH * 2));
+    EXPECT_FALSE(rejected.SetBody(body.data(), body.size()));
+}
+
+TEST(RestRequest, IgnoresBracketsInStrings)
+{
+    Request     request;
+    std::string body = "[\"\\\"" + std::string(OTBR_REST_MAX_BODY_JSON_DEPTH + 1, '[') + "\"]";
+
+    EXPECT_TRUE(request.SetBody(body.data(), body.size()));
+}
+
+TEST(RestRequest, RejectsTooManyValues)
+{
+    Request     request;
+    std::string body = "[";
+
+    for (size_t i = 0; i < OTBR_REST_MAX_BODY_JSON_VALUES; i++)
+    {
+        body += "0,";
+    }
+    body += "0]";
+
+    EXPECT_FALSE(request.SetBody(body.data(), body.size()));
+}
+
+TEST(RestRequest, RejectsTooLargeBody)
+{
+    Request     request;
+    std::string body(OTBR_REST_MAX_BODY_SIZE, ' ');
+
+    EXPECT_TRUE(Request::IsBodyLengthAllowed(OTBR_REST_MAX_BODY_SIZE));
+    EXPECT_FALSE(Request::IsBodyLengthAllowed(OTBR_REST_MAX_BODY_SIZE + 1));
+    EXPECT_TRUE(request.SetBody(body.data(), body.size()));
+    EXPECT_FALSE(request.SetBody(" ", 1));
+}
@@ -0,0 +1,155 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#if OTBR_ENABLE_REST_GZIP
+#include <zlib.h>
+#endif
+
+#include "rest/response.hpp"
+
+using otbr::rest::Response;
+
+static std::string Concatenate(const std::vector<struct iovec> &aBuffers)
+{
+    std::string output;
+
+    for (const struct iovec &buffer : aBuffers)
+    {
+        output.append(static_cast<const char *>(buffer.iov_base), buffer.iov_len);
+    }
+
+    return output;
+}
+
+TEST(RestResponse, SerializesWithContentLength)
+{
+    Response                  response;
+    std::vector<struct iovec> buffers;
+    std::string               code = "200 OK";
+    std::string               body = "{}";
+    std::string               output;
+
+    response.SetResponsCode(code);
+    response.SetBody(body);
+    response.Serialize(buffers);
+    output = Concatenate(buffers);
+
+    ASSERT_EQ(buffers.size(), 2u);
+    EXPECT_EQ(buffers[1].iov_base, response.GetBody().data());
+    EXPECT_EQ(output.compare(0, 17, "HTTP/1.1 200 OK\r\n"), 0);
+    EXPECT_NE(output.find("\r\nContent-Length: 2\r\n\r\n{}"), std::string::npos);
+}
+
+TEST(RestResponse, SerializesLargeBodyInChunks)
+{
+    Response                  response;
+    std::vector<struct iovec> buffers;
+    std::string               code = "200 OK";
+    std::string               body(20000, 'a');
+    std::string               output;
+    std::string               expected;
+
+    response.SetResponsCode(code);
+    response.SetBody(body);
+    response.SetChunkedEncodingAllowed(true);
+    response.Serialize(buffers);
+    output = Concatenate(buffers);
+
+    expected = "Transfer-Encoding: chunked\r\n\r\n";
+    for (int i = 0; i < 4; i++)
+    {
+        expected += "1000\r\n" + std::string(4096, 'a') + "\r\n";
+    }
+    expected += "e20\r\n" + std::string(3616, 'a') + "\r\n0\r\n\r\n";
+
+    EXPECT_EQ(output.find("Content-Length"), std::string::npos);
+    ASSERT_GE(output.size(), expected.size());
+    EXPECT_EQ(output.substr(output.size() - expected.size()), expected);
+}
+
+#if OTBR_ENABLE_REST_GZIP
+TEST(RestResponse, CompressesLargeBodyWithGzip)
+{
+    Response                  response;
+    std::vector<struct iovec> buffers;
+    std::string               code = "200 OK";
+    std::string               body(20000, 'a');
+    std::string               output;
+    std::string               compressed;
+    std::string               decompressed(body.size(), '\0');
+    z_stream                  stream = {};
+    size_t                    bodyStart;
+
+    response.SetResponsCode(code);
+    response.SetBody(body);
+    response.SetGzipAllowed(true);
+    response.Serialize(buffers);
+    output = Concatenate(buffers);
+
+    EXPECT_NE(output.find("\r\nContent-Encoding: gzip\r\n"), std::string::npos);
+    EXPECT_NE(output.find("\r\nVary: Accept-Encoding\r\n"), std::string::npos);
+    bodyStart = output.find("\r\n\r\n") + 4;
+    compressed = output.substr(bodyStart);
+    EXPECT_NE(output.find("\r\nContent-Length: " + std::to_string(compressed.size()) + "\r\n"), std::string::npos);
+    EXPECT_LT(compressed.size(), body.size());
+
+    ASSERT_EQ(inflateInit2(&stream, 15 + 16), Z_OK);
+    stream.next_in   = reinterpret_cast<Bytef *>(&compressed[0]);
+    stream.avail_in  = static_cast<uInt>(compressed.size());
+    stream.next_out  = reinterpret_cast<Bytef *>(&decompressed[0]);
+    stream.avail_out = static_cast<uInt>(decompressed.size());
+    EXPECT_EQ(inflate(&stream, Z_FINISH), Z_STREAM_END);
+    EXPECT_EQ(stream.total_out, body.size());
+    inflateEnd(&stream);
+
+    EXPECT_EQ(decompressed, body);
+}
+
+TEST(RestResponse, KeepsSmallBodyUncompressed)
+{
+    Response                  response;
+    std::vector<struct iovec> buffers;
+    std::string               code = "200 OK";
+    std::string               body = "{}";
+    std::string               output;
+
+    response.SetResponsCode(code);
+    response.SetBody(body);
+    response.SetGzipAllowed(true);
+    response.Serialize(buffers);
+    output = Concatenate(buffers);
+
+    EXPECT_EQ(output.find("Content-Encoding"), std::string::npos);
+    EXPECT_NE(output.find("\r\nContent-Length: 2\r\n\r\n{}"), std::string::npos);
+}
+#endif
@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop_manager.hpp"
+#include "rest/worker_pool.hpp"
+
+using otbr::rest::WorkerPool;
+
+static void RunMainloopOnce(void)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {1, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+    EXPECT_GE(otbr::MainloopManager::GetInstance().Poll(mainloop), 0);
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+}
+
+TEST(RestWorkerPool, RunsInlineWithoutThreads)
+{
+    WorkerPool pool(0);
+    int        steps = 0;
+
+    EXPECT_FALSE(pool.IsEnabled());
+
+    pool.Run([&steps]() { EXPECT_EQ(steps++, 0); }, [&steps]() { EXPECT_EQ(steps++, 1); });
+    EXPECT_EQ(steps, 2);
+}
+
+TEST(RestWorkerPool, RunsCompletionsOnMainloop)
+{
+    const int kNumJobs = 16;
+
+    WorkerPool       pool(2);
+    std::thread::id  mainloopThread = std::this_thread::get_id();
+    std::atomic<int> worked{0};
+    int              completed = 0;
+
+    EXPECT_TRUE(pool.IsEnabled());
+
+    for (int i = 0; i < kNumJobs; i++)
+    {
+        pool.Run(
+            [&worked, mainloopThread]() {
+                EXPECT_NE(std::this_thread::get_id(), mainloopThread);
+                ++worked;
+            },
+            [&completed, mainloopThread]() {
+                EXPECT_EQ(std::this_thread::get_id(), mainloopThread);
+                ++completed;
+            });
+    }
+
+    while (completed < kNumJobs)
+    {
+        RunMainloopOnce();
+    }
+
+    EXPECT_EQ(worked.load(), kNumJobs);
+}
+
+TEST(RestWorkerPool, RunsUrgentWorkFirst)
+{
+    WorkerPool        pool(1);
+    std::atomic<bool> blocked{true};
+    std::atomic<bool> started{false};
+    std::vector<int>  order;
+    int               completed = 0;
+
+    // The only worker is kept busy until both jobs are queued.
+    pool.Run(
+        [&blocked, &started]() {
+            started = true;
+            while (blocked)
+            {
+                std::this_thread::yield();
+            }
+        },
+        [&completed]() { ++completed; });
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+
+    pool.Run([&order]() { order.push_back(1); }, [&completed]() { ++completed; });
+    pool.Run([&order]() { order.push_back(2); }, [&completed]() { ++completed; }, /* aUrgent */ true);
+    EXPECT_EQ(pool.GetQueuedCount(), 2u);
+    blocked = false;
+
+    while (completed < 3)
+    {
+        RunMainloopOnce();
+    }
+
+    EXPECT_EQ(order, (std::vector<int>{2, 1}));
+    EXPECT_EQ(pool.GetQueuedCount(), 0u);
+}
@@ -0,0 +1,191 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "utils/scan_cache.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+using otbr::Milliseconds;
+using otbr::ScanCache;
+using otbr::Timepoint;
+
+using IntScanCache = ScanCache<int>;
+
+struct ScanRecorder
+{
+    IntScanCache::Handler GetHandler(void)
+    {
+        return [this](otError aError, const std::vector<int> &aResults) {
+            mDoneCount++;
+            mError   = aError;
+            mResults = aResults;
+        };
+    }
+    IntScanCache::ResultHandler GetResultHandler(void)
+    {
+        return [this](const int &aResult) { mStreamed.push_back(aResult); };
+    }
+
+    int              mDoneCount = 0;
+    otError          mError     = OT_ERROR_FAILED;
+    std::vector<int> mResults;
+    std::vector<int> mStreamed;
+};
+
+TEST(ScanCache, TestConcurrentRequestsShareOneScan)
+{
+    IntScanCache cache(Milliseconds(1000));
+    Timepoint    now = Timepoint();
+    ScanRecorder first;
+    ScanRecorder second;
+
+    EXPECT_EQ(cache.AddRequest(0, first.GetHandler(), first.GetResultHandler(), now), IntScanCache::kStartScan);
+    EXPECT_TRUE(cache.IsScanning());
+    cache.HandleResult(1);
+
+    // The request joining the scan receives the results reported before it joined.
+    EXPECT_EQ(cache.AddRequest(0, second.GetHandler(), second.GetResultHandler(), now), IntScanCache::kJoined);
+    EXPECT_THAT(second.mStreamed, ElementsAre(1));
+    cache.HandleResult(2);
+
+    EXPECT_THAT(first.mStreamed, ElementsAre(1, 2));
+    EXPECT_THAT(second.mStreamed, ElementsAre(1, 2));
+    EXPECT_EQ(first.mDoneCount, 0);
+
+    cache.HandleDone(OT_ERROR_NONE);
+    EXPECT_FALSE(cache.IsScanning());
+    for (const ScanRecorder *recorder : {&first, &second})
+    {
+        EXPECT_EQ(recorder->mDoneCount, 1);
+        EXPECT_EQ(recorder->mError, OT_ERROR_NONE);
+        EXPECT_THAT(recorder->mResults, ElementsAre(1, 2));
+    }
+}
+
+TEST(ScanCache, TestRecentResultsAreServedFromCache)
+{
+    IntScanCache cache(Milliseconds(1000));
+    Timepoint    now = Timepoint();
+    ScanRecorder first;
+    ScanRecorder cached;
+    ScanRecorder expired;
+
+    ASSERT_EQ(cache.AddRequest(0, first.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+    cache.HandleResult(7);
+    cache.HandleDone(OT_ERROR_NONE);
+
+    EXPECT_EQ(cache.AddRequest(0, cached.GetHandler(), cached.GetResultHandler(), now + Milliseconds(999)),
+              IntScanCache::kCached);
+    EXPECT_FALSE(cache.IsScanning());
+    EXPECT_EQ(cached.mDoneCount, 1);
+    EXPECT_THAT(cached.mResults, ElementsAre(7));
+    EXPECT_THAT(cached.mStreamed, ElementsAre(7));
+
+    EXPECT_EQ(cache.AddRequest(0, expired.GetHandler(), nullptr, now + Milliseconds(1000)), IntScanCache::kStartScan);
+    EXPECT_EQ(expired.mDoneCount, 0);
+
+    // The results of the expired scan are not reported to the new one.
+    cache.HandleResult(8);
+    cache.HandleDone(OT_ERROR_NONE);
+    EXPECT_THAT(expired.mResults, ElementsAre(8));
+}
+
+TEST(ScanCache, TestFailedScanIsNotCached)
+{
+    IntScanCache cache(Milliseconds(1000));
+    Timepoint    now = Timepoint();
+    ScanRecorder failed;
+    ScanRecorder retry;
+
+    ASSERT_EQ(cache.AddRequest(0, failed.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+    cache.HandleResult(1);
+    cache.HandleDone(OT_ERROR_ABORT);
+    EXPECT_EQ(failed.mError, OT_ERROR_ABORT);
+    EXPECT_THAT(failed.mResults, IsEmpty());
+
+    EXPECT_EQ(cache.AddRequest(0, retry.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+}
+
+TEST(ScanCache, TestParameterMismatch)
+{
+    IntScanCache cache(Milliseconds(1000));
+    Timepoint    now = Timepoint();
+    ScanRecorder recorder;
+
+    ASSERT_EQ(cache.AddRequest(100, recorder.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+    EXPECT_EQ(cache.AddRequest(200, recorder.GetHandler(), nullptr, now), IntScanCache::kBusy);
+    cache.HandleDone(OT_ERROR_NONE);
+    EXPECT_EQ(recorder.mDoneCount, 1);
+
+    EXPECT_EQ(cache.AddRequest(200, recorder.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+}
+
+TEST(ScanCache, TestZeroMaxAgeDisablesCache)
+{
+    IntScanCache cache(Milliseconds(0));
+    Timepoint    now = Timepoint();
+    ScanRecorder recorder;
+
+    ASSERT_EQ(cache.AddRequest(0, recorder.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+    cache.HandleDone(OT_ERROR_NONE);
+    EXPECT_EQ(cache.AddRequest(0, recorder.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+}
+
+TEST(ScanCache, TestHandlerStartingAnotherScan)
+{
+    IntScanCache cache(Milliseconds(0));
+    Timepoint    now = Timepoint();
+    ScanRecorder next;
+    int          doneCount = 0;
+
+    ASSERT_EQ(cache.AddRequest(
+                  0,
+                  [&](otError, const std::vector<int> &aResults) {
+                      doneCount++;
+                      EXPECT_THAT(aResults, ElementsAre(1));
+                      EXPECT_EQ(cache.AddRequest(0, next.GetHandler(), nullptr, now), IntScanCache::kStartScan);
+                  },
+                  nullptr, now),
+              IntScanCache::kStartScan);
+    cache.HandleResult(1);
+    cache.HandleDone(OT_ERROR_NONE);
+
+    // The request added by the handler belongs to the new scan.
+    EXPECT_EQ(doneCount, 1);
+    EXPECT_EQ(next.mDoneCount, 0);
+    EXPECT_TRUE(cache.IsScanning());
+    cache.HandleDone(OT_ERROR_NONE);
+    EXPECT_EQ(next.mDoneCount, 1);
+    EXPECT_THAT(next.mResults, IsEmpty());
+}
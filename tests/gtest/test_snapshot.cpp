@@ -0,0 +1,163 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "utils/snapshot.hpp"
+
+using otbr::Seconds;
+using otbr::Utils::SnapshotHeader;
+using otbr::Utils::SnapshotReader;
+using otbr::Utils::SnapshotWriter;
+
+class SnapshotTest : public testing::Test
+{
+protected:
+    void SetUp(void) override
+    {
+        char path[] = "/tmp/otbr-snapshot-XXXXXX";
+        int  fd     = mkstemp(path);
+
+        ASSERT_GE(fd, 0);
+        close(fd);
+        mPath = path;
+    }
+
+    void TearDown(void) override { unlink(mPath.c_str()); }
+
+    std::vector<uint8_t> ReadFile(void) const
+    {
+        std::vector<uint8_t> data;
+        FILE                *file = fopen(mPath.c_str(), "rb");
+        int                  c;
+
+        while (file != nullptr && (c = fgetc(file)) != EOF)
+        {
+            data.push_back(static_cast<uint8_t>(c));
+        }
+
+        if (file != nullptr)
+        {
+            fclose(file);
+        }
+
+        return data;
+    }
+
+    void WriteFile(const std::vector<uint8_t> &aData) const
+    {
+        FILE *file = fopen(mPath.c_str(), "wb");
+
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(fwrite(aData.data(), 1, aData.size(), file), aData.size());
+        fclose(file);
+    }
+
+    std::string mPath;
+};
+
+TEST_F(SnapshotTest, TestSaveAndLoad)
+{
+    SnapshotWriter           writer;
+    SnapshotReader           reader;
+    std::vector<std::string> values;
+
+    writer.AddRecord(1, "wpan0", 5);
+    writer.AddRecord(2, "a", 1);
+    writer.AddRecord(2, "", 0);
+    writer.AddRecord(2, "bcdef", 5);
+    ASSERT_EQ(writer.Save(mPath), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(reader.Load(mPath, Seconds(60)), OTBR_ERROR_NONE);
+    reader.ForEachRecord(2, [&values](const uint8_t *aValue, uint16_t aLength) {
+        values.emplace_back(reinterpret_cast<const char *>(aValue), aLength);
+    });
+    EXPECT_EQ(values, (std::vector<std::string>{"a", "", "bcdef"}));
+
+    values.clear();
+    reader.ForEachRecord(1, [&values](const uint8_t *aValue, uint16_t aLength) {
+        values.emplace_back(reinterpret_cast<const char *>(aValue), aLength);
+    });
+    EXPECT_EQ(values, (std::vector<std::string>{"wpan0"}));
+}
+
+TEST_F(SnapshotTest, TestRejectInvalidSnapshot)
+{
+    SnapshotWriter       writer;
+    SnapshotReader       reader;
+    std::vector<uint8_t> data;
+    SnapshotHeader       header;
+    bool                 called = false;
+
+    unlink(mPath.c_str());
+    EXPECT_EQ(reader.Load(mPath, Seconds(60)), OTBR_ERROR_NOT_FOUND);
+
+    writer.AddRecord(1, "wpan0", 5);
+    ASSERT_EQ(writer.Save(mPath), OTBR_ERROR_NONE);
+    data = ReadFile();
+    ASSERT_GT(data.size(), sizeof(header));
+
+    // Corrupted record.
+    data.back() ^= 0xff;
+    WriteFile(data);
+    EXPECT_EQ(reader.Load(mPath, Seconds(60)), OTBR_ERROR_PARSE);
+    data.back() ^= 0xff;
+
+    // Truncated records.
+    WriteFile(std::vector<uint8_t>(data.begin(), data.end() - 1));
+    EXPECT_EQ(reader.Load(mPath, Seconds(60)), OTBR_ERROR_PARSE);
+
+    // Another version.
+    memcpy(&header, data.data(), sizeof(header));
+    header.mVersion++;
+    memcpy(data.data(), &header, sizeof(header));
+    WriteFile(data);
+    EXPECT_EQ(reader.Load(mPath, Seconds(60)), OTBR_ERROR_PARSE);
+
+    // Too old.
+    header.mVersion--;
+    header.mSaveTime -= 61;
+    memcpy(data.data(), &header, sizeof(header));
+    WriteFile(data);
+    EXPECT_EQ(reader.Load(mPath, Seconds(60)), OTBR_ERROR_PARSE);
+
+    reader.ForEachRecord(1, [&called](const uint8_t *, uint16_t) { called = true; });
+    EXPECT_FALSE(called);
+
+    EXPECT_EQ(reader.Load(mPath, Seconds(120)), OTBR_ERROR_NONE);
+    reader.ForEachRecord(1, [&called](const uint8_t *, uint16_t) { called = true; });
+    EXPECT_TRUE(called);
+}
@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "common/startup_stats.hpp"
+
+using otbr::Microseconds;
+using otbr::StartupStats;
+
+TEST(StartupStats, TestSyncAndAsyncStages)
+{
+    StartupStats stats;
+
+    stats.BeginStage("async");
+    stats.RunStage("sync", []() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+    ASSERT_EQ(stats.GetStages().size(), 2u);
+    EXPECT_FALSE(stats.IsCompleted());
+    EXPECT_FALSE(stats.GetStages()[0].mCompleted);
+    EXPECT_TRUE(stats.GetStages()[1].mCompleted);
+    EXPECT_GE(stats.GetStages()[1].mDuration, Microseconds(2000));
+    EXPECT_GE(stats.GetStages()[1].mBeginTime, stats.GetStages()[0].mBeginTime);
+
+    stats.EndStage("async");
+    EXPECT_TRUE(stats.IsCompleted());
+    EXPECT_GE(stats.GetStages()[0].mDuration, stats.GetStages()[1].mDuration);
+    EXPECT_EQ(stats.GetDuration(), stats.GetStages()[0].mBeginTime + stats.GetStages()[0].mDuration);
+}
+
+TEST(StartupStats, TestEndStageOnce)
+{
+    StartupStats stats;
+    Microseconds duration;
+
+    // A stage not begun is ignored.
+    stats.EndStage("mdns");
+    EXPECT_TRUE(stats.GetStages().empty());
+    EXPECT_TRUE(stats.IsCompleted());
+
+    stats.BeginStage("mdns");
+    stats.EndStage("mdns");
+    duration = stats.GetStages()[0].mDuration;
+
+    // Completing a stage again does not change it, e.g. when the mDNS publisher becomes ready again.
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    stats.EndStage("mdns");
+    EXPECT_EQ(stats.GetStages()[0].mDuration, duration);
+
+    stats.Restart();
+    EXPECT_TRUE(stats.GetStages().empty());
+    EXPECT_EQ(stats.GetDuration(), Microseconds(0));
+}
@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "utils/crc16.hpp"
+#include "utils/steering_data.hpp"
+
+using ::testing::ElementsAreArray;
+
+TEST(Crc16, TestCheckValues)
+{
+    const uint8_t input[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    otbr::Crc16   ccitt(otbr::Crc16::kCcitt);
+    otbr::Crc16   ansi(otbr::Crc16::kAnsi);
+
+    ccitt.Update(input, sizeof(input));
+    EXPECT_EQ(ccitt.Get(), 0x31c3);
+
+    for (uint8_t byte : input)
+    {
+        ansi.Update(byte);
+    }
+    EXPECT_EQ(ansi.Get(), 0xfee8);
+}
+
+TEST(SteeringData, TestBulkBloomFilter)
+{
+    static constexpr uint16_t kNumJoiners = 40;
+
+    std::vector<uint8_t> joinerIds;
+    otbr::SteeringData   bulk;
+    otbr::SteeringData   single;
+
+    for (uint16_t i = 0; i < kNumJoiners; i++)
+    {
+        uint8_t eui64[otbr::SteeringData::kSizeJoinerId] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00};
+        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+
+        eui64[6] = static_cast<uint8_t>(i >> 8);
+        eui64[7] = static_cast<uint8_t>(i);
+        otbr::SteeringData::ComputeJoinerId(eui64, joinerId);
+        joinerIds.insert(joinerIds.end(), joinerId, joinerId + sizeof(joinerId));
+    }
+
+    for (uint8_t length = 1; length <= otbr::SteeringData::kMaxSizeOfBloomFilter; length++)
+    {
+        bulk.Init(length);
+        single.Init(length);
+
+        bulk.ComputeBloomFilter(joinerIds.data(), kNumJoiners);
+        for (uint16_t i = 0; i < kNumJoiners; i++)
+        {
+            single.ComputeBloomFilter(&joinerIds[i * otbr::SteeringData::kSizeJoinerId]);
+        }
+
+        EXPECT_THAT(std::vector<uint8_t>(bulk.GetBloomFilter(), bulk.GetBloomFilter() + length),
+                    ElementsAreArray(single.GetBloomFilter(), length));
+    }
+}
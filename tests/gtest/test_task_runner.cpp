@@ -27,6 +27,7 @@
  */
 
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <thread>
 
@@ -347,3 +348,227 @@ TEST(TaskRunner, TestAllAPIs)
 
     EXPECT_EQ(30, counter.load());
 }
+
+static void RunTaskRunnerOnce(otbr::TaskRunner &aTaskRunner)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+    aTaskRunner.Process(mainloop);
+}
+
+TEST(TaskRunner, TestTimerWheelTasksOrder)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner(otbr::TaskRunner::Mode::kTimerWheel);
+
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('a'); });
+    taskRunner.Post(std::chrono::milliseconds(9), [&]() { str.push_back('b'); });
+    taskRunner.Post([&]() { str.push_back('c'); });
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('d'); });
+
+    while (str.size() < 4)
+    {
+        RunTaskRunnerOnce(taskRunner);
+    }
+
+    // Make sure that tasks with smaller delay are executed earlier.
+    EXPECT_STREQ("cbad", str.c_str());
+}
+
+TEST(TaskRunner, TestTimerWheelCancelTasks)
+{
+    std::string              str;
+    otbr::TaskRunner         taskRunner(otbr::TaskRunner::Mode::kTimerWheel);
+    otbr::TaskRunner::TaskId tid1, tid2, tid3;
+
+    tid1 = taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('a'); });
+    tid2 = taskRunner.Post(std::chrono::milliseconds(20), [&]() { str.push_back('b'); });
+    tid3 = taskRunner.Post(std::chrono::milliseconds(30), [&]() { str.push_back('c'); });
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { taskRunner.Cancel(tid3); });
+
+    // Delays longer than one round of the wheel wait in the overflow of the wheel.
+    taskRunner.Post(std::chrono::milliseconds(5000), [&]() { str.push_back('x'); });
+    taskRunner.Post(std::chrono::milliseconds(40), [&]() { str.push_back('d'); });
+
+    taskRunner.Cancel(tid2);
+
+    while (str.size() < 2)
+    {
+        RunTaskRunnerOnce(taskRunner);
+    }
+
+    EXPECT_STREQ("ad", str.c_str());
+
+    // Make sure it's fine to cancel expired task IDs.
+    taskRunner.Cancel(tid1);
+    taskRunner.Cancel(tid2);
+}
+
+TEST(TaskRunner, TestTimerWheelLaterRoundTimeout)
+{
+    otbr::TaskRunner         taskRunner(otbr::TaskRunner::Mode::kTimerWheel);
+    otbr::MainloopContext    mainloop;
+    otbr::TaskRunner::TaskId taskId;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {100, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    // A task of a later round of the wheel must not wake up the mainloop before its deadline.
+    taskId = taskRunner.Post(std::chrono::milliseconds(10000), []() {});
+    taskRunner.Update(mainloop);
+    EXPECT_GE(mainloop.mTimeout.tv_sec, 9);
+    EXPECT_LE(mainloop.mTimeout.tv_sec, 10);
+
+    taskRunner.Cancel(taskId);
+    EXPECT_EQ(taskRunner.GetPendingTaskCount(), 0u);
+
+    mainloop.mTimeout = {100, 0};
+    taskRunner.Update(mainloop);
+    EXPECT_EQ(mainloop.mTimeout.tv_sec, 100);
+}
+
+TEST(TaskRunner, TestImmediateTasksOverflow)
+{
+    static constexpr int kThreadCount = 4;
+    static constexpr int kTaskCount   = 5000;
+
+    otbr::TaskRunner         taskRunner;
+    std::vector<std::thread> threads;
+    std::vector<int>         lastTasks(kThreadCount, -1);
+    std::atomic<int>         executed{0};
+    bool                     ordered = true;
+
+    // Post far more tasks than the lock-free queue can hold before running the mainloop.
+    for (int thread = 0; thread < kThreadCount; thread++)
+    {
+        threads.emplace_back([&, thread]() {
+            for (int i = 0; i < kTaskCount; i++)
+            {
+                taskRunner.Post([&, thread, i]() {
+                    ordered           = ordered && (lastTasks[thread] + 1 == i);
+                    lastTasks[thread] = i;
+                    ++executed;
+                });
+            }
+        });
+    }
+
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    while (executed.load() < kThreadCount * kTaskCount)
+    {
+        RunTaskRunnerOnce(taskRunner);
+    }
+
+    // Make sure the tasks of each thread are executed in the order of posting.
+    EXPECT_TRUE(ordered);
+}
+
+TEST(TaskRunner, TestPriorityTasksOrder)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner;
+
+    taskRunner.Post(otbr::TaskRunner::Priority::kBackground, [&]() { str.push_back('x'); });
+    taskRunner.Post([&]() { str.push_back('c'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kCritical, [&]() { str.push_back('a'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kBackground, [&]() { str.push_back('y'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kNormal, [&]() { str.push_back('d'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kCritical, [&]() { str.push_back('b'); });
+
+    RunTaskRunnerOnce(taskRunner);
+
+    // The lanes are executed by priority, the tasks of a lane in the order of posting.
+    EXPECT_EQ(str, "abcdxy");
+}
+
+TEST(TaskRunner, TestDelayedPriorityTasksOrder)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner;
+
+    taskRunner.Post(otbr::TaskRunner::Priority::kBackground, std::chrono::milliseconds(10),
+                    [&]() { str.push_back('c'); });
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('b'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kCritical, std::chrono::milliseconds(10),
+                    [&]() { str.push_back('a'); });
+
+    // All the tasks are due in the same iteration.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    RunTaskRunnerOnce(taskRunner);
+
+    EXPECT_EQ(str, "bac");
+}
+
+TEST(TaskRunner, TestBackgroundTasksNotStarved)
+{
+    otbr::TaskRunner      taskRunner;
+    std::atomic<bool>     stopped(false);
+    int                   iterations         = 0;
+    int                   backgroundExecuted = 0;
+    int                   backgroundOrder    = 0;
+    bool                  ordered            = true;
+    std::function<void()> repostNormal;
+    std::function<void()> repostCritical;
+
+    // The normal and critical lanes are never empty.
+    repostNormal = [&]() {
+        if (!stopped)
+        {
+            taskRunner.Post(repostNormal);
+        }
+    };
+    repostCritical = [&]() {
+        if (!stopped)
+        {
+            taskRunner.Post(otbr::TaskRunner::Priority::kCritical, repostCritical);
+        }
+    };
+    taskRunner.Post(repostNormal);
+    taskRunner.Post(otbr::TaskRunner::Priority::kCritical, repostCritical);
+
+    for (int i = 0; i < 4 * OTBR_TASK_RUNNER_BACKGROUND_BUDGET; i++)
+    {
+        taskRunner.Post(otbr::TaskRunner::Priority::kBackground, [&, i]() {
+            ordered = ordered && (backgroundOrder++ == i);
+            ++backgroundExecuted;
+        });
+    }
+
+    // Each iteration executes at most its budget of background tasks, and keeps the mainloop awake until they're done.
+    while (backgroundExecuted < 4 * OTBR_TASK_RUNNER_BACKGROUND_BUDGET)
+    {
+        int executed = backgroundExecuted;
+
+        RunTaskRunnerOnce(taskRunner);
+        ++iterations;
+        EXPECT_LE(backgroundExecuted - executed, OTBR_TASK_RUNNER_BACKGROUND_BUDGET);
+        ASSERT_LE(iterations, 4);
+    }
+
+    stopped = true;
+    RunTaskRunnerOnce(taskRunner);
+
+    EXPECT_EQ(4, iterations);
+    EXPECT_TRUE(ordered);
+}
@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The allocation tests of the Task Runner.
+ *
+ *   They are built into their own executable, because counting the allocations replaces `malloc()` for the whole
+ *   program.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/select.h>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "common/task_runner.hpp"
+
+#ifdef __GLIBC__
+extern "C" void *__libc_malloc(size_t aSize);
+
+// Counts the heap allocations of each thread, `operator new` allocates through `malloc()`.
+static thread_local size_t sAllocationCount = 0;
+
+extern "C" void *malloc(size_t aSize)
+{
+    ++sAllocationCount;
+
+    return __libc_malloc(aSize);
+}
+
+#define SKIP_UNLESS_COUNTING_ALLOCATIONS()
+#else
+static size_t sAllocationCount = 0;
+
+#define SKIP_UNLESS_COUNTING_ALLOCATIONS() GTEST_SKIP() << "The allocations are only counted with glibc"
+#endif
+
+static void RunTaskRunnerOnce(otbr::TaskRunner &aTaskRunner)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+    aTaskRunner.Process(mainloop);
+}
+
+TEST(TaskRunnerAllocation, TestPostWithoutAllocation)
+{
+    SKIP_UNLESS_COUNTING_ALLOCATIONS();
+
+    otbr::TaskRunner taskRunner;
+    int              counter = 0;
+    size_t           allocationCount;
+
+    // Let any lazily initialized state be allocated first.
+    taskRunner.Post([&counter]() { ++counter; });
+    RunTaskRunnerOnce(taskRunner);
+
+    allocationCount = sAllocationCount;
+
+    for (int i = 0; i < 100; i++)
+    {
+        taskRunner.Post([&counter, i]() { counter += i; });
+    }
+
+    RunTaskRunnerOnce(taskRunner);
+
+    EXPECT_EQ(allocationCount, sAllocationCount);
+    EXPECT_EQ(1 + 99 * 100 / 2, counter);
+}
+
+TEST(TaskRunnerAllocation, TestPostAndWaitWithoutAllocation)
+{
+    SKIP_UNLESS_COUNTING_ALLOCATIONS();
+
+    otbr::TaskRunner taskRunner;
+    bool             done                    = false;
+    size_t           mainloopAllocationCount = 0;
+    size_t           clientAllocationCount   = 0;
+    int              sum                     = 0;
+
+    std::thread client([&]() {
+        size_t allocationCount = sAllocationCount;
+
+        for (int i = 0; i < 100; i++)
+        {
+            sum += taskRunner.PostAndWait<int>([i]() { return i; });
+        }
+
+        clientAllocationCount = sAllocationCount - allocationCount;
+        taskRunner.Post([&done]() { done = true; });
+    });
+
+    while (!done)
+    {
+        size_t allocationCount = sAllocationCount;
+
+        RunTaskRunnerOnce(taskRunner);
+        mainloopAllocationCount += sAllocationCount - allocationCount;
+    }
+
+    client.join();
+
+    EXPECT_EQ(0u, clientAllocationCount);
+    EXPECT_EQ(0u, mainloopAllocationCount);
+    EXPECT_EQ(99 * 100 / 2, sum);
+}
@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/task_runner.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+long long ElapsedUs(Clock::time_point aStart)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - aStart).count();
+}
+
+void RunBenchmark(otbr::TaskRunner::Mode aMode, const char *aModeName, size_t aTimerCount)
+{
+    static constexpr int kUpdateCount = 1000;
+
+    otbr::TaskRunner                      taskRunner(aMode);
+    std::vector<otbr::TaskRunner::TaskId> taskIds;
+    std::mt19937                          random(aTimerCount);
+    std::uniform_int_distribution<int>    delay(1000, 60000);
+    Clock::time_point                     start;
+    long long                             postUs;
+    long long                             updateUs;
+    long long                             cancelUs;
+    int                                   executed = 0;
+
+    taskIds.reserve(aTimerCount);
+
+    start = Clock::now();
+    for (size_t i = 0; i < aTimerCount; i++)
+    {
+        taskIds.push_back(taskRunner.Post(std::chrono::milliseconds(delay(random)), [&executed]() { executed++; }));
+    }
+    postUs = ElapsedUs(start);
+
+    start = Clock::now();
+    for (int i = 0; i < kUpdateCount; i++)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {100, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        EXPECT_LE(mainloop.mTimeout.tv_sec, 60);
+    }
+    updateUs = ElapsedUs(start);
+
+    start = Clock::now();
+    for (otbr::TaskRunner::TaskId taskId : taskIds)
+    {
+        taskRunner.Cancel(taskId);
+    }
+    cancelUs = ElapsedUs(start);
+
+    EXPECT_EQ(executed, 0);
+
+    printf("TaskRunner %-10s timers=%-7zu post=%8lldus update(x%d)=%8lldus cancel=%8lldus\n", aModeName, aTimerCount,
+           postUs, kUpdateCount, updateUs, cancelUs);
+}
+
+} // namespace
+
+TEST(TaskRunnerBenchmark, TestDelayedTasks)
+{
+    for (size_t timerCount : {10000, 100000})
+    {
+        RunBenchmark(otbr::TaskRunner::Mode::kHeap, "heap", timerCount);
+        RunBenchmark(otbr::TaskRunner::Mode::kTimerWheel, "timerwheel", timerCount);
+    }
+}
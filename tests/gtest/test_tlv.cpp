@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/tlv.hpp"
+
+using otbr::TlvEditor;
+using otbr::TlvIterator;
+using otbr::TlvView;
+
+TEST(TlvView, IteratesTlvsInPlace)
+{
+    const uint8_t        tlvs[] = {0x01, 0x02, 0xaa, 0xbb, 0x02, 0x00, 0x03, 0x01, 0xcc};
+    std::vector<uint8_t> types;
+
+    for (const TlvIterator &tlv : TlvView(tlvs, sizeof(tlvs)))
+    {
+        types.push_back(tlv.GetType());
+    }
+
+    EXPECT_EQ(types, (std::vector<uint8_t>{1, 2, 3}));
+    EXPECT_TRUE(TlvView(tlvs, sizeof(tlvs)).IsWellFormed());
+}
+
+TEST(TlvView, FindsTlvByType)
+{
+    const uint8_t tlvs[] = {0x01, 0x02, 0xaa, 0xbb, 0x03, 0x01, 0xcc};
+    TlvIterator   tlv(nullptr, 0);
+
+    ASSERT_TRUE(TlvView(tlvs, sizeof(tlvs)).Find(3, tlv));
+    EXPECT_EQ(tlv.GetLength(), 1);
+    EXPECT_EQ(tlv.GetValue(), &tlvs[6]);
+    EXPECT_EQ(tlv.GetSize(), 3u);
+    EXPECT_FALSE(TlvView(tlvs, sizeof(tlvs)).Find(2, tlv));
+}
+
+TEST(TlvView, StopsAtOverrunningTlv)
+{
+    const uint8_t tlvs[] = {0x01, 0x01, 0xaa, 0x02, 0x05, 0xbb};
+    int           count  = 0;
+    TlvIterator   tlv(nullptr, 0);
+
+    for (const TlvIterator &it : TlvView(tlvs, sizeof(tlvs)))
+    {
+        EXPECT_EQ(it.GetType(), 1);
+        count++;
+    }
+
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(TlvView(tlvs, sizeof(tlvs)).IsWellFormed());
+    EXPECT_FALSE(TlvView(tlvs, sizeof(tlvs)).Find(2, tlv));
+
+    // A truncated header is not a TLV either.
+    EXPECT_FALSE(TlvView(tlvs, 4).IsWellFormed());
+    EXPECT_TRUE(TlvView(tlvs, 0).IsWellFormed());
+}
+
+TEST(TlvView, ReadsExtendedLength)
+{
+    std::vector<uint8_t> tlvs = {0x07, 0xff, 0x01, 0x00};
+    TlvIterator          tlv(nullptr, 0);
+
+    tlvs.resize(tlvs.size() + 256, 0x5a);
+    ASSERT_TRUE(TlvView(tlvs.data(), tlvs.size()).Find(7, tlv));
+    EXPECT_EQ(tlv.GetLength(), 256);
+    EXPECT_EQ(tlv.GetValue(), tlvs.data() + 4);
+    EXPECT_TRUE(TlvView(tlvs.data(), tlvs.size()).IsWellFormed());
+}
+
+TEST(TlvEditor, ReplacesTlvOfSameLengthInPlace)
+{
+    uint8_t   tlvs[16] = {0x01, 0x01, 0xaa, 0x34, 0x04, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0xcc};
+    TlvEditor editor(tlvs, 12, sizeof(tlvs));
+
+    EXPECT_EQ(editor.SetUint32(0x34, 300000), OTBR_ERROR_NONE);
+    EXPECT_EQ(editor.GetLength(), 12u);
+
+    const uint8_t expected[] = {0x01, 0x01, 0xaa, 0x34, 0x04, 0x00, 0x04, 0x93, 0xe0, 0x03, 0x01, 0xcc};
+    EXPECT_EQ(0, memcmp(tlvs, expected, sizeof(expected)));
+}
+
+TEST(TlvEditor, ResizesTlvAndMovesFollowingTlvs)
+{
+    uint8_t   tlvs[16] = {0x01, 0x01, 0xaa, 0x02, 0x01, 0xbb, 0x03, 0x01, 0xcc};
+    TlvEditor editor(tlvs, 9, sizeof(tlvs));
+    uint8_t   value[]  = {0x11, 0x22, 0x33};
+
+    EXPECT_EQ(editor.Set(0x02, value, sizeof(value)), OTBR_ERROR_NONE);
+    EXPECT_EQ(editor.GetLength(), 11u);
+
+    const uint8_t grown[] = {0x01, 0x01, 0xaa, 0x02, 0x03, 0x11, 0x22, 0x33, 0x03, 0x01, 0xcc};
+    EXPECT_EQ(0, memcmp(tlvs, grown, sizeof(grown)));
+
+    EXPECT_EQ(editor.Set(0x02, nullptr, 0), OTBR_ERROR_NONE);
+    EXPECT_EQ(editor.GetLength(), 8u);
+
+    const uint8_t shrunk[] = {0x01, 0x01, 0xaa, 0x02, 0x00, 0x03, 0x01, 0xcc};
+    EXPECT_EQ(0, memcmp(tlvs, shrunk, sizeof(shrunk)));
+}
+
+TEST(TlvEditor, AppendsAndRemovesTlv)
+{
+    uint8_t   tlvs[16] = {0x01, 0x01, 0xaa, 0x03, 0x01, 0xcc};
+    TlvEditor editor(tlvs, 6, sizeof(tlvs));
+
+    EXPECT_EQ(editor.SetUint64(0x33, 0x0102030405060708), OTBR_ERROR_NONE);
+    EXPECT_EQ(editor.GetLength(), 16u);
+
+    const uint8_t appended[] = {0x01, 0x01, 0xaa, 0x03, 0x01, 0xcc, 0x33, 0x08,
+                                0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    EXPECT_EQ(0, memcmp(tlvs, appended, sizeof(appended)));
+
+    EXPECT_EQ(editor.Remove(0x01), OTBR_ERROR_NONE);
+    EXPECT_EQ(editor.GetLength(), 13u);
+    EXPECT_EQ(0, memcmp(tlvs, appended + 3, 13));
+    EXPECT_EQ(editor.Remove(0x01), OTBR_ERROR_NOT_FOUND);
+}
+
+TEST(TlvEditor, RejectsEditsWhichDontFit)
+{
+    uint8_t   tlvs[8]  = {0x01, 0x01, 0xaa};
+    uint8_t   value[7] = {};
+    TlvEditor editor(tlvs, 3, sizeof(tlvs));
+
+    EXPECT_EQ(editor.SetUint32(0x34, 1), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(editor.GetLength(), 3u);
+    EXPECT_EQ(editor.Set(0x01, value, sizeof(value)), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(editor.GetLength(), 3u);
+}
+
+TEST(TlvEditor, RejectsMalformedTlvs)
+{
+    uint8_t   tlvs[8] = {0x01, 0x05, 0xaa};
+    TlvEditor editor(tlvs, 3, sizeof(tlvs));
+
+    EXPECT_EQ(editor.SetUint32(0x34, 1), OTBR_ERROR_PARSE);
+    EXPECT_EQ(editor.Remove(0x01), OTBR_ERROR_PARSE);
+    EXPECT_EQ(editor.GetLength(), 3u);
+}
@@ -30,13 +30,16 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
 #include <netinet/in.h>
 #include <signal.h>
+#include <sys/resource.h>
 
 #include <functional>
 #include <vector>
@@ -45,12 +48,18 @@
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/memory_stats.hpp"
 #include "mdns/mdns.hpp"
 
+#include "samples.hpp"
+
 using namespace otbr;
 using namespace otbr::Mdns;
+using otbr::Benchmark::Clock;
+using otbr::Benchmark::Samples;
 
-static Publisher *sPublisher = nullptr;
+static Publisher *sPublisher       = nullptr;
+static bool       sMainloopStopped = false;
 
 typedef std::function<void(void)> TestRunner;
 
@@ -58,19 +67,18 @@ int RunMainloop(void)
 {
     int rval = 0;
 
-    while (true)
+    while (!sMainloopStopped)
     {
         MainloopContext mainloop;
 
         mainloop.mMaxFd   = -1;
-        mainloop.mTimeout = {INT_MAX, INT_MAX};
+        mainloop.mTimeout = {INT_MAX, 0};
         FD_ZERO(&mainloop.mReadFdSet);
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
         MainloopManager::GetInstance().Update(mainloop);
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      (mainloop.mTimeout.tv_sec == INT_MAX ? nullptr : &mainloop.mTimeout));
+        rval = MainloopManager::GetInstance().Poll(mainloop);
 
         if (rval < 0)
         {
@@ -362,6 +370,524 @@ void PublishKeyWithServiceRemoved(void)
         });
 }
 
+static const char *GetBackendName(void)
+{
+#if OTBR_ENABLE_MDNS_AVAHI
+    return "avahi";
+#elif OTBR_ENABLE_MDNS_MDNSSD
+    return "mDNSResponder";
+#else
+    return "unknown";
+#endif
+}
+
+static void PrintMemory(const char *aName)
+{
+    MemoryStats::HeapUsage usage = MemoryStats::GetHeapUsage();
+    struct rusage          rusage;
+
+    getrusage(RUSAGE_SELF, &rusage);
+    printf("%-24s rss %8" PRIu64 " kB   peak rss %8ld kB\n", aName, usage.mResidentBytes / 1024, rusage.ru_maxrss);
+}
+
+/**
+ * This class implements a capacity benchmark of the SRP Advertising Proxy.
+ *
+ * It replays the SRP updates of a number of hosts with a number of services each the way `AdvertisingProxy` advertises
+ * them: an update publishes the host and all its services, and completes when all their callbacks are invoked. The
+ * hosts are registered, updated with new TXT data and removed, and for each round it reports the time-to-advertised
+ * of the updates, the peak number of outstanding updates and the resident set size of the process.
+ *
+ */
+class SrpProxyBenchmark
+{
+public:
+    SrpProxyBenchmark(uint32_t aHostCount, uint32_t aServiceCount, uint32_t aWindow)
+        : mHostCount(aHostCount)
+        , mServiceCount(aServiceCount)
+        , mWindow(aWindow)
+        , mRound(kRegister)
+        , mStarted(false)
+        , mIssuing(false)
+        , mNextHost(0)
+        , mCompletedCount(0)
+        , mOutstandingCount(0)
+        , mPeakOutstandingCount(0)
+        , mErrorCount(0)
+        , mTotalErrorCount(0)
+        , mUpdates(aHostCount)
+        , mSamples(aHostCount)
+    {
+    }
+
+    void Start(void)
+    {
+        VerifyOrExit(!mStarted);
+        mStarted = true;
+
+        printf("SRP proxy benchmark: %s, %" PRIu32 " hosts x %" PRIu32 " services, window %" PRIu32 "\n",
+               GetBackendName(), mHostCount, mServiceCount, mWindow);
+        PrintMemory("initial");
+        StartRound(kRegister);
+
+    exit:
+        return;
+    }
+
+    uint64_t GetErrorCount(void) const { return mTotalErrorCount; }
+
+private:
+    enum Round : uint8_t
+    {
+        kRegister,
+        kUpdate,
+        kRemove,
+        kDone,
+    };
+
+    struct Update
+    {
+        Clock::time_point mStartTime;
+        uint32_t          mCallbackCount = 0;
+        bool              mFailed        = false;
+    };
+
+    static const char *GetRoundName(Round aRound)
+    {
+        static const char *const kRoundNames[] = {"srp register", "srp update", "srp remove"};
+
+        return kRoundNames[aRound];
+    }
+
+    static std::string GetHostName(uint32_t aHost) { return "srp-bench-host-" + std::to_string(aHost); }
+
+    static std::string GetServiceName(uint32_t aHost, uint32_t aService)
+    {
+        return "srp-bench-" + std::to_string(aHost) + "-" + std::to_string(aService);
+    }
+
+    void StartRound(Round aRound)
+    {
+        mRound                = aRound;
+        mNextHost             = 0;
+        mCompletedCount       = 0;
+        mPeakOutstandingCount = 0;
+        mErrorCount           = 0;
+        mSamples              = Samples(mHostCount);
+        mRoundStartTime       = Clock::now();
+
+        if (mRound == kDone)
+        {
+            sMainloopStopped = true;
+        }
+        else
+        {
+            IssueUpdates();
+        }
+    }
+
+    void IssueUpdates(void)
+    {
+        // Results invoked while issuing the updates must not issue the next ones recursively.
+        VerifyOrExit(!mIssuing);
+        mIssuing = true;
+
+        while (mNextHost < mHostCount && (mWindow == 0 || mOutstandingCount < mWindow))
+        {
+            AdvertiseHost(mNextHost++);
+        }
+
+        mIssuing = false;
+
+        if (mCompletedCount == mHostCount)
+        {
+            FinishRound();
+        }
+
+    exit:
+        return;
+    }
+
+    void AdvertiseHost(uint32_t aHost)
+    {
+        Update            &update                          = mUpdates[aHost];
+        std::string        hostName                        = GetHostName(aHost);
+        std::string        round                           = std::to_string(mRound);
+        uint8_t            hostAddr[OTBR_IP6_ADDRESS_SIZE] = {0xfd, 0x00, 0x0d, 0xb8};
+        Publisher::TxtData txtData;
+        Publisher::TxtList txtList{
+            {"rn", round.c_str()},
+            {"tv", "1.3.0"},
+        };
+
+        hostAddr[12] = static_cast<uint8_t>(aHost >> 24);
+        hostAddr[13] = static_cast<uint8_t>(aHost >> 16);
+        hostAddr[14] = static_cast<uint8_t>(aHost >> 8);
+        hostAddr[15] = static_cast<uint8_t>(aHost);
+
+        Publisher::EncodeTxtData(txtList, txtData);
+
+        update.mStartTime     = Clock::now();
+        update.mCallbackCount = mServiceCount + 1;
+        update.mFailed        = false;
+
+        mOutstandingCount++;
+        mPeakOutstandingCount = std::max(mPeakOutstandingCount, mOutstandingCount);
+
+        for (uint32_t service = 0; service < mServiceCount; service++)
+        {
+            if (mRound == kRemove)
+            {
+                sPublisher->UnpublishService(GetServiceName(aHost, service), "_srpbench._udp",
+                                             [this, aHost](otbrError aError) { HandleResult(aHost, aError); });
+            }
+            else
+            {
+                sPublisher->PublishService(hostName, GetServiceName(aHost, service), "_srpbench._udp",
+                                           Publisher::SubTypeList{}, static_cast<uint16_t>(49152 + service), txtData,
+                                           [this, aHost](otbrError aError) { HandleResult(aHost, aError); });
+            }
+        }
+
+        if (mRound == kRemove)
+        {
+            sPublisher->UnpublishHost(hostName, [this, aHost](otbrError aError) { HandleResult(aHost, aError); });
+        }
+        else
+        {
+            sPublisher->PublishHost(hostName, {Ip6Address(hostAddr)},
+                                    [this, aHost](otbrError aError) { HandleResult(aHost, aError); });
+        }
+    }
+
+    void HandleResult(uint32_t aHost, otbrError aError)
+    {
+        Update &update = mUpdates[aHost];
+
+        // Like `AdvertisingProxy`, removing a name which isn't published is a success.
+        if (aError != OTBR_ERROR_NONE && !(mRound == kRemove && aError == OTBR_ERROR_NOT_FOUND))
+        {
+            otbrLogWarning("SRP update of %s failed: %s", GetHostName(aHost).c_str(), otbrErrorString(aError));
+            update.mFailed = true;
+        }
+
+        VerifyOrExit(--update.mCallbackCount == 0);
+
+        if (update.mFailed)
+        {
+            mErrorCount++;
+        }
+        else
+        {
+            mSamples.Add(Clock::now() - update.mStartTime);
+        }
+
+        mOutstandingCount--;
+        mCompletedCount++;
+        IssueUpdates();
+
+    exit:
+        return;
+    }
+
+    void FinishRound(void)
+    {
+        mSamples.Print(GetRoundName(mRound), mHostCount, Clock::now() - mRoundStartTime, mErrorCount);
+        printf("%-24s peak outstanding %" PRIu32 "\n", GetRoundName(mRound), mPeakOutstandingCount);
+        PrintMemory(GetRoundName(mRound));
+
+        mTotalErrorCount += mErrorCount;
+        StartRound(static_cast<Round>(mRound + 1));
+    }
+
+    uint32_t            mHostCount;
+    uint32_t            mServiceCount;
+    uint32_t            mWindow;
+    Round               mRound;
+    bool                mStarted;
+    bool                mIssuing;
+    uint32_t            mNextHost;
+    uint32_t            mCompletedCount;
+    uint32_t            mOutstandingCount;
+    uint32_t            mPeakOutstandingCount;
+    uint64_t            mErrorCount;
+    uint64_t            mTotalErrorCount;
+    std::vector<Update> mUpdates;
+    Samples             mSamples;
+    Clock::time_point   mRoundStartTime;
+};
+
+otbrError TestSrpProxyBenchmark(int aArgCount, char *aArgVector[])
+{
+    otbrError         error        = OTBR_ERROR_NONE;
+    uint32_t          hostCount    = aArgCount > 2 ? static_cast<uint32_t>(strtoul(aArgVector[2], nullptr, 0)) : 500;
+    uint32_t          serviceCount = aArgCount > 3 ? static_cast<uint32_t>(strtoul(aArgVector[3], nullptr, 0)) : 4;
+    uint32_t          window       = aArgCount > 4 ? static_cast<uint32_t>(strtoul(aArgVector[4], nullptr, 0)) : 0;
+    SrpProxyBenchmark benchmark(hostCount, serviceCount, window);
+
+    otbrLogSetLevel(OTBR_LOG_WARNING);
+
+    sPublisher = Publisher::Create([&benchmark](Publisher::State aState) {
+        if (aState == Publisher::State::kReady)
+        {
+            benchmark.Start();
+        }
+    });
+    SuccessOrExit(error = sPublisher->Start());
+    VerifyOrExit(RunMainloop() >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(benchmark.GetErrorCount() == 0, error = OTBR_ERROR_MDNS);
+
+exit:
+    Publisher::Destroy(sPublisher);
+    return error;
+}
+
+/**
+ * This class implements a benchmark of the mDNS publisher.
+ *
+ * It publishes, updates and unpublishes a number of hosts, keys and services, in this order and with at most a given
+ * number of outstanding operations, so that runs are reproducible. For each phase it reports the throughput, the
+ * distribution of the callback latencies and the number of requests sent to the mDNS daemon. The publications are
+ * not paced, so that the mDNS implementation is measured rather than the pace of the publisher.
+ *
+ */
+class PublisherBenchmark
+{
+public:
+    PublisherBenchmark(uint32_t aCount, uint32_t aWindow)
+        : mCount(aCount)
+        , mWindow(aWindow)
+        , mPhase(kPublishHosts)
+        , mStarted(false)
+        , mIssuing(false)
+        , mNextIndex(0)
+        , mCompletedCount(0)
+        , mErrorCount(0)
+        , mTotalErrorCount(0)
+        , mPhaseDaemonRequests(0)
+        , mStartTimes(aCount)
+        , mSamples(aCount)
+    {
+    }
+
+    void Start(void)
+    {
+        VerifyOrExit(!mStarted);
+        mStarted = true;
+
+        sPublisher->SetPublicationPace(0, 0);
+        printf("mDNS publisher benchmark: %s, %" PRIu32 " names, window %" PRIu32 "\n", GetBackendName(), mCount,
+               mWindow);
+        StartPhase(kPublishHosts);
+
+    exit:
+        return;
+    }
+
+    uint64_t GetErrorCount(void) const { return mTotalErrorCount; }
+
+private:
+    enum Phase : uint8_t
+    {
+        kPublishHosts,
+        kPublishKeys,
+        kPublishServices,
+        kUpdateServices,
+        kUpdateHosts,
+        kUnpublishServices,
+        kUnpublishKeys,
+        kUnpublishHosts,
+        kDone,
+    };
+
+    static const char *GetPhaseName(Phase aPhase)
+    {
+        static const char *const kPhaseNames[] = {
+            "publish host",   "publish key",       "publish service", "update service",
+            "update host",    "unpublish service", "unpublish key",   "unpublish host",
+        };
+
+        return kPhaseNames[aPhase];
+    }
+
+    static std::string GetHostName(uint32_t aIndex) { return "bench-host-" + std::to_string(aIndex); }
+
+    static std::string GetServiceName(uint32_t aIndex) { return "bench-service-" + std::to_string(aIndex); }
+
+    static Ip6Address GetHostAddress(uint32_t aIndex, uint8_t aVersion)
+    {
+        uint8_t address[OTBR_IP6_ADDRESS_SIZE] = {0xfd, 0x00, 0x0d, 0xb8};
+
+        address[11] = aVersion;
+        address[12] = static_cast<uint8_t>(aIndex >> 24);
+        address[13] = static_cast<uint8_t>(aIndex >> 16);
+        address[14] = static_cast<uint8_t>(aIndex >> 8);
+        address[15] = static_cast<uint8_t>(aIndex);
+
+        return Ip6Address(address);
+    }
+
+    static Publisher::TxtData GetTxtData(uint32_t aIndex, uint8_t aVersion)
+    {
+        std::string        index   = std::to_string(aIndex);
+        std::string        version = std::to_string(aVersion);
+        Publisher::TxtData txtData;
+        Publisher::TxtList txtList{
+            {"id", index.c_str()},
+            {"vn", version.c_str()},
+        };
+
+        Publisher::EncodeTxtData(txtList, txtData);
+
+        return txtData;
+    }
+
+    void StartPhase(Phase aPhase)
+    {
+        mPhase               = aPhase;
+        mNextIndex           = 0;
+        mCompletedCount      = 0;
+        mErrorCount          = 0;
+        mSamples             = Samples(mCount);
+        mPhaseDaemonRequests = sPublisher->GetMdnsTelemetryInfo().mDaemonRequests;
+        mPhaseStartTime      = Clock::now();
+
+        if (mPhase == kDone)
+        {
+            sMainloopStopped = true;
+        }
+        else
+        {
+            IssueOperations();
+        }
+    }
+
+    void IssueOperations(void)
+    {
+        // Results invoked while issuing the operations must not issue the next ones recursively.
+        VerifyOrExit(!mIssuing);
+        mIssuing = true;
+
+        while (mNextIndex < mCount && (mWindow == 0 || mNextIndex - mCompletedCount < mWindow))
+        {
+            IssueOperation(mNextIndex++);
+        }
+
+        mIssuing = false;
+
+        if (mCompletedCount == mCount)
+        {
+            FinishPhase();
+        }
+
+    exit:
+        return;
+    }
+
+    void IssueOperation(uint32_t aIndex)
+    {
+        Publisher::ResultCallback callback([this, aIndex](otbrError aError) { HandleResult(aIndex, aError); });
+        std::vector<uint8_t>      keyData(32, static_cast<uint8_t>(aIndex));
+
+        mStartTimes[aIndex] = Clock::now();
+
+        switch (mPhase)
+        {
+        case kPublishHosts:
+        case kUpdateHosts:
+            sPublisher->PublishHost(GetHostName(aIndex), {GetHostAddress(aIndex, mPhase == kUpdateHosts)},
+                                    std::move(callback));
+            break;
+        case kPublishKeys:
+            sPublisher->PublishKey(GetHostName(aIndex), keyData, std::move(callback));
+            break;
+        case kPublishServices:
+        case kUpdateServices:
+            sPublisher->PublishService(GetHostName(aIndex), GetServiceName(aIndex), "_bench._udp",
+                                       Publisher::SubTypeList{}, static_cast<uint16_t>(49152 + aIndex % 16384),
+                                       GetTxtData(aIndex, mPhase == kUpdateServices), std::move(callback));
+            break;
+        case kUnpublishServices:
+            sPublisher->UnpublishService(GetServiceName(aIndex), "_bench._udp", std::move(callback));
+            break;
+        case kUnpublishKeys:
+            sPublisher->UnpublishKey(GetHostName(aIndex), std::move(callback));
+            break;
+        case kUnpublishHosts:
+            sPublisher->UnpublishHost(GetHostName(aIndex), std::move(callback));
+            break;
+        case kDone:
+            break;
+        }
+    }
+
+    void HandleResult(uint32_t aIndex, otbrError aError)
+    {
+        if (aError == OTBR_ERROR_NONE)
+        {
+            mSamples.Add(Clock::now() - mStartTimes[aIndex]);
+        }
+        else
+        {
+            otbrLogWarning("%s %" PRIu32 " failed: %s", GetPhaseName(mPhase), aIndex, otbrErrorString(aError));
+            mErrorCount++;
+        }
+
+        mCompletedCount++;
+        IssueOperations();
+    }
+
+    void FinishPhase(void)
+    {
+        uint32_t requests = sPublisher->GetMdnsTelemetryInfo().mDaemonRequests - mPhaseDaemonRequests;
+
+        mSamples.Print(GetPhaseName(mPhase), mCount, Clock::now() - mPhaseStartTime, mErrorCount);
+        printf("%-24s daemon requests %" PRIu32 " (%.2f per operation)\n", GetPhaseName(mPhase), requests,
+               mCount > 0 ? static_cast<double>(requests) / mCount : 0.0);
+
+        mTotalErrorCount += mErrorCount;
+        StartPhase(static_cast<Phase>(mPhase + 1));
+    }
+
+    uint32_t                       mCount;
+    uint32_t                       mWindow;
+    Phase                          mPhase;
+    bool                           mStarted;
+    bool                           mIssuing;
+    uint32_t                       mNextIndex;
+    uint32_t                       mCompletedCount;
+    uint64_t                       mErrorCount;
+    uint64_t                       mTotalErrorCount;
+    uint32_t                       mPhaseDaemonRequests;
+    std::vector<Clock::time_point> mStartTimes;
+    Samples                        mSamples;
+    Clock::time_point              mPhaseStartTime;
+};
+
+otbrError TestPublisherBenchmark(int aArgCount, char *aArgVector[])
+{
+    otbrError          error     = OTBR_ERROR_NONE;
+    uint32_t           count     = aArgCount > 2 ? static_cast<uint32_t>(strtoul(aArgVector[2], nullptr, 0)) : 2000;
+    uint32_t           window    = aArgCount > 3 ? static_cast<uint32_t>(strtoul(aArgVector[3], nullptr, 0)) : 64;
+    PublisherBenchmark benchmark(count, window);
+
+    otbrLogSetLevel(OTBR_LOG_WARNING);
+
+    sPublisher = Publisher::Create([&benchmark](Publisher::State aState) {
+        if (aState == Publisher::State::kReady)
+        {
+            benchmark.Start();
+        }
+    });
+    SuccessOrExit(error = sPublisher->Start());
+    VerifyOrExit(RunMainloop() >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(benchmark.GetErrorCount() == 0, error = OTBR_ERROR_MDNS);
+
+exit:
+    Publisher::Destroy(sPublisher);
+    return error;
+}
+
 otbrError Test(TestRunner aTestRunner)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -521,6 +1047,14 @@ int main(int argc, char *argv[])
         ret = TestStopService();
         break;
 
+    case 'p':
+        ret = TestSrpProxyBenchmark(argc, argv);
+        break;
+
+    case '-':
+        ret = strcmp(argv[1], "--bench") == 0 ? TestPublisherBenchmark(argc, argv) : 1;
+        break;
+
     case 'y':
         ret = Test(PublishKey);
         break;
@@ -36,6 +36,16 @@
 #define MBEDTLS_HAVE_ASM
 #endif
 
+// Use the AES and SHA-256 instructions of the CPU when they are present, the software implementations are kept as
+// fallback for the CPUs without them.
+#if defined(__x86_64__) && defined(MBEDTLS_HAVE_ASM)
+#define MBEDTLS_AESNI_C
+#endif
+#if defined(__aarch64__)
+#define MBEDTLS_AESCE_C
+#define MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT
+#endif
+
 #define MBEDTLS_AES_ROM_TABLES
 #define MBEDTLS_ECP_DP_SECP256R1_ENABLED
 #define MBEDTLS_ECP_NIST_OPTIM
@@ -67,7 +77,6 @@
 #define MBEDTLS_PK_HAVE_ECC_KEYS
 #define MBEDTLS_PK_PARSE_C
 #define MBEDTLS_SHA256_C
-#define MBEDTLS_SHA256_SMALLER
 #define MBEDTLS_SSL_COOKIE_C
 #define MBEDTLS_SSL_CLI_C
 #define MBEDTLS_SSL_SRV_C
@@ -0,0 +1,81 @@
+/*
+ *    Copyright (c) 2024-2018, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a simple tool to format binary log files.
+ */
+
+#define OTBR_LOG_TAG "LOGDEC"
+
+#include <stdio.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include "common/binary_log.hpp"
+#include "common/code_utils.hpp"
+
+void help(void)
+{
+    printf("log-decoder - format a binary log file\n"
+           "SYNTAX:\n"
+           "    log-decoder <BINARY_LOG_FILE>\n"
+           "EXAMPLE:\n"
+           "    log-decoder /var/log/otbr-agent.binlog\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int                   ret = 0;
+    otbr::BinaryLogReader reader;
+    otbrError             error;
+    std::string           text;
+
+    VerifyOrExit(argc == 2, ret = EX_USAGE);
+
+    error = reader.Open(argv[1]);
+    VerifyOrExit(error == OTBR_ERROR_NONE,
+                 fprintf(stderr, "Failed to open %s: %s\n", argv[1], otbrErrorString(error)), ret = EX_NOINPUT);
+
+    while ((error = reader.ReadNext(text)) == OTBR_ERROR_NONE)
+    {
+        printf("%s\n", text.c_str());
+    }
+
+    // A binary log file which is still being written may end with a partial message.
+    VerifyOrExit(error == OTBR_ERROR_NOT_FOUND, fprintf(stderr, "Truncated or malformed binary log\n"),
+                 ret = EX_DATAERR);
+
+exit:
+    if (ret == EX_USAGE)
+    {
+        help();
+    }
+
+    return ret;
+}
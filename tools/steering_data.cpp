@@ -36,6 +36,8 @@
 #include <stdlib.h>
 #include <sysexits.h>
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/steering_data.hpp"
@@ -72,10 +74,11 @@ exit:
 
 int main(int argc, char *argv[])
 {
-    otbr::SteeringData computer;
-    int                ret    = EX_USAGE;
-    int                length = 16;
-    int                i      = 1;
+    otbr::SteeringData   computer;
+    std::vector<uint8_t> joinerIds;
+    int                  ret    = EX_USAGE;
+    int                  length = 16;
+    int                  i      = 1;
 
     if (argc < 2)
     {
@@ -98,8 +101,10 @@ int main(int argc, char *argv[])
         uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
 
         VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+        joinerIds.insert(joinerIds.end(), joinerId, joinerId + sizeof(joinerId));
     }
+    computer.ComputeBloomFilter(joinerIds.data(),
+                                static_cast<uint16_t>(joinerIds.size() / otbr::SteeringData::kSizeJoinerId));
 
     for (i = 0; i < length; i++)
     {